@@ -0,0 +1,87 @@
+"""
+Run the on-device benchmark suites ({"cmd":"bench"}) and compare builds.
+
+Usage:
+    python bench.py COM6                          # all suites
+    python bench.py COM6 --suite decode
+    python bench.py COM6 --save before.json       # baseline, then reflash...
+    python bench.py COM6 --compare before.json    # ...and diff against it
+    python bench.py --wifi sensecap.local
+"""
+import argparse
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(__file__))
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "..", "pipeline"))
+
+BENCH_TIMEOUT = 60
+
+
+def run_bench(link, suite):
+    """Send the bench command and wait (suites take a few seconds)."""
+    line = json.dumps({"cmd": "bench", "suite": suite}, separators=(",", ":"))
+    if hasattr(link, "ser"):
+        link.ser.write((line + "\n").encode())
+        return link._read_response(timeout=BENCH_TIMEOUT)
+    link.send_raw_line(line)
+    return link._read_until_status(timeout=BENCH_TIMEOUT)
+
+
+def lower_is_better(key):
+    return key.endswith("_ms") or key.endswith("_us")
+
+
+def print_report(results, baseline=None):
+    for suite, values in results.items():
+        print(f"\n[{suite}]")
+        for key, val in values.items():
+            line = f"  {key:<22} {val:>10}"
+            base = (baseline or {}).get(suite, {}).get(key)
+            if base not in (None, 0) and isinstance(val, (int, float)) and val >= 0:
+                change = (val - base) / base * 100
+                better = (change < 0) == lower_is_better(key)
+                mark = "better" if better and abs(change) >= 2 else "worse" if abs(change) >= 2 else ""
+                line += f"   was {base:>10}  {change:+6.1f}%  {mark}"
+            print(line)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="SenseCAP on-device benchmarks")
+    ap.add_argument("port", nargs="?", default="COM6")
+    ap.add_argument("--wifi", help="Use WiFi TCP (IP or hostname) instead of serial")
+    ap.add_argument("--suite", default="all",
+                    help="copy, fill, draw, decode, face, parse or all")
+    ap.add_argument("--save", help="Write results to this JSON file")
+    ap.add_argument("--compare", help="Baseline JSON file from an earlier --save")
+    args = ap.parse_args()
+
+    if args.wifi:
+        from wifi_link import WiFiLink
+        link = WiFiLink(args.wifi)
+        link.drain_boot(wait=0.5)
+    else:
+        from sensecap_controller import SenseCapController
+        link = SenseCapController(args.port)
+
+    resp = run_bench(link, args.suite)
+    link.close()
+    if resp.get("status") != "ok":
+        print(f"Bench failed: {resp}")
+        sys.exit(1)
+
+    baseline = None
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+    print_report(resp["results"], baseline)
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(resp["results"], f, indent=2)
+        print(f"\nSaved to {args.save}")
+
+
+if __name__ == "__main__":
+    main()
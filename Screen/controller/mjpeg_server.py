@@ -0,0 +1,199 @@
+"""
+Serve an MJPEG stream (multipart/x-mixed-replace) over HTTP, for the
+device to pull with {"cmd":"mjpeg","url":...}: a webcam, a folder of
+JPEGs in a loop, or a generated test pattern. Every client gets the
+newest frame; slow ones skip frames rather than lag.
+
+Usage:
+    python mjpeg_server.py                     # test pattern on :8080
+    python mjpeg_server.py --camera 0 --fps 20
+    python mjpeg_server.py --images frames/ --no-length
+    python mjpeg_server.py --device COM6       # ...and point the device at it
+
+MjpegServer can also be used from a script: publish() each new JPEG.
+"""
+import argparse
+import io
+import os
+import socket
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+sys.path.insert(0, os.path.dirname(__file__))
+
+from PIL import Image, ImageDraw
+
+BOUNDARY = "frame"
+
+
+class MjpegServer:
+    """Threaded HTTP server that streams the last published JPEG to every
+    client. content_length=False leaves Content-Length out of the part
+    headers, like many minimal servers do."""
+
+    def __init__(self, port=8080, content_length=True):
+        self._cond = threading.Condition()
+        self._frame = None
+        self._seq = 0
+        self._closed = False
+        self.content_length = content_length
+        server = self
+
+        class Handler(BaseHTTPRequestHandler):
+            def do_GET(self):
+                server._serve(self)
+
+            def log_message(self, fmt, *args):
+                pass
+
+        self.httpd = ThreadingHTTPServer(("", port), Handler)
+        self.httpd.daemon_threads = True
+        self.port = self.httpd.server_address[1]
+        self._thread = threading.Thread(target=self.httpd.serve_forever, daemon=True)
+        self._thread.start()
+
+    def publish(self, jpeg_bytes):
+        """Make jpeg_bytes the current frame."""
+        with self._cond:
+            self._frame = jpeg_bytes
+            self._seq += 1
+            self._cond.notify_all()
+
+    def close(self):
+        """Stop serving; open streams end after their current frame."""
+        with self._cond:
+            self._closed = True
+            self._cond.notify_all()
+        self.httpd.shutdown()
+        self.httpd.server_close()
+
+    @staticmethod
+    def local_ip(peer="8.8.8.8"):
+        """This host's address as seen on the way to peer (no packet is sent)."""
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+            s.connect((peer, 80))
+            return s.getsockname()[0]
+
+    def url(self, peer="8.8.8.8"):
+        return f"http://{self.local_ip(peer)}:{self.port}/"
+
+    def _serve(self, req):
+        req.send_response(200)
+        req.send_header("Content-Type", f"multipart/x-mixed-replace; boundary={BOUNDARY}")
+        req.send_header("Cache-Control", "no-cache")
+        req.end_headers()
+        seq = 0
+        try:
+            while True:
+                with self._cond:
+                    self._cond.wait_for(lambda: self._seq != seq or self._closed)
+                    if self._closed:
+                        break
+                    frame, seq = self._frame, self._seq
+                head = f"--{BOUNDARY}\r\nContent-Type: image/jpeg\r\n"
+                if self.content_length:
+                    head += f"Content-Length: {len(frame)}\r\n"
+                req.wfile.write(head.encode() + b"\r\n" + frame + b"\r\n")
+                req.wfile.flush()
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+
+
+def encode(img, quality):
+    buf = io.BytesIO()
+    img.save(buf, format="JPEG", quality=quality)
+    return buf.getvalue()
+
+
+def pattern_frames(quality):
+    """Test pattern: a moving bar and a frame counter."""
+    i = 0
+    while True:
+        img = Image.new("RGB", (480, 480), (20, 20, 40))
+        draw = ImageDraw.Draw(img)
+        x = (i * 8) % 480
+        draw.rectangle([x, 0, x + 40, 479], fill=(255, 105, 180))
+        draw.text((200, 230), f"frame {i}", fill=(255, 255, 255))
+        yield encode(img, quality)
+        i += 1
+
+
+def image_frames(folder):
+    """JPEGs in a folder, in name order, looped."""
+    names = sorted(n for n in os.listdir(folder) if n.lower().endswith((".jpg", ".jpeg")))
+    if not names:
+        raise SystemExit(f"no JPEGs in {folder}")
+    data = []
+    for name in names:
+        with open(os.path.join(folder, name), "rb") as f:
+            data.append(f.read())
+    while True:
+        yield from data
+
+
+def camera_frames(index, quality):
+    """Webcam frames (needs opencv-python), cropped square to 480x480."""
+    import cv2
+    cap = cv2.VideoCapture(index)
+    if not cap.isOpened():
+        raise SystemExit(f"cannot open camera {index}")
+    while True:
+        ok, frame = cap.read()
+        if not ok:
+            time.sleep(0.05)
+            continue
+        h, w = frame.shape[:2]
+        s = min(w, h)
+        frame = cv2.resize(frame[(h - s) // 2:(h + s) // 2, (w - s) // 2:(w + s) // 2], (480, 480))
+        yield cv2.imencode(".jpg", frame, [cv2.IMWRITE_JPEG_QUALITY, quality])[1].tobytes()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--port", type=int, default=8080)
+    src = ap.add_mutually_exclusive_group()
+    src.add_argument("--camera", type=int, help="webcam index")
+    src.add_argument("--images", help="folder of JPEGs to loop")
+    ap.add_argument("--fps", type=float, default=15)
+    ap.add_argument("--quality", type=int, default=70)
+    ap.add_argument("--no-length", action="store_true", help="leave out Content-Length")
+    ap.add_argument("--device", help="also tell the device on this serial port to pull the stream")
+    args = ap.parse_args()
+
+    if args.camera is not None:
+        frames = camera_frames(args.camera, args.quality)
+    elif args.images:
+        frames = image_frames(args.images)
+    else:
+        frames = pattern_frames(args.quality)
+
+    server = MjpegServer(args.port, content_length=not args.no_length)
+    print(f"Serving MJPEG at {server.url()}")
+    ctrl = None
+    if args.device:
+        from sensecap_controller import SenseCapController
+        ctrl = SenseCapController(args.device)
+        ip = ctrl.send_cmd({"cmd": "wifi"}).get("ip")
+        url = server.url(ip if ip and ip != "none" else "8.8.8.8")
+        print("Device:", ctrl.mjpeg_start(url))
+
+    try:
+        period = 1.0 / args.fps
+        t = time.monotonic()
+        for jpeg in frames:
+            server.publish(jpeg)
+            t += period
+            time.sleep(max(0.0, t - time.monotonic()))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if ctrl:
+            print("Device:", ctrl.mjpeg_stop())
+            ctrl.close()
+        server.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -14,27 +14,45 @@ Usage:
     ctrl.close()
 """
 
+import array
 import io
 import json
+import struct
+import sys
 import time
+import zlib
 import serial
 import serial.tools.list_ports
 
 try:
-    from PIL import Image
+    from PIL import Image, ImageChops
 except ImportError:
     Image = None  # Pillow optional; needed only for show_image()
 
 # Display resolution
 DISPLAY_W = 480
 DISPLAY_H = 480
+
+# Tile delta updates: 16x16 tiles, changed-tile bitmap size
+TILE = 16
+TILES_X = DISPLAY_W // TILE
+TILES_Y = DISPLAY_H // TILE
+TILE_MAP_BYTES = (TILES_X * TILES_Y + 7) // 8
+
+# Stream mode frame header magic
+STREAM_MAGIC = b"SCFR"
+STREAM_MAGIC_TS = b"SCFT"
+
+# Chunked transfer: chunk header magic, retransmit rounds the device allows
+CHUNK_MAGIC = b"SCCH"
+CHUNK_ROUNDS = 8
 BAUD = 921600
 
 
 class SenseCapController:
     """Controller for SenseCAP Indicator via CH340 UART."""
 
-    def __init__(self, port=None, baud=BAUD, timeout=3, wait_ready=False):
+    def __init__(self, port=None, baud=BAUD, timeout=3, wait_ready=False, chunk=None):
         """
         Connect to the SenseCAP Indicator.
 
@@ -44,11 +62,18 @@ class SenseCapController:
             baud:  Baud rate (default 921600).
             timeout: Serial read timeout in seconds.
             wait_ready: If True, block until device sends "ready".
+            chunk: Send image payloads in chunks of this many bytes
+                   (256-32768, e.g. 4096), each with a CRC; the device
+                   asks again for just the damaged ones. None sends
+                   them as plain bytes.
         """
         if port is None:
             port = self._auto_detect_port()
 
         self.port = port
+        self._stream_crc = False
+        self._tile_base = None      # RGB565 frame the device shows (tiles)
+        self.chunk = chunk
         self.ser = serial.Serial(port, baud, timeout=timeout)
         time.sleep(0.5)
         self.ser.reset_input_buffer()
@@ -108,6 +133,41 @@ class SenseCapController:
         self.ser.flush()
         return self._read_response()
 
+    def _send_payload(self, cmd, data, timeout=15):
+        """
+        Send a command that carries a payload: wait for "ready", send
+        the bytes (chunked if self.chunk is set) and return the final
+        reply.
+        """
+        if self.chunk:
+            cmd["chunk"] = self.chunk
+        resp = self.send_cmd(cmd)
+        if resp.get("status") != "ready":
+            return resp
+        if not self.chunk:
+            self.ser.write(data)
+            self.ser.flush()
+            return self._read_response(timeout=timeout)
+
+        # Every chunk, then the ones the device reports missing
+        resend = range((len(data) + self.chunk - 1) // self.chunk)
+        for _ in range(CHUNK_ROUNDS):
+            for seq in resend:
+                self.ser.write(self.encode_chunk(data, seq, self.chunk))
+            self.ser.flush()
+            resp = self._read_response(timeout=timeout)
+            if resp.get("status") != "nack":
+                return resp
+            resend = resp["chunks"]
+        return self._read_response(timeout=timeout)
+
+    @staticmethod
+    def encode_chunk(data, seq, chunk):
+        """One chunk of a chunked transfer: magic, seq, size, bytes, CRC."""
+        part = data[seq * chunk:(seq + 1) * chunk]
+        head = struct.pack("<HH", seq, len(part))
+        return CHUNK_MAGIC + head + part + struct.pack("<I", zlib.crc32(head + part))
+
     def _read_response(self, timeout=5):
         """Read one JSON line from device."""
         deadline = time.time() + timeout
@@ -126,57 +186,442 @@ class SenseCapController:
     # Image display
     # ------------------------------------------------------------------
 
-    def show_image(self, path_or_pil, quality=85):
+    def show_image(self, path_or_pil, quality=85, transition=None, duration=None,
+                   format="jpeg", fit=None):
         """
         Display an image on the 480x480 screen.
 
         Args:
             path_or_pil: File path (str) or PIL.Image object.
             quality:     JPEG compression quality (1-100).
+            transition:  Optional "fade" or "wipe" from the current screen.
+            duration:    Transition length in ms (device default 300).
+            format:      "jpeg", or "qoi" for lossless (best for UI
+                         frames with flat areas and text).
+            fit:         None resizes to 480x480 here. "cover" sends the
+                         image at its own size and the device scales it
+                         (1/2..1/8, or 2x when smaller) and center-crops:
+                         no resize work on the host, and a 240x240 frame
+                         is a quarter of the bytes.
 
         Returns:
             Response dict from device.
         """
+        img = self._load_image(path_or_pil, resize=fit is None)
+        data = self._encode_image(img, quality, format)
+        return self.send_jpeg(data, transition, duration, format=format, fit=fit)
+
+    def _encode_image(self, img, quality, format):
+        if format == "qoi":
+            return self.qoi_encode(img)
+
+        # Encode as JPEG. A restart marker per MCU row lets the device
+        # decode the two halves on both cores (Pillow versions without
+        # the option ignore it).
+        buf = io.BytesIO()
+        img.save(buf, format="JPEG", quality=quality, restart_marker_rows=1)
+        return buf.getvalue()
+
+    def _load_image(self, path_or_pil, resize=True):
+        """File path or PIL image -> 480x480 RGB (cover + center crop),
+        or RGB at its own size with resize=False."""
         if Image is None:
             raise RuntimeError("Pillow is required: pip install Pillow")
-
-        # Load image
         if isinstance(path_or_pil, str):
             img = Image.open(path_or_pil)
         else:
             img = path_or_pil
+        if not resize:
+            return img.convert("RGB")
+        return self._resize_cover(img.convert("RGB"), DISPLAY_W, DISPLAY_H)
 
-        # Convert to RGB, resize to 480x480 (cover + center crop)
-        img = img.convert("RGB")
-        img = self._resize_cover(img, DISPLAY_W, DISPLAY_H)
+    def send_jpeg(self, jpeg_bytes: bytes, transition=None, duration=None, format="jpeg",
+                  fit=None):
+        """
+        Send raw JPEG bytes (or QOI bytes with format="qoi") to the
+        device for display.
 
-        # Encode as JPEG
-        buf = io.BytesIO()
-        img.save(buf, format="JPEG", quality=quality)
-        jpeg_bytes = buf.getvalue()
+        The image should be 480x480; other sizes will be decoded
+        to whatever fits (clipped or padded with black), or with
+        fit="cover" scaled and center-cropped to fill the screen.
+        """
+        length = len(jpeg_bytes)
+        self._tile_base = None
 
-        return self.send_jpeg(jpeg_bytes)
+        # Step 1: send image command with length
+        cmd = {"cmd": "image", "len": length}
+        if format != "jpeg":
+            cmd["format"] = format
+        if fit:
+            cmd["fit"] = fit
+        if transition:
+            cmd["transition"] = transition
+        if duration is not None:
+            cmd["duration"] = int(duration)
+
+        # Step 2: send raw JPEG bytes once the device is ready, then wait
+        # for the decode result
+        return self._send_payload(cmd, jpeg_bytes)
 
-    def send_jpeg(self, jpeg_bytes: bytes):
+    # ------------------------------------------------------------------
+    # Image slot cache
+    # ------------------------------------------------------------------
+
+    def store(self, slot, path_or_pil, keep="frame", quality=85, format="jpeg", fit=None):
         """
-        Send raw JPEG bytes to the device for display.
+        Keep an image on the device under a name (up to 15 characters)
+        without showing it; show(slot) displays it later with no
+        transfer. Slots share a PSRAM budget (default 2 MB) and the least
+        recently used are evicted to make room.
+
+        Args:
+            keep: "frame" decodes it once (460 KB, shown with one copy);
+                  "data" keeps the compressed bytes and decodes them on
+                  each show.
+            quality, format, fit: As show_image().
 
-        The JPEG should be 480x480; other sizes will be decoded
-        to whatever fits (clipped or padded with black).
+        Returns:
+            Device reply, e.g. {"status":"ok","slot":"idle",
+            "bytes":460800,"evicted":0,"used":921600,"budget":2097152}.
         """
-        length = len(jpeg_bytes)
+        img = self._load_image(path_or_pil, resize=fit is None)
+        data = self._encode_image(img, quality, format)
+        cmd = {"cmd": "store", "slot": slot, "len": len(data), "keep": keep}
+        if format != "jpeg":
+            cmd["format"] = format
+        if fit:
+            cmd["fit"] = fit
+        return self._send_payload(cmd, data)
+
+    def show(self, slot, transition=None, duration=None):
+        """Display a stored image. Replies {"status":"error","msg":"no slot"}
+        if it was never stored or has been evicted."""
+        self._tile_base = None
+        cmd = {"cmd": "show", "slot": slot}
+        if transition:
+            cmd["transition"] = transition
+        if duration is not None:
+            cmd["duration"] = int(duration)
+        return self.send_cmd(cmd)
+
+    def evict(self, slot=None):
+        """Drop one stored image, or all of them with slot=None."""
+        cmd = {"cmd": "evict"}
+        if slot is not None:
+            cmd["slot"] = slot
+        return self.send_cmd(cmd)
+
+    def slots(self, budget=None):
+        """List stored images; budget (bytes) changes the cache size,
+        evicting least recently used slots if it shrinks."""
+        cmd = {"cmd": "slots"}
+        if budget is not None:
+            cmd["budget"] = int(budget)
+        return self.send_cmd(cmd)
+
+    def gallery(self, slots=None, cols=None, page=None, bg=None, wait=False):
+        """
+        Show JPEGs the device already holds (slots stored with
+        keep="data", or flash assets) as a grid of thumbnails. The device
+        decodes each at the JPEGDEC scale that fits its cell, one cell at
+        a time and only for the page on screen; touching a cell sends
+        {"event":"gallery_tap","slot":..,"index":..}.
 
-        # Step 1: send image command with length
-        resp = self.send_cmd({"cmd": "image", "len": length})
-        if resp.get("status") != "ready":
-            return resp
+        Args:
+            slots: Names in grid order; None takes every JPEG slot, most
+                   recently used first. Leave it out (with a gallery on
+                   screen) to turn the page or change cols / bg only.
+            cols:  1-8 columns (and rows) per page; default 3 for up to
+                   9 images, else 4.
+            page:  Page to show (0-based).
+            bg:    "#RRGGBB" around and between thumbnails.
+            wait:  Also wait for the page to finish decoding; its
+                   {"event":"gallery",..,"ms":..} is added as "done".
+
+        Returns:
+            {"status":"ok","images":N,"cols":C,"page":P,"pages":PP}.
+        """
+        cmd = {"cmd": "gallery"}
+        if slots is not None:
+            cmd["slots"] = list(slots)
+        if cols is not None:
+            cmd["cols"] = int(cols)
+        if page is not None:
+            cmd["page"] = int(page)
+        if bg:
+            cmd["bg"] = bg
+        self._tile_base = None
+        resp = self.send_cmd(cmd)
+        if wait and resp.get("status") == "ok":
+            deadline = time.time() + 10
+            while time.time() < deadline:
+                ev = self._read_response(timeout=max(0.1, deadline - time.time()))
+                if ev.get("event") == "gallery":
+                    resp["done"] = ev
+                    break
+        return resp
+
+    # ------------------------------------------------------------------
+    # Flash assets
+    # ------------------------------------------------------------------
+
+    def asset_upload(self, asset, path_or_pil, format="qoi", quality=85):
+        """
+        Write one image into the device's flash asset pack (added, or
+        replacing the asset of that name; up to 15 characters). Assets
+        survive reboots and are shown from flash without a transfer or a
+        RAM copy; one named "splash" is shown at boot. The whole pack is
+        built with tools/pack_assets.py.
+
+        Args:
+            format: "qoi", "jpeg" or "rgb565" (a raw 480x480 frame,
+                    largest but drawn with no decode). Raw JPEG / QOI
+                    bytes are sent as they are.
+
+        Returns:
+            Device reply, e.g. {"status":"ok","asset":"logo",
+            "bytes":21030,"free":4186112,"ms":180}.
+        """
+        if isinstance(path_or_pil, (bytes, bytearray)):
+            data = bytes(path_or_pil)
+        else:
+            img = self._load_image(path_or_pil)
+            data = self.to_rgb565(img) if format == "rgb565" else self._encode_image(img, quality, format)
+        cmd = {"cmd": "asset", "id": asset, "len": len(data), "format": format}
+        return self._send_payload(cmd, data, timeout=30)  # Erasing flash is slow
+
+    def asset_delete(self, asset):
+        """Remove one asset from the flash pack."""
+        return self.send_cmd({"cmd": "asset", "id": asset, "len": 0})
+
+    def assets(self):
+        """List the flash assets: {"status":"ok","size":N,"free":N,
+        "assets":[{"asset":"splash","format":"jpeg","bytes":N},...]}."""
+        return self.send_cmd({"cmd": "assets"})
+
+    def show_asset(self, asset, transition=None, duration=None, fit=None):
+        """Display a flash asset; fit="cover" fills the screen with one of
+        another size."""
+        self._tile_base = None
+        cmd = {"cmd": "show", "asset": asset}
+        if transition:
+            cmd["transition"] = transition
+        if duration is not None:
+            cmd["duration"] = int(duration)
+        if fit:
+            cmd["fit"] = fit
+        return self.send_cmd(cmd)
+
+    # ------------------------------------------------------------------
+    # Tile delta updates
+    # ------------------------------------------------------------------
+
+    def send_tiles(self, path_or_pil, codec="rle", full=False):
+        """
+        Update the screen by sending only the 16x16 tiles that differ
+        from the last send_tiles() frame, as RGB565. The first call (and
+        any after another image, clear, face or stream command, or with
+        full=True) sends every tile.
+
+        Args:
+            path_or_pil: File path (str) or PIL.Image object.
+            codec:       "rle" (run-length) or "raw".
+            full:        Send all tiles regardless of the last frame.
+
+        Returns:
+            Device reply, e.g. {"status":"ok","tiles":14,"ms":2}, plus
+            "bytes": the payload size sent.
+        """
+        frame = self.to_rgb565(self._load_image(path_or_pil))
+        base = None if full else self._tile_base
+        payload = self.encode_tiles(frame, base, codec)
+        self._tile_base = None
+
+        resp = self._send_payload({"cmd": "tiles", "len": len(payload), "codec": codec}, payload)
+        if resp.get("status") == "ok":
+            self._tile_base = frame
+        resp["bytes"] = len(payload)
+        return resp
+
+    @staticmethod
+    def to_rgb565(img):
+        """480x480 RGB PIL image -> RGB565 little-endian bytes."""
+        r, g, b = img.convert("RGB").split()
+        hi = ImageChops.add(r.point(lambda v: v & 0xF8), g.point(lambda v: v >> 5))
+        lo = ImageChops.add(g.point(lambda v: (v << 3) & 0xE0), b.point(lambda v: v >> 3))
+        return Image.merge("LA", (lo, hi)).tobytes()
+
+    @classmethod
+    def encode_tiles(cls, frame, base=None, codec="rle"):
+        """
+        Tiles payload: changed-tile bitmap, then those tiles' pixels
+        (each 16x16 row-major) as one raw or RLE stream.
+        """
+        row = DISPLAY_W * 2
+        span = TILE * 2
+        bitmap = bytearray(TILE_MAP_BYTES)
+        tiles = []
+        for ty in range(TILES_Y):
+            for tx in range(TILES_X):
+                off = ty * TILE * row + tx * span
+                rows = [frame[off + r * row:off + r * row + span] for r in range(TILE)]
+                if base is not None and all(
+                        base[off + r * row:off + r * row + span] == rows[r]
+                        for r in range(TILE)):
+                    continue
+                i = ty * TILES_X + tx
+                bitmap[i >> 3] |= 1 << (i & 7)
+                tiles.append(b"".join(rows))
+        pixels = b"".join(tiles)
+        if codec == "rle":
+            pixels = cls.rle565_encode(pixels)
+        return bytes(bitmap) + pixels
+
+    @staticmethod
+    def rle565_encode(pixels):
+        """
+        Run-length pack RGB565 LE pixels: header byte h < 0x80 is followed
+        by h + 1 literal pixels, h >= 0x80 by one pixel repeated h - 0x7E
+        times.
+        """
+        px = array.array("H")
+        px.frombytes(pixels)
+        if sys.byteorder == "big":
+            px.byteswap()
+        out = bytearray()
+        n = len(px)
+
+        def literals(a, b):
+            while a < b:
+                k = min(b - a, 128)
+                out.append(k - 1)
+                out.extend(pixels[a * 2:(a + k) * 2])
+                a += k
+
+        lit = i = 0
+        while i < n:
+            p = px[i]
+            j = i + 1
+            while j < n and j - i < 129 and px[j] == p:
+                j += 1
+            if j - i >= 2:
+                literals(lit, i)
+                out.append(0x7E + j - i)
+                out += struct.pack("<H", p)
+                lit = i = j
+            else:
+                i += 1
+        literals(lit, n)
+        return bytes(out)
 
-        # Step 2: send raw JPEG bytes
-        self.ser.write(jpeg_bytes)
+    # ------------------------------------------------------------------
+    # Stream mode
+    # ------------------------------------------------------------------
+
+    def stream_start(self, crc=False, max_latency=None, fit=None):
+        """
+        Enter stream mode: after this, send frames with stream_frame()
+        and no per-frame replies come back. The device reports
+        {"event":"stream",...} stats once a second.
+
+        Args:
+            crc: Append a CRC-32 to each frame; corrupted frames are
+                 dropped instead of shown.
+            max_latency: When frames come in faster than they decode, a
+                 waiting frame older than this (ms) is dropped for the
+                 next one. 0 shows every frame; None keeps the device
+                 default (150).
+            fit: "cover" to send frames at any size and have the device
+                 scale / center-crop them (see show_image()).
+        """
+        self._stream_crc = crc
+        self._tile_base = None
+        cmd = {"cmd": "stream", "crc": bool(crc)}
+        if max_latency is not None:
+            cmd["max_latency"] = int(max_latency)
+        if fit:
+            cmd["fit"] = fit
+        return self.send_cmd(cmd)
+
+    @staticmethod
+    def stream_clock():
+        """Host ms clock used for frame timestamps (wraps at 32 bits)."""
+        return int(time.monotonic() * 1000) & 0xFFFFFFFF
+
+    def stream_frame(self, jpeg_bytes: bytes, capture_ms=None):
+        """
+        Send one JPEG frame in stream mode (no reply).
+
+        Args:
+            capture_ms: stream_clock() when the frame was captured. The
+                 device then ages frames from it and reports the last
+                 shown one, so stream_glass_to_glass() works.
+        """
+        if capture_ms is None:
+            frame = STREAM_MAGIC + struct.pack("<I", len(jpeg_bytes))
+        else:
+            frame = STREAM_MAGIC_TS + struct.pack("<II", len(jpeg_bytes),
+                                                  capture_ms & 0xFFFFFFFF)
+        frame += jpeg_bytes
+        if self._stream_crc:
+            frame += struct.pack("<I", zlib.crc32(jpeg_bytes) & 0xFFFFFFFF)
+        self.ser.write(frame)
+
+    def stream_stop(self, timeout=10):
+        """
+        Leave stream mode. Returns the final stats, e.g.
+        {"status":"ok","frames":120,"fps":24.8,...,"crc_errors":0}.
+        """
+        self.ser.write(STREAM_MAGIC + struct.pack("<I", 0))
         self.ser.flush()
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            resp = self._read_response(timeout=max(0.1, deadline - time.time()))
+            if "status" in resp:
+                return resp
+        return {"status": "timeout"}
+
+    def stream_glass_to_glass(self, event):
+        """
+        Capture-to-screen ms of the last frame a stream event reports
+        (needs timestamped frames), or None. Includes the event's trip
+        back, so it slightly overestimates.
+        """
+        if "shown_ts" not in event:
+            return None
+        return ((self.stream_clock() - event["shown_ts"]) & 0xFFFFFFFF) - event["shown_ago"]
+
+    def mjpeg_start(self, url, fit=None):
+        """
+        Have the device pull an HTTP MJPEG stream (e.g. mjpeg_server.py,
+        mjpg-streamer) over WiFi and show its frames, newest first. The
+        link stays free for commands; {"event":"stream",...} stats come
+        once a second and {"event":"mjpeg_end","msg":..} if the server
+        ends the stream.
 
-        # Step 3: wait for decode result
-        return self._read_response(timeout=15)
+        Args:
+            url: "http://host[:port]/path", reachable from the device.
+            fit: "cover" to scale / center-crop frames of any size.
+
+        Returns:
+            {"status":"ok","boundary":..} once the stream is open.
+        """
+        self._tile_base = None
+        cmd = {"cmd": "mjpeg", "url": url}
+        if fit:
+            cmd["fit"] = fit
+        return self.send_cmd(cmd)
+
+    def mjpeg_stop(self, timeout=10):
+        """Stop pulling. Returns the final stats (as stream_stop())."""
+        self.ser.write(b'{"cmd":"mjpeg","stop":true}\n')
+        self.ser.flush()
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            resp = self._read_response(timeout=max(0.1, deadline - time.time()))
+            if "status" in resp:
+                return resp
+        return {"status": "timeout"}
 
     @staticmethod
     def _resize_cover(img, w, h):
@@ -196,18 +641,236 @@ class SenseCapController:
 
     def clear(self, color="#000000"):
         """Fill the screen with a solid color (hex string)."""
+        self._tile_base = None
         return self.send_cmd({"cmd": "clear", "color": color})
 
+    def text(self, text, x, y, size=24, color="#FFFFFF", align="left", bg=None,
+             w=None, h=None):
+        """
+        Draw text over everything on screen, rendered on the device from
+        its built-in anti-aliased fonts (16, 24, 32 or 48 px, ASCII).
+
+        Args:
+            x, y:  Top of the text; x is its left edge, center or right
+                   edge per align ("left", "center", "right").
+            w, h:  Make x, y the top-left of a w x h box that is cleared
+                   first and holds the aligned text, to redraw a changing
+                   value in place.
+            bg:    Fill the box (or the text's bounds) with this color.
+
+        Returns:
+            {"status":"ok","x":..,"y":..,"w":..,"h":..}, the area changed.
+        """
+        cmd = {"cmd": "text", "text": text, "x": int(x), "y": int(y), "size": int(size),
+               "color": color, "align": align}
+        if bg:
+            cmd["bg"] = bg
+        if w is not None:
+            cmd["w"] = int(w)
+        if h is not None:
+            cmd["h"] = int(h)
+        return self.send_cmd(cmd)
+
+    def text_clear(self, x=None, y=None, w=None, h=None):
+        """Remove all text, or only what lies in the given area."""
+        cmd = {"cmd": "text", "clear": True}
+        if w is not None:
+            cmd.update(x=int(x), y=int(y), w=int(w), h=int(h))
+        return self.send_cmd(cmd)
+
+    def sprite(self, sprite, path_or_pil, x, y, key=None):
+        """
+        Register a small image (up to 4, named up to 15 characters) that
+        the device blends into every frame it decodes from now on, at
+        x, y - so a stream can carry clean camera frames and the UI is
+        added on the device. Takes effect from the next frame.
+
+        Args:
+            path_or_pil: Image with transparency (kept as alpha), or raw
+                         QOI bytes.
+            key:         Color ("#FF00FF") to treat as transparent
+                         instead.
+
+        Returns:
+            {"status":"ok","sprites":[{"id":..,"x":..,"y":..,"w":..,"h":..}]}
+        """
+        if isinstance(path_or_pil, (bytes, bytearray)):
+            data = bytes(path_or_pil)
+        else:
+            if Image is None:
+                raise RuntimeError("Pillow is required: pip install Pillow")
+            img = Image.open(path_or_pil) if isinstance(path_or_pil, str) else path_or_pil
+            alpha = key is None and (img.mode in ("RGBA", "LA", "PA") or "transparency" in img.info)
+            data = self.qoi_encode(img, alpha=alpha)
+        cmd = {"cmd": "sprite", "id": sprite, "x": int(x), "y": int(y), "len": len(data)}
+        if key:
+            cmd["key"] = key
+        return self._send_payload(cmd, data)
+
+    def sprite_move(self, sprite, x, y):
+        """Move a sprite (from the next frame)."""
+        return self.send_cmd({"cmd": "sprite", "id": sprite, "x": int(x), "y": int(y)})
+
+    def sprite_remove(self, sprite=None):
+        """Drop one sprite, or all of them."""
+        if sprite is None:
+            return self.send_cmd({"cmd": "sprite", "clear": True})
+        return self.send_cmd({"cmd": "sprite", "id": sprite, "remove": True})
+
+    def screenshot(self, path=None, timeout=30):
+        """
+        Capture what is currently on the screen.
+
+        The device streams the frame as a QOI image in chunks.
+
+        Args:
+            path: Optional file to save to (.qoi keeps the raw stream,
+                  anything else is written by Pillow).
+
+        Returns:
+            PIL.Image (RGB), or raw QOI bytes if Pillow is missing.
+        """
+        resp = self.send_cmd({"cmd": "screenshot"})
+        if resp.get("status") != "screenshot":
+            raise RuntimeError(f"screenshot failed: {resp}")
+
+        data = bytearray()
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            resp = self._read_response(timeout=5)
+            status = resp.get("status")
+            if status == "chunk":
+                data += self.ser.read(resp["len"])
+            elif status == "ok":
+                break
+            elif status in ("error", "timeout"):
+                raise RuntimeError(f"screenshot failed: {resp}")
+            # Anything else (events) is ignored
+        else:
+            raise RuntimeError("screenshot timed out")
+
+        if path and path.lower().endswith(".qoi"):
+            with open(path, "wb") as f:
+                f.write(data)
+        if Image is None:
+            return bytes(data)
+        img = Image.frombytes("RGB", *self._qoi_decode(bytes(data)))
+        if path and not path.lower().endswith(".qoi"):
+            img.save(path)
+        return img
+
+    @staticmethod
+    def qoi_encode(img, alpha=False):
+        """
+        PIL image -> QOI bytes, with colors first reduced to what the
+        RGB565 panel shows (so nothing is lost on the device and
+        near-identical colors become runs). 3-channel, or with alpha=True
+        4-channel keeping the image's transparency (sprites).
+        """
+        mode = "RGBA" if alpha else "RGB"
+        img = img.convert(mode)
+        bands = img.split()
+        img = Image.merge(mode, (bands[0].point(lambda v: (v & 0xF8) | (v >> 5)),
+                                 bands[1].point(lambda v: (v & 0xFC) | (v >> 6)),
+                                 bands[2].point(lambda v: (v & 0xF8) | (v >> 5))) + bands[3:])
+        w, h = img.size
+        n = len(mode)
+        data = img.tobytes()
+        out = bytearray(b"qoif" + struct.pack(">II", w, h) + bytes((n, 0)))
+        index = [-1] * 64
+        pr = pg = pb = 0
+        pa = 255
+        prev = 0xFF
+        run = 0
+        for i in range(0, len(data), n):
+            r, g, b = data[i], data[i + 1], data[i + 2]
+            a = data[i + 3] if alpha else 255
+            px = (r << 24) | (g << 16) | (b << 8) | a
+            if px == prev:
+                run += 1
+                if run == 62:
+                    out.append(0xC0 | 61)
+                    run = 0
+                continue
+            if run:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            slot = (r * 3 + g * 5 + b * 7 + a * 11) % 64
+            if index[slot] == px:
+                out.append(slot)
+            else:
+                index[slot] = px
+                dr = (r - pr + 128) % 256 - 128
+                dg = (g - pg + 128) % 256 - 128
+                db = (b - pb + 128) % 256 - 128
+                if a != pa:
+                    out += bytes((0xFF, r, g, b, a))
+                elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                    out.append(0x80 | (dg + 32))
+                    out.append((dr - dg + 8) << 4 | (db - dg + 8))
+                else:
+                    out += bytes((0xFE, r, g, b))
+            prev, pr, pg, pb, pa = px, r, g, b, a
+        if run:
+            out.append(0xC0 | (run - 1))
+        return bytes(out + b"\x00" * 7 + b"\x01")
+
+    @staticmethod
+    def _qoi_decode(data):
+        """Decode a 3-channel QOI stream. Returns ((w, h), rgb_bytes)."""
+        if data[:4] != b"qoif":
+            raise ValueError("not a QOI image")
+        w = int.from_bytes(data[4:8], "big")
+        h = int.from_bytes(data[8:12], "big")
+        out = bytearray(w * h * 3)
+        index = [(0, 0, 0)] * 64
+        r, g, b = 0, 0, 0
+        pos, o, end = 14, 0, len(out)
+        while o < end:
+            op = data[pos]
+            pos += 1
+            run = 1
+            if op == 0xFE:
+                r, g, b = data[pos], data[pos + 1], data[pos + 2]
+                pos += 3
+            elif op == 0xFF:
+                r, g, b = data[pos], data[pos + 1], data[pos + 2]
+                pos += 4
+            elif op < 0x40:
+                r, g, b = index[op]
+            elif op < 0x80:
+                r = (r + ((op >> 4) & 3) - 2) & 0xFF
+                g = (g + ((op >> 2) & 3) - 2) & 0xFF
+                b = (b + (op & 3) - 2) & 0xFF
+            elif op < 0xC0:
+                dg = (op & 0x3F) - 32
+                nxt = data[pos]
+                pos += 1
+                r = (r + dg + (nxt >> 4) - 8) & 0xFF
+                g = (g + dg) & 0xFF
+                b = (b + dg + (nxt & 0x0F) - 8) & 0xFF
+            else:
+                run = (op & 0x3F) + 1
+            index[(r * 3 + g * 5 + b * 7 + 255 * 11) % 64] = (r, g, b)
+            px = bytes((r, g, b))
+            out[o:o + 3 * run] = px * run
+            o += 3 * run
+        return (w, h), bytes(out)
+
     # ------------------------------------------------------------------
     # Face mode commands
     # ------------------------------------------------------------------
 
     def face_on(self):
         """Enable animated face mode (disables image mode)."""
+        self._tile_base = None
         return self.send_cmd({"cmd": "face", "on": True})
 
     def face_off(self):
         """Disable face mode. Returns to static display."""
+        self._tile_base = None
         return self.send_cmd({"cmd": "face", "on": False})
 
     def set_mouth(self, openness):
@@ -0,0 +1,100 @@
+"""
+Display stress benchmark: max-rate JPEG streaming interleaved with face
+rendering, then report whether the RGB panel DMA underran (glitched).
+
+Usage:
+    python stress_display.py COM6 --seconds 20
+    python stress_display.py --wifi sensecap.local --bounce 0   # compare
+"""
+import argparse
+import io
+import os
+import random
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(__file__))
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "..", "pipeline"))
+
+from PIL import Image, ImageDraw
+
+
+def make_frames(count=8, quality=90):
+    """High-detail 480x480 frames so decode work (and PSRAM traffic) is maximal."""
+    frames = []
+    for i in range(count):
+        img = Image.effect_noise((480, 480), 80).convert("RGB")
+        draw = ImageDraw.Draw(img)
+        for _ in range(40):
+            x, y = random.randrange(480), random.randrange(480)
+            r = random.randrange(10, 80)
+            color = tuple(random.randrange(256) for _ in range(3))
+            draw.ellipse([x - r, y - r, x + r, y + r], outline=color, width=3)
+        buf = io.BytesIO()
+        img.save(buf, format="JPEG", quality=quality)
+        frames.append(buf.getvalue())
+    return frames
+
+
+def main():
+    ap = argparse.ArgumentParser(description="SenseCAP display stress benchmark")
+    ap.add_argument("port", nargs="?", default="COM6")
+    ap.add_argument("--wifi", help="Use WiFi TCP (IP or hostname) instead of serial")
+    ap.add_argument("--seconds", type=float, default=20.0)
+    ap.add_argument("--bounce", type=int, help="Set bounce buffer rows before the run")
+    ap.add_argument("--face-every", type=int, default=3,
+                    help="Render face for a moment after every N frames")
+    args = ap.parse_args()
+
+    if args.wifi:
+        from wifi_link import WiFiLink
+        link = WiFiLink(args.wifi)
+        link.drain_boot(wait=0.5)
+    else:
+        from sensecap_controller import SenseCapController
+        link = SenseCapController(args.port)
+
+    if args.bounce is not None:
+        print(f"Bounce rows -> {args.bounce}: {link.send_cmd({'cmd': 'display', 'bounce': args.bounce})}")
+
+    frames = make_frames()
+    print(f"Frames: {len(frames)} x ~{sum(map(len, frames)) // len(frames) // 1024} KB")
+
+    link.send_cmd({"cmd": "display", "reset": True})
+
+    sent = failed = 0
+    t0 = time.time()
+    while time.time() - t0 < args.seconds:
+        resp = link.send_jpeg(frames[sent % len(frames)])
+        if resp.get("status") == "ok":
+            sent += 1
+        else:
+            failed += 1
+        if args.face_every and sent % args.face_every == 0:
+            link.send_cmd({"cmd": "face", "on": True})
+            link.send_cmd({"cmd": "love", "value": 1.0})
+            time.sleep(0.1)
+    elapsed = time.time() - t0
+
+    stats = link.send_cmd({"cmd": "display"})
+    link.send_cmd({"cmd": "face", "on": True})
+    link.close()
+
+    print(f"\nStreamed {sent} frames in {elapsed:.1f} s ({sent / elapsed:.1f} fps), {failed} failed")
+    print(f"Display stats: {stats}")
+    underruns = stats.get("underruns")
+    if underruns is None:
+        print("Result: unknown (no stats from device)")
+    elif not stats.get("frames") or not stats.get("bounce"):
+        # Vsync stats and bounce buffers need an IDF 5 core; an IDF 4.4
+        # build compiles them out and underruns stays 0 whatever happens
+        print("Result: unknown / not supported (no vsync stats on this firmware)")
+    elif underruns > 0:
+        print(f"Result: GLITCHED ({underruns} late frames, worst {stats.get('worst_us')} us "
+              f"vs {stats.get('frame_us')} us nominal)")
+    else:
+        print("Result: clean")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+"""
+Compare full-JPEG updates with tile-delta updates ({"cmd":"tiles"}) on a
+UI-like sequence: a fixed photo-ish background with a ticking clock and a
+small sprite moving across it. Reports bytes on the wire and update
+latency (command sent -> frame on screen) for each.
+
+Usage:
+    python tiles_vs_jpeg.py COM6
+    python tiles_vs_jpeg.py /dev/ttyACM0 --frames 30 --codec raw
+"""
+import argparse
+import io
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(__file__))
+
+from PIL import Image, ImageDraw, ImageFilter
+
+from sensecap_controller import SenseCapController
+
+
+def make_frames(count):
+    """Background with a clock that ticks and a sprite that moves each frame."""
+    bg = Image.effect_noise((60, 60), 90).convert("RGB").resize((480, 480), Image.BICUBIC)
+    bg = bg.filter(ImageFilter.GaussianBlur(3))
+    frames = []
+    for i in range(count):
+        img = bg.copy()
+        draw = ImageDraw.Draw(img)
+        draw.rectangle([140, 20, 340, 70], fill=(20, 20, 40))
+        draw.text((160, 35), "12:%02d:%02d" % (i // 60, i % 60), fill=(255, 255, 255))
+        x = 40 + (i * 23) % 380
+        draw.ellipse([x, 380, x + 40, 420], fill=(255, 105, 180))
+        frames.append(img)
+    return frames
+
+
+def wait_drawn(ctrl):
+    """Any non-image command replies once the last image is on screen."""
+    ctrl.send_cmd({"cmd": "display"})
+
+
+def run(ctrl, frames, send):
+    total_bytes = 0
+    latencies = []
+    for img in frames:
+        t = time.time()
+        resp, nbytes = send(img)
+        if resp.get("status") != "ok":
+            print("  error:", resp)
+            return None
+        wait_drawn(ctrl)
+        latencies.append((time.time() - t) * 1000)
+        total_bytes += nbytes
+    n = len(frames)
+    return total_bytes / n, sum(latencies) / n, max(latencies)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Tile-delta vs JPEG update comparison")
+    ap.add_argument("port", nargs="?", default="COM6")
+    ap.add_argument("--frames", type=int, default=20)
+    ap.add_argument("--quality", type=int, default=85)
+    ap.add_argument("--codec", default="rle", choices=["rle", "raw"])
+    args = ap.parse_args()
+
+    ctrl = SenseCapController(args.port)
+    ctrl.ser.reset_input_buffer()
+    frames = make_frames(args.frames)
+
+    def send_jpeg(img):
+        buf = io.BytesIO()
+        img.save(buf, format="JPEG", quality=args.quality, restart_marker_rows=1)
+        data = buf.getvalue()
+        return ctrl.send_jpeg(data), len(data)
+
+    def send_tiles(img):
+        resp = ctrl.send_tiles(img, codec=args.codec)
+        return resp, resp.get("bytes", 0)
+
+    results = {}
+    for name, send in [("jpeg", send_jpeg), ("tiles", send_tiles)]:
+        send(frames[0])             # Same starting picture for both
+        wait_drawn(ctrl)
+        results[name] = run(ctrl, frames[1:], send)
+
+    print(f"{'':8}{'bytes/update':>14}{'avg ms':>10}{'max ms':>10}")
+    for name, r in results.items():
+        if r:
+            print(f"{name:8}{r[0]:>14.0f}{r[1]:>10.1f}{r[2]:>10.1f}")
+    ctrl.close()
+
+
+if __name__ == "__main__":
+    main()
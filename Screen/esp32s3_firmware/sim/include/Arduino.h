@@ -0,0 +1,180 @@
+/*
+ * Arduino core shim for the host simulator
+ *
+ * Just enough of the ESP32 Arduino API for the firmware in src/
+ * to build and run unmodified on Linux. Serial is a pty, Serial1
+ * (RP2040 link) is logged to stderr.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+
+using std::min;
+using std::max;
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+#define SERIAL_8N1    0x800001c
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+
+// ============================================================================
+// Timing / GPIO / Random
+// ============================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalRead(uint8_t pin);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+// Bit-banged LCD SPI writes go to a register block nobody reads
+struct SimGpioReg { volatile uint32_t val; };
+struct SimGpioDev {
+    SimGpioReg out_w1ts, out_w1tc, out1_w1ts, out1_w1tc;
+};
+extern SimGpioDev GPIO;
+
+// ============================================================================
+// String
+// ============================================================================
+
+class String {
+public:
+    String(const char *s = "") : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.size(); }
+    void reserve(unsigned n) { _s.reserve(n); }
+    void trim();
+    int  indexOf(char c, unsigned from = 0) const;
+    int  indexOf(const char *s, unsigned from = 0) const;
+    String substring(unsigned from, unsigned to = (unsigned)-1) const;
+    bool startsWith(const char *p) const { return _s.compare(0, strlen(p), p) == 0; }
+    bool equals(const char *p) const { return _s == p; }
+    long toInt() const { return strtol(_s.c_str(), NULL, 10); }
+    char operator[](unsigned i) const { return i < _s.size() ? _s[i] : 0; }
+
+    String &operator+=(char c) { _s += c; return *this; }
+    String &operator+=(const char *s) { _s += s; return *this; }
+    String &operator+=(const String &s) { _s += s._s; return *this; }
+    String operator+(const String &o) const { return String(_s + o._s); }
+    bool operator==(const char *p) const { return _s == p; }
+    bool operator==(const String &o) const { return _s == o._s; }
+
+private:
+    std::string _s;
+};
+
+// ============================================================================
+// Print / Stream
+// ============================================================================
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(const uint8_t *buf, size_t len) = 0;
+    size_t write(uint8_t b) { return write(&b, 1); }
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+
+    size_t println() { return write("\r\n"); }
+    template<typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long ms) { _timeout = ms; }
+    size_t readBytes(uint8_t *buf, size_t len);
+    size_t readBytes(char *buf, size_t len) { return readBytes((uint8_t *)buf, len); }
+    String readStringUntil(char terminator);
+
+protected:
+    int timedRead();
+    unsigned long _timeout = 1000;
+};
+
+// ============================================================================
+// Serial ports
+// ============================================================================
+
+// Serial (CH340 on the board) is backed by a pty master. Serial1 (the
+// internal RP2040 UART) is a log sink so buzzer commands show on stderr.
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(int num) : _num(num) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1,
+               int8_t rxPin = -1, int8_t txPin = -1);
+    void end() {}
+    void setRxBufferSize(size_t) {}
+    void flush() {}
+    int availableForWrite() { return 4096; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t *buf, size_t len);
+    size_t write(const uint8_t *buf, size_t len) override;
+    using Print::write;
+
+private:
+    int _num;
+    int _peeked = -1;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+// Firmware entry points
+void setup();
+void loop();
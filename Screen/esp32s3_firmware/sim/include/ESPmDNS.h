@@ -0,0 +1,12 @@
+#pragma once
+
+// mDNS is not simulated; clients connect to localhost
+class MDNSResponder {
+public:
+    bool begin(const char *hostname) { (void)hostname; return true; }
+    void addService(const char *service, const char *proto, uint16_t port) {
+        (void)service; (void)proto; (void)port;
+    }
+};
+
+extern MDNSResponder MDNS;
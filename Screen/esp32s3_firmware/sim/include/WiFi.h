@@ -0,0 +1,78 @@
+/*
+ * WiFi shim for the host simulator.
+ * WiFi.begin() "connects" instantly; WiFiServer/WiFiClient are real
+ * POSIX TCP sockets, so host tools can talk to the firmware over TCP.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+#include <memory>
+
+#define WIFI_STA        1
+#define WL_IDLE_STATUS  0
+#define WL_CONNECTED    3
+
+class IPAddress {
+public:
+    IPAddress(uint32_t addr = 0) : _addr(addr) {}
+    String toString() const;
+    operator uint32_t() const { return _addr; }
+private:
+    uint32_t _addr;  // Network byte order
+};
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int fd);
+
+    int  connect(const char *host, uint16_t port);
+    int  connect(const char *host, uint16_t port, int32_t timeout_ms);
+    bool connected();
+    void stop();
+    void setNoDelay(bool nodelay);
+    IPAddress remoteIP();
+    void flush() {}
+    explicit operator bool() { return _sock && _sock->fd >= 0; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    int read(uint8_t *buf, size_t len);
+    size_t write(const uint8_t *buf, size_t len) override;
+    using Print::write;
+
+private:
+    struct Sock {
+        int fd;
+        explicit Sock(int f) : fd(f) {}
+        ~Sock();
+    };
+    std::shared_ptr<Sock> _sock;
+};
+
+class WiFiServer {
+public:
+    explicit WiFiServer(uint16_t port) : _port(port) {}
+    void begin();
+    void setNoDelay(bool nodelay) { _nodelay = nodelay; }
+    WiFiClient accept();
+    WiFiClient available() { return accept(); }
+private:
+    uint16_t _port;
+    int      _fd = -1;
+    bool     _nodelay = false;
+};
+
+class WiFiClass {
+public:
+    void mode(int m) { (void)m; }
+    void begin(const char *ssid, const char *password);
+    int status() { return _status; }
+    IPAddress localIP();
+private:
+    int _status = WL_IDLE_STATUS;
+};
+
+extern WiFiClass WiFi;
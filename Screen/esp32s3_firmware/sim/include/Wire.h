@@ -0,0 +1,34 @@
+/*
+ * I2C shim for the host simulator.
+ * Emulates the TCA9535 expander (0x20) and an FT6336U touch
+ * controller (0x38) whose touch state comes from the sim script.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+class TwoWire : public Stream {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t freq = 0);
+    void beginTransmission(uint8_t addr);
+    uint8_t endTransmission(bool sendStop = true);
+    uint8_t requestFrom(uint8_t addr, uint8_t len, bool sendStop = true);
+
+    size_t write(const uint8_t *buf, size_t len) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+
+private:
+    uint8_t _addr = 0;
+    uint8_t _reg = 0;
+    uint8_t _tx[32];
+    size_t  _tx_len = 0;
+    uint8_t _rx[32];
+    size_t  _rx_len = 0;
+    size_t  _rx_pos = 0;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+// No cache between CPU and the simulated panel: write-back is a no-op
+static inline int Cache_WriteBack_Addr(uint32_t addr, uint32_t size) { (void)addr; (void)size; return 0; }
+static inline int Cache_Invalidate_Addr(uint32_t addr, uint32_t size) { (void)addr; (void)size; return 0; }
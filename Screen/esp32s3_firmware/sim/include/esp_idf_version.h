@@ -0,0 +1,20 @@
+#pragma once
+
+// The simulator defaults to ESP-IDF 5.1, the version the board's Arduino
+// core builds against (framebuffer access, bounce buffers, vsync
+// callbacks). -DSIM_IDF_MAJOR=4 (env sim_idf44) models IDF 4.4 instead,
+// for the double-buffered present path of the previous core.
+#ifndef SIM_IDF_MAJOR
+#define SIM_IDF_MAJOR 5
+#endif
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#if SIM_IDF_MAJOR >= 5
+#define ESP_IDF_VERSION_MAJOR 5
+#define ESP_IDF_VERSION_MINOR 1
+#else
+#define ESP_IDF_VERSION_MAJOR 4
+#define ESP_IDF_VERSION_MINOR 4
+#endif
+#define ESP_IDF_VERSION_PATCH 0
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(ESP_IDF_VERSION_MAJOR, ESP_IDF_VERSION_MINOR, ESP_IDF_VERSION_PATCH)
@@ -0,0 +1,35 @@
+/*
+ * FreeRTOS shim for the host simulator (pthreads underneath).
+ * Ticks are milliseconds; core affinity is ignored.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int           BaseType_t;
+typedef unsigned int  UBaseType_t;
+typedef uint32_t      TickType_t;
+
+#define pdFALSE            0
+#define pdTRUE             1
+#define pdPASS             pdTRUE
+#define pdFAIL             pdFALSE
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define tskNO_AFFINITY     0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+
+#define portYIELD_FROM_ISR(x) ((void)(x))
+
+// Critical sections map onto one global recursive mutex
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+void sim_enter_critical();
+void sim_exit_critical();
+#define portENTER_CRITICAL(mux)      ((void)(mux), sim_enter_critical())
+#define portEXIT_CRITICAL(mux)       ((void)(mux), sim_exit_critical())
+#define portENTER_CRITICAL_ISR(mux)  portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)   portEXIT_CRITICAL(mux)
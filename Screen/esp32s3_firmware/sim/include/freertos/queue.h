@@ -0,0 +1,16 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct SimQueue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t q);
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks);
+BaseType_t xQueueSendToBack(QueueHandle_t q, const void *item, TickType_t ticks);
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken);
+BaseType_t xQueueOverwrite(QueueHandle_t q, const void *item);
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks);
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+BaseType_t xQueueReset(QueueHandle_t q);
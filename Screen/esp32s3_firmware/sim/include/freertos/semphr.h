@@ -0,0 +1,15 @@
+#pragma once
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+// Semaphores are queues of zero-size items, as in FreeRTOS
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+void vSemaphoreDelete(SemaphoreHandle_t s);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken);
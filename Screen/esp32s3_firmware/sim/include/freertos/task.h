@@ -0,0 +1,21 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct SimTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out,
+                                   BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack,
+                       void *arg, UBaseType_t prio, TaskHandle_t *out);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xPortGetCoreID();
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
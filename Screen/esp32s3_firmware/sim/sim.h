@@ -0,0 +1,46 @@
+/*
+ * Host simulator internals
+ *
+ * Shared between the sim_*.cpp HAL pieces and sim_main.cpp.
+ * Firmware code in src/ never includes this.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+struct SimOptions {
+    const char *serial_link  = NULL;   // Symlink to the pty slave
+    uint32_t    serial_rate  = 92160;  // Bytes/s into Serial (0 = unlimited)
+    int         tcp_port     = 0;      // Override TCP_PORT (0 = keep)
+    int         http_port    = 0;      // Panel viewer port (0 = off)
+    const char *script       = NULL;   // Scripted touch / button input
+    const char *dump_on_exit = NULL;   // BMP written when the sim exits
+    const char *flash        = NULL;   // Asset partition image (NULL = erased RAM)
+};
+
+extern SimOptions g_sim;
+
+// Serial pty
+bool sim_serial_open();
+
+// Input state driven by the script and the viewer
+void sim_touch_set(bool down, int x, int y);
+void sim_touch_get(bool *down, int *x, int *y);
+void sim_button_set(bool pressed);
+bool sim_button_pressed();
+
+// Panel access
+bool sim_panel_snapshot(uint16_t *out, int *w, int *h, size_t max_px);
+bool sim_panel_encode_bmp(std::string &out);
+bool sim_panel_dump_bmp(const char *path);
+
+// Background services
+bool sim_viewer_start(int port);
+bool sim_script_start(const char *path);
+
+// Request a clean exit from the main loop
+void sim_request_exit(int code);
+bool sim_exit_requested(int *code);
@@ -0,0 +1,103 @@
+/*
+ * Flash partitions for the host simulator: the "assets" data partition
+ * from partitions.csv. With --flash FILE it is that file, mapped shared
+ * so asset updates persist across runs (a missing file is created
+ * erased); otherwise erased memory. Writes behave like NOR flash: they
+ * can only clear bits.
+ */
+
+#include "esp_partition.h"
+#include "sim.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define SIM_ASSETS_SIZE   0x4E0000
+#define SIM_SECTOR        4096
+
+static esp_partition_t s_assets = {
+    ESP_PARTITION_TYPE_DATA, 0x40, 0x310000, SIM_ASSETS_SIZE, SIM_SECTOR, "assets", false,
+};
+static uint8_t *s_mem = NULL;
+
+static bool flashOpen() {
+    if (s_mem) return true;
+    if (!g_sim.flash) {
+        s_mem = (uint8_t *)malloc(SIM_ASSETS_SIZE);
+        if (!s_mem) return false;
+        memset(s_mem, 0xFF, SIM_ASSETS_SIZE);
+        return true;
+    }
+    int fd = open(g_sim.flash, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "[sim] Can't open %s\n", g_sim.flash);
+        return false;
+    }
+    off_t len = lseek(fd, 0, SEEK_END);
+    if (len < SIM_ASSETS_SIZE) {
+        // Pad a short image (or a new file) with erased bytes
+        static uint8_t erased[SIM_SECTOR];
+        memset(erased, 0xFF, sizeof(erased));
+        while (len < SIM_ASSETS_SIZE) {
+            size_t n = SIM_ASSETS_SIZE - len < SIM_SECTOR ? SIM_ASSETS_SIZE - len : SIM_SECTOR;
+            if (pwrite(fd, erased, n, len) != (ssize_t)n) break;
+            len += n;
+        }
+    }
+    void *p = mmap(NULL, SIM_ASSETS_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return false;
+    s_mem = (uint8_t *)p;
+    return true;
+}
+
+static bool inRange(const esp_partition_t *part, size_t offset, size_t size) {
+    return part == &s_assets && offset <= part->size && size <= part->size - offset;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label) {
+    if (type != s_assets.type || subtype != s_assets.subtype) return NULL;
+    if (label && strcmp(label, s_assets.label) != 0) return NULL;
+    return flashOpen() ? &s_assets : NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *part, size_t offset, void *dst, size_t size) {
+    if (!inRange(part, offset, size)) return ESP_ERR_INVALID_ARG;
+    memcpy(dst, s_mem + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *part, size_t offset, const void *src, size_t size) {
+    if (!inRange(part, offset, size)) return ESP_ERR_INVALID_ARG;
+    const uint8_t *s = (const uint8_t *)src;
+    for (size_t i = 0; i < size; i++) s_mem[offset + i] &= s[i];
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *part, size_t offset, size_t size) {
+    if (!inRange(part, offset, size) || offset % SIM_SECTOR || size % SIM_SECTOR) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(s_mem + offset, 0xFF, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *part, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory,
+                             const void **out_ptr, esp_partition_mmap_handle_t *out_handle) {
+    (void)memory;
+    if (!inRange(part, offset, size)) return ESP_ERR_INVALID_ARG;
+    *out_ptr = s_mem + offset;
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+    (void)handle;
+}
@@ -0,0 +1,471 @@
+/*
+ * Arduino core pieces for the host simulator: time, GPIO, random,
+ * String/Print/Stream helpers, heap_caps, the Serial pty and the
+ * emulated I2C devices.
+ */
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "pins.h"
+#include "sim.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+SimOptions g_sim;
+SimGpioDev GPIO;
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+using Clock = std::chrono::steady_clock;
+static const Clock::time_point s_boot = Clock::now();
+
+int64_t esp_timer_get_time() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - s_boot).count();
+}
+
+unsigned long millis() {
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)esp_timer_get_time();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Only used for LCD init bit-banging, which has nothing to wait for
+void delayMicroseconds(uint32_t us) {
+    (void)us;
+}
+
+// Busy-wait loops call yield(); sleep briefly so they don't spin a host core
+void yield() {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+}
+
+// ============================================================================
+// GPIO / Random
+// ============================================================================
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    (void)pin;
+    (void)val;
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin == PIN_BUTTON_USER) return sim_button_pressed() ? LOW : HIGH;
+    return LOW;
+}
+
+static std::mt19937 s_rng(12345);
+static std::mutex   s_rng_lock;
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    std::lock_guard<std::mutex> lk(s_rng_lock);
+    return (long)(s_rng() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) {
+    std::lock_guard<std::mutex> lk(s_rng_lock);
+    s_rng.seed((uint32_t)seed);
+}
+
+uint32_t esp_random() {
+    std::lock_guard<std::mutex> lk(s_rng_lock);
+    return s_rng();
+}
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK:                return "ESP_OK";
+        case ESP_FAIL:              return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE:  return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT:       return "ESP_ERR_TIMEOUT";
+        default:                    return "ESP_ERR_UNKNOWN";
+    }
+}
+
+// ============================================================================
+// Heap
+// ============================================================================
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    (void)caps;
+    return calloc(n, size);
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    (void)caps;
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+// Report roughly what the board has (8MB PSRAM, ~300KB internal)
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? 8 * 1024 * 1024 : 300 * 1024;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? 8 * 1024 * 1024 : 128 * 1024;
+}
+
+// ============================================================================
+// String / Print / Stream
+// ============================================================================
+
+void String::trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) { _s.clear(); return; }
+    size_t e = _s.find_last_not_of(" \t\r\n");
+    _s = _s.substr(b, e - b + 1);
+}
+
+int String::indexOf(char c, unsigned from) const {
+    size_t p = _s.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::indexOf(const char *s, unsigned from) const {
+    size_t p = _s.find(s, from);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+String String::substring(unsigned from, unsigned to) const {
+    if (from >= _s.size() || to <= from) return String();
+    return String(_s.substr(from, to - from));
+}
+
+size_t Print::printf(const char *fmt, ...) {
+    char stack[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(stack, sizeof(stack), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    if ((size_t)n < sizeof(stack)) return write((const uint8_t *)stack, n);
+
+    std::string big(n + 1, '\0');
+    va_start(ap, fmt);
+    vsnprintf(&big[0], big.size(), fmt, ap);
+    va_end(ap);
+    return write((const uint8_t *)big.data(), n);
+}
+
+int Stream::timedRead() {
+    unsigned long start = millis();
+    do {
+        if (available() > 0) return read();
+        yield();
+    } while (millis() - start < _timeout);
+    return -1;
+}
+
+size_t Stream::readBytes(uint8_t *buf, size_t len) {
+    size_t n = 0;
+    while (n < len) {
+        int c = timedRead();
+        if (c < 0) break;
+        buf[n++] = (uint8_t)c;
+    }
+    return n;
+}
+
+String Stream::readStringUntil(char terminator) {
+    std::string s;
+    int c = timedRead();
+    while (c >= 0 && c != terminator) {
+        s += (char)c;
+        c = timedRead();
+    }
+    return String(s);
+}
+
+// ============================================================================
+// Serial (pty)
+// ============================================================================
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+
+static int  s_pty_master = -1;
+static int  s_pty_slave = -1;
+static bool s_tx_stalled = false;
+
+// Receive rate limit (token bucket), so host-side timings resemble the
+// real 921600 baud link instead of an infinitely fast pty
+static double        s_rx_tokens = 0;
+static unsigned long s_rx_last_us = 0;
+
+bool sim_serial_open() {
+    s_pty_master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (s_pty_master < 0 || grantpt(s_pty_master) != 0 || unlockpt(s_pty_master) != 0) {
+        perror("[sim] posix_openpt");
+        return false;
+    }
+    const char *name = ptsname(s_pty_master);
+
+    // Hold the slave open in raw mode: the line discipline must not
+    // touch binary JPEG payloads, and the master never sees EIO when
+    // the host tool disconnects.
+    s_pty_slave = open(name, O_RDWR | O_NOCTTY);
+    if (s_pty_slave >= 0) {
+        struct termios tio;
+        tcgetattr(s_pty_slave, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(s_pty_slave, TCSANOW, &tio);
+    }
+    fcntl(s_pty_master, F_SETFL, fcntl(s_pty_master, F_GETFL) | O_NONBLOCK);
+
+    fprintf(stderr, "[sim] Serial on %s\n", name);
+    if (g_sim.serial_link) {
+        unlink(g_sim.serial_link);
+        if (symlink(name, g_sim.serial_link) == 0) {
+            fprintf(stderr, "[sim] Linked %s -> %s\n", g_sim.serial_link, name);
+        } else {
+            perror("[sim] symlink");
+        }
+    }
+    return true;
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin) {
+    (void)baud;
+    (void)config;
+    (void)rxPin;
+    (void)txPin;
+}
+
+static int serial_budget() {
+    if (g_sim.serial_rate == 0) return 1 << 20;
+    unsigned long now = micros();
+    s_rx_tokens += (now - s_rx_last_us) * (double)g_sim.serial_rate / 1e6;
+    s_rx_last_us = now;
+    // Allow about one RX buffer of burst
+    if (s_rx_tokens > 8192) s_rx_tokens = 8192;
+    return (int)s_rx_tokens;
+}
+
+int HardwareSerial::available() {
+    if (_num != 0 || s_pty_master < 0) return 0;
+    int n = 0;
+    if (ioctl(s_pty_master, FIONREAD, &n) != 0) return 0;
+    if (_peeked >= 0) n++;
+    return std::min(n, serial_budget());
+}
+
+int HardwareSerial::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int HardwareSerial::peek() {
+    if (_peeked < 0) {
+        uint8_t c;
+        if (read(&c, 1) != 1) return -1;
+        _peeked = c;
+        s_rx_tokens += 1;  // Not consumed yet
+    }
+    return _peeked;
+}
+
+size_t HardwareSerial::read(uint8_t *buf, size_t len) {
+    if (_num != 0 || s_pty_master < 0 || len == 0) return 0;
+    size_t n = 0;
+    if (_peeked >= 0) {
+        buf[n++] = (uint8_t)_peeked;
+        _peeked = -1;
+    }
+    if (n < len) {
+        ssize_t r = ::read(s_pty_master, buf + n, len - n);
+        if (r > 0) n += r;
+    }
+    if (g_sim.serial_rate) s_rx_tokens -= n;
+    return n;
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) {
+    if (_num == 1) {
+        // RP2040 link: log each line
+        static std::string line;
+        for (size_t i = 0; i < len; i++) {
+            if (buf[i] == '\n') {
+                fprintf(stderr, "[sim] rp2040 <- %s\n", line.c_str());
+                line.clear();
+            } else if (buf[i] != '\r') {
+                line += (char)buf[i];
+            }
+        }
+        return len;
+    }
+    if (s_pty_master < 0) return len;
+
+    // Nobody reading the pty: drop output instead of blocking the
+    // firmware, but give a connected reader a moment to catch up.
+    size_t off = 0;
+    unsigned long start = millis();
+    while (off < len) {
+        ssize_t w = ::write(s_pty_master, buf + off, len - off);
+        if (w > 0) {
+            off += w;
+            s_tx_stalled = false;
+            continue;
+        }
+        if (w < 0 && errno != EAGAIN && errno != EINTR) break;
+        if (s_tx_stalled || millis() - start > 50) {
+            s_tx_stalled = true;
+            break;
+        }
+        yield();
+    }
+    return len;
+}
+
+// ============================================================================
+// I2C devices
+// ============================================================================
+
+TwoWire Wire;
+
+static std::mutex s_input_lock;
+static bool s_touch_down = false;
+static int  s_touch_x = 0;
+static int  s_touch_y = 0;
+static std::atomic<bool> s_button(false);
+
+void sim_touch_set(bool down, int x, int y) {
+    std::lock_guard<std::mutex> lk(s_input_lock);
+    s_touch_down = down;
+    s_touch_x = constrain(x, 0, LCD_H_RES - 1);
+    s_touch_y = constrain(y, 0, LCD_V_RES - 1);
+}
+
+void sim_touch_get(bool *down, int *x, int *y) {
+    std::lock_guard<std::mutex> lk(s_input_lock);
+    *down = s_touch_down;
+    *x = s_touch_x;
+    *y = s_touch_y;
+}
+
+void sim_button_set(bool pressed) {
+    s_button = pressed;
+}
+
+bool sim_button_pressed() {
+    return s_button;
+}
+
+// TCA9535 register file (input, output, polarity, config; two ports each)
+static uint8_t s_tca_regs[8] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF };
+
+#define SIM_ADDR_TCA9535  0x20
+#define SIM_ADDR_FT6336   0x38
+
+bool TwoWire::begin(int sda, int scl, uint32_t freq) {
+    (void)sda;
+    (void)scl;
+    (void)freq;
+    return true;
+}
+
+void TwoWire::beginTransmission(uint8_t addr) {
+    _addr = addr;
+    _tx_len = 0;
+}
+
+size_t TwoWire::write(const uint8_t *buf, size_t len) {
+    size_t n = std::min(len, sizeof(_tx) - _tx_len);
+    memcpy(_tx + _tx_len, buf, n);
+    _tx_len += n;
+    return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    if (_addr != SIM_ADDR_TCA9535 && _addr != SIM_ADDR_FT6336) return 2;  // NACK on address
+    if (_tx_len > 0) _reg = _tx[0];
+    if (_addr == SIM_ADDR_TCA9535) {
+        for (size_t i = 1; i < _tx_len; i++) {
+            s_tca_regs[(_reg + i - 1) & 7] = _tx[i];
+        }
+    }
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t len, bool sendStop) {
+    (void)sendStop;
+    _rx_len = 0;
+    _rx_pos = 0;
+    if (len > sizeof(_rx)) len = sizeof(_rx);
+
+    if (addr == SIM_ADDR_TCA9535) {
+        for (uint8_t i = 0; i < len; i++) _rx[i] = s_tca_regs[(_reg + i) & 7];
+        _rx_len = len;
+    } else if (addr == SIM_ADDR_FT6336) {
+        bool down;
+        int x, y;
+        sim_touch_get(&down, &x, &y);
+        // Register map from 0x02: TD_STATUS, P1_XH, P1_XL, P1_YH, P1_YL
+        uint8_t regs[256] = { 0 };
+        regs[0x02] = down ? 1 : 0;
+        regs[0x03] = (uint8_t)((x >> 8) & 0x0F);
+        regs[0x04] = (uint8_t)(x & 0xFF);
+        regs[0x05] = (uint8_t)((y >> 8) & 0x0F);
+        regs[0x06] = (uint8_t)(y & 0xFF);
+        regs[0xA8] = 0x11;  // Vendor ID
+        for (uint8_t i = 0; i < len; i++) _rx[i] = regs[(uint8_t)(_reg + i)];
+        _rx_len = len;
+    }
+    return (uint8_t)_rx_len;
+}
+
+int TwoWire::available() {
+    return (int)(_rx_len - _rx_pos);
+}
+
+int TwoWire::read() {
+    return _rx_pos < _rx_len ? _rx[_rx_pos++] : -1;
+}
+
+int TwoWire::peek() {
+    return _rx_pos < _rx_len ? _rx[_rx_pos] : -1;
+}
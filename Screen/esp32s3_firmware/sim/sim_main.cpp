@@ -0,0 +1,196 @@
+/*
+ * Host simulator entry point
+ *
+ * Runs the firmware's setup()/loop() on Linux against the shims in
+ * sim/include. Serial is a pty, TCP is a real socket, the panel is an
+ * in-memory framebuffer, and touch / button input comes from a script
+ * or the browser viewer.
+ *
+ * Usage: sensecap_sim [--serial-link PATH] [--serial-rate BYTES_PER_S]
+ *                     [--tcp-port N] [--http PORT] [--script FILE]
+ *                     [--dump-on-exit FILE.bmp] [--flash ASSETS.bin]
+ *
+ * Script format, one event per line ('#' starts a comment); times are
+ * milliseconds since start:
+ *   500   touch 240 240 [hold_ms]   tap (default hold 100ms)
+ *   800   touch-down 100 100        press and hold
+ *   900   touch-up
+ *   1000  button down|up            user button (GPIO38)
+ *   1200  press [hold_ms]           button tap
+ *   2000  dump out.bmp              write the panel as BMP
+ *   2500  quit [code]
+ */
+
+#include "Arduino.h"
+#include "sim.h"
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+static std::atomic<bool> s_exit(false);
+static std::atomic<int>  s_exit_code(0);
+
+void sim_request_exit(int code) {
+    s_exit_code = code;
+    s_exit = true;
+}
+
+bool sim_exit_requested(int *code) {
+    if (code) *code = s_exit_code;
+    return s_exit;
+}
+
+// ============================================================================
+// Script
+// ============================================================================
+
+struct ScriptEvent {
+    uint32_t    at_ms;
+    std::string cmd;
+    std::string args;
+};
+
+static void sleep_until_ms(uint32_t at_ms) {
+    uint32_t now = millis();
+    if (at_ms > now) delay(at_ms - now);
+}
+
+static void run_event(const ScriptEvent &ev) {
+    std::istringstream in(ev.args);
+    if (ev.cmd == "touch") {
+        int x = 0, y = 0, hold = 100;
+        in >> x >> y >> hold;
+        sim_touch_set(true, x, y);
+        delay(hold);
+        sim_touch_set(false, x, y);
+    } else if (ev.cmd == "touch-down") {
+        int x = 0, y = 0;
+        in >> x >> y;
+        sim_touch_set(true, x, y);
+    } else if (ev.cmd == "touch-up") {
+        bool down;
+        int x, y;
+        sim_touch_get(&down, &x, &y);
+        sim_touch_set(false, x, y);
+    } else if (ev.cmd == "button") {
+        std::string state;
+        in >> state;
+        sim_button_set(state == "down");
+    } else if (ev.cmd == "press") {
+        int hold = 100;
+        in >> hold;
+        sim_button_set(true);
+        delay(hold);
+        sim_button_set(false);
+    } else if (ev.cmd == "dump") {
+        std::string path;
+        in >> path;
+        if (!sim_panel_dump_bmp(path.c_str())) {
+            fprintf(stderr, "[sim] dump to '%s' failed\n", path.c_str());
+        }
+    } else if (ev.cmd == "quit") {
+        int code = 0;
+        in >> code;
+        sim_request_exit(code);
+    } else {
+        fprintf(stderr, "[sim] Unknown script command '%s'\n", ev.cmd.c_str());
+    }
+}
+
+bool sim_script_start(const char *path) {
+    std::ifstream f(path);
+    if (!f) {
+        fprintf(stderr, "[sim] Cannot open script %s\n", path);
+        return false;
+    }
+    std::vector<ScriptEvent> events;
+    std::string line;
+    while (std::getline(f, line)) {
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.resize(hash);
+        std::istringstream in(line);
+        ScriptEvent ev;
+        if (!(in >> ev.at_ms >> ev.cmd)) continue;
+        std::getline(in, ev.args);
+        events.push_back(ev);
+    }
+    fprintf(stderr, "[sim] Loaded %zu script events from %s\n", events.size(), path);
+
+    std::thread([events]() {
+        for (const ScriptEvent &ev : events) {
+            sleep_until_ms(ev.at_ms);
+            if (s_exit) return;
+            run_event(ev);
+        }
+    }).detach();
+    return true;
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+static void on_signal(int sig) {
+    (void)sig;
+    s_exit = true;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--serial-link PATH] [--serial-rate BYTES_PER_S]\n"
+            "          [--tcp-port N] [--http PORT] [--script FILE] [--dump-on-exit FILE.bmp]\n"
+            "          [--flash ASSETS.bin]\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!v) {
+            usage(argv[0]);
+            return 2;
+        }
+        if (!strcmp(a, "--serial-link"))       g_sim.serial_link = v;
+        else if (!strcmp(a, "--serial-rate"))  g_sim.serial_rate = (uint32_t)atol(v);
+        else if (!strcmp(a, "--tcp-port"))     g_sim.tcp_port = atoi(v);
+        else if (!strcmp(a, "--http"))         g_sim.http_port = atoi(v);
+        else if (!strcmp(a, "--script"))       g_sim.script = v;
+        else if (!strcmp(a, "--dump-on-exit")) g_sim.dump_on_exit = v;
+        else if (!strcmp(a, "--flash"))        g_sim.flash = v;
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    if (!sim_serial_open()) return 1;
+    if (g_sim.http_port) sim_viewer_start(g_sim.http_port);
+
+    setup();
+    // Start the script after setup so its timeline isn't eaten by boot
+    if (g_sim.script && !sim_script_start(g_sim.script)) return 1;
+
+    int code = 0;
+    while (!sim_exit_requested(&code)) {
+        loop();
+    }
+
+    if (g_sim.dump_on_exit) sim_panel_dump_bmp(g_sim.dump_on_exit);
+    fprintf(stderr, "[sim] Exit %d\n", code);
+    fflush(stderr);
+    // Worker tasks never return; skip static destructors they might race
+    _exit(code);
+}
@@ -0,0 +1,296 @@
+/*
+ * RGB panel shim for the host simulator.
+ *
+ * The panel is a heap RGB565 framebuffer. A thread raises on_vsync at
+ * the refresh rate implied by the timings, like the LCD_CAM DMA does.
+ * The framebuffer can be dumped as a BMP or watched live in a browser.
+ */
+
+#include "esp_lcd_panel_rgb.h"
+#include "sim.h"
+
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct esp_lcd_panel_t {
+    int                                 w = 0;
+    int                                 h = 0;
+    std::vector<uint16_t>               fb;
+    esp_lcd_rgb_panel_event_callbacks_t cbs = {};
+    void                               *user_ctx = NULL;
+    uint32_t                            frame_us = 16667;
+    std::atomic<bool>                   running{false};
+    std::thread                         vsync;
+};
+
+// Panel the viewer and dumps read from; guarded against esp_lcd_panel_del()
+static std::mutex        s_panel_lock;
+static esp_lcd_panel_t  *s_current = NULL;
+
+// ============================================================================
+// esp_lcd API
+// ============================================================================
+
+static void vsync_thread(esp_lcd_panel_t *p) {
+    auto next = std::chrono::steady_clock::now();
+    while (p->running) {
+        next += std::chrono::microseconds(p->frame_us);
+        std::this_thread::sleep_until(next);
+        if (p->cbs.on_vsync) p->cbs.on_vsync(p, NULL, p->user_ctx);
+    }
+}
+
+esp_err_t esp_lcd_new_rgb_panel(const esp_lcd_rgb_panel_config_t *config,
+                                esp_lcd_panel_handle_t *ret_panel) {
+    if (!config || !ret_panel) return ESP_ERR_INVALID_ARG;
+    // bits_per_pixel == 0 means "same as the bus width"
+    size_t bpp = config->bits_per_pixel ? config->bits_per_pixel : config->data_width;
+    if (bpp != 16) return ESP_ERR_NOT_SUPPORTED;
+    const esp_lcd_rgb_timing_t &t = config->timings;
+    // Like IDF: the two bounce buffers take turns, so the frame has to be
+    // an even multiple of one
+    size_t bb = config->bounce_buffer_size_px;
+    if (bb && ((size_t)t.h_res * t.v_res) % (2 * bb) != 0) return ESP_ERR_INVALID_ARG;
+
+    esp_lcd_panel_t *p = new esp_lcd_panel_t();
+    p->w = (int)t.h_res;
+    p->h = (int)t.v_res;
+    p->fb.assign((size_t)p->w * p->h, 0);
+    uint64_t htotal = t.h_res + t.hsync_pulse_width + t.hsync_back_porch + t.hsync_front_porch;
+    uint64_t vtotal = t.v_res + t.vsync_pulse_width + t.vsync_back_porch + t.vsync_front_porch;
+    if (t.pclk_hz) p->frame_us = (uint32_t)(htotal * vtotal * 1000000ULL / t.pclk_hz);
+
+    {
+        std::lock_guard<std::mutex> lk(s_panel_lock);
+        s_current = p;
+    }
+    *ret_panel = p;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel) {
+    return panel ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel) {
+    if (!panel) return ESP_ERR_INVALID_ARG;
+    if (!panel->running) {
+        panel->running = true;
+        panel->vsync = std::thread(vsync_thread, panel);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel) {
+    if (!panel) return ESP_ERR_INVALID_ARG;
+    panel->running = false;
+    if (panel->vsync.joinable()) panel->vsync.join();
+    {
+        std::lock_guard<std::mutex> lk(s_panel_lock);
+        if (s_current == panel) s_current = NULL;
+    }
+    delete panel;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start,
+                                    int x_end, int y_end, const void *color_data) {
+    if (!panel || !color_data || x_start < 0 || y_start < 0 ||
+        x_end > panel->w || y_end > panel->h || x_start >= x_end || y_start >= y_end) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint16_t *src = (const uint16_t *)color_data;
+    int w = x_end - x_start;
+    for (int y = y_start; y < y_end; y++) {
+        memcpy(&panel->fb[(size_t)y * panel->w + x_start], src, w * 2);
+        src += w;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_register_event_callbacks(esp_lcd_panel_handle_t panel,
+                                                     const esp_lcd_rgb_panel_event_callbacks_t *cbs,
+                                                     void *user_ctx) {
+    if (!panel || !cbs) return ESP_ERR_INVALID_ARG;
+    panel->cbs = *cbs;
+    panel->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_get_frame_buffer(esp_lcd_panel_handle_t panel,
+                                             uint32_t fb_num, void **fb0, ...) {
+    if (!panel || fb_num != 1 || !fb0) return ESP_ERR_INVALID_ARG;
+    *fb0 = panel->fb.data();
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_restart(esp_lcd_panel_handle_t panel) {
+    return panel ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+bool sim_panel_snapshot(uint16_t *out, int *w, int *h, size_t max_px) {
+    std::lock_guard<std::mutex> lk(s_panel_lock);
+    if (!s_current) return false;
+    size_t n = (size_t)s_current->w * s_current->h;
+    if (n > max_px) return false;
+    memcpy(out, s_current->fb.data(), n * 2);
+    *w = s_current->w;
+    *h = s_current->h;
+    return true;
+}
+
+static void put_le(std::string &s, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) s += (char)((v >> (8 * i)) & 0xFF);
+}
+
+// 24-bit bottom-up BMP
+bool sim_panel_encode_bmp(std::string &out) {
+    static std::vector<uint16_t> px(1024 * 1024);
+    int w, h;
+    if (!sim_panel_snapshot(px.data(), &w, &h, px.size())) return false;
+
+    uint32_t row_bytes = (uint32_t)(w * 3 + 3) & ~3u;
+    uint32_t data_size = row_bytes * h;
+    out.clear();
+    out.reserve(54 + data_size);
+    out += "BM";
+    put_le(out, 54 + data_size, 4);
+    put_le(out, 0, 4);
+    put_le(out, 54, 4);
+    put_le(out, 40, 4);
+    put_le(out, w, 4);
+    put_le(out, h, 4);
+    put_le(out, 1, 2);
+    put_le(out, 24, 2);
+    put_le(out, 0, 4);
+    put_le(out, data_size, 4);
+    put_le(out, 2835, 4);
+    put_le(out, 2835, 4);
+    put_le(out, 0, 4);
+    put_le(out, 0, 4);
+
+    for (int y = h - 1; y >= 0; y--) {
+        const uint16_t *row = &px[(size_t)y * w];
+        for (int x = 0; x < w; x++) {
+            uint16_t c = row[x];
+            uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            out += (char)((b << 3) | (b >> 2));
+            out += (char)((g << 2) | (g >> 4));
+            out += (char)((r << 3) | (r >> 2));
+        }
+        for (uint32_t pad = w * 3; pad < row_bytes; pad++) out += '\0';
+    }
+    return true;
+}
+
+bool sim_panel_dump_bmp(const char *path) {
+    std::string bmp;
+    if (!sim_panel_encode_bmp(bmp)) return false;
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(bmp.data(), 1, bmp.size(), f) == bmp.size();
+    fclose(f);
+    fprintf(stderr, "[sim] Dumped panel to %s\n", path);
+    return ok;
+}
+
+// ============================================================================
+// Viewer
+// ============================================================================
+
+// Minimal HTTP/1.0 server: "/" shows the panel and forwards clicks as
+// touches, "/frame.bmp" is the current framebuffer.
+static const char VIEWER_HTML[] =
+    "<!doctype html><html><head><title>SenseCAP sim</title></head>"
+    "<body style=\"background:#222;color:#ccc;font-family:sans-serif\">"
+    "<img id=\"f\" src=\"/frame.bmp\" style=\"cursor:crosshair\">"
+    "<p>Click = touch. <button id=\"b\">User button</button></p>"
+    "<script>"
+    "const f=document.getElementById('f'),b=document.getElementById('b');"
+    "function tick(){const i=new Image();i.onload=()=>{f.src=i.src;setTimeout(tick,100)};"
+    "i.onerror=()=>setTimeout(tick,500);i.src='/frame.bmp?'+Date.now()}"
+    "f.onmousedown=e=>fetch('/touch?down=1&x='+e.offsetX+'&y='+e.offsetY);"
+    "f.onmouseup=e=>fetch('/touch?down=0&x='+e.offsetX+'&y='+e.offsetY);"
+    "b.onmousedown=()=>fetch('/button?down=1');b.onmouseup=()=>fetch('/button?down=0');"
+    "tick();"
+    "</script></body></html>";
+
+static int query_int(const std::string &req, const char *key, int dflt) {
+    std::string k = std::string(key) + "=";
+    size_t p = req.find(k);
+    return p == std::string::npos ? dflt : atoi(req.c_str() + p + k.size());
+}
+
+static void send_all(int fd, const std::string &s) {
+    size_t off = 0;
+    while (off < s.size()) {
+        ssize_t w = send(fd, s.data() + off, s.size() - off, MSG_NOSIGNAL);
+        if (w <= 0) return;
+        off += w;
+    }
+}
+
+static void serve_http(int fd) {
+    char buf[1024];
+    ssize_t n = recv(fd, buf, sizeof(buf) - 1, 0);
+    if (n <= 0) return;
+    buf[n] = 0;
+    std::string req(buf, strcspn(buf, "\r\n"));
+
+    std::string body, type = "text/plain";
+    if (req.compare(0, 14, "GET /frame.bmp") == 0) {
+        if (!sim_panel_encode_bmp(body)) body = "no panel";
+        else type = "image/bmp";
+    } else if (req.compare(0, 10, "GET /touch") == 0) {
+        sim_touch_set(query_int(req, "down", 0) != 0, query_int(req, "x", 0), query_int(req, "y", 0));
+    } else if (req.compare(0, 11, "GET /button") == 0) {
+        sim_button_set(query_int(req, "down", 0) != 0);
+    } else {
+        body = VIEWER_HTML;
+        type = "text/html";
+    }
+    char hdr[160];
+    snprintf(hdr, sizeof(hdr),
+             "HTTP/1.0 200 OK\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+             "Cache-Control: no-store\r\n\r\n", type.c_str(), body.size());
+    send_all(fd, hdr);
+    send_all(fd, body);
+}
+
+bool sim_viewer_start(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in sa = {};
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = htons(port);
+    if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)) != 0 || listen(fd, 8) != 0) {
+        perror("[sim] viewer");
+        close(fd);
+        return false;
+    }
+    fprintf(stderr, "[sim] Panel viewer on http://127.0.0.1:%d/\n", port);
+    std::thread([fd]() {
+        for (;;) {
+            int c = accept(fd, NULL, NULL);
+            if (c < 0) continue;
+            serve_http(c);
+            close(c);
+        }
+    }).detach();
+    return true;
+}
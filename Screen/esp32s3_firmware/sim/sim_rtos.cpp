@@ -0,0 +1,274 @@
+/*
+ * FreeRTOS shim: tasks are std::threads, queues and semaphores are
+ * mutex + condition variable rings, task notifications are per-task
+ * counters. Priorities and core affinity are recorded but ignored.
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// ============================================================================
+// Tasks
+// ============================================================================
+
+struct SimTask {
+    std::string             name;
+    BaseType_t              core = 1;
+    std::mutex              m;
+    std::condition_variable cv;
+    uint32_t                notify = 0;
+};
+
+static thread_local SimTask *tl_self = NULL;
+
+static Clock::time_point deadline_for(TickType_t ticks) {
+    return Clock::now() + std::chrono::milliseconds(ticks);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out,
+                                   BaseType_t core) {
+    (void)stack;
+    (void)prio;
+    SimTask *t = new SimTask();
+    t->name = name ? name : "";
+    t->core = (core == tskNO_AFFINITY) ? 0 : core;
+    if (out) *out = t;
+    std::thread([t, fn, arg]() {
+        tl_self = t;
+        pthread_setname_np(pthread_self(), t->name.substr(0, 15).c_str());
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack,
+                       void *arg, UBaseType_t prio, TaskHandle_t *out) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == NULL || task == tl_self) {
+        pthread_exit(NULL);
+    }
+    // Deleting another task is not supported; it keeps running
+}
+
+void vTaskDelay(TickType_t ticks) {
+    if (ticks == 0) std::this_thread::yield();
+    else std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+    static const Clock::time_point start = Clock::now();
+    return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start).count();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (!tl_self) {
+        // Threads not created through the shim (main / loopTask)
+        tl_self = new SimTask();
+        tl_self->name = "loopTask";
+    }
+    return tl_self;
+}
+
+BaseType_t xPortGetCoreID() {
+    return xTaskGetCurrentTaskHandle()->core;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> lk(task->m);
+        task->notify++;
+    }
+    task->cv.notify_one();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    xTaskNotifyGive(task);
+    if (woken) *woken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    SimTask *t = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lk(t->m);
+    if (ticks == portMAX_DELAY) {
+        t->cv.wait(lk, [t] { return t->notify > 0; });
+    } else {
+        t->cv.wait_until(lk, deadline_for(ticks), [t] { return t->notify > 0; });
+    }
+    uint32_t v = t->notify;
+    if (v > 0) t->notify = clear_on_exit ? 0 : v - 1;
+    return v;
+}
+
+// ============================================================================
+// Queues
+// ============================================================================
+
+struct SimQueue {
+    std::mutex              m;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::vector<uint8_t>    ring;
+    UBaseType_t             length;
+    UBaseType_t             item_size;
+    UBaseType_t             head = 0;
+    UBaseType_t             count = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    SimQueue *q = new SimQueue();
+    q->length = length;
+    q->item_size = item_size;
+    q->ring.resize((size_t)length * item_size);
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    delete q;
+}
+
+template<typename Pred>
+static bool wait_on(std::condition_variable &cv, std::unique_lock<std::mutex> &lk,
+                    TickType_t ticks, Pred pred) {
+    if (ticks == portMAX_DELAY) {
+        cv.wait(lk, pred);
+        return true;
+    }
+    return cv.wait_until(lk, deadline_for(ticks), pred);
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lk(q->m);
+    if (!wait_on(q->not_full, lk, ticks, [q] { return q->count < q->length; })) return pdFALSE;
+    UBaseType_t tail = (q->head + q->count) % q->length;
+    if (q->item_size) memcpy(&q->ring[(size_t)tail * q->item_size], item, q->item_size);
+    q->count++;
+    lk.unlock();
+    q->not_empty.notify_one();
+    return pdPASS;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t q, const void *item, TickType_t ticks) {
+    return xQueueSend(q, item, ticks);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xQueueSend(q, item, 0);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t q, const void *item) {
+    {
+        std::lock_guard<std::mutex> lk(q->m);
+        q->head = 0;
+        q->count = 1;
+        if (q->item_size) memcpy(&q->ring[0], item, q->item_size);
+    }
+    q->not_empty.notify_one();
+    return pdPASS;
+}
+
+static BaseType_t queue_take(QueueHandle_t q, void *item, TickType_t ticks, bool remove) {
+    std::unique_lock<std::mutex> lk(q->m);
+    if (!wait_on(q->not_empty, lk, ticks, [q] { return q->count > 0; })) return pdFALSE;
+    if (q->item_size && item) memcpy(item, &q->ring[(size_t)q->head * q->item_size], q->item_size);
+    if (remove) {
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        lk.unlock();
+        q->not_full.notify_one();
+    }
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+    return queue_take(q, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t ticks) {
+    return queue_take(q, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    std::lock_guard<std::mutex> lk(q->m);
+    return q->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    {
+        std::lock_guard<std::mutex> lk(q->m);
+        q->head = 0;
+        q->count = 0;
+    }
+    q->not_full.notify_all();
+    return pdPASS;
+}
+
+// ============================================================================
+// Semaphores
+// ============================================================================
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t s = xQueueCreate(1, 0);
+    xSemaphoreGive(s);
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+    SemaphoreHandle_t s = xQueueCreate(max, 0);
+    for (UBaseType_t i = 0; i < initial; i++) xSemaphoreGive(s);
+    return s;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t s) {
+    vQueueDelete(s);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+    return xQueueReceive(s, NULL, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    return xQueueSend(s, NULL, 0);
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xSemaphoreGive(s);
+}
+
+// ============================================================================
+// Critical Sections
+// ============================================================================
+
+static std::recursive_mutex s_critical;
+
+void sim_enter_critical() {
+    s_critical.lock();
+}
+
+void sim_exit_critical() {
+    s_critical.unlock();
+}
@@ -0,0 +1,200 @@
+/*
+ * WiFi shim for the host simulator: the station is always connected
+ * on 127.0.0.1 and WiFiServer/WiFiClient wrap non-blocking TCP sockets.
+ */
+
+#include "WiFi.h"
+#include "ESPmDNS.h"
+#include "sim.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+static void set_nonblock(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+// ============================================================================
+// IPAddress / WiFiClass
+// ============================================================================
+
+String IPAddress::toString() const {
+    struct in_addr a;
+    a.s_addr = _addr;
+    return String(inet_ntoa(a));
+}
+
+void WiFiClass::begin(const char *ssid, const char *password) {
+    (void)password;
+    fprintf(stderr, "[sim] WiFi: pretending to join '%s'\n", ssid ? ssid : "");
+    _status = WL_CONNECTED;
+}
+
+IPAddress WiFiClass::localIP() {
+    return IPAddress(htonl(INADDR_LOOPBACK));
+}
+
+// ============================================================================
+// WiFiClient
+// ============================================================================
+
+WiFiClient::Sock::~Sock() {
+    if (fd >= 0) close(fd);
+}
+
+WiFiClient::WiFiClient(int fd) : _sock(std::make_shared<Sock>(fd)) {
+    set_nonblock(fd);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) {
+    return connect(host, port, 3000);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeout_ms) {
+    stop();
+    struct addrinfo hints = {}, *res = NULL;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    char portstr[8];
+    snprintf(portstr, sizeof(portstr), "%u", port);
+    if (getaddrinfo(host, portstr, &hints, &res) != 0 || !res) return 0;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        freeaddrinfo(res);
+        return 0;
+    }
+    set_nonblock(fd);
+    int r = ::connect(fd, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+    if (r != 0 && errno == EINPROGRESS) {
+        struct pollfd p = { fd, POLLOUT, 0 };
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (poll(&p, 1, timeout_ms) == 1 &&
+            getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) {
+            r = 0;
+        }
+    }
+    if (r != 0) {
+        close(fd);
+        return 0;
+    }
+    _sock = std::make_shared<Sock>(fd);
+    return 1;
+}
+
+bool WiFiClient::connected() {
+    if (!_sock || _sock->fd < 0) return false;
+    if (available() > 0) return true;
+    char c;
+    ssize_t r = recv(_sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (r == 0) return false;
+    if (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK) return false;
+    return true;
+}
+
+void WiFiClient::stop() {
+    _sock.reset();
+}
+
+void WiFiClient::setNoDelay(bool nodelay) {
+    if (!_sock) return;
+    int v = nodelay ? 1 : 0;
+    setsockopt(_sock->fd, IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v));
+}
+
+IPAddress WiFiClient::remoteIP() {
+    if (!_sock) return IPAddress();
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    if (getpeername(_sock->fd, (struct sockaddr *)&sa, &len) != 0) return IPAddress();
+    return IPAddress(sa.sin_addr.s_addr);
+}
+
+int WiFiClient::available() {
+    if (!_sock) return 0;
+    int n = 0;
+    if (ioctl(_sock->fd, FIONREAD, &n) != 0) return 0;
+    return n;
+}
+
+int WiFiClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::peek() {
+    if (!_sock) return -1;
+    uint8_t c;
+    return recv(_sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t len) {
+    if (!_sock) return -1;
+    ssize_t r = recv(_sock->fd, buf, len, MSG_DONTWAIT);
+    return r < 0 ? -1 : (int)r;
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t len) {
+    if (!_sock) return 0;
+    size_t off = 0;
+    while (off < len) {
+        ssize_t w = send(_sock->fd, buf + off, len - off, MSG_NOSIGNAL);
+        if (w > 0) {
+            off += w;
+        } else if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            struct pollfd p = { _sock->fd, POLLOUT, 0 };
+            if (poll(&p, 1, 1000) <= 0) break;
+        } else if (w < 0 && errno == EINTR) {
+            continue;
+        } else {
+            break;
+        }
+    }
+    return off;
+}
+
+// ============================================================================
+// WiFiServer
+// ============================================================================
+
+void WiFiServer::begin() {
+    if (g_sim.tcp_port) _port = (uint16_t)g_sim.tcp_port;
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in sa = {};
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_ANY);
+    sa.sin_port = htons(_port);
+    if (bind(_fd, (struct sockaddr *)&sa, sizeof(sa)) != 0 || listen(_fd, 4) != 0) {
+        perror("[sim] WiFiServer");
+        close(_fd);
+        _fd = -1;
+        return;
+    }
+    set_nonblock(_fd);
+    fprintf(stderr, "[sim] TCP server on port %u\n", _port);
+}
+
+WiFiClient WiFiServer::accept() {
+    if (_fd < 0) return WiFiClient();
+    int fd = ::accept(_fd, NULL, NULL);
+    if (fd < 0) return WiFiClient();
+    WiFiClient c(fd);
+    if (_nodelay) c.setNoDelay(true);
+    return c;
+}
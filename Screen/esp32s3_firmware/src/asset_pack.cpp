@@ -0,0 +1,187 @@
+/*
+ * Flash Asset Pack - Implementation
+ *
+ * The directory is cached in RAM; the data is only ever read through
+ * the mapping. Free space is whatever no entry covers, found by walking
+ * the entries in offset order.
+ */
+
+#include "asset_pack.h"
+#include "crc32.h"
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+
+#define ASSET_SUBTYPE  0x40
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+#define ASSET_MMAP_DATA  ESP_PARTITION_MMAP_DATA
+typedef esp_partition_mmap_handle_t asset_mmap_handle_t;
+#else
+#define ASSET_MMAP_DATA  SPI_FLASH_MMAP_DATA
+typedef spi_flash_mmap_handle_t asset_mmap_handle_t;
+#endif
+
+static const esp_partition_t *s_part = NULL;
+static const uint8_t *s_map = NULL;
+static asset_mmap_handle_t s_map_handle;
+static AssetHeader s_hdr;
+static AssetEntry  s_dir[ASSET_MAX];
+
+static uint32_t sectors(uint32_t size) {
+    return (size + ASSET_SECTOR - 1) / ASSET_SECTOR * ASSET_SECTOR;
+}
+
+static int indexOf(const char *name) {
+    for (int i = 0; i < s_hdr.count; i++) {
+        if (strncmp(s_dir[i].name, name, ASSET_NAME_LEN) == 0) return i;
+    }
+    return -1;
+}
+
+static void resetDir() {
+    memset(&s_hdr, 0, sizeof(s_hdr));
+    memcpy(s_hdr.magic, ASSET_MAGIC, 4);
+    s_hdr.version = ASSET_VERSION;
+}
+
+static bool loadDir() {
+    const AssetHeader *h = (const AssetHeader *)s_map;
+    if (memcmp(h->magic, ASSET_MAGIC, 4) != 0 || h->version != ASSET_VERSION || h->count > ASSET_MAX) {
+        return false;
+    }
+    const AssetEntry *e = (const AssetEntry *)(s_map + sizeof(AssetHeader));
+    if (crc32_update(0, (const uint8_t *)e, h->count * sizeof(AssetEntry)) != h->crc) return false;
+    for (int i = 0; i < h->count; i++) {
+        if (e[i].offset < ASSET_SECTOR || e[i].offset % ASSET_SECTOR ||
+            e[i].offset > s_part->size || e[i].size > s_part->size - e[i].offset) {
+            return false;
+        }
+    }
+    s_hdr = *h;
+    memcpy(s_dir, e, h->count * sizeof(AssetEntry));
+    return true;
+}
+
+static const char *saveDir() {
+    s_hdr.crc = crc32_update(0, (const uint8_t *)s_dir, s_hdr.count * sizeof(AssetEntry));
+    if (esp_partition_erase_range(s_part, 0, ASSET_SECTOR) != ESP_OK ||
+        esp_partition_write(s_part, 0, &s_hdr, sizeof(s_hdr)) != ESP_OK ||
+        esp_partition_write(s_part, sizeof(s_hdr), s_dir, s_hdr.count * sizeof(AssetEntry)) != ESP_OK) {
+        return "flash write fail";
+    }
+    return NULL;
+}
+
+// Free run of at least `size` bytes, ignoring entry `skip`. Returns its
+// offset, or 0; *largest gets the biggest run seen.
+static uint32_t findGap(uint32_t size, int skip, uint32_t *largest) {
+    uint32_t pos = ASSET_SECTOR;
+    uint32_t best = 0;
+    uint32_t found = 0;
+    for (;;) {
+        // Next entry at or after pos
+        int next = -1;
+        for (int i = 0; i < s_hdr.count; i++) {
+            if (i == skip || s_dir[i].offset < pos) continue;
+            if (next < 0 || s_dir[i].offset < s_dir[next].offset) next = i;
+        }
+        uint32_t end = next < 0 ? s_part->size / ASSET_SECTOR * ASSET_SECTOR : s_dir[next].offset;
+        uint32_t run = end > pos ? end - pos : 0;
+        if (run > best) best = run;
+        if (!found && run >= size) found = pos;
+        if (next < 0) break;
+        pos = s_dir[next].offset + sectors(s_dir[next].size);
+    }
+    if (largest) *largest = best;
+    return found;
+}
+
+bool asset_pack_init() {
+    s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_SUBTYPE,
+                                      "assets");
+    if (!s_part) return false;
+    const void *p;
+    if (esp_partition_mmap(s_part, 0, s_part->size, ASSET_MMAP_DATA, &p, &s_map_handle) != ESP_OK) {
+        s_part = NULL;
+        return false;
+    }
+    s_map = (const uint8_t *)p;
+    if (!loadDir()) resetDir();
+    return true;
+}
+
+const AssetEntry *asset_find(const char *name) {
+    int i = s_part ? indexOf(name) : -1;
+    return i < 0 ? NULL : &s_dir[i];
+}
+
+const uint8_t *asset_data(const AssetEntry *e) {
+    return s_map + e->offset;
+}
+
+bool asset_verify(const AssetEntry *e) {
+    return crc32_update(0, asset_data(e), e->size) == e->crc;
+}
+
+const char *asset_write(const char *name, AssetFormat format, const uint8_t *data, uint32_t size) {
+    if (!s_part) return "no asset partition";
+    if (!name[0] || strlen(name) >= ASSET_NAME_LEN || !size) return "bad asset";
+    int old = indexOf(name);
+    if (old < 0 && s_hdr.count >= ASSET_MAX) return "directory full";
+
+    // Beside the old version if there is room, else over it
+    uint32_t at = findGap(sectors(size), -1, NULL);
+    if (!at && old >= 0) {
+        at = findGap(sectors(size), old, NULL);
+        if (at) {
+            s_dir[old] = s_dir[--s_hdr.count];
+            const char *err = saveDir();
+            if (err) return err;
+            old = -1;
+        }
+    }
+    if (!at) return "no room";
+
+    if (esp_partition_erase_range(s_part, at, sectors(size)) != ESP_OK ||
+        esp_partition_write(s_part, at, data, size) != ESP_OK) {
+        return "flash write fail";
+    }
+    AssetEntry e;
+    memset(&e, 0, sizeof(e));
+    strncpy(e.name, name, ASSET_NAME_LEN - 1);
+    e.offset = at;
+    e.size = size;
+    e.crc = crc32_update(0, data, size);
+    e.format = format;
+    if (!asset_verify(&e)) return "flash verify fail";
+
+    if (old >= 0) s_dir[old] = e;
+    else s_dir[s_hdr.count++] = e;
+    return saveDir();
+}
+
+const char *asset_delete(const char *name) {
+    int i = s_part ? indexOf(name) : -1;
+    if (i < 0) return "no asset";
+    s_dir[i] = s_dir[--s_hdr.count];
+    return saveDir();
+}
+
+int asset_count() {
+    return s_part ? s_hdr.count : 0;
+}
+
+const AssetEntry *asset_at(int i) {
+    return i >= 0 && i < asset_count() ? &s_dir[i] : NULL;
+}
+
+uint32_t asset_pack_size() {
+    return s_part ? s_part->size : 0;
+}
+
+uint32_t asset_pack_free() {
+    if (!s_part) return 0;
+    uint32_t largest;
+    findGap(UINT32_MAX, -1, &largest);
+    return largest;
+}
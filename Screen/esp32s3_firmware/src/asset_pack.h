@@ -0,0 +1,72 @@
+/*
+ * Flash Asset Pack for SenseCAP Indicator
+ *
+ * Pre-encoded images (splash screens, sprites, UI cards) kept in the
+ * "assets" data partition (partitions.csv) and memory-mapped, so they
+ * are read straight from flash through the cache and never copied into
+ * RAM to be shown. tools/pack_assets.py builds the partition image from
+ * a directory; single assets can be replaced or added on the device.
+ *
+ * Layout (little-endian):
+ *   sector 0        AssetHeader, then `count` AssetEntry records
+ *   sectors 1..     asset data, each starting on a sector boundary
+ *
+ * An update writes the new data into free sectors first and only then
+ * rewrites the directory sector, so the old version stays intact until
+ * the new one is complete.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define ASSET_MAGIC       "SCAP"
+#define ASSET_VERSION     1
+#define ASSET_NAME_LEN    16            // Including the terminator
+#define ASSET_SECTOR      4096
+#define ASSET_MAX         ((ASSET_SECTOR - sizeof(AssetHeader)) / sizeof(AssetEntry))
+
+enum AssetFormat {
+    ASSET_JPEG = 0,
+    ASSET_QOI = 1,
+    ASSET_RGB565 = 2,                   // Raw 480x480 frame, little-endian
+};
+
+struct AssetHeader {
+    char     magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t crc;                       // CRC-32 of the entries
+    uint32_t reserved;
+};
+
+struct AssetEntry {
+    char     name[ASSET_NAME_LEN];
+    uint32_t offset;                    // From the partition start
+    uint32_t size;
+    uint32_t crc;                       // CRC-32 of the data
+    uint8_t  format;                    // AssetFormat
+    uint8_t  reserved[3];
+};
+
+// Find and map the partition. False if there is none; an erased or
+// corrupt directory reads as an empty pack.
+bool asset_pack_init();
+
+// Entry by name, or NULL
+const AssetEntry *asset_find(const char *name);
+
+// Mapped data of an entry (valid until the next write / delete)
+const uint8_t *asset_data(const AssetEntry *e);
+
+// Recompute the CRC of an entry's data
+bool asset_verify(const AssetEntry *e);
+
+// Add or replace an asset. Returns NULL or an error message.
+const char *asset_write(const char *name, AssetFormat format, const uint8_t *data, uint32_t size);
+const char *asset_delete(const char *name);
+
+int asset_count();
+const AssetEntry *asset_at(int i);
+uint32_t asset_pack_size();             // Partition bytes (0 without one)
+uint32_t asset_pack_free();             // Largest free run of sectors, bytes
@@ -0,0 +1,346 @@
+/*
+ * On-Device Benchmarks - Implementation
+ *
+ * Every measurement repeats its operation until it has run for at
+ * least BENCH_MIN_US and reports the average, so results are stable
+ * without tuning iteration counts per board. Bandwidth is in MB/s
+ * (bytes per microsecond), per-call costs in microseconds.
+ */
+
+#include "bench.h"
+#include <ArduinoJson.h>
+#include <JPEGDEC.h>
+#include "esp_heap_caps.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_timer.h"
+#include "bench_jpeg.h"
+#include "bench_ui.h"
+#include "compositor.h"
+#include "display.h"
+#include "face.h"
+#include "pins.h"
+#include "qoi.h"
+
+#define FRAME_PX        (LCD_H_RES * LCD_V_RES)
+#define FRAME_BYTES     (FRAME_PX * 2)
+#define SRAM_ROWS       16
+#define SRAM_BYTES      (LCD_H_RES * SRAM_ROWS * 2)
+#define BENCH_MIN_US    100000
+
+// ============================================================================
+// Report Writer
+// ============================================================================
+
+struct Report {
+    char  *buf;
+    size_t len;
+    size_t pos;
+    bool   first;   // No member written yet in the current object
+};
+
+static void rep_raw(Report &r, const char *fmt, ...) {
+    if (r.pos >= r.len) return;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(r.buf + r.pos, r.len - r.pos, fmt, args);
+    va_end(args);
+    if (n > 0) r.pos += n;
+    if (r.pos >= r.len) r.pos = r.len - 1;
+}
+
+static void rep_begin(Report &r, const char *name) {
+    rep_raw(r, "%s\"%s\":{", r.first ? "" : ",", name);
+    r.first = true;
+}
+
+static void rep_end(Report &r) {
+    rep_raw(r, "}");
+    r.first = false;
+}
+
+static void rep_int(Report &r, const char *key, int v) {
+    rep_raw(r, "%s\"%s\":%d", r.first ? "" : ",", key, v);
+    r.first = false;
+}
+
+static void rep_num(Report &r, const char *key, float v) {
+    rep_raw(r, "%s\"%s\":%.1f", r.first ? "" : ",", key, v);
+    r.first = false;
+}
+
+// ============================================================================
+// Timing Helpers
+// ============================================================================
+
+// Average microseconds per call of fn(), run for at least BENCH_MIN_US
+template<typename F>
+static float time_us(F fn) {
+    fn();  // Warm up caches / lazy init
+    int iters = 0;
+    int64_t start = esp_timer_get_time();
+    int64_t elapsed;
+    do {
+        fn();
+        iters++;
+        elapsed = esp_timer_get_time() - start;
+    } while (elapsed < BENCH_MIN_US);
+    return (float)elapsed / iters;
+}
+
+static float mbs(size_t bytes, float us) {
+    return us > 0 ? bytes / us : 0;
+}
+
+// Keeps read loops from being optimized away
+static volatile uint32_t s_sink;
+
+// ============================================================================
+// Suites
+// ============================================================================
+
+struct Scratch {
+    uint16_t *a;      // PSRAM frame
+    uint16_t *b;      // PSRAM frame
+    uint16_t *sram;   // Internal SRAM strip
+};
+
+static void suite_copy(Report &r, Scratch &s) {
+    rep_begin(r, "copy");
+
+    float us = time_us([&] { memset(s.a, 0x5A, FRAME_BYTES); });
+    rep_num(r, "psram_write_mbs", mbs(FRAME_BYTES, us));
+
+    us = time_us([&] {
+        const uint32_t *p = (const uint32_t *)s.a;
+        uint32_t acc = 0;
+        for (int i = 0; i < FRAME_BYTES / 4; i += 4) acc += p[i] + p[i + 1] + p[i + 2] + p[i + 3];
+        s_sink = acc;
+    });
+    rep_num(r, "psram_read_mbs", mbs(FRAME_BYTES, us));
+
+    us = time_us([&] { memcpy(s.b, s.a, FRAME_BYTES); });
+    rep_num(r, "psram_to_psram_mbs", mbs(FRAME_BYTES, us));
+
+    us = time_us([&] {
+        for (int off = 0; off < FRAME_PX; off += SRAM_BYTES / 2) memcpy(s.a + off, s.sram, SRAM_BYTES);
+    });
+    rep_num(r, "sram_to_psram_mbs", mbs(FRAME_BYTES, us));
+
+    us = time_us([&] {
+        for (int off = 0; off < FRAME_PX; off += SRAM_BYTES / 2) memcpy(s.sram, s.a + off, SRAM_BYTES);
+    });
+    rep_num(r, "psram_to_sram_mbs", mbs(FRAME_BYTES, us));
+
+    us = time_us([&] { memcpy(s.sram, s.sram + SRAM_BYTES / 4, SRAM_BYTES / 2); });
+    rep_num(r, "sram_to_sram_mbs", mbs(SRAM_BYTES / 2, us));
+
+    rep_end(r);
+}
+
+static void suite_fill(Report &r, Scratch &s) {
+    rep_begin(r, "fill");
+
+    float us = time_us([&] { display_fill_buffer(s.a, 0x1234, FRAME_PX); });
+    rep_num(r, "psram_mpx_s", FRAME_PX / us);
+
+    us = time_us([&] { display_fill_buffer(s.sram, 0x1234, SRAM_BYTES / 2); });
+    rep_num(r, "sram_mpx_s", (SRAM_BYTES / 2) / us);
+
+    // Panel fill is visible, so the screen is saved and put back after.
+    // A direct-mode layer lives only in the framebuffer the fill
+    // overwrites; the compositor could not redraw it.
+    display_wait_idle();
+    memcpy(s.a, compositor_frame(), FRAME_BYTES);
+    us = time_us([&] { display_fill(0x0000); });
+    rep_num(r, "panel_ms", us / 1000);
+    rep_num(r, "panel_mpx_s", FRAME_PX / us);
+
+    display_draw_fullscreen(s.a);
+    rep_end(r);
+}
+
+static void suite_draw(Report &r, Scratch &s) {
+    rep_begin(r, "draw");
+    esp_lcd_panel_handle_t panel = display_get_panel();
+
+    // Source: a copy of what's on screen, so pushes don't change it
+    display_wait_idle();
+    memcpy(s.a, compositor_frame(), FRAME_BYTES);
+
+    float us = time_us([&] {
+        esp_lcd_panel_draw_bitmap(panel, 0, 0, LCD_H_RES, LCD_V_RES, s.a);
+    });
+    rep_num(r, "bitmap_full_ms", us / 1000);
+    rep_num(r, "bitmap_full_mpx_s", FRAME_PX / us);
+
+    us = time_us([&] {
+        for (int y = 0; y < LCD_V_RES; y += SRAM_ROWS) {
+            esp_lcd_panel_draw_bitmap(panel, 0, y, LCD_H_RES, y + SRAM_ROWS, s.a + y * LCD_H_RES);
+        }
+    });
+    rep_num(r, "bitmap_strips_ms", us / 1000);
+
+    // Small-rect call overhead: a 64x64 tile packed into SRAM
+    for (int row = 0; row < 64; row++) {
+        memcpy(s.sram + row * 64, s.a + row * LCD_H_RES, 64 * 2);
+    }
+    us = time_us([&] { esp_lcd_panel_draw_bitmap(panel, 0, 0, 64, 64, s.sram); });
+    rep_num(r, "bitmap_64x64_us", us);
+
+    us = time_us([&] { display_draw_fullscreen(s.a); });
+    rep_num(r, "fullscreen_ms", us / 1000);
+
+    us = time_us([&] { display_draw_rect(0, 0, 64, 64, s.sram); });
+    rep_num(r, "rect_64x64_us", us);
+
+    rep_end(r);
+}
+
+// Decode target for the decode suite
+static uint16_t *s_decode_dst = NULL;
+
+static int bench_draw_cb(JPEGDRAW *d) {
+    for (int y = 0; y < d->iHeight; y++) {
+        int row = d->y + y;
+        if (row >= LCD_V_RES) break;
+        int w = min(d->iWidth, LCD_H_RES - d->x);
+        if (w > 0) memcpy(&s_decode_dst[row * LCD_H_RES + d->x], &d->pPixels[y * d->iWidth], w * 2);
+    }
+    return 1;
+}
+
+static void suite_decode(Report &r, Scratch &s) {
+    rep_begin(r, "decode");
+    rep_int(r, "jpeg_bytes", BENCH_JPEG_SIZE);
+
+    JPEGDEC *dec = new JPEGDEC();
+    s_decode_dst = s.a;
+    static const struct { const char *key; int scale; } scales[] = {
+        { "full_ms", 0 },
+        { "half_ms", JPEG_SCALE_HALF },
+        { "quarter_ms", JPEG_SCALE_QUARTER },
+        { "eighth_ms", JPEG_SCALE_EIGHTH },
+    };
+    for (auto &sc : scales) {
+        bool ok = true;
+        float us = time_us([&] {
+            if (!dec->openRAM((uint8_t *)BENCH_JPEG, BENCH_JPEG_SIZE, bench_draw_cb)) {
+                ok = false;
+                return;
+            }
+            dec->setPixelType(RGB565_LITTLE_ENDIAN);
+            if (!dec->decode(0, 0, sc.scale)) ok = false;
+            dec->close();
+        });
+        rep_num(r, sc.key, ok ? us / 1000 : -1);
+    }
+
+    // Same UI frame as JPEG and QOI: wire size and decode speed (MB/s of
+    // RGB565 output)
+    rep_int(r, "ui_jpeg_bytes", BENCH_UI_JPEG_SIZE);
+    rep_int(r, "ui_qoi_bytes", BENCH_UI_QOI_SIZE);
+    bool ok = true;
+    float us = time_us([&] {
+        if (!dec->openRAM((uint8_t *)BENCH_UI_JPEG, BENCH_UI_JPEG_SIZE, bench_draw_cb)) {
+            ok = false;
+            return;
+        }
+        dec->setPixelType(RGB565_LITTLE_ENDIAN);
+        if (!dec->decode(0, 0, 0)) ok = false;
+        dec->close();
+    });
+    rep_num(r, "ui_jpeg_ms", ok ? us / 1000 : -1);
+    rep_num(r, "ui_jpeg_mbs", ok ? mbs(FRAME_BYTES, us) : -1);
+
+    ok = true;
+    us = time_us([&] {
+        QoiDecoder q;
+        size_t pos = QOI_HEADER_SIZE;
+        if (!qoi_decode_begin(&q, BENCH_UI_QOI) ||
+            qoi_decode_rgb565(&q, BENCH_UI_QOI, BENCH_UI_QOI_SIZE, &pos, s.a, FRAME_PX) != FRAME_PX) {
+            ok = false;
+        }
+    });
+    rep_num(r, "ui_qoi_ms", ok ? us / 1000 : -1);
+    rep_num(r, "ui_qoi_mbs", ok ? mbs(FRAME_BYTES, us) : -1);
+    delete dec;
+    rep_end(r);
+}
+
+static void suite_face(Report &r) {
+    rep_begin(r, "face");
+    int tiles = 0, frames = 0;
+    float us = time_us([&] {
+        face_render_frame();
+        tiles += compositor_last_tiles();
+        frames++;
+    });
+    display_wait_idle();
+    rep_num(r, "frame_ms", us / 1000);
+    rep_num(r, "tiles_per_frame", frames ? (float)tiles / frames : 0);
+    rep_end(r);
+}
+
+static void suite_parse(Report &r) {
+    static const char *cmds[] = {
+        "{\"cmd\":\"mouth\",\"open\":0.42}",
+        "{\"cmd\":\"image\",\"len\":61234,\"transition\":\"fade\",\"duration\":300}",
+        "{\"cmd\":\"melody\",\"notes\":\"440:200,554:200,659:400\"}",
+    };
+    rep_begin(r, "parse");
+    float us = time_us([&] {
+        for (const char *c : cmds) {
+            StaticJsonDocument<256> doc;
+            deserializeJson(doc, c);
+            s_sink = doc["cmd"].as<const char *>()[0];
+        }
+    });
+    rep_num(r, "cmd_us", us / 3);
+    rep_end(r);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool bench_run(const char *suite, char *out, size_t len) {
+    bool all = strcmp(suite, "all") == 0;
+    static const char *known[] = { "copy", "fill", "draw", "decode", "face", "parse" };
+    bool found = all;
+    for (const char *k : known) found |= strcmp(suite, k) == 0;
+    if (!found) {
+        snprintf(out, len, "unknown suite");
+        return false;
+    }
+
+    Scratch s;
+    s.a = (uint16_t *)heap_caps_malloc(FRAME_BYTES, MALLOC_CAP_SPIRAM);
+    s.b = (uint16_t *)heap_caps_malloc(FRAME_BYTES, MALLOC_CAP_SPIRAM);
+    s.sram = (uint16_t *)heap_caps_malloc(SRAM_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!s.a || !s.b || !s.sram) {
+        heap_caps_free(s.a);
+        heap_caps_free(s.b);
+        heap_caps_free(s.sram);
+        snprintf(out, len, "bench alloc failed");
+        return false;
+    }
+    memset(s.sram, 0, SRAM_BYTES);
+
+    // Don't time someone else's in-flight present
+    display_wait_idle();
+
+    Report r = { out, len, 0, true };
+    rep_raw(r, "{");
+    if (all || !strcmp(suite, "copy"))   suite_copy(r, s);
+    if (all || !strcmp(suite, "fill"))   suite_fill(r, s);
+    if (all || !strcmp(suite, "draw"))   suite_draw(r, s);
+    if (all || !strcmp(suite, "decode")) suite_decode(r, s);
+    if (all || !strcmp(suite, "face"))   suite_face(r);
+    if (all || !strcmp(suite, "parse"))  suite_parse(r);
+    rep_raw(r, "}");
+
+    heap_caps_free(s.a);
+    heap_caps_free(s.b);
+    heap_caps_free(s.sram);
+    return true;
+}
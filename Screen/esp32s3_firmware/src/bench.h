@@ -0,0 +1,31 @@
+/*
+ * On-Device Benchmarks for SenseCAP Indicator
+ *
+ * Microbenchmarks for the memory, display and decode paths, run with
+ * {"cmd":"bench","suite":"..."} so firmware builds can be compared on
+ * real hardware with one command.
+ *
+ * Suites:
+ *   copy    PSRAM / SRAM read, write and memcpy bandwidth
+ *   fill    Buffer fills and a full panel fill
+ *   draw    esp_lcd_panel_draw_bitmap() and display_* push throughput
+ *   decode  JPEGDEC on the embedded reference JPEG at each scale
+ *   face    Face frame render + flush
+ *   parse   JSON command parse
+ *   all     Everything above
+ *
+ * Draw suites push the frame that is already on screen; the panel
+ * fill is the only visible step and the screen is restored after it.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define BENCH_REPORT_SIZE  2048
+
+// Run a suite and write its results as a JSON object into out, e.g.
+//   {"copy":{"psram_read_mbs":...},"fill":{...}}
+// Returns false for an unknown suite or if scratch buffers can't be
+// allocated (out then holds a short error message).
+bool bench_run(const char *suite, char *out, size_t len);
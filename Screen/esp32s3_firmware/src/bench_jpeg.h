@@ -0,0 +1,1862 @@
+/*
+ * Reference JPEG for the bench command (480x480 test card, 4:2:0,
+ * quality 80, 29542 bytes).
+ *
+ * Generated by tools/gen_bench_jpeg.py - do not edit.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define BENCH_JPEG_SIZE  29542
+
+static const uint8_t BENCH_JPEG[BENCH_JPEG_SIZE] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x84, 0x00, 0x06, 0x04, 0x04, 0x06, 0x0A, 0x10, 0x14,
+    0x18, 0x05, 0x05, 0x06, 0x08, 0x0A, 0x17, 0x18, 0x16, 0x06, 0x05, 0x06, 0x0A, 0x10, 0x17, 0x1C,
+    0x16, 0x06, 0x07, 0x09, 0x0C, 0x14, 0x23, 0x20, 0x19, 0x07, 0x09, 0x0F, 0x16, 0x1B, 0x2C, 0x29,
+    0x1F, 0x0A, 0x0E, 0x16, 0x1A, 0x20, 0x2A, 0x2D, 0x25, 0x14, 0x1A, 0x1F, 0x23, 0x29, 0x30, 0x30,
+    0x28, 0x1D, 0x25, 0x26, 0x27, 0x2D, 0x28, 0x29, 0x28, 0x01, 0x07, 0x07, 0x0A, 0x13, 0x28, 0x28,
+    0x28, 0x28, 0x07, 0x08, 0x0A, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x0A, 0x0A, 0x16, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x13, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x01,
+    0xE0, 0x01, 0xE0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4,
+    0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13,
+    0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15,
+    0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4,
+    0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2,
+    0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+    0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5,
+    0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04,
+    0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11,
+    0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+    0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1, 0x0A,
+    0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93,
+    0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8,
+    0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6,
+    0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF0, 0xFC, 0x52, 0x81, 0x46,
+    0x29, 0xC0, 0x57, 0xD8, 0x92, 0x84, 0xC5, 0x2E, 0x29, 0x71, 0x4A, 0x05, 0x05, 0xA0, 0x02, 0x94,
+    0x0A, 0x00, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0x82, 0x90, 0x98, 0xA5,
+    0xC5, 0x2E, 0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xEC, 0x50, 0x5A, 0x13, 0x14,
+    0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x42, 0x62, 0x9D, 0x8A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02,
+    0x94, 0x0A, 0x00, 0xA7, 0x62, 0x82, 0xD0, 0x98, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x52, 0x2D, 0x06,
+    0x29, 0x71, 0x46, 0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x09,
+    0x8A, 0x70, 0x14, 0x62, 0x94, 0x0A, 0x0A, 0x41, 0x8A, 0x5C, 0x51, 0x8A, 0x70, 0x14, 0x16, 0x84,
+    0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x4C, 0x53, 0x80, 0xA3, 0x14, 0xA0, 0x50, 0x5A,
+    0x0C, 0x52, 0xE2, 0x97, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05,
+    0xA0, 0xC5, 0x28, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x41, 0x8A, 0x5C, 0x52, 0xE2, 0x94, 0x0A, 0x0B,
+    0x42, 0x01, 0x4E, 0x02, 0x80, 0x29, 0x71, 0x41, 0x68, 0x31, 0x4A, 0x05, 0x18, 0xA7, 0x01, 0x41,
+    0x68, 0x4C, 0x52, 0xE2, 0x97, 0x14, 0xA0, 0x52, 0x29, 0x08, 0x05, 0x38, 0x0A, 0x00, 0xA5, 0xC5,
+    0x05, 0xA0, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0x82, 0xD0, 0x98, 0xA5, 0xC5, 0x2E, 0x29, 0x40,
+    0xA0, 0xB4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xB8, 0xA0, 0xB4, 0x18, 0xA5, 0x02, 0x97, 0x14, 0xA0,
+    0x50, 0x5A, 0x13, 0x14, 0xEC, 0x51, 0x8A, 0x50, 0x28, 0x2D, 0x00, 0x14, 0xA0, 0x50, 0x05, 0x3B,
+    0x14, 0x16, 0x8F, 0x3A, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0xA8, 0xFC, 0xA5, 0x00, 0x14, 0xA0,
+    0x50, 0x05, 0x2E, 0x29, 0x16, 0x80, 0x0A, 0x5C, 0x52, 0x81, 0x4B, 0x8A, 0x0A, 0x42, 0x62, 0x94,
+    0x0A, 0x5C, 0x52, 0x81, 0x41, 0x68, 0x00, 0xA5, 0x02, 0x80, 0x29, 0xD8, 0xA0, 0xB4, 0x20, 0x14,
+    0xB8, 0xA5, 0x02, 0x97, 0x14, 0x16, 0x84, 0xC5, 0x38, 0x0A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02,
+    0x94, 0x0A, 0x00, 0xA7, 0x62, 0x82, 0xD0, 0x80, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x0C,
+    0x52, 0x81, 0x46, 0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x08,
+    0x05, 0x2E, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28, 0x14, 0x62, 0x9C, 0x05, 0x05, 0x21,
+    0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x10, 0x0A, 0x76, 0x28, 0x02, 0x97, 0x14, 0x8B,
+    0x41, 0x8A, 0x50, 0x29, 0x71, 0x4A, 0x05, 0x05, 0xA1, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50,
+    0x5A, 0x00, 0x29, 0x71, 0x40, 0x14, 0xB8, 0xA0, 0xB4, 0x18, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x50,
+    0x5A, 0x10, 0x0A, 0x70, 0x14, 0x01, 0x4B, 0x8A, 0x0B, 0x40, 0x05, 0x2E, 0x28, 0x02, 0x9D, 0x8A,
+    0x0B, 0x42, 0x62, 0x94, 0x0A, 0x5C, 0x52, 0x81, 0x41, 0x48, 0x40, 0x29, 0xC0, 0x50, 0x05, 0x2E,
+    0x28, 0x2D, 0x00, 0x14, 0xB8, 0xA5, 0x02, 0x97, 0x14, 0x16, 0x84, 0xC5, 0x28, 0x14, 0xB8, 0xA5,
+    0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05, 0x00, 0x53, 0xB1, 0x41, 0x68, 0x40, 0x29, 0x71, 0x4A, 0x05,
+    0x2E, 0x28, 0x2D, 0x09, 0x8A, 0x70, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x40, 0x05, 0x28, 0x14, 0x01,
+    0x4E, 0xC5, 0x22, 0xD0, 0x80, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x3C, 0xEC, 0x0A, 0x50,
+    0x28, 0x02, 0x94, 0x0A, 0xA3, 0xF2, 0x94, 0x18, 0xA5, 0xC5, 0x2E, 0x29, 0x71, 0x41, 0x68, 0x40,
+    0x29, 0x71, 0x4A, 0x05, 0x28, 0x14, 0x14, 0x80, 0x0A, 0x50, 0x28, 0x02, 0x9C, 0x05, 0x05, 0xA1,
+    0x31, 0x4B, 0x8A, 0x5C, 0x52, 0xE2, 0x82, 0xD0, 0x80, 0x53, 0xB1, 0x40, 0x14, 0xA0, 0x50, 0x5A,
+    0x00, 0x29, 0x40, 0xA5, 0x02, 0x94, 0x0A, 0x0B, 0x42, 0x62, 0x97, 0x14, 0xB8, 0xA5, 0xC5, 0x22,
+    0xD0, 0x01, 0x4B, 0x8A, 0x00, 0xA5, 0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x50,
+    0x5A, 0x13, 0x14, 0xEC, 0x51, 0x8A, 0x5C, 0x50, 0x5A, 0x00, 0x29, 0x71, 0x40, 0x14, 0xE0, 0x28,
+    0x29, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0x81, 0x41, 0x68, 0x4C, 0x53, 0xB1, 0x46, 0x29, 0x71,
+    0x41, 0x68, 0x00, 0xA5, 0xC5, 0x28, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5,
+    0x02, 0x82, 0xD0, 0x62, 0x97, 0x14, 0x62, 0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x52, 0x81, 0x4A,
+    0x05, 0x05, 0xA1, 0x00, 0xA7, 0x01, 0x40, 0x14, 0xA0, 0x50, 0x5A, 0x0C, 0x52, 0xE2, 0x8C, 0x53,
+    0xB1, 0x41, 0x68, 0x40, 0x29, 0x71, 0x4A, 0x05, 0x28, 0x14, 0x8A, 0x40, 0x05, 0x28, 0x14, 0x01,
+    0x4A, 0x05, 0x05, 0xA0, 0xC5, 0x2E, 0x29, 0x71, 0x4B, 0x8A, 0x0B, 0x42, 0x01, 0x4B, 0x8A, 0x50,
+    0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xE0, 0x28, 0x2D, 0x09, 0x8A, 0x5C, 0x52,
+    0xE2, 0x97, 0x14, 0x16, 0x84, 0x02, 0x9D, 0x8A, 0x00, 0xA5, 0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05,
+    0x00, 0x53, 0x80, 0xA0, 0xB4, 0x26, 0x29, 0x71, 0x4B, 0x8A, 0x5C, 0x50, 0x5A, 0x00, 0x29, 0x71,
+    0x40, 0x14, 0xA0, 0x50, 0x5A, 0x3C, 0xEF, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x67, 0xE5, 0x28,
+    0x4C, 0x53, 0xB1, 0x46, 0x29, 0x40, 0xA0, 0xA4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xEC, 0x50, 0x5A,
+    0x13, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x42, 0x62, 0x9D, 0x8A, 0x31, 0x4A, 0x05, 0x05,
+    0xA0, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x4C, 0x52, 0x81, 0x4B, 0x8A, 0x50, 0x28,
+    0x2D, 0x06, 0x29, 0x71, 0x46, 0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28,
+    0x2D, 0x09, 0x8A, 0x70, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x41, 0x8A, 0x5C, 0x51, 0x8A, 0x70, 0x14,
+    0x14, 0x84, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x4C, 0x53, 0x80, 0xA3, 0x14, 0xA0,
+    0x50, 0x5A, 0x0C, 0x52, 0xE2, 0x97, 0x14, 0xA0, 0x52, 0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52,
+    0xE2, 0x82, 0xD0, 0x62, 0x94, 0x0A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0xC5, 0x2E, 0x29, 0x71, 0x4A,
+    0x05, 0x05, 0xA1, 0x00, 0xA7, 0x01, 0x40, 0x14, 0xB8, 0xA0, 0xB4, 0x18, 0xA5, 0x02, 0x8C, 0x53,
+    0x80, 0xA0, 0xB4, 0x26, 0x29, 0x71, 0x4B, 0x8A, 0x50, 0x28, 0x2D, 0x00, 0x14, 0xA0, 0x50, 0x05,
+    0x2E, 0x28, 0x29, 0x06, 0x29, 0x40, 0xA5, 0xC5, 0x28, 0x14, 0x16, 0x84, 0xC5, 0x2E, 0x29, 0x71,
+    0x4A, 0x05, 0x05, 0xA0, 0x02, 0x94, 0x0A, 0x00, 0xA7, 0x62, 0x82, 0xD0, 0x98, 0xA5, 0x02, 0x97,
+    0x14, 0xA0, 0x50, 0x5A, 0x13, 0x14, 0xEC, 0x51, 0x8A, 0x50, 0x28, 0x2D, 0x00, 0x14, 0xA0, 0x50,
+    0x05, 0x3B, 0x14, 0x8B, 0x42, 0x62, 0x94, 0x0A, 0x5C, 0x52, 0x81, 0x41, 0x68, 0x31, 0x4B, 0x8A,
+    0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x48, 0xF3, 0xAC, 0x52,
+    0x81, 0x4B, 0x8A, 0x50, 0x2A, 0x8F, 0xCA, 0x90, 0x01, 0x4A, 0x05, 0x00, 0x53, 0xB1, 0x41, 0x48,
+    0x40, 0x29, 0x71, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x09, 0x8A, 0x70, 0x14, 0x62, 0x94, 0x0A, 0x0B,
+    0x40, 0x05, 0x28, 0x14, 0x01, 0x4E, 0xC5, 0x05, 0xA1, 0x00, 0xA5, 0xC5, 0x28, 0x14, 0xB8, 0xA4,
+    0x5A, 0x0C, 0x52, 0x81, 0x46, 0x2A, 0x48, 0x61, 0x77, 0x20, 0x43, 0x1B, 0xBB, 0x92, 0x23, 0x8A,
+    0x35, 0x19, 0x32, 0x3B, 0x1E, 0x02, 0x28, 0xEE, 0x4D, 0x0D, 0xF7, 0x7E, 0x6C, 0xB4, 0x30, 0x0A,
+    0x50, 0x2B, 0xB8, 0xD0, 0x7E, 0x12, 0x6B, 0x37, 0x04, 0x1B, 0xE0, 0x96, 0x11, 0x60, 0x3E, 0xF9,
+    0x39, 0x66, 0x0E, 0xA7, 0xEE, 0xC0, 0xA7, 0xA8, 0x38, 0xCE, 0xE2, 0xA4, 0x7B, 0xF4, 0xAE, 0xF3,
+    0x46, 0xF8, 0x4D, 0xA1, 0xDB, 0xE0, 0xDC, 0xC7, 0x2D, 0xEC, 0x9F, 0x2B, 0x16, 0x98, 0xFC, 0xA2,
+    0x44, 0xEB, 0xB2, 0x15, 0xC7, 0x0E, 0x7B, 0x31, 0x6F, 0x4F, 0x5C, 0xFC, 0xD6, 0x3F, 0x3F, 0xC3,
+    0x43, 0xFE, 0x5F, 0xF3, 0xBE, 0xD1, 0xD7, 0xF1, 0xDB, 0xF1, 0x3A, 0xA9, 0xD1, 0x97, 0x6B, 0x1E,
+    0x18, 0x05, 0x6A, 0x43, 0xE1, 0x9D, 0x61, 0xC0, 0x30, 0xE8, 0xDA, 0x93, 0xA1, 0x02, 0x48, 0xA4,
+    0x58, 0x9C, 0x89, 0x11, 0x87, 0x05, 0x18, 0x0E, 0x84, 0x57, 0xD1, 0x36, 0x3A, 0x4D, 0x8D, 0xBE,
+    0x7E, 0xC1, 0x61, 0x6B, 0x6F, 0x9C, 0x79, 0xBE, 0x4A, 0x05, 0xF3, 0x36, 0xE7, 0x1B, 0xF6, 0x81,
+    0xF7, 0x72, 0x6A, 0xDD, 0x7C, 0xD5, 0x7E, 0x2D, 0x7F, 0xF3, 0x0D, 0x97, 0xAF, 0x56, 0xF7, 0xF9,
+    0x25, 0xFA, 0x9D, 0x31, 0xC3, 0xFF, 0x00, 0x34, 0xCF, 0x9B, 0xBF, 0xE1, 0x14, 0xD6, 0xFF, 0x00,
+    0xE8, 0x05, 0xAA, 0xFF, 0x00, 0xDF, 0x97, 0xFF, 0x00, 0xE2, 0x69, 0x7F, 0xE1, 0x14, 0xD6, 0xFF,
+    0x00, 0xE8, 0x05, 0xAA, 0x7F, 0xDF, 0x97, 0xFF, 0x00, 0xE2, 0x6B, 0xE9, 0x0A, 0x2B, 0x0F, 0xF5,
+    0xB2, 0xA7, 0xFD, 0x00, 0xD1, 0xFB, 0xD9, 0x5E, 0xC1, 0x7F, 0x33, 0x3E, 0x66, 0xBD, 0xD2, 0x6F,
+    0x6D, 0xF1, 0xF6, 0xEB, 0x1B, 0xAB, 0x7C, 0xE7, 0xCA, 0xF3, 0x90, 0xAF, 0x99, 0xB7, 0x19, 0xD9,
+    0xB8, 0x0F, 0xBB, 0x91, 0x55, 0x80, 0xAF, 0xA8, 0xAB, 0x22, 0xFF, 0x00, 0xC2, 0x5A, 0x2C, 0xFB,
+    0xBE, 0xD5, 0xA4, 0x59, 0x31, 0x63, 0xBE, 0x69, 0x55, 0x00, 0x67, 0x72, 0xD9, 0xC9, 0x99, 0x30,
+    0x7E, 0x63, 0xEF, 0xCF, 0x7A, 0xEB, 0xC3, 0xF1, 0x6A, 0xFF, 0x00, 0x98, 0xBC, 0x04, 0x97, 0x76,
+    0x9D, 0xFF, 0x00, 0x06, 0x97, 0xE6, 0x0E, 0x8F, 0x69, 0x1F, 0x3A, 0x81, 0x4E, 0xC5, 0x7A, 0xCE,
+    0xB1, 0xF0, 0x6E, 0xD1, 0xB2, 0x74, 0x9B, 0xE9, 0x60, 0x3F, 0x33, 0x88, 0x25, 0x1B, 0x94, 0xB1,
+    0xE8, 0x11, 0xC6, 0x08, 0x0B, 0xD3, 0x9D, 0xE7, 0xFA, 0xF0, 0x5A, 0xDF, 0x83, 0x35, 0x7B, 0x2C,
+    0x9B, 0xDB, 0x26, 0xF2, 0xB2, 0x57, 0xED, 0x51, 0xF2, 0xA4, 0x06, 0x03, 0x2C, 0xCB, 0xD3, 0x79,
+    0x23, 0x19, 0x00, 0x9A, 0xFA, 0xBC, 0xBF, 0x37, 0xC3, 0xCF, 0xFD, 0xDF, 0x15, 0x14, 0xF6, 0x50,
+    0x7A, 0x3F, 0xC7, 0x7F, 0x95, 0xC8, 0x71, 0x7D, 0x51, 0x89, 0x8A, 0x50, 0x29, 0x71, 0x4A, 0x05,
+    0x7B, 0x62, 0x42, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xB8, 0xA0, 0xB4, 0x00, 0x52, 0xE2, 0x80, 0x29,
+    0x71, 0x41, 0x68, 0x31, 0x4A, 0x05, 0x2E, 0x29, 0x40, 0xA0, 0xB4, 0x20, 0x14, 0xE0, 0x28, 0x02,
+    0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x50, 0x05, 0x3B, 0x14, 0x16, 0x84, 0xC5, 0x28, 0x14, 0xB8,
+    0xA5, 0x02, 0x82, 0xD0, 0x80, 0x53, 0x80, 0xAB, 0x76, 0xBA, 0x55, 0xE4, 0xB8, 0xF2, 0x2D, 0x65,
+    0x60, 0x7E, 0xE3, 0xE3, 0x83, 0x8F, 0xF6, 0xCF, 0x1F, 0xAD, 0x6B, 0x5B, 0xF8, 0x2E, 0xEC, 0xE3,
+    0xCE, 0x9A, 0x18, 0xC7, 0x57, 0xC6, 0x49, 0x43, 0x8F, 0xEE, 0xF1, 0xDF, 0xFD, 0xAA, 0xE6, 0xAB,
+    0x88, 0x82, 0xFE, 0x2D, 0x68, 0x2F, 0x23, 0xCF, 0xC5, 0x66, 0x54, 0x23, 0xFE, 0xF5, 0x8D, 0xA2,
+    0xBB, 0xAB, 0xDD, 0xFD, 0xCB, 0x53, 0x9F, 0x02, 0x97, 0x15, 0xD4, 0xFF, 0x00, 0xC2, 0x11, 0xFF,
+    0x00, 0x51, 0x0F, 0xFC, 0x73, 0xFF, 0x00, 0xB2, 0xA5, 0xFF, 0x00, 0x84, 0x23, 0xFE, 0x9F, 0xFF,
+    0x00, 0xF1, 0xCF, 0xFE, 0xCA, 0xB9, 0xFE, 0xBF, 0x47, 0xFE, 0x7F, 0x7E, 0x0F, 0xFC, 0x8E, 0x05,
+    0xC4, 0x38, 0x3F, 0xFA, 0x0E, 0xFF, 0x00, 0xC9, 0x65, 0xFF, 0x00, 0xC8, 0x9C, 0xB6, 0x29, 0x40,
+    0xAE, 0x9D, 0xBC, 0x14, 0xD8, 0xF9, 0x2F, 0x81, 0x3F, 0xC2, 0x0A, 0x75, 0x3E, 0xE7, 0x27, 0xF9,
+    0x55, 0x1B, 0x9F, 0x0B, 0x5F, 0xA0, 0xF9, 0x52, 0x39, 0x47, 0x25, 0xBC, 0xB3, 0xF7, 0x40, 0xF6,
+    0x38, 0xEB, 0xED, 0x9A, 0xB8, 0x63, 0x29, 0x3F, 0x86, 0xBC, 0x7F, 0x2F, 0xCC, 0xEA, 0xC3, 0x67,
+    0x78, 0x49, 0x7F, 0x0B, 0x30, 0xA5, 0xD9, 0x5E, 0xF1, 0xFF, 0x00, 0xD2, 0x92, 0x32, 0x00, 0xA5,
+    0x02, 0xA4, 0x96, 0xDE, 0x54, 0x38, 0x9A, 0x29, 0x23, 0x3F, 0x78, 0x2B, 0x02, 0x32, 0x3E, 0x86,
+    0x9B, 0x8A, 0xEC, 0x4F, 0xB3, 0x5E, 0x47, 0xBD, 0x09, 0x27, 0xF0, 0x49, 0x3E, 0xA9, 0xF7, 0x10,
+    0x0A, 0x5C, 0x52, 0x81, 0x4B, 0x8A, 0x66, 0xA8, 0x4C, 0x53, 0x80, 0xA3, 0x14, 0xA0, 0x50, 0x5A,
+    0x00, 0x29, 0x40, 0xA0, 0x0A, 0x76, 0x28, 0x2D, 0x08, 0x05, 0x2E, 0x29, 0x40, 0xA5, 0xC5, 0x05,
+    0xA0, 0xC5, 0x28, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x40, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82,
+    0x90, 0x80, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x3C, 0xEC, 0x0A, 0x50, 0x28, 0x02, 0x9C,
+    0x05, 0x33, 0xF2, 0x94, 0x26, 0x29, 0x71, 0x4B, 0x8A, 0x5C, 0x50, 0x5A, 0x10, 0x0A, 0x76, 0x28,
+    0x02, 0x94, 0x0A, 0x0B, 0x40, 0x05, 0x28, 0x14, 0xA0, 0x52, 0x81, 0x41, 0x68, 0x4C, 0x52, 0xE2,
+    0x97, 0x14, 0xB8, 0xA0, 0xB4, 0x00, 0x52, 0xE2, 0x80, 0x2B, 0xD4, 0xFC, 0x09, 0xF0, 0xA9, 0xF2,
+    0xB2, 0x78, 0x86, 0x34, 0xD9, 0x81, 0x2D, 0xBE, 0x9A, 0x7A, 0xB3, 0x93, 0xFF, 0x00, 0x2F, 0xAA,
+    0x47, 0x40, 0x30, 0x71, 0xCE, 0x7A, 0x36, 0x30, 0x41, 0xF3, 0x73, 0x3C, 0x7D, 0x3A, 0x6A, 0xF8,
+    0xBA, 0x9F, 0xF5, 0xEE, 0x3D, 0x66, 0xFB, 0x2F, 0xEA, 0xCB, 0xA9, 0xBD, 0x18, 0x37, 0xF0, 0x2F,
+    0x5F, 0x23, 0x97, 0xF0, 0x87, 0xC3, 0xBD, 0x47, 0x51, 0xC3, 0x7F, 0xC7, 0xB5, 0xAF, 0x23, 0xED,
+    0xAC, 0x33, 0xBD, 0x93, 0xB4, 0x31, 0x64, 0x13, 0xF3, 0x77, 0xE0, 0x75, 0xE7, 0x23, 0x15, 0xEC,
+    0x9E, 0x1A, 0xF0, 0x86, 0x99, 0xA7, 0x2E, 0x2C, 0x20, 0xCB, 0xF2, 0x24, 0xBC, 0x93, 0x05, 0xE4,
+    0x56, 0x23, 0x86, 0x90, 0x01, 0xC0, 0xC0, 0xE0, 0x00, 0x3B, 0xF5, 0xE6, 0xB6, 0x22, 0x89, 0x10,
+    0x01, 0x0C, 0x68, 0x88, 0x00, 0x8E, 0x28, 0xD4, 0x60, 0x46, 0x8A, 0x38, 0x08, 0xA3, 0xB0, 0x14,
+    0xFA, 0xFC, 0x87, 0x39, 0xCE, 0x6B, 0x54, 0xD2, 0x52, 0xE5, 0x8F, 0xD9, 0x82, 0xFD, 0x5F, 0x5F,
+    0xCB, 0xB2, 0x3D, 0x8A, 0x34, 0x52, 0xFD, 0x58, 0x51, 0x45, 0x15, 0xF3, 0xC7, 0x40, 0x51, 0x45,
+    0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x01, 0xC3, 0xF8,
+    0x9B, 0xE1, 0x6D, 0x8D, 0xC9, 0x2D, 0xA6, 0x32, 0xD9, 0x4B, 0x8C, 0x79, 0x2A, 0xA3, 0xCB, 0x90,
+    0xAA, 0x9E, 0xB1, 0x8E, 0x9B, 0x8E, 0x39, 0x19, 0x1F, 0xEC, 0x93, 0x5E, 0x53, 0xAA, 0xE8, 0xF7,
+    0x96, 0x8F, 0xB7, 0x51, 0xB7, 0x68, 0x64, 0xC0, 0x7D, 0xA7, 0x1F, 0x32, 0x37, 0x74, 0x60, 0x48,
+    0x3F, 0x81, 0xF6, 0xAF, 0xA3, 0xAB, 0x3B, 0x5B, 0xD0, 0x2C, 0x6F, 0x50, 0xAD, 0xFD, 0xBA, 0xBF,
+    0x05, 0x62, 0x9B, 0x03, 0x75, 0xB9, 0x6C, 0x73, 0x03, 0xF6, 0xE4, 0x0F, 0x63, 0xDF, 0x22, 0xBE,
+    0xCB, 0x23, 0xE2, 0x1A, 0x90, 0xB2, 0xC7, 0xB9, 0x4E, 0x3F, 0x0A, 0xFE, 0x68, 0x7A, 0x3E, 0xBE,
+    0x8F, 0xE4, 0xD1, 0x94, 0xE1, 0xFC, 0xA7, 0xCF, 0x18, 0xA5, 0xC5, 0x6F, 0xF8, 0xA7, 0xC1, 0x97,
+    0xDA, 0x71, 0x1F, 0x68, 0x2B, 0x2C, 0x24, 0x95, 0x82, 0xE9, 0x33, 0x82, 0x41, 0x3C, 0x4A, 0x0F,
+    0x42, 0x57, 0x9C, 0x72, 0x3D, 0x09, 0xC1, 0xAC, 0x2C, 0x57, 0xEA, 0xF8, 0x6A, 0xF0, 0x92, 0x4F,
+    0x0B, 0x56, 0x32, 0x4F, 0xE1, 0x68, 0xC3, 0xD4, 0x40, 0x29, 0x71, 0x4A, 0x05, 0x28, 0x15, 0xB9,
+    0x48, 0x40, 0x29, 0xC0, 0x50, 0x05, 0x28, 0x14, 0x16, 0x83, 0x14, 0xB8, 0xA3, 0x14, 0xEC, 0x50,
+    0x5A, 0x10, 0x0A, 0x5C, 0x52, 0x81, 0x5D, 0x66, 0x85, 0xE1, 0x45, 0xC0, 0x6D, 0x41, 0x4E, 0x7E,
+    0xFC, 0x76, 0xC7, 0xB0, 0xFF, 0x00, 0xA6, 0xE3, 0xDF, 0xD3, 0xF3, 0xF4, 0xAE, 0x7C, 0x4D, 0x78,
+    0xC5, 0x5E, 0xAB, 0xF2, 0x8A, 0xEE, 0x70, 0x66, 0x58, 0xFA, 0x74, 0xD5, 0xF1, 0x53, 0xF2, 0xA7,
+    0x1E, 0xB2, 0x7E, 0x5F, 0xD5, 0x8C, 0x7D, 0x2B, 0xC3, 0xB7, 0x57, 0x1C, 0xA8, 0x11, 0xC7, 0xD0,
+    0xCC, 0xDD, 0xF0, 0x7F, 0x81, 0x7B, 0xE3, 0xF2, 0xF7, 0xAE, 0xAF, 0x4F, 0xF0, 0xCD, 0x94, 0x43,
+    0xE7, 0x88, 0x4E, 0xDD, 0x19, 0xE4, 0x19, 0xF4, 0xFB, 0xA9, 0xF5, 0xFA, 0x9F, 0x7A, 0xD6, 0xA2,
+    0xBE, 0x5B, 0x13, 0x8D, 0x9B, 0xDA, 0x5C, 0xAB, 0xA2, 0x5F, 0xE6, 0x7E, 0x5B, 0x9A, 0x67, 0x95,
+    0xE7, 0xF0, 0xD4, 0x70, 0x8F, 0x48, 0xAF, 0xD5, 0xEE, 0xFF, 0x00, 0x05, 0xE4, 0x14, 0x55, 0x5B,
+    0xCD, 0x4E, 0xD6, 0x1F, 0xF8, 0xF9, 0xB8, 0x54, 0x3D, 0x97, 0xA9, 0x20, 0xFF, 0x00, 0xB2, 0x3E,
+    0x9E, 0x95, 0x8B, 0x37, 0x8D, 0x22, 0x07, 0xF7, 0x36, 0x72, 0x30, 0xEE, 0x58, 0x81, 0xCF, 0xB0,
+    0x00, 0xFF, 0x00, 0x3A, 0xC2, 0x8E, 0x1A, 0xA3, 0xFE, 0x15, 0x29, 0x3F, 0x3F, 0xF8, 0x73, 0xCF,
+    0xC1, 0x65, 0x98, 0x89, 0xFF, 0x00, 0xBA, 0x60, 0xEA, 0x35, 0xD1, 0xEC, 0x9F, 0xCD, 0xD9, 0x1D,
+    0x25, 0x15, 0xC7, 0x7F, 0xC2, 0x63, 0x7B, 0xFF, 0x00, 0x3C, 0x6D, 0x7F, 0x23, 0xFF, 0x00, 0xC5,
+    0x50, 0xBE, 0x2E, 0xBD, 0xEE, 0x96, 0xE7, 0xB8, 0x04, 0x1F, 0x94, 0x63, 0xB7, 0x35, 0xD7, 0xFD,
+    0x9D, 0x57, 0xB4, 0x3E, 0xF3, 0xD9, 0x5C, 0x33, 0x8A, 0xFE, 0x4A, 0x1F, 0x79, 0xD8, 0xD1, 0x5C,
+    0x9C, 0x3E, 0x30, 0xB8, 0x07, 0xF7, 0xD6, 0xD0, 0xB0, 0xEC, 0x17, 0x23, 0x9F, 0xA9, 0xCF, 0xF2,
+    0xAD, 0x1B, 0x5F, 0x15, 0xDA, 0x37, 0xFA, 0xF5, 0x78, 0x4F, 0x53, 0x9E, 0x46, 0x73, 0xD8, 0x8F,
+    0x51, 0xED, 0x59, 0x54, 0xC1, 0x55, 0x5B, 0xD2, 0x6F, 0xD3, 0x5F, 0xF8, 0x27, 0x26, 0x27, 0x21,
+    0xC5, 0xC7, 0x7C, 0x1C, 0xA5, 0xE7, 0x16, 0x9F, 0xE0, 0xB5, 0xFC, 0x0D, 0x79, 0xA0, 0x89, 0xC6,
+    0x26, 0x8A, 0x37, 0x1F, 0x78, 0x2B, 0x0C, 0xE0, 0xFD, 0x0D, 0x61, 0x5F, 0xF8, 0x4A, 0x36, 0xE6,
+    0xCA, 0x4F, 0x2C, 0xFF, 0x00, 0xCF, 0x26, 0xE8, 0x7A, 0x74, 0x6E, 0xBF, 0xCE, 0xB7, 0xA3, 0x95,
+    0x18, 0x66, 0x27, 0x57, 0x5F, 0xE1, 0x65, 0x3C, 0x1C, 0x7A, 0x11, 0x4F, 0xAC, 0x28, 0xD7, 0x9C,
+    0x7F, 0x85, 0x39, 0x2E, 0xEB, 0xFE, 0x01, 0xC1, 0x80, 0xC7, 0xD7, 0xA6, 0xFF, 0x00, 0xD9, 0x31,
+    0x15, 0x23, 0xD2, 0x71, 0xE8, 0xFD, 0x53, 0xD3, 0xF5, 0x3C, 0xF2, 0xE6, 0xCE, 0x68, 0x8E, 0x2E,
+    0x23, 0x28, 0xDF, 0x7B, 0x07, 0xB8, 0x3E, 0x84, 0x54, 0x78, 0xAF, 0x40, 0xBC, 0xB3, 0x8A, 0x65,
+    0x22, 0x75, 0xC8, 0xEA, 0x0F, 0x74, 0x6F, 0x55, 0x3E, 0xD5, 0xC8, 0xEA, 0xFA, 0x3B, 0xDB, 0x9E,
+    0x32, 0xD1, 0x9F, 0xF5, 0x52, 0x7A, 0x7B, 0x3F, 0xB8, 0xFD, 0x6B, 0xE9, 0x70, 0x38, 0xD5, 0x2D,
+    0x2A, 0x24, 0x9F, 0x6E, 0xFE, 0x9F, 0xE4, 0x7E, 0xB1, 0xC3, 0xD9, 0xFC, 0x2A, 0x7B, 0xB8, 0x88,
+    0xC6, 0x13, 0xE8, 0xBA, 0x4F, 0xD3, 0xFC, 0xBF, 0x16, 0x67, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0,
+    0x57, 0xA6, 0x7D, 0x8A, 0x13, 0x14, 0xB8, 0xA5, 0xC5, 0x2E, 0x28, 0x2D, 0x00, 0x14, 0xB8, 0xA0,
+    0x0A, 0x50, 0x28, 0x2D, 0x00, 0x14, 0xA0, 0x52, 0x81, 0x4A, 0x05, 0x05, 0xA1, 0x31, 0x4E, 0xC5,
+    0x18, 0xA5, 0xC5, 0x05, 0x20, 0x02, 0x97, 0x14, 0x01, 0x4E, 0x02, 0x82, 0xD1, 0xE7, 0x58, 0xA5,
+    0x02, 0x97, 0x14, 0xA0, 0x55, 0x1F, 0x94, 0xA1, 0x31, 0x4E, 0xC5, 0x18, 0xA5, 0x02, 0x82, 0xD0,
+    0x01, 0x4A, 0x05, 0x28, 0x14, 0xB8, 0xA0, 0xB4, 0x26, 0x29, 0x40, 0xA5, 0xC5, 0x28, 0x14, 0x16,
+    0x83, 0x14, 0xB8, 0xA3, 0x15, 0xDB, 0x7C, 0x33, 0xF0, 0x5F, 0xDB, 0xA4, 0xDF, 0x77, 0xC5, 0xB4,
+    0x64, 0x34, 0x88, 0x57, 0x22, 0xF2, 0x6E, 0xBB, 0x79, 0x18, 0xC0, 0xFE, 0x2E, 0xA7, 0x18, 0x18,
+    0xE7, 0x23, 0x8F, 0x1F, 0x89, 0x84, 0x22, 0xE5, 0x89, 0x95, 0x92, 0xD5, 0xF9, 0xBE, 0x8B, 0xE6,
+    0x6D, 0x4A, 0x2D, 0xBB, 0x44, 0xE8, 0x7E, 0x15, 0x78, 0x11, 0x30, 0x27, 0xD5, 0x20, 0x7D, 0xF9,
+    0xDD, 0xA4, 0xC0, 0xE3, 0x85, 0x40, 0x06, 0x24, 0x23, 0xD4, 0x9E, 0x99, 0x03, 0x1F, 0x78, 0x67,
+    0x20, 0x8F, 0x52, 0xA2, 0x8A, 0xFC, 0x2F, 0x35, 0xC7, 0x4E, 0xA4, 0x9C, 0xB1, 0x0F, 0xCA, 0x9C,
+    0x7A, 0x41, 0x76, 0x5F, 0xD6, 0xAF, 0x53, 0xE8, 0x68, 0xD3, 0x49, 0x5A, 0x3F, 0x3F, 0x30, 0xA2,
+    0x8A, 0x2B, 0xCE, 0x35, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80,
+    0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x20, 0xBE, 0xB1, 0x82,
+    0x74, 0x2B, 0x77, 0x0A, 0xCB, 0x1B, 0x0D, 0x92, 0xC6, 0xDF, 0xC4, 0x3D, 0x8F, 0xB1, 0xFC, 0x47,
+    0x6A, 0xF0, 0xEF, 0x17, 0x78, 0x66, 0x4D, 0x3E, 0x52, 0xB8, 0x95, 0xA1, 0x3F, 0x3D, 0x8D, 0xC3,
+    0x0F, 0xF5, 0xB1, 0xE0, 0x70, 0x48, 0xEF, 0x19, 0x38, 0x3D, 0x3D, 0x70, 0x01, 0x15, 0xEF, 0x15,
+    0x99, 0xE2, 0x2D, 0x0A, 0x1B, 0xE8, 0x99, 0x27, 0x6D, 0xB9, 0xF9, 0xE1, 0x98, 0x00, 0x4C, 0x12,
+    0xA9, 0xE0, 0xA8, 0x3F, 0x91, 0xE9, 0x91, 0x91, 0x91, 0x5F, 0x47, 0xC3, 0x79, 0xAB, 0xA7, 0x2F,
+    0xDE, 0x36, 0xE0, 0xF4, 0xAC, 0xBF, 0x97, 0xFB, 0xCB, 0xCD, 0x7E, 0x2B, 0xE5, 0x6C, 0xE7, 0x1F,
+    0xF8, 0x07, 0xCF, 0xE0, 0x53, 0x80, 0xAB, 0x3A, 0x96, 0x9D, 0x35, 0xB4, 0x8C, 0x97, 0x2B, 0x87,
+    0x52, 0x63, 0x7E, 0xBF, 0x36, 0x3B, 0xA6, 0x40, 0xE1, 0xC7, 0x23, 0x8E, 0x45, 0x57, 0xC5, 0x7E,
+    0xD5, 0x09, 0x26, 0xAF, 0x09, 0x26, 0x9F, 0xBD, 0x17, 0xDD, 0x1C, 0xE8, 0x31, 0x4A, 0x05, 0x18,
+    0xA7, 0x01, 0x56, 0x5A, 0x13, 0x14, 0xB8, 0xA5, 0xC5, 0x74, 0x5E, 0x14, 0xD1, 0x7C, 0xC3, 0xBE,
+    0x75, 0x70, 0x80, 0xE6, 0xD8, 0x7F, 0xCF, 0x59, 0x14, 0xF5, 0xCF, 0xFB, 0x07, 0xFC, 0xF5, 0xAC,
+    0x31, 0x15, 0x54, 0x55, 0xEA, 0x7C, 0xBC, 0xD9, 0xC9, 0x98, 0x62, 0xE1, 0x08, 0xB9, 0x62, 0x1E,
+    0xDF, 0x0A, 0xFE, 0x67, 0xD1, 0x2F, 0xEB, 0xCC, 0xD1, 0xF0, 0xBE, 0x84, 0xD1, 0x0D, 0xD7, 0x51,
+    0x81, 0x21, 0xFF, 0x00, 0x52, 0x87, 0xAC, 0x08, 0x7D, 0x7D, 0xDF, 0xF3, 0x1F, 0x98, 0xAE, 0x86,
+    0x8A, 0xAF, 0x7D, 0x7D, 0x0C, 0x0A, 0x5A, 0x76, 0xC0, 0xE8, 0x07, 0x77, 0x6F, 0x44, 0x1E, 0xF5,
+    0xF1, 0x95, 0xAA, 0x4A, 0x4E, 0xF2, 0x4D, 0xB7, 0xA4, 0x57, 0xE8, 0x7E, 0x35, 0x8C, 0xC4, 0x54,
+    0xA9, 0x2B, 0xD4, 0x4D, 0xB7, 0xEE, 0x42, 0x2B, 0xA7, 0x64, 0xBF, 0xAF, 0x31, 0x6E, 0xEF, 0x21,
+    0x84, 0x66, 0xE6, 0x40, 0x8B, 0xF7, 0x72, 0x7B, 0x93, 0xE8, 0x05, 0x72, 0x7A, 0xA7, 0x8A, 0xA7,
+    0x97, 0x8B, 0x50, 0x61, 0x4F, 0xEF, 0x83, 0xF3, 0x30, 0x07, 0xFB, 0xC3, 0xA6, 0x78, 0xFF, 0x00,
+    0x1A, 0xCF, 0xD5, 0x35, 0x49, 0xAE, 0x5B, 0x32, 0x9C, 0x0E, 0x90, 0xC4, 0x3A, 0x46, 0xBE, 0xDF,
+    0x5A, 0xA8, 0x05, 0x7D, 0x16, 0x0B, 0x03, 0x15, 0xAD, 0x74, 0x9B, 0xDE, 0xDD, 0x22, 0x7E, 0x8F,
+    0x91, 0x64, 0x34, 0xE2, 0x93, 0xCC, 0x21, 0x19, 0x4B, 0xE2, 0xB7, 0x48, 0x7F, 0x9B, 0xF3, 0xFB,
+    0xBB, 0xB4, 0xC5, 0x2E, 0x29, 0x71, 0x4A, 0x05, 0x7A, 0xE7, 0xDA, 0x20, 0x02, 0x94, 0x0A, 0x00,
+    0xA7, 0x62, 0x82, 0xD0, 0x98, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x50, 0x5A, 0x24, 0xB7, 0xB8, 0x96,
+    0x33, 0x98, 0x24, 0x64, 0x6F, 0x51, 0xDC, 0x67, 0xF8, 0x85, 0x74, 0xDA, 0x6F, 0x89, 0xE3, 0x7E,
+    0x2F, 0x02, 0xC4, 0xDF, 0xC3, 0x20, 0xE8, 0xC4, 0x9E, 0xE3, 0xB6, 0x3E, 0xB8, 0xFA, 0x57, 0x2D,
+    0x8A, 0x50, 0x2B, 0x93, 0x13, 0x86, 0x84, 0xBF, 0x89, 0x1F, 0x47, 0xD5, 0x1E, 0x4E, 0x6B, 0x95,
+    0xD1, 0xA8, 0xBF, 0xDA, 0xA9, 0x6B, 0xB4, 0x26, 0xB4, 0x6B, 0xFC, 0xFD, 0x1D, 0xCF, 0x45, 0xA4,
+    0x65, 0x04, 0x7C, 0xC0, 0x11, 0xD1, 0x94, 0xF7, 0x07, 0xD4, 0x7B, 0xD7, 0x35, 0xA1, 0x6B, 0x9B,
+    0x30, 0xB7, 0x6D, 0xF2, 0x7D, 0xD8, 0x65, 0x3F, 0xF2, 0xCF, 0xD9, 0xCF, 0xA7, 0xF2, 0xFA, 0x74,
+    0xE9, 0xAB, 0xE4, 0xF1, 0x54, 0x25, 0x17, 0x69, 0xFA, 0xC1, 0xF7, 0x3F, 0x19, 0xCD, 0xF2, 0xFA,
+    0x94, 0xA5, 0x6C, 0x42, 0xFE, 0xF5, 0x19, 0xF4, 0x9A, 0xEE, 0xBC, 0xFB, 0xAE, 0x9F, 0x73, 0x38,
+    0xDD, 0x63, 0x49, 0x78, 0x1B, 0xE5, 0x19, 0x88, 0x9C, 0xC2, 0xC3, 0xF8, 0x73, 0xD9, 0xBE, 0x9F,
+    0xAD, 0x67, 0x81, 0x5D, 0xED, 0xD5, 0xB2, 0x4A, 0xA4, 0x4A, 0x0E, 0xD3, 0xC1, 0xC7, 0x6C, 0x1E,
+    0xC7, 0xD8, 0xD7, 0x17, 0x79, 0x66, 0xF1, 0x31, 0x12, 0x03, 0xFE, 0xC3, 0x7F, 0x7D, 0x3D, 0x47,
+    0xD6, 0xBE, 0x8B, 0x2C, 0xC5, 0x73, 0x2B, 0x54, 0x7A, 0xAF, 0xFC, 0x99, 0x7F, 0x5B, 0x9F, 0xAA,
+    0x70, 0x96, 0x71, 0xED, 0x17, 0x2E, 0x2E, 0x4B, 0x9E, 0x3B, 0xFF, 0x00, 0xD3, 0xC8, 0xF7, 0xF5,
+    0xEF, 0xF7, 0xF5, 0xD2, 0x0C, 0x52, 0xE2, 0x8C, 0x52, 0x81, 0x5E, 0xA9, 0xF6, 0x88, 0x00, 0xA5,
+    0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x13, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x0A, 0x41, 0x8A,
+    0x5C, 0x51, 0x8A, 0x70, 0x14, 0x16, 0x84, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0xF3,
+    0xAC, 0x53, 0x80, 0xA3, 0x14, 0xA0, 0x53, 0x3F, 0x29, 0x40, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2,
+    0x82, 0xD0, 0x80, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x0C, 0x52, 0x81, 0x46, 0x29, 0x40,
+    0xA0, 0xB4, 0x5A, 0xD2, 0xB4, 0xC9, 0xEE, 0xA4, 0x44, 0xB5, 0x5C, 0xC8, 0xC4, 0x45, 0x1F, 0x5C,
+    0x2E, 0x7B, 0xBE, 0x01, 0xE1, 0x07, 0x27, 0x8E, 0x05, 0x7D, 0x1B, 0xA0, 0x68, 0xF1, 0x59, 0x42,
+    0x91, 0xC0, 0x72, 0xAA, 0x36, 0x33, 0xF3, 0xFB, 0xD9, 0x09, 0xC9, 0x38, 0x24, 0xFF, 0x00, 0xAC,
+    0x72, 0x4E, 0x33, 0xC7, 0x6A, 0xF3, 0x7F, 0x82, 0xFA, 0x12, 0xB3, 0x49, 0x2C, 0xD1, 0x67, 0x6F,
+    0xFA, 0x1D, 0x93, 0x9C, 0x60, 0x48, 0xC3, 0x2D, 0x81, 0xD7, 0x2A, 0xBB, 0x46, 0x78, 0xE0, 0x91,
+    0xCF, 0x6F, 0x58, 0xAF, 0xC9, 0xF8, 0xDF, 0x1C, 0xDC, 0xB9, 0x29, 0xCB, 0x48, 0xFB, 0xD3, 0xF3,
+    0x9B, 0x5F, 0xA2, 0x76, 0xF5, 0xB9, 0xEE, 0xE5, 0xD4, 0xF4, 0xBB, 0x5B, 0xE8, 0xBD, 0x02, 0x8A,
+    0x28, 0xAF, 0x87, 0x3D, 0x10, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+    0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+    0x00, 0xA2, 0x8A, 0x28, 0x03, 0x85, 0xF8, 0xA1, 0xE1, 0xA6, 0x99, 0x04, 0xB6, 0xE3, 0x2E, 0x83,
+    0x65, 0xD2, 0x00, 0x49, 0x96, 0xDB, 0x77, 0x55, 0xC7, 0xFC, 0xF1, 0x24, 0x93, 0xC7, 0x4C, 0x92,
+    0x78, 0xAF, 0x2B, 0xC5, 0x7D, 0x17, 0x2C, 0x48, 0xE0, 0x89, 0x51, 0x5D, 0x48, 0xD9, 0x22, 0x30,
+    0xC8, 0x75, 0x61, 0xD1, 0x94, 0xFA, 0x8A, 0xF0, 0x5D, 0x7B, 0x4B, 0x36, 0xB3, 0x3A, 0x10, 0xC0,
+    0x2B, 0x15, 0x8B, 0x71, 0x04, 0xB4, 0x27, 0x90, 0x58, 0x8F, 0xEF, 0x21, 0x06, 0xBF, 0x53, 0xE0,
+    0x7C, 0x73, 0x71, 0x70, 0xAD, 0x2D, 0x63, 0xEF, 0xD1, 0xFF, 0x00, 0x0B, 0xE9, 0xF2, 0x7F, 0x9D,
+    0x8E, 0x7A, 0xAB, 0xB7, 0xCC, 0xCF, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0xBE, 0xF0, 0x84, 0x4B,
+    0x69, 0x6A, 0xF2, 0xB0, 0x58, 0x86, 0x58, 0x9D, 0xAB, 0xED, 0x9E, 0xED, 0x8F, 0xEE, 0x8A, 0xF4,
+    0x8B, 0x5B, 0x64, 0x89, 0x42, 0xC4, 0x30, 0xA0, 0x6C, 0x5F, 0x7C, 0x77, 0x6C, 0x7F, 0x78, 0xD7,
+    0x2F, 0xE0, 0xDB, 0x02, 0x4B, 0x3B, 0x01, 0x81, 0xFB, 0x98, 0xB2, 0x3F, 0x8C, 0xE3, 0x38, 0x3F,
+    0xEC, 0x8F, 0x6E, 0xF5, 0xD6, 0xD7, 0xCB, 0xE7, 0x35, 0xAE, 0xED, 0x17, 0xB6, 0xAF, 0xD4, 0xFC,
+    0xCB, 0x8C, 0x71, 0x97, 0x92, 0x84, 0x25, 0xA4, 0x75, 0x9F, 0x9C, 0x9F, 0xF9, 0x2F, 0xD4, 0x6B,
+    0xBA, 0x81, 0x97, 0x60, 0xA0, 0x7C, 0xCC, 0xC7, 0xF8, 0x40, 0xF5, 0x3E, 0xD5, 0xC0, 0xEB, 0x3A,
+    0xA3, 0x5C, 0x3E, 0x72, 0xC1, 0x07, 0xCB, 0x6F, 0x19, 0xFE, 0x05, 0xFA, 0x0F, 0xEF, 0x1A, 0xE8,
+    0x3C, 0x5B, 0xA8, 0x32, 0x28, 0x58, 0x9F, 0x05, 0xB2, 0x66, 0xC1, 0xE7, 0xCA, 0x1D, 0x88, 0xFF,
+    0x00, 0x6C, 0xFF, 0x00, 0x2A, 0xE4, 0xB1, 0x5D, 0x79, 0x35, 0x0D, 0x39, 0xA6, 0x96, 0xBA, 0x43,
+    0xC9, 0x1E, 0xCF, 0x06, 0x60, 0x12, 0x5E, 0xD2, 0xB4, 0x55, 0xDF, 0xB9, 0x43, 0xFB, 0xAB, 0xAB,
+    0xF9, 0xFE, 0x5E, 0xA2, 0x62, 0x94, 0x0A, 0x5C, 0x52, 0x81, 0x5E, 0xE9, 0xF7, 0x88, 0x00, 0xA5,
+    0x02, 0x80, 0x29, 0xD8, 0xA0, 0xB4, 0x20, 0x14, 0xB8, 0xA5, 0x02, 0x97, 0x14, 0x16, 0x84, 0xC5,
+    0x38, 0x0A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02, 0x94, 0x0A, 0x00, 0xA7, 0x62, 0x82, 0xD0, 0x80,
+    0x57, 0x4B, 0xE1, 0xBD, 0x48, 0xB0, 0xD9, 0x2B, 0x12, 0x47, 0xCD, 0x03, 0x13, 0xD5, 0x07, 0x61,
+    0xFE, 0xEF, 0xF9, 0xE9, 0x5C, 0xE0, 0x15, 0x24, 0x32, 0xBA, 0x10, 0x62, 0x72, 0xAC, 0x39, 0x56,
+    0x1D, 0xBF, 0xFD, 0x75, 0xCB, 0x8B, 0xA2, 0xA4, 0xAC, 0xED, 0xDE, 0x0F, 0xB3, 0x3C, 0xBC, 0xEB,
+    0x03, 0x1A, 0x90, 0x71, 0x9A, 0x8D, 0xFE, 0x2A, 0x32, 0xFE, 0x59, 0x74, 0xFF, 0x00, 0x27, 0xE4,
+    0x77, 0x95, 0x91, 0xE2, 0x2B, 0x1D, 0xEB, 0xB9, 0x17, 0xE6, 0x5F, 0xBF, 0x8F, 0xE2, 0x8C, 0xFF,
+    0x00, 0xF1, 0x27, 0xFA, 0xD6, 0x95, 0xAC, 0xE2, 0x45, 0x05, 0x71, 0xC8, 0xDD, 0x80, 0x7E, 0xE9,
+    0x3D, 0xB3, 0xFE, 0xC9, 0xA9, 0x19, 0x41, 0xFB, 0xC0, 0x11, 0xD1, 0x81, 0xEE, 0x0F, 0xA8, 0xF7,
+    0xAF, 0x90, 0xA3, 0x37, 0x17, 0x7B, 0x6C, 0xED, 0x25, 0xF9, 0x9F, 0x89, 0xE0, 0x31, 0x13, 0xA7,
+    0x35, 0x24, 0x9D, 0xE2, 0xF9, 0x6A, 0x2E, 0xFD, 0x1A, 0xFC, 0xD1, 0xC1, 0x81, 0x4A, 0x05, 0x4D,
+    0x75, 0x6C, 0xD1, 0xB1, 0x0C, 0x79, 0x1C, 0x03, 0xFD, 0xE1, 0xFF, 0x00, 0xD7, 0x15, 0x1E, 0x2B,
+    0xED, 0xE2, 0xD7, 0xD9, 0x7E, 0x68, 0xFE, 0x85, 0xA3, 0x51, 0x34, 0x9D, 0x29, 0x26, 0x9A, 0x53,
+    0x83, 0xEE, 0x9E, 0xC2, 0x01, 0x4B, 0x8A, 0x50, 0x29, 0x71, 0x4C, 0xD9, 0x06, 0x29, 0x40, 0xA3,
+    0x14, 0xE0, 0x28, 0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x80, 0x53, 0xB1,
+    0x40, 0x14, 0xB8, 0xA0, 0xB4, 0x79, 0xD8, 0x14, 0xA0, 0x52, 0x81, 0x4A, 0x05, 0x51, 0xF9, 0x4A,
+    0x13, 0x14, 0xB8, 0xA5, 0xC5, 0x2E, 0x28, 0x2D, 0x00, 0x14, 0xB8, 0xA0, 0x0A, 0x50, 0x29, 0x16,
+    0x80, 0x0A, 0x50, 0x29, 0x40, 0xAD, 0x8F, 0x08, 0xE9, 0xE6, 0x7B, 0xA8, 0x54, 0x42, 0x92, 0x82,
+    0xEA, 0xF3, 0x44, 0xD8, 0xC3, 0xC1, 0x19, 0xCB, 0x6F, 0x0D, 0xFE, 0xC0, 0x3F, 0x5A, 0xCA, 0xBD,
+    0x44, 0x93, 0x73, 0xD9, 0x27, 0x52, 0x5E, 0x8B, 0x53, 0x58, 0x2E, 0xDE, 0x88, 0xF7, 0x5F, 0x08,
+    0xE9, 0x06, 0xCE, 0xDA, 0x24, 0x70, 0xE1, 0xC2, 0xEE, 0xB8, 0x56, 0x20, 0xEC, 0x9E, 0x42, 0x4B,
+    0x00, 0xCB, 0xFD, 0xD7, 0x24, 0x0F, 0xEB, 0x5A, 0xF4, 0x51, 0x5F, 0xCF, 0x55, 0xEA, 0x36, 0xDB,
+    0xA8, 0xF5, 0x6D, 0xD4, 0x9F, 0xAB, 0xD4, 0xFA, 0xC8, 0xAE, 0xDE, 0x88, 0x28, 0xA2, 0x8A, 0xC8,
+    0xA0, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+    0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+    0x00, 0xAF, 0x37, 0xF8, 0xB3, 0xA6, 0x1C, 0xC7, 0x22, 0x86, 0x23, 0x06, 0xCA, 0x63, 0x91, 0x85,
+    0x20, 0x92, 0xB8, 0x5E, 0xBF, 0x36, 0x5B, 0xDB, 0x8F, 0xCF, 0xD2, 0x2B, 0x9F, 0xF1, 0xE5, 0x91,
+    0x96, 0xD2, 0x4D, 0x91, 0x2B, 0xB0, 0x02, 0xE1, 0x33, 0x8F, 0xDD, 0x88, 0x98, 0x12, 0x50, 0x9F,
+    0x48, 0xF3, 0xEF, 0xDA, 0xBD, 0xBE, 0x1D, 0xC4, 0x72, 0xD4, 0x83, 0xBA, 0xD5, 0xFB, 0x19, 0xFA,
+    0x4B, 0x4F, 0xC2, 0xF7, 0xF9, 0x11, 0x51, 0x7F, 0x99, 0xE2, 0xC0, 0x52, 0x81, 0x40, 0x14, 0xA0,
+    0x57, 0xEE, 0x67, 0x2A, 0x3B, 0xCF, 0x0E, 0x5A, 0x08, 0xE1, 0x5E, 0x06, 0x4F, 0xEF, 0xDC, 0x8E,
+    0xE5, 0xFA, 0x75, 0xF4, 0x5C, 0x56, 0x9D, 0x32, 0x28, 0x95, 0x00, 0x11, 0x8C, 0x28, 0x01, 0x10,
+    0x7A, 0x2A, 0x8F, 0x53, 0xE8, 0x29, 0xB7, 0x53, 0x79, 0x6A, 0xC7, 0x6E, 0xEC, 0x03, 0x26, 0xDF,
+    0xEF, 0x6D, 0x1E, 0xBE, 0xF5, 0xF0, 0xB5, 0x24, 0xDB, 0x7B, 0xEA, 0xEE, 0x8F, 0xC3, 0x71, 0x35,
+    0x1C, 0xA4, 0xDA, 0xBB, 0x72, 0x6E, 0x51, 0xF9, 0xBD, 0x0E, 0x1B, 0x5B, 0xBB, 0xF3, 0x65, 0x62,
+    0x1B, 0x2B, 0x9F, 0x2E, 0x2E, 0x72, 0x36, 0x27, 0xF7, 0x0F, 0xFB, 0x47, 0x9A, 0xA3, 0x8A, 0x50,
+    0x29, 0x40, 0xAF, 0xB7, 0xA7, 0x14, 0x92, 0x51, 0xE9, 0xEE, 0xA3, 0xF7, 0x1C, 0x35, 0x35, 0x14,
+    0x95, 0x35, 0xA2, 0x4A, 0x9C, 0x7D, 0x10, 0x01, 0x4A, 0x05, 0x00, 0x53, 0x80, 0xAB, 0x3A, 0x50,
+    0x98, 0xA5, 0xC5, 0x2E, 0x29, 0x71, 0x41, 0x68, 0x40, 0x29, 0xD8, 0xA0, 0x0A, 0x50, 0x28, 0x2D,
+    0x00, 0x14, 0xA0, 0x52, 0x81, 0x4A, 0x05, 0x05, 0xA1, 0x31, 0x4B, 0x8A, 0x5C, 0x52, 0xE2, 0x82,
+    0xD0, 0x01, 0x4B, 0x8A, 0x00, 0xA5, 0x02, 0x82, 0xD1, 0xD0, 0xF8, 0x66, 0xE7, 0x2A, 0x55, 0x8F,
+    0x23, 0xE7, 0x4C, 0x9F, 0xE1, 0x6F, 0xEE, 0xAF, 0xB1, 0xFE, 0x75, 0xB7, 0x5C, 0xBF, 0x87, 0xE5,
+    0xDB, 0x27, 0x4C, 0xE4, 0x14, 0xCF, 0xF7, 0x71, 0xCF, 0xF4, 0xAE, 0xA2, 0xBE, 0x47, 0x35, 0x85,
+    0xA4, 0xEC, 0xB7, 0xF7, 0xCF, 0xC5, 0xB8, 0xCA, 0x82, 0x8D, 0x57, 0xCB, 0x1B, 0x73, 0x25, 0x88,
+    0x5F, 0x3D, 0x1F, 0xE2, 0x99, 0xCE, 0x78, 0x8E, 0xDC, 0x07, 0x04, 0x63, 0x91, 0x86, 0xF7, 0x64,
+    0xF5, 0xFC, 0x31, 0x59, 0x58, 0xAE, 0x87, 0xC4, 0x71, 0xAE, 0xC0, 0x48, 0xE7, 0x3B, 0x54, 0xFA,
+    0x06, 0x07, 0xF9, 0xE0, 0x57, 0x3F, 0x8A, 0xF7, 0xB2, 0xC9, 0xDE, 0x2A, 0xF7, 0xD3, 0xDC, 0x3F,
+    0x49, 0xE1, 0x0A, 0xEE, 0x54, 0xA3, 0xCE, 0xDE, 0x97, 0xA2, 0xFD, 0x13, 0xD3, 0xF0, 0xB2, 0x00,
+    0x29, 0x71, 0x40, 0x14, 0xE0, 0x2B, 0xD0, 0x3E, 0xA1, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0x81,
+    0x41, 0x68, 0x4C, 0x53, 0xB1, 0x46, 0x29, 0x71, 0x48, 0xB4, 0x00, 0x52, 0xE2, 0x94, 0x0A, 0x50,
+    0x28, 0x2D, 0x1E, 0x75, 0x8A, 0x50, 0x29, 0x71, 0x4A, 0x05, 0x51, 0xF9, 0x4A, 0x0C, 0x52, 0xE2,
+    0x8C, 0x52, 0x81, 0x41, 0x68, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x13, 0x15, 0xDB,
+    0x7C, 0x23, 0xB2, 0x49, 0x2E, 0xF2, 0xEC, 0xE0, 0xA2, 0x35, 0xC4, 0x40, 0x7F, 0x13, 0xB6, 0x17,
+    0xE7, 0xFF, 0x00, 0x80, 0xB9, 0xF4, 0xAE, 0x2F, 0x15, 0xDE, 0xFC, 0x1B, 0xFF, 0x00, 0x8F, 0xA7,
+    0xFF, 0x00, 0xAE, 0x4D, 0xFF, 0x00, 0xA3, 0x63, 0xAF, 0x1B, 0x88, 0x64, 0xFD, 0x94, 0xF9, 0x5F,
+    0xD9, 0x71, 0xFB, 0xF4, 0x3A, 0xF0, 0x7F, 0x12, 0xBF, 0x73, 0xD9, 0x28, 0xA2, 0x8A, 0xFC, 0x24,
+    0xFA, 0xA0, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A,
+    0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A,
+    0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA8, 0x2F, 0x6D, 0x12, 0x64, 0x65, 0x94, 0xB0, 0x56, 0x53,
+    0x04, 0x85, 0x7A, 0x85, 0x91, 0x48, 0xF9, 0x49, 0xF6, 0x3E, 0x95, 0x3D, 0x15, 0x51, 0x93, 0x5A,
+    0xC5, 0xFF, 0x00, 0x79, 0x01, 0xF3, 0xCE, 0x29, 0x40, 0xA5, 0xC5, 0x28, 0x15, 0xFD, 0x18, 0x70,
+    0x23, 0xD2, 0xEA, 0xA6, 0xAA, 0xC0, 0x44, 0xF9, 0xCF, 0xDD, 0x61, 0xC0, 0xEE, 0x57, 0xD0, 0x55,
+    0xBA, 0xAD, 0xA9, 0xFF, 0x00, 0xAB, 0x7F, 0xF7, 0x5B, 0xFF, 0x00, 0x41, 0x35, 0xF0, 0x94, 0x77,
+    0x5E, 0xA8, 0xFC, 0x37, 0x07, 0xF1, 0x46, 0xFD, 0xD5, 0xFE, 0xF3, 0xCF, 0xC0, 0xA5, 0x02, 0x80,
+    0x29, 0xD8, 0xAF, 0xBB, 0x3F, 0x77, 0x42, 0x62, 0x94, 0x0A, 0x5C, 0x52, 0x81, 0x41, 0x68, 0x4C,
+    0x53, 0xB1, 0x46, 0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x09,
+    0x8A, 0x50, 0x29, 0x71, 0x4A, 0x05, 0x22, 0xD0, 0x62, 0x97, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x40,
+    0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD1, 0x73, 0x45, 0x38, 0x95, 0x73, 0x9E, 0xE3, 0x8F,
+    0x75, 0x3E, 0x95, 0xD6, 0x57, 0x2D, 0xA2, 0x7F, 0xAD, 0x5F, 0xC7, 0xFF, 0x00, 0x40, 0x35, 0xD4,
+    0xD7, 0xCC, 0x67, 0x5F, 0x12, 0xF4, 0xFD, 0x59, 0xF9, 0x2F, 0x1F, 0x7F, 0x12, 0x3F, 0xE0, 0x5F,
+    0xFA, 0x54, 0x8C, 0xBF, 0x11, 0x7D, 0xC1, 0xFE, 0xF0, 0xFF, 0x00, 0xD0, 0x4D, 0x73, 0xD8, 0xAE,
+    0x87, 0xC4, 0x3F, 0x70, 0x7F, 0xBC, 0x3F, 0xF4, 0x13, 0x58, 0x00, 0x57, 0xA9, 0x94, 0x7C, 0x3F,
+    0x36, 0x7D, 0x8F, 0x03, 0xFF, 0x00, 0x09, 0x7F, 0x8A, 0x42, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xB8,
+    0xAF, 0x4C, 0xFB, 0x14, 0x26, 0x29, 0xC0, 0x51, 0x8A, 0x50, 0x28, 0x2D, 0x06, 0x29, 0x71, 0x4B,
+    0x8A, 0x50, 0x28, 0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD1, 0xE7, 0x78, 0xA5,
+    0x02, 0x8C, 0x52, 0x81, 0x54, 0x7E, 0x52, 0x80, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x22, 0xD0,
+    0x80, 0x53, 0xB1, 0x40, 0x14, 0xB8, 0xA0, 0xB4, 0x18, 0xAE, 0xF3, 0xE0, 0xE7, 0xFC, 0x7D, 0x3F,
+    0xFD, 0x72, 0x6F, 0xFD, 0x1B, 0x1D, 0x70, 0x98, 0xAE, 0xDF, 0xE1, 0x15, 0xCC, 0x69, 0x74, 0x44,
+    0x8F, 0x82, 0xD1, 0xB4, 0x30, 0x0C, 0x7D, 0xF9, 0x03, 0x29, 0xC6, 0x47, 0xFB, 0x0A, 0x4D, 0x78,
+    0xDC, 0x44, 0x9F, 0xB2, 0x9F, 0x2A, 0x7F, 0x0B, 0x67, 0x66, 0x09, 0xFB, 0xCA, 0xFD, 0xCF, 0x67,
+    0xA2, 0x8A, 0x2B, 0xF0, 0xA3, 0xEA, 0xC2, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x2A, 0x3B, 0x8B, 0x88,
+    0xE3, 0x52, 0xD3, 0x36, 0xD4, 0x50, 0x65, 0x95, 0xBF, 0xBA, 0x88, 0x39, 0xE0, 0x7A, 0x0A, 0x71,
+    0x4F, 0xEC, 0xA7, 0xD9, 0x2E, 0xE0, 0x78, 0x06, 0x29, 0x40, 0xA5, 0xC5, 0x28, 0x15, 0xFD, 0x18,
+    0x79, 0xA8, 0xF4, 0x2B, 0x39, 0x8B, 0xA2, 0x96, 0x00, 0x12, 0x04, 0x8C, 0x07, 0x62, 0xCB, 0xDA,
+    0xA5, 0x65, 0x04, 0x61, 0x94, 0x11, 0xF7, 0x59, 0x4F, 0xF1, 0x03, 0xEA, 0x3D, 0xEB, 0x1F, 0xC2,
+    0xD7, 0x1B, 0xA3, 0xC1, 0x2B, 0x95, 0x25, 0x40, 0x1D, 0x76, 0xB7, 0x3F, 0x30, 0xF7, 0x24, 0xD6,
+    0xCD, 0x7C, 0x3E, 0x26, 0x16, 0x6D, 0x76, 0x7A, 0x1F, 0x8A, 0xE6, 0x14, 0x79, 0x67, 0x24, 0xBA,
+    0x36, 0xA3, 0xE9, 0xD3, 0xF0, 0x3C, 0xEE, 0x48, 0x99, 0x49, 0x0E, 0x30, 0xC0, 0xEC, 0x71, 0xE8,
+    0xC0, 0xFA, 0xD2, 0x62, 0xB5, 0xFC, 0x49, 0x66, 0x52, 0x4C, 0x80, 0x02, 0xB7, 0xCE, 0x31, 0xD9,
+    0xC7, 0x5E, 0x3D, 0xFA, 0xD6, 0x56, 0x2B, 0xEC, 0xE8, 0x54, 0xBA, 0x4D, 0x5B, 0x5D, 0x5F, 0xA9,
+    0xFB, 0x2E, 0x5F, 0x88, 0x52, 0x8C, 0x65, 0x06, 0xB5, 0x5C, 0xCF, 0xC9, 0xF5, 0x5F, 0x27, 0xA0,
+    0x98, 0xA7, 0x01, 0x46, 0x29, 0x40, 0xAD, 0x4E, 0xE4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xEC, 0x50,
+    0x5A, 0x10, 0x0A, 0x5C, 0x52, 0x81, 0x4B, 0x8A, 0x0B, 0x41, 0x8A, 0x50, 0x28, 0xC5, 0x28, 0x14,
+    0x16, 0x80, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA1, 0x00, 0xA5, 0xC5, 0x28, 0x14, 0xB8,
+    0xA0, 0xB4, 0x6A, 0x78, 0x7A, 0x2C, 0xB9, 0x25, 0x41, 0x00, 0x63, 0x3F, 0xDD, 0x66, 0x3D, 0xBE,
+    0xA3, 0x35, 0xD0, 0xD6, 0x7E, 0x8B, 0x6D, 0xB1, 0x3E, 0x60, 0x32, 0x7F, 0x78, 0x7F, 0xDD, 0xED,
+    0x93, 0xF4, 0xE6, 0xB4, 0x2B, 0xE3, 0xF3, 0x1A, 0x97, 0x93, 0xE5, 0x7F, 0xDC, 0x5F, 0x23, 0xF1,
+    0x1E, 0x29, 0xC4, 0xA9, 0x55, 0x93, 0xA6, 0xD3, 0x4B, 0xF7, 0x10, 0x7D, 0xED, 0xBF, 0xE3, 0x73,
+    0x23, 0xC4, 0x32, 0x1C, 0x28, 0xE3, 0x04, 0x97, 0x27, 0xDD, 0x47, 0x6F, 0xCE, 0xB1, 0x00, 0xAB,
+    0xFA, 0xCC, 0xBB, 0xA4, 0x3C, 0xA9, 0x03, 0x11, 0x82, 0x3D, 0xBD, 0x7E, 0x84, 0xD5, 0x2C, 0x57,
+    0xD1, 0xE5, 0xF0, 0xB4, 0x55, 0xFF, 0x00, 0xC6, 0xFE, 0x67, 0xEA, 0xBC, 0x2F, 0x43, 0x96, 0x94,
+    0x14, 0x96, 0xAD, 0x7B, 0x69, 0x7F, 0xDB, 0xDA, 0xFE, 0x4D, 0x21, 0x00, 0xA7, 0x62, 0x80, 0x29,
+    0x71, 0x5D, 0xA7, 0xD0, 0xA0, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0x91, 0x68, 0x40, 0x29, 0x40,
+    0xA5, 0x02, 0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x50, 0x05, 0x2E, 0x28, 0x2D, 0x1E, 0x76, 0x05,
+    0x28, 0x14, 0xA0, 0x52, 0x81, 0x54, 0x7E, 0x52, 0x84, 0xC5, 0x3B, 0x14, 0x62, 0x97, 0x14, 0x16,
+    0x80, 0x0A, 0x5C, 0x50, 0x05, 0x38, 0x0A, 0x0B, 0x42, 0x01, 0x5B, 0x9E, 0x0A, 0xBC, 0x78, 0x6E,
+    0xE1, 0x31, 0x85, 0x24, 0xB8, 0xB7, 0x21, 0xBF, 0xB9, 0x3F, 0xCA, 0x71, 0x8F, 0x45, 0x63, 0x58,
+    0xA0, 0x52, 0x81, 0x58, 0xE2, 0x29, 0xA9, 0x26, 0xA5, 0xD5, 0x3A, 0x6F, 0xE6, 0xAC, 0x6B, 0x4E,
+    0x56, 0x77, 0x5F, 0xE2, 0x47, 0xD3, 0x34, 0x56, 0x77, 0x87, 0xB5, 0x51, 0x77, 0x04, 0x6E, 0x0A,
+    0x92, 0xCA, 0x1A, 0x6D, 0xA0, 0x80, 0xB3, 0x0E, 0x18, 0x28, 0x6F, 0xEE, 0xB8, 0x23, 0xBD, 0x68,
+    0xD7, 0xF3, 0xDD, 0x58, 0x34, 0xDA, 0xA8, 0xAC, 0xD3, 0x70, 0x9A, 0xEC, 0xD1, 0xF6, 0x51, 0x7F,
+    0xCA, 0xFC, 0xD0, 0x51, 0x45, 0x15, 0x99, 0x41, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01,
+    0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01,
+    0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x58, 0xBE, 0x33, 0xBA, 0x78, 0xAD, 0x65, 0x31,
+    0x85, 0x27, 0x6F, 0x90, 0x73, 0xFD, 0xD9, 0x98, 0x03, 0xD3, 0xD0, 0x1A, 0xDA, 0xAE, 0x0B, 0xE2,
+    0x96, 0xA2, 0x31, 0x1C, 0x6A, 0x54, 0x9F, 0xF8, 0xFC, 0x98, 0x60, 0xE5, 0x40, 0x04, 0x0C, 0x37,
+    0xFB, 0x59, 0x6A, 0xF6, 0x32, 0x0C, 0x3B, 0x95, 0x48, 0x24, 0xBA, 0xAA, 0xB3, 0xF4, 0x5A, 0xBF,
+    0xBE, 0xD6, 0x33, 0xAA, 0xF4, 0xFC, 0x0F, 0x3D, 0x02, 0x94, 0x0A, 0x00, 0xA7, 0x01, 0x5F, 0xBA,
+    0x9E, 0x7A, 0x34, 0xFC, 0x39, 0x78, 0x23, 0x93, 0x0C, 0x4E, 0xD6, 0xFD, 0xD1, 0xF6, 0x72, 0x78,
+    0xC8, 0xFA, 0xF1, 0xF8, 0xD7, 0x63, 0x5E, 0x79, 0x8A, 0xED, 0x74, 0x8D, 0x40, 0x4C, 0x80, 0x96,
+    0x05, 0xC7, 0xCB, 0x3A, 0xFA, 0x37, 0xA9, 0x1F, 0xED, 0xF5, 0xAF, 0x9E, 0xCE, 0x68, 0xFD, 0xA8,
+    0xAF, 0xEE, 0x4F, 0xF4, 0x3E, 0x0F, 0x8C, 0x30, 0x7B, 0x4E, 0x9C, 0x5F, 0xFC, 0xFA, 0xAD, 0xE4,
+    0xFA, 0x3F, 0xD3, 0xEE, 0xEE, 0x26, 0xB1, 0xA7, 0x09, 0xD3, 0x8F, 0xBE, 0x3E, 0x78, 0x4F, 0xAB,
+    0x63, 0xA1, 0x27, 0xFB, 0xDF, 0x5A, 0xE3, 0x71, 0x5E, 0x83, 0x5C, 0xEE, 0xBF, 0xA3, 0xB6, 0x4B,
+    0xC0, 0x32, 0x3E, 0xF4, 0xE8, 0x3F, 0x84, 0xFA, 0x8F, 0xAF, 0x7F, 0xCE, 0xA7, 0x29, 0xC4, 0xDB,
+    0xDD, 0xAB, 0x2F, 0x3A, 0x7E, 0x4F, 0xB1, 0x1C, 0x25, 0x98, 0xA5, 0xEE, 0x62, 0x66, 0x92, 0x7A,
+    0xD0, 0x7D, 0xA5, 0xDB, 0xE7, 0xD3, 0xCF, 0xD4, 0xC1, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x40, 0xAF,
+    0xA3, 0x3F, 0x48, 0x42, 0x62, 0x97, 0x14, 0xB8, 0xA5, 0xC5, 0x22, 0xD0, 0x01, 0x4B, 0x8A, 0x00,
+    0xA5, 0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x50, 0x5A, 0x13, 0x14, 0xEC, 0x51,
+    0x8A, 0x5C, 0x50, 0x5A, 0x00, 0x2A, 0xD6, 0x9F, 0x67, 0xE6, 0xB6, 0x32, 0x40, 0xFB, 0xD2, 0x11,
+    0xD9, 0x47, 0xA7, 0xD4, 0xD4, 0x31, 0x44, 0xCC, 0x71, 0x1A, 0x96, 0x27, 0x85, 0x03, 0xBD, 0x74,
+    0xDA, 0x75, 0x88, 0x85, 0x71, 0x90, 0x58, 0xFC, 0xD2, 0x37, 0xBF, 0xB7, 0xD2, 0xB8, 0x33, 0x0C,
+    0x42, 0x8A, 0xF7, 0x5A, 0xBB, 0xD2, 0x1E, 0x5E, 0x67, 0xCF, 0x71, 0x26, 0x66, 0xA9, 0xC7, 0xF7,
+    0x53, 0x5C, 0xEF, 0xDD, 0xA2, 0xBB, 0x7F, 0x7B, 0xE5, 0xD3, 0xBB, 0xF9, 0x96, 0x55, 0x40, 0xFB,
+    0xA0, 0x01, 0xD0, 0x01, 0xD8, 0x0F, 0x41, 0x51, 0xDC, 0xCE, 0x23, 0x52, 0x5B, 0xB7, 0x38, 0xF5,
+    0x3F, 0xFD, 0x73, 0x52, 0xD6, 0x26, 0xB7, 0x76, 0x18, 0x85, 0x46, 0x04, 0x0F, 0x9A, 0x4C, 0x7F,
+    0x7F, 0xFF, 0x00, 0xB1, 0x15, 0xF3, 0x78, 0x3A, 0x3C, 0xCE, 0xCE, 0xFF, 0x00, 0xCD, 0x3F, 0x43,
+    0xF2, 0xFC, 0x8B, 0x04, 0xEA, 0x4D, 0x26, 0xA5, 0x6F, 0xE2, 0x62, 0x1F, 0x68, 0xAD, 0xFE, 0xFD,
+    0x97, 0x9B, 0x32, 0xC9, 0x27, 0xEF, 0x12, 0x4F, 0x52, 0x4F, 0x72, 0x7D, 0x4D, 0x2E, 0x28, 0xC5,
+    0x2E, 0x2B, 0xEC, 0xCF, 0xDE, 0x63, 0xE4, 0xBC, 0x90, 0x01, 0x4B, 0x8A, 0x50, 0x29, 0x40, 0xA0,
+    0xB4, 0x20, 0x14, 0xA0, 0x52, 0x81, 0x4A, 0x05, 0x05, 0xA0, 0xC5, 0x2E, 0x28, 0xC5, 0x3B, 0x14,
+    0x16, 0x84, 0x02, 0x97, 0x14, 0xA0, 0x52, 0x81, 0x41, 0x68, 0xF3, 0xAC, 0x53, 0x80, 0xA3, 0x14,
+    0xA0, 0x53, 0x3F, 0x29, 0x41, 0x8A, 0x5C, 0x51, 0x8A, 0x70, 0x14, 0x16, 0x84, 0x02, 0x94, 0x0A,
+    0x50, 0x29, 0x71, 0x41, 0x68, 0x31, 0x4A, 0x05, 0x18, 0xA5, 0x02, 0x82, 0xD1, 0xE9, 0xFF, 0x00,
+    0x08, 0x75, 0x96, 0x65, 0x78, 0xA5, 0x97, 0x3B, 0x7F, 0xD2, 0xEC, 0xD0, 0xE7, 0x88, 0xD8, 0xE1,
+    0xB0, 0x7A, 0x61, 0x5B, 0x69, 0xC7, 0x1C, 0x92, 0x79, 0xAF, 0x47, 0xAF, 0x9E, 0x34, 0x3D, 0x56,
+    0x4B, 0x49, 0x52, 0x48, 0x46, 0x4A, 0x9D, 0xC5, 0x3F, 0xE7, 0xA4, 0x67, 0x82, 0x32, 0x41, 0xFB,
+    0xEA, 0x48, 0xE9, 0xC7, 0x6A, 0xF7, 0xDD, 0x37, 0x50, 0x86, 0xE6, 0x35, 0x7B, 0x66, 0xCA, 0x30,
+    0x12, 0xA7, 0x4F, 0x97, 0x3D, 0x9F, 0x04, 0xF2, 0x87, 0x83, 0xCF, 0x06, 0xBF, 0x25, 0xE3, 0x3C,
+    0x0B, 0x8C, 0xF9, 0xE9, 0xC7, 0x49, 0xEA, 0xFC, 0xA7, 0xD7, 0xEF, 0xDF, 0xD6, 0xE7, 0xD2, 0x65,
+    0x75, 0x6E, 0xAC, 0xDE, 0xAB, 0xF2, 0x2D, 0x51, 0x45, 0x15, 0xF1, 0x87, 0xA8, 0x14, 0x51, 0x45,
+    0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45,
+    0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x15, 0xE2, 0xBE,
+    0x25, 0xD5, 0x5A, 0xEA, 0x77, 0x6F, 0x33, 0x72, 0x67, 0xCB, 0xB5, 0xEB, 0x81, 0x02, 0x1E, 0x36,
+    0xAB, 0x7F, 0x78, 0x73, 0xDB, 0x9A, 0xEF, 0xFC, 0x7F, 0xE2, 0x01, 0x04, 0x5B, 0x22, 0x39, 0x96,
+    0x40, 0x50, 0x90, 0x47, 0xEE, 0xA0, 0xEF, 0xBD, 0x4F, 0xFC, 0xF4, 0x19, 0x03, 0x8F, 0x5E, 0x78,
+    0xAF, 0x2F, 0xC5, 0x7E, 0x9B, 0xC0, 0xF8, 0x16, 0x93, 0xA9, 0x5A, 0x3B, 0xFE, 0xEA, 0x87, 0xA7,
+    0x57, 0xF3, 0x7A, 0x7C, 0x99, 0xC5, 0x89, 0x9F, 0x45, 0xEA, 0xC4, 0xC5, 0x28, 0x14, 0xB8, 0xA5,
+    0x02, 0xBE, 0xFC, 0xE6, 0x42, 0x62, 0xAE, 0xE9, 0x97, 0xEF, 0x03, 0x65, 0x49, 0xDB, 0xD2, 0x74,
+    0xFE, 0xFA, 0x7B, 0x0F, 0x51, 0x55, 0x31, 0x4A, 0x05, 0x4D, 0x48, 0xA6, 0xAD, 0x34, 0xBB, 0x32,
+    0x6B, 0x53, 0x8C, 0x93, 0x55, 0xA2, 0x9A, 0x7E, 0xEC, 0x91, 0xDE, 0x43, 0x32, 0x38, 0x06, 0x26,
+    0x0C, 0xA7, 0x95, 0x61, 0xDF, 0xFF, 0x00, 0xD5, 0x4F, 0xAE, 0x4F, 0x47, 0xD5, 0x7C, 0x82, 0x7C,
+    0xC5, 0x66, 0x43, 0xC9, 0x03, 0xF8, 0x18, 0x7F, 0x74, 0x1F, 0x5A, 0xEA, 0x61, 0x99, 0x1C, 0x03,
+    0x13, 0x06, 0x53, 0xCA, 0xB0, 0xEF, 0xFF, 0x00, 0xEA, 0xAF, 0x90, 0xC6, 0x61, 0x9C, 0x5E, 0xCE,
+    0xDF, 0x61, 0x9F, 0x93, 0x67, 0x19, 0x74, 0xA9, 0xBD, 0x54, 0x9C, 0x5F, 0xF0, 0xA7, 0xDF, 0xCB,
+    0xD7, 0xF3, 0xDC, 0xC1, 0xD6, 0x34, 0x32, 0x0E, 0xEB, 0x34, 0x24, 0x7F, 0xCB, 0x48, 0x57, 0xF8,
+    0x49, 0xFE, 0xE0, 0xF4, 0x3F, 0xA7, 0xD3, 0xA6, 0x20, 0x15, 0xDE, 0x56, 0x7D, 0xF6, 0x8D, 0x04,
+    0xBF, 0x74, 0x08, 0xDF, 0xAF, 0x98, 0x07, 0x5E, 0x7F, 0x89, 0x7D, 0xFF, 0x00, 0x3A, 0xEF, 0xC1,
+    0x63, 0xED, 0xA6, 0x26, 0xFD, 0x94, 0xBF, 0xCC, 0xFA, 0x0C, 0x97, 0x3F, 0xB2, 0x51, 0xCC, 0xF9,
+    0x9A, 0xF8, 0x63, 0x53, 0xAA, 0x5E, 0x7D, 0xFD, 0x56, 0xBE, 0xA7, 0x2B, 0x8A, 0x5C, 0x55, 0xEB,
+    0x8D, 0x16, 0xEA, 0x3F, 0xF9, 0x67, 0xE6, 0x0F, 0x58, 0xF9, 0xC1, 0xF7, 0x1F, 0xFD, 0x6A, 0xA4,
+    0x05, 0x7B, 0xD4, 0xEA, 0x45, 0xFF, 0x00, 0x0A, 0x71, 0x67, 0xDF, 0xE1, 0xB1, 0x10, 0x92, 0xBE,
+    0x1A, 0xB4, 0x25, 0xDE, 0xCF, 0x60, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x5A, 0x1D, 0x68, 0x4C,
+    0x53, 0x80, 0xA3, 0x15, 0x24, 0x71, 0x3B, 0x7F, 0xAB, 0x46, 0x63, 0xD4, 0x85, 0x1D, 0xBE, 0x82,
+    0x93, 0x7D, 0xD8, 0xDC, 0x97, 0xDB, 0x92, 0x5D, 0x5B, 0x19, 0x8A, 0x92, 0x18, 0x1D, 0xCE, 0x22,
+    0x46, 0x63, 0xE8, 0x3B, 0x0F, 0x7A, 0xD1, 0xB6, 0xD0, 0x65, 0x3F, 0xEB, 0xDD, 0x50, 0x77, 0x51,
+    0xD7, 0xAF, 0xF5, 0x1F, 0x5A, 0xD9, 0x82, 0xDA, 0x28, 0xC7, 0xEE, 0x63, 0x55, 0xF5, 0xF7, 0xFA,
+    0x9F, 0x6A, 0xF2, 0xF1, 0x58, 0xF8, 0xAF, 0xE0, 0xB5, 0x27, 0xF8, 0x23, 0xE5, 0x73, 0x5E, 0x21,
+    0xA5, 0x1D, 0x30, 0x4D, 0x54, 0x96, 0xCA, 0xDF, 0x0A, 0xF5, 0x7D, 0x7E, 0x5F, 0x7A, 0x20, 0xD3,
+    0xB4, 0xE5, 0x84, 0x73, 0x86, 0x73, 0xF7, 0xDF, 0xFA, 0x2D, 0x5C, 0xA2, 0xAB, 0x5E, 0x5F, 0xC7,
+    0x17, 0xDE, 0xC9, 0x6E, 0xAA, 0x83, 0xFA, 0xFE, 0x35, 0xF3, 0xAF, 0x9A, 0x4F, 0xAB, 0x6C, 0xFC,
+    0xD5, 0xBA, 0xD5, 0x25, 0xB4, 0xE7, 0x29, 0x6B, 0xFD, 0x76, 0x4B, 0xEE, 0x43, 0x35, 0x2B, 0xE1,
+    0x18, 0xF9, 0x18, 0x6F, 0x3F, 0x70, 0x7F, 0x74, 0x7A, 0x91, 0x5C, 0xF1, 0x24, 0xFD, 0xE2, 0x49,
+    0xEA, 0x49, 0xEE, 0x4F, 0xAD, 0x3E, 0x59, 0x19, 0xC9, 0x2E, 0x79, 0x3C, 0x9F, 0x6F, 0xA7, 0xD2,
+    0x9A, 0x05, 0x7D, 0x56, 0x0B, 0x0E, 0xA2, 0xBC, 0xF7, 0x9B, 0x3F, 0x62, 0xC8, 0x32, 0xD8, 0xD3,
+    0x8D, 0x95, 0x9C, 0x9F, 0xBD, 0x5E, 0x5E, 0x7D, 0xBD, 0x17, 0xFC, 0x10, 0xC5, 0x2E, 0x29, 0x71,
+    0x4A, 0x05, 0x76, 0x1E, 0xFA, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28,
+    0x14, 0x62, 0x94, 0x0A, 0x0B, 0x41, 0x8A, 0x5C, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x42, 0x01, 0x4E,
+    0x02, 0x80, 0x29, 0x71, 0x41, 0x68, 0xF3, 0xBC, 0x52, 0x81, 0x46, 0x29, 0xC0, 0x55, 0x1F, 0x94,
+    0xA1, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x00, 0x29, 0x71, 0x40, 0x14, 0xB8, 0xA0,
+    0xB4, 0x18, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A, 0xEF, 0x3E, 0x1A, 0x78, 0xB7,
+    0xC8, 0x6F, 0x2A, 0xF5, 0xE5, 0x31, 0x39, 0x0B, 0x60, 0x7A, 0x8B, 0x69, 0xDC, 0xF4, 0xC7, 0xA4,
+    0xC4, 0xFA, 0xE0, 0x1E, 0xDC, 0x93, 0x5C, 0x28, 0x14, 0xB8, 0xAE, 0x0C, 0xCB, 0x09, 0x09, 0xC5,
+    0xC7, 0x10, 0xB7, 0xF8, 0x5F, 0xF2, 0xBE, 0x8D, 0x7F, 0x5E, 0x47, 0x46, 0x1E, 0xAB, 0x4E, 0xF0,
+    0xF9, 0xF9, 0x9F, 0x48, 0x51, 0x5C, 0x4F, 0xC3, 0xCF, 0x18, 0xFD, 0xA5, 0x7C, 0xBD, 0x46, 0xE7,
+    0x75, 0xC8, 0xFF, 0x00, 0x8F, 0x77, 0x6E, 0xB7, 0x50, 0x01, 0xDD, 0xB3, 0xCB, 0x27, 0x39, 0xE8,
+    0x48, 0xE7, 0x9E, 0x4D, 0x76, 0xD5, 0xF8, 0x76, 0x61, 0x84, 0x9C, 0x24, 0xE3, 0x89, 0x8E, 0xAB,
+    0x67, 0xD2, 0x4B, 0xBA, 0xF2, 0x3E, 0xB6, 0x8D, 0x44, 0xD5, 0xE0, 0xFF, 0x00, 0xE0, 0x05, 0x14,
+    0x51, 0x5C, 0x46, 0xA1, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01,
+    0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x55, 0x75, 0x3D, 0x46,
+    0x1B, 0x68, 0xD9, 0xEE, 0x4B, 0x04, 0x5F, 0x99, 0xB6, 0x8E, 0x58, 0x93, 0x80, 0x14, 0x7F, 0xB4,
+    0x4E, 0x3F, 0x9D, 0x58, 0x92, 0x45, 0x50, 0x4C, 0x8E, 0xAA, 0xA3, 0xE7, 0x91, 0xD8, 0xF0, 0x8A,
+    0x07, 0x56, 0x27, 0xD0, 0x57, 0x93, 0xF8, 0xC3, 0xC4, 0xAF, 0x79, 0x26, 0x20, 0x95, 0xBE, 0xCC,
+    0xBF, 0xF1, 0xEC, 0x98, 0xC7, 0x98, 0xD8, 0xFB, 0xCE, 0x3D, 0xCE, 0x71, 0xE8, 0x3B, 0x03, 0x9A,
+    0xF7, 0x72, 0x0C, 0xB6, 0x55, 0x25, 0x6D, 0x54, 0x57, 0xBD, 0x5E, 0x5E, 0x5D, 0x97, 0x9B, 0xE9,
+    0xF7, 0xF4, 0x31, 0xAD, 0x52, 0xDF, 0xA1, 0x99, 0xAC, 0xEA, 0xB3, 0x5D, 0xC8, 0xCF, 0x3B, 0x37,
+    0x3C, 0x44, 0x84, 0xFF, 0x00, 0xA8, 0x8B, 0x3C, 0x2A, 0xF4, 0xFB, 0xA3, 0xDB, 0x9E, 0xBD, 0x6A,
+    0x96, 0x29, 0x40, 0xA5, 0xC5, 0x7E, 0xD7, 0x4A, 0x11, 0x49, 0x2A, 0x30, 0x49, 0x2F, 0x72, 0x0B,
+    0xB2, 0x3C, 0xBB, 0xF7, 0x7E, 0xA2, 0x62, 0x9C, 0x05, 0x18, 0xA5, 0x02, 0xB4, 0x29, 0x00, 0x14,
+    0xA0, 0x52, 0x81, 0x4B, 0x8A, 0x0B, 0x42, 0x01, 0x57, 0x2C, 0x35, 0x29, 0xA1, 0x3F, 0x21, 0xCA,
+    0xFD, 0xE9, 0x22, 0x3F, 0xC5, 0xF4, 0x35, 0x54, 0x0A, 0x5C, 0x54, 0x54, 0x82, 0x7A, 0x54, 0x8A,
+    0x7D, 0xD1, 0x15, 0xA9, 0x46, 0x4A, 0xD8, 0x8A, 0x71, 0x92, 0x7A, 0x49, 0x33, 0xB0, 0xB3, 0xD4,
+    0x21, 0x98, 0x7E, 0xE9, 0xB9, 0xEF, 0x19, 0xEA, 0xA0, 0x7A, 0x8A, 0xB3, 0x5C, 0x42, 0x92, 0x3E,
+    0xE9, 0x20, 0xF5, 0x52, 0x3B, 0x11, 0xE8, 0x6B, 0x52, 0xD3, 0x5E, 0x9D, 0x3F, 0xD7, 0x28, 0x94,
+    0x74, 0x52, 0x78, 0x23, 0xEA, 0xDF, 0xFD, 0x6C, 0xD7, 0x81, 0x89, 0xCB, 0x9F, 0xFC, 0xC3, 0x4A,
+    0xFE, 0x47, 0xC2, 0x66, 0x3C, 0x3B, 0x25, 0xAE, 0x5B, 0x35, 0x25, 0xBF, 0x23, 0xD1, 0xAF, 0x9E,
+    0xCF, 0xE7, 0x63, 0xA3, 0xA8, 0xE4, 0xB6, 0x89, 0xBF, 0xD6, 0x43, 0x1B, 0x1E, 0x80, 0xB0, 0x1D,
+    0x3E, 0xA6, 0xAB, 0x43, 0xAC, 0x5A, 0xBF, 0xFC, 0xB5, 0xD8, 0x7F, 0xBA, 0xFC, 0x63, 0x1E, 0xAD,
+    0xD3, 0xF5, 0xAB, 0x8A, 0xC0, 0xFD, 0xD2, 0x08, 0xEA, 0x08, 0xEE, 0x0F, 0xA1, 0xAF, 0x26, 0x50,
+    0x92, 0xF8, 0xE3, 0x34, 0x7C, 0x9D, 0x5A, 0x55, 0x60, 0xFF, 0x00, 0x7B, 0x4A, 0xB4, 0x1E, 0xCB,
+    0x75, 0x72, 0x9F, 0xF6, 0x35, 0x9F, 0xFC, 0xF0, 0xFD, 0x4F, 0xF8, 0xD2, 0x0D, 0x16, 0xD3, 0xFE,
+    0x78, 0x93, 0xDC, 0x0C, 0x9F, 0x97, 0x8E, 0xDC, 0xD5, 0xEA, 0x2A, 0xBE, 0xB1, 0x53, 0xFE, 0x82,
+    0x2A, 0xFD, 0xEC, 0xDB, 0xFB, 0x43, 0x11, 0xFF, 0x00, 0x43, 0x0C, 0x5F, 0xFE, 0x04, 0xFF, 0x00,
+    0xCC, 0xA9, 0x1E, 0x97, 0x6A, 0xBF, 0x76, 0xDD, 0x4F, 0x6F, 0x9B, 0x9F, 0xD0, 0xD5, 0x94, 0x45,
+    0x51, 0xF2, 0x2A, 0xA8, 0xEC, 0xA3, 0xB7, 0xD0, 0x53, 0xAA, 0x39, 0x67, 0x8D, 0x3F, 0xD6, 0xC8,
+    0xAB, 0xDC, 0x67, 0xBE, 0x3F, 0xBA, 0x2A, 0x1C, 0xA4, 0xFE, 0x29, 0x4D, 0xF6, 0xEA, 0x63, 0x3A,
+    0xB5, 0x65, 0xA5, 0x4A, 0xB5, 0xE6, 0xFE, 0xCA, 0x6D, 0xBB, 0x92, 0x51, 0x59, 0xD3, 0xEB, 0x70,
+    0x8F, 0xF5, 0x4A, 0x64, 0xF5, 0x3D, 0x00, 0xFC, 0x4F, 0xF8, 0x56, 0x65, 0xCD, 0xFC, 0xD2, 0x7D,
+    0xF7, 0xC0, 0xFE, 0xE2, 0xF4, 0xFC, 0x6B, 0xB6, 0x86, 0x06, 0x6F, 0xE3, 0x5C, 0xAB, 0xBB, 0xFF,
+    0x00, 0x23, 0xDD, 0xCB, 0xB2, 0x0C, 0x44, 0xBF, 0x8D, 0x0F, 0x66, 0xBA, 0xB7, 0xBF, 0xFE, 0x03,
+    0xBF, 0xDF, 0x63, 0x4A, 0xFB, 0x57, 0x45, 0xE2, 0xDC, 0x86, 0x6F, 0xEF, 0x8E, 0x8B, 0x9F, 0x43,
+    0xED, 0x58, 0xF2, 0x48, 0xCC, 0x72, 0xEC, 0x49, 0xEA, 0xC7, 0xD6, 0x9A, 0x05, 0x2E, 0x2B, 0xE8,
+    0x70, 0xD8, 0x78, 0xC7, 0xF8, 0x6B, 0xFC, 0x4F, 0xB9, 0xFA, 0x5E, 0x53, 0x96, 0xD2, 0xA6, 0xBF,
+    0xD9, 0xA1, 0xAF, 0xFC, 0xBC, 0x9B, 0xDE, 0x5F, 0xF0, 0x3C, 0x83, 0x14, 0xA0, 0x52, 0xE2, 0x94,
+    0x0A, 0xEA, 0x3D, 0x94, 0x20, 0x14, 0xA0, 0x52, 0x81, 0x4B, 0x8A, 0x0B, 0x40, 0x05, 0x2E, 0x28,
+    0x02, 0x97, 0x14, 0x16, 0x83, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x42, 0x01, 0x4E, 0x02,
+    0x80, 0x29, 0x71, 0x41, 0x68, 0x00, 0xA5, 0xC5, 0x00, 0x53, 0xB1, 0x41, 0x68, 0xF3, 0xA0, 0x29,
+    0x40, 0xA5, 0x02, 0x94, 0x0A, 0x67, 0xE5, 0x28, 0x4C, 0x53, 0xB1, 0x46, 0x29, 0x71, 0x41, 0x68,
+    0x00, 0xA5, 0xC5, 0x28, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0x02, 0x82,
+    0x90, 0x62, 0x97, 0x14, 0x62, 0x9D, 0x8A, 0x0B, 0x42, 0xC5, 0x23, 0xA1, 0x06, 0x27, 0x64, 0x60,
+    0x43, 0xC6, 0xEA, 0x70, 0x51, 0x94, 0xF5, 0x56, 0x1E, 0x86, 0xBD, 0x53, 0xC1, 0xDF, 0x10, 0xD2,
+    0xE4, 0xAC, 0x7A, 0xA0, 0x58, 0xE7, 0xC0, 0x48, 0x6E, 0x7B, 0x5D, 0xC9, 0x9E, 0x85, 0x7B, 0x16,
+    0x18, 0xF6, 0x27, 0xA6, 0x38, 0x15, 0xE5, 0x60, 0x52, 0x81, 0x5E, 0x4E, 0x6F, 0x97, 0x53, 0xA8,
+    0xAD, 0x89, 0x8E, 0xBF, 0xF2, 0xEA, 0x7D, 0x60, 0xFF, 0x00, 0x55, 0xDD, 0x7E, 0xBA, 0x9D, 0x98,
+    0x6A, 0xF2, 0x8F, 0xC0, 0xFF, 0x00, 0xC4, 0xBB, 0x9F, 0x45, 0x51, 0x5E, 0x4F, 0xE1, 0x4F, 0x88,
+    0x73, 0xDA, 0x80, 0x9A, 0x82, 0x34, 0xF6, 0xE0, 0x15, 0x89, 0xD7, 0xEF, 0xC2, 0x31, 0xC0, 0x52,
+    0x48, 0xC8, 0x5F, 0xCC, 0x76, 0x38, 0x00, 0x57, 0xA6, 0xE9, 0x9A, 0xAD, 0xA5, 0xD2, 0x6E, 0xB0,
+    0xB8, 0x59, 0x53, 0x25, 0x37, 0x0C, 0xFC, 0xAC, 0xBD, 0x9D, 0x4E, 0x31, 0xF9, 0x57, 0xE4, 0x59,
+    0xB6, 0x57, 0x56, 0x9B, 0xFD, 0xFD, 0x36, 0xD6, 0xD0, 0x9A, 0xD9, 0xFF, 0x00, 0x93, 0xF2, 0x7F,
+    0x89, 0xF4, 0x98, 0x7C, 0x44, 0x65, 0xF0, 0x3D, 0x7A, 0xA2, 0xDD, 0x14, 0x51, 0x5E, 0x31, 0xD4,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x15, 0x0D, 0xDD, 0xDC, 0x30, 0xA9, 0x6B, 0x99, 0x56, 0x38, 0xC7, 0xCD, 0x23, 0x9E, 0xC3, 0xFF,
+    0x00, 0xAE, 0x7F, 0x3E, 0xD5, 0x91, 0xAF, 0x78, 0xC2, 0xC6, 0xCF, 0x21, 0xD9, 0xA5, 0x9B, 0xA8,
+    0xB6, 0x4F, 0xE1, 0xDC, 0x0E, 0x3C, 0xD7, 0xED, 0x9F, 0xC4, 0xF7, 0xC5, 0x79, 0xA6, 0xB7, 0xAF,
+    0x5D, 0xDE, 0xB6, 0x6F, 0x1D, 0x78, 0xF9, 0x62, 0x85, 0x3E, 0xEC, 0x43, 0xFD, 0x85, 0x24, 0xFD,
+    0xE3, 0xEF, 0xFD, 0x2B, 0xEA, 0x32, 0x4C, 0x8E, 0xAD, 0x4B, 0x3A, 0xCA, 0x50, 0x8F, 0xC5, 0xCD,
+    0xD6, 0x4B, 0xC9, 0x7E, 0xBB, 0x7A, 0xEC, 0x72, 0xD6, 0xAE, 0x97, 0xC3, 0xAB, 0xFC, 0x8D, 0x2F,
+    0x14, 0x78, 0xCE, 0x6B, 0xDF, 0x96, 0x04, 0x68, 0x60, 0xEA, 0xC9, 0x9E, 0x6E, 0x08, 0x3C, 0x19,
+    0x71, 0xE8, 0x31, 0xC7, 0x3C, 0xF7, 0x3C, 0x63, 0x9C, 0xC5, 0x2E, 0x29, 0x71, 0x5F, 0xAC, 0xE0,
+    0xB0, 0xD4, 0xE0, 0xB9, 0x70, 0x94, 0x94, 0x56, 0xF6, 0xEE, 0xFC, 0xFB, 0x9E, 0x64, 0xA4, 0xDF,
+    0xC6, 0xC4, 0x02, 0x9D, 0x8A, 0x00, 0xA5, 0x02, 0xBA, 0x81, 0x00, 0x14, 0xA0, 0x52, 0x81, 0x4A,
+    0x05, 0x05, 0xA1, 0x31, 0x4B, 0x8A, 0x5C, 0x52, 0xE2, 0x82, 0xD0, 0x01, 0x4B, 0x8A, 0x00, 0xA5,
+    0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x50, 0x5A, 0x13, 0x14, 0xF4, 0x76, 0x53,
+    0xF2, 0x33, 0x29, 0xEC, 0xC3, 0xB7, 0xD0, 0xD2, 0x62, 0x97, 0x14, 0x9F, 0x9F, 0xCC, 0xA6, 0xBF,
+    0x99, 0x2E, 0xCC, 0x9B, 0xED, 0x97, 0x1F, 0xF3, 0xF3, 0x37, 0xFD, 0xF4, 0x69, 0x7E, 0xD9, 0x71,
+    0xFF, 0x00, 0x3F, 0x33, 0x7F, 0xDF, 0x46, 0xA1, 0x02, 0x9C, 0x05, 0x47, 0xB3, 0x8F, 0xFC, 0xFB,
+    0x87, 0xDC, 0x66, 0xA8, 0x53, 0xFF, 0x00, 0xA0, 0x7A, 0x3F, 0x72, 0x24, 0x37, 0x53, 0x9F, 0xBD,
+    0x3C, 0xA4, 0x74, 0x20, 0x93, 0xC8, 0x3E, 0xA2, 0xA3, 0x02, 0x94, 0x0A, 0x50, 0x2A, 0xA3, 0x15,
+    0xF6, 0x62, 0x91, 0xBD, 0x38, 0x45, 0x7F, 0x0A, 0x9C, 0x57, 0x7B, 0x09, 0x8A, 0x76, 0x28, 0xC5,
+    0x2E, 0x2A, 0x8D, 0x90, 0x01, 0x4B, 0x8A, 0x50, 0x29, 0x40, 0xA0, 0xB4, 0x20, 0x14, 0xA0, 0x52,
+    0x81, 0x4A, 0x05, 0x22, 0xD0, 0x62, 0x97, 0x14, 0x62, 0x9D, 0x8A, 0x0B, 0x42, 0x01, 0x4B, 0x8A,
+    0x50, 0x29, 0x40, 0xA0, 0xB4, 0x20, 0x14, 0xE0, 0x28, 0x02, 0x94, 0x0A, 0x0B, 0x41, 0x8A, 0x5C,
+    0x51, 0x8A, 0x76, 0x28, 0x2D, 0x08, 0x05, 0x2E, 0x29, 0x40, 0xA5, 0x02, 0x82, 0xD1, 0xE7, 0x78,
+    0xA5, 0x02, 0x8C, 0x52, 0x81, 0x54, 0x7E, 0x52, 0x83, 0x14, 0xB8, 0xA5, 0xC5, 0x28, 0x14, 0x16,
+    0x84, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x31, 0x4A, 0x05, 0x18, 0xA7, 0x01, 0x48,
+    0xA4, 0x26, 0x29, 0x71, 0x4B, 0x8A, 0x50, 0x28, 0x2D, 0x08, 0x05, 0x38, 0x0A, 0x00, 0xA5, 0xC5,
+    0x05, 0xA0, 0xC5, 0x59, 0xB0, 0xD4, 0x2E, 0x6D, 0xDB, 0x75, 0x95, 0xC4, 0x90, 0xBF, 0xF7, 0x94,
+    0xFD, 0xE0, 0x08, 0xE1, 0xC7, 0x70, 0x48, 0xE8, 0x72, 0x3D, 0x6A, 0x0C, 0x52, 0x81, 0x53, 0x38,
+    0xA7, 0xA5, 0x48, 0xC5, 0xAD, 0xA4, 0x9F, 0x53, 0x48, 0xBE, 0xCD, 0xF9, 0x1D, 0xDE, 0x8F, 0xF1,
+    0x4A, 0x75, 0xC0, 0xD5, 0xAD, 0x56, 0x45, 0xC0, 0x5F, 0x3E, 0x1E, 0x1B, 0x20, 0x1E, 0x5D, 0x09,
+    0xC1, 0xDE, 0x71, 0xD0, 0xA8, 0x1F, 0xA5, 0x76, 0x1A, 0x5F, 0x8B, 0xF4, 0x9B, 0x9C, 0x79, 0x17,
+    0xD1, 0xAB, 0x9C, 0x01, 0x04, 0x9F, 0x29, 0xDF, 0x27, 0x65, 0x0D, 0xD4, 0x83, 0xC7, 0x04, 0xD7,
+    0x8A, 0xE2, 0x94, 0x0A, 0xF9, 0x5C, 0x7F, 0x0E, 0x61, 0xE5, 0xAD, 0x05, 0x3A, 0x6F, 0xCB, 0x6F,
+    0xB9, 0xFE, 0x96, 0x3D, 0x2A, 0x38, 0xD9, 0xAF, 0x8D, 0xA6, 0x7D, 0x05, 0x45, 0x78, 0x35, 0xA6,
+    0xA1, 0x75, 0x0E, 0x7E, 0xC9, 0x77, 0x71, 0x0E, 0x7F, 0xD6, 0x79, 0x6C, 0x46, 0xFD, 0xBF, 0xDE,
+    0xDA, 0x7B, 0x66, 0xB5, 0xE2, 0xF1, 0xCE, 0xB8, 0xA0, 0x05, 0xD4, 0x98, 0x80, 0x36, 0xA9, 0x64,
+    0x42, 0x48, 0x03, 0xF8, 0x98, 0xAF, 0xF5, 0xCD, 0x7C, 0xDD, 0x7E, 0x15, 0xAB, 0xFF, 0x00, 0x30,
+    0xD8, 0xCA, 0x0F, 0xD6, 0xEB, 0xF2, 0xE6, 0x3B, 0xA1, 0x8F, 0x8F, 0xDB, 0xA7, 0x25, 0xFD, 0x7C,
+    0x8F, 0x62, 0xA2, 0xBC, 0x83, 0xFE, 0x13, 0xCD, 0x77, 0xFE, 0x82, 0x3F, 0xF9, 0x0D, 0x3F, 0xF8,
+    0x9A, 0x5F, 0xF8, 0x4F, 0x35, 0xDF, 0xFA, 0x08, 0xFF, 0x00, 0xE4, 0x34, 0xFF, 0x00, 0xE2, 0x6B,
+    0x0F, 0xF5, 0x5B, 0x11, 0xFF, 0x00, 0x3F, 0xF0, 0x7F, 0x7C, 0xBF, 0xF9, 0x13, 0x4F, 0xAE, 0xC3,
+    0xF9, 0x6A, 0x7E, 0x1F, 0xE6, 0x7A, 0xF5, 0x47, 0x3D, 0xC4, 0x51, 0x82, 0x6E, 0x25, 0x8E, 0x34,
+    0x1F, 0x7E, 0x47, 0x20, 0x05, 0xC9, 0xEE, 0xC7, 0xD4, 0xD7, 0x8F, 0x5D, 0x78, 0xB7, 0x58, 0x97,
+    0x1E, 0x6E, 0xA7, 0x70, 0x31, 0xF7, 0x7C, 0xBF, 0x97, 0x39, 0xFE, 0xF7, 0x97, 0x8C, 0xFE, 0x35,
+    0x96, 0xEE, 0xEC, 0x49, 0x91, 0xD9, 0x98, 0xFC, 0xF2, 0x3B, 0x1E, 0x5D, 0x8F, 0x76, 0x27, 0xD4,
+    0xD7, 0x5E, 0x1F, 0x85, 0x67, 0xFF, 0x00, 0x31, 0x78, 0xEA, 0x6B, 0xBA, 0x49, 0xBF, 0xC5, 0xDB,
+    0xF2, 0x22, 0x58, 0xD5, 0xF6, 0x29, 0xB3, 0xD4, 0xB5, 0x2F, 0x88, 0x3A, 0x54, 0x39, 0x10, 0x3C,
+    0x97, 0x2F, 0xCA, 0xE2, 0x31, 0xC0, 0x75, 0xFE, 0xF4, 0x8D, 0x8E, 0x18, 0xF7, 0x1B, 0xAB, 0x90,
+    0xD5, 0x7C, 0x7B, 0xAA, 0x4F, 0xC4, 0x4E, 0xB6, 0xA9, 0xC9, 0x02, 0x2C, 0xEE, 0x2B, 0x91, 0x8D,
+    0xF2, 0xFF, 0x00, 0xB3, 0x8E, 0xDB, 0x73, 0xDE, 0xB9, 0xB0, 0x29, 0xD8, 0xAF, 0xAA, 0xC0, 0x64,
+    0x58, 0x68, 0x6D, 0x47, 0x9D, 0xEE, 0xA5, 0x2D, 0x7F, 0x0D, 0xBF, 0x03, 0x96, 0xA6, 0x22, 0x4F,
+    0xED, 0x5B, 0xD0, 0x4C, 0x52, 0x81, 0x4B, 0x8A, 0x50, 0x2B, 0xE8, 0x8C, 0x10, 0x98, 0xA7, 0x62,
+    0x8C, 0x52, 0x81, 0x41, 0x68, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x13, 0x14, 0xA0,
+    0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x41, 0x8A, 0x5C, 0x51, 0x8A, 0x50, 0x29, 0x16, 0x80, 0x0A, 0x50,
+    0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA1, 0x31, 0x4E, 0x02, 0x8C, 0x52, 0x81, 0x41, 0x68, 0x31, 0x4B,
+    0x8A, 0x31, 0x4E, 0x02, 0x82, 0xD0, 0x80, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x06, 0x29,
+    0x40, 0xA3, 0x14, 0xA0, 0x50, 0x52, 0x0C, 0x52, 0xE2, 0x97, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A,
+    0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28, 0x14, 0x62, 0x9C, 0x05, 0x05, 0xA1, 0x31,
+    0x4B, 0x8A, 0x5C, 0x52, 0x81, 0x41, 0x68, 0x40, 0x29, 0xC0, 0x50, 0x05, 0x2E, 0x28, 0x2D, 0x06,
+    0x29, 0x40, 0xA3, 0x14, 0xE0, 0x28, 0x2D, 0x09, 0x8A, 0x5C, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x40,
+    0x05, 0x28, 0x14, 0x01, 0x4B, 0x8A, 0x0B, 0x47, 0x9D, 0xE2, 0x94, 0x0A, 0x5C, 0x52, 0x81, 0x4C,
+    0xFC, 0xA5, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x01, 0x4B, 0x8A, 0x00, 0xA7,
+    0x62, 0x82, 0x90, 0x98, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x50, 0x5A, 0x10, 0x0A, 0x70, 0x14, 0x01,
+    0x4B, 0x8A, 0x0B, 0x40, 0x05, 0x2E, 0x28, 0x02, 0x9D, 0x8A, 0x0B, 0x42, 0x62, 0x94, 0x0A, 0x5C,
+    0x52, 0x81, 0x41, 0x68, 0x00, 0xA5, 0x02, 0x80, 0x29, 0x71, 0x41, 0x68, 0x00, 0xA5, 0xC5, 0x28,
+    0x14, 0xB8, 0xA0, 0xB4, 0x26, 0x29, 0xC0, 0x51, 0x8A, 0x50, 0x29, 0x16, 0x80, 0x0A, 0x50, 0x28,
+    0x02, 0x9D, 0x8A, 0x0B, 0x42, 0x01, 0x4B, 0x8A, 0x50, 0x29, 0x71, 0x41, 0x48, 0x4C, 0x53, 0x80,
+    0xA3, 0x14, 0xA0, 0x50, 0x5A, 0x00, 0x29, 0x40, 0xA5, 0x02, 0x97, 0x14, 0x16, 0x84, 0x02, 0x97,
+    0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x62, 0x94, 0x0A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02, 0x94,
+    0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x40, 0x29, 0xD8, 0xA0, 0x0A, 0x5C, 0x50, 0x5A, 0x0C, 0x52,
+    0x81, 0x46, 0x29, 0xC0, 0x50, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA1, 0x00,
+    0xA7, 0x62, 0x80, 0x29, 0x71, 0x41, 0x68, 0x31, 0x4A, 0x05, 0x2E, 0x29, 0x40, 0xA0, 0xA4, 0x20,
+    0x14, 0xA0, 0x52, 0x81, 0x4B, 0x8A, 0x45, 0xA0, 0x02, 0x97, 0x14, 0x01, 0x4B, 0x8A, 0x0B, 0x41,
+    0x8A, 0x50, 0x29, 0x71, 0x4A, 0x05, 0x05, 0xA1, 0x00, 0xA7, 0x01, 0x40, 0x14, 0xB8, 0xA0, 0xB4,
+    0x00, 0x52, 0xE2, 0x80, 0x29, 0xD8, 0xA0, 0xB4, 0x26, 0x29, 0x40, 0xA5, 0xC5, 0x28, 0x14, 0x16,
+    0x80, 0x0A, 0x50, 0x28, 0x02, 0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x52, 0x81, 0x4B, 0x8A, 0x0B,
+    0x47, 0x9D, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x55, 0x1F, 0x94, 0xA0, 0xC5, 0x2E, 0x28, 0xC5,
+    0x3B, 0x14, 0x8A, 0x42, 0x01, 0x4B, 0x8A, 0x50, 0x2B, 0xD1, 0xB5, 0xBD, 0x2A, 0xC9, 0x74, 0x4B,
+    0x59, 0x23, 0xB1, 0xB5, 0x5B, 0x86, 0x99, 0xA2, 0x9E, 0xF1, 0x50, 0x6F, 0x96, 0x30, 0xF7, 0x1C,
+    0x49, 0x28, 0x19, 0x20, 0x60, 0x77, 0xED, 0x51, 0x39, 0x5A, 0xD7, 0x5B, 0xBE, 0x53, 0x68, 0x2F,
+    0x3F, 0xEF, 0x1E, 0x72, 0x05, 0x38, 0x0A, 0xF7, 0x2D, 0x6F, 0xC3, 0xBA, 0x52, 0xEB, 0x76, 0xD1,
+    0xC7, 0xA4, 0x69, 0xEB, 0x6E, 0xD0, 0xB4, 0x93, 0xD9, 0xAC, 0x4B, 0xB2, 0x59, 0x02, 0x5C, 0x73,
+    0x24, 0x40, 0x60, 0x91, 0x81, 0xDB, 0xB5, 0x64, 0xE8, 0x5A, 0x26, 0x9C, 0xDF, 0xDB, 0x3E, 0x66,
+    0x9B, 0x64, 0xDE, 0x5F, 0x99, 0xFD, 0x9B, 0xBA, 0x35, 0xFF, 0x00, 0x41, 0xDB, 0xF6, 0x9C, 0x7D,
+    0x97, 0x23, 0x8D, 0xBB, 0x47, 0x4C, 0x74, 0x15, 0x8A, 0xAE, 0xBF, 0x95, 0xEC, 0xA5, 0xF7, 0xBB,
+    0x1D, 0x1E, 0xC9, 0xFF, 0x00, 0x32, 0xFE, 0x5F, 0xC2, 0xE7, 0x92, 0x62, 0x97, 0x15, 0xE8, 0x9A,
+    0xD6, 0x95, 0x64, 0xBA, 0x25, 0xB3, 0xC7, 0x63, 0x6A, 0xB7, 0x0D, 0x33, 0x47, 0x3D, 0xE2, 0xA0,
+    0xDF, 0x2C, 0x61, 0xEE, 0x38, 0x92, 0x50, 0x32, 0x40, 0xC0, 0xEF, 0xDA, 0xBA, 0xED, 0x6B, 0xC3,
+    0xBA, 0x52, 0xEB, 0x76, 0xC9, 0x1E, 0x91, 0xA7, 0xAD, 0xBB, 0x42, 0xD2, 0x4F, 0x66, 0xB1, 0x2E,
+    0xC9, 0x64, 0x09, 0x71, 0xCC, 0x91, 0x01, 0x82, 0x46, 0x07, 0x6E, 0xD4, 0xDD, 0x65, 0xFC, 0xAF,
+    0xAF, 0xE0, 0x35, 0x4F, 0xCD, 0x74, 0xFC, 0x4F, 0x0E, 0x02, 0x97, 0x15, 0xEB, 0x5A, 0x16, 0x89,
+    0xA7, 0x37, 0xF6, 0xC7, 0x99, 0xA6, 0xD9, 0x37, 0x97, 0xE6, 0x7F, 0x66, 0xEE, 0x8D, 0x7F, 0xD0,
+    0x76, 0xFD, 0xA7, 0x1F, 0x65, 0xC8, 0xE3, 0x6E, 0xD1, 0xD3, 0x1D, 0x05, 0x65, 0x6B, 0x5A, 0x5D,
+    0x9A, 0xE8, 0xB6, 0xCF, 0x1D, 0x95, 0xAA, 0xDC, 0x34, 0xCD, 0x1C, 0xF7, 0x81, 0x06, 0xF9, 0x63,
+    0x0F, 0x71, 0xC4, 0x92, 0x81, 0x92, 0x06, 0x07, 0x7E, 0xD4, 0xD5, 0x55, 0xFC, 0xAF, 0x75, 0x1F,
+    0xBD, 0x5C, 0xAE, 0x4F, 0x3F, 0x33, 0xCF, 0x00, 0xA5, 0x02, 0xBD, 0xBB, 0x5A, 0xF0, 0xF6, 0x94,
+    0xBA, 0xD5, 0xB2, 0x47, 0xA4, 0xE9, 0xEB, 0x6E, 0xD0, 0xB4, 0x93, 0xD9, 0xAC, 0x4B, 0xB2, 0x59,
+    0x02, 0xDC, 0x73, 0x24, 0x40, 0x60, 0x91, 0x81, 0xDB, 0xB5, 0x65, 0x68, 0x7A, 0x2E, 0x9E, 0xDF,
+    0xDB, 0x1E, 0x66, 0x9B, 0x64, 0xDE, 0x5F, 0x99, 0xFD, 0x9B, 0xBA, 0x35, 0xFF, 0x00, 0x42, 0xDB,
+    0xF6, 0x8C, 0x7D, 0x97, 0x23, 0x8D, 0xB8, 0x1D, 0x31, 0xD2, 0xA5, 0x57, 0x5F, 0xCA, 0xF6, 0x52,
+    0xFB, 0xDD, 0x8B, 0xE4, 0xF3, 0x5D, 0x8F, 0x27, 0xC5, 0x2E, 0x2B, 0xD0, 0xB5, 0x9D, 0x2E, 0xCD,
+    0x74, 0x5B, 0x67, 0x8E, 0xCA, 0xD9, 0x6E, 0x1A, 0x56, 0x8E, 0x7B, 0xC0, 0x83, 0x7C, 0xA8, 0x1A,
+    0xE3, 0x89, 0x25, 0x03, 0x38, 0x18, 0x1D, 0xFB, 0x57, 0x59, 0xAC, 0xF8, 0x7F, 0x4B, 0x5D, 0x6A,
+    0xD9, 0x23, 0xD2, 0x6C, 0x16, 0xDD, 0xA2, 0x69, 0x27, 0xB3, 0x11, 0x2E, 0xC9, 0x5C, 0x2D, 0xC7,
+    0x32, 0x44, 0x06, 0x32, 0x30, 0x3B, 0x76, 0xA6, 0xEB, 0x2F, 0xE5, 0x7D, 0x7F, 0x02, 0x94, 0x7C,
+    0xFB, 0x7E, 0x27, 0x89, 0x01, 0x4E, 0xC5, 0x7A, 0xB6, 0x87, 0xA2, 0xE9, 0xED, 0xFD, 0xAF, 0xE6,
+    0x69, 0xD6, 0x6D, 0xE5, 0xF9, 0x9F, 0xD9, 0xDB, 0xA3, 0x5F, 0xF4, 0x2D, 0xBF, 0x68, 0xC7, 0xD9,
+    0x72, 0x38, 0xDB, 0x81, 0xD3, 0x1D, 0x2B, 0x2B, 0x59, 0xD3, 0x2C, 0xD7, 0x46, 0xB6, 0x78, 0xEC,
+    0xAD, 0x96, 0xE1, 0xA5, 0x68, 0xE7, 0xBB, 0x08, 0x37, 0xCA, 0x81, 0xAE, 0x38, 0x92, 0x50, 0x33,
+    0x81, 0x81, 0xDF, 0xB5, 0x35, 0x55, 0x7F, 0x2B, 0xDD, 0x47, 0xEF, 0x57, 0x2B, 0x97, 0xCF, 0xCC,
+    0xF3, 0xF0, 0x29, 0x40, 0xAF, 0x6B, 0xD6, 0x7C, 0x3F, 0xA5, 0xAE, 0xB3, 0x6C, 0x91, 0xE9, 0x56,
+    0x0B, 0x6E, 0xD1, 0x34, 0x93, 0xDA, 0x08, 0xD7, 0x64, 0xAE, 0x16, 0x7E, 0x64, 0x88, 0x0C, 0x64,
+    0x60, 0x76, 0xED, 0x59, 0x5A, 0x26, 0x8D, 0xA7, 0xB7, 0xF6, 0xBF, 0x99, 0xA7, 0x59, 0xB7, 0x97,
+    0xE6, 0x7F, 0x67, 0x6E, 0x8D, 0x7F, 0xD0, 0xB6, 0xFD, 0xA3, 0x1F, 0x66, 0xC8, 0xE3, 0x6E, 0x07,
+    0x4C, 0x74, 0xA8, 0x55, 0xD7, 0xF2, 0xBD, 0x94, 0xBE, 0xF7, 0x62, 0xF9, 0x7C, 0xFC, 0x8F, 0x2A,
+    0xC5, 0x2E, 0x2B, 0xD0, 0x35, 0x8D, 0x32, 0xCD, 0x74, 0x6B, 0x67, 0x8E, 0xCA, 0xD9, 0x67, 0x32,
+    0xB4, 0x73, 0xDD, 0x84, 0x1B, 0xE5, 0x40, 0xD3, 0xF1, 0x24, 0xA0, 0x67, 0x03, 0x03, 0xBF, 0x6A,
+    0xEA, 0xB5, 0x8D, 0x03, 0x4B, 0x5D, 0x66, 0xD9, 0x23, 0xD2, 0xAC, 0x16, 0x03, 0x13, 0x49, 0x35,
+    0xA0, 0x8D, 0x76, 0x4A, 0xE1, 0x67, 0xE6, 0x48, 0x80, 0xC6, 0x46, 0x07, 0x6E, 0xD4, 0xDD, 0x65,
+    0xFC, 0xAF, 0xAF, 0xE0, 0x34, 0x8F, 0x16, 0x02, 0x9D, 0x8A, 0xF5, 0x3D, 0x13, 0x46, 0xD3, 0xDB,
+    0xFB, 0x5F, 0xCC, 0xD3, 0xAC, 0xDB, 0xCB, 0xF3, 0x3F, 0xB3, 0xB7, 0x46, 0xBF, 0xE8, 0x5B, 0x7E,
+    0xD1, 0x8F, 0xB3, 0x64, 0x71, 0xB7, 0x03, 0xA6, 0x3A, 0x56, 0x5E, 0xB1, 0xA6, 0x59, 0xAE, 0x8F,
+    0x6C, 0xF1, 0xD9, 0xDB, 0x2C, 0xE6, 0x56, 0x8E, 0x6B, 0xB0, 0x83, 0x7C, 0xA8, 0x1A, 0x7E, 0x24,
+    0x94, 0x0C, 0xE0, 0x60, 0x77, 0xED, 0x4D, 0x55, 0x5F, 0xCA, 0xF7, 0x51, 0xFB, 0xD5, 0xCB, 0x47,
+    0x02, 0x05, 0x28, 0x15, 0xEC, 0xFA, 0xC6, 0x81, 0xA6, 0x2E, 0xB1, 0x6C, 0x91, 0xE9, 0x56, 0x0B,
+    0x01, 0x89, 0xA4, 0x9A, 0xD0, 0x46, 0xBB, 0x25, 0x70, 0xB3, 0xF2, 0xF1, 0x01, 0x8C, 0x8C, 0x0E,
+    0xDD, 0xAB, 0x2F, 0x45, 0xD1, 0xAC, 0x1B, 0xFB, 0x5B, 0xCC, 0xD3, 0xEC, 0xDB, 0xCB, 0xF3, 0x3F,
+    0xB3, 0xB2, 0x8B, 0xFE, 0x87, 0xB7, 0xED, 0x18, 0xFB, 0x36, 0x47, 0x18, 0xC0, 0xE9, 0x8E, 0x95,
+    0x2A, 0xBA, 0xFE, 0x57, 0xB2, 0x97, 0xDE, 0xEC, 0x52, 0x3C, 0xB7, 0x14, 0xB8, 0xAE, 0xFB, 0x57,
+    0xD3, 0x6D, 0x17, 0x47, 0xB7, 0x78, 0xEC, 0xED, 0x96, 0x73, 0x2B, 0x47, 0x35, 0xD8, 0x41, 0xBA,
+    0x54, 0x0D, 0x3F, 0x0F, 0x2E, 0x33, 0x81, 0x81, 0xDF, 0xB5, 0x75, 0x1A, 0xC6, 0x83, 0xA6, 0x2E,
+    0xB1, 0x6E, 0x91, 0xE9, 0x76, 0x2B, 0x01, 0x89, 0xA4, 0x9A, 0xD0, 0x46, 0xBB, 0x65, 0x70, 0xB3,
+    0xF2, 0xF1, 0x63, 0x19, 0x18, 0x1D, 0xA9, 0xBA, 0xCB, 0xF9, 0x5F, 0x5F, 0xC0, 0xA4, 0x78, 0xD8,
+    0x14, 0xB8, 0xAF, 0x50, 0xD1, 0x74, 0x7B, 0x06, 0xFE, 0xD6, 0xF3, 0x34, 0xFB, 0x46, 0xF2, 0xFC,
+    0xCF, 0xEC, 0xFC, 0xA2, 0xFF, 0x00, 0xA1, 0xED, 0xFB, 0x46, 0x3E, 0xCD, 0x91, 0xC6, 0x30, 0x3A,
+    0x63, 0xA5, 0x66, 0x6A, 0xFA, 0x6D, 0xA2, 0xE9, 0x16, 0xEE, 0x96, 0x76, 0xCB, 0x39, 0x95, 0xA3,
+    0x9A, 0xEC, 0x20, 0xDD, 0x2A, 0x06, 0x9F, 0x87, 0x97, 0x19, 0xC0, 0xC0, 0xEF, 0x4F, 0xDA, 0xAF,
+    0xE5, 0x7B, 0xA8, 0xFD, 0xEA, 0xE5, 0xA6, 0x70, 0x60, 0x52, 0x81, 0x5E, 0xC7, 0xAB, 0xE8, 0x3A,
+    0x6A, 0xEA, 0xF6, 0xE9, 0x1E, 0x97, 0x62, 0xB0, 0x18, 0x8C, 0x93, 0x5A, 0x08, 0xD7, 0x6C, 0xAE,
+    0x16, 0x7E, 0x5E, 0x2C, 0x63, 0x23, 0x03, 0xB5, 0x66, 0x68, 0xDA, 0x3D, 0x83, 0x7F, 0x6A, 0xF9,
+    0x9A, 0x7D, 0xA3, 0x79, 0x7E, 0x67, 0xF6, 0x7E, 0x51, 0x7F, 0xD0, 0xF6, 0xF9, 0xFF, 0x00, 0xF1,
+    0xED, 0x91, 0xC6, 0x30, 0x3A, 0x63, 0xA5, 0x4A, 0xAE, 0xBF, 0x95, 0xEC, 0xA5, 0xF7, 0xBB, 0x14,
+    0x99, 0xE6, 0x18, 0xA7, 0x62, 0xBB, 0xAD, 0x5B, 0x4D, 0xB4, 0x5D, 0x22, 0xDD, 0xD2, 0xCE, 0xDD,
+    0x67, 0x32, 0x98, 0xE6, 0xBA, 0x0A, 0x37, 0x4A, 0x81, 0xA7, 0xE1, 0xE5, 0xC6, 0x70, 0x30, 0x3B,
+    0xD7, 0x51, 0xAB, 0xE8, 0x5A, 0x6A, 0xEA, 0xF6, 0xE8, 0x9A, 0x65, 0x8A, 0xC0, 0x62, 0x32, 0x4D,
+    0x6A, 0x23, 0x5D, 0xB2, 0xB8, 0x59, 0xF9, 0x78, 0xB1, 0x8C, 0x8C, 0x0E, 0xD4, 0xDD, 0x65, 0xFC,
+    0xAF, 0xAF, 0xE0, 0x57, 0x31, 0xE3, 0xC0, 0x52, 0xE2, 0xBD, 0x37, 0x46, 0xD2, 0x2C, 0x5B, 0xFB,
+    0x57, 0xCC, 0xB0, 0xB4, 0x6F, 0x2F, 0xCC, 0xFE, 0xCF, 0xCA, 0x2F, 0xFA, 0x1E, 0xDF, 0x3F, 0xFE,
+    0x3D, 0xB8, 0xE3, 0x18, 0x1D, 0x31, 0xD2, 0xB3, 0x75, 0x6D, 0x3A, 0xD1, 0x74, 0x8B, 0x77, 0x4B,
+    0x4B, 0x75, 0x9C, 0xCA, 0x63, 0x9A, 0xE8, 0x28, 0xDD, 0x22, 0x06, 0x9F, 0x87, 0x93, 0x19, 0xC0,
+    0xC0, 0xEF, 0x4F, 0xDA, 0xFF, 0x00, 0x75, 0xEE, 0xA3, 0xF7, 0xAB, 0x96, 0xA5, 0xFE, 0x47, 0x0A,
+    0x05, 0x28, 0x15, 0xEB, 0xFA, 0xB6, 0x87, 0xA6, 0xAE, 0xAD, 0x6E, 0x89, 0xA6, 0x58, 0xAC, 0x06,
+    0x23, 0x24, 0xD6, 0xA2, 0x35, 0xDB, 0x23, 0x85, 0x9F, 0x97, 0x8F, 0x18, 0xC8, 0xC0, 0xED, 0x59,
+    0xBA, 0x3E, 0x91, 0x62, 0xDF, 0xDA, 0x9E, 0x65, 0x85, 0xA3, 0x6C, 0xF3, 0x3E, 0xC1, 0x94, 0x5F,
+    0xF4, 0x3D, 0xBE, 0x7F, 0xFC, 0x7B, 0xF1, 0xC6, 0x30, 0x3A, 0x63, 0xA5, 0x4F, 0xB7, 0x5F, 0xCA,
+    0xF6, 0x52, 0xFB, 0xDD, 0x86, 0xA7, 0xE5, 0xE6, 0x79, 0x9E, 0x29, 0xD8, 0xAE, 0xE3, 0x55, 0xD3,
+    0xAD, 0x57, 0x49, 0xB7, 0x74, 0xB4, 0xB7, 0x59, 0xCC, 0xA6, 0x39, 0xAE, 0x82, 0x8D, 0xD2, 0x20,
+    0x69, 0xF8, 0x79, 0x31, 0x9C, 0x0C, 0x0E, 0xF5, 0xD3, 0x6A, 0xDA, 0x1E, 0x9C, 0xBA, 0xB5, 0xBA,
+    0x26, 0x99, 0x64, 0xB0, 0x18, 0x8C, 0x93, 0x5A, 0x88, 0xD7, 0x6C, 0x8E, 0x16, 0x7E, 0x5E, 0x3C,
+    0x63, 0x23, 0x03, 0xB5, 0x37, 0x59, 0x7F, 0x2B, 0xEB, 0xF8, 0x17, 0xCF, 0xE5, 0xDF, 0xF0, 0x3C,
+    0x88, 0x0A, 0x5C, 0x57, 0xA5, 0x68, 0xFA, 0x4D, 0x8B, 0x7F, 0x6A, 0x6F, 0xB0, 0xB4, 0x6D, 0x9E,
+    0x67, 0xD8, 0x32, 0x83, 0xFD, 0x13, 0x6F, 0x9F, 0xFF, 0x00, 0x1E, 0xFC, 0x71, 0x8C, 0x0E, 0x98,
+    0xAC, 0xED, 0x57, 0x4E, 0xB5, 0x5D, 0x26, 0xDD, 0xD2, 0xD2, 0xDD, 0x66, 0x32, 0x98, 0xE6, 0xBA,
+    0x0A, 0x37, 0x48, 0x81, 0xA6, 0xE1, 0xE4, 0xC6, 0x70, 0x30, 0x3B, 0xD3, 0xF6, 0xBF, 0xDD, 0x7B,
+    0xA8, 0xFD, 0xEA, 0xE5, 0xA9, 0xF9, 0x79, 0x1C, 0x38, 0x14, 0xA0, 0x57, 0xAE, 0x6A, 0xBA, 0x26,
+    0x9C, 0xBA, 0xAD, 0xBA, 0x26, 0x9B, 0x64, 0xB0, 0x98, 0x8C, 0x93, 0x5A, 0x88, 0xD7, 0x6C, 0x8E,
+    0x16, 0x6E, 0x5E, 0x3C, 0x63, 0x23, 0x03, 0xB5, 0x66, 0xE9, 0x1A, 0x4D, 0x93, 0x7F, 0x6A, 0x6F,
+    0xB1, 0xB5, 0x6D, 0x9E, 0x67, 0xD8, 0x32, 0x83, 0xFD, 0x13, 0x6F, 0x9F, 0xFF, 0x00, 0x1E, 0xFC,
+    0x71, 0x8C, 0x0E, 0x98, 0xA9, 0xF6, 0xEB, 0xF9, 0x5E, 0xCA, 0x5F, 0x7B, 0xB0, 0xD5, 0x4F, 0x27,
+    0xDC, 0xF3, 0x7C, 0x52, 0xE2, 0xBB, 0x6D, 0x57, 0x4F, 0xB5, 0x5D, 0x2A, 0x07, 0x4B, 0x4B, 0x75,
+    0x98, 0xC8, 0x63, 0x9A, 0xE8, 0x28, 0xDD, 0x22, 0x06, 0x9B, 0x87, 0x93, 0x19, 0xE3, 0x03, 0xBD,
+    0x74, 0x9A, 0xAE, 0x89, 0xA7, 0x2E, 0xAB, 0x02, 0x26, 0x9B, 0x64, 0xB0, 0x98, 0xCB, 0xCD, 0x6C,
+    0x23, 0x5D, 0xB2, 0x38, 0x59, 0xB9, 0x78, 0xF1, 0x8E, 0xC3, 0xB5, 0x37, 0x59, 0x7F, 0x2B, 0xEB,
+    0xF8, 0x17, 0xED, 0x3C, 0x9F, 0x5F, 0xC0, 0xF2, 0x60, 0x29, 0x71, 0x5E, 0x8F, 0xA4, 0x69, 0x56,
+    0x4D, 0xFD, 0xA7, 0xBE, 0xC6, 0xD5, 0xB6, 0x6F, 0xFB, 0x0E, 0x50, 0x7F, 0xA2, 0x6D, 0xF3, 0xFF,
+    0x00, 0xE3, 0xDF, 0x8E, 0x31, 0x81, 0xD3, 0x15, 0x9D, 0xAA, 0x69, 0xF6, 0xAB, 0xA5, 0x40, 0xE9,
+    0x69, 0x6E, 0xB3, 0x19, 0x0A, 0x4B, 0x72, 0x14, 0x6E, 0x91, 0x03, 0x4D, 0xC3, 0xC9, 0x8C, 0xF6,
+    0x1D, 0xE9, 0xFB, 0x5F, 0xEE, 0xBD, 0xD4, 0x7E, 0xF5, 0x72, 0xD5, 0x4F, 0x27, 0xFC, 0xBF, 0x85,
+    0xCE, 0x28, 0x0A, 0x70, 0x15, 0xEA, 0xFA, 0xA6, 0x8B, 0xA7, 0xAE, 0xA9, 0x02, 0x26, 0x9D, 0x66,
+    0xB0, 0x98, 0xCB, 0xCB, 0x6C, 0x23, 0x5D, 0xB2, 0x38, 0x59, 0xB9, 0x78, 0xF1, 0x8E, 0xC3, 0xB5,
+    0x67, 0x69, 0x3A, 0x55, 0x93, 0x7F, 0x69, 0xEF, 0xB1, 0xB5, 0x6D, 0x9B, 0xFE, 0xC3, 0x94, 0x1F,
+    0xE8, 0x9B, 0x7C, 0xFF, 0x00, 0xF8, 0xF7, 0xE3, 0x8C, 0x60, 0x74, 0xC5, 0x47, 0xB7, 0x5F, 0xCA,
+    0xF6, 0x52, 0xFB, 0xDD, 0x81, 0x56, 0x5F, 0xCA, 0xFA, 0x4B, 0xEF, 0x76, 0x3C, 0xEB, 0x14, 0xB8,
+    0xAE, 0xD3, 0x54, 0xD3, 0xED, 0x57, 0x4B, 0x81, 0xD2, 0xD6, 0x05, 0x98, 0xC8, 0x52, 0x5B, 0x90,
+    0xA3, 0x74, 0x88, 0x1A, 0x6E, 0x1E, 0x4C, 0x67, 0xB0, 0xEF, 0x5D, 0x16, 0xA9, 0xA3, 0x69, 0xEB,
+    0xAA, 0x40, 0x89, 0xA7, 0x59, 0xAC, 0x26, 0x32, 0xF2, 0xDB, 0x08, 0xD7, 0x6C, 0x8E, 0x16, 0x6E,
+    0x5E, 0x3C, 0x63, 0xB0, 0xED, 0x4D, 0xD6, 0x5F, 0xCA, 0xFA, 0xFE, 0x05, 0xFB, 0x65, 0xFC, 0xAF,
+    0xAF, 0xE0, 0x79, 0x50, 0x14, 0xB8, 0xAF, 0x44, 0xD2, 0x74, 0xBB, 0x26, 0xFE, 0xD2, 0xDF, 0x63,
+    0x6A, 0xDB, 0x37, 0xFD, 0x87, 0x28, 0x3F, 0xD1, 0x76, 0xF9, 0xDF, 0xEA, 0x38, 0xE3, 0x18, 0x1D,
+    0x31, 0x59, 0xFA, 0x9D, 0x85, 0xB2, 0xE9, 0x70, 0x3A, 0x5A, 0xC0, 0xB3, 0x19, 0x0A, 0x4B, 0x72,
+    0x14, 0x6E, 0x91, 0x03, 0x4D, 0xC3, 0xC9, 0x8C, 0xF6, 0x1D, 0xE9, 0xFB, 0x5F, 0xEE, 0xBD, 0xD4,
+    0x7E, 0xF5, 0x73, 0x45, 0x57, 0xFB, 0xAF, 0x75, 0x1F, 0xBD, 0x5C, 0xE3, 0x40, 0xA5, 0x02, 0xBD,
+    0x4F, 0x53, 0xD1, 0xB4, 0xF5, 0xD5, 0x20, 0x44, 0xD3, 0xAC, 0xD6, 0x13, 0x19, 0x79, 0x6D, 0x84,
+    0x6B, 0xB6, 0x47, 0x0B, 0x37, 0x2F, 0x1E, 0x31, 0xD8, 0x76, 0xAF, 0x2D, 0x02, 0xAA, 0x95, 0x4B,
+    0xEC, 0x9E, 0xDC, 0xDF, 0x9F, 0xF9, 0x1A, 0x51, 0xA9, 0x7D, 0x93, 0xDB, 0x9B, 0xF3, 0xFF, 0x00,
+    0x20, 0xC5, 0x2E, 0x29, 0x71, 0x4B, 0x8A, 0xD4, 0xE9, 0x42, 0x01, 0x4B, 0x8A, 0x50, 0x29, 0x40,
+    0xA0, 0xA4, 0x79, 0xDE, 0x29, 0x40, 0xA3, 0x14, 0xE0, 0x2A, 0x8F, 0xCA, 0x90, 0x98, 0xA5, 0xC5,
+    0x2E, 0x29, 0x40, 0xA0, 0xA4, 0x20, 0x15, 0xEA, 0x1A, 0xF7, 0xFC, 0x80, 0x2D, 0x3F, 0xEB, 0xB3,
+    0x7F, 0xE8, 0x77, 0x35, 0xE6, 0x20, 0x57, 0xA7, 0xEB, 0xDF, 0xF2, 0x00, 0xB4, 0xFF, 0x00, 0xAE,
+    0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0xD6, 0x15, 0xFA, 0x7A, 0xFE, 0x8C, 0xEA, 0xA3, 0xD7, 0xD3, 0xFC,
+    0x8E, 0xCF, 0x5E, 0xFF, 0x00, 0x90, 0xFD, 0xA7, 0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE6, 0xB1, 0xBC,
+    0x3D, 0xFF, 0x00, 0x31, 0xCF, 0xFB, 0x6B, 0xFF, 0x00, 0xB7, 0x55, 0xB5, 0xAF, 0x7F, 0xC8, 0x7A,
+    0xD3, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x73, 0x58, 0xDE, 0x1E, 0xFF, 0x00, 0x98, 0xE7, 0xFD, 0xB5,
+    0xFF, 0x00, 0xDB, 0xAA, 0xE0, 0x5B, 0x7C, 0x97, 0xFE, 0x94, 0x77, 0x3D, 0xFE, 0x6F, 0xF2, 0x31,
+    0x75, 0xEF, 0xF9, 0x00, 0xDA, 0x7F, 0xD7, 0x66, 0xFF, 0x00, 0xD0, 0xEE, 0x6B, 0xB3, 0xD7, 0xBF,
+    0xE4, 0x3D, 0x69, 0xFF, 0x00, 0x5C, 0x5B, 0xFF, 0x00, 0x40, 0xB9, 0xAE, 0x37, 0x5D, 0xFF, 0x00,
+    0x90, 0x0D, 0xA7, 0xFD, 0x76, 0x6F, 0xFD, 0x0E, 0xE6, 0xBB, 0x3D, 0x7B, 0xFE, 0x43, 0xD6, 0xBF,
+    0xF5, 0xC5, 0xBF, 0xF4, 0x0B, 0x9A, 0xA9, 0x75, 0xFF, 0x00, 0xB7, 0xC5, 0x1F, 0xFE, 0x44, 0xC6,
+    0xF0, 0xFF, 0x00, 0xFC, 0xC6, 0xFF, 0x00, 0xED, 0xAF, 0xFE, 0xDD, 0x56, 0x36, 0xBB, 0xFF, 0x00,
+    0x20, 0x1B, 0x5F, 0xFA, 0xEC, 0xDF, 0xFA, 0x1D, 0xCD, 0x6C, 0xF8, 0x7F, 0xFE, 0x63, 0x7F, 0xF6,
+    0xD7, 0xFF, 0x00, 0x6E, 0xAB, 0x1F, 0x5D, 0xFF, 0x00, 0x90, 0x15, 0xAF, 0xFD, 0x76, 0x6F, 0xFD,
+    0x0E, 0xE6, 0xAD, 0x6F, 0xF3, 0x5F, 0xFA, 0x48, 0x7F, 0x93, 0xFC, 0xCE, 0xCB, 0x5D, 0xFF, 0x00,
+    0x90, 0xF5, 0xAF, 0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE6, 0xB1, 0xBC, 0x3F, 0xFF, 0x00, 0x31, 0xBF,
+    0xFB, 0x6B, 0xFF, 0x00, 0xB7, 0x35, 0xB3, 0xAE, 0xFF, 0x00, 0xC8, 0x76, 0xD7, 0xFE, 0xB8, 0xB7,
+    0xFE, 0x81, 0x73, 0x58, 0xFE, 0x1F, 0xFF, 0x00, 0x98, 0xDF, 0xFD, 0xB5, 0xFF, 0x00, 0xDB, 0x9A,
+    0xC9, 0x6D, 0xF2, 0x5F, 0xFA, 0x51, 0xA7, 0xF9, 0xBF, 0xC8, 0xC6, 0xD7, 0x7F, 0xE4, 0x05, 0x6B,
+    0xFF, 0x00, 0x5D, 0x9B, 0xFF, 0x00, 0x43, 0xB9, 0xAE, 0xCB, 0x5D, 0xFF, 0x00, 0x90, 0xED, 0xAF,
+    0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE6, 0xB8, 0xED, 0x73, 0xFE, 0x40, 0x56, 0xBF, 0xF5, 0xD9, 0xBF,
+    0xF4, 0x3B, 0x9A, 0xEC, 0xB5, 0xDF, 0xF9, 0x0E, 0xDA, 0xFF, 0x00, 0xD7, 0x16, 0xFF, 0x00, 0xD0,
+    0x2E, 0x6A, 0xA5, 0xD7, 0xFE, 0xDF, 0x08, 0xFF, 0x00, 0x91, 0x8D, 0xA0, 0x7F, 0xCC, 0x6B, 0xFE,
+    0xDA, 0xFF, 0x00, 0xED, 0xCD, 0x64, 0x6B, 0x9F, 0xF2, 0x02, 0xB5, 0xFF, 0x00, 0xAE, 0xCD, 0xFF,
+    0x00, 0xA1, 0xDC, 0xD6, 0xC6, 0x81, 0xFF, 0x00, 0x31, 0xAF, 0xFB, 0x6B, 0xFF, 0x00, 0xB7, 0x35,
+    0x91, 0xAE, 0x7F, 0xC8, 0x0E, 0xD7, 0xFE, 0xBB, 0x37, 0xFE, 0x87, 0x71, 0x56, 0xB7, 0xF9, 0xAF,
+    0xFD, 0x24, 0x7F, 0xE4, 0xFF, 0x00, 0x33, 0xAF, 0xD7, 0x3F, 0xE4, 0x39, 0x6B, 0xFF, 0x00, 0x5C,
+    0x5B, 0xFF, 0x00, 0x40, 0xB8, 0xAC, 0x8D, 0x03, 0xFE, 0x63, 0x5F, 0xF6, 0xD7, 0xFF, 0x00, 0x6E,
+    0x6B, 0x63, 0x5C, 0xFF, 0x00, 0x90, 0xE5, 0xAF, 0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE2, 0xB2, 0x34,
+    0x0F, 0xF9, 0x8D, 0x7F, 0xDB, 0x5F, 0xFD, 0xB9, 0xAC, 0x96, 0xDF, 0x25, 0xFF, 0x00, 0xA5, 0x17,
+    0xFD, 0x7E, 0x06, 0x3E, 0xB9, 0xFF, 0x00, 0x20, 0x3B, 0x5F, 0xFA, 0xEC, 0xDF, 0xFA, 0x1D, 0xC5,
+    0x76, 0x1A, 0xE7, 0xFC, 0x87, 0x2D, 0x7F, 0xEB, 0x8B, 0x7F, 0xE8, 0x17, 0x15, 0xC8, 0x6B, 0x7F,
+    0xF2, 0x03, 0xB5, 0xFF, 0x00, 0xAE, 0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0x57, 0x5F, 0xAE, 0x7F, 0xC8,
+    0x72, 0xD7, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x71, 0x55, 0x2E, 0xBF, 0xF6, 0xF8, 0xD7, 0xF9, 0x19,
+    0x1A, 0x0F, 0xFC, 0xC6, 0xBF, 0xED, 0xAF, 0xFE, 0xDC, 0xD6, 0x46, 0xB7, 0xFF, 0x00, 0x20, 0x3B,
+    0x5F, 0xFA, 0xEC, 0xDF, 0xFA, 0x1D, 0xC5, 0x6C, 0x68, 0x3F, 0xF3, 0x19, 0xFF, 0x00, 0xB6, 0xBF,
+    0xFB, 0x73, 0x59, 0x1A, 0xDF, 0xFC, 0x81, 0x2D, 0x7F, 0xEB, 0xB3, 0x7F, 0xE8, 0x77, 0x15, 0x4B,
+    0x7F, 0x9A, 0xFF, 0x00, 0xD2, 0x46, 0x75, 0xDA, 0xDF, 0xFC, 0x86, 0xED, 0x7F, 0xEB, 0x8B, 0x7F,
+    0xE8, 0x17, 0x15, 0x93, 0xA0, 0xFF, 0x00, 0xCC, 0x67, 0xFE, 0xDA, 0xFF, 0x00, 0xED, 0xCD, 0x6B,
+    0xEB, 0x7F, 0xF2, 0x1B, 0xB5, 0xFF, 0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0x56, 0x46, 0x85,
+    0xFF, 0x00, 0x31, 0x9F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x35, 0x9A, 0xDB, 0xE4, 0xBF, 0xF4, 0xA2,
+    0x8C, 0x8D, 0x6B, 0xFE, 0x40, 0x96, 0xBF, 0xF5, 0xD9, 0xBF, 0xF4, 0x3B, 0x8A, 0xEB, 0xB5, 0xBF,
+    0xF9, 0x0D, 0xDB, 0x7F, 0xD7, 0x16, 0xFF, 0x00, 0xD0, 0x2E, 0x2B, 0x92, 0xD6, 0xBF, 0xE4, 0x09,
+    0x6D, 0xFF, 0x00, 0x5D, 0x9B, 0xFF, 0x00, 0x43, 0xB8, 0xAE, 0xBB, 0x5B, 0xFF, 0x00, 0x90, 0xDD,
+    0xB7, 0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE2, 0xAA, 0x5D, 0x7F, 0xED, 0xF1, 0xA3, 0x23, 0x42, 0xFF,
+    0x00, 0x98, 0xCF, 0xFD, 0xB4, 0xFF, 0x00, 0xDB, 0x9A, 0xC9, 0xD6, 0xBF, 0xE4, 0x09, 0x6D, 0xFF,
+    0x00, 0x5D, 0x9B, 0xFF, 0x00, 0x43, 0xB8, 0xAD, 0x7D, 0x0B, 0xFE, 0x63, 0x1F, 0xF6, 0xD3, 0xFF,
+    0x00, 0x6E, 0x6B, 0x2B, 0x5A, 0xFF, 0x00, 0x90, 0x2D, 0xB7, 0xFD, 0x76, 0x6F, 0xFD, 0x0E, 0xE2,
+    0xA9, 0x6F, 0xF3, 0x5F, 0xFA, 0x49, 0x48, 0xEB, 0x35, 0xAF, 0xF9, 0x0D, 0x5B, 0x7F, 0xD7, 0x16,
+    0xFF, 0x00, 0xD0, 0x6E, 0x2B, 0x27, 0x42, 0xFF, 0x00, 0x98, 0xC7, 0xFD, 0xB4, 0xFF, 0x00, 0xDB,
+    0x8A, 0xD6, 0xD6, 0xBF, 0xE4, 0x35, 0x6D, 0xFF, 0x00, 0x5C, 0x5B, 0xFF, 0x00, 0x41, 0xB8, 0xAC,
+    0xAD, 0x0F, 0xFE, 0x63, 0x1F, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B, 0x35, 0xB7, 0xC9, 0x7F, 0xE9,
+    0x43, 0x32, 0x75, 0x9F, 0xF9, 0x02, 0xDB, 0x7F, 0xD7, 0x56, 0xFF, 0x00, 0xD0, 0xAE, 0x2B, 0xAC,
+    0xD6, 0xBF, 0xE4, 0x35, 0x6D, 0xFF, 0x00, 0x5C, 0x9B, 0xFF, 0x00, 0x41, 0xB8, 0xAE, 0x53, 0x59,
+    0xFF, 0x00, 0x90, 0x2D, 0xB7, 0xFD, 0x75, 0x6F, 0xFD, 0x0A, 0xE2, 0xBA, 0xCD, 0x67, 0xFE, 0x43,
+    0x56, 0xDF, 0xF5, 0xC9, 0xBF, 0xF4, 0x1B, 0x8A, 0xA9, 0x75, 0xFF, 0x00, 0xB7, 0xC6, 0x64, 0xE8,
+    0x7F, 0xF3, 0x18, 0xFF, 0x00, 0xB6, 0x9F, 0xFB, 0x71, 0x59, 0x5A, 0xCF, 0xFC, 0x81, 0x6D, 0xBF,
+    0xEB, 0xAB, 0x7F, 0xE8, 0x57, 0x15, 0xAD, 0xA1, 0xFF, 0x00, 0xCC, 0x5F, 0xFE, 0xDA, 0x7F, 0xED,
+    0xC5, 0x65, 0x6B, 0x3F, 0xF2, 0x06, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x5C, 0x55,
+    0x2D, 0xFE, 0x6B, 0xFF, 0x00, 0x49, 0x2D, 0x1D, 0x5E, 0xB3, 0xFF, 0x00, 0x21, 0x9B, 0x6F, 0xFA,
+    0xE4, 0xDF, 0xFA, 0x0D, 0xC5, 0x65, 0x68, 0x9F, 0xF3, 0x17, 0xFF, 0x00, 0xB6, 0x9F, 0xFB, 0x71,
+    0x5A, 0xBA, 0xCF, 0xFC, 0x86, 0x6D, 0xBF, 0xEB, 0x93, 0x7F, 0xE8, 0x33, 0xD6, 0x5E, 0x89, 0xFF,
+    0x00, 0x31, 0x7F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0x92, 0xDB, 0xE4, 0xBF, 0xF4, 0xA0, 0x5F,
+    0xD7, 0xDE, 0x64, 0xEB, 0x1F, 0xF2, 0x06, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x4F,
+    0x5D, 0x5E, 0xB3, 0xFF, 0x00, 0x21, 0x9B, 0x6F, 0xFA, 0xE4, 0xDF, 0xFA, 0x0C, 0xF5, 0xCA, 0xEB,
+    0x1F, 0xF2, 0x06, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x4F, 0x5D, 0x56, 0xB1, 0xFF,
+    0x00, 0x21, 0x9B, 0x6F, 0xFA, 0xE4, 0xDF, 0xFA, 0x0C, 0xF5, 0x72, 0xEB, 0xFF, 0x00, 0x6F, 0x94,
+    0xFF, 0x00, 0xCC, 0xCA, 0xD1, 0x3F, 0xE6, 0x2F, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xE2, 0xB2, 0xF5,
+    0x8F, 0xF9, 0x03, 0xDB, 0x7F, 0xD7, 0x56, 0xFF, 0x00, 0xD0, 0xA7, 0xAD, 0x5D, 0x13, 0xFE, 0x62,
+    0xDF, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B, 0x2F, 0x58, 0xFF, 0x00, 0x90, 0x3D, 0xB7, 0xFD, 0x75,
+    0x6F, 0xFD, 0x0A, 0x7A, 0xA5, 0xBF, 0xCD, 0x7F, 0xE9, 0x25, 0x2F, 0xD5, 0x7E, 0x47, 0x53, 0xAC,
+    0x7F, 0xC8, 0x62, 0xDB, 0xFE, 0xB9, 0x37, 0xFE, 0x83, 0x3D, 0x65, 0xE8, 0xBF, 0xF3, 0x16, 0xFF,
+    0x00, 0xB6, 0x9F, 0xFB, 0x71, 0x5A, 0xBA, 0xC7, 0xFC, 0x86, 0x2D, 0xFF, 0x00, 0xEB, 0x93, 0x7F,
+    0xE8, 0x33, 0xD6, 0x5E, 0x8B, 0xFF, 0x00, 0x31, 0x6F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0x92,
+    0xDB, 0xE4, 0xBF, 0xF4, 0xA1, 0x2F, 0xD1, 0x7E, 0x66, 0x5E, 0xAF, 0xFF, 0x00, 0x20, 0x7B, 0x7F,
+    0xFA, 0xEA, 0xDF, 0xFA, 0x14, 0xF5, 0xD4, 0xEB, 0x1F, 0xF2, 0x18, 0xB7, 0xFF, 0x00, 0xAE, 0x4D,
+    0xFF, 0x00, 0xA0, 0xCF, 0x5C, 0xBE, 0xAF, 0xFF, 0x00, 0x20, 0x7B, 0x7F, 0xFA, 0xEA, 0xDF, 0xFA,
+    0x14, 0xF5, 0xD4, 0x6A, 0xFF, 0x00, 0xF2, 0x17, 0xB7, 0xFF, 0x00, 0xAE, 0x47, 0xFF, 0x00, 0x41,
+    0x9E, 0xAE, 0x5D, 0x7F, 0xED, 0xF2, 0xDF, 0xFF, 0x00, 0x24, 0x65, 0xE8, 0xBF, 0xF3, 0x16, 0xFF,
+    0x00, 0xB6, 0x9F, 0xFB, 0x71, 0x59, 0x9A, 0xBF, 0xFC, 0x82, 0x2D, 0xFF, 0x00, 0xEB, 0xAB, 0x7F,
+    0xE8, 0x53, 0xD6, 0xA6, 0x8D, 0xFF, 0x00, 0x31, 0x5F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0x99,
+    0xAB, 0xFF, 0x00, 0xC8, 0x22, 0xDF, 0xFE, 0xBA, 0x9F, 0xFD, 0x0A, 0x7A, 0xA5, 0xBF, 0xCD, 0x7F,
+    0xE9, 0x25, 0xAF, 0xD5, 0x7E, 0x47, 0x4F, 0xAB, 0xFF, 0x00, 0xC8, 0x5E, 0xDF, 0xFE, 0xB9, 0x1F,
+    0xFD, 0x06, 0x7A, 0xCC, 0xD1, 0xBF, 0xE6, 0x2B, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xBD, 0x69, 0xEA,
+    0xFF, 0x00, 0xF2, 0x17, 0xB7, 0xFF, 0x00, 0xAE, 0x47, 0xFF, 0x00, 0x41, 0x9E, 0xB3, 0x74, 0x6F,
+    0xF9, 0x8A, 0xFF, 0x00, 0xDB, 0x4F, 0xFD, 0xAF, 0x59, 0x2D, 0xBE, 0x4B, 0xFF, 0x00, 0x4A, 0x25,
+    0x6D, 0xF2, 0x5F, 0x99, 0x97, 0xAB, 0x7F, 0xC8, 0x22, 0xDF, 0xFE, 0xBA, 0x9F, 0xFD, 0x0A, 0x7A,
+    0xE9, 0xF5, 0x7F, 0xF9, 0x0B, 0xDB, 0xFF, 0x00, 0xD7, 0x23, 0xFF, 0x00, 0xA0, 0xCF, 0x5C, 0xCE,
+    0xAD, 0xFF, 0x00, 0x20, 0x8B, 0x7F, 0xFA, 0xEA, 0x7F, 0xF4, 0x29, 0xEB, 0xA7, 0xD5, 0xBF, 0xE4,
+    0x2D, 0x6F, 0xFF, 0x00, 0x5C, 0x8F, 0xFE, 0x83, 0x3D, 0x5C, 0xBA, 0xFF, 0x00, 0xDB, 0xE5, 0xCB,
+    0xFF, 0x00, 0x92, 0x33, 0x34, 0x6F, 0xF9, 0x8A, 0xFF, 0x00, 0xDB, 0x4F, 0xFD, 0xAF, 0x59, 0x9A,
+    0xB7, 0xFC, 0x82, 0x6D, 0xFF, 0x00, 0xEB, 0xA9, 0xFF, 0x00, 0xD0, 0xA7, 0xAD, 0x3D, 0x1F, 0xFE,
+    0x62, 0x9F, 0xF6, 0xD3, 0xFF, 0x00, 0x6B, 0xD6, 0x6E, 0xAD, 0xFF, 0x00, 0x20, 0x9B, 0x7F, 0xFA,
+    0xEA, 0x7F, 0xF4, 0x29, 0xEA, 0x96, 0xFF, 0x00, 0x35, 0xFF, 0x00, 0xA4, 0x9A, 0x47, 0x7F, 0x9A,
+    0xFF, 0x00, 0xD2, 0x4E, 0x9B, 0x56, 0xFF, 0x00, 0x90, 0xB5, 0xBF, 0xFD, 0x72, 0x3F, 0xFA, 0x0C,
+    0xF5, 0xE4, 0x40, 0x57, 0xAE, 0xEA, 0xDF, 0xF2, 0x16, 0xB7, 0xFF, 0x00, 0xAE, 0x47, 0xFF, 0x00,
+    0x41, 0x9E, 0xBC, 0x90, 0x0A, 0xD3, 0x0B, 0xFA, 0x2F, 0xCD, 0x9B, 0xE1, 0x3F, 0x45, 0xF9, 0xB1,
+    0x31, 0x4E, 0xC5, 0x18, 0xA5, 0x02, 0xBB, 0x0E, 0xF4, 0x00, 0x52, 0x81, 0x40, 0x14, 0xEC, 0x50,
+    0x52, 0x3C, 0xEB, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x67, 0xE5, 0x28, 0x40, 0x29, 0xC0, 0x50,
+    0x05, 0x2E, 0x28, 0x2D, 0x00, 0x15, 0xE9, 0xDA, 0xF7, 0xFC, 0x80, 0x6D, 0x3F, 0xEB, 0xB3, 0x7F,
+    0xE8, 0x77, 0x35, 0xE6, 0x60, 0x57, 0xA6, 0xEB, 0xBF, 0xF2, 0x01, 0xB4, 0xFF, 0x00, 0xAE, 0xCD,
+    0xFF, 0x00, 0xA1, 0xDC, 0xD6, 0x15, 0xFA, 0x7A, 0xFE, 0x8C, 0xEA, 0xA1, 0xD7, 0xD3, 0xF5, 0x47,
+    0x65, 0xAF, 0x7F, 0xC8, 0x7A, 0xD3, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x73, 0x58, 0xFE, 0x1E, 0xFF,
+    0x00, 0x98, 0xDF, 0xFD, 0xB5, 0xFF, 0x00, 0xDB, 0xAA, 0xD9, 0xD7, 0xBF, 0xE4, 0x3D, 0x6B, 0xFF,
+    0x00, 0x5C, 0x5B, 0xFF, 0x00, 0x40, 0xB9, 0xAC, 0x6F, 0x0F, 0xFF, 0x00, 0xCC, 0x6F, 0xFE, 0xDA,
+    0xFF, 0x00, 0xED, 0xD5, 0x70, 0xAD, 0xBE, 0x4B, 0xFF, 0x00, 0x4A, 0x3B, 0xDE, 0xFF, 0x00, 0x37,
+    0xF9, 0x18, 0xDA, 0xEF, 0xFC, 0x80, 0x6D, 0x7F, 0xEB, 0xB3, 0x7F, 0xE8, 0x77, 0x35, 0xD9, 0xEB,
+    0xBF, 0xF2, 0x1E, 0xB5, 0xFF, 0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0xD7, 0x1B, 0xAE, 0xFF,
+    0x00, 0xC8, 0x06, 0xD7, 0xFE, 0xBB, 0x37, 0xFE, 0x87, 0x73, 0x5D, 0x96, 0xBB, 0xFF, 0x00, 0x21,
+    0xDB, 0x5F, 0xFA, 0xE2, 0xDF, 0xFA, 0x05, 0xCD, 0x54, 0xBA, 0xFF, 0x00, 0xDB, 0xE2, 0x8F, 0xFF,
+    0x00, 0x22, 0x63, 0x78, 0x7F, 0xFE, 0x63, 0x7F, 0xF6, 0xD7, 0xFF, 0x00, 0x6E, 0x6B, 0x1F, 0x5D,
+    0xFF, 0x00, 0x90, 0x15, 0xAF, 0xFD, 0x76, 0x6F, 0xFD, 0x0E, 0xE6, 0xB6, 0x7C, 0x3F, 0xFF, 0x00,
+    0x31, 0xBF, 0xFB, 0x6B, 0xFF, 0x00, 0xB7, 0x35, 0x8F, 0xAE, 0x7F, 0xC8, 0x0A, 0xD7, 0xFE, 0xBB,
+    0x37, 0xFE, 0x87, 0x73, 0x54, 0xB7, 0xF9, 0xAF, 0xFD, 0x24, 0x3F, 0xC9, 0xFE, 0x67, 0x63, 0xAE,
+    0xFF, 0x00, 0xC8, 0x76, 0xD7, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x73, 0x58, 0xFA, 0x07, 0xFC, 0xC6,
+    0xFF, 0x00, 0xED, 0xAF, 0xFE, 0xDC, 0xD6, 0xCE, 0xBB, 0xFF, 0x00, 0x21, 0xDB, 0x5F, 0xFA, 0xE2,
+    0xDF, 0xFA, 0x05, 0xCD, 0x63, 0xE8, 0x1F, 0xF3, 0x1A, 0xFF, 0x00, 0xB6, 0xBF, 0xFB, 0x73, 0x59,
+    0xAD, 0xBE, 0x4B, 0xFF, 0x00, 0x4A, 0x34, 0xFF, 0x00, 0x37, 0xF9, 0x18, 0xDA, 0xE7, 0xFC, 0x80,
+    0xAD, 0x7F, 0xEB, 0xB3, 0x7F, 0xE8, 0x77, 0x35, 0xD8, 0xEB, 0x9F, 0xF2, 0x1C, 0xB5, 0xFF, 0x00,
+    0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0x57, 0x21, 0xAE, 0x7F, 0xC8, 0x0E, 0xD7, 0xFE, 0xBB, 0x37,
+    0xFE, 0x87, 0x71, 0x5D, 0x86, 0xB9, 0xFF, 0x00, 0x21, 0xCB, 0x5F, 0xFA, 0xE2, 0xDF, 0xFA, 0x05,
+    0xC5, 0x54, 0xBA, 0xFF, 0x00, 0xDB, 0xE1, 0x1F, 0xFE, 0x44, 0xC7, 0xD0, 0x3F, 0xE6, 0x35, 0xFF,
+    0x00, 0x6D, 0x7F, 0xF6, 0xE6, 0xB2, 0x35, 0xCF, 0xF9, 0x01, 0xDA, 0xFF, 0x00, 0xD7, 0x66, 0xFF,
+    0x00, 0xD0, 0xEE, 0x2B, 0x63, 0x40, 0xFF, 0x00, 0x98, 0xD7, 0xFD, 0xB5, 0xFF, 0x00, 0xDB, 0x9A,
+    0xC8, 0xD6, 0xFF, 0x00, 0xE4, 0x07, 0x6B, 0xFF, 0x00, 0x5D, 0x9B, 0xFF, 0x00, 0x43, 0xB8, 0xAA,
+    0x5B, 0xFC, 0xD7, 0xFE, 0x92, 0x3F, 0xF2, 0x7F, 0x99, 0xD7, 0xEB, 0x9F, 0xF2, 0x1C, 0xB5, 0xFF,
+    0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0x56, 0x46, 0x83, 0xFF, 0x00, 0x31, 0xAF, 0xFB, 0x6B,
+    0xFF, 0x00, 0xB7, 0x35, 0xAF, 0xAE, 0x7F, 0xC8, 0x72, 0xD7, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x71,
+    0x59, 0x3A, 0x0F, 0xFC, 0xC6, 0x7F, 0xED, 0xAF, 0xFE, 0xDC, 0xD6, 0x6B, 0x6F, 0x92, 0xFF, 0x00,
+    0xD2, 0x8B, 0xFF, 0x00, 0x37, 0xF9, 0x18, 0xFA, 0xDF, 0xFC, 0x80, 0xED, 0x7F, 0xEB, 0xB3, 0x7F,
+    0xE8, 0x77, 0x15, 0xD7, 0xEB, 0x7F, 0xF2, 0x1B, 0xB5, 0xFF, 0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0,
+    0x5C, 0x57, 0x23, 0xAD, 0xFF, 0x00, 0xC8, 0x12, 0xD7, 0xFE, 0xBB, 0x37, 0xFE, 0x87, 0x71, 0x5D,
+    0x7E, 0xB7, 0xFF, 0x00, 0x21, 0xBB, 0x5F, 0xFA, 0xE2, 0xDF, 0xFA, 0x05, 0xC5, 0x54, 0xBA, 0xFF,
+    0x00, 0xDB, 0xE3, 0x5F, 0xE4, 0x63, 0xE8, 0x3F, 0xF3, 0x19, 0xFF, 0x00, 0xB6, 0xBF, 0xFB, 0x73,
+    0x59, 0x3A, 0xDF, 0xFC, 0x81, 0x2D, 0x7F, 0xEB, 0xB3, 0x7F, 0xE8, 0x77, 0x15, 0xAF, 0xA1, 0x7F,
+    0xCC, 0x67, 0xFE, 0xDA, 0x7F, 0xED, 0xCD, 0x64, 0xEB, 0x5F, 0xF2, 0x04, 0xB6, 0xFF, 0x00, 0xAE,
+    0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0x55, 0x2D, 0xFE, 0x6B, 0xFF, 0x00, 0x49, 0x19, 0xD6, 0xEB, 0x7F,
+    0xF2, 0x1B, 0xB6, 0xFF, 0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0x56, 0x4E, 0x85, 0xFF, 0x00,
+    0x31, 0x9F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x35, 0xAF, 0xAD, 0xFF, 0x00, 0xC8, 0x6E, 0xDB, 0xFE,
+    0xB8, 0xB7, 0xFE, 0x81, 0x71, 0x59, 0x3A, 0x17, 0xFC, 0xC6, 0x3F, 0xED, 0xA7, 0xFE, 0xDC, 0xD6,
+    0x4B, 0x6F, 0x92, 0xFF, 0x00, 0xD2, 0x8A, 0x32, 0x35, 0xAF, 0xF9, 0x02, 0x5B, 0x7F, 0xD7, 0x66,
+    0xFF, 0x00, 0xD0, 0xEE, 0x2B, 0xAE, 0xD6, 0xBF, 0xE4, 0x35, 0x6D, 0xFF, 0x00, 0x5C, 0x5B, 0xFF,
+    0x00, 0x41, 0xB8, 0xAE, 0x4B, 0x5A, 0xFF, 0x00, 0x90, 0x2D, 0xB7, 0xFD, 0x76, 0x6F, 0xFD, 0x0E,
+    0xE2, 0xBA, 0xDD, 0x6B, 0xFE, 0x43, 0x56, 0xDF, 0xF5, 0xC5, 0xBF, 0xF4, 0x1B, 0x8A, 0xB9, 0x75,
+    0xFF, 0x00, 0xB7, 0xC6, 0x8C, 0x9D, 0x0B, 0xFE, 0x63, 0x1F, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B,
+    0x2B, 0x59, 0xFF, 0x00, 0x90, 0x2D, 0xB7, 0xFD, 0x75, 0x6F, 0xFD, 0x0E, 0xE2, 0xB5, 0xB4, 0x3F,
+    0xF9, 0x8C, 0x7F, 0xDB, 0x4F, 0xFD, 0xB8, 0xAC, 0xAD, 0x67, 0xFE, 0x40, 0xB6, 0xDF, 0xF5, 0xD5,
+    0xBF, 0xF4, 0x2B, 0x8A, 0xA5, 0xBF, 0xCD, 0x7F, 0xE9, 0x23, 0x3A, 0xBD, 0x6B, 0xFE, 0x43, 0x56,
+    0xDF, 0xF5, 0xC9, 0xBF, 0xF4, 0x1B, 0x8A, 0xCA, 0xD0, 0xFF, 0x00, 0xE6, 0x31, 0xFF, 0x00, 0x6D,
+    0x3F, 0xF6, 0xE2, 0xB5, 0xB5, 0xAF, 0xF9, 0x0D, 0x5B, 0x7F, 0xD7, 0x26, 0xFF, 0x00, 0xD0, 0x6E,
+    0x2B, 0x2B, 0x43, 0xFF, 0x00, 0x98, 0xBF, 0xFD, 0xB4, 0xFF, 0x00, 0xDB, 0x8A, 0xC9, 0x6D, 0xF2,
+    0x5F, 0xFA, 0x51, 0x46, 0x4E, 0xB3, 0xFF, 0x00, 0x20, 0x5B, 0x6F, 0xFA, 0xEA, 0xDF, 0xFA, 0x15,
+    0xC5, 0x75, 0x7A, 0xCF, 0xFC, 0x86, 0x6D, 0xBF, 0xEB, 0x93, 0x7F, 0xE8, 0x37, 0x15, 0xCA, 0xEB,
+    0x3F, 0xF2, 0x06, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x5C, 0x57, 0x57, 0xAC, 0xFF,
+    0x00, 0xC8, 0x66, 0xDB, 0xFE, 0xB9, 0x37, 0xFE, 0x83, 0x3D, 0x5C, 0xBA, 0xFF, 0x00, 0xDB, 0xE3,
+    0x32, 0xB4, 0x4F, 0xF9, 0x8B, 0xFF, 0x00, 0xDB, 0x4F, 0xFD, 0xB8, 0xAC, 0xAD, 0x63, 0xFE, 0x40,
+    0xD6, 0xDF, 0xF5, 0xD5, 0xBF, 0xF4, 0x29, 0xEB, 0x57, 0x44, 0xFF, 0x00, 0x98, 0xBF, 0xFD, 0xB4,
+    0xFF, 0x00, 0xDB, 0x8A, 0xCB, 0xD6, 0x3F, 0xE4, 0x0D, 0x6D, 0xFF, 0x00, 0x5D, 0x5B, 0xFF, 0x00,
+    0x42, 0x9E, 0xA9, 0x6F, 0xF3, 0x5F, 0xFA, 0x49, 0x48, 0xEA, 0xB5, 0x9F, 0xF9, 0x0C, 0xDB, 0x7F,
+    0xD7, 0x26, 0xFF, 0x00, 0xD0, 0x67, 0xAC, 0xAD, 0x13, 0xFE, 0x62, 0xFF, 0x00, 0xF6, 0xD3, 0xFF,
+    0x00, 0x6E, 0x2B, 0x57, 0x58, 0xFF, 0x00, 0x90, 0xCD, 0xB7, 0xFD, 0x72, 0x6F, 0xFD, 0x06, 0x7A,
+    0xCB, 0xD1, 0x3F, 0xE6, 0x2D, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xE2, 0xB2, 0x5B, 0x7C, 0x97, 0xFE,
+    0x94, 0x34, 0x65, 0x6B, 0x1F, 0xF2, 0x07, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x4F,
+    0x5D, 0x56, 0xB1, 0xFF, 0x00, 0x21, 0x8B, 0x6F, 0xFA, 0xE4, 0xDF, 0xFA, 0x0C, 0xF5, 0xCB, 0x6B,
+    0x1F, 0xF2, 0x07, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x4F, 0x5D, 0x56, 0xB1, 0xFF,
+    0x00, 0x21, 0x8B, 0x7F, 0xFA, 0xE4, 0xDF, 0xFA, 0x0C, 0xF5, 0x72, 0xEB, 0xFF, 0x00, 0x6F, 0x95,
+    0xFF, 0x00, 0x04, 0xCA, 0xD1, 0x7F, 0xE6, 0x2D, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xE2, 0xB3, 0x35,
+    0x7F, 0xF9, 0x03, 0xDB, 0xFF, 0x00, 0xD7, 0x56, 0xFF, 0x00, 0xD0, 0xA7, 0xAD, 0x4D, 0x17, 0xFE,
+    0x62, 0xDF, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B, 0x33, 0x57, 0xFF, 0x00, 0x90, 0x3D, 0xBF, 0xFD,
+    0x75, 0x6F, 0xFD, 0x0A, 0x7A, 0xA5, 0xBF, 0xCD, 0x7F, 0xE9, 0x25, 0x2F, 0xD5, 0x7E, 0x47, 0x4F,
+    0xAC, 0x7F, 0xC8, 0x62, 0xDF, 0xFE, 0xB9, 0x37, 0xFE, 0x83, 0x3D, 0x66, 0x68, 0xBF, 0xF3, 0x16,
+    0xFF, 0x00, 0xB6, 0x9F, 0xFB, 0x71, 0x5A, 0x9A, 0xBF, 0xFC, 0x85, 0xED, 0xFF, 0x00, 0xEB, 0x91,
+    0xFF, 0x00, 0xD0, 0x67, 0xAC, 0xCD, 0x1B, 0xFE, 0x62, 0xBF, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B,
+    0x25, 0xB7, 0xC9, 0x7F, 0xE9, 0x42, 0x5F, 0xA2, 0xFC, 0xCC, 0xBD, 0x5F, 0xFE, 0x41, 0x16, 0xFF,
+    0x00, 0xF5, 0xD5, 0xBF, 0xF4, 0x29, 0xEB, 0xA8, 0xD5, 0xFF, 0x00, 0xE4, 0x2F, 0x6F, 0xFF, 0x00,
+    0x5C, 0x8F, 0xFE, 0x83, 0x3D, 0x73, 0x1A, 0xBF, 0xFC, 0x82, 0x2D, 0xFF, 0x00, 0xEB, 0xA9, 0xFF,
+    0x00, 0xD0, 0xA7, 0xAE, 0x9F, 0x57, 0xFF, 0x00, 0x90, 0xBD, 0xBF, 0xFD, 0x72, 0x3F, 0xFA, 0x0C,
+    0xF5, 0x52, 0xEB, 0xFF, 0x00, 0x6F, 0x96, 0xFF, 0x00, 0xF9, 0x23, 0x33, 0x46, 0xFF, 0x00, 0x98,
+    0xAF, 0xFD, 0xB4, 0xFF, 0x00, 0xDA, 0xF5, 0x99, 0xAB, 0x7F, 0xC8, 0x22, 0xDF, 0xFE, 0xBA, 0x9F,
+    0xFD, 0x0A, 0x7A, 0xD4, 0xD1, 0xBF, 0xE6, 0x2B, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xBD, 0x66, 0x6A,
+    0xDF, 0xF2, 0x08, 0xB7, 0xFF, 0x00, 0xAE, 0xA7, 0xFF, 0x00, 0x42, 0x9E, 0xAD, 0x6F, 0xF3, 0x5F,
+    0xFA, 0x49, 0x6B, 0xF5, 0x5F, 0x91, 0xD3, 0x6A, 0xFF, 0x00, 0xF2, 0x17, 0xB7, 0xFF, 0x00, 0xAE,
+    0x47, 0xFF, 0x00, 0x41, 0x9E, 0xB3, 0x74, 0x6F, 0xF9, 0x8A, 0xFF, 0x00, 0xDB, 0x4F, 0xFD, 0xAF,
+    0x5A, 0x7A, 0xB7, 0xFC, 0x85, 0xAD, 0xFF, 0x00, 0xEB, 0x91, 0xFF, 0x00, 0xD0, 0x67, 0xAC, 0xCD,
+    0x1F, 0xFE, 0x62, 0x9F, 0xF6, 0xD3, 0xFF, 0x00, 0x6B, 0xD6, 0x4B, 0x6F, 0x92, 0xFF, 0x00, 0xD2,
+    0x89, 0x5F, 0xA2, 0xFC, 0xCC, 0xCD, 0x5B, 0xFE, 0x41, 0x36, 0xFF, 0x00, 0xF5, 0xD4, 0xFF, 0x00,
+    0xE8, 0x53, 0xD7, 0x4D, 0xAB, 0x7F, 0xC8, 0x5A, 0xDF, 0xFE, 0xB9, 0x1F, 0xFD, 0x06, 0x7A, 0xE6,
+    0xB5, 0x6F, 0xF9, 0x04, 0xDB, 0xFF, 0x00, 0xD7, 0x53, 0xFF, 0x00, 0xA1, 0x4F, 0x5D, 0x36, 0xAD,
+    0xFF, 0x00, 0x21, 0x6B, 0x7F, 0xFA, 0xE4, 0x7F, 0xF4, 0x19, 0xEA, 0xA5, 0xD7, 0xFE, 0xDF, 0x2D,
+    0xFF, 0x00, 0xF2, 0x46, 0x66, 0x8F, 0xFF, 0x00, 0x31, 0x4F, 0xFB, 0x69, 0xFF, 0x00, 0xB5, 0xEB,
+    0x37, 0x55, 0xFF, 0x00, 0x90, 0x4D, 0xBF, 0xFD, 0x75, 0x3F, 0xFA, 0x14, 0xF5, 0xA7, 0xA3, 0xFF,
+    0x00, 0xCC, 0x53, 0xFE, 0xDA, 0x7F, 0xED, 0x7A, 0xCE, 0xD5, 0x7F, 0xE4, 0x13, 0x6F, 0xFF, 0x00,
+    0x5D, 0x4F, 0xFE, 0x85, 0x35, 0x5A, 0xDF, 0xE6, 0xBF, 0xF4, 0x93, 0x48, 0xEF, 0xF3, 0x5F, 0x91,
+    0xD2, 0x6A, 0xDF, 0xF2, 0x16, 0xB7, 0xFF, 0x00, 0xAE, 0x47, 0xFF, 0x00, 0x41, 0x9A, 0xBC, 0x90,
+    0x0A, 0xF5, 0xBD, 0x57, 0xFE, 0x42, 0xB6, 0xFF, 0x00, 0xF5, 0xC8, 0xFF, 0x00, 0xE8, 0x33, 0x57,
+    0x93, 0x01, 0x5A, 0x61, 0x7F, 0x45, 0xF9, 0xB3, 0x6C, 0x27, 0xE8, 0xBF, 0x36, 0x00, 0x52, 0x81,
+    0x40, 0x14, 0xEC, 0x57, 0x59, 0xDC, 0x84, 0x02, 0x97, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD1, 0xE7,
+    0x40, 0x53, 0x80, 0xA0, 0x0A, 0x50, 0x2A, 0x8F, 0xCA, 0x50, 0x62, 0x97, 0x14, 0x62, 0x9D, 0x8A,
+    0x0B, 0x42, 0x01, 0x5E, 0x9B, 0xAE, 0xFF, 0x00, 0xC8, 0x06, 0xD7, 0xFE, 0xBB, 0x37, 0xFE, 0x87,
+    0x73, 0x5E, 0x68, 0x05, 0x7A, 0x66, 0xBB, 0xFF, 0x00, 0x20, 0x1B, 0x5F, 0xFA, 0xEC, 0xDF, 0xFA,
+    0x1D, 0xCD, 0x61, 0x5B, 0xA7, 0xAF, 0xE8, 0xCE, 0xAA, 0x1D, 0x7D, 0x3F, 0x54, 0x76, 0x5A, 0xEF,
+    0xFC, 0x87, 0xAD, 0x7F, 0xEB, 0x8B, 0x7F, 0xE8, 0x17, 0x35, 0x8D, 0xE1, 0xFF, 0x00, 0xF9, 0x8D,
+    0xFF, 0x00, 0xDB, 0x5F, 0xFD, 0xB9, 0xAD, 0x9D, 0x77, 0xFE, 0x43, 0xB6, 0xBF, 0xF5, 0xC5, 0xBF,
+    0xF4, 0x0B, 0x9A, 0xC7, 0xF0, 0xFF, 0x00, 0xFC, 0xC6, 0xFF, 0x00, 0xED, 0xAF, 0xFE, 0xDC, 0xD7,
+    0x02, 0xDB, 0xE4, 0xBF, 0xF4, 0xA3, 0xD0, 0x7B, 0xFC, 0xDF, 0xE4, 0x63, 0x6B, 0xBF, 0xF2, 0x02,
+    0xB5, 0xFF, 0x00, 0xAE, 0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0xD7, 0x65, 0xAE, 0xFF, 0x00, 0xC8, 0x76,
+    0xD7, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x73, 0x5C, 0x76, 0xB9, 0xFF, 0x00, 0x20, 0x2B, 0x5F, 0xFA,
+    0xEC, 0xDF, 0xFA, 0x1D, 0xCD, 0x76, 0x5A, 0xEF, 0xFC, 0x87, 0x6D, 0x7F, 0xEB, 0x8B, 0x7F, 0xE8,
+    0x17, 0x35, 0x72, 0xEB, 0xFF, 0x00, 0x6F, 0x8A, 0x3F, 0xFC, 0x89, 0x8D, 0xA0, 0x7F, 0xCC, 0x6F,
+    0xFE, 0xDA, 0xFF, 0x00, 0xED, 0xCD, 0x63, 0xEB, 0x9F, 0xF2, 0x02, 0xB5, 0xFF, 0x00, 0xAE, 0xCD,
+    0xFF, 0x00, 0xA1, 0xDC, 0xD6, 0xCE, 0x81, 0xFF, 0x00, 0x31, 0xAF, 0xFB, 0x6B, 0xFF, 0x00, 0xB7,
+    0x35, 0x8F, 0xAE, 0x7F, 0xC8, 0x0E, 0xD7, 0xFE, 0xBB, 0x37, 0xFE, 0x87, 0x71, 0x54, 0xB7, 0xF9,
+    0xAF, 0xFD, 0x24, 0x3A, 0x7C, 0x9F, 0xE6, 0x76, 0x1A, 0xE7, 0xFC, 0x87, 0x6D, 0x7F, 0xEB, 0x8B,
+    0x7F, 0xE8, 0x17, 0x35, 0x91, 0xA0, 0x7F, 0xCC, 0x6B, 0xFE, 0xDA, 0xFF, 0x00, 0xED, 0xCD, 0x6C,
+    0x6B, 0x9F, 0xF2, 0x1C, 0xB5, 0xFF, 0x00, 0xAE, 0x2D, 0xFF, 0x00, 0xA0, 0x5C, 0x56, 0x46, 0x81,
+    0xFF, 0x00, 0x31, 0xAF, 0xFB, 0x6B, 0xFF, 0x00, 0xB7, 0x35, 0x92, 0xDB, 0xE4, 0xBF, 0xF4, 0xA3,
+    0x57, 0xFA, 0xBF, 0xC8, 0xC7, 0xD7, 0x3F, 0xE4, 0x07, 0x6B, 0xFF, 0x00, 0x5D, 0x9B, 0xFF, 0x00,
+    0x43, 0xB8, 0xAE, 0xC3, 0x5C, 0xFF, 0x00, 0x90, 0xE5, 0xAF, 0xFD, 0x71, 0x6F, 0xFD, 0x02, 0xE2,
+    0xB9, 0x0D, 0x6F, 0xFE, 0x40, 0x76, 0xBF, 0xF5, 0xD9, 0xBF, 0xF4, 0x3B, 0x8A, 0xEB, 0xF5, 0xCF,
+    0xF9, 0x0E, 0x5A, 0xFF, 0x00, 0xD7, 0x16, 0xFF, 0x00, 0xD0, 0x2E, 0x2A, 0xE5, 0xD7, 0xFE, 0xDF,
+    0x14, 0x7F, 0xF9, 0x13, 0x23, 0x41, 0xFF, 0x00, 0x98, 0xD7, 0xFD, 0xB5, 0xFF, 0x00, 0xDB, 0x9A,
+    0xC8, 0xD6, 0xFF, 0x00, 0xE4, 0x07, 0x6B, 0xFF, 0x00, 0x5D, 0x9B, 0xFF, 0x00, 0x43, 0xB8, 0xAD,
+    0x7D, 0x07, 0xFE, 0x63, 0x3F, 0xF6, 0xD7, 0xFF, 0x00, 0x6E, 0x6B, 0x27, 0x5B, 0xFF, 0x00, 0x90,
+    0x25, 0xAF, 0xFD, 0x76, 0x6F, 0xFD, 0x0E, 0xE2, 0xA9, 0x6F, 0xF3, 0x5F, 0xFA, 0x48, 0xFF, 0x00,
+    0xC9, 0xFE, 0x67, 0x5D, 0xAD, 0xFF, 0x00, 0xC8, 0x6E, 0xD7, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x71,
+    0x59, 0x1A, 0x0F, 0xFC, 0xC6, 0x7F, 0xED, 0xAF, 0xFE, 0xDC, 0xD6, 0xC6, 0xB7, 0xFF, 0x00, 0x21,
+    0xBB, 0x5F, 0xFA, 0xE2, 0xDF, 0xFA, 0x05, 0xC5, 0x64, 0x68, 0x5F, 0xF3, 0x19, 0xFF, 0x00, 0xB6,
+    0x9F, 0xFB, 0x73, 0x59, 0x2D, 0xBE, 0x4B, 0xFF, 0x00, 0x4A, 0x2F, 0xFC, 0xDF, 0xE4, 0x64, 0x6B,
+    0x7F, 0xF2, 0x04, 0xB5, 0xFF, 0x00, 0xAE, 0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0x57, 0x5D, 0xAD, 0xFF,
+    0x00, 0xC8, 0x6E, 0xDB, 0xFE, 0xB8, 0xB7, 0xFE, 0x81, 0x71, 0x5C, 0x96, 0xB5, 0xFF, 0x00, 0x20,
+    0x4B, 0x6F, 0xFA, 0xEC, 0xDF, 0xFA, 0x1D, 0xC5, 0x75, 0xDA, 0xDF, 0xFC, 0x86, 0xED, 0xBF, 0xEB,
+    0x8B, 0x7F, 0xE8, 0x17, 0x15, 0x72, 0xEB, 0xFF, 0x00, 0x6F, 0x8D, 0x7F, 0x91, 0x91, 0xA1, 0x7F,
+    0xCC, 0x67, 0xFE, 0xDA, 0x7F, 0xED, 0xCD, 0x64, 0xEB, 0x5F, 0xF2, 0x04, 0xB6, 0xFF, 0x00, 0xAE,
+    0xCD, 0xFF, 0x00, 0xA1, 0xDC, 0x56, 0xBE, 0x85, 0xFF, 0x00, 0x31, 0x8F, 0xFB, 0x69, 0xFF, 0x00,
+    0xB7, 0x35, 0x93, 0xAD, 0x7F, 0xC8, 0x16, 0xDB, 0xFE, 0xBB, 0x37, 0xFE, 0x87, 0x71, 0x54, 0xB7,
+    0xF9, 0xAF, 0xFD, 0x24, 0x3F, 0xAF, 0xC4, 0xEB, 0x75, 0xAF, 0xF9, 0x0D, 0x5B, 0x7F, 0xD7, 0x16,
+    0xFF, 0x00, 0xD0, 0x2E, 0x2B, 0x27, 0x42, 0xFF, 0x00, 0x98, 0xC7, 0xFD, 0xB4, 0xFF, 0x00, 0xDB,
+    0x8A, 0xD6, 0xD6, 0xBF, 0xE4, 0x35, 0x6D, 0xFF, 0x00, 0x5C, 0x5B, 0xFF, 0x00, 0x41, 0xB8, 0xAC,
+    0xAD, 0x0F, 0xFE, 0x63, 0x1F, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B, 0x25, 0xB7, 0xC9, 0x7F, 0xE9,
+    0x45, 0x99, 0x1A, 0xCF, 0xFC, 0x81, 0x6D, 0xBF, 0xEB, 0xAB, 0x7F, 0xE8, 0x77, 0x15, 0xD6, 0xEB,
+    0x5F, 0xF2, 0x1A, 0xB6, 0xFF, 0x00, 0xAE, 0x4D, 0xFF, 0x00, 0xA0, 0xDC, 0x57, 0x29, 0xAC, 0xFF,
+    0x00, 0xC8, 0x16, 0xDB, 0xFE, 0xBA, 0xB7, 0xFE, 0x85, 0x71, 0x5D, 0x66, 0xB5, 0xFF, 0x00, 0x21,
+    0xAB, 0x6F, 0xFA, 0xE4, 0xDF, 0xFA, 0x0D, 0xC5, 0x54, 0xBA, 0xFF, 0x00, 0xDB, 0xE3, 0x46, 0x4E,
+    0x87, 0xFF, 0x00, 0x31, 0x8F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0x95, 0xAC, 0xFF, 0x00, 0xC8,
+    0x16, 0xDB, 0xFE, 0xBA, 0xB7, 0xFE, 0x85, 0x71, 0x5A, 0xDA, 0x1F, 0xFC, 0xC5, 0xFF, 0x00, 0xED,
+    0xA7, 0xFE, 0xDC, 0x56, 0x56, 0xB3, 0xFF, 0x00, 0x20, 0x6B, 0x6F, 0xFA, 0xEA, 0xDF, 0xFA, 0x15,
+    0xC5, 0x5A, 0xDF, 0xE6, 0xBF, 0xF4, 0x91, 0x9D, 0x56, 0xB3, 0xFF, 0x00, 0x21, 0x9B, 0x6F, 0xFA,
+    0xE4, 0xDF, 0xFA, 0x0D, 0xC5, 0x65, 0x68, 0x9F, 0xF3, 0x17, 0xFF, 0x00, 0xB6, 0x9F, 0xFB, 0x71,
+    0x5A, 0xDA, 0xCF, 0xFC, 0x86, 0x6D, 0xBF, 0xEB, 0x93, 0x7F, 0xE8, 0x33, 0xD6, 0x56, 0x89, 0xFF,
+    0x00, 0x31, 0x7F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0x92, 0xDB, 0xE4, 0xBF, 0xF4, 0xA2, 0x8C,
+    0xAD, 0x63, 0xFE, 0x40, 0xD6, 0xDF, 0xF5, 0xD5, 0xBF, 0xF4, 0x29, 0xEB, 0xAB, 0xD6, 0x7F, 0xE4,
+    0x33, 0x6D, 0xFF, 0x00, 0x5C, 0x9B, 0xFF, 0x00, 0x41, 0x9E, 0xB9, 0x5D, 0x63, 0xFE, 0x40, 0xD6,
+    0xDF, 0xF5, 0xD5, 0xBF, 0xF4, 0x29, 0xEB, 0xAA, 0xD6, 0x3F, 0xE4, 0x33, 0x6D, 0xFF, 0x00, 0x5C,
+    0x9B, 0xFF, 0x00, 0x41, 0x9E, 0xAA, 0x5D, 0x7F, 0xED, 0xF1, 0x99, 0x5A, 0x27, 0xFC, 0xC5, 0xFF,
+    0x00, 0xED, 0xA7, 0xFE, 0xDC, 0x56, 0x5E, 0xB1, 0xFF, 0x00, 0x20, 0x6B, 0x6F, 0xFA, 0xEA, 0xDF,
+    0xFA, 0x14, 0xF5, 0xAB, 0xA2, 0x7F, 0xCC, 0x5B, 0xFE, 0xDA, 0x7F, 0xED, 0xC5, 0x65, 0xEB, 0x1F,
+    0xF2, 0x07, 0xB6, 0xFF, 0x00, 0xAE, 0xAD, 0xFF, 0x00, 0xA1, 0x4F, 0x56, 0xB7, 0xF9, 0xAF, 0xFD,
+    0x24, 0xA4, 0x75, 0x3A, 0xC7, 0xFC, 0x86, 0x2D, 0xBF, 0xEB, 0x93, 0x7F, 0xE8, 0x33, 0xD6, 0x5E,
+    0x8B, 0xFF, 0x00, 0x31, 0x6F, 0xFB, 0x69, 0xFF, 0x00, 0xB7, 0x15, 0xAB, 0xAC, 0x7F, 0xC8, 0x62,
+    0xDF, 0xFE, 0xB9, 0x37, 0xFE, 0x83, 0x3D, 0x65, 0xE8, 0xBF, 0xF3, 0x16, 0xFF, 0x00, 0xB6, 0x9F,
+    0xFB, 0x71, 0x59, 0x2D, 0xBE, 0x4B, 0xFF, 0x00, 0x4A, 0x1A, 0x32, 0xB5, 0x7F, 0xF9, 0x03, 0xDB,
+    0xFF, 0x00, 0xD7, 0x56, 0xFF, 0x00, 0xD0, 0xA7, 0xAE, 0xA7, 0x58, 0xFF, 0x00, 0x90, 0xC5, 0xBF,
+    0xFD, 0x72, 0x6F, 0xFD, 0x06, 0x7A, 0xE5, 0xF5, 0x7F, 0xF9, 0x03, 0xDB, 0xFF, 0x00, 0xD7, 0x56,
+    0xFF, 0x00, 0xD0, 0xA7, 0xAE, 0xA7, 0x57, 0xFF, 0x00, 0x90, 0xC5, 0xBF, 0xFD, 0x72, 0x3F, 0xFA,
+    0x0C, 0xF5, 0x52, 0xEB, 0xFF, 0x00, 0x6F, 0x95, 0xFF, 0x00, 0x04, 0xCB, 0xD1, 0x7F, 0xE6, 0x2D,
+    0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xE2, 0xB3, 0x35, 0x7F, 0xF9, 0x04, 0x5B, 0xFF, 0x00, 0xD7, 0x56,
+    0xFF, 0x00, 0xD0, 0xA7, 0xAD, 0x4D, 0x1B, 0xFE, 0x62, 0xBF, 0xF6, 0xD3, 0xFF, 0x00, 0x6E, 0x2B,
+    0x33, 0x57, 0xFF, 0x00, 0x90, 0x45, 0xBF, 0xFD, 0x75, 0x3F, 0xFA, 0x14, 0xF5, 0x4B, 0x7F, 0x9A,
+    0xFF, 0x00, 0xD2, 0x4A, 0x5F, 0xE5, 0xF9, 0x1D, 0x3E, 0xAF, 0xFF, 0x00, 0x21, 0x7B, 0x7F, 0xFA,
+    0xE4, 0x7F, 0xF4, 0x19, 0xEB, 0x33, 0x46, 0xFF, 0x00, 0x98, 0xAF, 0xFD, 0xB4, 0xFF, 0x00, 0xDA,
+    0xF5, 0xA7, 0xAB, 0xFF, 0x00, 0xC8, 0x5E, 0xDF, 0xFE, 0xB9, 0x1F, 0xFD, 0x06, 0x7A, 0xCC, 0xD1,
+    0xBF, 0xE6, 0x2B, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0xBD, 0x66, 0xB6, 0xF9, 0x2F, 0xFD, 0x28, 0x17,
+    0xE8, 0xBF, 0x33, 0x33, 0x56, 0xFF, 0x00, 0x90, 0x45, 0xBF, 0xFD, 0x75, 0x3F, 0xFA, 0x14, 0xF5,
+    0xD3, 0xEA, 0xFF, 0x00, 0xF2, 0x17, 0xB7, 0xFF, 0x00, 0xAE, 0x47, 0xFF, 0x00, 0x41, 0x9E, 0xB9,
+    0x9D, 0x5B, 0xFE, 0x41, 0x16, 0xFF, 0x00, 0xF5, 0xD4, 0xFF, 0x00, 0xE8, 0x53, 0xD7, 0x4F, 0xAB,
+    0x7F, 0xC8, 0x5A, 0xDF, 0xFE, 0xB9, 0x1F, 0xFD, 0x06, 0x7A, 0xA9, 0x75, 0xFF, 0x00, 0xB7, 0xCA,
+    0x7F, 0xE6, 0x65, 0xE8, 0xDF, 0xF3, 0x15, 0xFF, 0x00, 0xB6, 0x9F, 0xFB, 0x5E, 0xB3, 0x75, 0x6F,
+    0xF9, 0x04, 0xDB, 0xFF, 0x00, 0xD7, 0x53, 0xFF, 0x00, 0xA1, 0x4F, 0x5A, 0x7A, 0x3F, 0xFC, 0xC5,
+    0x3F, 0xED, 0xA7, 0xFE, 0xD7, 0xAC, 0xDD, 0x5B, 0xFE, 0x41, 0x36, 0xFF, 0x00, 0xF5, 0xD4, 0xFF,
+    0x00, 0xE8, 0x53, 0xD5, 0x2D, 0xFE, 0x6B, 0xFF, 0x00, 0x49, 0x2D, 0x7E, 0xAB, 0xF2, 0x3A, 0x5D,
+    0x5B, 0xFE, 0x42, 0xD6, 0xFF, 0x00, 0xF5, 0xC8, 0xFF, 0x00, 0xE8, 0x33, 0xD6, 0x6E, 0x8F, 0xFF,
+    0x00, 0x31, 0x4F, 0xFB, 0x69, 0xFF, 0x00, 0xB5, 0xEB, 0x4F, 0x56, 0xFF, 0x00, 0x90, 0xB5, 0xBF,
+    0xFD, 0x72, 0x3F, 0xFA, 0x0C, 0xF5, 0x9B, 0xA3, 0xFF, 0x00, 0xCC, 0x53, 0xFE, 0xDA, 0x7F, 0xED,
+    0x7A, 0xCD, 0x6D, 0xF2, 0x5F, 0xFA, 0x51, 0x2B, 0xF4, 0x5F, 0x99, 0x99, 0xAA, 0xFF, 0x00, 0xC8,
+    0x26, 0xDF, 0xFE, 0xBA, 0x9F, 0xFD, 0x0A, 0x7A, 0xE9, 0xB5, 0x6F, 0xF9, 0x0B, 0x5B, 0xFF, 0x00,
+    0xD7, 0x23, 0xFF, 0x00, 0xA0, 0xCD, 0x5C, 0xD6, 0xAB, 0xFF, 0x00, 0x20, 0x9B, 0x7F, 0xFA, 0xEA,
+    0x7F, 0xF4, 0x29, 0xAB, 0xA5, 0xD5, 0x7F, 0xE4, 0x2B, 0x6F, 0xFF, 0x00, 0x5C, 0x8F, 0xFE, 0x83,
+    0x35, 0x54, 0xBA, 0xFF, 0x00, 0xDB, 0xE5, 0xBF, 0xFE, 0x48, 0xCD, 0xD2, 0x3F, 0xE6, 0x29, 0xFF,
+    0x00, 0x6D, 0x3F, 0xF6, 0xBD, 0x67, 0x6A, 0xBF, 0xF2, 0x0A, 0xB7, 0xFF, 0x00, 0xAE, 0x87, 0xFF,
+    0x00, 0x42, 0x9A, 0xB4, 0xB4, 0x8F, 0xF9, 0x8A, 0x7F, 0xDB, 0x4F, 0xFD, 0xAF, 0x59, 0xDA, 0xA7,
+    0xFC, 0x82, 0xA0, 0xFF, 0x00, 0xAE, 0x87, 0xFF, 0x00, 0x42, 0x9A, 0xA9, 0x6F, 0xF3, 0x5F, 0xFA,
+    0x49, 0xA2, 0xDF, 0xE6, 0xBF, 0x23, 0xA3, 0xD5, 0x7F, 0xE4, 0x2B, 0x07, 0xFD, 0x73, 0x3F, 0xFA,
+    0x0C, 0xD5, 0xE4, 0xE0, 0x57, 0xAC, 0xEA, 0xBF, 0xF2, 0x15, 0x83, 0xFE, 0xB9, 0x9F, 0xFD, 0x06,
+    0x6A, 0xF2, 0x80, 0x2B, 0x5C, 0x2F, 0xE8, 0xBF, 0x36, 0x6D, 0x85, 0xFD, 0x17, 0xEA, 0x26, 0x29,
+    0x71, 0x4B, 0x8A, 0x5C, 0x57, 0x59, 0xDA, 0x84, 0x02, 0x9D, 0x8A, 0x00, 0xA5, 0x02, 0x82, 0xD1,
+    0xE7, 0x78, 0xA5, 0x02, 0x97, 0x14, 0xA0, 0x53, 0x3F, 0x29, 0x42, 0x62, 0x97, 0x14, 0xB8, 0xA5,
+    0x02, 0x82, 0xD0, 0x01, 0x5D, 0x35, 0xF7, 0x8C, 0xBC, 0xDB, 0x08, 0xAD, 0xBE, 0xC3, 0xB7, 0xCB,
+    0x73, 0x77, 0xF6, 0xCD, 0xFF, 0x00, 0xEB, 0x77, 0x19, 0x38, 0xF2, 0x76, 0xF1, 0x8F, 0x33, 0xFB,
+    0xC7, 0xA5, 0x73, 0x40, 0x52, 0xE2, 0xA6, 0x49, 0x75, 0x5F, 0xDE, 0x46, 0xB1, 0x93, 0xFB, 0x2F,
+    0xFB, 0xAC, 0xEF, 0xAF, 0xBE, 0x29, 0xF9, 0xB7, 0xF1, 0x5C, 0xFF, 0x00, 0x64, 0x6D, 0xF2, 0xD0,
+    0xDA, 0x7D, 0x8F, 0xCD, 0xFF, 0x00, 0x5B, 0xB8, 0x49, 0xCF, 0x9D, 0xB3, 0x8C, 0x79, 0x9F, 0xDD,
+    0x3D, 0x2A, 0x9E, 0x9F, 0xF1, 0x0B, 0xC9, 0xFB, 0x6F, 0xFC, 0x4B, 0x37, 0x7D, 0xAB, 0x77, 0xFC,
+    0xB4, 0xFF, 0x00, 0x8F, 0x1F, 0x37, 0xCD, 0xFF, 0x00, 0x67, 0x9D, 0xBE, 0x67, 0xFB, 0x3D, 0x2B,
+    0x8F, 0xC5, 0x28, 0x15, 0x1E, 0xCA, 0x3F, 0xCB, 0xFD, 0xDF, 0xD4, 0xDB, 0xDA, 0xCB, 0xF9, 0xBF,
+    0xBC, 0x74, 0x97, 0xDE, 0x31, 0xF3, 0x6C, 0x62, 0xB6, 0xFB, 0x0E, 0xDF, 0x2D, 0xCD, 0xDF, 0xDB,
+    0x37, 0xFF, 0x00, 0xAD, 0xDC, 0x64, 0xE3, 0xCA, 0xDB, 0xC6, 0x3C, 0xCF, 0xEF, 0x1E, 0x95, 0xB3,
+    0x7D, 0xF1, 0x4B, 0xCD, 0xBE, 0x8A, 0xE7, 0xFB, 0x23, 0x6F, 0x96, 0x86, 0xD3, 0xEC, 0x7E, 0x6F,
+    0xFA, 0xDD, 0xC2, 0x4E, 0x7C, 0xDD, 0x9C, 0x63, 0xCC, 0xFE, 0xE9, 0xE9, 0x5C, 0x1E, 0x29, 0x40,
+    0xA1, 0xD3, 0x8F, 0x58, 0xF7, 0xBF, 0xCF, 0x72, 0x95, 0x47, 0xFC, 0xDD, 0xBF, 0x0D, 0x8E, 0xC3,
+    0x4F, 0xF8, 0x83, 0xE4, 0xFD, 0xB7, 0xFE, 0x25, 0xBB, 0xBE, 0xD5, 0xBB, 0xFE, 0x5A, 0x7F, 0xC7,
+    0x8F, 0x9B, 0xE6, 0xFF, 0x00, 0xB3, 0xCE, 0xDF, 0x33, 0xFD, 0x9E, 0x95, 0x52, 0xFB, 0xC6, 0x1E,
+    0x6D, 0x8C, 0x56, 0xDF, 0x61, 0xDB, 0xE5, 0xB9, 0xBB, 0xFB, 0x66, 0xFF, 0x00, 0xF5, 0xBB, 0x8C,
+    0x9C, 0x79, 0x5B, 0x78, 0xC6, 0xFF, 0x00, 0xEF, 0x1E, 0x95, 0xCD, 0x81, 0x4E, 0xC5, 0x3F, 0x66,
+    0xBF, 0x97, 0xFB, 0xDF, 0xA1, 0x4A, 0x6F, 0xBF, 0x91, 0xDD, 0x5F, 0x7C, 0x50, 0xF3, 0x6F, 0xA2,
+    0xB8, 0xFE, 0xC8, 0xDB, 0xE5, 0xA1, 0xB4, 0xFB, 0x1F, 0x9B, 0xFE, 0xB7, 0x70, 0x93, 0x9F, 0x37,
+    0x67, 0x18, 0xDF, 0xFD, 0xD3, 0xD2, 0xAA, 0x58, 0x7C, 0x40, 0xF2, 0xBE, 0xDB, 0xFF, 0x00, 0x12,
+    0xDD, 0xDF, 0x6A, 0xDD, 0xFF, 0x00, 0x2D, 0x3F, 0xE3, 0xC7, 0xCD, 0xF3, 0x7F, 0xD9, 0xE7, 0x6F,
+    0x99, 0xFE, 0xCF, 0x4A, 0xE4, 0x71, 0x4A, 0x05, 0x2F, 0x65, 0x1F, 0xE5, 0xFE, 0xEF, 0xEA, 0x69,
+    0xED, 0x1F, 0xF3, 0x79, 0x9D, 0x1D, 0xEF, 0x8B, 0xFC, 0xDB, 0x18, 0xAD, 0xFE, 0xC5, 0xB7, 0xCB,
+    0x73, 0x77, 0xF6, 0xCD, 0xFF, 0x00, 0xEB, 0x77, 0x19, 0x38, 0xF2, 0xB6, 0xF1, 0x8D, 0xFF, 0x00,
+    0xDE, 0x3D, 0x2B, 0x62, 0xF7, 0xE2, 0x7F, 0x9B, 0x7D, 0x15, 0xC7, 0xF6, 0x4E, 0xDF, 0x2D, 0x0D,
+    0xA7, 0xD8, 0xFC, 0xDF, 0xF5, 0xBB, 0x84, 0x9C, 0xF9, 0xBB, 0x38, 0xC6, 0xFF, 0x00, 0xEE, 0x9E,
+    0x95, 0xC2, 0xE2, 0x94, 0x0A, 0x1D, 0x38, 0xF5, 0x8F, 0x7B, 0xFC, 0xF7, 0x29, 0x4D, 0xF7, 0xFE,
+    0x91, 0xD7, 0x58, 0x78, 0xFB, 0xCA, 0xFB, 0x6F, 0xFC, 0x4B, 0x77, 0x7D, 0xAB, 0x77, 0xFC, 0xB4,
+    0xFF, 0x00, 0x8F, 0x2F, 0x37, 0xCC, 0xFF, 0x00, 0x67, 0x9D, 0xBE, 0x67, 0xFB, 0x3D, 0x2A, 0xAD,
+    0xEF, 0x8B, 0xBC, 0xDB, 0x18, 0xAD, 0xFE, 0xC5, 0xB7, 0xCB, 0x73, 0x75, 0xF6, 0xCD, 0xFF, 0x00,
+    0xEB, 0x77, 0x19, 0x38, 0xF2, 0xB6, 0xF6, 0xDF, 0xFD, 0xE3, 0xD2, 0xB9, 0xD0, 0x29, 0x71, 0x4F,
+    0xD9, 0xAF, 0xE5, 0xFE, 0xF7, 0xE8, 0x52, 0x9B, 0xEF, 0xE4, 0x77, 0x17, 0xBF, 0x13, 0x7C, 0xDB,
+    0xE8, 0xAE, 0x3F, 0xB2, 0x76, 0xF9, 0x68, 0x6D, 0x7E, 0xC9, 0xE6, 0xFF, 0x00, 0xAD, 0xDC, 0x24,
+    0xE7, 0xCD, 0xD9, 0xDB, 0x7F, 0xF7, 0x4F, 0x4A, 0xAB, 0x61, 0xE3, 0xDF, 0x2B, 0xED, 0x9F, 0xF1,
+    0x2E, 0xDD, 0xF6, 0xAD, 0xDF, 0xF2, 0xD3, 0xFE, 0x3C, 0xBC, 0xDF, 0x33, 0xFD, 0x9E, 0x76, 0xF9,
+    0x9F, 0xEC, 0xF4, 0xAE, 0x4B, 0x14, 0xA0, 0x54, 0xFB, 0x28, 0xFF, 0x00, 0x2F, 0xF7, 0x7F, 0x52,
+    0xD4, 0xDF, 0x7F, 0x33, 0xA1, 0xBD, 0xF1, 0x6F, 0x9B, 0x65, 0x15, 0xBF, 0xD8, 0xB6, 0xF9, 0x6E,
+    0x6E, 0xBE, 0xD7, 0xBF, 0xFD, 0x6E, 0xE3, 0x27, 0x1E, 0x56, 0xDE, 0xDB, 0xFF, 0x00, 0xBC, 0x7A,
+    0x56, 0xC5, 0xEF, 0xC4, 0xCF, 0x36, 0xF6, 0x2B, 0x8F, 0xEC, 0xAD, 0xBE, 0x5A, 0x1B, 0x5F, 0xB2,
+    0x79, 0x9F, 0xEB, 0x77, 0x09, 0x39, 0xF3, 0x76, 0x76, 0xDF, 0xFD, 0xD3, 0xD2, 0xB8, 0x7C, 0x53,
+    0x80, 0xA6, 0xE9, 0xC7, 0xAC, 0x7B, 0xDF, 0xE7, 0xB9, 0x4A, 0x4F, 0xB9, 0xD6, 0x58, 0x78, 0xF3,
+    0xCA, 0xFB, 0x67, 0xFC, 0x4B, 0xB7, 0x7D, 0xAB, 0x77, 0xFC, 0xB4, 0xFF, 0x00, 0x8F, 0x2F, 0x37,
+    0xCC, 0xFF, 0x00, 0x67, 0x9D, 0xBE, 0x67, 0xFB, 0x3D, 0x2A, 0xA5, 0xEF, 0x8B, 0x7C, 0xDB, 0x28,
+    0xAD, 0xFE, 0xC5, 0xB7, 0xCB, 0x73, 0x75, 0xF6, 0xBD, 0xFF, 0x00, 0xEB, 0x77, 0x19, 0x38, 0xF2,
+    0xB6, 0xF6, 0xDF, 0xFD, 0xE3, 0xD2, 0xB9, 0xF0, 0x29, 0x71, 0x47, 0xB3, 0x5F, 0xCB, 0xFD, 0xEF,
+    0xD0, 0xB5, 0x2F, 0x3F, 0x23, 0xB6, 0xBD, 0xF8, 0x95, 0xE6, 0xDE, 0xC5, 0x71, 0xFD, 0x95, 0xB7,
+    0xCB, 0x43, 0x6B, 0xF6, 0x4F, 0x33, 0xFD, 0x6E, 0xE1, 0x27, 0x3E, 0x6E, 0xCE, 0xDB, 0xFF, 0x00,
+    0xBA, 0x7A, 0x55, 0x5B, 0x1F, 0x1D, 0xF9, 0x5F, 0x6C, 0xFF, 0x00, 0x89, 0x76, 0xEF, 0xB4, 0xEE,
+    0xFE, 0x3F, 0xF8, 0xF2, 0xF3, 0x7C, 0xCF, 0xF6, 0x79, 0xDB, 0xBF, 0xFD, 0x9E, 0x95, 0xCA, 0x62,
+    0x94, 0x0A, 0x5E, 0xCA, 0x3F, 0xCB, 0xFD, 0xDF, 0xD4, 0xA5, 0x2F, 0x33, 0xA0, 0xBC, 0xF1, 0x67,
+    0x9B, 0x65, 0x15, 0xBF, 0xD8, 0xF6, 0xF9, 0x6E, 0x6E, 0xBE, 0xD7, 0xBF, 0xFD, 0x6E, 0xE3, 0x27,
+    0x1E, 0x56, 0xDE, 0xDB, 0xFF, 0x00, 0xBC, 0x7A, 0x56, 0xBD, 0xE7, 0xC4, 0x9F, 0x36, 0xF6, 0x3B,
+    0x8F, 0xEC, 0xBD, 0xBE, 0x5A, 0x1B, 0x5F, 0xB2, 0x79, 0x9F, 0xEB, 0x77, 0x09, 0x39, 0xF3, 0x76,
+    0x76, 0xDF, 0xFD, 0xD3, 0xD2, 0xB8, 0x9C, 0x53, 0x80, 0xA6, 0xE9, 0xC7, 0xAC, 0x7B, 0xFE, 0x3B,
+    0x96, 0x99, 0xD5, 0x58, 0xF8, 0xE7, 0xCA, 0xFB, 0x67, 0xFC, 0x4B, 0xF7, 0x7D, 0xA7, 0x77, 0xF1,
+    0xFF, 0x00, 0xC7, 0x9F, 0x9B, 0xE6, 0x7F, 0xB3, 0xCE, 0x37, 0xFF, 0x00, 0xB3, 0xD2, 0xAA, 0xDE,
+    0x78, 0xAF, 0xCD, 0xB2, 0x8E, 0xDF, 0xEC, 0x7B, 0x76, 0x39, 0xBA, 0xFB, 0x5E, 0xFF, 0x00, 0xF5,
+    0xBB, 0x8C, 0x9C, 0x79, 0x5B, 0x7B, 0x6F, 0xFE, 0xF1, 0xAC, 0x00, 0x29, 0x71, 0x47, 0x22, 0xFE,
+    0x5F, 0xEF, 0x14, 0x99, 0xDA, 0x5E, 0x7C, 0x47, 0xF3, 0x6F, 0x23, 0xB8, 0xFE, 0xCB, 0xDB, 0xB1,
+    0x0D, 0xAF, 0xD9, 0x3C, 0xCF, 0xF5, 0xBB, 0x84, 0x9C, 0xF9, 0xBB, 0x3B, 0x6F, 0xFE, 0xE9, 0xAA,
+    0xD6, 0x3E, 0x38, 0xF2, 0xBE, 0xD7, 0xFF, 0x00, 0x12, 0xFD, 0xDF, 0x69, 0xDD, 0xFC, 0x7F, 0xF1,
+    0xE7, 0xE6, 0xF9, 0x9F, 0xEC, 0xF3, 0x8D, 0xFF, 0x00, 0xEC, 0xF4, 0xAE, 0x57, 0x14, 0xA0, 0x52,
+    0xF6, 0x71, 0xFE, 0x5F, 0xEE, 0x96, 0x99, 0xBF, 0x79, 0xE2, 0xAF, 0x32, 0xCE, 0x38, 0x3E, 0xC7,
+    0xB7, 0x63, 0x9B, 0x9F, 0xB5, 0x6E, 0xFF, 0x00, 0x5B, 0xB8, 0xC9, 0xC7, 0x95, 0xB7, 0xB6, 0xFF,
+    0x00, 0xEF, 0x1A, 0xD6, 0xBC, 0xF8, 0x8D, 0xE6, 0x5E, 0x47, 0x3F, 0xF6, 0x5E, 0xDD, 0x88, 0x6D,
+    0xBE, 0xCB, 0xE6, 0x7F, 0xAD, 0xDC, 0x24, 0xE7, 0xCD, 0xD9, 0xDB, 0x7F, 0xF7, 0x4D, 0x71, 0x98,
+    0xA5, 0x02, 0x9B, 0xA7, 0x1F, 0xE5, 0xEF, 0xF8, 0xEE, 0x52, 0x3A, 0x8B, 0x2F, 0x1B, 0xF9, 0x5F,
+    0x6B, 0xFF, 0x00, 0x40, 0xDD, 0xF6, 0x9D, 0xDF, 0xC7, 0xFF, 0x00, 0x1E, 0x7E, 0x67, 0x99, 0xFE,
+    0xCF, 0x38, 0xDF, 0xFE, 0xCF, 0x4A, 0xAD, 0x77, 0xE2, 0x9F, 0x32, 0xCE, 0x38, 0x3E, 0xC7, 0xB7,
+    0x63, 0x9B, 0x9F, 0xB5, 0x6E, 0xFF, 0x00, 0x59, 0xB8, 0xC9, 0xC7, 0x95, 0x8E, 0xDB, 0xFF, 0x00,
+    0xBC, 0x6B, 0x04, 0x0A, 0x5C, 0x51, 0xC8, 0xBF, 0x97, 0xFB, 0xC5, 0xA3, 0xB2, 0xBC, 0xF8, 0x89,
+    0xE6, 0x5E, 0x47, 0x3F, 0xF6, 0x66, 0xDD, 0x88, 0x6D, 0xBE, 0xCB, 0xE6, 0x7F, 0xAC, 0xDC, 0x24,
+    0xE7, 0xCD, 0xDB, 0xDB, 0x7F, 0xF7, 0x4D, 0x56, 0xB2, 0xF1, 0xB7, 0x95, 0xF6, 0xBF, 0xF4, 0x0D,
+    0xDF, 0x69, 0xDD, 0xFC, 0x7F, 0xF1, 0xE7, 0xE6, 0x79, 0x9F, 0xEC, 0xF3, 0x8D, 0xFF, 0x00, 0xEC,
+    0xF4, 0xAE, 0x5F, 0x14, 0xE0, 0x29, 0x7B, 0x38, 0xFF, 0x00, 0x2F, 0xF7, 0x4A, 0x46, 0xED, 0xDF,
+    0x8A, 0x3C, 0xCB, 0x38, 0xE0, 0xFB, 0x26, 0xDD, 0x8C, 0x6E, 0x7E, 0xD5, 0xBB, 0xFD, 0x66, 0xE3,
+    0x27, 0x1E, 0x5E, 0x3B, 0x6F, 0xFE, 0xF1, 0xAD, 0x5B, 0xBF, 0x88, 0x5E, 0x65, 0xE4, 0x73, 0xFF,
+    0x00, 0x66, 0x6D, 0xD8, 0xA6, 0xDB, 0xEC, 0xBE, 0x67, 0xFA, 0xCD, 0xC1, 0xF9, 0xF3, 0x36, 0xF6,
+    0xDF, 0xFD, 0xD3, 0x5C, 0x76, 0x29, 0x40, 0xA1, 0xD3, 0x8F, 0xF2, 0xF7, 0xFC, 0x77, 0x2D, 0x23,
+    0xA7, 0xB2, 0xF1, 0xAF, 0x97, 0xF6, 0xBF, 0xF4, 0x0D, 0xDF, 0x68, 0xDD, 0xFC, 0x7F, 0xF1, 0xE9,
+    0xE6, 0x79, 0x9F, 0xEC, 0xF3, 0x8D, 0xFE, 0xD5, 0x5A, 0xEF, 0xC4, 0xFE, 0x65, 0x9C, 0x70, 0x7D,
+    0x93, 0x6E, 0xC6, 0x37, 0x3F, 0x6A, 0xDD, 0xFE, 0xB3, 0x71, 0x7E, 0x3C, 0xBC, 0x76, 0xDF, 0xFD,
+    0xE3, 0x58, 0x40, 0x52, 0xE2, 0x9F, 0x22, 0xFE, 0x5F, 0xEF, 0x16, 0x97, 0x97, 0x99, 0xD8, 0x5D,
+    0xFC, 0x41, 0xF3, 0x2E, 0xE3, 0x9F, 0xFB, 0x37, 0x6E, 0xC5, 0x36, 0xDF, 0x65, 0xF3, 0x3F, 0xD6,
+    0x6E, 0x0F, 0xCF, 0x99, 0xB7, 0xB6, 0xFF, 0x00, 0xEE, 0x9A, 0xAD, 0x65, 0xE3, 0x3F, 0x2F, 0xED,
+    0x5F, 0xE8, 0x3B, 0xBE, 0xD1, 0xBB, 0xF8, 0xFF, 0x00, 0xE3, 0xD3, 0xCC, 0xF3, 0x3F, 0xD9, 0xE7,
+    0x1B, 0xFD, 0xAB, 0x99, 0xC5, 0x38, 0x0A, 0x5E, 0xCE, 0x3F, 0xCB, 0xFD, 0xD2, 0x94, 0x57, 0x6F,
+    0x23, 0x72, 0xEF, 0xC4, 0xDE, 0x65, 0xA4, 0x70, 0x7D, 0x93, 0x6E, 0xC6, 0x37, 0x3F, 0x6A, 0xDD,
+    0xFE, 0xB3, 0x71, 0x7E, 0x3C, 0xBC, 0x76, 0xDF, 0xFD, 0xE3, 0x5A, 0x77, 0x7E, 0x3F, 0xF3, 0x2E,
+    0xE3, 0x9F, 0xFB, 0x37, 0x6E, 0xC5, 0x36, 0xDF, 0x66, 0xF3, 0x3F, 0xD6, 0x6E, 0x0F, 0xCF, 0x99,
+    0xB7, 0xFD, 0xBF, 0xEE, 0x9A, 0xE4, 0x71, 0x4A, 0x05, 0x0E, 0x9C, 0x7F, 0x97, 0xBF, 0xE3, 0xB9,
+    0x7C, 0xAB, 0xB1, 0xD2, 0xD9, 0xF8, 0xCB, 0xCB, 0xFB, 0x57, 0xFA, 0x0E, 0xEF, 0xB4, 0x6E, 0xFE,
+    0x3F, 0xF8, 0xF4, 0xF3, 0x3C, 0xCF, 0xF6, 0x79, 0xC6, 0xFF, 0x00, 0x6A, 0xAF, 0x75, 0xE2, 0x5F,
+    0x32, 0xD2, 0x38, 0x3E, 0xCB, 0xB7, 0x63, 0x1B, 0x8F, 0xB4, 0xEE, 0xFF, 0x00, 0x59, 0xB8, 0xBF,
+    0x1E, 0x5E, 0x3F, 0xDB, 0xFE, 0xF1, 0xAC, 0x30, 0x29, 0x71, 0x4F, 0x91, 0x7F, 0x2F, 0xF7, 0x8A,
+    0x51, 0x5D, 0xBC, 0xCE, 0xBA, 0xEF, 0xC7, 0xDE, 0x65, 0xDC, 0x73, 0xFF, 0x00, 0x67, 0x6D, 0xD8,
+    0xA6, 0xDF, 0xEC, 0xDE, 0x67, 0xFA, 0xCD, 0xC1, 0xF9, 0xF3, 0x36, 0xFF, 0x00, 0xB7, 0xFD, 0xD3,
+    0x55, 0xEC, 0xFC, 0x63, 0xE5, 0xFD, 0xAB, 0xFD, 0x07, 0x77, 0xDA, 0x37, 0x7F, 0x1F, 0xFC, 0x7A,
+    0x79, 0x9B, 0xFF, 0x00, 0xD9, 0xE7, 0x1B, 0xFD, 0xAB, 0x9B, 0xC5, 0x28, 0x15, 0x3E, 0xCE, 0x3F,
+    0xCB, 0xFD, 0xD2, 0x94, 0x17, 0x6F, 0x23, 0x6A, 0xEB, 0xC4, 0x9E, 0x65, 0xA4, 0x70, 0xFD, 0x97,
+    0x6E, 0xC6, 0x37, 0x1F, 0x69, 0xDD, 0xFE, 0xB3, 0x71, 0x7E, 0x3C, 0xBC, 0x7F, 0xB7, 0xFD, 0xE3,
+    0x5A, 0x77, 0x5E, 0x3C, 0xF3, 0x2E, 0xE3, 0x9B, 0xFB, 0x3B, 0x6E, 0xC5, 0x36, 0xFF, 0x00, 0x66,
+    0xF3, 0x3F, 0xD6, 0x64, 0x3F, 0x3E, 0x66, 0xDF, 0xF6, 0xFF, 0x00, 0xBA, 0x6B, 0x93, 0xC5, 0x28,
+    0x14, 0xDD, 0x38, 0xFF, 0x00, 0x2F, 0x7F, 0xC7, 0x72, 0xF9, 0x17, 0x6F, 0xE9, 0x9D, 0x1D, 0x9F,
+    0x8C, 0x3C, 0xBF, 0xB5, 0x7F, 0xA1, 0x6E, 0xFB, 0x46, 0xEF, 0xE3, 0xFF, 0x00, 0x8F, 0x5F, 0x33,
+    0x7F, 0xFB, 0x3C, 0xE3, 0x7F, 0xB5, 0x57, 0xBA, 0xF1, 0x1F, 0x99, 0x6B, 0x1C, 0x3F, 0x65, 0xDB,
+    0xB1, 0x8D, 0xC7, 0xDA, 0x77, 0x7F, 0xAC, 0xC9, 0x7E, 0x3C, 0xBC, 0x7F, 0xB7, 0xFD, 0xE3, 0x58,
+    0xA0, 0x53, 0xB1, 0x47, 0x22, 0xFE, 0x5F, 0x32, 0xD4, 0x17, 0x6F, 0x33, 0xAB, 0xBA, 0xF1, 0xDF,
+    0x99, 0x75, 0x1C, 0xDF, 0xD9, 0xDB, 0x76, 0x29, 0xB7, 0xFB, 0x36, 0xFF, 0x00, 0xF5, 0x99, 0x0F,
+    0xCF, 0x99, 0xB7, 0xFD, 0xBF, 0x43, 0x5C, 0xA0, 0x14, 0xB8, 0xA5, 0x02, 0x9C, 0x62, 0x97, 0xC2,
+    0xBC, 0x8D, 0x21, 0x14, 0xBE, 0x15, 0xE4, 0x26, 0x29, 0xD8, 0xA3, 0x14, 0xA0, 0x55, 0x9A, 0xA0,
+    0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0xF3, 0xAC, 0x52, 0x81, 0x4B, 0x8A, 0x50, 0x2A,
+    0x8F, 0xCA, 0x50, 0x01, 0x4A, 0x05, 0x00, 0x52, 0xE2, 0x82, 0xD0, 0x01, 0x4B, 0x8A, 0x50, 0x29,
+    0x71, 0x41, 0x68, 0x4C, 0x53, 0x80, 0xA3, 0x14, 0xA0, 0x50, 0x5A, 0x00, 0x29, 0x40, 0xA0, 0x0A,
+    0x76, 0x29, 0x16, 0x84, 0x02, 0x97, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x98, 0xA7, 0x01, 0x46,
+    0x29, 0x40, 0xA0, 0xB4, 0x00, 0x52, 0x81, 0x4A, 0x05, 0x2E, 0x28, 0x2D, 0x08, 0x05, 0x2E, 0x29,
+    0x40, 0xA5, 0xC5, 0x05, 0x20, 0xC5, 0x28, 0x14, 0x62, 0x9C, 0x05, 0x05, 0xA1, 0x00, 0xA5, 0x02,
+    0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x10, 0x0A, 0x76, 0x28, 0x02, 0x97, 0x14, 0x16, 0x83, 0x14, 0xA0,
+    0x51, 0x8A, 0x70, 0x14, 0x16, 0x84, 0x02, 0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x00, 0xA5,
+    0xC5, 0x00, 0x52, 0xE2, 0x82, 0xD0, 0x62, 0x94, 0x0A, 0x92, 0xCE, 0x10, 0xC4, 0xE5, 0x8B, 0x73,
+    0xB7, 0x83, 0xF7, 0x8B, 0x8E, 0x83, 0x70, 0x1C, 0xC6, 0x31, 0xFC, 0x47, 0x3F, 0xCA, 0xBC, 0xB2,
+    0x1D, 0xBC, 0x29, 0x0E, 0x0F, 0x09, 0xFC, 0x4E, 0x85, 0x3F, 0x8F, 0xA7, 0x52, 0x09, 0x1E, 0xDD,
+    0x8D, 0x05, 0xA2, 0x50, 0x29, 0x40, 0xA6, 0x0B, 0xC7, 0x39, 0xF3, 0x2D, 0xC2, 0x0E, 0x55, 0x19,
+    0x40, 0xFD, 0xDC, 0x85, 0x86, 0x04, 0x99, 0x03, 0xFD, 0x52, 0x8E, 0x78, 0xCE, 0x39, 0xE8, 0x69,
+    0xD1, 0x89, 0x39, 0xDC, 0xA0, 0xFF, 0x00, 0xCB, 0x4F, 0x2C, 0xFF, 0x00, 0x7A, 0x36, 0x1C, 0x13,
+    0x9F, 0xE3, 0x1F, 0x50, 0x07, 0x27, 0x3D, 0x68, 0x2D, 0x0F, 0x02, 0x97, 0x14, 0xE5, 0x2C, 0x00,
+    0x20, 0xC5, 0x27, 0x45, 0x8E, 0x11, 0x81, 0xFB, 0xCD, 0xB9, 0xC1, 0x73, 0x9C, 0x93, 0xC8, 0xEB,
+    0xF5, 0x39, 0xE2, 0x9B, 0x14, 0x12, 0x37, 0x0C, 0x64, 0x56, 0xE0, 0x4E, 0x31, 0x81, 0x9D, 0xC3,
+    0xFD, 0x51, 0x20, 0x60, 0xB1, 0xFA, 0x03, 0xD0, 0x52, 0x29, 0x0B, 0x8A, 0x50, 0x29, 0x91, 0xB3,
+    0x31, 0x05, 0x13, 0x60, 0x18, 0xFD, 0xD9, 0xC9, 0xDE, 0xC5, 0x8F, 0x09, 0x9C, 0x93, 0x83, 0x8C,
+    0xFC, 0xBC, 0xFA, 0x81, 0x8A, 0x95, 0xD2, 0xE1, 0x4F, 0x0D, 0x02, 0x8E, 0xAC, 0xDC, 0x1F, 0x21,
+    0x38, 0xE1, 0xB3, 0x9C, 0x92, 0x70, 0x07, 0xAF, 0x27, 0x27, 0xB0, 0x5A, 0x10, 0x0A, 0x70, 0x15,
+    0x1C, 0x92, 0x93, 0xBB, 0x64, 0x4A, 0x71, 0xC3, 0x1C, 0x91, 0xF3, 0xB1, 0xC7, 0xCC, 0xBD, 0xB7,
+    0x1E, 0xD9, 0x04, 0x76, 0x3C, 0x83, 0x56, 0x63, 0x41, 0xD7, 0xE7, 0x50, 0x70, 0x24, 0xC8, 0xFB,
+    0x92, 0x4A, 0x47, 0xFA, 0x95, 0x3D, 0x93, 0x0C, 0x33, 0xFC, 0xFA, 0x50, 0x5A, 0x23, 0x02, 0x97,
+    0x15, 0x1C, 0x92, 0xB2, 0x16, 0x01, 0x43, 0x11, 0xF3, 0xCA, 0x79, 0xF9, 0x54, 0x2B, 0x75, 0x38,
+    0x1C, 0x64, 0x83, 0xC7, 0x3D, 0x00, 0xCF, 0x67, 0x64, 0xAB, 0x7D, 0xDC, 0x9F, 0xBE, 0xD1, 0x96,
+    0x04, 0x61, 0x5B, 0x91, 0x90, 0x47, 0x23, 0x00, 0xF4, 0xF5, 0xE9, 0x41, 0x68, 0x7E, 0x29, 0x40,
+    0xA5, 0x62, 0xEA, 0x3E, 0x54, 0x90, 0x31, 0xC2, 0x43, 0xBD, 0x0F, 0x2F, 0xF3, 0x70, 0xE1, 0x80,
+    0x1C, 0xF1, 0xD3, 0x9C, 0xFA, 0xF4, 0xA1, 0x10, 0xEC, 0x04, 0x16, 0x6E, 0x36, 0x48, 0xE9, 0xFD,
+    0xE8, 0xFD, 0xCF, 0xF7, 0xF9, 0xEE, 0x0F, 0xA6, 0x68, 0x2D, 0x0A, 0x05, 0x28, 0x14, 0x42, 0x37,
+    0x63, 0xC9, 0x61, 0x8C, 0x9F, 0x30, 0x75, 0x20, 0xC8, 0x38, 0x07, 0x93, 0xF7, 0x39, 0xEE, 0x05,
+    0x0E, 0xCA, 0x77, 0x6F, 0x62, 0x08, 0x05, 0x1A, 0x32, 0x40, 0x2E, 0x73, 0x91, 0xB0, 0x2F, 0x7E,
+    0xA3, 0x8C, 0x8F, 0x5C, 0x63, 0x04, 0x2D, 0x0A, 0x05, 0x2E, 0x2A, 0x25, 0x93, 0x2D, 0x84, 0x99,
+    0x1C, 0x60, 0x3F, 0x9D, 0xD0, 0x46, 0x48, 0xE7, 0x7A, 0x9E, 0xCA, 0x17, 0x3D, 0x41, 0xEB, 0xEB,
+    0xCD, 0xBB, 0x90, 0xF8, 0xE6, 0x35, 0x53, 0xFE, 0xAE, 0x39, 0x13, 0x00, 0x64, 0x67, 0xEF, 0x86,
+    0x1D, 0x49, 0xFF, 0x00, 0x6B, 0x07, 0xB1, 0x1C, 0x64, 0x2D, 0x11, 0x62, 0x9C, 0x05, 0x47, 0x92,
+    0x84, 0x99, 0x26, 0x25, 0x72, 0x64, 0x88, 0x94, 0xFF, 0x00, 0x58, 0x33, 0x83, 0x80, 0x40, 0xFB,
+    0x83, 0x9E, 0x98, 0x07, 0xBF, 0x7A, 0xB2, 0x77, 0x29, 0x1E, 0x6A, 0x22, 0xFC, 0xC1, 0xAE, 0x5C,
+    0x90, 0x04, 0x71, 0x2B, 0x0C, 0xE1, 0x7D, 0x1C, 0xF4, 0xEF, 0x8E, 0xA7, 0x06, 0x82, 0xD1, 0x18,
+    0x14, 0xA0, 0x53, 0x52, 0x46, 0x61, 0xF2, 0xEF, 0x6C, 0x92, 0xA9, 0x32, 0x85, 0x3B, 0x1B, 0x3D,
+    0x36, 0x80, 0x39, 0x28, 0x06, 0x39, 0xEA, 0x4F, 0x14, 0xB3, 0x80, 0x55, 0x76, 0x15, 0x63, 0xF7,
+    0x1D, 0x55, 0xC2, 0x92, 0x76, 0xE4, 0x72, 0x0B, 0xFD, 0xF1, 0xEB, 0xDF, 0x1C, 0xF6, 0xA0, 0xB4,
+    0x38, 0x0A, 0x5C, 0x53, 0xE3, 0x8E, 0x22, 0xCC, 0xBB, 0xA6, 0x24, 0x10, 0x55, 0xBA, 0xE3, 0xF7,
+    0x8A, 0x0E, 0xE5, 0x1D, 0xBF, 0x11, 0x80, 0x78, 0x1C, 0x66, 0xA5, 0x82, 0x36, 0x39, 0x2F, 0x03,
+    0x2A, 0x65, 0x4E, 0x33, 0xF7, 0xE3, 0x24, 0xF2, 0x14, 0x8E, 0x3A, 0x63, 0x9C, 0x0C, 0x72, 0x4E,
+    0x79, 0xA0, 0xA4, 0x41, 0x8A, 0x70, 0x14, 0xF7, 0xDA, 0x32, 0x63, 0xC1, 0x4C, 0x84, 0x52, 0x7E,
+    0xE9, 0x05, 0x73, 0xD7, 0x24, 0xFC, 0xB9, 0xF4, 0xE9, 0xEB, 0x48, 0x91, 0x49, 0xB5, 0x8F, 0x99,
+    0x14, 0x87, 0x19, 0xDA, 0x30, 0x06, 0x5B, 0x93, 0xE5, 0xB9, 0x3D, 0x10, 0x1E, 0xBC, 0x7A, 0x50,
+    0x5A, 0x10, 0x0A, 0x50, 0x29, 0x24, 0x70, 0xBF, 0xDF, 0x55, 0xE8, 0x85, 0xC7, 0xFA, 0xB1, 0x22,
+    0xE7, 0x2F, 0xC7, 0xF0, 0x64, 0x63, 0xD4, 0xF0, 0xBE, 0xCF, 0x8C, 0xBA, 0x75, 0x8D, 0x94, 0x8C,
+    0x31, 0x69, 0x40, 0xE5, 0x99, 0x38, 0xF3, 0x03, 0x63, 0x0B, 0x90, 0x47, 0x7C, 0xF3, 0xD3, 0x8A,
+    0x0B, 0x42, 0x01, 0x4B, 0x8A, 0x6C, 0x2E, 0xAC, 0xDF, 0xE8, 0xEE, 0x8E, 0x3A, 0xAA, 0x9C, 0xE1,
+    0x79, 0xC6, 0x0B, 0x10, 0x79, 0xE4, 0x1E, 0x84, 0x7B, 0x7A, 0x58, 0x16, 0xD2, 0x28, 0xF9, 0x36,
+    0xBF, 0x3C, 0xEE, 0xFE, 0x35, 0x43, 0x8E, 0x1B, 0x1C, 0x02, 0x4F, 0xB9, 0x3D, 0xFB, 0xD0, 0x5A,
+    0x3C, 0xDC, 0x0A, 0x50, 0x28, 0x02, 0x94, 0x0A, 0x67, 0xE5, 0x28, 0x31, 0x4B, 0x8A, 0x5C, 0x52,
+    0xE2, 0x82, 0xD0, 0x80, 0x53, 0xB1, 0x40, 0x14, 0xA0, 0x50, 0x5A, 0x00, 0x29, 0x40, 0xA0, 0x0A,
+    0x70, 0x14, 0x16, 0x84, 0xC5, 0x2E, 0x29, 0x71, 0x4B, 0x8A, 0x0B, 0x42, 0x01, 0x4E, 0xC5, 0x00,
+    0x52, 0x81, 0x41, 0x68, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x50, 0x28, 0x2D, 0x09, 0x8A, 0x5C, 0x52,
+    0xE2, 0x97, 0x14, 0x14, 0x80, 0x0A, 0x5C, 0x50, 0x05, 0x28, 0x14, 0x16, 0x80, 0x0A, 0x50, 0x29,
+    0x40, 0xA5, 0x02, 0x82, 0xD0, 0x98, 0xA7, 0x62, 0x8C, 0x52, 0xE2, 0x91, 0x68, 0x00, 0xA5, 0xC5,
+    0x00, 0x53, 0x80, 0xA0, 0xB4, 0x20, 0x14, 0xA0, 0x52, 0x81, 0x4A, 0x05, 0x05, 0xA0, 0xC5, 0x2E,
+    0x28, 0xC5, 0x2E, 0x28, 0x2D, 0x00, 0x14, 0xB8, 0xA5, 0x02, 0x94, 0x0A, 0x0B, 0x43, 0x81, 0x00,
+    0x03, 0x09, 0x0F, 0x82, 0x4B, 0xA0, 0xE4, 0x06, 0x51, 0xD2, 0x62, 0x72, 0x06, 0xEC, 0xB7, 0x61,
+    0xEB, 0x9C, 0xD3, 0x92, 0x18, 0x81, 0x3B, 0x5D, 0x24, 0x1C, 0x79, 0x71, 0xAF, 0xFC, 0xB3, 0x60,
+    0xDE, 0x99, 0xE3, 0x60, 0x20, 0x72, 0x33, 0xF9, 0x54, 0x71, 0x16, 0x21, 0xB7, 0x24, 0xAE, 0x39,
+    0x12, 0x2E, 0x46, 0x19, 0x46, 0x30, 0x3C, 0xBC, 0x1C, 0xEE, 0x20, 0x0E, 0x99, 0xF5, 0x3D, 0xA9,
+    0x44, 0xAA, 0xC4, 0xE2, 0xD0, 0x95, 0x1F, 0xB9, 0xBA, 0x2A, 0x39, 0x48, 0xE3, 0x3D, 0x54, 0xA8,
+    0x27, 0x92, 0x41, 0xEB, 0xDB, 0xBD, 0x05, 0xA1, 0xB6, 0xE3, 0x79, 0x1E, 0x50, 0x8C, 0x93, 0x91,
+    0x28, 0x40, 0x40, 0x5D, 0xAB, 0xD0, 0xE1, 0x4F, 0x3B, 0x80, 0x27, 0xAF, 0xA7, 0x34, 0xF7, 0x9D,
+    0x7E, 0x5C, 0xAA, 0x32, 0xE0, 0x4A, 0x15, 0xB0, 0x3C, 0xD8, 0x94, 0x8F, 0xBB, 0x92, 0x4F, 0x07,
+    0x24, 0xE4, 0x9F, 0x4C, 0xE3, 0x34, 0xE9, 0x9F, 0x20, 0x12, 0x70, 0x09, 0x11, 0x8C, 0x70, 0x43,
+    0xE5, 0x87, 0xDF, 0xDB, 0xD2, 0x4F, 0xC3, 0x03, 0x20, 0x74, 0xA6, 0xC8, 0xA3, 0x6E, 0x16, 0x2D,
+    0xDF, 0xC6, 0xA0, 0x1C, 0xEE, 0x9C, 0x83, 0xC4, 0x64, 0x6E, 0xE2, 0x26, 0xC0, 0x3F, 0x87, 0xE2,
+    0x14, 0x84, 0x88, 0x9E, 0xE0, 0x29, 0xC9, 0x69, 0xD3, 0x27, 0x26, 0x38, 0xC0, 0xFF, 0x00, 0x56,
+    0x49, 0x6E, 0x73, 0xBB, 0xB9, 0xE7, 0xDE, 0xA5, 0x99, 0xD0, 0x36, 0xD1, 0x1C, 0x8B, 0xDA, 0x57,
+    0x66, 0xFB, 0xCD, 0x1B, 0x0E, 0xC7, 0x3C, 0x2F, 0x1D, 0xB2, 0x7D, 0x31, 0xC1, 0x64, 0x32, 0xCA,
+    0xA7, 0xF7, 0xAE, 0x87, 0x8C, 0xA4, 0x8E, 0xC4, 0x0B, 0x76, 0x5C, 0xFF, 0x00, 0xAD, 0x0C, 0x3D,
+    0xB1, 0xCA, 0xE4, 0xF6, 0xEF, 0x4F, 0x05, 0x7E, 0x4F, 0x2A, 0x36, 0x2B, 0xC0, 0x8D, 0x63, 0x19,
+    0xF3, 0x3C, 0xC0, 0xD9, 0xDC, 0xC4, 0x73, 0x8E, 0x33, 0xD3, 0x3D, 0xCF, 0x1C, 0x05, 0xA2, 0xC3,
+    0x79, 0xCC, 0x73, 0x25, 0xC7, 0x94, 0x87, 0x00, 0xEF, 0x00, 0x6E, 0x01, 0x33, 0xF2, 0x9C, 0xF4,
+    0x53, 0xE8, 0x07, 0xD7, 0x83, 0x54, 0x23, 0x55, 0xEB, 0x31, 0x2E, 0xC7, 0x12, 0x30, 0x60, 0x48,
+    0x58, 0xB0, 0x7E, 0xFC, 0x6C, 0x46, 0x76, 0x1C, 0x0C, 0x86, 0x3F, 0x85, 0x4F, 0xE5, 0x82, 0xBB,
+    0xA5, 0x61, 0xDF, 0x72, 0xAE, 0x08, 0x56, 0xCA, 0xE3, 0xCD, 0x90, 0x0E, 0x77, 0xF2, 0x4F, 0x5C,
+    0xF6, 0xED, 0x52, 0x05, 0x91, 0x5C, 0x6C, 0x59, 0xB6, 0x02, 0x63, 0x80, 0x16, 0xCF, 0x93, 0x8E,
+    0x32, 0x3B, 0x77, 0xC6, 0x01, 0xFA, 0xF6, 0x14, 0x16, 0x8A, 0xE9, 0x08, 0xF9, 0xB0, 0xD2, 0xC7,
+    0x9C, 0x6E, 0x4C, 0x67, 0x04, 0x76, 0x70, 0x08, 0xC6, 0x39, 0xC7, 0x18, 0x23, 0xEE, 0x8C, 0xE2,
+    0xAC, 0x43, 0x0C, 0xA7, 0x1B, 0x96, 0x42, 0x31, 0xE7, 0x49, 0x2B, 0x6D, 0x3B, 0xCA, 0x82, 0x41,
+    0x2B, 0xEB, 0xCF, 0xE7, 0xC9, 0xCE, 0x69, 0xEA, 0x17, 0xA9, 0x85, 0xF2, 0x49, 0x66, 0x92, 0x4C,
+    0x6E, 0x8E, 0x48, 0xF8, 0x1B, 0x4E, 0x00, 0x3D, 0x0F, 0xA8, 0xEB, 0xBB, 0xB9, 0x09, 0xA8, 0xF9,
+    0x84, 0xFC, 0x92, 0x4F, 0x9C, 0x81, 0x09, 0x27, 0x85, 0x67, 0x8C, 0x0C, 0x46, 0xEA, 0x3A, 0xB9,
+    0xCF, 0x4E, 0x32, 0x7A, 0x75, 0x20, 0x2D, 0x11, 0x3A, 0x4C, 0x38, 0x8C, 0x49, 0x2C, 0x78, 0xDC,
+    0xAA, 0xA0, 0xF2, 0xAD, 0x8E, 0x8E, 0x18, 0xFA, 0xE3, 0x82, 0x7D, 0x48, 0x3D, 0x69, 0x6D, 0xC0,
+    0xE7, 0x05, 0xA3, 0x70, 0x36, 0x4B, 0xB9, 0xF1, 0x8C, 0x86, 0xE4, 0x37, 0xAA, 0x83, 0x9E, 0x01,
+    0x18, 0xF4, 0xC9, 0xA9, 0x24, 0xB5, 0x07, 0xFD, 0x43, 0x3F, 0x04, 0x12, 0xD9, 0x3F, 0x34, 0x85,
+    0x81, 0xE0, 0x11, 0xDF, 0x8E, 0x46, 0x73, 0xF8, 0xD3, 0xD1, 0x5C, 0x8C, 0x06, 0xC0, 0xCA, 0x9B,
+    0xA2, 0x50, 0x7E, 0xF3, 0xCD, 0x2D, 0xCE, 0xDE, 0x7B, 0x7B, 0x02, 0x46, 0x01, 0x07, 0x80, 0x42,
+    0xD0, 0x43, 0x71, 0x8F, 0xB8, 0xE9, 0x9D, 0xD8, 0x85, 0x81, 0xFF, 0x00, 0x5E, 0xD3, 0x37, 0xF1,
+    0x48, 0x00, 0xFB, 0xB8, 0x19, 0xE3, 0x1D, 0x3F, 0x16, 0xBA, 0x3B, 0x0C, 0xC8, 0xFB, 0x06, 0x4C,
+    0xE8, 0x57, 0x92, 0xAD, 0x18, 0xFF, 0x00, 0x96, 0x99, 0xEE, 0x9F, 0xEE, 0xE7, 0xB1, 0xC7, 0x26,
+    0x93, 0xE4, 0xE8, 0xC9, 0x1E, 0x07, 0xCB, 0x2C, 0x71, 0xE0, 0x6E, 0x0D, 0xC9, 0xD9, 0xB9, 0xBF,
+    0x84, 0x11, 0xEA, 0x3F, 0x03, 0x52, 0x82, 0x70, 0x4A, 0xB3, 0x05, 0x39, 0x30, 0x46, 0x09, 0x2C,
+    0x0A, 0x11, 0xCA, 0x10, 0xDC, 0xF9, 0x67, 0xD4, 0xE4, 0x75, 0x5C, 0x74, 0xA0, 0xB4, 0x10, 0xCF,
+    0xB5, 0x0E, 0xC6, 0x93, 0x79, 0x21, 0x98, 0x30, 0xFB, 0xE4, 0x93, 0xFE, 0xAE, 0x42, 0x0F, 0x50,
+    0x46, 0x09, 0x27, 0xA6, 0x01, 0xA6, 0xBC, 0x29, 0x26, 0x58, 0xC4, 0x41, 0xC0, 0xD8, 0x36, 0xAE,
+    0x06, 0x7F, 0x89, 0x94, 0x64, 0x85, 0x8F, 0x03, 0xD4, 0xE3, 0x1C, 0xE2, 0x92, 0x38, 0x5B, 0x1C,
+    0x22, 0x8C, 0xE1, 0x4B, 0x0E, 0x9B, 0x0E, 0xDC, 0x80, 0x01, 0x1C, 0xB9, 0xDA, 0x7A, 0xF2, 0x3F,
+    0x1A, 0x92, 0x29, 0xD5, 0x71, 0xFB, 0xE2, 0xDD, 0x5C, 0xB6, 0xC0, 0x49, 0x99, 0x40, 0xEF, 0x93,
+    0xF7, 0x01, 0x1E, 0xD8, 0xE8, 0x45, 0x05, 0xA0, 0x36, 0xE0, 0xE3, 0xCD, 0xB8, 0x94, 0xE0, 0x88,
+    0x41, 0x50, 0x73, 0x29, 0x2E, 0x0E, 0xD6, 0xCB, 0x75, 0x18, 0x3D, 0x4E, 0x33, 0xD3, 0x90, 0x69,
+    0xC5, 0xCC, 0x83, 0x11, 0xA3, 0x20, 0xC8, 0x51, 0x80, 0x3F, 0x8F, 0x18, 0xF2, 0xDB, 0x8E, 0xB9,
+    0x24, 0xF3, 0xD7, 0x90, 0x4F, 0x76, 0xAA, 0x14, 0xF9, 0x76, 0xA4, 0x67, 0x6F, 0x9B, 0x08, 0xE0,
+    0x82, 0xCD, 0xE8, 0xC0, 0x8E, 0x49, 0xC0, 0xCE, 0xDC, 0x83, 0xCF, 0x3D, 0x4A, 0x42, 0xB1, 0xF6,
+    0x38, 0x2E, 0xA1, 0x62, 0x66, 0xC7, 0x4D, 0xB8, 0xCA, 0x83, 0xDD, 0x47, 0x18, 0xCE, 0x39, 0xF4,
+    0xA4, 0x5A, 0x1C, 0x89, 0xB8, 0x90, 0x1D, 0x10, 0xFD, 0xC9, 0x00, 0xCE, 0x04, 0xA5, 0xCE, 0x4A,
+    0x44, 0x40, 0x04, 0x2B, 0x31, 0x1C, 0x67, 0x03, 0xAF, 0xBB, 0xD5, 0x9C, 0x93, 0xB1, 0x99, 0x00,
+    0x24, 0xCC, 0x83, 0x61, 0xF3, 0x11, 0xFA, 0x96, 0x5C, 0x8E, 0xAB, 0xEE, 0x46, 0x3D, 0xF3, 0x4D,
+    0x81, 0x42, 0x29, 0xFD, 0xDA, 0x87, 0x38, 0x20, 0x1F, 0xBC, 0xD1, 0xC8, 0xDC, 0x88, 0xF6, 0xE7,
+    0xF8, 0x7F, 0xFD, 0x5E, 0xAB, 0x2A, 0x2A, 0x1C, 0x6C, 0xDA, 0x07, 0xF1, 0x20, 0xC9, 0x44, 0x8D,
+    0x98, 0xE2, 0x15, 0xCF, 0xF7, 0xC1, 0xE7, 0x68, 0x03, 0xBF, 0x18, 0xA0, 0xB4, 0x3C, 0x91, 0xF2,
+    0x9D, 0xBC, 0x1C, 0x90, 0xDF, 0xDD, 0x25, 0x46, 0x0C, 0x83, 0x9E, 0x8D, 0xC8, 0x19, 0x1C, 0xF4,
+    0xC9, 0xA9, 0x96, 0x65, 0xC8, 0xF2, 0x60, 0x56, 0xFE, 0x29, 0x76, 0xAF, 0xDF, 0x40, 0x0E, 0x42,
+    0x80, 0x1B, 0xB9, 0xF5, 0xC7, 0xBF, 0x35, 0x0C, 0x98, 0x8C, 0x36, 0xD8, 0x14, 0xAE, 0xE3, 0x1A,
+    0xB8, 0x1C, 0xC1, 0xB0, 0x8F, 0x94, 0xB0, 0x1E, 0x83, 0x8E, 0x46, 0x09, 0xEF, 0xD6, 0x9C, 0xBF,
+    0x32, 0x61, 0x59, 0xB8, 0x00, 0xB8, 0x18, 0xCB, 0xB9, 0xFA, 0x8F, 0xC3, 0x18, 0xCF, 0x4C, 0x0E,
+    0x39, 0x0B, 0x43, 0x49, 0x43, 0x90, 0x84, 0x3F, 0x78, 0xD9, 0x8F, 0x20, 0x44, 0x49, 0xC4, 0xC0,
+    0x9E, 0xA1, 0x41, 0xC7, 0x1E, 0xE3, 0x18, 0xA7, 0xAC, 0x88, 0x9F, 0xEA, 0xB7, 0xA9, 0x27, 0x12,
+    0x16, 0x73, 0xF2, 0xEE, 0xCF, 0xCD, 0x33, 0x0C, 0x7D, 0xEC, 0x73, 0xCB, 0x01, 0xCF, 0x1D, 0x8A,
+    0x41, 0x0A, 0xE0, 0x17, 0x65, 0x74, 0xE6, 0x1D, 0xA9, 0xC8, 0x74, 0x03, 0x85, 0x89, 0xC8, 0xCF,
+    0x5C, 0xF1, 0x83, 0xCF, 0xD4, 0x53, 0xED, 0xED, 0xD5, 0x8F, 0xEE, 0x9C, 0x94, 0x39, 0xDD, 0x23,
+    0x01, 0xF3, 0x31, 0xEC, 0x4F, 0xA6, 0x7B, 0x10, 0x7E, 0x98, 0xE8, 0x14, 0x86, 0x4F, 0xB3, 0x03,
+    0xCE, 0x01, 0x8E, 0x4C, 0x66, 0x5F, 0xF9, 0xE5, 0x1A, 0x81, 0x9D, 0xA0, 0x9E, 0xAD, 0x8E, 0xB9,
+    0x20, 0x9E, 0xBD, 0x4D, 0x2B, 0xBA, 0x74, 0x06, 0x77, 0x6F, 0xE0, 0x2B, 0x93, 0xB5, 0x65, 0x5C,
+    0xE4, 0x93, 0xC7, 0x56, 0x27, 0x39, 0x07, 0x81, 0x8A, 0x9D, 0x6D, 0xA1, 0xC6, 0x0C, 0xA2, 0x32,
+    0x38, 0xBA, 0x65, 0x3C, 0xEE, 0x90, 0x83, 0x87, 0x00, 0x72, 0x32, 0xDC, 0x76, 0xED, 0x8A, 0x49,
+    0x6D, 0x83, 0x21, 0xC2, 0xED, 0x50, 0x76, 0x98, 0xD8, 0x0C, 0x22, 0xA1, 0x39, 0x2B, 0x1F, 0x03,
+    0xE6, 0x5C, 0x9E, 0xBE, 0xC3, 0x18, 0x14, 0x16, 0x88, 0x23, 0xCE, 0xDC, 0xBA, 0xAB, 0x10, 0x3C,
+    0x94, 0xDD, 0x27, 0x0C, 0x53, 0x8C, 0x4C, 0xAE, 0x47, 0xDC, 0x63, 0xD3, 0x8F, 0xCB, 0x19, 0xB5,
+    0x6E, 0xA8, 0x01, 0xC1, 0x8D, 0xD4, 0x1F, 0x3A, 0x45, 0x52, 0x78, 0x20, 0xE4, 0x01, 0xB4, 0x7F,
+    0x73, 0x3C, 0xE3, 0x93, 0xC7, 0x14, 0xD6, 0x89, 0x4F, 0xFC, 0x7E, 0x47, 0xB4, 0xF1, 0x1B, 0xA1,
+    0x2D, 0xF2, 0xC4, 0x8C, 0x7A, 0xE0, 0x1C, 0xEE, 0xEB, 0xC9, 0xF5, 0x20, 0xF1, 0xC2, 0x14, 0x46,
+    0xC6, 0xC1, 0x14, 0x6E, 0xC4, 0x2C, 0x6E, 0x00, 0x24, 0xE1, 0x06, 0x4B, 0x0C, 0x2F, 0x40, 0x47,
+    0x4C, 0x1C, 0xFB, 0x50, 0x5A, 0x1A, 0x0A, 0xE4, 0xEC, 0x8D, 0x90, 0x1C, 0xBA, 0x4E, 0xA7, 0x38,
+    0x45, 0x1D, 0x42, 0x93, 0xD5, 0x63, 0x38, 0xE0, 0x8F, 0xC7, 0x02, 0x9F, 0x22, 0xCA, 0xC3, 0xFE,
+    0x3D, 0xE2, 0x5E, 0xBB, 0xF0, 0x4F, 0x08, 0x30, 0x31, 0xC1, 0xC6, 0x70, 0xA7, 0xD0, 0x1C, 0x7A,
+    0x0A, 0x8C, 0xB8, 0xC8, 0x2A, 0xD9, 0x75, 0xF9, 0x04, 0x4F, 0x9F, 0xBD, 0x1A, 0x7F, 0xCB, 0xBF,
+    0x27, 0xEF, 0xB0, 0xED, 0xED, 0xC1, 0xEF, 0x38, 0x8E, 0x47, 0x38, 0x97, 0x70, 0x27, 0xE4, 0x9A,
+    0x75, 0x00, 0x07, 0x01, 0xD4, 0xEE, 0x63, 0xB4, 0x1E, 0x7A, 0x74, 0x20, 0xFE, 0x74, 0x16, 0x8F,
+    0x39, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0xA8, 0xFC, 0xA5, 0x09, 0x8A, 0x76, 0x28, 0xC5, 0x28,
+    0x14, 0x16, 0x80, 0x0A, 0x50, 0x28, 0x02, 0x9D, 0x8A, 0x45, 0xA1, 0x31, 0x4A, 0x05, 0x2E, 0x29,
+    0x40, 0xA0, 0xB4, 0x26, 0x29, 0xD8, 0xA3, 0x14, 0xA0, 0x50, 0x5A, 0x00, 0x29, 0x40, 0xA5, 0x02,
+    0x97, 0x14, 0x16, 0x84, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0x82, 0x90, 0x62, 0x97, 0x14, 0x62,
+    0x9C, 0x05, 0x05, 0xA1, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x13, 0x14, 0xE0, 0x28,
+    0xC5, 0x28, 0x14, 0x16, 0x83, 0x14, 0xB8, 0xA3, 0x14, 0xE0, 0x28, 0x2D, 0x08, 0x05, 0x28, 0x14,
+    0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x62, 0x94, 0x0A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0xC5, 0x2E, 0x29,
+    0x71, 0x4A, 0x05, 0x05, 0xA1, 0x00, 0xA5, 0x02, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x06, 0x2E, 0x18,
+    0x17, 0x59, 0x0A, 0x8E, 0x8B, 0xD8, 0x29, 0x55, 0xE4, 0x4B, 0xD3, 0x27, 0xA6, 0x38, 0x1E, 0xBD,
+    0xC9, 0x6C, 0x56, 0xF2, 0x27, 0x31, 0xC4, 0xBC, 0xFE, 0xF4, 0x88, 0x7F, 0x8C, 0x0C, 0x90, 0x02,
+    0xAF, 0xAA, 0x72, 0x30, 0x7F, 0x1C, 0xF2, 0x15, 0x90, 0x11, 0xF7, 0xD9, 0xA3, 0x39, 0x50, 0x7F,
+    0xE7, 0x94, 0xC7, 0xD4, 0x0C, 0x9C, 0x2B, 0x03, 0xF8, 0xE7, 0x3D, 0x69, 0xFE, 0x69, 0x0B, 0xF3,
+    0xBF, 0x99, 0xC7, 0x9C, 0x51, 0xC7, 0xDC, 0x73, 0x9C, 0x6E, 0x24, 0x0E, 0xA7, 0x93, 0x83, 0xC7,
+    0x5C, 0x0A, 0x45, 0xA0, 0x74, 0x92, 0x35, 0x3E, 0x63, 0x46, 0xC3, 0xA4, 0xE4, 0xE7, 0x0A, 0x46,
+    0x07, 0xEE, 0xC8, 0xF5, 0xEE, 0x4E, 0x7D, 0x3A, 0xE6, 0xA3, 0x16, 0xCB, 0x19, 0xC3, 0xA0, 0x89,
+    0xFA, 0xAE, 0xD6, 0xF9, 0x48, 0x07, 0xF8, 0x0B, 0x73, 0xF2, 0xF3, 0x91, 0xC8, 0xF5, 0x3D, 0x2A,
+    0xC4, 0x4F, 0x08, 0x03, 0x73, 0x4A, 0x87, 0x3B, 0x0B, 0xB9, 0x27, 0xCB, 0x70, 0xC4, 0x1E, 0x5C,
+    0x1C, 0x10, 0x48, 0x27, 0xB1, 0x23, 0xF1, 0xA8, 0xAE, 0x0A, 0xC4, 0xC4, 0x2C, 0x97, 0x1B, 0xB3,
+    0xE7, 0x6F, 0x45, 0x1F, 0x75, 0x7D, 0x13, 0x00, 0x70, 0xC7, 0x27, 0x8C, 0x7E, 0x34, 0x14, 0x89,
+    0x1A, 0x37, 0x39, 0xF3, 0x62, 0x28, 0x18, 0x79, 0x6A, 0xC4, 0x8C, 0x9F, 0x97, 0x1D, 0x33, 0x8C,
+    0xB6, 0x47, 0xDE, 0x6E, 0x7B, 0x73, 0x4B, 0x28, 0x40, 0x41, 0x58, 0xD1, 0xD1, 0x41, 0x37, 0x21,
+    0x88, 0x3B, 0xF7, 0xF5, 0x27, 0x1C, 0xF2, 0x71, 0x82, 0x49, 0xE9, 0xF8, 0xD0, 0x63, 0x21, 0x9B,
+    0x2A, 0x11, 0xBF, 0xD6, 0xBE, 0x3F, 0x87, 0x76, 0x39, 0x12, 0x1E, 0x9B, 0x73, 0xD7, 0x04, 0x75,
+    0xE9, 0xCE, 0x48, 0xA4, 0x5C, 0x9F, 0x34, 0xB1, 0xE8, 0x87, 0x3C, 0x6F, 0x9D, 0x82, 0xF0, 0xA8,
+    0x4A, 0x9C, 0xFC, 0xD9, 0x27, 0x8F, 0x53, 0xD0, 0x64, 0x2D, 0x09, 0x0C, 0xC1, 0x37, 0x79, 0x8A,
+    0x58, 0x60, 0x85, 0x92, 0x5C, 0x72, 0xC5, 0x7B, 0x63, 0xFB, 0xC0, 0x9F, 0xE2, 0xEA, 0x78, 0xCF,
+    0x79, 0x04, 0x21, 0x4E, 0x3C, 0xC7, 0x78, 0xC0, 0x55, 0xB8, 0x8C, 0x92, 0x36, 0x92, 0x9C, 0x6F,
+    0x2C, 0x38, 0xC8, 0x1D, 0x8F, 0x07, 0x19, 0xED, 0x4C, 0x6F, 0x31, 0x18, 0x05, 0x99, 0x80, 0xE0,
+    0xB4, 0x43, 0x6E, 0x11, 0x63, 0x19, 0x04, 0x4B, 0x8E, 0x88, 0x79, 0xFB, 0xBF, 0x9D, 0x4E, 0x92,
+    0xC9, 0xCE, 0xFF, 0x00, 0x3D, 0x8F, 0xFA, 0xAF, 0x2C, 0x2F, 0x24, 0xBF, 0x20, 0xBC, 0x8F, 0x8E,
+    0x9E, 0x9C, 0x7F, 0x4A, 0x0B, 0x44, 0x10, 0xB0, 0x4C, 0x6F, 0x05, 0x54, 0x8C, 0x6D, 0x5E, 0x30,
+    0xE0, 0x9C, 0x90, 0x1B, 0x18, 0xC3, 0x71, 0xD7, 0x18, 0x20, 0xF0, 0x29, 0xD1, 0xBC, 0x43, 0x88,
+    0x24, 0x88, 0x8C, 0x80, 0xC1, 0x54, 0x92, 0x62, 0x45, 0xE3, 0xF8, 0x4E, 0x72, 0xD8, 0xE7, 0x1F,
+    0x51, 0x8C, 0x0A, 0x7F, 0xAF, 0xD9, 0xA4, 0x2C, 0xA3, 0x2D, 0x19, 0x93, 0x81, 0x2E, 0x41, 0xC9,
+    0xDC, 0x0E, 0x73, 0x87, 0x1E, 0x83, 0x1F, 0x4A, 0x48, 0xF2, 0x4A, 0x83, 0x10, 0x63, 0x90, 0x59,
+    0x40, 0xE3, 0x6C, 0xA3, 0x3C, 0x12, 0x07, 0x52, 0x46, 0x41, 0xE7, 0x1D, 0xE8, 0x2D, 0x13, 0x34,
+    0x8C, 0x3E, 0x60, 0x1D, 0x54, 0xF3, 0x28, 0xC6, 0x76, 0x11, 0x8E, 0x06, 0x47, 0x58, 0xC8, 0x3C,
+    0x91, 0x8C, 0x75, 0xC8, 0xE8, 0x4E, 0xE1, 0x00, 0x0C, 0xEE, 0xB9, 0x22, 0x38, 0xF2, 0x39, 0x83,
+    0xCB, 0x18, 0x3C, 0x8E, 0x3E, 0x61, 0xD4, 0x67, 0xDF, 0x9E, 0x94, 0xC3, 0x0C, 0xEA, 0x0E, 0xC0,
+    0x8A, 0x17, 0x71, 0x2F, 0x81, 0xCB, 0xB0, 0xFE, 0x06, 0xF6, 0x5C, 0x75, 0x5E, 0x9D, 0xF0, 0x45,
+    0x24, 0x76, 0x91, 0x2F, 0xFA, 0xA6, 0x94, 0xB0, 0x24, 0xCE, 0x08, 0xEA, 0xCB, 0xD4, 0x67, 0x6F,
+    0x24, 0x63, 0x3E, 0x9D, 0xF1, 0xD2, 0x82, 0xD0, 0xF6, 0x90, 0x2F, 0x57, 0x2F, 0x26, 0xDF, 0xDE,
+    0x32, 0x28, 0xFF, 0x00, 0x50, 0x14, 0x9E, 0x84, 0x91, 0x90, 0xBD, 0xF1, 0x9F, 0x9B, 0xBF, 0x79,
+    0x5A, 0x78, 0xDC, 0xF1, 0x20, 0x50, 0x32, 0xF7, 0x49, 0xBB, 0xE6, 0x23, 0x90, 0x33, 0x9F, 0x4E,
+    0xBD, 0x40, 0x1F, 0x5C, 0x1A, 0xA7, 0xB0, 0x1E, 0x20, 0x94, 0x0C, 0xE0, 0x2F, 0x1F, 0x2B, 0x6F,
+    0x3C, 0x6E, 0x08, 0x7F, 0x84, 0xF1, 0xCA, 0x8C, 0x67, 0x38, 0x15, 0x6A, 0x18, 0x42, 0x91, 0xFB,
+    0xC2, 0x23, 0xC0, 0xCC, 0x7D, 0x48, 0x50, 0x09, 0xCE, 0x54, 0x63, 0x09, 0xB8, 0x1F, 0x41, 0xD8,
+    0xF4, 0xA0, 0xB4, 0x32, 0x39, 0x7B, 0xB9, 0x27, 0x92, 0x19, 0x8F, 0x55, 0x94, 0x63, 0xEE, 0x3B,
+    0x01, 0x8D, 0xD8, 0xEC, 0x3A, 0x0E, 0x7A, 0x52, 0xAC, 0xAC, 0x4F, 0x53, 0x20, 0x00, 0x3C, 0x72,
+    0x2B, 0x60, 0xA6, 0x48, 0xDC, 0x43, 0x1C, 0xFD, 0xD7, 0xED, 0xD3, 0x8F, 0xCD, 0xEC, 0x18, 0x91,
+    0xF3, 0xC9, 0xB7, 0xFD, 0x60, 0x3C, 0x62, 0x51, 0x0E, 0x7F, 0xD6, 0xE7, 0x1C, 0xE7, 0xDB, 0x80,
+    0x07, 0x07, 0xB4, 0x12, 0x21, 0x04, 0xF9, 0x9B, 0x55, 0x4E, 0x55, 0x64, 0x65, 0x39, 0xFB, 0xA3,
+    0xE6, 0x50, 0x09, 0xEE, 0x4E, 0x08, 0xC6, 0x7B, 0x50, 0x5A, 0x27, 0x8A, 0x46, 0xC6, 0x1E, 0x46,
+    0x20, 0x7C, 0xAD, 0x24, 0x8B, 0x90, 0x54, 0x2F, 0x50, 0xAA, 0x3F, 0x8F, 0xA1, 0xE4, 0x1C, 0x1C,
+    0xD3, 0xDA, 0xE9, 0x08, 0x3E, 0x5D, 0xCF, 0x92, 0x07, 0x2D, 0xBB, 0xEF, 0x17, 0x61, 0xD9, 0xB2,
+    0x7A, 0x80, 0x09, 0xC8, 0x3E, 0xF4, 0x01, 0x16, 0x70, 0x18, 0x24, 0xB8, 0xF3, 0x3C, 0xBC, 0x75,
+    0x93, 0x91, 0xF2, 0x8E, 0x3E, 0xEF, 0xCD, 0x8E, 0x3A, 0x10, 0x73, 0x8E, 0x29, 0xD3, 0xC3, 0x23,
+    0xF2, 0x90, 0x4C, 0x5B, 0xFD, 0x6A, 0xC2, 0xE4, 0xE4, 0x6E, 0x19, 0xC0, 0x18, 0x1F, 0x74, 0xF1,
+    0xC1, 0xCE, 0x3B, 0x64, 0x02, 0x02, 0xD1, 0x14, 0x71, 0x91, 0xB4, 0x42, 0x1D, 0xB3, 0xC2, 0x00,
+    0xD9, 0xF2, 0xD7, 0x70, 0xFB, 0x99, 0xF7, 0x03, 0xDB, 0x3C, 0x35, 0x4B, 0x01, 0xDA, 0xA3, 0x6C,
+    0x40, 0x8E, 0x21, 0x67, 0x0D, 0x93, 0xE5, 0x39, 0x20, 0xE1, 0x95, 0x7F, 0x84, 0x80, 0x3E, 0xE9,
+    0xED, 0xCD, 0x20, 0xB9, 0x2D, 0x9C, 0xC9, 0x18, 0xCE, 0xD4, 0x59, 0x49, 0x20, 0x34, 0x8B, 0x9F,
+    0xBD, 0xCB, 0x7D, 0xE0, 0x31, 0xC7, 0xE1, 0x8E, 0x0D, 0x4E, 0x5F, 0x7F, 0xFA, 0xC9, 0x1C, 0x0E,
+    0x5E, 0xD9, 0x46, 0x41, 0x98, 0x1E, 0xEE, 0x80, 0xF4, 0xDE, 0x78, 0x18, 0x07, 0xF3, 0xE4, 0x2D,
+    0x11, 0xC0, 0x19, 0x31, 0xB9, 0x99, 0xDB, 0x06, 0x20, 0xC8, 0x72, 0x04, 0x44, 0x8C, 0x90, 0xA8,
+    0x47, 0x45, 0xE9, 0xD7, 0xB7, 0x43, 0xC5, 0x0C, 0xD2, 0x4A, 0x9F, 0x2E, 0xC6, 0x8F, 0x2C, 0x88,
+    0x88, 0x07, 0xEF, 0x1E, 0x25, 0xEA, 0xE5, 0x8F, 0xA0, 0xE3, 0x85, 0xFE, 0x54, 0x5A, 0x99, 0x09,
+    0x06, 0x14, 0x8E, 0x56, 0xE5, 0xF8, 0x39, 0x2E, 0x36, 0x67, 0xEF, 0x81, 0xC6, 0xF7, 0xC9, 0xCE,
+    0x39, 0x3C, 0x76, 0xA4, 0xB3, 0x84, 0xA8, 0xC2, 0xA4, 0xEA, 0xFC, 0x67, 0x18, 0xC4, 0x48, 0xCD,
+    0xFC, 0x44, 0x81, 0x8D, 0xC7, 0xB8, 0xCF, 0xA8, 0xEE, 0x28, 0x29, 0x11, 0x47, 0x0B, 0x1C, 0x7C,
+    0xAD, 0xBB, 0x82, 0xAF, 0x91, 0xCA, 0x4A, 0x48, 0x38, 0x50, 0x7B, 0x67, 0x8E, 0x99, 0xC7, 0x1C,
+    0x54, 0xFF, 0x00, 0x67, 0x81, 0x89, 0xEC, 0x09, 0x31, 0xB2, 0x1E, 0x4B, 0x94, 0xE8, 0x61, 0x63,
+    0xBB, 0xEF, 0xB8, 0x23, 0x8C, 0xFD, 0x0E, 0x2A, 0x38, 0xE2, 0x62, 0x78, 0x59, 0x55, 0xBF, 0xD6,
+    0x4F, 0x20, 0x61, 0xBA, 0x3D, 0xCE, 0x32, 0x51, 0x40, 0xED, 0x9E, 0x3F, 0x2C, 0x0C, 0xD2, 0xB4,
+    0x4A, 0x1B, 0x2F, 0x2C, 0x48, 0x09, 0xDB, 0x22, 0xB7, 0xF0, 0xE4, 0x8C, 0x04, 0x28, 0x7A, 0x6D,
+    0x1E, 0xB8, 0x5E, 0x83, 0x26, 0x82, 0xD1, 0x34, 0x70, 0x33, 0x01, 0xB9, 0x59, 0x63, 0xF9, 0x51,
+    0x64, 0x5D, 0xA7, 0x6B, 0x30, 0x5F, 0xBA, 0x3B, 0x64, 0x13, 0xF4, 0xEA, 0x73, 0x48, 0x5B, 0x39,
+    0x00, 0x11, 0x1E, 0x36, 0x3B, 0x48, 0x30, 0x24, 0x27, 0x24, 0x99, 0x1C, 0x03, 0xD1, 0xCF, 0x1D,
+    0x31, 0x9E, 0x06, 0x01, 0xCC, 0x65, 0xAD, 0xC1, 0xC1, 0x0C, 0x06, 0x77, 0x48, 0xED, 0x80, 0x10,
+    0x22, 0xFF, 0x00, 0xCB, 0x2E, 0xF9, 0x50, 0xC3, 0x8C, 0x9F, 0x50, 0x49, 0xE6, 0x9C, 0xAA, 0x84,
+    0x62, 0x3F, 0x38, 0x2E, 0x77, 0x39, 0x56, 0x1C, 0xA2, 0xB1, 0xE4, 0xB0, 0x38, 0x39, 0x03, 0x8E,
+    0x73, 0xC1, 0xE7, 0xD4, 0x2D, 0x08, 0xAD, 0x31, 0x03, 0xF7, 0xD2, 0xB2, 0x9F, 0x99, 0xD1, 0x5B,
+    0xE6, 0x70, 0x17, 0xF8, 0x50, 0x1E, 0x9D, 0x7B, 0x9C, 0xFE, 0x22, 0xA7, 0x5D, 0xAC, 0x3F, 0xD0,
+    0x98, 0xA9, 0xE5, 0x95, 0x1C, 0xFD, 0xE7, 0xDC, 0x3A, 0x0E, 0x3E, 0xE9, 0xC7, 0x72, 0x18, 0xF5,
+    0xCE, 0x39, 0x55, 0x81, 0x0F, 0x0D, 0x20, 0x03, 0xE6, 0x68, 0x57, 0xA6, 0xD5, 0x59, 0x79, 0x18,
+    0x03, 0x90, 0xC7, 0x39, 0x19, 0x1C, 0xF0, 0x31, 0xD6, 0x99, 0x1A, 0x48, 0x98, 0x23, 0xCC, 0x23,
+    0x1B, 0xC9, 0x19, 0x05, 0x14, 0x85, 0x27, 0x39, 0x23, 0xFD, 0x5E, 0x3B, 0x7D, 0x07, 0x27, 0x20,
+    0x2D, 0x0A, 0x10, 0x8C, 0xEF, 0x92, 0x62, 0x58, 0xEE, 0x57, 0xDA, 0x70, 0x9E, 0x68, 0x3C, 0xC2,
+    0x39, 0xED, 0xC7, 0x04, 0x9E, 0x78, 0xA6, 0xDC, 0x4F, 0x20, 0x50, 0x19, 0xE5, 0x85, 0x71, 0xB5,
+    0x25, 0x5C, 0x9D, 0xB1, 0x26, 0x38, 0x97, 0x81, 0xD1, 0x4F, 0x1D, 0x3D, 0xEA, 0x43, 0x1C, 0xAB,
+    0xF7, 0x5F, 0x7E, 0xE1, 0xBA, 0x47, 0x07, 0xE5, 0xC2, 0x02, 0x70, 0xA7, 0x6F, 0xA3, 0x64, 0x72,
+    0x58, 0x81, 0x90, 0x45, 0x31, 0x66, 0xDC, 0xA0, 0x4E, 0x4C, 0x8B, 0xF7, 0x92, 0x31, 0x81, 0xB9,
+    0x54, 0x63, 0xF7, 0x69, 0xEE, 0x03, 0x76, 0xF6, 0xEB, 0xD1, 0x16, 0x8F, 0x3F, 0xC5, 0x38, 0x0A,
+    0x31, 0x4A, 0x05, 0x51, 0xF9, 0x4A, 0x00, 0x29, 0x40, 0xA0, 0x0A, 0x76, 0x28, 0x2D, 0x08, 0x05,
+    0x2E, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28, 0x14, 0x62, 0x94, 0x0A, 0x0B, 0x40, 0x05,
+    0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x80, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x0C,
+    0x52, 0x81, 0x46, 0x29, 0xC0, 0x50, 0x52, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA1,
+    0x00, 0xA7, 0x62, 0x80, 0x29, 0x71, 0x48, 0xB4, 0x18, 0xA5, 0x02, 0x8C, 0x53, 0x80, 0xA0, 0xB4,
+    0x20, 0x14, 0xA0, 0x52, 0x81, 0x4B, 0x8A, 0x0B, 0x40, 0x05, 0x2E, 0x28, 0x02, 0x97, 0x14, 0x16,
+    0x83, 0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x0B, 0x42, 0x01, 0x4E, 0x02, 0x80, 0x29, 0x71, 0x41,
+    0x68, 0x00, 0xA5, 0xC5, 0x00, 0x53, 0xB1, 0x41, 0x68, 0x86, 0xD9, 0x08, 0x6F, 0xDE, 0x82, 0xC3,
+    0x25, 0x95, 0x73, 0xC6, 0xD2, 0x3B, 0xC4, 0x47, 0x5E, 0xBF, 0x8F, 0x3C, 0xF2, 0x69, 0xC4, 0x4D,
+    0xD0, 0xC4, 0x1D, 0x0F, 0xCC, 0x00, 0x1C, 0x9D, 0xB8, 0xC7, 0x99, 0x1E, 0x7F, 0x84, 0x80, 0x3D,
+    0xB9, 0x00, 0x8A, 0x58, 0x66, 0xE1, 0xB1, 0x2C, 0x69, 0x82, 0x70, 0xB8, 0xEA, 0xC1, 0x7F, 0xE5,
+    0xA4, 0x99, 0xE0, 0x10, 0x07, 0x4C, 0x72, 0x7B, 0x77, 0x9A, 0xE6, 0xEC, 0x22, 0xFE, 0xEA, 0x7D,
+    0xC3, 0x1B, 0x95, 0x0E, 0x07, 0x93, 0xBB, 0x91, 0x94, 0x65, 0xEA, 0xD8, 0xEA, 0x58, 0xFA, 0xF3,
+    0x9C, 0x50, 0x52, 0x04, 0x4D, 0xB8, 0xDC, 0x4A, 0xB9, 0xF9, 0x50, 0xB3, 0x72, 0x87, 0x18, 0xCB,
+    0x1C, 0x75, 0xE4, 0x9E, 0x07, 0x61, 0xEB, 0x4D, 0x92, 0x65, 0x3C, 0x85, 0x3D, 0x30, 0x5D, 0xC0,
+    0xE1, 0xDA, 0x3C, 0x00, 0xD1, 0x80, 0x38, 0x45, 0x1D, 0x00, 0x20, 0xF4, 0xEE, 0x69, 0x43, 0xB3,
+    0xA8, 0x2D, 0x11, 0x8C, 0x75, 0xBB, 0x75, 0x27, 0x23, 0x71, 0xEC, 0x7B, 0x8D, 0x87, 0xDF, 0x03,
+    0x04, 0x50, 0x12, 0x36, 0xDC, 0x5E, 0x37, 0x67, 0xC8, 0x1E, 0x5E, 0x72, 0x1F, 0x3F, 0xF3, 0xCE,
+    0x5C, 0x8C, 0xF1, 0xC9, 0xE4, 0x60, 0x64, 0x76, 0xE0, 0x2D, 0x0B, 0x17, 0x94, 0xC3, 0xF7, 0x92,
+    0x65, 0x31, 0xE6, 0x61, 0xC1, 0xF9, 0xD8, 0xF7, 0x98, 0x03, 0xC7, 0x24, 0x72, 0x46, 0x48, 0x27,
+    0xAF, 0x79, 0x0D, 0xE1, 0x65, 0xC2, 0xA9, 0x58, 0xCE, 0x52, 0xDC, 0x30, 0xC9, 0x77, 0x1D, 0x02,
+    0x47, 0xD7, 0x3D, 0xBE, 0xF0, 0xC0, 0xE7, 0x8C, 0xD4, 0x53, 0x1C, 0x8D, 0xB0, 0x60, 0x36, 0x44,
+    0xDD, 0x0E, 0x70, 0x98, 0xE5, 0x14, 0x0E, 0xBD, 0x01, 0x18, 0xF7, 0xA7, 0xC2, 0x06, 0xD6, 0xC0,
+    0x20, 0xE0, 0x79, 0xE8, 0xE3, 0x3E, 0x67, 0x9C, 0x47, 0x50, 0x0F, 0xA7, 0xB8, 0xC1, 0xCF, 0x4C,
+    0xE6, 0x82, 0xD0, 0xAC, 0x41, 0x03, 0xE7, 0x09, 0x90, 0x1A, 0x46, 0x8C, 0xE3, 0x78, 0x47, 0x23,
+    0x25, 0x88, 0x19, 0xE3, 0x3D, 0xFF, 0x00, 0x0E, 0x84, 0xAA, 0x90, 0x80, 0x11, 0x22, 0x03, 0x9C,
+    0x92, 0x88, 0x40, 0x2E, 0x14, 0x9C, 0x86, 0xDB, 0xD4, 0xAF, 0xB8, 0x07, 0x3F, 0x89, 0x7A, 0xC6,
+    0x4E, 0x02, 0xB1, 0x20, 0x9C, 0x45, 0x1A, 0x1E, 0x23, 0x75, 0x07, 0x2B, 0x2C, 0x6A, 0x79, 0x0A,
+    0x3B, 0xF5, 0x39, 0xA1, 0x3F, 0xD8, 0x1B, 0x59, 0x98, 0xAC, 0xA4, 0x9C, 0xEC, 0x72, 0xC7, 0x27,
+    0x70, 0x1F, 0xC2, 0xA7, 0xB0, 0x00, 0x7F, 0x17, 0xB8, 0x5A, 0x21, 0xF2, 0xE5, 0x52, 0xBB, 0x59,
+    0x4E, 0x30, 0x60, 0xB7, 0x62, 0x73, 0x34, 0x83, 0xF8, 0x94, 0x30, 0x23, 0x96, 0x6F, 0x5F, 0x7E,
+    0x95, 0x2D, 0xA9, 0x4D, 0xA7, 0x0B, 0x18, 0x6C, 0x08, 0xC2, 0x81, 0x85, 0x08, 0x4F, 0xCC, 0x73,
+    0xC7, 0x44, 0x39, 0xEA, 0x78, 0x39, 0xE4, 0x52, 0x5C, 0x40, 0xDB, 0x73, 0x33, 0x23, 0x83, 0x90,
+    0x92, 0x3F, 0x00, 0xB2, 0x0F, 0xF9, 0x66, 0xA0, 0x71, 0xBB, 0x1D, 0x00, 0xC9, 0xC7, 0xD6, 0xA4,
+    0x66, 0x3D, 0xA0, 0x4C, 0x93, 0xFE, 0xB0, 0x74, 0x91, 0x72, 0x39, 0x84, 0xED, 0x1C, 0x36, 0x46,
+    0x30, 0x49, 0xF4, 0xE4, 0xE6, 0x82, 0xD0, 0xA6, 0x5E, 0x0B, 0x3B, 0xAE, 0xDF, 0x91, 0x23, 0xCA,
+    0xB6, 0x06, 0x5B, 0xBE, 0xEF, 0x50, 0x7D, 0x4E, 0x07, 0xEA, 0xC2, 0x58, 0x30, 0x2C, 0xB0, 0xE3,
+    0xAA, 0x48, 0x0E, 0x7C, 0xBC, 0xB0, 0x23, 0x2A, 0x33, 0xC4, 0x87, 0xA0, 0xE0, 0xF5, 0xE6, 0x9E,
+    0xCB, 0xB7, 0x0D, 0xE7, 0x7C, 0xC1, 0x7C, 0xDD, 0xCA, 0x3B, 0xA8, 0x23, 0xF7, 0xA4, 0xE0, 0xFD,
+    0xEE, 0x38, 0x1D, 0xBA, 0x53, 0x92, 0x74, 0xDC, 0x08, 0x40, 0x14, 0x65, 0xD6, 0x25, 0x03, 0x03,
+    0x70, 0x3C, 0xCC, 0x99, 0x1D, 0x54, 0xE3, 0x95, 0x03, 0xBF, 0x4E, 0xA1, 0x68, 0x80, 0x32, 0xB2,
+    0x91, 0x20, 0xEA, 0x44, 0x8A, 0x87, 0x1F, 0xBC, 0x76, 0x5F, 0xE0, 0x5C, 0x0C, 0x33, 0x71, 0xEB,
+    0xC1, 0xE8, 0x73, 0x56, 0x61, 0x93, 0x1B, 0x44, 0xC6, 0x36, 0x5C, 0x19, 0x1B, 0x77, 0x24, 0xEC,
+    0xE7, 0xE6, 0x23, 0x39, 0xEE, 0x47, 0x4F, 0x62, 0x7B, 0x35, 0x97, 0x20, 0x19, 0x26, 0x13, 0x63,
+    0x12, 0xA4, 0x51, 0x90, 0x4B, 0xB3, 0x39, 0xC8, 0xC6, 0x79, 0xC9, 0x23, 0xA8, 0xE3, 0xA0, 0x1C,
+    0xD3, 0xA4, 0x97, 0x24, 0xEC, 0x91, 0xD5, 0x71, 0x99, 0x10, 0xA9, 0xF9, 0x42, 0x8F, 0xBA, 0xA0,
+    0xF7, 0x04, 0xE7, 0xA0, 0xE9, 0xDC, 0x52, 0x2D, 0x0C, 0x4B, 0x8C, 0xB1, 0xDB, 0x16, 0x1F, 0xEE,
+    0x33, 0xE1, 0x7E, 0x65, 0x93, 0x04, 0x92, 0xDC, 0xFF, 0x00, 0x13, 0x1E, 0x83, 0x90, 0x46, 0x09,
+    0x3C, 0xD3, 0xFF, 0x00, 0xD2, 0x32, 0x30, 0xDB, 0xC1, 0xF9, 0x6D, 0x9C, 0xB7, 0x0E, 0xA8, 0x3F,
+    0xB8, 0x4F, 0x21, 0x13, 0x9E, 0x71, 0xCF, 0xE8, 0xB6, 0xF0, 0x15, 0xE1, 0x88, 0x1C, 0x89, 0x08,
+    0xCE, 0x7C, 0xDC, 0x39, 0xE7, 0x9C, 0x8E, 0x4F, 0xBE, 0x33, 0x80, 0x70, 0x71, 0x84, 0x19, 0xC9,
+    0x06, 0x36, 0x68, 0xB8, 0xF3, 0x92, 0x30, 0xA7, 0x72, 0xBA, 0xB6, 0x36, 0x48, 0x0F, 0x3F, 0x31,
+    0x3D, 0xB3, 0x8E, 0xA6, 0x82, 0xD0, 0xE6, 0x59, 0xF8, 0xC4, 0x0F, 0x11, 0x04, 0x0B, 0x52, 0x87,
+    0x88, 0x4E, 0x48, 0xF9, 0x49, 0xE8, 0x0A, 0xF5, 0xE3, 0xB7, 0x41, 0x9A, 0x8F, 0x32, 0x6E, 0xE6,
+    0x60, 0xA4, 0xFE, 0xF0, 0x38, 0x18, 0x02, 0x36, 0x27, 0x97, 0x71, 0x9C, 0x06, 0x0C, 0x40, 0xF7,
+    0xEB, 0xEA, 0x5E, 0xB3, 0x38, 0x00, 0xC4, 0xC8, 0xB2, 0x1E, 0x56, 0xD9, 0x72, 0x78, 0x38, 0x07,
+    0xCA, 0x5C, 0x1C, 0x91, 0xD7, 0x3C, 0xE7, 0xBF, 0x4C, 0x16, 0xC3, 0x22, 0x00, 0x72, 0xF9, 0x94,
+    0x81, 0x16, 0x08, 0x04, 0xB1, 0x61, 0xFC, 0x61, 0x88, 0xE5, 0xFA, 0x1E, 0x0F, 0xD7, 0x91, 0x41,
+    0x68, 0x99, 0xAE, 0x18, 0xFC, 0xAC, 0xC9, 0xE5, 0x81, 0x94, 0xB8, 0x07, 0x1B, 0x4A, 0x83, 0xC4,
+    0x20, 0x28, 0x1C, 0x8E, 0x3F, 0x03, 0xCD, 0x47, 0x14, 0xCF, 0x86, 0xC9, 0x58, 0x89, 0x0A, 0x91,
+    0x39, 0x6F, 0xF5, 0x48, 0xF9, 0xF9, 0xB3, 0xDC, 0xF1, 0x9E, 0xD8, 0xC6, 0x45, 0x3D, 0x13, 0x72,
+    0xE0, 0x6C, 0x64, 0x38, 0x76, 0x28, 0x33, 0xF7, 0x39, 0xC3, 0x10, 0x3A, 0xB7, 0x4C, 0xED, 0x39,
+    0xF6, 0xEE, 0xC8, 0xFE, 0x51, 0x86, 0x8D, 0x19, 0x80, 0xF2, 0x64, 0x45, 0x5F, 0xBA, 0xDB, 0x8E,
+    0x31, 0xCE, 0x7E, 0x6C, 0x91, 0xEA, 0x3D, 0x0F, 0x4A, 0x0A, 0x43, 0xA2, 0x46, 0x65, 0x61, 0x32,
+    0x91, 0x22, 0xE5, 0x88, 0x23, 0x98, 0xD4, 0xA6, 0x79, 0x94, 0x8E, 0xAE, 0x0F, 0xBF, 0x4F, 0xA6,
+    0x26, 0x95, 0x8E, 0xD1, 0xBE, 0x7D, 0xC0, 0xE4, 0x43, 0x96, 0x03, 0xCC, 0x1B, 0x06, 0x73, 0x26,
+    0x3B, 0x1C, 0xE7, 0xA1, 0x23, 0xA7, 0x7C, 0xB2, 0x5B, 0x75, 0xE0, 0x8C, 0xA9, 0x39, 0x52, 0xAC,
+    0xA7, 0x76, 0xD0, 0x4F, 0xDE, 0x5E, 0xFB, 0x4F, 0x5E, 0x32, 0x3A, 0xE2, 0x9B, 0x71, 0xE6, 0x9F,
+    0xF5, 0x73, 0x88, 0x9B, 0x6F, 0x94, 0x19, 0x5B, 0xE5, 0x77, 0x57, 0x20, 0x6D, 0x24, 0xFA, 0xF1,
+    0xD7, 0x23, 0x19, 0xE9, 0x83, 0x41, 0x68, 0x9D, 0xB7, 0x12, 0x7E, 0xCC, 0xB9, 0x7F, 0xBF, 0x85,
+    0xE9, 0x2C, 0x05, 0x4E, 0x3A, 0x7A, 0x26, 0x3D, 0x3F, 0x1A, 0x65, 0xAB, 0x49, 0x1A, 0x93, 0x16,
+    0x48, 0xFB, 0xED, 0x22, 0x8C, 0x84, 0x6E, 0x77, 0x10, 0xAA, 0x47, 0x01, 0x46, 0x7F, 0x2E, 0x29,
+    0x5D, 0x64, 0x5D, 0x84, 0x63, 0x6E, 0xCD, 0xF2, 0x48, 0x49, 0xF9, 0x9D, 0x81, 0x3D, 0xCF, 0x21,
+    0xF0, 0x38, 0xF4, 0xE1, 0xAA, 0x24, 0x31, 0x87, 0xFF, 0x00, 0x53, 0x2C, 0x6D, 0xC4, 0xD0, 0xC7,
+    0x9E, 0x58, 0xAA, 0x8F, 0xE1, 0x6C, 0x73, 0x95, 0xFE, 0xEE, 0x4F, 0xA1, 0xA0, 0xB4, 0x48, 0xE5,
+    0x79, 0x0C, 0x80, 0xA7, 0xDF, 0x01, 0x89, 0xFD, 0xF0, 0xDC, 0xB9, 0x24, 0xE0, 0xF0, 0xA8, 0x17,
+    0xB0, 0x1E, 0x83, 0xB8, 0x96, 0x57, 0x50, 0x79, 0x0A, 0xC0, 0xE3, 0xED, 0x13, 0x29, 0x62, 0x8C,
+    0x76, 0xE4, 0x9D, 0x8A, 0x40, 0xF9, 0xB3, 0xD3, 0x90, 0x7B, 0xE3, 0x9A, 0xAE, 0xA6, 0x51, 0xCE,
+    0x5A, 0x7E, 0x44, 0x7F, 0x68, 0x6E, 0x84, 0x0C, 0x60, 0x04, 0x62, 0x38, 0x7C, 0x91, 0xDB, 0xEB,
+    0xCE, 0x2A, 0x68, 0x98, 0x1E, 0x22, 0x91, 0x5D, 0x39, 0x08, 0xFB, 0x3A, 0xEC, 0x24, 0x8D, 0xBB,
+    0x80, 0xE8, 0x0E, 0x39, 0xF7, 0xE7, 0x14, 0x16, 0x80, 0xC1, 0x10, 0x18, 0x46, 0x8D, 0xF0, 0xB9,
+    0x59, 0x7A, 0x7C, 0xAE, 0x71, 0xFC, 0x44, 0xE0, 0x93, 0xEC, 0x3B, 0xD1, 0xE5, 0xAA, 0xF3, 0x71,
+    0x1B, 0x81, 0xB8, 0x34, 0x8C, 0xBC, 0xED, 0x0E, 0xBD, 0x1F, 0x76, 0x08, 0xDC, 0x70, 0x7A, 0x74,
+    0xE0, 0x73, 0x52, 0xCB, 0x18, 0x38, 0x36, 0x92, 0x21, 0x5C, 0x89, 0x58, 0xAB, 0x73, 0x0B, 0x2E,
+    0x79, 0x20, 0x8F, 0x7E, 0x9F, 0x5C, 0xE7, 0xA8, 0x40, 0xA0, 0x9C, 0x21, 0x50, 0x01, 0xF9, 0x66,
+    0x05, 0x81, 0x77, 0x90, 0x7F, 0x02, 0x0F, 0xEF, 0x02, 0x9E, 0xD9, 0x3D, 0xE8, 0x2D, 0x0A, 0xF1,
+    0xC6, 0x98, 0x1E, 0x7B, 0x42, 0xEA, 0x7C, 0xD7, 0x50, 0x0E, 0x21, 0x4F, 0x30, 0x80, 0x59, 0x81,
+    0xEE, 0x87, 0xBE, 0x4F, 0x4C, 0x7B, 0x82, 0x38, 0xD8, 0xE2, 0x19, 0x36, 0x26, 0x3C, 0xC6, 0x3D,
+    0x46, 0xE5, 0x23, 0x3E, 0x61, 0xDC, 0x08, 0xDB, 0xB4, 0x1F, 0x6F, 0xC4, 0x66, 0x6B, 0x69, 0x5C,
+    0x73, 0x04, 0x6B, 0xC1, 0x2C, 0x71, 0x9C, 0xCF, 0x18, 0x20, 0x7E, 0xE9, 0x47, 0x4C, 0xF1, 0xC7,
+    0x6C, 0x00, 0x45, 0x32, 0x1B, 0xA9, 0xB2, 0x00, 0x72, 0x0F, 0x0D, 0x3B, 0x76, 0xD8, 0xC5, 0x79,
+    0x50, 0x54, 0x1C, 0x65, 0x8F, 0x6C, 0x0E, 0x83, 0x8A, 0x0B, 0x47, 0x9D, 0x01, 0x4A, 0x05, 0x00,
+    0x53, 0x80, 0xAA, 0x3F, 0x29, 0x42, 0x62, 0x97, 0x14, 0xB8, 0xA5, 0xC5, 0x22, 0xD0, 0x01, 0x4B,
+    0x8A, 0x00, 0xA5, 0x02, 0x82, 0xD0, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xA0, 0x50, 0x5A, 0x13, 0x14,
+    0xB8, 0xA5, 0xC5, 0x2E, 0x28, 0x2D, 0x00, 0x14, 0xB8, 0xA0, 0x0A, 0x70, 0x14, 0x14, 0x84, 0x02,
+    0x94, 0x0A, 0x50, 0x29, 0x40, 0xA0, 0xB4, 0x26, 0x29, 0xD8, 0xA3, 0x14, 0xB8, 0xA0, 0xB4, 0x00,
+    0x52, 0xE2, 0x80, 0x29, 0xC0, 0x50, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0x02, 0x82, 0xD0,
+    0x62, 0x97, 0x14, 0x62, 0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x52, 0x81, 0x4A, 0x05, 0x05, 0xA1,
+    0x00, 0xA5, 0x02, 0x94, 0x0A, 0x50, 0x28, 0x2D, 0x06, 0x29, 0x71, 0x46, 0x29, 0xD8, 0xA0, 0xB4,
+    0x20, 0x14, 0xB8, 0xA5, 0x02, 0x94, 0x0A, 0x45, 0x21, 0x2D, 0x9A, 0x63, 0x90, 0x59, 0x99, 0x86,
+    0x7C, 0xA5, 0x5C, 0xFC, 0x9E, 0x61, 0xC2, 0xE4, 0x8C, 0x0E, 0xBF, 0xA7, 0x39, 0xA9, 0x57, 0x3C,
+    0xEF, 0x2C, 0x57, 0x04, 0xC9, 0x1B, 0x9C, 0x6F, 0x8C, 0x93, 0xC3, 0xBF, 0x1F, 0x78, 0xFA, 0xF5,
+    0x1D, 0x6A, 0x34, 0xF2, 0x39, 0x2E, 0x81, 0x86, 0x0C, 0x04, 0x29, 0x23, 0x73, 0x27, 0x27, 0x2B,
+    0xC7, 0x62, 0x39, 0xC9, 0x19, 0xE6, 0x95, 0x11, 0x14, 0x67, 0x74, 0xCE, 0x9C, 0x20, 0x90, 0x81,
+    0xF2, 0xBE, 0xEF, 0x98, 0x46, 0x3D, 0x38, 0x1C, 0x61, 0x87, 0x5C, 0x71, 0x9A, 0x0B, 0x44, 0x70,
+    0xCA, 0xCE, 0x7E, 0x56, 0xF3, 0x43, 0x60, 0x79, 0x3D, 0xE5, 0x68, 0x54, 0x90, 0x09, 0x1F, 0xDC,
+    0x38, 0xCF, 0x4C, 0xF6, 0xEF, 0x99, 0x9E, 0xDD, 0x87, 0x51, 0x1A, 0xA9, 0x21, 0x0A, 0xE0, 0xE5,
+    0x37, 0x8C, 0x0F, 0x30, 0x63, 0xF8, 0x94, 0x1C, 0x8E, 0x30, 0x0E, 0x7D, 0x29, 0x89, 0x34, 0xBC,
+    0x9F, 0x34, 0x16, 0xC6, 0xD9, 0x72, 0x08, 0xD9, 0x10, 0x27, 0x01, 0xE4, 0x51, 0xFC, 0x60, 0xFD,
+    0x7E, 0x86, 0xA5, 0x52, 0xA0, 0xE0, 0xC6, 0xF2, 0xF3, 0xE7, 0xB4, 0x85, 0x4F, 0xCE, 0xD8, 0x3C,
+    0x4D, 0xBB, 0xA0, 0x27, 0x3E, 0xBC, 0x7B, 0xF4, 0x0B, 0x43, 0xC4, 0x4A, 0xB9, 0xDF, 0x2F, 0xEE,
+    0xC0, 0x2C, 0x61, 0x24, 0x1D, 0xC7, 0x7F, 0x39, 0x5C, 0xF5, 0x50, 0x3D, 0x49, 0xFA, 0x1C, 0x54,
+    0x31, 0xC6, 0xE8, 0x7F, 0xD2, 0x03, 0x95, 0xE7, 0xCD, 0x60, 0xFF, 0x00, 0xEB, 0x13, 0x69, 0xE1,
+    0xCA, 0xE7, 0x97, 0xCE, 0x46, 0x58, 0x67, 0xBF, 0x5A, 0x91, 0x19, 0xD7, 0x18, 0x9B, 0xA8, 0xC4,
+    0xA7, 0x03, 0x38, 0x20, 0x72, 0x8F, 0xEC, 0x71, 0x9C, 0x95, 0x1C, 0x73, 0xD2, 0xA3, 0x55, 0x55,
+    0xC7, 0x95, 0xBF, 0x3F, 0xF1, 0xF2, 0xE8, 0x3F, 0xE5, 0x9E, 0xD3, 0x91, 0xB4, 0x10, 0x30, 0x02,
+    0xF3, 0xD0, 0xE7, 0xB7, 0xB0, 0x5A, 0x25, 0x66, 0x51, 0xD1, 0x5C, 0x10, 0x7C, 0xD5, 0x00, 0x01,
+    0xB1, 0x1F, 0xFB, 0xC4, 0x2E, 0x47, 0x96, 0x14, 0xFB, 0xF6, 0xE4, 0x52, 0xA4, 0x80, 0x12, 0x3C,
+    0xD5, 0x62, 0x7E, 0x59, 0x56, 0x30, 0x30, 0xDB, 0x71, 0xCE, 0x40, 0xC9, 0x32, 0x67, 0xD3, 0x07,
+    0x38, 0x39, 0xA5, 0x24, 0x9C, 0x09, 0xA2, 0x52, 0x33, 0xE4, 0x85, 0x53, 0xFE, 0xAD, 0xA4, 0xDD,
+    0x92, 0xC4, 0x9C, 0x82, 0xC3, 0xEA, 0x0E, 0x0E, 0x0F, 0x7A, 0x53, 0x6F, 0x0E, 0xEC, 0xA8, 0x91,
+    0x50, 0xFC, 0xA5, 0x40, 0xFF, 0x00, 0x56, 0x77, 0xE3, 0xE7, 0xC9, 0x61, 0x8E, 0x38, 0xE3, 0x3E,
+    0x94, 0x16, 0x86, 0xCB, 0x21, 0x90, 0x7C, 0xFB, 0x02, 0x82, 0x0C, 0x31, 0x8C, 0x64, 0x44, 0xDD,
+    0xE4, 0x46, 0xC8, 0xE4, 0xE3, 0xAA, 0x9F, 0xCB, 0x9A, 0x79, 0x08, 0x70, 0x24, 0x97, 0x73, 0x13,
+    0xBE, 0x37, 0xDD, 0x9D, 0x8E, 0x0B, 0x1C, 0x92, 0x4F, 0x01, 0xCF, 0xA2, 0xF1, 0xDF, 0x26, 0x9D,
+    0x3A, 0x83, 0xF7, 0x5A, 0x4D, 0xDF, 0x72, 0x32, 0x87, 0xFD, 0x66, 0xE2, 0x78, 0x39, 0x27, 0xA9,
+    0x18, 0x1C, 0x83, 0xD7, 0x38, 0x1C, 0x54, 0x52, 0xBE, 0x18, 0xED, 0x8A, 0x42, 0xF8, 0x2A, 0xD2,
+    0x67, 0x39, 0x1D, 0x3E, 0x74, 0x20, 0x60, 0x33, 0x63, 0xB7, 0x5E, 0x07, 0x34, 0x16, 0x85, 0x86,
+    0x22, 0xC7, 0x06, 0x30, 0x1C, 0x7C, 0x85, 0x1F, 0x90, 0x62, 0x01, 0x71, 0xB5, 0x49, 0xEE, 0x0E,
+    0x39, 0x03, 0xA0, 0xCF, 0x3C, 0x15, 0x8C, 0x39, 0x40, 0x27, 0x8E, 0x4D, 0x9D, 0x17, 0xA6, 0x21,
+    0xF2, 0xFA, 0xE7, 0x7E, 0x7E, 0xE8, 0xC8, 0xFC, 0x3A, 0x1E, 0x82, 0x4B, 0x45, 0xDA, 0x7F, 0xD4,
+    0x46, 0xBC, 0x98, 0xDF, 0xE7, 0x6C, 0x5C, 0x12, 0xB8, 0xC1, 0x8F, 0x93, 0xC1, 0xF5, 0x18, 0x1E,
+    0xF5, 0x32, 0x46, 0xAB, 0x80, 0x26, 0x40, 0xA3, 0xF7, 0x25, 0x0A, 0x9E, 0xB3, 0x15, 0x3F, 0x29,
+    0xEC, 0x4F, 0x6E, 0x87, 0xD7, 0xD4, 0x05, 0xA2, 0xBB, 0xBC, 0x6F, 0xC1, 0xE7, 0x80, 0xA9, 0xE6,
+    0x67, 0x2D, 0x84, 0xE3, 0xCB, 0x89, 0x7B, 0x8F, 0x52, 0x46, 0x07, 0xB6, 0x72, 0xB6, 0x51, 0xB2,
+    0x9C, 0x4C, 0x64, 0x3C, 0x64, 0x44, 0xC7, 0x8F, 0x2E, 0x40, 0x7F, 0xD6, 0x6F, 0x23, 0xFE, 0x59,
+    0x8E, 0xC0, 0x7E, 0x14, 0xFF, 0x00, 0xF4, 0xCE, 0x4C, 0xF1, 0xC2, 0x50, 0x7C, 0xC1, 0xA4, 0x65,
+    0xC1, 0x3B, 0x70, 0x36, 0xE0, 0x75, 0x19, 0xFF, 0x00, 0x13, 0xD2, 0x92, 0x2B, 0x49, 0x93, 0x88,
+    0x25, 0x46, 0x5E, 0x8A, 0x1B, 0x19, 0x04, 0x0C, 0x6E, 0xDB, 0xD8, 0x03, 0xC7, 0x0D, 0x8E, 0x39,
+    0xC8, 0x39, 0xA0, 0xB4, 0x11, 0xB3, 0x37, 0x12, 0x3E, 0xD7, 0x3F, 0xBB, 0x49, 0x64, 0xCE, 0x64,
+    0x83, 0x39, 0xC6, 0x14, 0xFF, 0x00, 0x16, 0x47, 0x75, 0x20, 0x73, 0xC8, 0xC5, 0x3A, 0x54, 0x2F,
+    0x93, 0x2B, 0x81, 0x83, 0x98, 0xD4, 0xA8, 0x07, 0xCB, 0xDA, 0x38, 0x03, 0x9C, 0xEC, 0xCE, 0x3A,
+    0x63, 0xA7, 0x24, 0x74, 0x7C, 0x0A, 0xD2, 0x70, 0xD8, 0x8F, 0xB8, 0xDA, 0x4E, 0x51, 0x9D, 0xCF,
+    0x00, 0xB7, 0x42, 0x0F, 0x1D, 0x78, 0x3E, 0xA7, 0x80, 0xDF, 0x3A, 0x39, 0x00, 0xE0, 0x82, 0x48,
+    0x2E, 0xCD, 0xC8, 0x08, 0x0E, 0x0B, 0x34, 0x79, 0x1C, 0x1E, 0x07, 0x40, 0x3D, 0x07, 0x18, 0x01,
+    0x68, 0x7B, 0xBA, 0x6D, 0x3B, 0x5E, 0x56, 0x3C, 0xEE, 0x39, 0x27, 0x68, 0x42, 0x76, 0x85, 0x6E,
+    0x06, 0x17, 0x76, 0x79, 0x27, 0x27, 0xA0, 0x34, 0xC9, 0xD3, 0x68, 0x52, 0x0A, 0x32, 0xF5, 0x44,
+    0x73, 0xC7, 0x96, 0xDC, 0x11, 0x1C, 0x99, 0xEB, 0xCE, 0x7A, 0x63, 0x1D, 0xCE, 0x29, 0x72, 0xE4,
+    0x2F, 0x99, 0x29, 0x54, 0x07, 0x1E, 0x60, 0x38, 0xD9, 0xCE, 0x01, 0x27, 0xD9, 0x7D, 0xF1, 0xD3,
+    0xBF, 0x14, 0x20, 0x65, 0x51, 0xE6, 0x81, 0xC7, 0xC9, 0xBE, 0x36, 0xC8, 0x6E, 0x79, 0xC2, 0x83,
+    0xFC, 0x47, 0x6F, 0x40, 0x0F, 0xA9, 0x07, 0x8A, 0x0B, 0x43, 0x58, 0x49, 0x80, 0x15, 0xD8, 0x92,
+    0x08, 0xE4, 0x82, 0x17, 0xE6, 0x3C, 0x9D, 0xA0, 0xF0, 0x00, 0x20, 0xF1, 0xEC, 0x47, 0x4A, 0x7C,
+    0x2C, 0xAA, 0x09, 0x18, 0xE7, 0x2D, 0x18, 0x50, 0x17, 0xCB, 0x77, 0x63, 0xC2, 0x31, 0xCF, 0x19,
+    0x07, 0xAE, 0x3D, 0x81, 0x34, 0xF4, 0x2A, 0x31, 0x9F, 0x34, 0xF1, 0xBC, 0x48, 0x02, 0xFC, 0xDE,
+    0x58, 0x3F, 0x74, 0x9C, 0xE4, 0xC6, 0x71, 0x81, 0x91, 0x8E, 0xBF, 0x58, 0x6D, 0x9D, 0xF2, 0xC1,
+    0x91, 0x77, 0xFF, 0x00, 0xAC, 0x4C, 0x0D, 0xD8, 0x4D, 0xB9, 0xC2, 0x37, 0x3F, 0x77, 0x19, 0xFC,
+    0x30, 0x3B, 0xE0, 0x29, 0x12, 0xC6, 0xEC, 0x9F, 0xEB, 0xA4, 0x8C, 0x8E, 0xB3, 0x4B, 0x91, 0x95,
+    0x90, 0x48, 0x38, 0xD8, 0x31, 0xF7, 0x32, 0x7A, 0x63, 0xD8, 0x1E, 0x28, 0x8A, 0x35, 0xC9, 0xF3,
+    0x24, 0x8C, 0xAF, 0xFC, 0xB4, 0x00, 0x76, 0x70, 0x3F, 0xD6, 0xB2, 0x83, 0xF7, 0x43, 0x1E, 0xB9,
+    0xCF, 0xAF, 0x5C, 0x4E, 0xC2, 0x43, 0x9F, 0x32, 0x38, 0x7A, 0xB3, 0x33, 0x02, 0x0E, 0xD2, 0x5B,
+    0x90, 0x5B, 0x3F, 0x74, 0x29, 0x52, 0x48, 0x03, 0x07, 0x93, 0x51, 0x36, 0xC0, 0x07, 0x9D, 0x2D,
+    0xA2, 0x93, 0x96, 0x54, 0xC7, 0xDE, 0x39, 0x03, 0xE6, 0x93, 0x1F, 0xC2, 0x32, 0x79, 0x04, 0x73,
+    0xC8, 0xC7, 0x40, 0xB4, 0x2A, 0x24, 0x27, 0x21, 0x65, 0x8D, 0xE3, 0x63, 0x88, 0xD4, 0x67, 0x2B,
+    0x10, 0x3D, 0xB8, 0x27, 0x25, 0x88, 0xE3, 0x9F, 0x5C, 0x83, 0x4E, 0x77, 0x66, 0x04, 0x86, 0x3E,
+    0x5F, 0xCC, 0xD1, 0xA8, 0x51, 0xF2, 0x16, 0x63, 0xD7, 0x3D, 0xDD, 0x41, 0xF6, 0xCF, 0x07, 0x9A,
+    0x21, 0x96, 0x41, 0x8F, 0x33, 0x12, 0x29, 0xCC, 0x78, 0x53, 0x80, 0xE7, 0x27, 0xFD, 0x74, 0x4B,
+    0x9E, 0x7D, 0xB1, 0x83, 0xE8, 0x4F, 0x54, 0xB8, 0x04, 0x7F, 0xAD, 0x95, 0xF6, 0xFF, 0x00, 0x1C,
+    0x45, 0x4E, 0x22, 0x8F, 0x1C, 0xF9, 0x41, 0x54, 0xFD, 0xDC, 0x7B, 0x11, 0xCE, 0xEC, 0xD0, 0x5A,
+    0x1A, 0x61, 0x87, 0xFE, 0x5B, 0xA3, 0x8F, 0xE1, 0x56, 0x2E, 0x32, 0x33, 0x8E, 0x0B, 0x12, 0x73,
+    0x90, 0xD8, 0xFD, 0x7D, 0xA9, 0xE1, 0xA7, 0x62, 0xA1, 0x63, 0x21, 0xB1, 0xB4, 0x14, 0x19, 0x01,
+    0xC1, 0x51, 0x96, 0xE7, 0xFE, 0x59, 0x90, 0x3B, 0x67, 0xD6, 0x96, 0x38, 0xA7, 0x4C, 0xF9, 0x56,
+    0xE5, 0x94, 0xE2, 0x58, 0x4C, 0x8C, 0x08, 0x94, 0x83, 0x92, 0x55, 0x9B, 0x1C, 0xFE, 0xBD, 0x38,
+    0xCE, 0x48, 0x22, 0x8C, 0xED, 0xC2, 0xA6, 0xF2, 0x0F, 0xDA, 0x37, 0x2B, 0x1F, 0xDD, 0x07, 0x5E,
+    0x0C, 0x8F, 0xC7, 0x20, 0x0F, 0x5F, 0xA9, 0xA4, 0x5A, 0x21, 0xF9, 0x86, 0xDD, 0xC6, 0x3E, 0x4A,
+    0xAB, 0x49, 0xD4, 0x33, 0x8E, 0x98, 0x6E, 0xDB, 0x88, 0x3D, 0x18, 0xF1, 0x9E, 0x07, 0x00, 0xBD,
+    0xDA, 0x51, 0x8F, 0x29, 0x98, 0x03, 0xF3, 0x46, 0x8B, 0xD4, 0xA2, 0xAE, 0x72, 0x83, 0x9E, 0x48,
+    0xFA, 0xE0, 0xF4, 0xEB, 0xCC, 0xC7, 0x25, 0x89, 0x0F, 0xB5, 0x0E, 0x56, 0x51, 0xC8, 0x2F, 0xB7,
+    0x38, 0xF3, 0x19, 0xFB, 0xF0, 0xDD, 0x48, 0xC7, 0xAF, 0x40, 0x5C, 0xB3, 0xC4, 0xC0, 0x79, 0xD2,
+    0x40, 0x00, 0x3B, 0x99, 0x50, 0xB0, 0xD8, 0xA6, 0x33, 0xCE, 0x31, 0x9C, 0x60, 0xF6, 0xC0, 0xA0,
+    0xB4, 0x27, 0x9C, 0x3A, 0xAC, 0x6E, 0x08, 0xDC, 0x59, 0xB1, 0xC0, 0xF2, 0xB2, 0x72, 0xA0, 0x67,
+    0xD3, 0xB1, 0x1D, 0x31, 0x4E, 0xB7, 0xB4, 0x60, 0x7F, 0x7D, 0x2B, 0x6C, 0x38, 0x9A, 0x30, 0x41,
+    0xCA, 0xFC, 0xA4, 0x9D, 0xEC, 0x07, 0x5E, 0xA3, 0x23, 0x27, 0x3D, 0xF8, 0xC5, 0x38, 0x42, 0x76,
+    0xE5, 0x20, 0x12, 0x2E, 0x52, 0x16, 0x45, 0x39, 0xF9, 0x91, 0xFF, 0x00, 0x85, 0x4E, 0x3A, 0x9C,
+    0xFE, 0x7C, 0xE3, 0x1C, 0x1B, 0xDD, 0x08, 0xFB, 0x4F, 0xCE, 0xDC, 0xDB, 0xBC, 0xD1, 0x9E, 0x63,
+    0x27, 0x90, 0x11, 0x87, 0x71, 0xC8, 0xC0, 0xE7, 0xEB, 0xC5, 0x05, 0xA3, 0xCE, 0xB1, 0x4A, 0x05,
+    0x2E, 0x29, 0x40, 0xAA, 0x3F, 0x29, 0x42, 0x62, 0x9D, 0x8A, 0x31, 0x4A, 0x05, 0x05, 0xA0, 0x02,
+    0x94, 0x0A, 0x50, 0x29, 0x71, 0x41, 0x68, 0x4C, 0x52, 0x81, 0x4B, 0x8A, 0x50, 0x28, 0x2D, 0x06,
+    0x29, 0x71, 0x46, 0x29, 0xC0, 0x50, 0x52, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5, 0xC5, 0x05, 0xA1,
+    0x31, 0x4E, 0x02, 0x8C, 0x52, 0x81, 0x48, 0xB4, 0x18, 0xA5, 0xC5, 0x18, 0xA7, 0x01, 0x41, 0x68,
+    0x40, 0x29, 0x40, 0xA5, 0x02, 0x97, 0x14, 0x16, 0x83, 0x14, 0xA0, 0x51, 0x8A, 0x50, 0x28, 0x2D,
+    0x06, 0x29, 0x71, 0x4B, 0x8A, 0x50, 0x28, 0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82,
+    0xD0, 0x62, 0x94, 0x0A, 0x31, 0x4E, 0x02, 0x82, 0xD0, 0x98, 0xA5, 0xC5, 0x2E, 0x29, 0x40, 0xA0,
+    0xB4, 0x20, 0x14, 0xE0, 0x28, 0x02, 0x97, 0x14, 0x14, 0x89, 0x5D, 0x95, 0x41, 0xCA, 0xC6, 0x4F,
+    0x06, 0x3C, 0xFF, 0x00, 0xCF, 0x40, 0x9B, 0x86, 0x40, 0xC1, 0xEA, 0x3F, 0xBD, 0xCF, 0xA7, 0xAB,
+    0x04, 0x43, 0x6E, 0x61, 0x4D, 0xA4, 0x12, 0x25, 0x50, 0xA7, 0x05, 0xD8, 0xFF, 0x00, 0x12, 0x1F,
+    0x41, 0x9E, 0xDC, 0x67, 0x38, 0x19, 0x35, 0x10, 0xD9, 0x9C, 0xE2, 0x32, 0x72, 0xA9, 0xE5, 0x90,
+    0x7A, 0x83, 0xD7, 0xCB, 0x1D, 0x48, 0xED, 0xD3, 0xAF, 0x7C, 0xE6, 0xAD, 0x09, 0xE5, 0x07, 0xFD,
+    0x44, 0xAA, 0x4F, 0xEE, 0xE4, 0x2E, 0x3F, 0xD6, 0xAE, 0x01, 0xCB, 0x29, 0x27, 0x93, 0xD3, 0xDB,
+    0xB9, 0xC0, 0xA0, 0xB4, 0x33, 0xCA, 0x98, 0xB6, 0x52, 0x4F, 0x2D, 0x8F, 0xCB, 0x72, 0x72, 0x08,
+    0x7C, 0x29, 0xC9, 0x5C, 0xFF, 0x00, 0x78, 0xF1, 0x8D, 0xDC, 0x73, 0x8E, 0x29, 0x12, 0x13, 0xBC,
+    0x6E, 0x89, 0xD0, 0x7F, 0x13, 0x12, 0x40, 0x5D, 0x99, 0xFB, 0xC4, 0x7F, 0x7F, 0x69, 0x3D, 0xC7,
+    0x3D, 0x32, 0x32, 0x59, 0x0C, 0xC0, 0xFF, 0x00, 0xA8, 0x9A, 0x37, 0xE8, 0x37, 0x05, 0x3B, 0x62,
+    0x45, 0x55, 0x19, 0x62, 0xE4, 0x70, 0x02, 0x8E, 0xA0, 0xF3, 0xC7, 0xA1, 0x33, 0xBC, 0x8E, 0x73,
+    0x9C, 0xC7, 0xD5, 0xC2, 0x32, 0x8F, 0x91, 0xE3, 0x5E, 0x7C, 0xD9, 0x70, 0xDC, 0x85, 0x1E, 0xED,
+    0xEB, 0xDA, 0x82, 0xD0, 0xD1, 0x21, 0x00, 0xEE, 0x8E, 0x30, 0x0F, 0xEE, 0xDB, 0x77, 0x0C, 0xC8,
+    0xCB, 0xD5, 0xC2, 0xF5, 0x2E, 0x76, 0x8C, 0xE7, 0x83, 0xC6, 0x3A, 0xD4, 0x66, 0x17, 0xC8, 0xE5,
+    0xD8, 0x11, 0xBB, 0xE5, 0x1C, 0xC4, 0xC9, 0xFD, 0xCD, 0xBF, 0xDD, 0xC0, 0xE4, 0x00, 0x3A, 0x66,
+    0x96, 0x3B, 0x9C, 0x0F, 0x95, 0x2E, 0x00, 0xCE, 0xDF, 0x2C, 0x93, 0xB9, 0x18, 0xE3, 0xF8, 0x88,
+    0x1C, 0x33, 0x71, 0xFC, 0x87, 0xAC, 0xA2, 0x45, 0x2B, 0xFE, 0xB2, 0xE2, 0x3C, 0x10, 0xA5, 0x9B,
+    0xF8, 0x19, 0x09, 0x38, 0x78, 0x89, 0xE0, 0x60, 0x63, 0xD0, 0x71, 0xEF, 0x41, 0x68, 0x6F, 0x97,
+    0xBB, 0xE6, 0x32, 0xC6, 0xA0, 0x92, 0x59, 0x8B, 0x60, 0x62, 0x4F, 0x55, 0xE4, 0xF0, 0xC7, 0x3D,
+    0x7B, 0x72, 0x00, 0xC1, 0xA1, 0xED, 0xC8, 0x24, 0xED, 0x8C, 0xB0, 0x1B, 0xF2, 0x46, 0x03, 0x31,
+    0x6C, 0x92, 0x48, 0x03, 0xD4, 0x0C, 0x70, 0x48, 0x3D, 0x85, 0x4C, 0xAE, 0xA7, 0x21, 0xE6, 0x56,
+    0x3C, 0xAB, 0xB3, 0x10, 0x7C, 0xC8, 0xCC, 0x63, 0x94, 0x07, 0x3C, 0x13, 0x93, 0x8C, 0x8F, 0x7E,
+    0x3A, 0x47, 0x13, 0x2F, 0x06, 0xD8, 0x3B, 0xA2, 0xFC, 0xAB, 0x21, 0x39, 0x2A, 0x30, 0xA4, 0x9C,
+    0xE4, 0x64, 0x2E, 0x4F, 0x04, 0x77, 0xFC, 0x00, 0x5A, 0x26, 0x90, 0x38, 0x39, 0xB6, 0xDD, 0xBB,
+    0x99, 0x3C, 0xBC, 0x1D, 0x84, 0x67, 0xF8, 0xC6, 0x7A, 0xB2, 0x36, 0x7A, 0x73, 0xE9, 0xEB, 0x5A,
+    0x79, 0x01, 0xE2, 0x56, 0x5D, 0xBF, 0x2C, 0xF7, 0x21, 0x73, 0x8D, 0xE1, 0xF1, 0xD1, 0xBF, 0xD9,
+    0x07, 0xB0, 0x5E, 0x83, 0x9E, 0x32, 0xE4, 0x9C, 0x7C, 0xD8, 0x79, 0x01, 0xCF, 0xEE, 0x91, 0x08,
+    0x18, 0x0F, 0x83, 0x92, 0x33, 0x9F, 0x9D, 0xB1, 0xD0, 0x93, 0xDB, 0xA9, 0xA5, 0x8F, 0x04, 0xFE,
+    0xEE, 0x7D, 0xDC, 0x66, 0x60, 0xC7, 0x04, 0x47, 0xF3, 0x72, 0x5F, 0x23, 0xA0, 0xE7, 0x9C, 0xE7,
+    0xBF, 0x1D, 0x02, 0xD1, 0x35, 0xD4, 0x44, 0xE4, 0xC5, 0x0B, 0x8E, 0xEE, 0xEB, 0xC0, 0x66, 0x62,
+    0x3E, 0xF0, 0x20, 0xF6, 0xE9, 0x8D, 0xC7, 0xB6, 0x71, 0x51, 0x24, 0x48, 0x7A, 0xCA, 0x8F, 0x93,
+    0x99, 0x1F, 0x38, 0x0C, 0x9B, 0xBA, 0xC8, 0xE3, 0xA7, 0x42, 0x7B, 0xE3, 0x3E, 0xA6, 0x85, 0x46,
+    0xDA, 0x09, 0x60, 0x4E, 0x03, 0x46, 0xD8, 0x27, 0xEC, 0xA0, 0x81, 0x92, 0xC8, 0x47, 0xA0, 0xF7,
+    0x27, 0xAF, 0x6A, 0xB3, 0x26, 0x64, 0xFB, 0xC2, 0x46, 0x23, 0x95, 0x0B, 0xD5, 0x80, 0x23, 0x38,
+    0x04, 0x90, 0x49, 0x55, 0x3D, 0x0E, 0x41, 0x38, 0xC1, 0x39, 0xC2, 0x2D, 0x04, 0xAA, 0xB8, 0x3B,
+    0x1A, 0x52, 0xCA, 0x3C, 0xBD, 0xE0, 0x6D, 0x00, 0x2A, 0xF5, 0xDA, 0x0F, 0xFB, 0x5C, 0x70, 0x47,
+    0x18, 0xEE, 0x49, 0xAF, 0x1B, 0x9C, 0x9D, 0xCD, 0xF2, 0x02, 0x09, 0x95, 0x58, 0x81, 0x30, 0x52,
+    0xC4, 0x6C, 0x03, 0xA6, 0xFF, 0x00, 0xE7, 0xD0, 0xE7, 0xAC, 0xF1, 0xC0, 0xDC, 0xF9, 0xC9, 0x10,
+    0x8F, 0xAC, 0x4E, 0x83, 0x9B, 0x70, 0xAB, 0xCE, 0xD5, 0x2B, 0xF5, 0xEF, 0x9C, 0x83, 0xC7, 0x06,
+    0x9B, 0x24, 0x71, 0x29, 0x3B, 0x55, 0x7F, 0x84, 0xB8, 0x5C, 0xFC, 0x92, 0x23, 0x1C, 0x92, 0x32,
+    0x38, 0xC1, 0xC1, 0xE0, 0x7A, 0xFB, 0x10, 0xB4, 0x29, 0xB7, 0xDA, 0x09, 0xFB, 0x39, 0x8C, 0xE7,
+    0x6C, 0x12, 0xBB, 0xF0, 0x81, 0x32, 0x38, 0xEB, 0x8E, 0xBD, 0xDB, 0x39, 0xE7, 0x3C, 0x13, 0x49,
+    0x2B, 0x2F, 0x3E, 0x7C, 0x6C, 0x14, 0xF1, 0x6F, 0x0E, 0xD1, 0x98, 0xD5, 0xB3, 0xDC, 0x67, 0xF8,
+    0x71, 0xCF, 0x38, 0xED, 0xD0, 0x0A, 0x22, 0x89, 0xB6, 0x8F, 0x99, 0x33, 0xFE, 0xB6, 0x26, 0x8F,
+    0xE5, 0xF9, 0x1C, 0x01, 0x87, 0x38, 0x6F, 0xB8, 0xA4, 0xF6, 0x3D, 0x73, 0x9E, 0xB5, 0x25, 0xB8,
+    0x42, 0x0F, 0x95, 0x9E, 0x00, 0x6B, 0x56, 0x38, 0xFF, 0x00, 0x47, 0x11, 0xB3, 0x13, 0x9E, 0x0F,
+    0x2E, 0x73, 0xDB, 0x8E, 0xF8, 0xCD, 0x05, 0xA1, 0x00, 0x4D, 0xD9, 0x78, 0x8E, 0xE2, 0x77, 0x8B,
+    0x76, 0x3C, 0x86, 0xDA, 0xDC, 0xB2, 0x37, 0x5E, 0x7D, 0xF3, 0xD3, 0x18, 0xC6, 0x29, 0xDE, 0x63,
+    0x06, 0xDA, 0xD2, 0xB3, 0xB0, 0xCA, 0xC4, 0x06, 0x30, 0x24, 0x18, 0xC1, 0x46, 0x1D, 0x30, 0x07,
+    0x4E, 0x3D, 0xB1, 0x52, 0x28, 0x08, 0xDF, 0xE9, 0x53, 0x15, 0x03, 0x2C, 0xCE, 0x01, 0xCB, 0x06,
+    0xEC, 0xED, 0x8C, 0xFC, 0xC7, 0x27, 0x18, 0x00, 0x9C, 0x8C, 0x11, 0x50, 0xB1, 0xD9, 0xFE, 0xAE,
+    0xE3, 0x74, 0xA7, 0xE7, 0x19, 0x38, 0x39, 0x72, 0x46, 0x24, 0xDC, 0x79, 0xD8, 0x49, 0xED, 0x9E,
+    0xB9, 0xC5, 0x05, 0x20, 0x44, 0x95, 0x54, 0x87, 0xDE, 0xBF, 0x79, 0x64, 0xDB, 0xC0, 0x69, 0xB8,
+    0xE7, 0x24, 0x8F, 0xE1, 0xC7, 0x6F, 0xCF, 0x9A, 0x9E, 0xDD, 0xA4, 0x91, 0x80, 0x59, 0x9C, 0x28,
+    0xE4, 0x90, 0x30, 0x02, 0x80, 0x39, 0x08, 0x07, 0x77, 0xC6, 0x3E, 0x6C, 0xFD, 0x73, 0xC4, 0xA0,
+    0x92, 0x0E, 0x52, 0x45, 0xC8, 0x2A, 0xF1, 0x64, 0x0D, 0xA1, 0x33, 0x90, 0x84, 0xE7, 0x21, 0x81,
+    0xF4, 0x00, 0x75, 0x1D, 0xC8, 0x47, 0x55, 0x91, 0x46, 0xF8, 0x99, 0xE2, 0xFF, 0x00, 0x57, 0x1C,
+    0x43, 0x1F, 0x22, 0xED, 0x1C, 0xB8, 0x43, 0x80, 0x46, 0x0F, 0x71, 0x8C, 0xF4, 0xED, 0x41, 0x68,
+    0x8E, 0xD6, 0xE9, 0x5B, 0x1E, 0x6C, 0xEC, 0xA3, 0x27, 0x2E, 0x4F, 0x3E, 0x62, 0xFE, 0x03, 0x07,
+    0x07, 0xDF, 0xAF, 0xE5, 0x2E, 0x55, 0x81, 0xF2, 0x23, 0x7D, 0xDC, 0x97, 0x00, 0x71, 0xB9, 0xF3,
+    0xC9, 0xE0, 0xE7, 0x1D, 0x06, 0x4A, 0xF4, 0xC7, 0x1D, 0x2A, 0x2B, 0xBB, 0x66, 0xC3, 0x6F, 0x85,
+    0x19, 0x7A, 0xB9, 0x61, 0xFE, 0xAA, 0x5D, 0xC7, 0xFD, 0x56, 0x08, 0xE0, 0x64, 0xF1, 0xC7, 0xAF,
+    0x22, 0x91, 0x56, 0x1D, 0xC0, 0x31, 0xDE, 0x79, 0x0A, 0xCC, 0x8B, 0xD1, 0x4E, 0x38, 0x45, 0x07,
+    0x8C, 0x7A, 0x8F, 0xA0, 0xF5, 0x0B, 0x43, 0x23, 0x27, 0xF8, 0xE3, 0x5D, 0xBC, 0x8C, 0xE0, 0x12,
+    0xB1, 0x8C, 0x8C, 0x1D, 0x80, 0x64, 0x30, 0x07, 0xBB, 0x71, 0xEF, 0x8A, 0xB4, 0x8D, 0xBB, 0xE5,
+    0x74, 0x6D, 0xDF, 0xF2, 0xDB, 0xD8, 0xA9, 0xE7, 0x73, 0x29, 0xED, 0xBB, 0x19, 0xE4, 0x93, 0xF7,
+    0xBB, 0x8A, 0x8B, 0xCD, 0x6F, 0x50, 0x46, 0xE0, 0x10, 0x94, 0xFF, 0x00, 0x57, 0x95, 0xE7, 0x04,
+    0xF3, 0x91, 0xD0, 0x72, 0x4F, 0x4C, 0x52, 0xDA, 0xB4, 0x64, 0x31, 0x67, 0x5C, 0x00, 0x0E, 0xDC,
+    0x9C, 0xAC, 0x99, 0x38, 0x56, 0xDA, 0x47, 0xF1, 0x73, 0xC0, 0x3F, 0x85, 0x05, 0xA1, 0xCA, 0xEC,
+    0x43, 0x60, 0x48, 0xEE, 0x1B, 0x7A, 0xB6, 0xD1, 0x91, 0x22, 0x60, 0x2F, 0xCA, 0x3A, 0x60, 0x63,
+    0xD3, 0x8A, 0x55, 0xB5, 0x5C, 0x0C, 0x7C, 0xC1, 0xB3, 0x1C, 0x72, 0xB0, 0xE2, 0x79, 0x38, 0xC1,
+    0x91, 0x89, 0xF5, 0x04, 0xF4, 0x39, 0xF7, 0x34, 0xD4, 0x01, 0xB7, 0x6C, 0x86, 0x55, 0x3F, 0xEB,
+    0x56, 0x53, 0x9F, 0xDE, 0x20, 0xE8, 0x64, 0x7C, 0xE3, 0x2A, 0x73, 0xED, 0xE9, 0x9C, 0x0A, 0xB1,
+    0x0D, 0xA6, 0xE5, 0x5F, 0x3F, 0x77, 0x50, 0x14, 0x1C, 0x1F, 0x95, 0x49, 0xE0, 0x12, 0x47, 0xDD,
+    0x18, 0xE8, 0x73, 0xD7, 0x02, 0x82, 0xD1, 0x0C, 0x08, 0xC1, 0x46, 0xD8, 0x63, 0x51, 0x90, 0x5D,
+    0x49, 0xC9, 0x60, 0xCF, 0x80, 0x20, 0x76, 0xC8, 0xFB, 0xC3, 0xA6, 0x3B, 0x67, 0xAD, 0x49, 0x12,
+    0xBC, 0x84, 0xEF, 0x79, 0x13, 0x6A, 0xED, 0x54, 0x55, 0xCF, 0x98, 0x08, 0xEA, 0xC7, 0x1D, 0xC0,
+    0xEE, 0x06, 0x7F, 0x31, 0x4C, 0x99, 0xE4, 0x42, 0xBE, 0x74, 0xAF, 0xB7, 0x86, 0x59, 0x94, 0x80,
+    0x71, 0x29, 0x39, 0xEE, 0x78, 0x72, 0x33, 0xD0, 0x63, 0xBF, 0xA5, 0x4B, 0x0E, 0xC9, 0x01, 0xC6,
+    0xE4, 0x5E, 0x4C, 0x62, 0x33, 0x9C, 0x61, 0xF8, 0xE1, 0x73, 0xCA, 0x83, 0xC0, 0xE4, 0xE7, 0x90,
+    0x07, 0x52, 0x16, 0x88, 0x6F, 0xFC, 0xB6, 0xFE, 0x32, 0x0E, 0x02, 0x97, 0x60, 0x32, 0x77, 0x11,
+    0xF7, 0x98, 0xB1, 0xC8, 0x03, 0xD8, 0xE3, 0x03, 0x9F, 0x5B, 0x30, 0xA2, 0xAE, 0x09, 0xDC, 0xAB,
+    0x82, 0x53, 0x23, 0x25, 0x12, 0x1E, 0x98, 0xE0, 0x1E, 0xBD, 0x79, 0x3D, 0xB3, 0xC5, 0x40, 0x50,
+    0x7D, 0xD1, 0x19, 0x8F, 0xAC, 0xFB, 0x57, 0x82, 0xAF, 0x91, 0xCC, 0xFC, 0x76, 0x03, 0x18, 0x00,
+    0xF7, 0xC7, 0x6A, 0x74, 0x6C, 0xD8, 0x1B, 0xED, 0xA5, 0x5C, 0xF3, 0x9C, 0xB7, 0xDD, 0xC1, 0xE4,
+    0x45, 0x91, 0xF7, 0x89, 0x19, 0xEE, 0x4E, 0x7D, 0x68, 0x2D, 0x1E, 0x7D, 0x8A, 0x50, 0x28, 0xC5,
+    0x28, 0x14, 0xCF, 0xCA, 0x50, 0x01, 0x4A, 0x05, 0x28, 0x14, 0xB8, 0xA0, 0xB4, 0x20, 0x14, 0xB8,
+    0xA5, 0x02, 0x97, 0x14, 0x16, 0x83, 0x14, 0xA0, 0x51, 0x8A, 0x70, 0x14, 0x16, 0x84, 0x02, 0x94,
+    0x0A, 0x50, 0x29, 0x71, 0x41, 0x48, 0x40, 0x29, 0xD8, 0xA0, 0x0A, 0x5C, 0x50, 0x5A, 0x0C, 0x52,
+    0x81, 0x4B, 0x8A, 0x50, 0x28, 0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0xE2, 0x82, 0xD0, 0x01,
+    0x4B, 0x8A, 0x00, 0xA5, 0xC5, 0x05, 0xA0, 0xC5, 0x28, 0x14, 0xB8, 0xA5, 0x02, 0x82, 0xD0, 0x80,
+    0x53, 0x80, 0xA0, 0x0A, 0x5C, 0x50, 0x5A, 0x00, 0x29, 0x71, 0x40, 0x14, 0xEC, 0x50, 0x5A, 0x13,
+    0x14, 0xA0, 0x52, 0xE2, 0x94, 0x0A, 0x45, 0xA1, 0x00, 0xA7, 0x01, 0x40, 0x14, 0xB8, 0xA0, 0xA4,
+    0x00, 0x52, 0xE2, 0x94, 0x0A, 0x5C, 0x50, 0x5A, 0x10, 0x81, 0x8C, 0x63, 0xFD, 0x90, 0x73, 0x9D,
+    0xC2, 0x5C, 0xFD, 0xE5, 0x23, 0x1C, 0xB9, 0xC7, 0x6F, 0x4E, 0x69, 0xF2, 0xBA, 0x12, 0x77, 0xED,
+    0x51, 0xB4, 0x60, 0xE4, 0xFE, 0xF1, 0x81, 0x20, 0x85, 0x61, 0xC1, 0x2B, 0xD3, 0xA0, 0xE0, 0xF3,
+    0x9A, 0x49, 0x66, 0x93, 0x1C, 0xA2, 0xB6, 0x48, 0xB6, 0x45, 0x19, 0xF9, 0xFE, 0x5E, 0x37, 0x64,
+    0x7A, 0xFB, 0xF0, 0x79, 0xC5, 0x46, 0x2E, 0xA4, 0x51, 0x97, 0xCE, 0x7F, 0xD6, 0x79, 0x8C, 0x0E,
+    0x31, 0x93, 0xD6, 0x44, 0xCE, 0x0B, 0x82, 0xBE, 0xFD, 0xBA, 0x50, 0x5A, 0x26, 0x49, 0x65, 0xF9,
+    0x7E, 0xD0, 0xEE, 0xBB, 0x73, 0xBB, 0x39, 0xDD, 0x1E, 0x58, 0xFA, 0x1E, 0x8C, 0x14, 0x76, 0xC1,
+    0xE8, 0x2A, 0xC5, 0x9A, 0x3B, 0x72, 0x18, 0xA9, 0x52, 0x48, 0x8C, 0x93, 0x95, 0x72, 0x46, 0x79,
+    0xC0, 0x04, 0xF2, 0xD9, 0x38, 0x27, 0xA7, 0x5E, 0xF5, 0x62, 0xB5, 0x52, 0x76, 0x97, 0x49, 0x14,
+    0xFC, 0xB9, 0x0B, 0xF7, 0xBC, 0xB1, 0x8F, 0x94, 0x81, 0xD3, 0x68, 0xFC, 0x09, 0xEF, 0xC5, 0x2C,
+    0x32, 0x47, 0x92, 0x36, 0xC6, 0x49, 0xFD, 0xD2, 0xA4, 0x98, 0x07, 0x61, 0x5E, 0x43, 0x1D, 0x80,
+    0x8C, 0xA8, 0xC0, 0xE0, 0x0F, 0xCE, 0x82, 0xD0, 0x8D, 0xB0, 0x03, 0xF6, 0x51, 0xB7, 0x1F, 0xBD,
+    0x70, 0xCD, 0xF7, 0x00, 0xCF, 0xDF, 0xC9, 0x3D, 0x41, 0xF7, 0xC8, 0xE7, 0xDA, 0x9B, 0x94, 0x71,
+    0xF2, 0x34, 0x8A, 0x31, 0xFB, 0xE8, 0x14, 0xF4, 0x79, 0x5B, 0x80, 0x8B, 0xF3, 0x72, 0x41, 0xEA,
+    0x07, 0xE5, 0xD2, 0xA4, 0x65, 0x67, 0x0B, 0xB9, 0x52, 0x21, 0x9F, 0xDE, 0x1C, 0x8E, 0x65, 0xC8,
+    0xF9, 0xB2, 0x7A, 0x90, 0x0F, 0x43, 0x91, 0xE9, 0xCF, 0x15, 0x3B, 0xC3, 0x1B, 0x36, 0x04, 0x31,
+    0xEE, 0x60, 0x63, 0xBB, 0x88, 0x9C, 0x79, 0x6F, 0x1E, 0x00, 0x3B, 0xB8, 0xC8, 0x66, 0xF4, 0x0B,
+    0x9F, 0xD2, 0x82, 0xD0, 0xD6, 0x86, 0x30, 0x08, 0x36, 0xB0, 0xEC, 0x5C, 0x2C, 0xA4, 0xB0, 0xCA,
+    0xBB, 0x1F, 0x46, 0xF5, 0xF7, 0xE7, 0xDF, 0x8E, 0x22, 0x89, 0x15, 0x98, 0xEC, 0x32, 0x01, 0x82,
+    0xAB, 0xB7, 0x27, 0xF7, 0xAD, 0xD3, 0x7A, 0x1C, 0x74, 0xC8, 0xED, 0x83, 0x83, 0x53, 0x08, 0x55,
+    0x5B, 0xE4, 0x0B, 0xD3, 0x2B, 0x26, 0xDC, 0x05, 0x6C, 0x83, 0xCB, 0x28, 0x1D, 0x48, 0x3C, 0xE3,
+    0x1F, 0xA6, 0x0B, 0xB6, 0x2D, 0xFE, 0xAE, 0x49, 0x06, 0xEC, 0xAB, 0x15, 0x51, 0xF3, 0xC7, 0xB1,
+    0x47, 0xCC, 0x07, 0xFC, 0xF4, 0xC8, 0x1D, 0xB9, 0xC0, 0xE0, 0xF3, 0x41, 0x68, 0x12, 0x57, 0xE3,
+    0x74, 0x88, 0xD1, 0x0F, 0x9E, 0x54, 0xDA, 0x36, 0xC4, 0x03, 0x67, 0x31, 0xB0, 0x24, 0x9D, 0xA0,
+    0xFB, 0x8C, 0x60, 0x92, 0x39, 0xC3, 0x8C, 0x68, 0xDF, 0x7A, 0x44, 0x56, 0xC2, 0xB4, 0xE3, 0x8C,
+    0x21, 0x39, 0x3F, 0x29, 0x4E, 0x7E, 0x57, 0x3D, 0xFF, 0x00, 0x13, 0xC8, 0xA8, 0x9E, 0x31, 0xC6,
+    0x22, 0x7D, 0xC0, 0x12, 0xF0, 0x92, 0x0A, 0xB0, 0x44, 0x1D, 0xD4, 0x93, 0xFB, 0xCD, 0xA3, 0x1C,
+    0x9F, 0x53, 0x9E, 0xA6, 0x79, 0xE2, 0x54, 0x3F, 0xBA, 0x45, 0x90, 0x11, 0xE7, 0x22, 0xB9, 0xCA,
+    0xCF, 0x9D, 0xBC, 0xB8, 0x39, 0xF7, 0x6E, 0xBF, 0x5E, 0xD4, 0x16, 0x85, 0x30, 0xC8, 0x47, 0x0D,
+    0x13, 0x47, 0x82, 0x0C, 0xB1, 0x9E, 0x15, 0xF6, 0x8C, 0xE4, 0xE0, 0xE3, 0x39, 0x3C, 0xF2, 0x31,
+    0xCE, 0x33, 0xCD, 0x11, 0xA1, 0x0B, 0x97, 0xB7, 0x67, 0xC0, 0x08, 0x48, 0x39, 0xF2, 0x99, 0x30,
+    0x7E, 0x5E, 0x72, 0x7E, 0xF6, 0x7A, 0x81, 0xFA, 0x1A, 0x92, 0x61, 0x23, 0x8E, 0x2D, 0xD5, 0xC7,
+    0x02, 0x00, 0x32, 0x30, 0x1C, 0x1E, 0x7C, 0xBF, 0xF6, 0x8F, 0x4E, 0x80, 0xFB, 0x70, 0x6A, 0xBC,
+    0x41, 0xB7, 0x73, 0x23, 0x3A, 0x73, 0x8C, 0x67, 0x2E, 0xAD, 0x18, 0x1C, 0xB6, 0x0F, 0xDD, 0xDD,
+    0xC1, 0xCF, 0xE1, 0x93, 0x41, 0x68, 0xB5, 0x1A, 0x95, 0xE4, 0x6D, 0x7C, 0x90, 0x67, 0x0B, 0x8D,
+    0xC7, 0xA8, 0x1B, 0x80, 0xC9, 0xFC, 0x77, 0x1E, 0x7D, 0x3A, 0x88, 0x96, 0x53, 0x85, 0xF9, 0x8A,
+    0xE4, 0x81, 0xF6, 0x85, 0x0D, 0x80, 0x79, 0x3F, 0x7C, 0x8C, 0x92, 0xDC, 0x80, 0x3D, 0x3A, 0xE6,
+    0x99, 0x13, 0xC6, 0x39, 0x82, 0x39, 0x11, 0xFE, 0x6D, 0x8C, 0xAA, 0x31, 0x29, 0x00, 0x72, 0x8B,
+    0x9C, 0xE0, 0x90, 0x09, 0xEB, 0x8F, 0x6A, 0x54, 0x96, 0x35, 0x66, 0xCF, 0x96, 0xDC, 0x12, 0x57,
+    0x6E, 0x33, 0x21, 0x24, 0xE3, 0x61, 0xED, 0xCF, 0xA8, 0x07, 0x8E, 0x0D, 0x05, 0xA2, 0x46, 0x8D,
+    0x71, 0x82, 0x0B, 0xA0, 0xC4, 0x91, 0x80, 0xBC, 0x3A, 0x2A, 0x03, 0xC2, 0xA8, 0xFF, 0x00, 0x96,
+    0xBE, 0x99, 0x00, 0x77, 0x39, 0xA6, 0x92, 0xCC, 0x3E, 0x79, 0xF7, 0xFF, 0x00, 0x0C, 0x64, 0xF0,
+    0x62, 0x05, 0x87, 0xDE, 0xC8, 0x6E, 0x57, 0xA7, 0x3C, 0x9C, 0xE7, 0xB7, 0x29, 0x31, 0x8C, 0x95,
+    0xF3, 0x24, 0x0A, 0xA7, 0x8C, 0x83, 0xFC, 0x40, 0x8F, 0xBA, 0xD9, 0xE8, 0x47, 0x4E, 0x0F, 0x6A,
+    0x96, 0x57, 0xC6, 0x4E, 0x63, 0x90, 0x12, 0x04, 0x76, 0xFE, 0xAD, 0xB7, 0x82, 0x01, 0xE0, 0x6E,
+    0x51, 0xC7, 0xCA, 0x7D, 0x0F, 0x42, 0x40, 0x52, 0x17, 0xCB, 0x94, 0x96, 0x01, 0xA4, 0x07, 0x02,
+    0x68, 0x21, 0x24, 0x61, 0x66, 0xC7, 0x2A, 0x33, 0xC7, 0xCA, 0x7D, 0x81, 0x19, 0xF4, 0xA8, 0xE3,
+    0xB7, 0x8D, 0x86, 0x23, 0x51, 0x83, 0xF3, 0x23, 0x0E, 0xB7, 0x18, 0x07, 0x3B, 0x64, 0x2B, 0xFC,
+    0x1C, 0x74, 0xFC, 0xCD, 0x58, 0xB7, 0x89, 0x83, 0x7D, 0xC8, 0xF6, 0x70, 0xD2, 0x64, 0x37, 0x32,
+    0x2B, 0x70, 0x5B, 0x20, 0x72, 0x49, 0x03, 0x8E, 0x78, 0xEC, 0x7A, 0x47, 0x69, 0x00, 0x07, 0x28,
+    0x92, 0x02, 0x4E, 0x61, 0x2B, 0xD4, 0x3A, 0x76, 0x0A, 0x71, 0x93, 0xC7, 0x6C, 0x01, 0x92, 0x3A,
+    0x66, 0x82, 0xD0, 0x96, 0x31, 0x4B, 0xCE, 0xC8, 0x40, 0x60, 0x7C, 0xB8, 0xB2, 0x3E, 0xEB, 0xB2,
+    0x60, 0x95, 0x23, 0x83, 0xB7, 0x1F, 0x8D, 0x11, 0x90, 0x41, 0x31, 0x4F, 0x27, 0x99, 0xF7, 0x21,
+    0x04, 0xF1, 0x1C, 0x2A, 0x09, 0x1B, 0xD7, 0x39, 0xC6, 0xDF, 0x7F, 0xEB, 0x51, 0x34, 0x85, 0xD4,
+    0x29, 0x0F, 0xFF, 0x00, 0x3C, 0xE1, 0xCF, 0x02, 0x3C, 0x60, 0x7E, 0xF0, 0x80, 0x38, 0xC8, 0xF4,
+    0xED, 0xDA, 0xA7, 0x9A, 0xCC, 0xE3, 0xE5, 0xDC, 0x5B, 0xFD, 0x69, 0x89, 0x17, 0xB0, 0x27, 0x89,
+    0x1B, 0x27, 0x8C, 0x81, 0x81, 0x92, 0x73, 0xFA, 0x05, 0xA2, 0x59, 0x97, 0x39, 0x11, 0x86, 0x40,
+    0xA7, 0xCB, 0x94, 0x7F, 0x08, 0xE0, 0xF2, 0xB9, 0xE7, 0xE7, 0x39, 0x1C, 0x0C, 0x9C, 0xF1, 0x9A,
+    0x8B, 0xF7, 0xCC, 0x72, 0x63, 0x49, 0x48, 0xFE, 0x31, 0x9F, 0x9D, 0xCA, 0x9F, 0xB8, 0x14, 0x81,
+    0xCA, 0x0E, 0x38, 0xE9, 0x80, 0x7B, 0x1A, 0x49, 0x15, 0xC9, 0x1E, 0x5A, 0xAA, 0x90, 0x37, 0xB3,
+    0x36, 0xDC, 0x20, 0x93, 0xF8, 0xA4, 0x20, 0x74, 0x1E, 0xC7, 0x07, 0xB6, 0x79, 0x06, 0x7B, 0x7C,
+    0x1E, 0x1E, 0x21, 0x8E, 0x1B, 0xCC, 0x39, 0xC4, 0x52, 0xF1, 0x94, 0x56, 0xDD, 0xD0, 0x01, 0xEB,
+    0x9E, 0xD8, 0x3C, 0xD2, 0x2D, 0x08, 0x9E, 0x66, 0x33, 0x73, 0xE5, 0x02, 0x08, 0x77, 0x8D, 0x7E,
+    0xF2, 0xB8, 0x3D, 0xF3, 0x93, 0x9E, 0x73, 0xDF, 0x27, 0xD0, 0x52, 0x6D, 0x31, 0xF1, 0x2C, 0x64,
+    0x29, 0x06, 0x46, 0x19, 0x38, 0x2B, 0x29, 0xFF, 0x00, 0x96, 0xAB, 0x1A, 0xE7, 0xE5, 0x04, 0x01,
+    0xD3, 0xF9, 0x0A, 0x6C, 0x73, 0x60, 0x93, 0x2C, 0x99, 0x0D, 0xBA, 0x2B, 0xA4, 0x19, 0xE8, 0x0E,
+    0x3E, 0xEB, 0x72, 0x48, 0x24, 0x60, 0x76, 0x1D, 0x7A, 0x8A, 0x77, 0x1F, 0xF2, 0xDC, 0x6F, 0x7E,
+    0x1E, 0x15, 0x76, 0xCE, 0xF9, 0x02, 0x9E, 0xA0, 0x8C, 0xFC, 0xE1, 0x17, 0xBF, 0x7E, 0x99, 0x38,
+    0xA0, 0xB4, 0x32, 0x30, 0x07, 0x08, 0x16, 0x2C, 0xE2, 0xDD, 0x63, 0xC9, 0xCC, 0xAB, 0xF3, 0x7D,
+    0xC5, 0x24, 0x60, 0xED, 0x3D, 0xCE, 0x3E, 0xB9, 0x15, 0x2C, 0x07, 0x60, 0x3F, 0xB9, 0x96, 0x44,
+    0x00, 0x32, 0x12, 0x83, 0xFD, 0x4C, 0x67, 0x38, 0x69, 0xB2, 0x46, 0x31, 0x8F, 0x6F, 0xA1, 0xEA,
+    0xC5, 0x7D, 0xC0, 0xEF, 0x01, 0x5B, 0x0B, 0x2C, 0x08, 0x1B, 0x02, 0x37, 0xDA, 0x9F, 0x32, 0xEE,
+    0xE9, 0xB7, 0x8C, 0x71, 0xDF, 0xAF, 0x35, 0x23, 0x16, 0x24, 0x79, 0x49, 0xB1, 0x8E, 0x20, 0x60,
+    0xDC, 0x2B, 0xED, 0xC7, 0xDD, 0x51, 0x8E, 0x0E, 0x7D, 0x73, 0xCF, 0x73, 0xC8, 0x0B, 0x44, 0x8D,
+    0x1B, 0x0E, 0x58, 0x46, 0x54, 0x8C, 0x34, 0x5C, 0xEE, 0x79, 0x79, 0xE0, 0x63, 0xFB, 0xBF, 0x31,
+    0xE0, 0x28, 0xCF, 0x27, 0x1C, 0x10, 0xB1, 0xC8, 0x58, 0x1D, 0x8C, 0x18, 0x82, 0xAC, 0x1F, 0x1F,
+    0x34, 0xE4, 0x77, 0x2C, 0x7F, 0xB8, 0x30, 0xDD, 0xBA, 0xF2, 0x47, 0x34, 0x8F, 0x16, 0xC1, 0x84,
+    0x54, 0x66, 0x71, 0xB9, 0x86, 0x30, 0x1D, 0xF3, 0xD5, 0x10, 0x81, 0xD0, 0xFB, 0x67, 0xB8, 0xC9,
+    0xA5, 0x1C, 0x7D, 0xF7, 0x44, 0x5E, 0x8E, 0x99, 0x38, 0x3C, 0x90, 0x7C, 0xC6, 0x71, 0xD8, 0xF0,
+    0x3E, 0xE9, 0xE7, 0xB9, 0x02, 0x82, 0xD1, 0x14, 0x4F, 0xBB, 0x02, 0x78, 0xD8, 0x39, 0x39, 0x8A,
+    0xE1, 0xC7, 0xFA, 0x96, 0x62, 0x0F, 0xDF, 0x07, 0x27, 0x04, 0x00, 0x0E, 0x47, 0x1D, 0xC7, 0x41,
+    0x6B, 0x7C, 0xAA, 0xC3, 0xF7, 0x6A, 0xD3, 0x11, 0xE6, 0xAE, 0xEE, 0x3E, 0x61, 0xCF, 0xCE, 0x30,
+    0x06, 0x5C, 0x71, 0xD3, 0x20, 0xF7, 0x34, 0xD3, 0x00, 0x51, 0xFB, 0xD4, 0x65, 0x53, 0x89, 0x23,
+    0x2E, 0xC0, 0xAB, 0x7C, 0xB8, 0xFD, 0xE8, 0x2B, 0xC0, 0x45, 0xE0, 0x1D, 0xA3, 0xDF, 0xA5, 0x33,
+    0x64, 0x8A, 0x46, 0xC7, 0x4D, 0xB8, 0x00, 0xAA, 0xE3, 0x74, 0x65, 0x70, 0x3B, 0x9E, 0x72, 0xC0,
+    0x81, 0xD8, 0x76, 0xED, 0x41, 0x68, 0xF3, 0xD0, 0x29, 0x40, 0xA5, 0x02, 0x94, 0x0A, 0xA3, 0xF2,
+    0x94, 0x26, 0x29, 0x71, 0x4B, 0x8A, 0x5C, 0x50, 0x5A, 0x00, 0x29, 0x71, 0x40, 0x14, 0xE0, 0x28,
+    0x2D, 0x08, 0x05, 0x28, 0x14, 0xA0, 0x52, 0x81, 0x41, 0x48, 0x4C, 0x53, 0xB1, 0x46, 0x29, 0x71,
+    0x41, 0x68, 0x00, 0xA5, 0xC5, 0x00, 0x53, 0x80, 0xA4, 0x5A, 0x10, 0x0A, 0x50, 0x29, 0x40, 0xA5,
+    0x02, 0x82, 0xD0, 0x62, 0x97, 0x14, 0x62, 0x97, 0x14, 0x16, 0x80, 0x0A, 0x5C, 0x52, 0x81, 0x4A,
+    0x05, 0x05, 0xA1, 0x00, 0xA7, 0x01, 0x40, 0x14, 0xA0, 0x50, 0x5A, 0x0C, 0x52, 0xE2, 0x8C, 0x53,
+    0xB1, 0x41, 0x68, 0x40, 0x29, 0x71, 0x4A, 0x05, 0x28, 0x14, 0x16, 0x84, 0x02, 0x9C, 0x05, 0x00,
+    0x52, 0x81, 0x41, 0x48, 0x31, 0x4B, 0x8A, 0x5C, 0x52, 0xE2, 0x82, 0xD0, 0x80, 0x52, 0xE2, 0x94,
+    0x0A, 0x50, 0x28, 0x2D, 0x0A, 0xE3, 0x05, 0x7C, 0xC8, 0x15, 0xBF, 0xEB, 0xA1, 0x03, 0x2B, 0x8F,
+    0xF9, 0x64, 0x08, 0xC7, 0xCF, 0x90, 0x39, 0x6E, 0x4F, 0x6A, 0x77, 0x96, 0x14, 0x7C, 0xD3, 0x70,
+    0x30, 0xE7, 0x77, 0xF7, 0x4E, 0x33, 0xB7, 0x1C, 0x8C, 0x30, 0xEA, 0x70, 0x72, 0x3A, 0x52, 0xB4,
+    0x6E, 0x17, 0xE6, 0x75, 0x54, 0xC6, 0x65, 0xF2, 0xF6, 0xE4, 0xC7, 0x23, 0x13, 0xFB, 0xC2, 0xD8,
+    0xE8, 0x3F, 0x99, 0xEB, 0x46, 0xC0, 0xFD, 0xA6, 0xFF, 0x00, 0x9E, 0x71, 0x2C, 0x79, 0xCB, 0x05,
+    0xC8, 0xC3, 0x93, 0xB8, 0x60, 0xB2, 0x75, 0x38, 0x19, 0xEB, 0xDE, 0x82, 0xD0, 0xD7, 0x28, 0x48,
+    0xDF, 0x98, 0xC8, 0xC3, 0x95, 0x6F, 0xE2, 0xDA, 0xA0, 0x9F, 0x33, 0xE5, 0x1C, 0xB3, 0x00, 0x32,
+    0x70, 0x3F, 0x0E, 0xA9, 0x15, 0xB6, 0xE6, 0x26, 0x63, 0x01, 0x24, 0x02, 0xF1, 0x46, 0xD8, 0x06,
+    0x23, 0x8C, 0x93, 0xF3, 0x0F, 0x40, 0x7A, 0xF2, 0x7F, 0x30, 0xE9, 0x0C, 0x5C, 0xE0, 0xB0, 0x60,
+    0x0C, 0x90, 0x12, 0xDC, 0x46, 0x8E, 0xB8, 0xC2, 0x36, 0x0F, 0x38, 0x18, 0xC1, 0x03, 0x81, 0xF5,
+    0x25, 0x77, 0xB7, 0xFC, 0xB4, 0x9F, 0x2D, 0x93, 0x2A, 0xA7, 0xCC, 0x0E, 0x76, 0x8F, 0xEF, 0x0E,
+    0x37, 0x12, 0x3A, 0x1F, 0x61, 0x9E, 0x30, 0x16, 0x82, 0x29, 0x64, 0xCF, 0xEF, 0x6E, 0x49, 0x6C,
+    0x6C, 0x2D, 0x20, 0x39, 0x1B, 0x36, 0x9E, 0xBB, 0x78, 0xC3, 0x0C, 0xF7, 0x3D, 0x3B, 0x9C, 0xD3,
+    0xBC, 0xC2, 0x19, 0x73, 0x74, 0x80, 0x72, 0xB3, 0x97, 0x00, 0x6D, 0x67, 0x07, 0xA1, 0x18, 0x1C,
+    0xE4, 0xF3, 0x8C, 0x64, 0x1E, 0x31, 0xC5, 0x44, 0x80, 0x2F, 0x04, 0x46, 0x83, 0x01, 0xC5, 0xC2,
+    0xA8, 0xFB, 0xA8, 0xDD, 0x42, 0x10, 0x72, 0x02, 0xF7, 0x3E, 0x95, 0x34, 0x6F, 0x91, 0xC4, 0xB1,
+    0x4B, 0x9E, 0x58, 0x20, 0x6E, 0x19, 0x78, 0xCC, 0x6A, 0xA0, 0x64, 0x27, 0x4E, 0xB8, 0xFC, 0xB9,
+    0x0B, 0x42, 0x2D, 0xAC, 0x5C, 0xEC, 0x82, 0x56, 0x5F, 0xBD, 0x6E, 0x87, 0xB0, 0x6C, 0xFA, 0x90,
+    0x72, 0x7D, 0x3E, 0x6E, 0xD9, 0x14, 0xF9, 0x3C, 0xD6, 0x3C, 0x98, 0xC0, 0xC8, 0x36, 0xED, 0x91,
+    0xD1, 0x14, 0xE3, 0x3B, 0x49, 0xE0, 0xE4, 0x77, 0x53, 0xCF, 0x7E, 0xB4, 0x88, 0x03, 0x90, 0x23,
+    0x5D, 0x92, 0x92, 0x18, 0xCA, 0x46, 0x77, 0x70, 0xA7, 0x2A, 0xED, 0x8F, 0xBA, 0xB9, 0xEF, 0x8E,
+    0x3B, 0x66, 0x80, 0xAA, 0xF9, 0x32, 0x47, 0x39, 0x1B, 0x7F, 0x73, 0xB5, 0x4F, 0xC8, 0xBD, 0x81,
+    0xF9, 0x7B, 0xE4, 0x8C, 0xE4, 0xFD, 0x41, 0xA4, 0x5A, 0x1C, 0xD3, 0xA9, 0x19, 0xE2, 0x31, 0x92,
+    0x6E, 0xA4, 0x55, 0x39, 0x8B, 0x7E, 0x40, 0xF2, 0x8F, 0xA9, 0x03, 0xAF, 0x19, 0x3D, 0x47, 0x51,
+    0x52, 0x15, 0x04, 0x63, 0x7B, 0x05, 0x0C, 0x5D, 0x8B, 0x82, 0x77, 0x8D, 0x9F, 0x36, 0x7E, 0x8B,
+    0x93, 0x82, 0xA7, 0x9E, 0xBC, 0xD4, 0x0E, 0xB2, 0x10, 0x36, 0x4A, 0x10, 0x7F, 0xAC, 0xCF, 0x3F,
+    0x21, 0x5E, 0x3E, 0x67, 0x63, 0xC0, 0xE4, 0x76, 0xE3, 0xF0, 0xCD, 0x3B, 0x68, 0x2B, 0xF7, 0xDC,
+    0xAF, 0x48, 0xD1, 0x3E, 0x60, 0x03, 0x49, 0xC1, 0x8F, 0x27, 0x92, 0xBB, 0x79, 0xC7, 0x3D, 0x7E,
+    0xB4, 0x16, 0x87, 0x4A, 0x00, 0xC1, 0x8D, 0x48, 0x3D, 0x18, 0x83, 0x95, 0x74, 0x38, 0x19, 0x99,
+    0x89, 0x1C, 0xB3, 0x31, 0x19, 0xCE, 0x78, 0xCF, 0x1C, 0xD2, 0xCB, 0x3C, 0x87, 0x6F, 0xDA, 0x15,
+    0xC3, 0x6E, 0xC3, 0x6D, 0x1C, 0x08, 0x58, 0x74, 0xC3, 0x7A, 0xB0, 0x18, 0xE3, 0xB1, 0xE6, 0x9D,
+    0x11, 0x6C, 0xFE, 0xFA, 0x32, 0xC7, 0x3B, 0x65, 0x00, 0x64, 0xE6, 0x26, 0x03, 0xE6, 0x07, 0xAE,
+    0x40, 0x61, 0xC2, 0xE7, 0x1D, 0x4D, 0x2A, 0xDB, 0x31, 0x21, 0x96, 0x54, 0x04, 0xFE, 0xEA, 0x39,
+    0x1B, 0x39, 0x02, 0x3C, 0x71, 0x9C, 0x03, 0x96, 0x1D, 0xB8, 0xE3, 0x93, 0x9E, 0x72, 0x16, 0x86,
+    0x98, 0xA1, 0x7F, 0xB9, 0x72, 0xE1, 0x09, 0x0B, 0x09, 0xE4, 0x9D, 0xB2, 0x74, 0x09, 0xCF, 0xF0,
+    0x36, 0x79, 0x3C, 0xE7, 0x8C, 0x71, 0xCC, 0x90, 0x87, 0x43, 0x8D, 0xB1, 0x10, 0x3F, 0xD6, 0x43,
+    0xE5, 0x93, 0x93, 0x2A, 0x9E, 0x51, 0x89, 0x3D, 0x72, 0x46, 0x73, 0xD2, 0x92, 0x07, 0x75, 0xC6,
+    0xD9, 0x09, 0x20, 0x33, 0xBC, 0x84, 0x12, 0x43, 0x31, 0x23, 0x28, 0x87, 0x1F, 0x74, 0x93, 0x9C,
+    0x91, 0x8E, 0xF8, 0xE9, 0x40, 0xB4, 0x66, 0x53, 0xB2, 0x69, 0x32, 0x39, 0x46, 0x51, 0xF7, 0x98,
+    0xF5, 0xFC, 0xFA, 0x1E, 0x31, 0x41, 0x68, 0x4C, 0x32, 0x70, 0x63, 0x40, 0x70, 0x7C, 0x84, 0x2C,
+    0x06, 0xF5, 0x60, 0x32, 0x26, 0x62, 0x14, 0xFC, 0xF9, 0x3D, 0xFA, 0x8E, 0x9C, 0x53, 0x9E, 0x28,
+    0x93, 0x3E, 0x5C, 0x3B, 0x89, 0x3B, 0x12, 0x34, 0x0D, 0xFB, 0x92, 0xC0, 0x1F, 0x98, 0x13, 0xD8,
+    0x73, 0x80, 0x3F, 0x1E, 0x69, 0x26, 0xB6, 0x8B, 0x19, 0x96, 0x60, 0x18, 0x7E, 0xE9, 0x49, 0x23,
+    0x11, 0xBB, 0x2F, 0x49, 0x70, 0x79, 0xE4, 0x01, 0xC1, 0x3C, 0x7D, 0xEE, 0x29, 0xF6, 0xB2, 0x16,
+    0xE5, 0x99, 0x4B, 0x7F, 0xAE, 0x5E, 0xEF, 0x11, 0x1C, 0x80, 0x91, 0x91, 0xFC, 0x63, 0x19, 0xF5,
+    0x1C, 0x03, 0xE8, 0x14, 0x88, 0x96, 0x25, 0x56, 0x01, 0xF0, 0xAA, 0x14, 0xB8, 0x8D, 0x87, 0x32,
+    0x12, 0xA7, 0x9F, 0x98, 0x67, 0x86, 0xC9, 0xE0, 0x60, 0x7A, 0x54, 0xFB, 0xC0, 0x3F, 0xE9, 0x0C,
+    0xB0, 0x2F, 0x0D, 0x34, 0x0F, 0x82, 0x76, 0xE7, 0x18, 0x53, 0xCE, 0x43, 0xE0, 0x0F, 0x42, 0x39,
+    0xC7, 0x7A, 0x8E, 0xF2, 0xDE, 0x40, 0x7F, 0x78, 0xC3, 0x1D, 0x57, 0x00, 0x81, 0xE7, 0x28, 0x1F,
+    0xEB, 0x1C, 0x9C, 0x72, 0x71, 0xF5, 0xE8, 0x70, 0x06, 0x44, 0x8E, 0xA0, 0x1E, 0xA2, 0x66, 0x39,
+    0x43, 0xF3, 0x12, 0x16, 0xD8, 0x3B, 0x67, 0x71, 0x63, 0xE9, 0x81, 0x9C, 0x71, 0x8F, 0xC6, 0x82,
+    0xD0, 0xFB, 0x84, 0x04, 0x1F, 0x34, 0xBB, 0xA1, 0xC7, 0x94, 0xE7, 0x19, 0x8C, 0x82, 0x78, 0x8F,
+    0x20, 0xE7, 0x70, 0x24, 0x8E, 0xA7, 0xDB, 0x39, 0x22, 0x4B, 0x80, 0x58, 0x0F, 0x35, 0x77, 0x60,
+    0x86, 0x65, 0x27, 0x1B, 0x55, 0x79, 0x1B, 0x90, 0xFA, 0x10, 0x01, 0xC9, 0xCE, 0x7A, 0x7B, 0xBA,
+    0x08, 0x4E, 0xDC, 0xBB, 0x14, 0x70, 0x00, 0x8B, 0xCB, 0xC1, 0x1D, 0xB9, 0xEA, 0x49, 0x18, 0x23,
+    0x3C, 0xF3, 0xC7, 0x5A, 0x86, 0x59, 0x03, 0x12, 0x60, 0xDF, 0xB8, 0x11, 0x1A, 0xB4, 0x64, 0x9F,
+    0x39, 0xCF, 0x1F, 0xBA, 0xC1, 0x3F, 0x77, 0x69, 0x3C, 0x93, 0xC0, 0x02, 0x82, 0xD1, 0x12, 0xC0,
+    0xF8, 0x56, 0x51, 0xB5, 0x3F, 0xD7, 0xED, 0x43, 0x9F, 0x25, 0x4E, 0x4E, 0x78, 0x04, 0x72, 0x73,
+    0xC6, 0x00, 0xF5, 0x07, 0x19, 0xAB, 0x08, 0xCA, 0xED, 0x81, 0x12, 0xC8, 0x38, 0x67, 0x62, 0x30,
+    0x1D, 0x86, 0x3E, 0xE3, 0x7A, 0x33, 0x12, 0x07, 0xCC, 0x41, 0x23, 0xD0, 0xD2, 0xCE, 0xEA, 0x8A,
+    0x72, 0x51, 0xF1, 0xFB, 0xB5, 0x7C, 0xB6, 0x71, 0xB8, 0xFD, 0xCC, 0xE7, 0xA0, 0x27, 0xD8, 0x11,
+    0xDF, 0xA5, 0x32, 0x27, 0x6E, 0x04, 0xAA, 0xA3, 0x1B, 0x5E, 0x36, 0x38, 0x00, 0xB2, 0xC8, 0xBC,
+    0x12, 0x3F, 0x84, 0x0E, 0x9C, 0xF0, 0x73, 0x8E, 0xD8, 0x0B, 0x43, 0x62, 0x58, 0xCE, 0x77, 0x29,
+    0x20, 0x92, 0x2E, 0xD2, 0x33, 0xFE, 0xA1, 0x06, 0x78, 0xC9, 0x3F, 0xF2, 0xD5, 0xCA, 0xF4, 0xE0,
+    0xE3, 0xAD, 0x4D, 0x30, 0x56, 0xE0, 0xA6, 0x11, 0x80, 0x4C, 0xA8, 0xC6, 0x63, 0x72, 0x39, 0x40,
+    0x08, 0xEA, 0x3B, 0x6D, 0xC9, 0xE0, 0x7B, 0x04, 0x79, 0x13, 0x38, 0x2E, 0x40, 0x6E, 0xC1, 0x46,
+    0x64, 0x66, 0x5F, 0x45, 0x03, 0x9C, 0x91, 0xD8, 0x7A, 0xFA, 0x53, 0x6D, 0x67, 0x0A, 0x48, 0x19,
+    0xC8, 0x1B, 0x90, 0x91, 0x91, 0xB0, 0xA6, 0x7E, 0x79, 0x4F, 0x4E, 0x71, 0xDB, 0x19, 0xEB, 0xEC,
+    0x16, 0x86, 0x9D, 0xF9, 0x00, 0x44, 0x1D, 0x81, 0x54, 0x4B, 0x87, 0x1C, 0xC9, 0x22, 0x92, 0x32,
+    0x72, 0x4F, 0x00, 0x7E, 0x20, 0xF1, 0xC6, 0x29, 0x6D, 0xA5, 0x08, 0x7F, 0x74, 0xE7, 0x07, 0xE6,
+    0x92, 0x3C, 0x7F, 0xAB, 0xC8, 0xC6, 0x40, 0xCA, 0xE0, 0x29, 0x18, 0xCF, 0x04, 0x0E, 0xF8, 0xC1,
+    0xA6, 0x88, 0x43, 0xE7, 0x66, 0xD9, 0x00, 0x01, 0xA4, 0x20, 0x12, 0x1D, 0x10, 0x8C, 0x60, 0xE3,
+    0x3C, 0xE3, 0x1D, 0x46, 0x3A, 0x1E, 0x29, 0xD6, 0xAE, 0x49, 0xE1, 0xB0, 0x17, 0xF7, 0x9B, 0x07,
+    0x42, 0x14, 0x0E, 0x19, 0x09, 0xE8, 0xA3, 0x3D, 0xC1, 0xEB, 0x41, 0x68, 0x91, 0x17, 0xE6, 0xC3,
+    0xA4, 0x48, 0x3E, 0xEE, 0xE0, 0x31, 0xE5, 0x95, 0x4C, 0x90, 0x71, 0x90, 0x76, 0x0C, 0x0E, 0x78,
+    0xC9, 0xE8, 0x69, 0x14, 0xB6, 0xD2, 0xB0, 0x82, 0xED, 0xC4, 0x8E, 0x84, 0x9C, 0xF1, 0xFD, 0xD3,
+    0x90, 0x7E, 0x50, 0x47, 0x7F, 0xA8, 0xCE, 0x69, 0xF3, 0x45, 0x11, 0x40, 0x5A, 0x49, 0x0C, 0x43,
+    0x87, 0x4E, 0x9B, 0xD5, 0x90, 0x0F, 0x94, 0x2F, 0x1F, 0x7B, 0xFD, 0xA3, 0xCF, 0x19, 0xCF, 0x5B,
+    0x0C, 0x65, 0x6E, 0x56, 0x39, 0x23, 0x41, 0xF3, 0x3C, 0x59, 0x00, 0x44, 0x5D, 0x57, 0x98, 0x65,
+    0x5F, 0x51, 0xC7, 0x00, 0x91, 0xE9, 0x9C, 0x02, 0x16, 0x88, 0x48, 0x0C, 0x08, 0x8C, 0x4A, 0xCC,
+    0xDC, 0x8C, 0x02, 0x32, 0x8D, 0xDD, 0xD8, 0x8C, 0x90, 0xEC, 0x47, 0x7C, 0xE0, 0xF3, 0xD2, 0x91,
+    0xA0, 0xC1, 0x3E, 0x69, 0x91, 0x57, 0xE7, 0xFB, 0x2C, 0x41, 0x87, 0xCC, 0xA8, 0xCC, 0x78, 0xC8,
+    0x3F, 0x79, 0x80, 0xFD, 0x3B, 0x74, 0x9E, 0xDA, 0x6C, 0x1C, 0x46, 0x1A, 0x4F, 0xE2, 0x89, 0x98,
+    0xFD, 0xE7, 0x52, 0x72, 0xC4, 0x16, 0xC7, 0xDC, 0x39, 0xC6, 0x06, 0x7A, 0x83, 0xDE, 0x89, 0xE2,
+    0x00, 0x12, 0x08, 0x2F, 0xC8, 0x98, 0xF0, 0xDE, 0x52, 0xB7, 0x3D, 0xCF, 0x62, 0x71, 0x9C, 0x01,
+    0xD7, 0xEA, 0x02, 0xD1, 0xFF, 0xD9,
+};
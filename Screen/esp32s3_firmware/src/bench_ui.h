@@ -0,0 +1,3007 @@
+/*
+ * Reference UI frame for the bench command (480x480, RGB565 colors) as
+ * JPEG (4:2:0, quality 80, 26750 bytes) and QOI (21030 bytes).
+ *
+ * Generated by tools/gen_bench_jpeg.py - do not edit.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define BENCH_UI_JPEG_SIZE  26750
+
+static const uint8_t BENCH_UI_JPEG[BENCH_UI_JPEG_SIZE] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x84, 0x00, 0x06, 0x04, 0x04, 0x06, 0x0A, 0x10, 0x14,
+    0x18, 0x05, 0x05, 0x06, 0x08, 0x0A, 0x17, 0x18, 0x16, 0x06, 0x05, 0x06, 0x0A, 0x10, 0x17, 0x1C,
+    0x16, 0x06, 0x07, 0x09, 0x0C, 0x14, 0x23, 0x20, 0x19, 0x07, 0x09, 0x0F, 0x16, 0x1B, 0x2C, 0x29,
+    0x1F, 0x0A, 0x0E, 0x16, 0x1A, 0x20, 0x2A, 0x2D, 0x25, 0x14, 0x1A, 0x1F, 0x23, 0x29, 0x30, 0x30,
+    0x28, 0x1D, 0x25, 0x26, 0x27, 0x2D, 0x28, 0x29, 0x28, 0x01, 0x07, 0x07, 0x0A, 0x13, 0x28, 0x28,
+    0x28, 0x28, 0x07, 0x08, 0x0A, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x0A, 0x0A, 0x16, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x13, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x01,
+    0xE0, 0x01, 0xE0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4,
+    0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13,
+    0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15,
+    0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4,
+    0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2,
+    0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+    0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5,
+    0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04,
+    0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11,
+    0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+    0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1, 0x0A,
+    0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93,
+    0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8,
+    0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6,
+    0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF2, 0x6A, 0x28, 0xA2, 0xBE,
+    0xA0, 0xF3, 0x82, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A,
+    0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x0F, 0x4D, 0xD5, 0xBE, 0x0A, 0xC9,
+    0x6A, 0xD0, 0x35, 0xEE, 0xB1, 0xF6, 0x6B, 0x19, 0xBC, 0xB8, 0xE4, 0xBF, 0xBA, 0x8D, 0x23, 0x7D,
+    0x3E, 0xE6, 0xE6, 0x29, 0x5B, 0x6D, 0xCD, 0xAC, 0x93, 0x00, 0x3E, 0xCC, 0xB1, 0x8D, 0xD9, 0x94,
+    0x1C, 0x9C, 0x20, 0x62, 0x31, 0x59, 0x17, 0x5F, 0x0D, 0x1D, 0x65, 0x95, 0x2D, 0xB5, 0x2F, 0xB5,
+    0x14, 0x8F, 0xFB, 0x53, 0x4E, 0x92, 0x28, 0x98, 0x0D, 0x56, 0xD1, 0xA6, 0x28, 0xBF, 0x65, 0x33,
+    0x14, 0xC9, 0x9E, 0x63, 0x1E, 0x36, 0x19, 0x15, 0x81, 0x3E, 0x5B, 0x3B, 0x00, 0xAD, 0x1C, 0x3F,
+    0x15, 0xB5, 0xC0, 0xEA, 0xD3, 0x3C, 0x77, 0x0C, 0xA5, 0x9A, 0xD3, 0xCD, 0x69, 0x73, 0x0C, 0x53,
+    0x47, 0x32, 0xED, 0x37, 0x4B, 0x20, 0x72, 0x22, 0x13, 0x36, 0xD2, 0xD2, 0x33, 0xA7, 0xF0, 0x30,
+    0xCB, 0x6E, 0x35, 0x8F, 0x8A, 0xFA, 0xED, 0xC3, 0xEE, 0xB4, 0x6B, 0x4D, 0x2D, 0xBC, 0xA4, 0xD2,
+    0x17, 0xFB, 0x3D, 0x36, 0x18, 0xEC, 0xAD, 0xA5, 0x2C, 0x16, 0xDE, 0x52, 0x4B, 0x28, 0xDC, 0x79,
+    0x0A, 0xEA, 0x08, 0x00, 0x11, 0xC5, 0x73, 0x25, 0x3E, 0xB2, 0x46, 0xAF, 0x97, 0xA2, 0x65, 0xBD,
+    0x53, 0xE1, 0x8C, 0x16, 0xF0, 0xDC, 0x48, 0xDA, 0xD5, 0xC4, 0xBE, 0x43, 0x1B, 0x69, 0xE0, 0x4B,
+    0x62, 0x0E, 0xF3, 0x77, 0x3C, 0x6A, 0xCE, 0xF2, 0xC8, 0xA3, 0x64, 0xCF, 0x10, 0xE5, 0x0C, 0xA4,
+    0x12, 0x41, 0x5F, 0x97, 0x26, 0x4B, 0xBF, 0x84, 0xED, 0x0C, 0xB6, 0xE2, 0xF2, 0xFE, 0xEE, 0x18,
+    0x2E, 0x1E, 0x3B, 0x3D, 0x32, 0x69, 0x60, 0x0B, 0x24, 0x72, 0xCD, 0xB8, 0x30, 0xBC, 0xD3, 0xA4,
+    0x95, 0x58, 0x1B, 0x69, 0xB6, 0x82, 0x46, 0xF4, 0x2A, 0x77, 0x06, 0xCE, 0x15, 0xB2, 0x2D, 0x3E,
+    0x24, 0x6A, 0xC9, 0x11, 0x49, 0x12, 0xD2, 0xE0, 0x94, 0x9A, 0xC6, 0x4B, 0xD9, 0x54, 0xF9, 0xAF,
+    0x06, 0xA3, 0x92, 0xC2, 0x6B, 0xA5, 0x60, 0x58, 0x2B, 0xB3, 0xB0, 0x0C, 0x59, 0x77, 0x36, 0xE6,
+    0x04, 0x85, 0xDB, 0x72, 0x5F, 0x8B, 0xFE, 0x22, 0x67, 0x46, 0x79, 0xED, 0xC1, 0x49, 0x23, 0xD4,
+    0xA0, 0x8E, 0x35, 0x2A, 0xA2, 0xE6, 0xDC, 0x4B, 0xB8, 0x98, 0xE2, 0x2A, 0x3F, 0xE2, 0x62, 0xD2,
+    0xB9, 0x93, 0xBB, 0x67, 0x19, 0x03, 0x8A, 0x2D, 0x3E, 0x92, 0x41, 0xEE, 0xF6, 0x65, 0x78, 0x3E,
+    0x19, 0x6B, 0x0F, 0x80, 0xB0, 0xE6, 0x76, 0x54, 0xBA, 0xB4, 0x8C, 0x7F, 0xAB, 0x92, 0x2B, 0x8B,
+    0x99, 0x10, 0x09, 0x2F, 0xC9, 0xDA, 0x0D, 0xC3, 0xA6, 0x53, 0xE6, 0xD9, 0x22, 0x9F, 0x91, 0xB7,
+    0x6D, 0x56, 0xBF, 0x0F, 0xC2, 0x2D, 0x44, 0xDB, 0xCB, 0x2C, 0x8F, 0x70, 0x3C, 0xA5, 0x97, 0xFB,
+    0x4E, 0xD5, 0x62, 0xE6, 0xDA, 0xEE, 0xD2, 0x49, 0x41, 0x0B, 0x71, 0x23, 0x22, 0x32, 0x28, 0x8F,
+    0x96, 0x8E, 0x49, 0x19, 0x49, 0xC6, 0xC3, 0xD6, 0xAA, 0x5F, 0x7C, 0x55, 0xD6, 0x65, 0x93, 0x74,
+    0x51, 0xDA, 0x5B, 0x21, 0x22, 0x5B, 0xBB, 0x28, 0x03, 0x85, 0xBB, 0x91, 0x2E, 0x26, 0x7C, 0xCA,
+    0xCC, 0xE5, 0x81, 0xF3, 0xA7, 0x76, 0x1B, 0x64, 0x5D, 0xA7, 0x0C, 0x9B, 0x59, 0x54, 0x82, 0x0F,
+    0x8A, 0x3A, 0x92, 0x43, 0x24, 0x62, 0xC3, 0x4C, 0x65, 0x90, 0xCE, 0xED, 0x74, 0xC1, 0xFC, 0xC8,
+    0x97, 0x54, 0x4C, 0x38, 0x37, 0x02, 0x4C, 0xB0, 0x3C, 0x1F, 0xDE, 0x19, 0x0E, 0x42, 0x96, 0x27,
+    0x6A, 0xE1, 0xBE, 0x7E, 0x9C, 0xBD, 0xC5, 0xEE, 0xF9, 0x99, 0x1E, 0x0B, 0xF0, 0xEC, 0x5A, 0x95,
+    0xD4, 0x70, 0xCF, 0xA8, 0xC7, 0x64, 0xB2, 0x13, 0x12, 0xDD, 0xB8, 0x04, 0x24, 0x81, 0x09, 0x00,
+    0x21, 0x65, 0xC9, 0x95, 0xC0, 0x51, 0xF3, 0x0E, 0x4F, 0x1E, 0x95, 0xD5, 0x47, 0xF0, 0xB3, 0x4E,
+    0x79, 0x55, 0x21, 0xF1, 0x56, 0x4B, 0x2C, 0x72, 0x44, 0x1A, 0xDF, 0x06, 0x4B, 0xAB, 0xA4, 0x9C,
+    0x88, 0x92, 0x41, 0x29, 0x4D, 0xF2, 0xF9, 0x4B, 0xB3, 0x74, 0xEA, 0xB2, 0x06, 0xDD, 0x1B, 0x11,
+    0x8D, 0xDC, 0x36, 0x97, 0xA9, 0xCB, 0x6C, 0xC5, 0xA0, 0x58, 0xD9, 0x8A, 0x49, 0x64, 0xC1, 0xF3,
+    0x81, 0x1D, 0xE4, 0x0E, 0x87, 0x18, 0x23, 0x95, 0x47, 0x38, 0xF7, 0xEB, 0x9A, 0xEC, 0x6F, 0xBE,
+    0x31, 0x6A, 0x77, 0x12, 0xC8, 0xF7, 0xFA, 0x46, 0x91, 0x71, 0xE6, 0x2C, 0x56, 0xF7, 0x76, 0x72,
+    0xF9, 0xE6, 0x26, 0x4B, 0x19, 0xB7, 0x2E, 0x2D, 0x8C, 0xF8, 0xFB, 0xF8, 0xC8, 0xC6, 0x3A, 0xF1,
+    0xF3, 0x3E, 0xE7, 0x51, 0x4B, 0xFE, 0x5D, 0xBF, 0xF8, 0x71, 0x46, 0xDF, 0x69, 0x0C, 0xD3, 0x3E,
+    0x17, 0x4B, 0x35, 0xB3, 0xCB, 0x36, 0xA9, 0x1D, 0xB4, 0x88, 0x27, 0x33, 0xE9, 0x6E, 0x84, 0xC8,
+    0x92, 0x69, 0xB1, 0x48, 0x5C, 0x48, 0x88, 0xC7, 0x68, 0x42, 0x23, 0x5C, 0xB8, 0x4C, 0x16, 0xE4,
+    0x7D, 0xCF, 0x32, 0xDC, 0xDF, 0x09, 0xED, 0x52, 0x65, 0x13, 0xF8, 0xA2, 0xDE, 0x2B, 0x26, 0x91,
+    0xAC, 0x0E, 0xB5, 0x2C, 0x60, 0x2C, 0x12, 0xA5, 0xA6, 0xFC, 0x5D, 0x46, 0x64, 0xF9, 0x1D, 0x24,
+    0x05, 0x0A, 0x48, 0x63, 0x7E, 0x85, 0x43, 0x7C, 0xC1, 0x6B, 0xFF, 0x00, 0xC2, 0xEA, 0xF1, 0x11,
+    0xB6, 0x68, 0x5C, 0x58, 0x34, 0x4F, 0xE7, 0x7D, 0xBE, 0x73, 0x19, 0xDF, 0x77, 0xFD, 0xA2, 0x65,
+    0x2D, 0xE6, 0x10, 0xD8, 0x18, 0x79, 0x0B, 0x0D, 0xAA, 0xB8, 0x20, 0x75, 0x19, 0x06, 0x0B, 0x3F,
+    0x8A, 0x77, 0x90, 0x05, 0xFB, 0x06, 0x89, 0xA4, 0x5B, 0xE1, 0xBC, 0xF6, 0x91, 0x0C, 0xFB, 0xE5,
+    0xDB, 0x67, 0x24, 0x41, 0x5A, 0xE9, 0xE7, 0x2C, 0x04, 0x10, 0x48, 0x76, 0x80, 0xEB, 0xB4, 0xF2,
+    0xB8, 0xE7, 0x31, 0xEF, 0xF7, 0x5E, 0x45, 0x7B, 0xBF, 0xE6, 0x49, 0x7F, 0xF0, 0xD6, 0x18, 0xDF,
+    0x65, 0xBE, 0xB7, 0x25, 0xDC, 0xBB, 0x22, 0xBE, 0x78, 0xE1, 0xB6, 0x93, 0x17, 0x70, 0x4F, 0x2B,
+    0xAB, 0x1D, 0x26, 0x59, 0x36, 0x87, 0x11, 0xB0, 0x4D, 0x87, 0x72, 0x2C, 0xC5, 0x82, 0xC6, 0x77,
+    0x60, 0x18, 0xC7, 0xC3, 0x29, 0xDA, 0x09, 0x66, 0xB5, 0xBD, 0xF3, 0x60, 0x89, 0x5A, 0xE6, 0x78,
+    0x55, 0x01, 0x92, 0x58, 0x45, 0xC4, 0xC8, 0xAF, 0x02, 0xC2, 0xEE, 0xA5, 0x1D, 0xE2, 0x3B, 0x8F,
+    0x9D, 0x95, 0x01, 0x88, 0x0C, 0xA1, 0x4B, 0xE6, 0x6A, 0x7E, 0x3D, 0xD5, 0xAE, 0xA6, 0x12, 0x6A,
+    0x12, 0xC7, 0x33, 0x04, 0xFE, 0xCD, 0x58, 0x98, 0x1E, 0x34, 0xED, 0xE4, 0xF9, 0x7E, 0x78, 0x3B,
+    0xF1, 0x20, 0x25, 0x4B, 0x79, 0xBE, 0x63, 0x29, 0x21, 0x9C, 0xE4, 0xE6, 0x7B, 0x9F, 0x89, 0x9A,
+    0xEB, 0x42, 0xF1, 0x5B, 0x5C, 0xC7, 0x69, 0x6D, 0x21, 0x79, 0x75, 0x28, 0x61, 0x5F, 0x9A, 0xFA,
+    0x4B, 0x99, 0x59, 0x89, 0xBA, 0xBB, 0x90, 0xB3, 0x92, 0xC0, 0x84, 0xE6, 0x4E, 0x54, 0x00, 0xD9,
+    0xE7, 0x35, 0x69, 0xFF, 0x00, 0x32, 0xF3, 0x16, 0x9D, 0x9F, 0x91, 0xAF, 0x79, 0xF0, 0xBE, 0xD2,
+    0x17, 0x84, 0x5C, 0xEB, 0xF2, 0x41, 0x6F, 0x31, 0x0B, 0x0E, 0xA1, 0x71, 0x14, 0x68, 0x12, 0x33,
+    0x1B, 0x92, 0xEA, 0x5E, 0xE3, 0x0C, 0xB1, 0x30, 0x03, 0x2B, 0x23, 0x67, 0xA8, 0xE1, 0xA2, 0x32,
+    0xF3, 0x3E, 0x2B, 0xF0, 0xE2, 0xD8, 0x3A, 0x2A, 0x5D, 0x49, 0x38, 0x64, 0xFB, 0x62, 0xC8, 0xD1,
+    0x95, 0x01, 0x1E, 0x57, 0x03, 0xCA, 0x62, 0x48, 0x60, 0xC8, 0xA0, 0xEE, 0x46, 0x78, 0xC9, 0x24,
+    0x23, 0x30, 0x1B, 0x8D, 0xFB, 0x5F, 0x89, 0x9A, 0xEA, 0xCE, 0x92, 0xDD, 0xDC, 0xC7, 0x7A, 0x51,
+    0xCE, 0xA1, 0x0E, 0x9F, 0x70, 0xBF, 0xB9, 0x17, 0xAC, 0xAD, 0xF3, 0xAD, 0x94, 0x65, 0x40, 0x60,
+    0xCC, 0x5B, 0x20, 0x03, 0xBB, 0xE6, 0x27, 0x24, 0xE6, 0x87, 0x8B, 0x7C, 0x5B, 0x79, 0xAA, 0x4A,
+    0x1E, 0xFA, 0x1B, 0x48, 0x42, 0xA2, 0xD8, 0x59, 0x5A, 0x5B, 0x26, 0xD4, 0xB3, 0xB5, 0x87, 0x38,
+    0x58, 0x13, 0x27, 0x80, 0x49, 0x3C, 0x93, 0xE8, 0x38, 0xC0, 0x0E, 0x0A, 0x5F, 0x6D, 0xAF, 0x31,
+    0x3B, 0x74, 0x46, 0x25, 0x14, 0x51, 0x5B, 0x90, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00,
+    0x14, 0x51, 0x45, 0x00, 0x70, 0xF4, 0x51, 0x45, 0x7C, 0xD1, 0xDC, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x7B, 0x9F, 0xC7, 0x8F, 0xF9, 0x77, 0xFF, 0x00, 0xB6, 0xBF, 0xFB, 0x4A, 0xBC,
+    0x9A, 0xBD, 0x67, 0xE3, 0xC7, 0xFC, 0xBB, 0xFF, 0x00, 0xDB, 0x5F, 0xFD, 0xA5, 0x5E, 0x4D, 0x5E,
+    0x2F, 0x0D, 0x7F, 0x0A, 0x3F, 0xF6, 0xF7, 0xFE, 0x94, 0xCF, 0x43, 0x37, 0xF8, 0xDF, 0xCB, 0xF2,
+    0x41, 0x45, 0x14, 0x57, 0xBA, 0x79, 0xA1, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45,
+    0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x06, 0x2D,
+    0x14, 0x51, 0x50, 0x50, 0x51, 0x45, 0x14, 0x01, 0xEE, 0x7F, 0x1E, 0x3F, 0xE5, 0xDF, 0xFE, 0xDA,
+    0xFF, 0x00, 0xED, 0x2A, 0xF2, 0x6A, 0xF5, 0x9F, 0x8F, 0x1F, 0xF2, 0xEF, 0xFF, 0x00, 0x6D, 0x7F,
+    0xF6, 0x95, 0x79, 0x35, 0x78, 0xBC, 0x35, 0xFC, 0x28, 0xFF, 0x00, 0xDB, 0xDF, 0xFA, 0x53, 0x3D,
+    0x0C, 0xDF, 0xE3, 0x7F, 0x2F, 0xC9, 0x05, 0x14, 0x51, 0x5E, 0xE9, 0xE6, 0x85, 0x15, 0x7B, 0x46,
+    0xD0, 0xF5, 0x0B, 0xD7, 0x09, 0xA5, 0x58, 0xCF, 0x73, 0x29, 0xE7, 0xCB, 0x8C, 0x67, 0x62, 0x96,
+    0x03, 0x32, 0xB7, 0x60, 0x09, 0x19, 0x24, 0x80, 0x3B, 0x9A, 0xF6, 0x2F, 0x0E, 0x7E, 0xCE, 0x1D,
+    0x4F, 0x89, 0x75, 0x7F, 0x55, 0x8A, 0x0B, 0x1F, 0xC3, 0x05, 0xE7, 0x95, 0x7E, 0xA3, 0x1E, 0x5F,
+    0xA1, 0xDD, 0xDA, 0x98, 0xD2, 0x3C, 0x3E, 0x8A, 0xFA, 0x33, 0xFE, 0x19, 0xCF, 0xC3, 0x7F, 0xF4,
+    0x10, 0xD7, 0x3F, 0xEF, 0xB8, 0xFF, 0x00, 0xF8, 0xD5, 0x65, 0x78, 0x83, 0xF6, 0x70, 0xB6, 0x2B,
+    0xFF, 0x00, 0x14, 0xEE, 0xAF, 0x3A, 0xCA, 0x3E, 0xF4, 0x57, 0xB8, 0x2B, 0x36, 0x48, 0xE9, 0x2C,
+    0x4A, 0x31, 0xB4, 0x67, 0xF8, 0x1B, 0x3C, 0x74, 0xEB, 0x4E, 0xC3, 0xB1, 0xE1, 0x14, 0x56, 0xCF,
+    0x8A, 0x3C, 0x25, 0xAA, 0x69, 0x92, 0x14, 0xD5, 0xAC, 0xDE, 0x33, 0x92, 0x96, 0xF7, 0x00, 0x1D,
+    0x97, 0x8A, 0x98, 0xE6, 0xD6, 0x52, 0x39, 0x18, 0x23, 0xDC, 0x74, 0x60, 0x0F, 0x15, 0x8D, 0x48,
+    0x90, 0xA2, 0x8A, 0x29, 0x01, 0xEB, 0x87, 0x56, 0x8D, 0x44, 0x6D, 0xF6, 0xDB, 0x1B, 0xB9, 0x91,
+    0x8E, 0x8B, 0x3D, 0x9C, 0xD7, 0x50, 0x29, 0xBF, 0x86, 0x4B, 0x4B, 0xA2, 0x65, 0x9D, 0xF7, 0x3C,
+    0x67, 0x26, 0x76, 0x25, 0x98, 0x48, 0x4B, 0x1F, 0x2C, 0x9D, 0xC1, 0x9A, 0x6B, 0x5A, 0xB7, 0x89,
+    0x6C, 0x2E, 0x2E, 0x4F, 0xD8, 0xF5, 0x2D, 0x36, 0xE2, 0xCE, 0x64, 0x86, 0xC5, 0x8D, 0xCC, 0xCF,
+    0x8B, 0x68, 0x6C, 0xE5, 0x9C, 0xA9, 0xBB, 0x6B, 0xC9, 0x86, 0x18, 0x3C, 0x48, 0xC4, 0xB5, 0xB4,
+    0x8A, 0x37, 0x72, 0xAE, 0x5B, 0x13, 0x78, 0xCD, 0x14, 0x0E, 0xE7, 0xA3, 0x5F, 0xF8, 0x92, 0xCD,
+    0xAD, 0xE4, 0x5D, 0x52, 0xF6, 0x0D, 0x42, 0x51, 0x24, 0xF7, 0x56, 0xF3, 0xBA, 0x21, 0x78, 0x75,
+    0x1D, 0x48, 0xCA, 0xBB, 0x61, 0x85, 0x5F, 0x6F, 0x96, 0x11, 0x0C, 0xAC, 0xD1, 0xC8, 0xCA, 0xB2,
+    0x32, 0x15, 0x0D, 0xB4, 0xEE, 0xB1, 0x26, 0xAF, 0xA7, 0xAC, 0xD1, 0x18, 0x35, 0x5D, 0x0E, 0x69,
+    0x76, 0xC8, 0xB7, 0x9A, 0x87, 0x93, 0xB6, 0x3B, 0xFD, 0x35, 0x60, 0x9D, 0x4B, 0xEA, 0x72, 0x4A,
+    0x8E, 0xE2, 0xE2, 0xE3, 0x2F, 0x90, 0x62, 0x91, 0x24, 0x25, 0x09, 0x0D, 0x80, 0x0F, 0x98, 0xD1,
+    0x40, 0x1E, 0xAB, 0x63, 0xE3, 0x18, 0x52, 0x65, 0x55, 0xF1, 0x04, 0xF6, 0xF6, 0xCF, 0x05, 0xBD,
+    0x95, 0xDD, 0xB5, 0xBB, 0x95, 0x2B, 0x30, 0x81, 0x88, 0x5B, 0x2D, 0x40, 0xB3, 0x6D, 0x1A, 0x73,
+    0x3E, 0x06, 0x59, 0x01, 0x6C, 0x2C, 0xC0, 0x83, 0x24, 0xB5, 0xAB, 0x61, 0xE3, 0x3B, 0x33, 0xA6,
+    0xCF, 0x1D, 0xC7, 0x89, 0x7C, 0x95, 0x2B, 0x71, 0x3E, 0x87, 0x19, 0x28, 0xD3, 0xDF, 0xC3, 0x3C,
+    0xD2, 0x8D, 0x9A, 0xD3, 0x36, 0xFF, 0x00, 0x9E, 0x79, 0x1D, 0x49, 0xC2, 0x46, 0x76, 0xFC, 0xCA,
+    0xE4, 0x6F, 0xDB, 0xE2, 0xB4, 0x50, 0x17, 0x3D, 0x1B, 0xE2, 0x6F, 0x8D, 0x2D, 0xAF, 0xE3, 0x02,
+    0xD6, 0xC6, 0xC6, 0x28, 0x8C, 0xA7, 0x52, 0xD3, 0x64, 0x8D, 0x83, 0x38, 0x8A, 0x48, 0x80, 0x71,
+    0x73, 0x19, 0x6C, 0xC6, 0x5A, 0x6E, 0x58, 0x08, 0xF6, 0x48, 0xDF, 0x32, 0x93, 0xB7, 0x7C, 0x99,
+    0x5F, 0x0F, 0x75, 0x99, 0x2D, 0x84, 0xFE, 0x6E, 0xA1, 0x04, 0x16, 0xA5, 0x50, 0x5E, 0x5B, 0xB3,
+    0x2A, 0xBD, 0xD5, 0xC3, 0x4B, 0xB5, 0x1A, 0xD2, 0x42, 0xAE, 0xC0, 0xD8, 0x17, 0x32, 0xE5, 0x23,
+    0x72, 0x0A, 0x8C, 0x8E, 0x45, 0x71, 0xD4, 0x50, 0x07, 0xA5, 0x6A, 0x1A, 0xFE, 0x9B, 0x6F, 0x6F,
+    0x24, 0x56, 0x5A, 0x8C, 0x97, 0x31, 0x46, 0x6E, 0x34, 0x3B, 0x12, 0x66, 0x21, 0xE2, 0x8E, 0xF2,
+    0x67, 0x60, 0xD6, 0xB1, 0xDB, 0xF9, 0x61, 0xE2, 0xB9, 0x44, 0x50, 0xE5, 0xE4, 0x7C, 0x31, 0x04,
+    0x20, 0x50, 0x16, 0x4D, 0xCF, 0x19, 0xF8, 0x87, 0x4F, 0x80, 0x40, 0xC7, 0x59, 0xD3, 0x6E, 0x07,
+    0xDA, 0x9A, 0xE3, 0x58, 0xD3, 0x2C, 0x02, 0x13, 0xAA, 0xE9, 0xD1, 0xB3, 0x2F, 0x99, 0xA8, 0x18,
+    0x9C, 0xAE, 0xFB, 0xB8, 0x0B, 0x6E, 0xF9, 0x63, 0x12, 0x07, 0xDA, 0xC3, 0x09, 0xC7, 0x8C, 0xD1,
+    0x40, 0x5C, 0xE8, 0xFC, 0x71, 0x77, 0xA7, 0xB4, 0x88, 0x9A, 0x48, 0xFD, 0xD4, 0x2A, 0xFA, 0x6F,
+    0x98, 0xA7, 0x29, 0x70, 0xC2, 0xF6, 0x76, 0xDD, 0x66, 0xF9, 0x3F, 0x24, 0x8A, 0xE0, 0x8C, 0xB3,
+    0x10, 0x38, 0x2C, 0xD8, 0xDC, 0x79, 0xCA, 0x28, 0xA0, 0x47, 0xAF, 0xEB, 0x3E, 0x23, 0xD3, 0xCE,
+    0xC9, 0x34, 0xC9, 0x74, 0x69, 0xA5, 0x88, 0xC8, 0x2C, 0xBE, 0xDB, 0xB0, 0x7D, 0xBB, 0x4E, 0xD4,
+    0xEC, 0xA6, 0x91, 0xA2, 0xD4, 0xA0, 0x49, 0x19, 0x9D, 0xAD, 0x72, 0x13, 0x71, 0x60, 0x1E, 0x46,
+    0x21, 0x81, 0x6D, 0xCC, 0x67, 0xD5, 0x75, 0x1D, 0x11, 0xAE, 0x26, 0x69, 0x35, 0xEB, 0x4B, 0xCD,
+    0x3A, 0x41, 0x6B, 0x0D, 0xF4, 0x77, 0x32, 0x73, 0x2E, 0x92, 0x59, 0xD8, 0x9D, 0x96, 0xCC, 0x24,
+    0x79, 0x6C, 0xDE, 0x34, 0x50, 0x5D, 0x7C, 0xC5, 0x0C, 0x44, 0xA0, 0xAF, 0xCF, 0x5E, 0x33, 0x45,
+    0x03, 0xB9, 0xE9, 0x4B, 0xAE, 0x69, 0xF0, 0x45, 0x2C, 0x77, 0xB3, 0x47, 0x79, 0x24, 0x66, 0xF6,
+    0x5D, 0x17, 0x51, 0x86, 0x54, 0x54, 0x36, 0xDA, 0x82, 0x79, 0x21, 0x6C, 0xAC, 0x50, 0xB0, 0xC4,
+    0xF3, 0x13, 0x21, 0x51, 0xB3, 0x6A, 0x8D, 0xE9, 0xB8, 0x1C, 0x1E, 0x57, 0xC0, 0x5A, 0xB5, 0xA5,
+    0xA5, 0xDC, 0x4F, 0xA9, 0x79, 0x7F, 0x66, 0xCB, 0x41, 0xA8, 0x07, 0x8F, 0x78, 0x36, 0xD7, 0x11,
+    0xB2, 0xB7, 0x99, 0x0E, 0x46, 0x41, 0x46, 0x3E, 0xB8, 0xEB, 0xB5, 0xBE, 0xE9, 0xE7, 0xE8, 0xA0,
+    0x0F, 0x66, 0xF0, 0xFF, 0x00, 0x8D, 0xED, 0x23, 0x67, 0x10, 0xDE, 0xE9, 0xB6, 0x1F, 0xB9, 0x86,
+    0xDA, 0x7B, 0xC0, 0xFC, 0x4D, 0x35, 0x81, 0x99, 0xD0, 0xD8, 0xCD, 0x1E, 0x58, 0x8F, 0xB3, 0x6C,
+    0x40, 0x24, 0x81, 0xD8, 0x70, 0xB3, 0x6F, 0x61, 0xE5, 0xCA, 0xC4, 0xF1, 0xEC, 0x4F, 0x63, 0x3D,
+    0xBB, 0xD9, 0x68, 0x70, 0xC5, 0xBA, 0xE6, 0xDE, 0x09, 0x9A, 0x54, 0xF9, 0x9D, 0xBC, 0xF9, 0x47,
+    0xD8, 0xF4, 0xC4, 0x2D, 0x80, 0xAC, 0x15, 0x14, 0x89, 0xD9, 0x43, 0x15, 0x28, 0x5F, 0x18, 0xAF,
+    0x1C, 0xA2, 0x80, 0xB9, 0xED, 0x5E, 0x39, 0xF8, 0x83, 0xA7, 0xB7, 0x90, 0x1A, 0xFA, 0xC4, 0x98,
+    0xAE, 0x4D, 0xD6, 0xB9, 0xA5, 0x69, 0xCB, 0xBE, 0x2D, 0x4A, 0xCA, 0xE7, 0x24, 0xB4, 0x17, 0x84,
+    0x28, 0x6C, 0xC2, 0xEC, 0x8E, 0x0E, 0xDD, 0xEC, 0xCD, 0xB8, 0x63, 0x15, 0x3F, 0x81, 0xBC, 0x5B,
+    0xE1, 0x94, 0x79, 0x7F, 0xB4, 0x64, 0x82, 0xDA, 0x12, 0xB0, 0xDE, 0xDC, 0x4D, 0x3C, 0xB9, 0x7B,
+    0xDD, 0x4A, 0x0B, 0xAB, 0x89, 0x95, 0x94, 0x46, 0x5C, 0x9C, 0x21, 0x5C, 0xEE, 0x95, 0x9D, 0x58,
+    0x08, 0x98, 0xBB, 0x1C, 0x9F, 0x0E, 0xA2, 0x80, 0xB9, 0xEA, 0xBA, 0x87, 0x8A, 0x34, 0x3B, 0xD8,
+    0x65, 0xFB, 0x45, 0xED, 0xF5, 0xC3, 0x9F, 0xB6, 0x6A, 0x3A, 0x7D, 0x96, 0xF4, 0x88, 0x69, 0x09,
+    0x71, 0x3E, 0xE4, 0x4B, 0xA0, 0xC5, 0x7C, 0xCF, 0xB4, 0x4A, 0x56, 0x52, 0x04, 0x92, 0x30, 0x2A,
+    0xA1, 0x54, 0x8D, 0xD9, 0xF3, 0xFF, 0x00, 0x0C, 0x3A, 0x2C, 0xC0, 0xC9, 0x77, 0xE4, 0x2A, 0xAC,
+    0x97, 0x12, 0x36, 0x57, 0xFD, 0x21, 0x62, 0x81, 0xCF, 0x97, 0xFB, 0xC0, 0x47, 0xFA, 0x60, 0x1B,
+    0x39, 0x56, 0x07, 0x38, 0x2A, 0xC3, 0x83, 0x95, 0x45, 0x00, 0x7A, 0xC7, 0x87, 0xB5, 0xCF, 0x0D,
+    0x59, 0x4B, 0x72, 0x34, 0xC9, 0xA3, 0xBA, 0xB2, 0x78, 0x56, 0xC2, 0x64, 0x92, 0x57, 0x86, 0x3B,
+    0xD9, 0xA7, 0x72, 0x5F, 0x30, 0xB9, 0x91, 0xC8, 0x82, 0x12, 0xFB, 0x48, 0x01, 0x80, 0x1B, 0x30,
+    0xEE, 0xEA, 0xCF, 0x24, 0x3E, 0x27, 0xB3, 0xB9, 0xB3, 0xB8, 0x8C, 0x45, 0xA1, 0xDA, 0xDB, 0x6E,
+    0xB9, 0xD6, 0x74, 0x14, 0xB9, 0x95, 0x0B, 0xF9, 0x2E, 0x24, 0xC2, 0x41, 0xA6, 0xFC, 0xFB, 0x1E,
+    0x36, 0x71, 0xB7, 0x6C, 0x90, 0x9C, 0xE1, 0x90, 0x38, 0x0E, 0x1B, 0xC8, 0xE8, 0xA0, 0x2E, 0x7A,
+    0x8E, 0xA9, 0xE2, 0xED, 0x3E, 0x58, 0xD3, 0xFE, 0x11, 0xDB, 0xC9, 0x12, 0xE8, 0x88, 0x62, 0xBF,
+    0xBD, 0xD4, 0x0A, 0x6D, 0xB8, 0xB8, 0x48, 0x2F, 0x55, 0x84, 0xF6, 0x72, 0x97, 0x00, 0xDF, 0x79,
+    0x85, 0x98, 0xE5, 0xE3, 0xCB, 0xE6, 0x56, 0x46, 0xC9, 0x62, 0xEB, 0x5E, 0xB4, 0xB8, 0xB9, 0x95,
+    0x8F, 0x8B, 0x64, 0xBA, 0xB0, 0x94, 0x2D, 0x8E, 0xB5, 0x6D, 0x74, 0xB8, 0xDB, 0x14, 0x92, 0xCA,
+    0x58, 0xD8, 0xDB, 0xCC, 0xC7, 0x0B, 0x64, 0x88, 0xD2, 0xC6, 0x46, 0xF7, 0x56, 0x64, 0x8F, 0x6B,
+    0x31, 0x6A, 0xF2, 0xEA, 0x28, 0x03, 0xBF, 0xBF, 0xD5, 0xF4, 0x9F, 0x25, 0xD7, 0x52, 0xD5, 0xE7,
+    0xBD, 0x65, 0x92, 0xE9, 0xF4, 0x38, 0x48, 0xDF, 0x35, 0xA4, 0xB7, 0x60, 0x00, 0x6F, 0xAE, 0x9F,
+    0x74, 0x65, 0x27, 0x20, 0xB3, 0x14, 0xCB, 0x86, 0xC3, 0x46, 0xD9, 0x2D, 0x8E, 0x57, 0xC2, 0xD7,
+    0xC6, 0x19, 0xD0, 0x89, 0x36, 0x67, 0x75, 0xA3, 0x49, 0x88, 0xC8, 0x45, 0xBA, 0x8D, 0x94, 0x99,
+    0x12, 0xE3, 0xE5, 0x20, 0x06, 0xE4, 0x31, 0x50, 0x47, 0x1B, 0x97, 0xEF, 0x0C, 0xAA, 0x28, 0x03,
+    0xA7, 0xF1, 0xE5, 0xF4, 0x57, 0x0F, 0x0B, 0xC6, 0xD1, 0xA9, 0x78, 0x56, 0x4B, 0x8B, 0x18, 0xE6,
+    0xDE, 0x9A, 0x5C, 0x82, 0x47, 0x1B, 0x2D, 0x00, 0x27, 0x62, 0x94, 0x01, 0x82, 0x67, 0xE4, 0xDD,
+    0xB7, 0x8E, 0x95, 0xD7, 0x69, 0x3E, 0x30, 0x44, 0xD3, 0x4C, 0x2B, 0xA9, 0xC1, 0x09, 0xFB, 0x34,
+    0x89, 0x0A, 0xA9, 0x52, 0xD2, 0x5D, 0x5D, 0x5F, 0x4C, 0x59, 0x27, 0x8D, 0xE5, 0x51, 0xF3, 0xDB,
+    0x47, 0xC1, 0xF2, 0x8B, 0x0D, 0xDF, 0x2B, 0x06, 0x65, 0x57, 0xF2, 0xAA, 0x28, 0x03, 0xA0, 0xF0,
+    0x1B, 0x44, 0x2E, 0xA3, 0x33, 0xCF, 0x69, 0x12, 0x01, 0x23, 0x39, 0xB8, 0xFB, 0x92, 0x81, 0x6E,
+    0xFF, 0x00, 0x2C, 0xC0, 0xCB, 0x10, 0x22, 0xE3, 0xEE, 0xE0, 0xCA, 0xAA, 0x73, 0x86, 0xC8, 0xC8,
+    0x3E, 0x95, 0xA9, 0x78, 0xA6, 0x29, 0x2E, 0x9C, 0x69, 0x57, 0xFA, 0x55, 0xDD, 0xBB, 0xF9, 0x3F,
+    0xDB, 0x82, 0x7B, 0xA4, 0x86, 0x3B, 0x1B, 0x88, 0xAF, 0xA6, 0x72, 0x34, 0xDB, 0xA4, 0x48, 0x5D,
+    0xBC, 0x99, 0x4E, 0xE0, 0xEB, 0xBC, 0xF2, 0x4B, 0x87, 0x25, 0x71, 0xE2, 0xB4, 0x50, 0x07, 0xB8,
+    0xD9, 0x78, 0x93, 0x4A, 0x8F, 0x4E, 0x64, 0x7D, 0x6F, 0x4A, 0x95, 0x8C, 0x77, 0xF0, 0xD8, 0xCF,
+    0x10, 0x8E, 0x37, 0x2B, 0x2B, 0x49, 0xB6, 0x39, 0xAC, 0x8E, 0x4A, 0x8B, 0xF3, 0x99, 0x06, 0x04,
+    0x40, 0x15, 0x44, 0xE4, 0x91, 0xBB, 0x37, 0xC4, 0x97, 0xD0, 0x18, 0x81, 0xD2, 0xF5, 0x1D, 0x19,
+    0xAF, 0xCD, 0xC4, 0x8B, 0xA8, 0xDB, 0x35, 0xEA, 0xB2, 0x5F, 0x34, 0xB6, 0x8E, 0x3C, 0xE9, 0x40,
+    0x30, 0x45, 0x87, 0x8C, 0xE0, 0xFE, 0xE0, 0x87, 0xC8, 0x59, 0x09, 0x62, 0xE8, 0x7C, 0x82, 0x8A,
+    0x02, 0xE7, 0xB6, 0xF8, 0x77, 0x52, 0xD2, 0xE1, 0x9D, 0x9B, 0x52, 0xD6, 0xB4, 0x69, 0x2C, 0xA4,
+    0x8E, 0x3B, 0x8D, 0x42, 0xDA, 0xD6, 0xE0, 0x24, 0x56, 0x56, 0xE1, 0x6E, 0x09, 0x8A, 0xDF, 0x4D,
+    0xD8, 0xA5, 0x95, 0xE5, 0x55, 0x25, 0x76, 0x2C, 0x8A, 0x5B, 0x6B, 0xEF, 0x0D, 0x21, 0x7C, 0xE9,
+    0xBE, 0x20, 0xE9, 0x31, 0x43, 0x2D, 0xBA, 0xDB, 0x4F, 0x7D, 0x37, 0xFA, 0x72, 0x36, 0xAC, 0xD3,
+    0xFE, 0xED, 0x25, 0xB9, 0x12, 0xED, 0x7D, 0x3D, 0x26, 0x95, 0xF3, 0xE7, 0x47, 0xC7, 0xDF, 0xDF,
+    0xC9, 0xDA, 0x5D, 0x9D, 0xB7, 0x79, 0x1D, 0x14, 0x05, 0xCF, 0x63, 0xBE, 0xF1, 0x77, 0x87, 0x59,
+    0xE3, 0x74, 0x9A, 0x08, 0x42, 0xC8, 0x0C, 0x8E, 0xD1, 0x2B, 0xBF, 0xD8, 0xB5, 0x2B, 0x6B, 0x81,
+    0xB3, 0x51, 0x8A, 0x47, 0x94, 0xB0, 0x88, 0x85, 0x69, 0x36, 0x4C, 0xBB, 0x8C, 0x8D, 0xB9, 0x56,
+    0x6E, 0x6B, 0xCF, 0xFC, 0x79, 0xAF, 0xA5, 0xF4, 0xFB, 0xCC, 0x3E, 0x5C, 0xFB, 0x7C, 0xAD, 0x59,
+    0x55, 0xD5, 0x90, 0xDE, 0xA4, 0x8D, 0x93, 0x67, 0x70, 0xA4, 0xE5, 0x19, 0x70, 0x46, 0x59, 0xB6,
+    0x8F, 0x95, 0x4E, 0xC0, 0xB5, 0xCE, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x82, 0x8A, 0x28, 0xA0,
+    0x02, 0x8A, 0x28, 0xA0, 0x0C, 0x5A, 0x28, 0xA2, 0xA0, 0xA0, 0xA2, 0x8A, 0x28, 0x03, 0xDC, 0xFE,
+    0x3C, 0x7F, 0xCB, 0xBF, 0xFD, 0xB5, 0xFF, 0x00, 0xDA, 0x55, 0xE4, 0xD5, 0xEB, 0x3F, 0x1E, 0x3F,
+    0xE5, 0xDF, 0xFE, 0xDA, 0xFF, 0x00, 0xED, 0x2A, 0xF2, 0x6A, 0xF1, 0x78, 0x6B, 0xF8, 0x51, 0xFF,
+    0x00, 0xB7, 0xBF, 0xF4, 0xA6, 0x7A, 0x19, 0xBF, 0xC6, 0xFE, 0x5F, 0x92, 0x0A, 0xBD, 0xA1, 0xE8,
+    0xD7, 0x37, 0xB3, 0x24, 0x76, 0x29, 0xBA, 0x57, 0x61, 0x04, 0x5C, 0x1C, 0x26, 0xE3, 0xC9, 0x93,
+    0x68, 0x3C, 0x46, 0x32, 0x49, 0xC1, 0xC0, 0xE6, 0xA8, 0xD7, 0xB8, 0x7E, 0xCE, 0x1E, 0x1C, 0xFF,
+    0x00, 0x5D, 0x70, 0xF2, 0x7F, 0xD4, 0x22, 0xDA, 0x30, 0x7F, 0xDC, 0x66, 0x32, 0xAE, 0x3F, 0xDC,
+    0xC7, 0xCD, 0xEB, 0x91, 0xD2, 0xBD, 0xE4, 0x79, 0xC8, 0xF4, 0xCF, 0x03, 0x78, 0x1B, 0x4F, 0xD1,
+    0xE1, 0xD9, 0x62, 0x37, 0xC8, 0x70, 0xFA, 0x8D, 0xF3, 0x0F, 0x9A, 0xF2, 0x60, 0x3F, 0x88, 0x76,
+    0x09, 0x93, 0x81, 0x9C, 0x0F, 0x72, 0x49, 0x3D, 0x1D, 0x14, 0x55, 0x9A, 0x05, 0x14, 0x51, 0x40,
+    0x19, 0x5E, 0x26, 0xF0, 0xCE, 0x9F, 0xA9, 0x42, 0xD1, 0xEA, 0xB0, 0x6F, 0x8C, 0xFC, 0xC8, 0xE3,
+    0xEF, 0x5B, 0x4C, 0x07, 0x0D, 0x6E, 0xFD, 0x8A, 0x67, 0xE9, 0xD8, 0x82, 0x09, 0x15, 0xF2, 0x8F,
+    0x8D, 0x3C, 0x27, 0x73, 0xA5, 0x5C, 0x3C, 0x57, 0x6D, 0xE6, 0x63, 0x12, 0x5B, 0x5C, 0x85, 0x20,
+    0x5D, 0x5B, 0xB8, 0xE1, 0x90, 0x1F, 0xC8, 0xE0, 0x90, 0x08, 0x23, 0x27, 0x15, 0xF6, 0x1D, 0x79,
+    0x67, 0xED, 0x09, 0xE1, 0xCF, 0x3E, 0xD1, 0x65, 0x49, 0x30, 0xD0, 0x37, 0xCE, 0x84, 0xF1, 0x25,
+    0xBD, 0xDB, 0x2A, 0x9D, 0xA3, 0x07, 0x91, 0x20, 0x4E, 0xE0, 0x63, 0x3D, 0x4E, 0x29, 0x32, 0x64,
+    0x8F, 0x9C, 0xE8, 0xA2, 0x8A, 0x82, 0x0E, 0xD4, 0xFC, 0x35, 0x64, 0x78, 0xFE, 0xDB, 0xAC, 0x5A,
+    0x43, 0x67, 0x23, 0xFD, 0x91, 0xAF, 0xCE, 0x33, 0xA7, 0x4D, 0xE5, 0xB1, 0x29, 0xAA, 0xC4, 0xEC,
+    0xA1, 0x1E, 0xDD, 0x40, 0xDC, 0xA6, 0x5D, 0xDC, 0xE2, 0x3D, 0xE4, 0x10, 0x1E, 0x3E, 0x17, 0x5C,
+    0xF9, 0x93, 0xC6, 0x65, 0xBE, 0x6B, 0x98, 0xE2, 0x3A, 0xB5, 0x95, 0x9A, 0x5B, 0x9D, 0xD7, 0x71,
+    0x24, 0xBB, 0x4A, 0xBF, 0x98, 0xEB, 0xCA, 0xB6, 0x3E, 0xE1, 0x99, 0x0F, 0x3B, 0x19, 0x88, 0x00,
+    0xE3, 0xDD, 0x78, 0xE3, 0x54, 0x91, 0x63, 0x02, 0x58, 0xE2, 0x28, 0x5A, 0x64, 0x96, 0x20, 0x47,
+    0x9B, 0x33, 0x02, 0x15, 0x9A, 0x0C, 0xED, 0x0D, 0x69, 0x19, 0xDA, 0x85, 0x63, 0x56, 0x45, 0x00,
+    0x29, 0xF9, 0x57, 0x06, 0xA1, 0xE3, 0x19, 0xAE, 0x27, 0x59, 0x2F, 0xB4, 0xFB, 0x4B, 0x82, 0x10,
+    0xD9, 0x9B, 0x5B, 0x87, 0x99, 0xD6, 0x48, 0xDD, 0x5C, 0x7C, 0xCF, 0x34, 0xCC, 0xC0, 0xAE, 0xF2,
+    0x46, 0x24, 0x5C, 0x1C, 0x11, 0xCD, 0x03, 0x2F, 0x47, 0xE0, 0x38, 0x8C, 0x2F, 0x21, 0xD7, 0x2D,
+    0x08, 0x47, 0x96, 0xCA, 0x5D, 0x83, 0x2B, 0x2C, 0x96, 0x50, 0xBB, 0x6E, 0xB7, 0x97, 0x70, 0xCA,
+    0x4C, 0xE6, 0x14, 0x0D, 0x81, 0x96, 0x70, 0x31, 0xF7, 0x77, 0xE8, 0xDF, 0x7C, 0x33, 0xD3, 0xE1,
+    0x68, 0x95, 0xFC, 0x4F, 0xE7, 0x79, 0xB2, 0x34, 0x16, 0x73, 0xDB, 0x41, 0xBD, 0x2E, 0x6C, 0xE3,
+    0x0D, 0xF3, 0xD9, 0xCE, 0xB2, 0xE1, 0x8A, 0xB8, 0x55, 0x28, 0x0F, 0x99, 0xB8, 0xE1, 0x03, 0xFC,
+    0xBB, 0xF9, 0xCB, 0x8F, 0x17, 0xDE, 0x38, 0x3F, 0xBA, 0x80, 0x49, 0xBA, 0x67, 0x4B, 0xD2, 0x5D,
+    0x9E, 0x2B, 0x6D, 0x41, 0x18, 0x3C, 0x6B, 0x24, 0xAE, 0xD9, 0x46, 0xDE, 0xC7, 0x90, 0x58, 0x31,
+    0x24, 0x36, 0x49, 0xCD, 0xEB, 0xDF, 0x89, 0x5A, 0xCC, 0xBB, 0x76, 0xBC, 0x11, 0x01, 0x24, 0xFA,
+    0x81, 0x88, 0x02, 0xC9, 0x34, 0xDA, 0x9E, 0xED, 0xC2, 0x5B, 0x69, 0xD9, 0xD7, 0x0A, 0x8C, 0xC0,
+    0x0D, 0x80, 0x00, 0x49, 0x39, 0x24, 0x92, 0x01, 0x6E, 0xDB, 0xE1, 0x8D, 0xDB, 0xC8, 0xD1, 0x19,
+    0xE4, 0x4D, 0x40, 0x20, 0x92, 0x1B, 0x43, 0x1F, 0xC9, 0x2D, 0xE9, 0xF3, 0x09, 0x8A, 0x4B, 0xA0,
+    0xDF, 0x2B, 0x18, 0x63, 0x2C, 0xA5, 0x90, 0x2B, 0xE0, 0x95, 0x3B, 0x36, 0xBB, 0x61, 0xC9, 0xE1,
+    0x99, 0xC4, 0x0F, 0x22, 0x19, 0x33, 0x13, 0x8B, 0x1D, 0x72, 0xC9, 0xE3, 0x60, 0xFA, 0x74, 0xD2,
+    0xB3, 0xE0, 0xC9, 0xC1, 0x1B, 0x4E, 0xCC, 0x64, 0xB2, 0xB0, 0x6F, 0x94, 0xAF, 0x42, 0x75, 0x74,
+    0x3F, 0x8A, 0x9E, 0x24, 0xB3, 0x2E, 0x61, 0xD4, 0xA4, 0x9E, 0x47, 0x0B, 0x14, 0xB7, 0x37, 0x44,
+    0xBB, 0x24, 0x70, 0xAC, 0xB8, 0x11, 0x34, 0x84, 0xF0, 0x8F, 0x21, 0x6E, 0x9D, 0x40, 0xCF, 0x19,
+    0x06, 0xA3, 0x78, 0xF3, 0x52, 0x01, 0xC5, 0x90, 0x82, 0xD3, 0xCC, 0x59, 0x2D, 0x75, 0x77, 0x8F,
+    0x71, 0x3A, 0xA4, 0x17, 0x52, 0xB3, 0x7F, 0xA6, 0x99, 0x99, 0xF2, 0x61, 0xDE, 0xC0, 0x37, 0xFA,
+    0xCC, 0x1C, 0x16, 0x34, 0x01, 0x47, 0xC2, 0xDA, 0x34, 0x37, 0xB3, 0xA4, 0x77, 0x57, 0xFF, 0x00,
+    0x63, 0x8D, 0xB7, 0x19, 0xAF, 0x76, 0x16, 0x16, 0xCB, 0x1C, 0x6C, 0x73, 0x22, 0x02, 0x38, 0x18,
+    0xE4, 0x92, 0x02, 0x8F, 0x99, 0x8E, 0x01, 0xAB, 0x7E, 0x35, 0xF0, 0xA3, 0x69, 0x92, 0xAA, 0x48,
+    0xF7, 0x65, 0xCA, 0x0B, 0x99, 0x52, 0x78, 0xC2, 0x98, 0x99, 0x9D, 0x86, 0x06, 0xC9, 0x24, 0x04,
+    0x15, 0x00, 0xE5, 0x64, 0x23, 0x9C, 0x1C, 0x10, 0x40, 0xCD, 0xD0, 0xF5, 0x67, 0xB3, 0x99, 0x24,
+    0x8A, 0xDE, 0x09, 0x9D, 0x18, 0x5C, 0xC1, 0x14, 0xBB, 0xB6, 0x99, 0xA3, 0x3C, 0x17, 0x08, 0xCA,
+    0x7E, 0x46, 0xC1, 0xFB, 0xD8, 0xF5, 0xC8, 0xE2, 0xA7, 0xF1, 0x1F, 0x88, 0xEE, 0x6F, 0xDC, 0x35,
+    0xDC, 0x70, 0x47, 0x85, 0x16, 0xF0, 0x43, 0x10, 0x38, 0x8D, 0x03, 0x12, 0x77, 0x3B, 0x96, 0x24,
+    0xCB, 0x23, 0x33, 0x12, 0xCE, 0xCC, 0x49, 0x24, 0x9A, 0x00, 0xD9, 0x87, 0xC0, 0x0C, 0xD6, 0x7E,
+    0x78, 0xD4, 0x63, 0x07, 0xCB, 0x3A, 0x8C, 0x76, 0xAC, 0xA0, 0x07, 0x58, 0x6F, 0x0C, 0x6C, 0x04,
+    0xF2, 0x3A, 0xE4, 0x81, 0x82, 0x36, 0x86, 0x39, 0x3B, 0x58, 0x29, 0x29, 0xBF, 0x1B, 0xC2, 0xDA,
+    0x34, 0x37, 0xB3, 0xA4, 0x77, 0x57, 0xFF, 0x00, 0x63, 0x8D, 0xB7, 0x19, 0xAF, 0x76, 0x16, 0x16,
+    0xCB, 0x1C, 0x6C, 0x73, 0x22, 0x02, 0x38, 0x18, 0xE4, 0x92, 0x02, 0x8F, 0x99, 0x8E, 0x01, 0xA2,
+    0xC3, 0xC4, 0x77, 0x36, 0xE8, 0xC9, 0x6B, 0x1C, 0x0B, 0x1B, 0xAF, 0x93, 0x7A, 0x30, 0x73, 0x70,
+    0xFB, 0x65, 0x01, 0xBC, 0xDC, 0xE4, 0x14, 0x49, 0x59, 0x7E, 0x52, 0xAA, 0xC3, 0x87, 0x0C, 0x0B,
+    0x03, 0x46, 0xC6, 0xFA, 0x68, 0x18, 0x35, 0xAC, 0x9B, 0x24, 0x19, 0x30, 0xCB, 0x81, 0x98, 0x98,
+    0x83, 0xCC, 0x64, 0xF4, 0x29, 0x9C, 0x82, 0x39, 0x53, 0xCA, 0x90, 0x40, 0x34, 0x01, 0xDC, 0x5A,
+    0xFC, 0x25, 0x99, 0xDD, 0x91, 0x75, 0x2F, 0x32, 0x60, 0xB0, 0xDC, 0xD8, 0x47, 0x14, 0x60, 0x8D,
+    0x52, 0x1B, 0x96, 0x6D, 0xC6, 0xCA, 0xEA, 0x47, 0x44, 0x3B, 0x22, 0x46, 0x75, 0xFD, 0xE6, 0x5D,
+    0x47, 0x3B, 0x58, 0x38, 0x5E, 0x2F, 0x56, 0xB2, 0x58, 0x25, 0x91, 0x12, 0x49, 0x24, 0x08, 0xED,
+    0x6C, 0x92, 0xBA, 0x15, 0x32, 0x2C, 0x4E, 0x46, 0x64, 0x81, 0xF9, 0x05, 0xB1, 0xD0, 0xF2, 0x3A,
+    0x1A, 0xDF, 0xD1, 0x7E, 0x23, 0xEA, 0x56, 0x8C, 0xC6, 0x0B, 0x7B, 0x19, 0x89, 0xF2, 0xE3, 0xB5,
+    0x17, 0x2A, 0xCF, 0xFD, 0x9B, 0x69, 0x67, 0x36, 0xE5, 0x8E, 0xC1, 0xA5, 0x72, 0x42, 0x06, 0xC7,
+    0x72, 0x46, 0x01, 0x04, 0x30, 0x06, 0xB0, 0x35, 0x6D, 0x4A, 0x5B, 0xA9, 0x64, 0x92, 0xE1, 0x63,
+    0x59, 0x24, 0x76, 0xBC, 0x99, 0x53, 0xA2, 0xC9, 0x33, 0x92, 0x7C, 0xB0, 0x49, 0xE0, 0x13, 0xEA,
+    0x68, 0x03, 0xA6, 0x7F, 0x87, 0x72, 0x45, 0x86, 0xD5, 0xAE, 0xA7, 0xB3, 0xB3, 0x32, 0x0B, 0x3F,
+    0xB7, 0xC9, 0x1A, 0x86, 0xB6, 0xCD, 0xBB, 0xB9, 0x17, 0xD6, 0x4F, 0x2A, 0xB2, 0xBC, 0x6A, 0x17,
+    0xE5, 0xDA, 0xDB, 0xB3, 0x98, 0xCB, 0x7C, 0x9B, 0xEF, 0x69, 0x9F, 0x0B, 0x61, 0xB9, 0x9A, 0x68,
+    0xED, 0xF5, 0xFF, 0x00, 0xF5, 0x7B, 0x22, 0xB6, 0xD4, 0x1A, 0x12, 0x22, 0xBB, 0xB9, 0xBB, 0x2F,
+    0xE5, 0x86, 0x97, 0x7E, 0x40, 0xBA, 0x40, 0xB8, 0x6D, 0x8C, 0xA4, 0x9C, 0x29, 0x6C, 0xA1, 0x92,
+    0xAC, 0xFF, 0x00, 0x15, 0xB5, 0x39, 0x36, 0xFD, 0xAA, 0xC3, 0x4D, 0x98, 0x87, 0x17, 0xB7, 0x6C,
+    0xFE, 0x6F, 0xFC, 0x4C, 0xA7, 0x10, 0xC8, 0xA4, 0xDE, 0xA0, 0x94, 0x02, 0x24, 0x49, 0x08, 0x20,
+    0x2A, 0x82, 0xA0, 0x21, 0x1E, 0x58, 0x0B, 0x59, 0xA7, 0xC7, 0xDA, 0xB1, 0x66, 0x62, 0xF0, 0x12,
+    0xD0, 0x37, 0x87, 0xEE, 0x17, 0x6F, 0xFA, 0xEB, 0x49, 0xC1, 0xDC, 0x64, 0x6E, 0xA5, 0xE5, 0x98,
+    0x99, 0x0B, 0x6E, 0xC9, 0x63, 0xCF, 0x1C, 0x50, 0x06, 0x3E, 0xAD, 0x60, 0xD6, 0xF2, 0xC8, 0x8F,
+    0xE6, 0x65, 0x1D, 0xAD, 0x5C, 0x38, 0x00, 0xEE, 0x89, 0xC8, 0xFD, 0xE2, 0xA3, 0x30, 0xCF, 0x1D,
+    0x9D, 0x87, 0xA1, 0x3D, 0x6B, 0x7F, 0xC6, 0x1E, 0x06, 0xFE, 0xCF, 0x50, 0xD0, 0x6A, 0x1F, 0x6D,
+    0x4F, 0x36, 0x6D, 0x26, 0xE6, 0x64, 0x4C, 0x2D, 0xBD, 0xC5, 0xA1, 0x5C, 0x07, 0x6D, 0xC7, 0x06,
+    0x55, 0x27, 0x82, 0xAA, 0x78, 0x25, 0x77, 0x2E, 0x18, 0xF3, 0x33, 0xCF, 0x2C, 0x8C, 0x5A, 0xE2,
+    0x59, 0x24, 0x90, 0x93, 0x2C, 0xD2, 0xB9, 0xC9, 0x96, 0x47, 0x3C, 0x99, 0x18, 0xF7, 0x63, 0x5A,
+    0xBA, 0xBF, 0x8B, 0xB5, 0x4B, 0xC5, 0x61, 0xAA, 0x5E, 0x49, 0x3E, 0x5C, 0x5E, 0xBB, 0x12, 0x47,
+    0xEF, 0x80, 0x6E, 0x4C, 0x48, 0x40, 0x24, 0xAB, 0x01, 0x92, 0xA5, 0x82, 0x80, 0xAA, 0x42, 0x8C,
+    0x50, 0x20, 0xF0, 0xFF, 0x00, 0x87, 0x5A, 0xF4, 0x30, 0x82, 0x59, 0x16, 0xE3, 0x29, 0x06, 0x99,
+    0x09, 0x50, 0x12, 0xF6, 0xE6, 0x66, 0x3F, 0x24, 0x97, 0x6E, 0xEA, 0x15, 0x99, 0x03, 0x15, 0x04,
+    0x1D, 0xF8, 0x20, 0x73, 0x80, 0x6F, 0x1F, 0x04, 0xCA, 0x52, 0x47, 0xB7, 0x92, 0xED, 0xE3, 0x8C,
+    0x39, 0xD4, 0x60, 0xF2, 0x7F, 0x7B, 0x67, 0x22, 0x49, 0x20, 0x51, 0x77, 0x6E, 0x8C, 0xDB, 0x44,
+    0x81, 0x09, 0x62, 0xCE, 0xBB, 0x00, 0x6C, 0x83, 0xFB, 0xBF, 0x32, 0x0F, 0x0C, 0xF8, 0xE3, 0x54,
+    0xD3, 0x52, 0x55, 0xD2, 0x25, 0x8E, 0x13, 0x21, 0x8E, 0x49, 0x2E, 0xB0, 0x77, 0x42, 0xD6, 0x72,
+    0x12, 0x3C, 0x93, 0x9C, 0x61, 0xF2, 0x41, 0x05, 0x58, 0x11, 0xC5, 0x4F, 0x3F, 0xC4, 0x1D, 0x4E,
+    0x45, 0x99, 0x6E, 0x84, 0x72, 0xC7, 0x2B, 0xBD, 0xEA, 0x44, 0xCF, 0x28, 0x1A, 0x64, 0xF7, 0x02,
+    0x5D, 0xC7, 0x4E, 0x54, 0x90, 0x60, 0x48, 0x26, 0x7C, 0x83, 0xB8, 0x37, 0xF1, 0x03, 0x40, 0xCC,
+    0xAF, 0x0F, 0x69, 0xD6, 0x97, 0x33, 0x2A, 0xEA, 0x3A, 0x9C, 0x7A, 0x7C, 0x04, 0x34, 0x97, 0x17,
+    0xEC, 0xBB, 0x84, 0x0B, 0x14, 0x4C, 0x78, 0x88, 0x11, 0x93, 0x21, 0x18, 0x00, 0x1C, 0x92, 0x78,
+    0xC9, 0xE2, 0xBB, 0x4D, 0x33, 0xE1, 0x1C, 0x72, 0xCF, 0x34, 0x57, 0x7A, 0xBD, 0xF5, 0xA3, 0x46,
+    0xA9, 0x71, 0x6C, 0x8F, 0x66, 0xC5, 0xEF, 0x62, 0x68, 0xDC, 0xB1, 0x4B, 0x78, 0xDC, 0xF1, 0x6F,
+    0x22, 0x14, 0xDC, 0xAC, 0xE8, 0xCD, 0x80, 0xA4, 0x92, 0xB9, 0xE2, 0xFC, 0x3B, 0xAF, 0xDD, 0xE9,
+    0xF3, 0xA4, 0xBA, 0x73, 0x46, 0x26, 0x43, 0xBE, 0x30, 0xE3, 0x21, 0xD5, 0x94, 0x82, 0x24, 0x5F,
+    0x47, 0x42, 0x47, 0x50, 0x7D, 0x08, 0x3C, 0xD6, 0xC3, 0xFC, 0x48, 0xD5, 0x58, 0x83, 0x2A, 0xC1,
+    0x24, 0x82, 0x21, 0xA5, 0xAD, 0xD4, 0x86, 0x42, 0xE0, 0xA3, 0xBB, 0x09, 0x3E, 0xD0, 0xD2, 0x13,
+    0xBE, 0x39, 0x1C, 0xB0, 0xF9, 0xB6, 0x06, 0x0A, 0x42, 0xE5, 0x50, 0xA8, 0x05, 0xE9, 0x3E, 0x19,
+    0xF9, 0x56, 0xB2, 0xCB, 0xA8, 0xEA, 0xBE, 0x4C, 0xB1, 0x28, 0x6B, 0x9D, 0x2D, 0x23, 0xDC, 0xC9,
+    0x70, 0xD7, 0xB3, 0x44, 0x03, 0xCD, 0xBC, 0x0C, 0x19, 0x62, 0xEA, 0x0B, 0x1E, 0xBF, 0x2F, 0x03,
+    0x74, 0x9F, 0xF0, 0xAA, 0x2E, 0xD1, 0xA3, 0x3A, 0x84, 0xD7, 0x76, 0x56, 0x0E, 0x1D, 0xE5, 0xD4,
+    0xEE, 0x21, 0xC3, 0x5B, 0x35, 0xBC, 0x12, 0xBE, 0x1F, 0x4F, 0xDF, 0xBB, 0x22, 0x28, 0xF9, 0xE0,
+    0x0C, 0xE7, 0x61, 0x65, 0xDA, 0xCD, 0x9B, 0x71, 0xF1, 0x33, 0x5D, 0x78, 0xCA, 0xAC, 0xF0, 0x47,
+    0xB9, 0x66, 0xB6, 0xD4, 0xE7, 0x44, 0x1B, 0xB5, 0x38, 0x6F, 0xE6, 0x66, 0x61, 0x77, 0x9C, 0x8F,
+    0xDD, 0xBB, 0xBE, 0xDC, 0x2A, 0x95, 0xC9, 0xC7, 0x53, 0x56, 0xFC, 0x59, 0xF1, 0x6B, 0x5B, 0xD5,
+    0x15, 0x57, 0x50, 0x87, 0x4D, 0x58, 0xD5, 0xD2, 0xF6, 0x08, 0xA3, 0x8F, 0x21, 0x67, 0x80, 0x3F,
+    0x2E, 0xB2, 0x96, 0xC8, 0x90, 0x3F, 0x20, 0xE4, 0x1C, 0x0E, 0x07, 0x39, 0x00, 0xC3, 0xF1, 0x67,
+    0x87, 0x5B, 0x4E, 0x9B, 0xCA, 0x9A, 0x59, 0x1A, 0x70, 0x91, 0xCB, 0xA8, 0xA3, 0x28, 0x02, 0xDA,
+    0xE6, 0x78, 0x83, 0x15, 0x8D, 0x95, 0xDB, 0x22, 0x20, 0xC0, 0x67, 0x8C, 0x9C, 0xE0, 0x63, 0x93,
+    0xA3, 0x6F, 0xE0, 0x37, 0x92, 0xD4, 0xCD, 0x06, 0xA7, 0x03, 0xB8, 0x8B, 0xFB, 0x55, 0xF4, 0xA5,
+    0x56, 0xF3, 0x3C, 0x91, 0x7A, 0xD1, 0x92, 0xA3, 0xA6, 0xC8, 0xD5, 0x0B, 0x16, 0xCE, 0x57, 0xA3,
+    0x28, 0x04, 0x35, 0x63, 0xEB, 0xBA, 0xDB, 0xDE, 0x38, 0x69, 0x2D, 0xE3, 0x84, 0x80, 0x53, 0x62,
+    0xBC, 0xAC, 0x19, 0x9E, 0x46, 0x62, 0x4B, 0x5C, 0x49, 0x21, 0xCC, 0x8E, 0xC4, 0x9F, 0x98, 0x0C,
+    0xF3, 0x8C, 0x92, 0x4C, 0xF6, 0x9E, 0x27, 0x9E, 0x18, 0xB6, 0x5A, 0x5A, 0xDA, 0x46, 0x71, 0x24,
+    0x52, 0x5E, 0x1D, 0xCC, 0xCF, 0x15, 0xE2, 0x61, 0xC2, 0xA4, 0x8C, 0xCA, 0xA6, 0x58, 0xF0, 0xA4,
+    0xAC, 0x6A, 0xF8, 0x00, 0x6E, 0xEB, 0x90, 0x0D, 0x8B, 0xAF, 0x87, 0x13, 0x5B, 0xBA, 0xFF, 0x00,
+    0x6A, 0xDE, 0x7D, 0x9E, 0xD9, 0x98, 0x46, 0xB2, 0x2A, 0x06, 0x9A, 0x18, 0x5A, 0xDB, 0xCC, 0x2D,
+    0x73, 0xA5, 0xAB, 0xE4, 0x7D, 0x8A, 0x22, 0xA6, 0x40, 0x4E, 0x57, 0x39, 0x5D, 0xC3, 0x04, 0xDB,
+    0xD1, 0xBE, 0x16, 0x35, 0xCD, 0xC4, 0xD0, 0x8D, 0x5E, 0x38, 0xDD, 0x48, 0x8F, 0x47, 0xBB, 0x08,
+    0x1A, 0x3D, 0x51, 0xA7, 0x86, 0x47, 0x4D, 0xD2, 0x47, 0x21, 0xDA, 0x2E, 0x6D, 0xD0, 0xB8, 0x21,
+    0x5C, 0x01, 0x90, 0x79, 0xC0, 0x6C, 0x69, 0xFC, 0x71, 0x72, 0xE8, 0x11, 0xF4, 0xDD, 0x28, 0x40,
+    0x25, 0x7D, 0x55, 0x6D, 0x12, 0x32, 0x10, 0x9B, 0xA5, 0x20, 0xA3, 0x44, 0xAC, 0x01, 0x0A, 0xA7,
+    0x0A, 0x48, 0xF3, 0x10, 0x7D, 0xC7, 0x5C, 0x0A, 0xBD, 0x07, 0xC5, 0x3D, 0x61, 0x5A, 0x36, 0x74,
+    0x82, 0x59, 0x23, 0xF2, 0xCA, 0x4D, 0x2B, 0xCA, 0x5A, 0xE1, 0xED, 0x05, 0xC6, 0x0D, 0xCC, 0xDE,
+    0x6E, 0x4F, 0x98, 0x6E, 0x1F, 0x23, 0x70, 0x53, 0xC0, 0xC0, 0x5C, 0x82, 0x01, 0x47, 0x4B, 0xF0,
+    0x6C, 0xD7, 0x36, 0xED, 0x2D, 0xA2, 0xDF, 0x4A, 0x89, 0xBD, 0x6F, 0xF6, 0x44, 0x36, 0xDA, 0x34,
+    0x10, 0x48, 0xF9, 0x79, 0xD9, 0xC0, 0xC3, 0x2A, 0xAF, 0x4C, 0x91, 0x93, 0x91, 0x9F, 0x2C, 0x49,
+    0xB3, 0x73, 0xF0, 0xE7, 0x4D, 0x8D, 0xA0, 0x03, 0xC4, 0xD2, 0x4D, 0x1C, 0xC7, 0xCC, 0xB6, 0xBD,
+    0x86, 0xD8, 0x98, 0xD6, 0xC0, 0x19, 0x72, 0xED, 0x33, 0x48, 0xBC, 0xD9, 0x84, 0x53, 0x22, 0x9D,
+    0xA6, 0x30, 0x73, 0x96, 0xC1, 0xAC, 0xA9, 0xBE, 0x22, 0xEB, 0x4C, 0xAC, 0xA2, 0xEA, 0x44, 0xB7,
+    0x64, 0x92, 0xD2, 0xE2, 0xC9, 0x64, 0x93, 0x6C, 0xCB, 0x79, 0x3B, 0xB9, 0x69, 0x0B, 0x39, 0x25,
+    0x95, 0xDF, 0xAE, 0xEC, 0x90, 0x02, 0xBE, 0xE0, 0x58, 0x31, 0xA4, 0x78, 0xE9, 0xED, 0x0A, 0x1B,
+    0x2D, 0x0B, 0x46, 0x52, 0x92, 0x1D, 0x4D, 0x03, 0x09, 0x48, 0x96, 0x66, 0x56, 0x0A, 0x27, 0x56,
+    0x94, 0xE4, 0x5A, 0x06, 0xF9, 0x3F, 0x89, 0x48, 0xC8, 0x39, 0x2C, 0x58, 0x03, 0x46, 0xEF, 0xE1,
+    0x56, 0xA1, 0x13, 0xBC, 0x6E, 0xD3, 0xB5, 0xEA, 0xAA, 0x49, 0x1C, 0x4B, 0x16, 0x22, 0x9A, 0x6B,
+    0x8B, 0xA6, 0x50, 0xBF, 0xDA, 0x2E, 0xCA, 0x07, 0x9F, 0x18, 0x0C, 0xA4, 0x8C, 0x31, 0xCC, 0x7C,
+    0x38, 0xC1, 0xCE, 0x5F, 0x00, 0x5F, 0xB4, 0x1E, 0x6A, 0xCD, 0x68, 0x90, 0x81, 0x33, 0x5D, 0xBC,
+    0xB2, 0x20, 0x1B, 0xAC, 0x58, 0x02, 0x6C, 0x58, 0x31, 0xDE, 0xB3, 0x3B, 0x22, 0x2B, 0x2E, 0x46,
+    0xF3, 0xB4, 0xE0, 0x61, 0x88, 0x9F, 0x11, 0xB5, 0xB2, 0xE1, 0xAE, 0xEE, 0x23, 0xBA, 0x98, 0x22,
+    0x59, 0x41, 0x77, 0x20, 0xC4, 0x90, 0x41, 0x6F, 0x26, 0x71, 0x0D, 0xE4, 0x45, 0x58, 0x19, 0x41,
+    0x65, 0x62, 0x1F, 0x2C, 0x09, 0xDC, 0x73, 0x82, 0x34, 0x7F, 0xE1, 0x6E, 0x6A, 0xBE, 0x5C, 0xCA,
+    0x34, 0xFD, 0x28, 0x79, 0xCB, 0x25, 0xB5, 0xF4, 0xFB, 0x64, 0xDD, 0xE4, 0xDD, 0x4D, 0x33, 0x62,
+    0x3F, 0xDE, 0x63, 0xF7, 0x6F, 0x3B, 0xE3, 0xE5, 0xCF, 0xF7, 0xB3, 0x8A, 0x00, 0xA3, 0xE2, 0x8F,
+    0x04, 0xC3, 0x63, 0x1E, 0xF4, 0xD6, 0xE0, 0xBB, 0xDC, 0xC8, 0x6C, 0x16, 0x34, 0x20, 0x5C, 0x59,
+    0x5C, 0xC4, 0xCC, 0x19, 0x8B, 0x90, 0x43, 0xC6, 0x81, 0x0B, 0x2E, 0xC3, 0xB4, 0x3A, 0x1D, 0xC7,
+    0x70, 0xAE, 0x56, 0xBA, 0x0D, 0x5F, 0xC6, 0x53, 0xDC, 0xC4, 0xD1, 0x47, 0xA7, 0x69, 0xB6, 0x76,
+    0xC6, 0x41, 0xAB, 0x35, 0xAD, 0xB2, 0xB0, 0x09, 0x7A, 0x11, 0x81, 0x31, 0x87, 0x76, 0xC0, 0x91,
+    0x18, 0x0C, 0x0F, 0x94, 0x60, 0x6D, 0x03, 0x9C, 0xF3, 0xF4, 0x08, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0xC5, 0xA2, 0x8A, 0x2A, 0x0A, 0x0A, 0x28, 0xA2, 0x80, 0x3D, 0xCF, 0xE3, 0xC7,
+    0xFC, 0xBB, 0xFF, 0x00, 0xDB, 0x5F, 0xFD, 0xA5, 0x5E, 0x4D, 0x5E, 0xB3, 0xF1, 0xE3, 0xFE, 0x5D,
+    0xFF, 0x00, 0xED, 0xAF, 0xFE, 0xD2, 0xAF, 0x26, 0xAF, 0x17, 0x86, 0xBF, 0x85, 0x1F, 0xFB, 0x7B,
+    0xFF, 0x00, 0x4A, 0x67, 0xA1, 0x9B, 0xFC, 0x6F, 0xE5, 0xF9, 0x20, 0xAF, 0xA3, 0x3F, 0x67, 0x3F,
+    0xF8, 0xF1, 0x93, 0xFE, 0xBB, 0xB7, 0xFE, 0x93, 0xC3, 0x5F, 0x39, 0xD7, 0xBB, 0xFE, 0xCE, 0x1E,
+    0x20, 0x84, 0xA4, 0xD0, 0x32, 0xED, 0x94, 0x37, 0xF6, 0xB4, 0x2D, 0xCF, 0xEF, 0xA1, 0x75, 0x45,
+    0x3C, 0x63, 0x8F, 0x28, 0x85, 0xFE, 0x2C, 0x9C, 0xF0, 0x38, 0x35, 0xEF, 0xA3, 0xCF, 0x89, 0xED,
+    0x14, 0x51, 0x45, 0x51, 0x61, 0x45, 0x14, 0x50, 0x01, 0x5C, 0x3F, 0xC6, 0xBF, 0xF9, 0x06, 0x5C,
+    0x7F, 0xDB, 0x2F, 0xFD, 0x2B, 0x8E, 0xBB, 0x8A, 0xF3, 0x2F, 0x8F, 0xDE, 0x20, 0x86, 0x0B, 0x2F,
+    0x29, 0x97, 0x74, 0xB3, 0x30, 0x8E, 0x15, 0xE7, 0xF7, 0x70, 0xDB, 0x3A, 0xB1, 0x6C, 0xE0, 0xF4,
+    0x21, 0x46, 0x32, 0x0F, 0x39, 0x1D, 0x0D, 0x0C, 0x4C, 0xF9, 0xB6, 0x8A, 0x28, 0xAC, 0xCC, 0xC2,
+    0x8A, 0xF6, 0x6F, 0x10, 0x78, 0x8A, 0xD7, 0x74, 0x33, 0xC1, 0xE2, 0xD9, 0x1A, 0xE9, 0x26, 0x64,
+    0xB4, 0xD4, 0x26, 0x92, 0x3C, 0x49, 0xA4, 0x5D, 0x40, 0xF9, 0xFF, 0x00, 0x89, 0x7C, 0x26, 0x7D,
+    0xAC, 0x11, 0x15, 0x73, 0xF6, 0x48, 0xB9, 0x60, 0x5E, 0x3D, 0xD9, 0x22, 0x4F, 0x0D, 0x78, 0x83,
+    0x4F, 0x6B, 0xD9, 0x5E, 0xF7, 0x5F, 0xB1, 0x86, 0x22, 0xC9, 0x1E, 0xBF, 0x34, 0x92, 0xE0, 0xDE,
+    0xDE, 0xC8, 0x97, 0x09, 0x9D, 0x0E, 0x6F, 0x9D, 0xB6, 0x40, 0xF2, 0x00, 0xAE, 0xB2, 0x41, 0xB2,
+    0x2E, 0x1C, 0x1E, 0x5A, 0x81, 0x9E, 0x2B, 0x45, 0x7A, 0xE5, 0xFC, 0xBA, 0x64, 0x76, 0x52, 0x2D,
+    0xD7, 0x88, 0xB4, 0x3B, 0xA6, 0xDB, 0x3D, 0xBC, 0x17, 0x6E, 0x5A, 0x5B, 0x8B, 0xCD, 0x55, 0x6F,
+    0xE5, 0x2A, 0xDF, 0x66, 0x2C, 0xEA, 0xA9, 0x73, 0x6E, 0x0E, 0xD6, 0xEA, 0x8C, 0xE5, 0x94, 0xE5,
+    0x89, 0x63, 0x4F, 0xF1, 0x24, 0xA2, 0x58, 0xA4, 0xBE, 0xF1, 0x17, 0x99, 0x76, 0x64, 0x2F, 0x7F,
+    0xE4, 0xCD, 0x08, 0x54, 0x3F, 0x64, 0x9A, 0x32, 0xF3, 0x5A, 0x4B, 0x22, 0xC6, 0x24, 0x5D, 0x9B,
+    0x51, 0xD6, 0x46, 0x42, 0x9B, 0x5A, 0x44, 0x05, 0x80, 0x90, 0x03, 0xC8, 0xE8, 0xAF, 0x63, 0xB6,
+    0xD6, 0x34, 0x6B, 0x59, 0x09, 0x9E, 0x7D, 0x2A, 0xE2, 0x11, 0x14, 0x43, 0x51, 0x10, 0x5C, 0x82,
+    0xA3, 0x52, 0xB4, 0x96, 0x78, 0x93, 0xEC, 0x1B, 0xE1, 0x32, 0x7F, 0xA2, 0x44, 0x50, 0x86, 0x8C,
+    0xAB, 0xA2, 0x0D, 0xE5, 0xA5, 0x62, 0x0B, 0xE6, 0xDA, 0xCB, 0xE1, 0x79, 0x2D, 0xE5, 0x59, 0x3F,
+    0xB3, 0x66, 0x2B, 0x1D, 0xDC, 0x5A, 0x5C, 0xCC, 0xE4, 0x18, 0xA4, 0x8E, 0x62, 0xF1, 0x9B, 0x28,
+    0xA7, 0x60, 0xCA, 0x1F, 0x81, 0xB7, 0x74, 0x99, 0xC8, 0xD9, 0x92, 0x6E, 0x30, 0x01, 0xE5, 0xD4,
+    0x57, 0xB1, 0xEB, 0xFE, 0x32, 0xB6, 0xB9, 0x92, 0x2F, 0xB2, 0x6A, 0x76, 0x36, 0xF7, 0x49, 0x22,
+    0x58, 0xE9, 0x5A, 0xD9, 0x70, 0x0D, 0xA8, 0xB5, 0xB1, 0x3B, 0xBF, 0xB4, 0x6E, 0x0A, 0xCC, 0xDB,
+    0x25, 0xBC, 0x9B, 0x1C, 0xCB, 0x2C, 0x72, 0x05, 0x3F, 0x30, 0xC1, 0x91, 0x85, 0xBC, 0xD2, 0x9E,
+    0xEA, 0xE5, 0xF4, 0xC9, 0xF4, 0xA5, 0x8A, 0x75, 0x4B, 0xB6, 0x86, 0xF6, 0xE6, 0x35, 0xFB, 0x0E,
+    0xA2, 0x6F, 0x8A, 0x38, 0x0D, 0xE6, 0xC8, 0xA7, 0xCC, 0x87, 0xCE, 0x7C, 0xEC, 0x91, 0x76, 0xB0,
+    0x5D, 0xA5, 0x18, 0xA3, 0x80, 0x78, 0xE5, 0x15, 0xB3, 0xE3, 0x39, 0xE2, 0x92, 0xF2, 0xE5, 0xAD,
+    0xE5, 0x8E, 0x48, 0xCC, 0xD2, 0xCB, 0x0C, 0xA8, 0x72, 0x25, 0x8D, 0xE7, 0x6C, 0x18, 0xD8, 0x76,
+    0x61, 0x5D, 0xFF, 0x00, 0xC5, 0x88, 0xF4, 0xF3, 0x6C, 0x8D, 0x0F, 0x89, 0xB4, 0xDD, 0x42, 0xEB,
+    0xCC, 0x58, 0x27, 0x16, 0x72, 0x21, 0xFB, 0x75, 0xB2, 0xC5, 0x26, 0xD7, 0xBF, 0x8C, 0x6E, 0x62,
+    0xD6, 0xA3, 0x11, 0x82, 0xD3, 0x49, 0xF2, 0xF3, 0x9D, 0xCC, 0xD4, 0x01, 0xE4, 0xF4, 0x57, 0x71,
+    0xF0, 0xD2, 0xEF, 0x46, 0x4D, 0xE3, 0x5A, 0x10, 0x4C, 0x7C, 0xC8, 0x6E, 0x20, 0xD3, 0x26, 0x20,
+    0x26, 0xA1, 0x0C, 0x3E, 0x6E, 0xEC, 0xCD, 0x29, 0x54, 0x06, 0x0C, 0xAB, 0x0D, 0xCC, 0x0B, 0x00,
+    0x63, 0x07, 0x0E, 0xC0, 0xF5, 0x76, 0xDA, 0xBF, 0x86, 0xA0, 0xD3, 0xE5, 0x4F, 0xED, 0x7F, 0xDF,
+    0x85, 0xB9, 0xD2, 0xAC, 0x20, 0x41, 0x18, 0x92, 0x2B, 0x35, 0x96, 0x52, 0xAB, 0x7B, 0x79, 0x1E,
+    0x4B, 0x0B, 0x89, 0xA4, 0x8C, 0x9F, 0x2D, 0xF6, 0x37, 0x18, 0x1B, 0x16, 0x52, 0x40, 0x3C, 0x72,
+    0x8A, 0xF7, 0xBF, 0x12, 0xFC, 0x46, 0xD1, 0x1A, 0x48, 0x3E, 0xCF, 0xE2, 0xEB, 0xB6, 0x9A, 0x33,
+    0xF6, 0x89, 0x6F, 0xA3, 0x4C, 0x24, 0xD1, 0xC9, 0x69, 0x71, 0xB0, 0xC8, 0x86, 0x29, 0x40, 0x74,
+    0xDE, 0xAA, 0xE5, 0x61, 0x1F, 0x78, 0xFC, 0x99, 0x50, 0xB1, 0xD1, 0x93, 0xC7, 0x36, 0xB6, 0x17,
+    0x32, 0x35, 0xAC, 0xB1, 0xEA, 0x25, 0x52, 0x2B, 0xB8, 0x59, 0xEE, 0x23, 0x65, 0xBC, 0x4B, 0x44,
+    0xB9, 0x56, 0xF2, 0x2F, 0x2E, 0x2E, 0x67, 0x2A, 0x64, 0x69, 0xB7, 0xAA, 0xAF, 0xEF, 0x08, 0xF9,
+    0x0A, 0x72, 0x58, 0x81, 0x6F, 0x33, 0xC4, 0xA8, 0xAF, 0x55, 0x68, 0x74, 0x18, 0x6D, 0x6E, 0x22,
+    0x4F, 0x14, 0xCF, 0x3B, 0x0F, 0x3A, 0xFB, 0x42, 0x86, 0x17, 0x89, 0x4D, 0xBC, 0x36, 0x92, 0xCF,
+    0x1A, 0xA4, 0xD7, 0xCC, 0xC3, 0x70, 0xBE, 0x8E, 0x52, 0xFB, 0x14, 0x03, 0x8D, 0xC5, 0x46, 0x5B,
+    0xE6, 0xC6, 0xF1, 0xF7, 0x8C, 0x97, 0x50, 0x43, 0xF6, 0x98, 0xF4, 0xD8, 0xEE, 0x0B, 0xC1, 0xA8,
+    0x32, 0xDB, 0xE5, 0x84, 0xAD, 0x3D, 0x80, 0x0C, 0x62, 0x9D, 0x87, 0xCA, 0x63, 0x2A, 0x8A, 0xEB,
+    0x92, 0x32, 0x14, 0x0E, 0x51, 0x99, 0xC0, 0x38, 0x3A, 0x2B, 0xAE, 0xF0, 0x3E, 0xB5, 0x15, 0xAA,
+    0x93, 0x73, 0x77, 0x69, 0x14, 0x46, 0xE2, 0xD9, 0xEE, 0x43, 0x26, 0xE9, 0x20, 0x8E, 0x21, 0x39,
+    0xF3, 0x6C, 0x8F, 0x38, 0x36, 0x47, 0x07, 0xEE, 0x36, 0x49, 0x01, 0xB2, 0xA4, 0xAB, 0x74, 0x16,
+    0xDA, 0xCE, 0x8D, 0x15, 0xB4, 0xAB, 0xAA, 0x6A, 0x9E, 0x7D, 0xD9, 0xFB, 0x4C, 0x1A, 0x6D, 0xF6,
+    0xD0, 0xF3, 0x0B, 0x99, 0x56, 0x51, 0xFB, 0xCB, 0xA0, 0xEC, 0x04, 0x77, 0x2A, 0xC4, 0x15, 0x02,
+    0x55, 0x2C, 0xFB, 0xD2, 0x52, 0x77, 0x79, 0x60, 0x1E, 0x63, 0x45, 0x7A, 0xE6, 0xB5, 0xE2, 0xBB,
+    0x5C, 0x44, 0x62, 0xF1, 0x2F, 0x95, 0x7C, 0x1A, 0x3B, 0x8B, 0x6D, 0x41, 0x65, 0x77, 0x0D, 0x65,
+    0x6F, 0x69, 0x32, 0xA1, 0xD4, 0x64, 0xD9, 0x29, 0xDF, 0x0C, 0xC5, 0xB7, 0x28, 0x8A, 0x2F, 0x31,
+    0x5F, 0x32, 0x22, 0xB1, 0x61, 0x19, 0x1D, 0xD6, 0x8D, 0xF6, 0xBB, 0x83, 0x35, 0xFE, 0x6C, 0x96,
+    0x30, 0xD7, 0x16, 0x52, 0x5E, 0x86, 0x4B, 0xA9, 0xE5, 0x57, 0xDC, 0xB6, 0x37, 0x7E, 0x63, 0x3B,
+    0x09, 0x1E, 0x47, 0x90, 0xBA, 0x81, 0x20, 0x52, 0xF1, 0xB4, 0x44, 0xBE, 0xD2, 0x01, 0xE4, 0x74,
+    0x55, 0xBD, 0x5A, 0x3B, 0x45, 0x96, 0x41, 0xA6, 0xCD, 0x24, 0xB6, 0xC1, 0xD9, 0x34, 0xF9, 0x9F,
+    0xAC, 0xD6, 0xC1, 0xCE, 0xD3, 0x20, 0xC0, 0xE5, 0x93, 0x1F, 0xC2, 0x3E, 0x82, 0xBB, 0x1F, 0x1F,
+    0xDC, 0x69, 0xF3, 0xC4, 0x8D, 0xF6, 0xB8, 0xEE, 0xAF, 0xD4, 0xAD, 0xB5, 0xC5, 0xE2, 0xC8, 0x85,
+    0xA6, 0xB6, 0xD8, 0xFF, 0x00, 0x2E, 0xA2, 0x50, 0xFC, 0xED, 0x68, 0xEB, 0xB0, 0x48, 0x02, 0xEF,
+    0x03, 0x2E, 0xA1, 0x4C, 0x4C, 0xE0, 0x8E, 0x0E, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02,
+    0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02,
+    0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02,
+    0x8A, 0x28, 0xA0, 0x0C, 0x5A, 0x28, 0xA2, 0xA0, 0xA0, 0xA2, 0x8A, 0x28, 0x03, 0xDC, 0xFE, 0x3C,
+    0x7F, 0xCB, 0xBF, 0xFD, 0xB5, 0xFF, 0x00, 0xDA, 0x55, 0xE4, 0xD5, 0xEB, 0x3F, 0x1E, 0x3F, 0xE5,
+    0xDF, 0xFE, 0xDA, 0xFF, 0x00, 0xED, 0x2A, 0xF2, 0x6A, 0xF1, 0x78, 0x6B, 0xF8, 0x51, 0xFF, 0x00,
+    0xB7, 0xBF, 0xF4, 0xA6, 0x7A, 0x19, 0xBF, 0xC6, 0xFE, 0x5F, 0x92, 0x0A, 0xD9, 0xF0, 0x97, 0x8A,
+    0x2E, 0xF4, 0xCB, 0x84, 0x96, 0xC9, 0xDC, 0x10, 0x40, 0xBA, 0x85, 0x4E, 0x05, 0xE5, 0xB1, 0x23,
+    0x29, 0x21, 0x20, 0xF1, 0x20, 0x1E, 0x87, 0x07, 0x04, 0x72, 0x05, 0x63, 0x51, 0x5E, 0xF1, 0xE6,
+    0x9F, 0x65, 0x78, 0x67, 0xC4, 0xDA, 0x7E, 0xA5, 0x0A, 0xC9, 0xA5, 0x4F, 0xBE, 0x33, 0xF2, 0xBA,
+    0x1F, 0xBD, 0x6D, 0x30, 0x1C, 0xAD, 0xC2, 0x76, 0x29, 0x9F, 0xA7, 0x70, 0x48, 0x20, 0xD6, 0xAD,
+    0x7C, 0x79, 0xE1, 0x3F, 0x1A, 0x6A, 0xDA, 0x53, 0x96, 0xD1, 0xEE, 0xBC, 0xBC, 0xE0, 0x5D, 0xDB,
+    0xB0, 0xCA, 0xDD, 0x22, 0x36, 0x71, 0x32, 0x1F, 0xC4, 0x64, 0x10, 0xC0, 0x13, 0x82, 0x33, 0x5E,
+    0xE1, 0xE1, 0xCF, 0xDA, 0x13, 0x43, 0x9F, 0x23, 0x5A, 0xB6, 0x9F, 0x4C, 0x6E, 0x5A, 0x37, 0xE6,
+    0x45, 0x91, 0x46, 0x38, 0xDF, 0x1A, 0x83, 0x92, 0x49, 0xFE, 0x0C, 0x60, 0x75, 0xCF, 0x15, 0x49,
+    0x96, 0x99, 0xEA, 0x74, 0x57, 0x0F, 0xFF, 0x00, 0x0B, 0xAF, 0xC1, 0x9F, 0xF4, 0x1E, 0xFF, 0x00,
+    0xC8, 0x33, 0x7F, 0xF1, 0xBA, 0xCA, 0xF1, 0x07, 0xC7, 0xEF, 0x0E, 0x40, 0xBF, 0xF1, 0x29, 0xF3,
+    0xF5, 0x29, 0x4F, 0xDD, 0x89, 0x55, 0x91, 0x63, 0xC1, 0x1F, 0xEB, 0xA5, 0x95, 0x47, 0x50, 0x4E,
+    0x30, 0x8D, 0xD3, 0x9C, 0x75, 0xA7, 0x71, 0xDF, 0xCC, 0xF4, 0x3D, 0x57, 0x55, 0xB4, 0xB4, 0x8D,
+    0xA4, 0xD4, 0x6E, 0x52, 0x08, 0x14, 0x79, 0x97, 0x13, 0x37, 0x44, 0x5F, 0x60, 0x3B, 0xB1, 0xE0,
+    0x00, 0x09, 0x27, 0x81, 0xCD, 0x7C, 0xA9, 0xF1, 0x1B, 0xC7, 0x33, 0x6B, 0x17, 0x05, 0xF3, 0x3A,
+    0x5B, 0x2F, 0xEE, 0xB4, 0xAB, 0x37, 0x23, 0xFD, 0x1E, 0x1C, 0x0C, 0x92, 0xAB, 0xDE, 0x62, 0x32,
+    0x7A, 0x9E, 0xD9, 0x20, 0x0A, 0x3C, 0x73, 0xF1, 0x1B, 0x56, 0xD6, 0x1B, 0xFD, 0x36, 0x5F, 0x2E,
+    0xD8, 0x31, 0x9A, 0xC7, 0x4D, 0x4F, 0xBB, 0x6F, 0x91, 0x8F, 0x9D, 0xB0, 0x37, 0x10, 0x3B, 0x9F,
+    0x53, 0xB4, 0x00, 0x71, 0x5C, 0xAD, 0x4B, 0x64, 0xB6, 0x14, 0x51, 0x45, 0x49, 0x21, 0x45, 0x6A,
+    0xF8, 0x5B, 0x40, 0x7D, 0x42, 0x74, 0x8A, 0x29, 0xBC, 0xA7, 0x7D, 0xC9, 0x04, 0x9B, 0x19, 0x80,
+    0x99, 0x63, 0x62, 0x3C, 0xC5, 0x40, 0x48, 0x0C, 0xC0, 0x02, 0x70, 0x42, 0x8F, 0x98, 0xF0, 0x2B,
+    0xAE, 0x8B, 0xE0, 0xD5, 0xFC, 0x8E, 0x51, 0x35, 0x1B, 0x48, 0x6E, 0x15, 0x22, 0x9B, 0x53, 0x8E,
+    0xE9, 0x90, 0x2D, 0x8D, 0xCD, 0xEC, 0x8E, 0xA2, 0x37, 0x96, 0x27, 0x93, 0xE6, 0x90, 0xAA, 0x95,
+    0xF9, 0x7E, 0x60, 0x79, 0xDA, 0x70, 0x18, 0x19, 0xE7, 0x94, 0x57, 0x71, 0x77, 0xF0, 0xEA, 0xCE,
+    0x38, 0x5E, 0x45, 0xF1, 0x24, 0x0C, 0xA9, 0xE7, 0x4A, 0xA3, 0x6A, 0x1F, 0xB5, 0xDA, 0xDB, 0x4E,
+    0x63, 0x47, 0xB5, 0x58, 0xE5, 0x66, 0x22, 0xF6, 0xE3, 0x6A, 0x82, 0x63, 0x0A, 0xBF, 0x31, 0x2D,
+    0x80, 0xBB, 0xD9, 0x79, 0xF0, 0xF2, 0x25, 0x31, 0xFD, 0x8F, 0x52, 0xBB, 0x9E, 0x19, 0x49, 0x82,
+    0xCE, 0xF7, 0xC8, 0xF9, 0x0D, 0xCA, 0x2C, 0x99, 0x53, 0x34, 0x72, 0x38, 0x27, 0xCE, 0x4D, 0xA0,
+    0x23, 0x3B, 0xBE, 0x18, 0xA2, 0xB0, 0xF2, 0xFC, 0xC0, 0x0E, 0x2A, 0x8A, 0xEC, 0x57, 0xC0, 0x10,
+    0xA4, 0xEF, 0x16, 0xA7, 0xAC, 0xFD, 0x96, 0x65, 0xF9, 0xEC, 0xED, 0x7C, 0xA2, 0xD2, 0x5F, 0xAF,
+    0x97, 0x21, 0xDB, 0x1C, 0x2A, 0xD8, 0x12, 0x17, 0x55, 0x50, 0xA6, 0x40, 0x1F, 0x76, 0x63, 0x66,
+    0x52, 0xA5, 0x98, 0xFF, 0x00, 0x0E, 0xAE, 0xC5, 0xA9, 0x99, 0xAE, 0x63, 0x82, 0x45, 0x0F, 0x2D,
+    0xEE, 0x9B, 0x74, 0x36, 0x37, 0x95, 0x05, 0xC6, 0xC2, 0x6C, 0x9D, 0x89, 0x0C, 0x52, 0x4C, 0x86,
+    0x07, 0x63, 0xA9, 0xC0, 0xDA, 0x77, 0x26, 0xE0, 0x0E, 0x46, 0x8A, 0xEE, 0x35, 0xDF, 0x86, 0xF6,
+    0xD6, 0x65, 0x04, 0xFE, 0x26, 0xB1, 0x3E, 0x64, 0x9F, 0xD9, 0xD6, 0xEB, 0x81, 0x9B, 0x3B, 0x84,
+    0x8B, 0xE7, 0x1A, 0xBB, 0x23, 0xB2, 0xA7, 0xD9, 0x26, 0x64, 0x56, 0xC4, 0x8E, 0x70, 0x4B, 0x00,
+    0x71, 0x82, 0x2F, 0xC2, 0xF9, 0x44, 0x9E, 0x5D, 0xE6, 0xA5, 0xF6, 0x7B, 0x9D, 0xCB, 0x07, 0x93,
+    0x24, 0x2E, 0x16, 0xE9, 0xDE, 0x5B, 0x81, 0x8D, 0x3E, 0xEA, 0x40, 0xAA, 0x4C, 0xE9, 0x08, 0x29,
+    0xB9, 0xA3, 0x57, 0xCE, 0x03, 0x02, 0xA6, 0x80, 0x38, 0x7A, 0x2B, 0xBC, 0xB5, 0xF8, 0x57, 0x2C,
+    0x96, 0x66, 0x61, 0xA8, 0x49, 0x1D, 0xCA, 0x89, 0xA5, 0xBA, 0xD2, 0x26, 0x87, 0x69, 0x82, 0x3D,
+    0x38, 0x9D, 0xE7, 0xCC, 0x76, 0x04, 0x84, 0xC0, 0x1F, 0x2C, 0x6D, 0x87, 0x21, 0x5B, 0x1F, 0x31,
+    0x17, 0xAE, 0x3E, 0x0C, 0x4A, 0xD2, 0xC4, 0xBA, 0x66, 0xAD, 0x24, 0xF1, 0x48, 0x5E, 0x1B, 0x7D,
+    0x4A, 0x58, 0x36, 0x47, 0x24, 0x89, 0x6E, 0xEC, 0x86, 0x07, 0x0E, 0xDB, 0x96, 0xE4, 0xC6, 0xE3,
+    0x20, 0x70, 0x06, 0xEC, 0x15, 0x64, 0x2C, 0x01, 0xE6, 0xB4, 0x57, 0xA3, 0x5C, 0xFC, 0x21, 0x45,
+    0x9C, 0xC3, 0x17, 0x88, 0x60, 0xF3, 0xC4, 0x43, 0x52, 0x92, 0x09, 0x51, 0x77, 0xAC, 0xCF, 0x1C,
+    0x87, 0xCA, 0x16, 0xD0, 0xC9, 0x23, 0x17, 0x40, 0xAA, 0x4E, 0xC5, 0x71, 0xB4, 0x93, 0xFD, 0xD0,
+    0xF0, 0x69, 0xFF, 0x00, 0x09, 0xDE, 0x7B, 0x36, 0xB8, 0xB7, 0xD5, 0xBC, 0xC8, 0x95, 0x67, 0x92,
+    0xE0, 0x2C, 0x2C, 0x00, 0x6B, 0x10, 0xC4, 0x18, 0x5E, 0x52, 0x99, 0x4B, 0x95, 0x5E, 0xA1, 0x72,
+    0xA4, 0x80, 0x54, 0xE1, 0xB6, 0x80, 0x70, 0x14, 0x57, 0xA7, 0x6A, 0xFF, 0x00, 0x03, 0xEE, 0x60,
+    0x92, 0x25, 0x5D, 0x6A, 0x03, 0x14, 0xB2, 0x49, 0xA6, 0xDB, 0x5E, 0x4D, 0x19, 0x41, 0x1D, 0xDC,
+    0x50, 0x92, 0x8B, 0x34, 0x6E, 0x73, 0xFE, 0x97, 0x32, 0xBA, 0x82, 0x03, 0x0C, 0x61, 0x81, 0x3B,
+    0x80, 0xAA, 0x16, 0x7F, 0x07, 0x75, 0x29, 0xE5, 0x31, 0xDB, 0x5E, 0x41, 0xE7, 0xAA, 0xC7, 0x25,
+    0xDA, 0xC8, 0xAC, 0x05, 0x8C, 0xF3, 0x24, 0x99, 0x4B, 0xD6, 0x40, 0xC4, 0x14, 0x68, 0xCE, 0xD3,
+    0xB4, 0xC6, 0xEB, 0x86, 0x0C, 0x37, 0x20, 0x60, 0x2C, 0x70, 0x14, 0x57, 0x55, 0x1F, 0x81, 0x24,
+    0x7B, 0x53, 0x34, 0x37, 0x79, 0xD9, 0x24, 0xB6, 0x3A, 0xA6, 0x42, 0xF9, 0x56, 0x8F, 0x6B, 0x0E,
+    0xE1, 0xB2, 0xF1, 0x24, 0x6C, 0xFD, 0xAB, 0x2A, 0xAB, 0x84, 0xDA, 0x58, 0xE3, 0x77, 0x2B, 0xBB,
+    0x95, 0xA0, 0x41, 0x45, 0x75, 0x5E, 0x06, 0xF0, 0x1C, 0xDA, 0xB7, 0x99, 0xF6, 0x59, 0x67, 0x0D,
+    0x1E, 0xD7, 0x92, 0x18, 0xE3, 0x04, 0xCB, 0x0C, 0xBB, 0x87, 0xEE, 0xA4, 0x91, 0xD1, 0x72, 0x8C,
+    0x17, 0x86, 0x91, 0x49, 0x19, 0x2B, 0x92, 0xB8, 0x38, 0x7A, 0xEE, 0x99, 0xF6, 0x49, 0xE5, 0x8F,
+    0xCD, 0xF3, 0x7C, 0xB9, 0x1E, 0xCB, 0xCE, 0xC6, 0x3C, 0xDF, 0x22, 0x42, 0x33, 0xB3, 0x27, 0x1B,
+    0xB1, 0xEA, 0x68, 0x02, 0x8D, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x18, 0xB4, 0x51, 0x45, 0x41, 0x41, 0x45, 0x14,
+    0x50, 0x07, 0xB9, 0xFC, 0x78, 0xFF, 0x00, 0x97, 0x7F, 0xFB, 0x6B, 0xFF, 0x00, 0xB4, 0xAB, 0xC9,
+    0xAB, 0xD6, 0x7E, 0x3C, 0x7F, 0xCB, 0xBF, 0xFD, 0xB5, 0xFF, 0x00, 0xDA, 0x55, 0xE4, 0xD5, 0xE2,
+    0xF0, 0xD7, 0xF0, 0xA3, 0xFF, 0x00, 0x6F, 0x7F, 0xE9, 0x4C, 0xF4, 0x33, 0x7F, 0x8D, 0xFC, 0xBF,
+    0x24, 0x14, 0x51, 0x45, 0x7B, 0xA7, 0x9A, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14,
+    0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x4F, 0x67, 0x76, 0xF1, 0x12, 0x63, 0x19, 0x25, 0x5E,
+    0xDC, 0xF2, 0xC3, 0xE5, 0x9E, 0x26, 0x53, 0xCA, 0x11, 0xD1, 0x5B, 0xD7, 0x07, 0xA3, 0x02, 0x32,
+    0x0F, 0x46, 0xBF, 0x10, 0xAE, 0x44, 0x85, 0xD3, 0x46, 0xD0, 0xD5, 0xB7, 0x43, 0x3D, 0x8C, 0x6B,
+    0x11, 0xDB, 0xA4, 0xFD, 0x82, 0x5D, 0xD8, 0xD3, 0x17, 0x77, 0xCA, 0x2E, 0x64, 0xC9, 0x70, 0x0F,
+    0xCD, 0x93, 0xD0, 0x9A, 0xE5, 0x68, 0xA0, 0x0E, 0x82, 0xFB, 0xC6, 0xB7, 0xD3, 0x19, 0x4B, 0xC3,
+    0x68, 0xAF, 0x28, 0x68, 0xE5, 0x95, 0x41, 0x2D, 0x6C, 0x2E, 0x2E, 0x5D, 0xDB, 0xEC, 0x52, 0x3B,
+    0x12, 0xA2, 0x4F, 0x31, 0x90, 0x85, 0x21, 0x59, 0x49, 0xDC, 0x09, 0x39, 0xAB, 0x5A, 0x9F, 0xC4,
+    0x3B, 0xCB, 0x94, 0x89, 0x2E, 0xB4, 0xCD, 0x29, 0xA3, 0x8F, 0x11, 0x40, 0xBB, 0x5F, 0xF7, 0xB6,
+    0x68, 0xAE, 0x16, 0x3B, 0x8C, 0xBF, 0x22, 0x08, 0xDC, 0x85, 0x3F, 0xEB, 0x17, 0xAA, 0xB8, 0x62,
+    0x49, 0xE5, 0x68, 0xA0, 0x0E, 0x8F, 0x50, 0xF1, 0xF6, 0xAD, 0x2B, 0xEE, 0x89, 0xE0, 0xB4, 0xF9,
+    0x45, 0xAD, 0xBC, 0x30, 0x2F, 0x16, 0x96, 0xF1, 0x33, 0x10, 0xB6, 0xAE, 0xFB, 0x88, 0x11, 0xC8,
+    0xC5, 0x80, 0xDF, 0x85, 0x21, 0x4A, 0x63, 0x62, 0x6D, 0x81, 0x3C, 0x5F, 0x78, 0xAC, 0xED, 0x14,
+    0x50, 0x23, 0xBA, 0xCF, 0x6B, 0x78, 0xE0, 0xBE, 0x6E, 0xAD, 0xB5, 0x10, 0xD9, 0x5B, 0xA7, 0x2E,
+    0x4B, 0x79, 0x2C, 0xC5, 0x94, 0xB1, 0x66, 0xCE, 0x37, 0x16, 0x01, 0x40, 0xC3, 0xA2, 0x80, 0x3A,
+    0x7D, 0x47, 0xC7, 0xF7, 0xD3, 0x2C, 0x6B, 0x15, 0x96, 0x9B, 0x67, 0x04, 0x61, 0x45, 0x95, 0xB5,
+    0xA2, 0x15, 0xF2, 0xA7, 0x80, 0x49, 0xB5, 0xFE, 0xD3, 0xB8, 0xBE, 0xE8, 0x1A, 0x56, 0x61, 0x99,
+    0x31, 0xBB, 0x92, 0x09, 0x27, 0x25, 0xE7, 0x8F, 0x27, 0x91, 0xD9, 0x93, 0x47, 0xD1, 0xA0, 0x0C,
+    0x8B, 0x64, 0x6D, 0x62, 0x46, 0xF2, 0xE3, 0x86, 0x29, 0x0B, 0x01, 0x15, 0xAB, 0xBB, 0x28, 0x06,
+    0x7D, 0xAE, 0x46, 0xDD, 0xA4, 0x8E, 0x41, 0x0C, 0xE1, 0xF9, 0x8A, 0x28, 0x03, 0xA7, 0x3F, 0x10,
+    0x35, 0x00, 0xAE, 0x2D, 0xE0, 0xB4, 0x84, 0xBA, 0x4D, 0x67, 0x77, 0x32, 0xEF, 0x2D, 0x34, 0x5A,
+    0x8C, 0xEA, 0xCC, 0x64, 0x32, 0xBB, 0x65, 0x88, 0x50, 0x9B, 0x88, 0x2E, 0x57, 0x01, 0x89, 0x21,
+    0x48, 0xA9, 0xA4, 0xF8, 0xB6, 0xE2, 0xDF, 0x04, 0xDA, 0xC1, 0x74, 0xC1, 0x84, 0xB2, 0x35, 0xC3,
+    0xCA, 0x45, 0xCC, 0x31, 0x5B, 0xB2, 0x2C, 0x77, 0x31, 0x2C, 0xAA, 0x0A, 0x47, 0x1B, 0x11, 0x8D,
+    0xB9, 0xC6, 0x54, 0x92, 0x84, 0xA9, 0xC3, 0xA2, 0x80, 0x3A, 0x3D, 0x1F, 0xC7, 0xBA, 0x9D, 0xAB,
+    0x23, 0x44, 0x96, 0x32, 0x6C, 0x8F, 0xFB, 0x3A, 0xD9, 0x5A, 0x25, 0x06, 0x1B, 0x62, 0x24, 0xFF,
+    0x00, 0x51, 0x71, 0x08, 0x46, 0x52, 0x4C, 0x8C, 0x4B, 0x2C, 0x8A, 0xC4, 0xF2, 0xC4, 0xD5, 0x5B,
+    0x8F, 0x16, 0xEA, 0x72, 0x07, 0x12, 0x5E, 0xDD, 0x98, 0xD8, 0xBC, 0xB1, 0x5B, 0x19, 0xA5, 0x2B,
+    0x67, 0x25, 0xCB, 0x1D, 0xC6, 0xDD, 0x5A, 0x43, 0xCC, 0xA8, 0xCE, 0xA7, 0x71, 0x6C, 0x86, 0x39,
+    0xC9, 0x39, 0xAC, 0x6A, 0x28, 0x03, 0xA7, 0xD5, 0xBE, 0x20, 0x6A, 0x17, 0x2D, 0x99, 0x20, 0xB4,
+    0x89, 0x49, 0x49, 0x2F, 0xA1, 0x8F, 0x7E, 0x75, 0x06, 0x82, 0x02, 0x9F, 0xE9, 0x97, 0x4C, 0xE5,
+    0xC8, 0x7B, 0x76, 0x28, 0x47, 0x9A, 0x01, 0x04, 0x9F, 0xBC, 0x49, 0x25, 0xEF, 0x8F, 0x27, 0x9E,
+    0x47, 0x7B, 0xBD, 0x1F, 0x46, 0x99, 0xD8, 0x6C, 0xB6, 0x12, 0x23, 0x11, 0xA7, 0x33, 0x4E, 0xD2,
+    0x13, 0x68, 0x8C, 0xE7, 0x99, 0x6E, 0x18, 0xB1, 0xDD, 0xBC, 0x7F, 0x0E, 0x36, 0x12, 0xA7, 0x98,
+    0xA2, 0x80, 0x3A, 0x77, 0xF8, 0x8D, 0xAD, 0xB2, 0xBA, 0xBD, 0xC4, 0x7B, 0x24, 0x46, 0xB5, 0xD4,
+    0xC2, 0x8C, 0x1B, 0xD1, 0x2C, 0xF3, 0x3E, 0x64, 0x74, 0x20, 0x82, 0xB2, 0xCE, 0xC7, 0x0A, 0x55,
+    0x48, 0xC0, 0x60, 0x46, 0x41, 0xE6, 0x28, 0xA2, 0x80, 0x35, 0x7C, 0x3F, 0xE2, 0x07, 0xB2, 0x32,
+    0x62, 0xC2, 0xC6, 0xED, 0x24, 0x8C, 0xE9, 0xF7, 0x56, 0xD7, 0x4A, 0xC5, 0x5A, 0x17, 0x75, 0x39,
+    0x5D, 0x8C, 0xA4, 0x15, 0x64, 0x04, 0x1C, 0xE4, 0x75, 0x1C, 0xE0, 0xD5, 0x1B, 0xFB, 0xE9, 0xA7,
+    0x76, 0x7B, 0xB9, 0x37, 0xCA, 0xEC, 0xD7, 0x37, 0x32, 0x60, 0x0F, 0x32, 0x69, 0x58, 0x92, 0x76,
+    0x8C, 0x75, 0x63, 0xD8, 0x62, 0xA0, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80,
+    0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80,
+    0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80,
+    0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x31, 0x68, 0xA2, 0x8A,
+    0x82, 0x82, 0x8A, 0x28, 0xA0, 0x0F, 0x73, 0xF8, 0xF1, 0xFF, 0x00, 0x2E, 0xFF, 0x00, 0xF6, 0xD7,
+    0xFF, 0x00, 0x69, 0x57, 0x93, 0x56, 0x2D, 0x15, 0xC5, 0x96, 0x61, 0xF9, 0x22, 0xA3, 0xED, 0x39,
+    0xAD, 0x7D, 0x76, 0xBD, 0xDB, 0x7B, 0x6B, 0xDC, 0xE8, 0xC6, 0x55, 0xE6, 0x6D, 0xF2, 0xDA, 0xFD,
+    0x3E, 0x56, 0x36, 0xA8, 0xAC, 0x5A, 0x2B, 0xBE, 0xE7, 0x35, 0x8D, 0xAA, 0x2B, 0x16, 0x8A, 0x2E,
+    0x16, 0x36, 0xA8, 0xAC, 0x5A, 0x28, 0xB8, 0x58, 0xDA, 0xA2, 0xB1, 0x68, 0xA2, 0xE1, 0x63, 0x6A,
+    0x8A, 0xC5, 0xA2, 0x8B, 0x85, 0x8D, 0xAA, 0x2B, 0x16, 0x8A, 0x2E, 0x16, 0x36, 0xA8, 0xAC, 0x5A,
+    0x28, 0xB8, 0x58, 0xDA, 0xA2, 0xB1, 0x68, 0xA2, 0xE1, 0x63, 0x6A, 0x8A, 0xC5, 0xA2, 0x8B, 0x85,
+    0x8D, 0xAA, 0x2B, 0x16, 0x8A, 0x2E, 0x16, 0x36, 0xA8, 0xAC, 0x5A, 0x28, 0xB8, 0x58, 0xDA, 0xA2,
+    0xB1, 0x68, 0xA2, 0xE1, 0x63, 0x6A, 0x8A, 0xC5, 0xA2, 0x8B, 0x85, 0x8D, 0xAA, 0x2B, 0x16, 0x8A,
+    0x2E, 0x16, 0x36, 0xA8, 0xAC, 0x5A, 0x28, 0xB8, 0x58, 0xDA, 0xA2, 0xB1, 0x68, 0xA2, 0xE1, 0x63,
+    0x6A, 0x8A, 0xC5, 0xA2, 0x8B, 0x85, 0x8D, 0xAA, 0x2B, 0x16, 0x8A, 0x2E, 0x16, 0x36, 0xA8, 0xAC,
+    0x5A, 0x28, 0xB8, 0x58, 0xDA, 0xA2, 0xB1, 0x68, 0xA2, 0xE1, 0x63, 0x6A, 0x8A, 0xC5, 0xA2, 0x8B,
+    0x85, 0x8D, 0xAA, 0x2B, 0x16, 0x8A, 0x2E, 0x16, 0x36, 0xA8, 0xAC, 0x5A, 0x28, 0xB8, 0x58, 0xDA,
+    0xA2, 0xB1, 0x68, 0xA2, 0xE1, 0x63, 0x6A, 0x8A, 0xC5, 0xA2, 0x8B, 0x85, 0x8D, 0xAA, 0x2B, 0x16,
+    0x8A, 0x2E, 0x16, 0x36, 0xA8, 0xAC, 0x5A, 0x28, 0xB8, 0x58, 0x28, 0xA2, 0x8A, 0x91, 0x85, 0x14,
+    0x51, 0x40, 0x05, 0x15, 0xEB, 0x3F, 0x15, 0x7F, 0xE5, 0x8F, 0xFD, 0xB4, 0xFF, 0x00, 0xD9, 0x2B,
+    0x80, 0xA2, 0x27, 0x0E, 0x5D, 0x89, 0xE7, 0x8A, 0x97, 0xB3, 0xB5, 0xEF, 0xA5, 0xEF, 0x6B, 0x36,
+    0xBC, 0xBB, 0x18, 0xB4, 0x56, 0xD5, 0x15, 0x56, 0x3B, 0x6E, 0x62, 0xD1, 0x5B, 0x54, 0x51, 0x60,
+    0xB9, 0x8B, 0x45, 0x6D, 0x51, 0x45, 0x82, 0xE6, 0x2D, 0x15, 0xB5, 0x45, 0x16, 0x0B, 0x98, 0xB4,
+    0x56, 0xD5, 0x14, 0x58, 0x2E, 0x62, 0xD1, 0x5B, 0x54, 0x51, 0x60, 0xB9, 0x8B, 0x45, 0x6D, 0x51,
+    0x45, 0x82, 0xE6, 0x2D, 0x15, 0xB5, 0x45, 0x16, 0x0B, 0x98, 0xB4, 0x56, 0xD5, 0x14, 0x58, 0x2E,
+    0x62, 0xD1, 0x5B, 0x54, 0x51, 0x60, 0xB9, 0x8B, 0x45, 0x6D, 0x51, 0x45, 0x82, 0xE6, 0x2D, 0x15,
+    0xB5, 0x45, 0x16, 0x0B, 0x98, 0xB4, 0x56, 0xD5, 0x14, 0x58, 0x2E, 0x62, 0xD1, 0x5B, 0x54, 0x51,
+    0x60, 0xB9, 0x8B, 0x45, 0x6D, 0x51, 0x45, 0x82, 0xE6, 0x2D, 0x15, 0xB5, 0x45, 0x16, 0x0B, 0x98,
+    0xB4, 0x56, 0xD5, 0x14, 0x58, 0x2E, 0x62, 0xD1, 0x5B, 0x54, 0x51, 0x60, 0xB9, 0x8B, 0x45, 0x6D,
+    0x51, 0x45, 0x82, 0xE6, 0x2D, 0x15, 0xB5, 0x45, 0x16, 0x0B, 0x98, 0xB4, 0x56, 0xD5, 0x14, 0x58,
+    0x2E, 0x62, 0xD1, 0x5B, 0x54, 0x51, 0x60, 0xB9, 0x8B, 0x45, 0x6D, 0x51, 0x45, 0x82, 0xE6, 0x2D,
+    0x15, 0xB5, 0x45, 0x16, 0x0B, 0x98, 0xB4, 0x56, 0xD5, 0x14, 0x58, 0x2E, 0x62, 0xD1, 0x5B, 0x54,
+    0x51, 0x60, 0xB9, 0x8B, 0x45, 0x6D, 0x51, 0x45, 0x82, 0xE6, 0x2D, 0x14, 0x51, 0x52, 0x30, 0xA2,
+    0x8A, 0x28, 0x03, 0xD6, 0x7E, 0x2A, 0xFF, 0x00, 0xCB, 0x1F, 0xFB, 0x69, 0xFF, 0x00, 0xB2, 0x57,
+    0x01, 0x5D, 0xFF, 0x00, 0xC5, 0x5F, 0xF9, 0x63, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0x4A, 0xE0, 0x28,
+    0xA7, 0xB1, 0xE1, 0xF0, 0xF7, 0xF0, 0xE3, 0xF3, 0xFF, 0x00, 0xD2, 0x98, 0x51, 0x45, 0x15, 0x67,
+    0xB4, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45,
+    0x00, 0x14, 0x57, 0xB1, 0xF8, 0xB7, 0xC6, 0x7A, 0x35, 0xEB, 0xA4, 0x76, 0xB2, 0x69, 0x5A, 0x64,
+    0xEB, 0x3C, 0xB3, 0x5E, 0x5F, 0x5A, 0x46, 0x24, 0x4B, 0xA3, 0x25, 0xB0, 0x04, 0x9B, 0xA9, 0x44,
+    0x20, 0x8B, 0xF9, 0x4F, 0x96, 0xC1, 0x94, 0xA3, 0x01, 0xB9, 0xD8, 0x20, 0x1B, 0xA8, 0xE8, 0xBA,
+    0x8E, 0x8D, 0x67, 0x2C, 0x83, 0x48, 0x96, 0x08, 0xED, 0xA6, 0x80, 0x8D, 0x67, 0x4A, 0xBB, 0xBA,
+    0x05, 0x3C, 0xE3, 0x71, 0x22, 0x18, 0x2D, 0x67, 0x84, 0x8E, 0x64, 0x6D, 0xBB, 0x24, 0x69, 0x30,
+    0x91, 0x96, 0x91, 0xB2, 0x0F, 0x00, 0xCF, 0x2A, 0xA2, 0xBD, 0x56, 0xF3, 0x54, 0x89, 0x2D, 0x65,
+    0x82, 0xE3, 0x5D, 0xD0, 0xE4, 0xB6, 0x0B, 0x71, 0xA9, 0x69, 0xF7, 0x51, 0xC6, 0x8C, 0xD3, 0x6A,
+    0x71, 0xDE, 0xB2, 0x04, 0x86, 0xD0, 0xBB, 0x84, 0x17, 0x50, 0xB6, 0xF5, 0x31, 0xC7, 0x16, 0xDC,
+    0xEE, 0x52, 0x40, 0x72, 0x71, 0xBC, 0x6F, 0xA9, 0xD8, 0xBC, 0x25, 0x63, 0xD5, 0x64, 0xB9, 0x9F,
+    0x7C, 0x2D, 0x14, 0x89, 0x8D, 0x9A, 0xA5, 0x84, 0x50, 0xCD, 0xFB, 0xD9, 0xE3, 0xDF, 0x29, 0x59,
+    0x5A, 0x77, 0x72, 0xC0, 0xBC, 0x64, 0xEE, 0xDC, 0xC9, 0xBC, 0xB6, 0x00, 0x38, 0x3A, 0x2B, 0xBF,
+    0xF8, 0x51, 0x06, 0x9B, 0x27, 0x9E, 0xBA, 0xD7, 0x88, 0xE0, 0xD3, 0xE0, 0x91, 0x56, 0xC2, 0x4B,
+    0x39, 0xB6, 0xED, 0xBF, 0xF3, 0x37, 0x9D, 0xCC, 0x64, 0x38, 0x06, 0xD1, 0x50, 0x95, 0x6C, 0x7C,
+    0xAE, 0x57, 0x93, 0xF7, 0x1E, 0xFD, 0xDE, 0xB1, 0xA3, 0x3C, 0x33, 0x8D, 0x46, 0x4F, 0x39, 0xD2,
+    0x4B, 0xBB, 0xDF, 0x0F, 0xDB, 0x4D, 0x30, 0x91, 0x85, 0xB6, 0xA6, 0x0A, 0x2F, 0x95, 0x28, 0x92,
+    0x40, 0x4D, 0xBD, 0xC0, 0xDE, 0xC0, 0x90, 0xC7, 0x22, 0x58, 0xDC, 0x80, 0x43, 0x80, 0x79, 0x8D,
+    0x15, 0xE8, 0x77, 0xDA, 0x96, 0x91, 0x04, 0xA9, 0x24, 0x57, 0x71, 0xC9, 0x3E, 0x1E, 0xE2, 0x49,
+    0xF2, 0xA5, 0xF5, 0x7B, 0x0B, 0xFB, 0x79, 0x40, 0x5D, 0x44, 0xEC, 0x99, 0x04, 0xB0, 0x28, 0x54,
+    0x7D, 0xD0, 0x29, 0x76, 0x73, 0xB8, 0x60, 0x79, 0xAD, 0xD0, 0x58, 0x78, 0xE6, 0x68, 0xEE, 0x25,
+    0xFE, 0xC6, 0xD5, 0x34, 0xAB, 0x48, 0xC2, 0xC1, 0xA7, 0xDE, 0xEF, 0x90, 0x6C, 0x96, 0xE5, 0x27,
+    0x64, 0x23, 0x45, 0x92, 0x69, 0x24, 0xC4, 0x51, 0x79, 0xAF, 0x2A, 0x95, 0x87, 0x6A, 0x2A, 0xA8,
+    0x68, 0xF1, 0x9D, 0xE0, 0x1E, 0x39, 0x45, 0x7B, 0xC2, 0xF8, 0x9B, 0x4C, 0x5D, 0x3A, 0x45, 0xB7,
+    0xF1, 0x3D, 0x8B, 0xE6, 0x3B, 0xCB, 0x5B, 0x11, 0x73, 0x23, 0x34, 0xDA, 0x83, 0x5C, 0xDC, 0xCC,
+    0xD9, 0xBC, 0xB7, 0xDC, 0x98, 0x33, 0x40, 0x83, 0x0C, 0xCA, 0x49, 0x66, 0xE0, 0x0F, 0xBB, 0x26,
+    0x1D, 0xE7, 0x8D, 0xF4, 0x6B, 0xB9, 0xA1, 0xDA, 0x9E, 0x67, 0x95, 0x3C, 0x96, 0x6D, 0x77, 0x76,
+    0xE1, 0x53, 0x54, 0xB2, 0xBE, 0x32, 0x7C, 0xD7, 0x11, 0x44, 0xD0, 0x85, 0x17, 0x2E, 0x4F, 0x98,
+    0x7E, 0xCA, 0xFF, 0x00, 0x2E, 0x3C, 0xC2, 0xDF, 0x71, 0xC0, 0x3C, 0x8E, 0x8A, 0xF7, 0x4B, 0x0F,
+    0x18, 0xE8, 0x97, 0x73, 0xCB, 0xE6, 0x6A, 0xD6, 0x89, 0x6C, 0xEF, 0x15, 0xB2, 0x40, 0xCD, 0xE5,
+    0x15, 0x8E, 0x2D, 0x46, 0xEA, 0x4F, 0x30, 0x4A, 0x3C, 0xA3, 0xBA, 0x3C, 0x07, 0x04, 0x3C, 0x78,
+    0x0F, 0x87, 0xF3, 0x65, 0x00, 0x3F, 0x33, 0x79, 0xE3, 0x7B, 0xA4, 0xB6, 0x96, 0x31, 0x71, 0xA1,
+    0xDB, 0x41, 0xFE, 0x91, 0x6D, 0x61, 0xF6, 0x45, 0x43, 0x29, 0x86, 0xF6, 0xE5, 0x89, 0x4F, 0x24,
+    0x34, 0x8A, 0x23, 0xB9, 0x3B, 0xBE, 0xEC, 0x80, 0xA8, 0x55, 0x6D, 0xC7, 0xF7, 0x62, 0x50, 0x0F,
+    0x31, 0xA2, 0xBD, 0x57, 0x55, 0xD5, 0x6C, 0xA3, 0xD8, 0xD7, 0xDE, 0x20, 0xB1, 0x69, 0x7E, 0xD3,
+    0x3C, 0x9A, 0xBD, 0x95, 0x9B, 0x97, 0x5B, 0xFB, 0x39, 0x2D, 0xF0, 0x24, 0x91, 0x22, 0x0B, 0x19,
+    0x91, 0xA3, 0x3B, 0x47, 0xEE, 0x55, 0x24, 0xDD, 0x89, 0x87, 0x12, 0x81, 0x3E, 0x97, 0xE3, 0x9D,
+    0x00, 0xCA, 0x4D, 0xBC, 0xB3, 0xDB, 0xC0, 0x56, 0x1B, 0x6B, 0xDD, 0x39, 0xD0, 0x2A, 0x6A, 0x9F,
+    0xE9, 0x12, 0x96, 0x8E, 0xDE, 0xC9, 0x25, 0x11, 0xA4, 0x7F, 0xBC, 0x53, 0x96, 0x98, 0x60, 0x02,
+    0x1C, 0x49, 0xBE, 0x42, 0xC0, 0x1E, 0x47, 0x45, 0x7A, 0xE4, 0xFE, 0x23, 0xB2, 0x4B, 0x29, 0xD1,
+    0xB5, 0xC8, 0x0B, 0x85, 0x9E, 0x4D, 0x2A, 0x29, 0x24, 0x33, 0x4F, 0x3C, 0xB7, 0x97, 0xEC, 0x8C,
+    0xD7, 0x0E, 0x5F, 0xCB, 0x06, 0x5B, 0x7E, 0x3E, 0x42, 0xEF, 0xB5, 0x9A, 0x44, 0x38, 0x62, 0x1A,
+    0x8F, 0xC5, 0x1D, 0x7F, 0x42, 0x9A, 0x2D, 0x96, 0x10, 0xD8, 0xBD, 0xCF, 0x9A, 0x25, 0x8A, 0xEE,
+    0xDD, 0xCC, 0x98, 0xB2, 0x8E, 0xDF, 0x0C, 0x24, 0xBD, 0x90, 0xE4, 0xF9, 0xB7, 0xA6, 0x43, 0xF7,
+    0x57, 0x7E, 0x3C, 0xC6, 0x19, 0x60, 0xCE, 0x01, 0xE6, 0x34, 0x57, 0x79, 0xF0, 0xAB, 0x5A, 0xB1,
+    0x81, 0xA6, 0x4D, 0x57, 0xEC, 0x8F, 0x04, 0xA8, 0x2D, 0xDE, 0xDE, 0x56, 0x00, 0xB4, 0x88, 0x49,
+    0x0D, 0x02, 0x5C, 0x7E, 0xE8, 0x98, 0x18, 0x67, 0xF7, 0xA5, 0x7F, 0xD8, 0x24, 0xE5, 0x5B, 0xA0,
+    0x87, 0x59, 0xD1, 0xA4, 0xB1, 0x90, 0xCB, 0xAA, 0x58, 0x81, 0xFE, 0x96, 0x2D, 0xB4, 0xE4, 0x50,
+    0x92, 0x69, 0x97, 0x37, 0x5B, 0xB6, 0x0B, 0x38, 0x19, 0xD9, 0x84, 0x77, 0x21, 0x80, 0x71, 0x1B,
+    0xED, 0xFB, 0xAA, 0x41, 0x51, 0x33, 0x30, 0x07, 0x91, 0xD1, 0x5B, 0x9E, 0x0A, 0xBB, 0x48, 0x6E,
+    0x55, 0xA5, 0xBA, 0x82, 0x04, 0x55, 0x92, 0x59, 0xDA, 0x58, 0xD5, 0xD6, 0x78, 0x56, 0xD9, 0xF3,
+    0x1B, 0xDB, 0xBB, 0x28, 0x3F, 0x6B, 0x5C, 0xA6, 0x37, 0xA9, 0x39, 0xE0, 0xE6, 0xAD, 0xF8, 0xFE,
+    0xE6, 0xC6, 0x59, 0x51, 0xB4, 0xEB, 0xA8, 0xE7, 0x53, 0x1A, 0xB5, 0xC4, 0x91, 0x80, 0x12, 0x3B,
+    0x9D, 0xEF, 0x95, 0xB3, 0x8F, 0x6A, 0xB0, 0x4B, 0x7F, 0xBA, 0x82, 0x45, 0x0E, 0x14, 0x00, 0x3E,
+    0x4D, 0xB4, 0x08, 0xE6, 0x28, 0xAF, 0x46, 0xD3, 0x3C, 0x79, 0x6C, 0x9A, 0x68, 0x86, 0xE4, 0x79,
+    0x8A, 0xAB, 0x3D, 0x84, 0xF6, 0xFC, 0x02, 0xF2, 0xDF, 0xAB, 0xB4, 0x6C, 0x90, 0xB3, 0x30, 0x61,
+    0x6B, 0x3A, 0xE5, 0x9B, 0x6C, 0x6E, 0x84, 0xAE, 0xC2, 0x46, 0xE0, 0xF7, 0xE7, 0xF8, 0x91, 0xA6,
+    0xDD, 0xEC, 0x37, 0xB0, 0xDF, 0x41, 0x12, 0x4B, 0x25, 0xED, 0xDC, 0x6B, 0x2A, 0x85, 0xB8, 0x1A,
+    0x95, 0xBC, 0xD9, 0x09, 0x62, 0x14, 0xE4, 0xDB, 0x30, 0x0A, 0x3E, 0x43, 0x1C, 0x99, 0x63, 0x71,
+    0xB7, 0xCC, 0x6C, 0x83, 0x3C, 0xAA, 0x8A, 0xF6, 0xD8, 0xBC, 0x5B, 0xA4, 0xC9, 0x73, 0x72, 0x6C,
+    0x63, 0xB4, 0xB1, 0x99, 0xE3, 0x86, 0xFB, 0x51, 0xD3, 0xA5, 0xB8, 0x80, 0x41, 0xAB, 0x6A, 0x30,
+    0x4A, 0xC5, 0x84, 0x5A, 0x9A, 0x33, 0x61, 0xC2, 0x3A, 0x98, 0xD9, 0x1A, 0x33, 0xBC, 0x16, 0x90,
+    0x02, 0x0D, 0x33, 0x58, 0xF1, 0xBE, 0x8C, 0x2C, 0xEE, 0x61, 0x44, 0xB1, 0x99, 0xD7, 0xCF, 0x5D,
+    0x3A, 0xF2, 0x67, 0x12, 0x35, 0xDD, 0xB5, 0xEE, 0xA5, 0x37, 0x36, 0x6D, 0xB8, 0x92, 0x51, 0x84,
+    0x2D, 0xF3, 0x48, 0xAC, 0x7F, 0xD6, 0x00, 0xC1, 0x06, 0xE0, 0x0F, 0x15, 0xA2, 0xBD, 0x3B, 0x50,
+    0xF1, 0x36, 0x9F, 0xF2, 0xCB, 0x34, 0xF6, 0x37, 0x77, 0x1E, 0x64, 0xDA, 0x83, 0x5B, 0xC7, 0xF2,
+    0x41, 0x39, 0xBD, 0xB7, 0x91, 0x48, 0xBA, 0xB5, 0x5C, 0xC8, 0x4C, 0xD3, 0x42, 0xA3, 0x04, 0x04,
+    0x78, 0xF6, 0x99, 0xB6, 0xB4, 0x8E, 0x4D, 0xA6, 0xF1, 0x06, 0x85, 0x35, 0xD5, 0xC1, 0xD3, 0xAF,
+    0xE3, 0xB2, 0xD2, 0x1D, 0x17, 0x49, 0xBC, 0xD3, 0xE2, 0x2B, 0x01, 0x9E, 0x26, 0xDD, 0x99, 0x2D,
+    0xA2, 0x8D, 0x1B, 0x78, 0xB7, 0x45, 0x67, 0xF9, 0xBC, 0xB7, 0x6C, 0x88, 0xF9, 0x07, 0x63, 0x00,
+    0x79, 0x3D, 0x15, 0xE9, 0xCD, 0xE3, 0x0D, 0x32, 0x3B, 0x36, 0x82, 0x5D, 0x3E, 0xC4, 0xAE, 0xEB,
+    0xBB, 0x7B, 0x0B, 0x99, 0x26, 0x69, 0x05, 0x9C, 0xD8, 0xCA, 0xB4, 0x3A, 0x68, 0x67, 0x0B, 0xE6,
+    0x86, 0x08, 0x8C, 0x27, 0x70, 0xA7, 0x73, 0x64, 0x8D, 0xDB, 0xAD, 0x6A, 0x1E, 0x2B, 0x79, 0x9A,
+    0xDD, 0x22, 0xBE, 0xD1, 0xAD, 0xEE, 0x04, 0x92, 0x59, 0xEA, 0x4B, 0x13, 0x44, 0x60, 0xBD, 0xB0,
+    0x8C, 0xCC, 0xA6, 0x59, 0xF5, 0x1B, 0x95, 0x72, 0x0D, 0xC2, 0xCB, 0x30, 0xC3, 0xF9, 0xA5, 0xF3,
+    0xE6, 0x6D, 0xCB, 0x00, 0xE0, 0x1E, 0x4F, 0x45, 0x7B, 0x55, 0xD3, 0xE9, 0x8B, 0x2C, 0xAB, 0xA8,
+    0x78, 0x96, 0xC7, 0x52, 0x85, 0xE3, 0x82, 0x09, 0x63, 0x7B, 0xB6, 0x68, 0xAE, 0xD5, 0xF5, 0x07,
+    0xC2, 0xC9, 0x33, 0x5C, 0x6E, 0x53, 0x01, 0xDA, 0xC0, 0x81, 0x20, 0x89, 0x37, 0x07, 0x12, 0x31,
+    0xDC, 0xFE, 0x4F, 0xE2, 0x5B, 0x98, 0xA5, 0xB9, 0x99, 0xAD, 0xEE, 0xA4, 0xB8, 0x8D, 0xA4, 0x92,
+    0x68, 0x6E, 0x9C, 0x60, 0xDC, 0xC6, 0xF2, 0x92, 0x1A, 0x44, 0x0A, 0xB8, 0x32, 0x0E, 0x7E, 0xEA,
+    0xFD, 0x05, 0x00, 0x66, 0xD1, 0x5E, 0x95, 0x77, 0xAD, 0x58, 0x2F, 0x97, 0x3C, 0xD7, 0x76, 0x8C,
+    0xEA, 0x64, 0x82, 0x6B, 0x6B, 0x54, 0x80, 0x4B, 0x7D, 0x1E, 0xA3, 0x0C, 0xF8, 0xFB, 0x7A, 0xCB,
+    0xE7, 0x12, 0x56, 0x3F, 0x2C, 0x3B, 0x39, 0x9B, 0x87, 0xDB, 0xFE, 0xB5, 0x5C, 0xBE, 0xE7, 0x85,
+    0x7C, 0x79, 0x6F, 0x6D, 0xE6, 0x80, 0xB6, 0x90, 0x4D, 0xE5, 0xDB, 0x2D, 0x8D, 0xA3, 0xDD, 0xB1,
+    0x8D, 0x9F, 0x4D, 0xBD, 0x75, 0x68, 0xE0, 0xBE, 0xF3, 0xE4, 0x20, 0x4F, 0xBB, 0x2A, 0x38, 0x8C,
+    0x2F, 0x2E, 0x0C, 0x60, 0xBB, 0x80, 0x78, 0xCD, 0x15, 0xEB, 0x1A, 0x87, 0xC4, 0x11, 0x34, 0x57,
+    0x09, 0x6D, 0xAC, 0x48, 0xD6, 0xA6, 0x4B, 0xA9, 0xAD, 0xE3, 0x5D, 0x91, 0xB9, 0x4B, 0xE4, 0xB9,
+    0x2A, 0x14, 0xCA, 0xC7, 0x7C, 0x52, 0x0C, 0x96, 0x06, 0x38, 0xE4, 0x56, 0x65, 0xD8, 0x49, 0xDA,
+    0x28, 0xBA, 0xF1, 0xC6, 0x8E, 0xF2, 0x42, 0xDA, 0x94, 0xB1, 0xC8, 0x30, 0xDA, 0xA0, 0x78, 0x83,
+    0x32, 0xFE, 0xFE, 0xD2, 0x60, 0xD1, 0xEA, 0x56, 0x59, 0x4C, 0x3B, 0xDD, 0x81, 0xBC, 0x21, 0x8A,
+    0x29, 0xC3, 0x6E, 0x91, 0x40, 0xC6, 0x00, 0x3C, 0x9E, 0x8A, 0xFA, 0x0B, 0x44, 0xF1, 0xA6, 0x84,
+    0xD7, 0x12, 0x1B, 0x4D, 0x53, 0x4D, 0xB6, 0xB0, 0x22, 0xD9, 0x10, 0xEA, 0x3B, 0x59, 0xA7, 0x7B,
+    0x7B, 0xD9, 0xF9, 0xB3, 0x84, 0x30, 0x6C, 0xCB, 0x2B, 0x79, 0x85, 0xE5, 0x62, 0xEA, 0x4E, 0xF7,
+    0x52, 0xA4, 0x15, 0xE1, 0xF5, 0x0F, 0x1E, 0x5A, 0x25, 0xBC, 0x91, 0x69, 0xF7, 0xD1, 0xEC, 0x06,
+    0xE3, 0x4E, 0xD2, 0xE7, 0x8A, 0x2D, 0xB2, 0x1D, 0x3E, 0xFE, 0x67, 0x62, 0x27, 0xB7, 0x29, 0xB0,
+    0xA5, 0xD8, 0x11, 0x8C, 0xAF, 0x91, 0x24, 0x67, 0xEE, 0xA1, 0x03, 0x0C, 0x01, 0xE6, 0xB4, 0x57,
+    0xB5, 0x6A, 0xFE, 0x2F, 0xD0, 0x64, 0x30, 0x2C, 0xD7, 0x19, 0x97, 0xCD, 0x96, 0xE7, 0xC4, 0x0D,
+    0x6C, 0xD1, 0x2C, 0x38, 0x68, 0xA6, 0x59, 0x26, 0x88, 0x46, 0x0E, 0xFF, 0x00, 0x31, 0x9B, 0xE4,
+    0x59, 0x11, 0xDE, 0x44, 0x50, 0xAC, 0xBF, 0xBC, 0x3E, 0x67, 0x9F, 0xFC, 0x43, 0xD4, 0x74, 0x9B,
+    0x89, 0x22, 0x3E, 0x1F, 0xB5, 0xFB, 0x3D, 0xB0, 0x89, 0x61, 0x86, 0xDB, 0x7E, 0xEF, 0x2B, 0x64,
+    0xB2, 0x75, 0x42, 0x4E, 0xD2, 0x57, 0x1B, 0x86, 0x06, 0x5B, 0x2C, 0x0B, 0x82, 0x1D, 0x80, 0x39,
+    0x5A, 0x28, 0xA2, 0x81, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x18, 0xB4, 0x51, 0x45,
+    0x41, 0x41, 0x45, 0x14, 0x50, 0x07, 0xAC, 0xFC, 0x55, 0xFF, 0x00, 0x96, 0x3F, 0xF6, 0xD3, 0xFF,
+    0x00, 0x64, 0xAE, 0x02, 0xBB, 0xFF, 0x00, 0x8A, 0xBF, 0xF2, 0xC7, 0xFE, 0xDA, 0x7F, 0xEC, 0x95,
+    0xC0, 0x51, 0x4F, 0x63, 0xC3, 0xE1, 0xEF, 0xE1, 0xC7, 0xE7, 0xFF, 0x00, 0xA5, 0x30, 0xA2, 0x8A,
+    0xBD, 0xA1, 0xE8, 0xD7, 0x37, 0xB3, 0x24, 0x76, 0x29, 0xBA, 0x57, 0x61, 0x04, 0x5C, 0x1C, 0x26,
+    0xE3, 0xC9, 0x93, 0x68, 0x3C, 0x46, 0x32, 0x49, 0xC1, 0xC0, 0xE6, 0xB4, 0x3D, 0xA0, 0xD1, 0xB4,
+    0x3D, 0x42, 0xF5, 0xC2, 0x69, 0x56, 0x33, 0xDC, 0xCA, 0x79, 0xF2, 0xE3, 0x19, 0xD8, 0xA5, 0x80,
+    0xCC, 0xAD, 0xD8, 0x02, 0x46, 0x49, 0x20, 0x0E, 0xE6, 0xBD, 0x8B, 0xC3, 0x9F, 0xB3, 0x87, 0x53,
+    0xE2, 0x5D, 0x5F, 0xD5, 0x62, 0x82, 0xC7, 0xF0, 0xC1, 0x79, 0xE5, 0x5F, 0xA8, 0xC7, 0x97, 0xE8,
+    0x77, 0x76, 0xAF, 0x4C, 0xF0, 0x37, 0x81, 0xB4, 0xFD, 0x1E, 0x1D, 0x96, 0x23, 0x7C, 0x87, 0x0F,
+    0xA8, 0xDF, 0x30, 0xF9, 0xAF, 0x26, 0x03, 0xF8, 0x87, 0x60, 0x99, 0x38, 0x19, 0xC0, 0xF7, 0x24,
+    0x93, 0xD1, 0xD5, 0x25, 0xDC, 0xB4, 0xBB, 0x9E, 0x59, 0xFF, 0x00, 0x0C, 0xE7, 0xE1, 0xBF, 0xFA,
+    0x08, 0x6B, 0x9F, 0xF7, 0xDC, 0x7F, 0xFC, 0x6A, 0xB2, 0xBC, 0x41, 0xFB, 0x38, 0x5B, 0x15, 0xFF,
+    0x00, 0x8A, 0x77, 0x57, 0x9D, 0x65, 0x1F, 0x7A, 0x2B, 0xDC, 0x15, 0x9B, 0x24, 0x74, 0x96, 0x25,
+    0x18, 0xDA, 0x33, 0xFC, 0x0D, 0x9E, 0x3A, 0x75, 0xAF, 0x68, 0xA2, 0x8B, 0x0E, 0xC7, 0xC7, 0x3E,
+    0x28, 0xF0, 0x96, 0xA9, 0xA6, 0x48, 0x53, 0x56, 0xB3, 0x78, 0xCE, 0x4A, 0x5B, 0xDC, 0x00, 0x76,
+    0x5E, 0x2A, 0x63, 0x9B, 0x59, 0x48, 0xE4, 0x60, 0x8F, 0x71, 0xD1, 0x80, 0x3C, 0x56, 0x35, 0x7D,
+    0x95, 0xE2, 0x6F, 0x0C, 0xE9, 0xFA, 0x94, 0x2D, 0x1E, 0xAB, 0x06, 0xF8, 0xCF, 0xCC, 0x8E, 0x3E,
+    0xF5, 0xB4, 0xC0, 0x70, 0xD6, 0xEF, 0xD8, 0xA6, 0x7E, 0x9D, 0x88, 0x20, 0x91, 0x5F, 0x28, 0xF8,
+    0xD3, 0xC2, 0x77, 0x3A, 0x55, 0xC3, 0xC5, 0x76, 0xDE, 0x66, 0x31, 0x25, 0xB5, 0xC8, 0x52, 0x05,
+    0xD5, 0xBB, 0x8E, 0x19, 0x01, 0xFC, 0x8E, 0x09, 0x00, 0x82, 0x32, 0x71, 0x49, 0xA2, 0x5A, 0x30,
+    0xE8, 0xA2, 0x8A, 0x92, 0x42, 0x8A, 0xEF, 0x3F, 0xE1, 0x58, 0xC4, 0x8D, 0x1F, 0xDB, 0xB5, 0x99,
+    0x2D, 0xE0, 0x70, 0xF7, 0x31, 0xDE, 0x34, 0x39, 0x02, 0xCE, 0xDA, 0x09, 0x5C, 0xBC, 0x68, 0xB2,
+    0x1D, 0xC0, 0x22, 0x01, 0xF2, 0x17, 0x19, 0x24, 0xE7, 0x61, 0x89, 0xA5, 0x80, 0x7C, 0x3D, 0xB4,
+    0x59, 0x9E, 0x3B, 0x8F, 0x12, 0xDA, 0x09, 0x54, 0xDB, 0x25, 0x9F, 0x92, 0x9B, 0x86, 0xA6, 0xBA,
+    0x84, 0x41, 0x98, 0xD8, 0x80, 0xC0, 0x91, 0x6D, 0x1E, 0x48, 0xC0, 0x26, 0x43, 0x85, 0x50, 0x19,
+    0x94, 0x10, 0x67, 0x15, 0x45, 0x75, 0xD1, 0x78, 0x2F, 0x4D, 0x6B, 0x76, 0x98, 0x78, 0xA6, 0xD0,
+    0x46, 0x11, 0xE5, 0x8E, 0xC7, 0xCB, 0x26, 0x65, 0x9E, 0x39, 0x99, 0x50, 0x5E, 0x5B, 0x46, 0xCD,
+    0xB5, 0x6E, 0x00, 0x5F, 0x98, 0xBE, 0x01, 0x60, 0xBC, 0xE4, 0x13, 0x3C, 0xDF, 0x0E, 0x56, 0x23,
+    0x19, 0xBD, 0xD5, 0x24, 0x36, 0xF2, 0xC8, 0x96, 0x5A, 0x6D, 0xD5, 0xA4, 0x26, 0x51, 0x34, 0x53,
+    0x2B, 0xF2, 0x5E, 0x16, 0x2B, 0xBA, 0x29, 0x54, 0x21, 0x45, 0x95, 0xDF, 0x3B, 0x8A, 0x86, 0x01,
+    0x4B, 0x00, 0x71, 0x54, 0x57, 0x7E, 0x3E, 0x13, 0xCC, 0x25, 0x96, 0x39, 0xAE, 0x6F, 0xA2, 0x95,
+    0x55, 0xA4, 0xD3, 0x24, 0x92, 0xDC, 0x08, 0xF5, 0x19, 0xBE, 0xD1, 0x2A, 0x22, 0xBD, 0xC7, 0x9B,
+    0xF2, 0x7D, 0xBD, 0xA3, 0x1B, 0x0B, 0x60, 0x31, 0x24, 0x0C, 0xFC, 0xA5, 0xF2, 0x9B, 0xC0, 0xE8,
+    0xD0, 0x3C, 0xB6, 0xBA, 0xB4, 0x05, 0x52, 0x49, 0x2C, 0xDE, 0x29, 0x76, 0x8D, 0xCB, 0x69, 0x1B,
+    0x31, 0x65, 0x92, 0x37, 0x71, 0x87, 0x06, 0x15, 0x04, 0x31, 0x05, 0xDC, 0x2E, 0x71, 0xB5, 0x98,
+    0x03, 0x95, 0xA2, 0xBB, 0x85, 0xF8, 0x6A, 0x8D, 0x34, 0x2B, 0x16, 0xA7, 0x3B, 0xC1, 0x24, 0xAF,
+    0xA4, 0x49, 0xA9, 0xF9, 0x2A, 0xAB, 0x6B, 0x75, 0x11, 0xE1, 0x64, 0x86, 0x59, 0x55, 0x83, 0xB0,
+    0xEA, 0xAE, 0xB1, 0xB7, 0xFC, 0xF3, 0x12, 0x70, 0x4C, 0xFA, 0x47, 0xC1, 0xBD, 0x5A, 0xE7, 0x22,
+    0x19, 0xE0, 0x32, 0xF9, 0x71, 0x5F, 0xDB, 0x85, 0xFB, 0x8D, 0x15, 0xDD, 0xC3, 0xAF, 0xEF, 0xE7,
+    0x62, 0x3F, 0xD5, 0xAA, 0x33, 0x02, 0x89, 0x2A, 0x32, 0x8C, 0xAB, 0x1C, 0xAE, 0xE0, 0x0E, 0x02,
+    0x8A, 0xEA, 0xAE, 0xFC, 0x09, 0x22, 0x87, 0x7B, 0x5B, 0xBF, 0x3E, 0xD5, 0x3C, 0xED, 0xF7, 0xA4,
+    0x2A, 0x8B, 0x94, 0xB4, 0x94, 0xAA, 0xBD, 0x89, 0x92, 0x40, 0x1D, 0x27, 0x72, 0x83, 0x28, 0xEC,
+    0xCA, 0x4E, 0x0A, 0x9F, 0x93, 0x7C, 0x8D, 0xE0, 0x6B, 0x74, 0x9E, 0x34, 0xB9, 0xD6, 0x24, 0x5B,
+    0x77, 0x92, 0x5D, 0x3A, 0x1D, 0x42, 0x38, 0x19, 0x8F, 0x99, 0x6C, 0xAB, 0x85, 0x7D, 0x3C, 0x36,
+    0xF0, 0xED, 0x23, 0x05, 0x2A, 0xD1, 0xAE, 0x38, 0x2A, 0x58, 0x1C, 0xD0, 0x07, 0x23, 0x45, 0x77,
+    0xFA, 0x67, 0xC2, 0xD4, 0x96, 0x69, 0xA3, 0xBB, 0xD4, 0x6F, 0xAD, 0x1E, 0x3D, 0x8B, 0x6B, 0x1C,
+    0x96, 0xEA, 0x5A, 0xE6, 0x69, 0x8B, 0x80, 0xB7, 0x0C, 0xB3, 0x14, 0x43, 0x2C, 0x8B, 0x84, 0xDF,
+    0x30, 0x12, 0x64, 0x15, 0x38, 0x22, 0xB3, 0x8F, 0x81, 0x22, 0x48, 0x24, 0x7B, 0xBD, 0x4E, 0x44,
+    0xB8, 0x8C, 0xBD, 0xAD, 0xE6, 0x9A, 0x91, 0x67, 0xEC, 0xD7, 0x96, 0xCD, 0x26, 0xE1, 0x35, 0xD3,
+    0xBA, 0x2E, 0xD5, 0xC4, 0x63, 0x2A, 0xD2, 0x1D, 0xCE, 0xAB, 0xB7, 0x25, 0x77, 0x00, 0x72, 0x34,
+    0x57, 0x71, 0x71, 0xF0, 0xDA, 0x18, 0x5D, 0x3E, 0xDD, 0xE2, 0x08, 0x23, 0xB7, 0x6C, 0xB4, 0xB3,
+    0xC7, 0x19, 0x91, 0xE2, 0x84, 0xDB, 0x34, 0x81, 0x92, 0x0B, 0x76, 0x70, 0x42, 0x42, 0x13, 0x7E,
+    0x24, 0xCA, 0x12, 0x0E, 0x0A, 0x14, 0x77, 0xB7, 0x67, 0xF0, 0x86, 0xE1, 0x9D, 0x92, 0xF6, 0xEA,
+    0xEE, 0xCA, 0x75, 0x36, 0xD0, 0xCD, 0x14, 0xF0, 0xAE, 0xD6, 0x93, 0x52, 0x91, 0x81, 0x30, 0xDC,
+    0x24, 0xA4, 0x15, 0x85, 0x54, 0xE0, 0x96, 0x1B, 0xDB, 0xE4, 0x00, 0x39, 0x00, 0x80, 0x79, 0xE5,
+    0x15, 0xD3, 0xCD, 0xE0, 0x69, 0xD6, 0x19, 0x1A, 0x39, 0xE4, 0x9A, 0x78, 0x49, 0xB6, 0xD7, 0x34,
+    0xD8, 0x62, 0x62, 0xDA, 0x5D, 0xCA, 0xCB, 0x20, 0xFF, 0x00, 0x49, 0x94, 0x7C, 0xBB, 0x04, 0x51,
+    0xB3, 0x6E, 0x0C, 0xD8, 0x38, 0x52, 0x31, 0xF3, 0x55, 0x4D, 0x7F, 0xC2, 0x77, 0x36, 0x8A, 0xAE,
+    0xAD, 0xE7, 0xDA, 0x33, 0x34, 0x36, 0x77, 0xC8, 0xA7, 0x6C, 0x9E, 0x59, 0x23, 0xE7, 0x95, 0x72,
+    0xB9, 0x2C, 0xAE, 0x30, 0x24, 0x7F, 0xBA, 0x48, 0x25, 0x0A, 0xB3, 0x02, 0x30, 0xE8, 0xAE, 0x83,
+    0xC2, 0x3E, 0x16, 0x5D, 0x44, 0xCA, 0xB1, 0xDC, 0x5D, 0xAD, 0xC2, 0x46, 0xF7, 0xF6, 0x36, 0xF1,
+    0x40, 0x5C, 0x5E, 0xB4, 0x0A, 0x4E, 0xD7, 0x75, 0x61, 0xB4, 0xB9, 0xC0, 0x07, 0x69, 0x04, 0x9C,
+    0x75, 0xC0, 0x3B, 0x91, 0xFC, 0x25, 0xBF, 0x16, 0xCF, 0x36, 0xA1, 0x75, 0x1D, 0x9C, 0x71, 0x89,
+    0x45, 0xD2, 0xCB, 0xB3, 0x1F, 0x69, 0xB2, 0x77, 0x5D, 0x91, 0xBA, 0xC8, 0x72, 0x67, 0x98, 0x2A,
+    0xAF, 0x03, 0x27, 0x77, 0xA2, 0x79, 0x80, 0xCE, 0x0E, 0x8A, 0xEF, 0xEF, 0x7E, 0x19, 0x59, 0x45,
+    0xE5, 0x14, 0xF1, 0x0C, 0xF7, 0x30, 0x3B, 0x4C, 0x26, 0xD4, 0xAD, 0xED, 0x49, 0x8A, 0xD6, 0xD2,
+    0xCB, 0xCD, 0xCB, 0x7D, 0xA1, 0xA4, 0x50, 0xC7, 0x6C, 0x44, 0xED, 0x5C, 0x9C, 0x02, 0x57, 0x77,
+    0xCB, 0xBE, 0x0B, 0x7F, 0x85, 0xF2, 0x48, 0xF2, 0x47, 0x1E, 0xB3, 0x62, 0xD3, 0xAF, 0x91, 0x1C,
+    0x33, 0x6E, 0x51, 0x0D, 0xE5, 0xC6, 0xA6, 0xD9, 0x55, 0xB5, 0xBA, 0x77, 0x04, 0xE6, 0xDF, 0xE7,
+    0x18, 0x88, 0x93, 0x86, 0x00, 0x7D, 0xD2, 0xC0, 0x1C, 0x3D, 0x15, 0xD1, 0xDD, 0x78, 0x26, 0xE5,
+    0x23, 0x67, 0x4B, 0x98, 0x18, 0x27, 0x98, 0x97, 0xA8, 0xF9, 0x52, 0x92, 0xDA, 0xCD, 0xB4, 0x84,
+    0x0E, 0x07, 0x55, 0x20, 0xE1, 0xC4, 0x6E, 0x09, 0x0A, 0xCA, 0x0B, 0xC5, 0xE6, 0x74, 0xF7, 0xFF,
+    0x00, 0x06, 0xD6, 0xD6, 0x48, 0x57, 0x52, 0xF1, 0x0C, 0x71, 0x09, 0xA6, 0x7D, 0x2E, 0xCA, 0x55,
+    0x84, 0xE4, 0x24, 0x59, 0x0A, 0xD2, 0x40, 0xEC, 0xAD, 0x99, 0xE5, 0xC2, 0xF0, 0xAC, 0x80, 0x10,
+    0xC6, 0x4C, 0x11, 0x90, 0x0F, 0x35, 0xA2, 0xBB, 0xF9, 0xBE, 0x1A, 0x69, 0xEB, 0x26, 0xC5, 0xD7,
+    0xAF, 0xA6, 0x91, 0xA3, 0xFB, 0x7E, 0x91, 0x6F, 0x0D, 0xA6, 0x5F, 0x56, 0x86, 0x39, 0x67, 0x0C,
+    0x6D, 0x17, 0xCE, 0x03, 0x1E, 0x5C, 0x5B, 0xD4, 0xF9, 0x99, 0x75, 0x23, 0x68, 0xCE, 0x01, 0xAA,
+    0x7E, 0x1C, 0xAB, 0x5B, 0xC9, 0x25, 0xB6, 0xA9, 0x23, 0xCC, 0x81, 0xE4, 0xFE, 0xC9, 0x78, 0x4A,
+    0xC8, 0x8B, 0x69, 0x34, 0x81, 0xFE, 0xDA, 0x77, 0x10, 0xA6, 0xDE, 0x05, 0x57, 0x23, 0x73, 0x10,
+    0x58, 0x29, 0xC1, 0x64, 0x2E, 0x01, 0xC5, 0x51, 0x5E, 0x87, 0xA7, 0x7C, 0x23, 0x96, 0x69, 0x20,
+    0x51, 0x7F, 0x76, 0x90, 0xCE, 0x64, 0x8A, 0x2B, 0xD6, 0xB7, 0xC0, 0xB3, 0x9E, 0xD7, 0xCF, 0xDD,
+    0x1D, 0xEC, 0x4D, 0x20, 0x21, 0xE3, 0xF2, 0x97, 0x8E, 0x84, 0x96, 0xDA, 0xC4, 0x2E, 0x5A, 0x07,
+    0xF8, 0x5C, 0xB1, 0xCC, 0x61, 0xBD, 0xD6, 0xE3, 0x5B, 0xE1, 0x1C, 0x7A, 0x8C, 0x3A, 0x5C, 0x11,
+    0x17, 0x79, 0x99, 0xA2, 0x66, 0x92, 0x3F, 0xDD, 0xB6, 0x03, 0xDB, 0x22, 0x92, 0xA0, 0xB6, 0x24,
+    0xCA, 0xE0, 0xAE, 0x78, 0x00, 0xE0, 0xE8, 0xAE, 0xC6, 0x0F, 0x87, 0xBE, 0x65, 0xBB, 0xCD, 0x6B,
+    0x7D, 0x3C, 0xD0, 0x2C, 0x4D, 0xA9, 0x98, 0xD2, 0x1F, 0xDE, 0x26, 0x2F, 0x1D, 0x10, 0x5C, 0x45,
+    0xBF, 0x00, 0x4C, 0xB1, 0xB3, 0x92, 0x1D, 0xF6, 0x00, 0x72, 0x3E, 0xE9, 0x69, 0xE1, 0xF8, 0x67,
+    0xCC, 0x5E, 0x7E, 0xAB, 0x88, 0x25, 0x92, 0xDE, 0xCE, 0xC6, 0xE2, 0x28, 0xF7, 0x14, 0xFE, 0xD5,
+    0x8A, 0x46, 0x51, 0x77, 0x19, 0x75, 0x01, 0xE2, 0x55, 0x42, 0xCA, 0x1D, 0xB0, 0x18, 0x10, 0x4F,
+    0x19, 0x00, 0xE1, 0xE8, 0xAE, 0xD4, 0xFC, 0x38, 0x6F, 0x32, 0x48, 0xD6, 0x7D, 0x49, 0xEF, 0x56,
+    0x37, 0xBF, 0x8B, 0x4C, 0x8E, 0xDC, 0x33, 0x16, 0x86, 0x79, 0x17, 0x6D, 0xD9, 0x59, 0x48, 0x53,
+    0x24, 0x4A, 0x8E, 0x0E, 0x58, 0x10, 0xD8, 0x4D, 0xC4, 0xA6, 0xFA, 0x37, 0x5E, 0x07, 0xB8, 0x0B,
+    0x27, 0xD8, 0x85, 0xDC, 0xD2, 0x44, 0xF2, 0xDB, 0xDF, 0xC0, 0xF1, 0xAA, 0xFD, 0x9A, 0x3B, 0x00,
+    0xE5, 0xDA, 0x49, 0x04, 0x8C, 0x08, 0x8D, 0x36, 0x7D, 0xD2, 0xD8, 0x63, 0xB4, 0x91, 0x98, 0xCC,
+    0x80, 0x1C, 0xC5, 0x15, 0xDC, 0x78, 0xF7, 0xE1, 0x83, 0xE9, 0x31, 0x23, 0x8D, 0x62, 0x0B, 0xD5,
+    0x69, 0x24, 0xB2, 0x7F, 0x29, 0x1B, 0x11, 0x34, 0x0E, 0xC0, 0x6E, 0x98, 0x64, 0x64, 0x85, 0x39,
+    0x04, 0x82, 0x0E, 0x42, 0xEE, 0x00, 0x91, 0xC3, 0xD0, 0x20, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A,
+    0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A,
+    0x28, 0x03, 0x16, 0x8A, 0x28, 0xA8, 0x28, 0x28, 0xA2, 0x8A, 0x00, 0xF5, 0x9F, 0x8A, 0xBF, 0xF2,
+    0xC7, 0xFE, 0xDA, 0x7F, 0xEC, 0x95, 0xC0, 0x57, 0x7F, 0xF1, 0x57, 0xFE, 0x58, 0xFF, 0x00, 0xDB,
+    0x4F, 0xFD, 0x92, 0xB8, 0x0A, 0x29, 0xEC, 0x78, 0x7C, 0x3D, 0xFC, 0x38, 0xFC, 0xFF, 0x00, 0xF4,
+    0xA6, 0x15, 0xEE, 0x1F, 0xB3, 0x87, 0x87, 0x3F, 0xD7, 0x5C, 0x3C, 0x9F, 0xF5, 0x08, 0xB6, 0x8C,
+    0x1F, 0xF7, 0x19, 0x8C, 0xAB, 0x8F, 0xF7, 0x31, 0xF3, 0x7A, 0xE4, 0x74, 0xAF, 0x0F, 0xAF, 0xA3,
+    0x3F, 0x67, 0x3F, 0xF8, 0xF1, 0x93, 0xFE, 0xBB, 0xB7, 0xFE, 0x93, 0xC3, 0x5A, 0xA3, 0xDC, 0x89,
+    0xEA, 0x74, 0x51, 0x45, 0x51, 0x61, 0x45, 0x14, 0x50, 0x01, 0x5E, 0x59, 0xFB, 0x42, 0x78, 0x73,
+    0xCF, 0xB4, 0x59, 0x52, 0x4C, 0x34, 0x0D, 0xF3, 0xA1, 0x3C, 0x49, 0x6F, 0x76, 0xCA, 0xA7, 0x68,
+    0xC1, 0xE4, 0x48, 0x13, 0xB8, 0x18, 0xCF, 0x53, 0x8A, 0xF5, 0x3A, 0xE1, 0xFE, 0x35, 0xFF, 0x00,
+    0xC8, 0x32, 0xE3, 0xFE, 0xD9, 0x7F, 0xE9, 0x5C, 0x74, 0x31, 0x33, 0xE5, 0x8A, 0x28, 0xA2, 0xB3,
+    0x33, 0x3A, 0xEB, 0xCF, 0x8A, 0x1A, 0xDC, 0xC5, 0x7E, 0xD4, 0x6D, 0x24, 0x40, 0xE9, 0x79, 0xF6,
+    0x6D, 0x98, 0x49, 0x24, 0x89, 0x65, 0x0D, 0xE6, 0xC2, 0x84, 0x02, 0x35, 0x1F, 0x35, 0xCC, 0x9C,
+    0x7C, 0xF9, 0xC7, 0x03, 0x8A, 0xA9, 0xAC, 0xF8, 0xDA, 0x5B, 0xC9, 0x0B, 0xDE, 0x69, 0x1A, 0x51,
+    0xCA, 0xF9, 0x0D, 0x00, 0x57, 0xC0, 0xDF, 0x7A, 0x65, 0x62, 0x8C, 0x64, 0x24, 0x19, 0xA4, 0x66,
+    0x04, 0x87, 0x1F, 0x29, 0x21, 0x71, 0x5C, 0xE5, 0x14, 0x01, 0xD0, 0x5F, 0x78, 0xD6, 0xFA, 0x71,
+    0x2F, 0xDA, 0x21, 0xB4, 0x2F, 0x23, 0xB5, 0xD4, 0x57, 0x2A, 0x08, 0x7D, 0x38, 0x5C, 0xB3, 0x97,
+    0x4B, 0x29, 0x83, 0x67, 0x65, 0xC7, 0x98, 0xC0, 0xAB, 0x16, 0x5E, 0x49, 0xC6, 0x49, 0x27, 0x47,
+    0x55, 0xF8, 0xB1, 0xE2, 0x2B, 0x83, 0x1B, 0x1B, 0xDF, 0x26, 0x54, 0x65, 0xBA, 0x13, 0xC4, 0x5B,
+    0xF7, 0xD7, 0x30, 0xC4, 0x54, 0x33, 0x42, 0xEC, 0xCA, 0x37, 0x21, 0x6C, 0x84, 0x44, 0x56, 0xC9,
+    0xDE, 0x0F, 0x18, 0xE3, 0xA8, 0xA0, 0x0E, 0x9C, 0x78, 0xE9, 0xD6, 0x42, 0xF0, 0xE8, 0x5A, 0x34,
+    0x67, 0x02, 0x18, 0xE1, 0x02, 0x52, 0x96, 0xF0, 0xF9, 0xE5, 0xD9, 0x6D, 0xA1, 0x79, 0x48, 0x0B,
+    0x79, 0xB8, 0xAB, 0x00, 0x02, 0x95, 0x24, 0x28, 0x1B, 0x9B, 0x39, 0xB3, 0xF8, 0x9B, 0x50, 0x73,
+    0x21, 0x13, 0xF9, 0x6F, 0x2E, 0xE6, 0xD5, 0x64, 0x4E, 0x3E, 0xDD, 0x34, 0xAE, 0xE4, 0xB3, 0xAF,
+    0x40, 0x4A, 0xBB, 0x27, 0xCA, 0x14, 0x6D, 0x25, 0x71, 0x86, 0x6C, 0xE5, 0x51, 0x40, 0x1D, 0x1C,
+    0x7E, 0x3C, 0xD4, 0xB7, 0x42, 0x67, 0x10, 0x4E, 0x21, 0x8D, 0x6C, 0x2D, 0xA0, 0x7D, 0xC1, 0x64,
+    0x4B, 0x71, 0x28, 0x46, 0x94, 0x46, 0xCB, 0xF3, 0xDA, 0xAC, 0xA7, 0x6B, 0x02, 0xAC, 0xBC, 0x10,
+    0x73, 0x92, 0x64, 0xD6, 0xFE, 0x22, 0x6B, 0x17, 0xAC, 0x5B, 0x52, 0x6B, 0x49, 0x5F, 0x11, 0x47,
+    0xB9, 0xA3, 0x52, 0x02, 0xD9, 0x16, 0x23, 0xF7, 0x0D, 0x95, 0xCC, 0xAE, 0xCC, 0x49, 0x28, 0x4F,
+    0x25, 0x57, 0x08, 0x59, 0x4F, 0x31, 0x45, 0x00, 0x69, 0x7F, 0x6F, 0xDD, 0xEC, 0x60, 0xCD, 0x1B,
+    0x48, 0xCE, 0x6E, 0xE6, 0xD4, 0x48, 0xFD, 0xF3, 0x34, 0xB1, 0xBA, 0xB2, 0xB5, 0xDF, 0x52, 0xB7,
+    0x2A, 0xC7, 0x70, 0x24, 0x83, 0xF8, 0x9C, 0xDA, 0xB1, 0xF1, 0x8E, 0xA1, 0x14, 0x81, 0xC7, 0x91,
+    0x2C, 0x9B, 0x8C, 0xD7, 0xDE, 0x6A, 0xE5, 0x75, 0x40, 0xD0, 0x94, 0xC6, 0xA1, 0x06, 0x70, 0x77,
+    0x46, 0xCE, 0x09, 0xDA, 0x1C, 0xEE, 0x62, 0xCC, 0x49, 0xC8, 0xC3, 0xA2, 0x80, 0x3A, 0xEF, 0x0D,
+    0x7C, 0x50, 0xD6, 0xF4, 0xF6, 0x06, 0xDC, 0xDA, 0x5C, 0x32, 0xA2, 0xE9, 0xF0, 0xBD, 0xCA, 0x6E,
+    0x31, 0xD8, 0x44, 0x64, 0x22, 0x34, 0x94, 0x10, 0x76, 0xEF, 0x7C, 0xF5, 0xCF, 0xCA, 0xA3, 0x3B,
+    0x46, 0x2B, 0x36, 0x5F, 0x18, 0xEA, 0x07, 0x3E, 0x47, 0x91, 0x6E, 0xCD, 0xE7, 0x25, 0xD4, 0xF1,
+    0xAF, 0xCF, 0x79, 0x6D, 0xA9, 0x63, 0x72, 0x5E, 0xCE, 0xE4, 0x97, 0x08, 0x72, 0x41, 0x72, 0xCC,
+    0x09, 0xCE, 0xEC, 0x81, 0x8C, 0x3A, 0x28, 0x03, 0xB5, 0xD5, 0x3E, 0x2B, 0xEA, 0x93, 0xAC, 0x2B,
+    0x1E, 0x9F, 0xA3, 0x59, 0xC3, 0x0B, 0x9B, 0xFD, 0x3E, 0xD6, 0xD2, 0x22, 0xAB, 0x1D, 0xE8, 0x07,
+    0x6B, 0xEC, 0xDC, 0x79, 0x81, 0xD8, 0xB0, 0x1F, 0x74, 0x9F, 0xBE, 0x18, 0x71, 0x50, 0x5B, 0xFC,
+    0x50, 0xD6, 0xD1, 0xF7, 0x66, 0xD1, 0xE4, 0x2F, 0x1D, 0xE5, 0xD1, 0x64, 0xF9, 0x6E, 0xE4, 0xB5,
+    0x92, 0x56, 0x1E, 0x6D, 0xB8, 0x21, 0x70, 0xEF, 0x29, 0x63, 0xB5, 0x17, 0xE6, 0x01, 0xC6, 0x1F,
+    0x2C, 0x79, 0x1A, 0x28, 0x19, 0xB2, 0xBE, 0x2E, 0xD5, 0x02, 0xE1, 0x2F, 0x24, 0x52, 0x44, 0xD1,
+    0x5D, 0xCD, 0x93, 0x9B, 0xD8, 0xB5, 0x10, 0x37, 0x8B, 0xC0, 0x4E, 0x18, 0xBE, 0x3A, 0x95, 0xDF,
+    0xD3, 0x2C, 0x76, 0xA6, 0xDD, 0x1F, 0x15, 0xFC, 0x4A, 0xD6, 0x75, 0x44, 0x0B, 0xAB, 0x3C, 0x0C,
+    0xA3, 0xCB, 0x6C, 0xA0, 0x23, 0x74, 0xD6, 0xCB, 0x28, 0xDD, 0xB3, 0x76, 0x01, 0x9C, 0x4A, 0x77,
+    0x61, 0x40, 0x38, 0x18, 0x00, 0x0A, 0xE5, 0x68, 0xA0, 0x45, 0xED, 0x27, 0x57, 0x96, 0xD8, 0xB1,
+    0x85, 0x77, 0x06, 0x5F, 0xB2, 0xDC, 0xC7, 0xBD, 0xD4, 0x4D, 0x6E, 0xCE, 0xA4, 0xAC, 0x9E, 0x53,
+    0xAE, 0x44, 0xCA, 0xBB, 0x48, 0x24, 0x8C, 0x1E, 0x30, 0x70, 0x45, 0xE9, 0x7C, 0x5F, 0x78, 0xE5,
+    0x8D, 0xC4, 0x50, 0x4B, 0x33, 0xAB, 0xDB, 0xCF, 0x76, 0xC5, 0xF7, 0x05, 0xBA, 0x79, 0x59, 0xBC,
+    0x80, 0xAE, 0x02, 0xF9, 0x8F, 0x21, 0x27, 0x6A, 0xA8, 0x38, 0xC1, 0x1B, 0x5A, 0x40, 0xF8, 0x74,
+    0x50, 0x07, 0x4F, 0xE2, 0x7F, 0x88, 0x5A, 0xA6, 0xA3, 0x18, 0x8E, 0xE9, 0x6D, 0x21, 0xB6, 0x0E,
+    0x2E, 0xE0, 0xB2, 0x81, 0x48, 0x5B, 0x76, 0x8E, 0x05, 0x40, 0xB6, 0xEA, 0xC4, 0xE1, 0x63, 0x40,
+    0x48, 0x00, 0x81, 0x92, 0x49, 0xED, 0x88, 0xEC, 0x7C, 0x79, 0xA9, 0x40, 0xEC, 0xD1, 0x08, 0x1D,
+    0x9A, 0x44, 0xBC, 0xFD, 0xF6, 0xE6, 0x31, 0x25, 0xBD, 0xD1, 0x93, 0xCB, 0x8A, 0x59, 0x18, 0xB0,
+    0x49, 0x6E, 0x08, 0x66, 0xF9, 0xF7, 0x31, 0x00, 0x96, 0xCE, 0x73, 0xCE, 0x51, 0x40, 0x1D, 0x3D,
+    0xBF, 0xC4, 0x0D, 0x41, 0x20, 0x78, 0xC4, 0x16, 0x92, 0x3C, 0x80, 0xC7, 0x75, 0xA9, 0xCD, 0xBD,
+    0xE5, 0x2B, 0x23, 0x4B, 0x9F, 0x29, 0xA5, 0x76, 0x00, 0xBA, 0xCD, 0x20, 0x25, 0x50, 0x12, 0x18,
+    0x93, 0xC9, 0xCD, 0x13, 0x78, 0xFE, 0xF8, 0xB4, 0x46, 0x0B, 0x2D, 0x36, 0xD9, 0x63, 0x9B, 0xFB,
+    0x72, 0x3B, 0x4B, 0x74, 0x2B, 0x1C, 0xF7, 0x99, 0x4C, 0x79, 0xD6, 0xEA, 0xD8, 0xC4, 0x28, 0x81,
+    0x46, 0x02, 0x9C, 0x64, 0x92, 0x58, 0x92, 0x79, 0x8A, 0x28, 0x03, 0xAA, 0xB1, 0xF8, 0x8F, 0xA9,
+    0x42, 0xD9, 0x8A, 0xDE, 0xC7, 0xCB, 0xF3, 0x12, 0xFA, 0x1B, 0x15, 0x56, 0x58, 0xE1, 0xFB, 0x3C,
+    0xD3, 0x3A, 0xA2, 0x24, 0x4E, 0xBF, 0x24, 0x53, 0xCC, 0x58, 0x02, 0x4F, 0x21, 0x7B, 0x0C, 0x55,
+    0x55, 0xF1, 0xBE, 0xA7, 0xE5, 0x94, 0x96, 0x69, 0x26, 0x42, 0x1D, 0x64, 0x32, 0xC9, 0x29, 0x26,
+    0x4B, 0x8F, 0x37, 0x73, 0x20, 0x32, 0x60, 0x34, 0xBE, 0x67, 0x24, 0x28, 0xC8, 0x18, 0x6C, 0x86,
+    0x90, 0x3F, 0x3F, 0x45, 0x00, 0x74, 0xFA, 0xC7, 0x8F, 0xEF, 0xAE, 0xA2, 0x11, 0xC9, 0x65, 0xA6,
+    0xC5, 0x18, 0x77, 0xBA, 0x4F, 0x29, 0x0F, 0x26, 0x74, 0x65, 0xC3, 0x44, 0xEC, 0x57, 0x16, 0xD1,
+    0x10, 0x88, 0x76, 0x6E, 0x8D, 0x40, 0x08, 0x46, 0x2A, 0x7B, 0x2F, 0x89, 0x9A, 0x9C, 0x52, 0x2C,
+    0x86, 0xDE, 0xD2, 0x79, 0xD4, 0x24, 0x62, 0xEE, 0xE5, 0xA5, 0x77, 0x61, 0x6F, 0xE6, 0x7D, 0xDB,
+    0x87, 0x94, 0x95, 0x13, 0xB3, 0xE5, 0x82, 0xB2, 0x2B, 0x63, 0x04, 0x6D, 0x2C, 0x1B, 0x91, 0xA2,
+    0x81, 0x9D, 0x04, 0x7E, 0x36, 0xD4, 0x14, 0x38, 0x4F, 0x2F, 0xCB, 0x77, 0x96, 0xF6, 0xE6, 0x26,
+    0x67, 0x60, 0xD3, 0x5F, 0x5B, 0x3A, 0x12, 0x0C, 0x8E, 0x4E, 0x62, 0x8E, 0x46, 0xC1, 0xCE, 0xE2,
+    0x7F, 0xD6, 0x16, 0xC0, 0xC5, 0xAD, 0x53, 0xE2, 0x2D, 0xFD, 0xD0, 0xFF, 0x00, 0x4C, 0xB2, 0xB1,
+    0x90, 0xF9, 0xAF, 0xAC, 0xBB, 0x3F, 0x98, 0x44, 0x97, 0x73, 0x26, 0x07, 0x9B, 0x0B, 0xC8, 0x54,
+    0x8B, 0x64, 0x0A, 0x14, 0x14, 0x20, 0x00, 0x01, 0xC8, 0x2C, 0x1B, 0x95, 0xA2, 0x81, 0x1D, 0x3E,
+    0x91, 0xE3, 0xFB, 0xEB, 0x56, 0x06, 0xDA, 0xCB, 0x4D, 0x66, 0x02, 0x18, 0xAD, 0xB7, 0xA1, 0x22,
+    0xDE, 0x3B, 0x03, 0x9C, 0x44, 0x9B, 0xB1, 0x8B, 0xA9, 0x32, 0xED, 0xC1, 0xCB, 0xFC, 0xEB, 0xB5,
+    0xC0, 0x60, 0xFB, 0xAF, 0x89, 0x5A, 0xCB, 0xA4, 0xC9, 0x1B, 0xC1, 0x6F, 0x14, 0xFB, 0x9B, 0x51,
+    0x8A, 0x10, 0x47, 0x99, 0x34, 0xF7, 0x2C, 0xE5, 0x81, 0xDD, 0xD5, 0xD5, 0xBC, 0xB3, 0xC9, 0x05,
+    0x30, 0xAC, 0x0E, 0x01, 0x1C, 0xAD, 0x14, 0x01, 0xD5, 0x78, 0x8F, 0xE2, 0x3E, 0xA5, 0x7F, 0x00,
+    0x86, 0xEA, 0xDE, 0xC6, 0x2B, 0x75, 0x90, 0x5F, 0x59, 0xC5, 0x0A, 0xB0, 0xFB, 0x26, 0xD8, 0xC8,
+    0xD9, 0x01, 0x67, 0x3F, 0x22, 0xEE, 0x24, 0x0E, 0x76, 0xF4, 0x5C, 0x28, 0x0A, 0x39, 0x5A, 0x28,
+    0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28,
+    0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x0C, 0x5A, 0x28, 0xA2, 0xA0, 0xA0, 0xA2,
+    0x8A, 0x28, 0x03, 0xD6, 0x7E, 0x2A, 0xFF, 0x00, 0xCB, 0x1F, 0xFB, 0x69, 0xFF, 0x00, 0xB2, 0x57,
+    0x01, 0x5D, 0xFF, 0x00, 0xC5, 0x5F, 0xF9, 0x63, 0xFF, 0x00, 0x6D, 0x3F, 0xF6, 0x4A, 0xE0, 0x28,
+    0xA7, 0xB1, 0xE1, 0xF0, 0xF7, 0xF0, 0xE3, 0xF3, 0xFF, 0x00, 0xD2, 0x98, 0x57, 0xBB, 0xFE, 0xCE,
+    0x1E, 0x20, 0x84, 0xA4, 0xD0, 0x32, 0xED, 0x94, 0x37, 0xF6, 0xB4, 0x2D, 0xCF, 0xEF, 0xA1, 0x75,
+    0x45, 0x3C, 0x63, 0x8F, 0x28, 0x85, 0xFE, 0x2C, 0x9C, 0xF0, 0x38, 0x35, 0xE1, 0x15, 0xB3, 0xE1,
+    0x2F, 0x14, 0x5D, 0xE9, 0x97, 0x09, 0x2D, 0x93, 0xB8, 0x20, 0x81, 0x75, 0x0A, 0x9C, 0x0B, 0xCB,
+    0x62, 0x46, 0x52, 0x42, 0x41, 0xE2, 0x40, 0x3D, 0x0E, 0x0E, 0x08, 0xE4, 0x0A, 0xD1, 0x1E, 0xDA,
+    0x3E, 0xC6, 0xA2, 0xB2, 0xBC, 0x33, 0xE2, 0x6D, 0x3F, 0x52, 0x85, 0x64, 0xD2, 0xA7, 0xDF, 0x19,
+    0xF9, 0x5D, 0x0F, 0xDE, 0xB6, 0x98, 0x0E, 0x56, 0xE1, 0x3B, 0x14, 0xCF, 0xD3, 0xB8, 0x24, 0x10,
+    0x6B, 0x56, 0xAC, 0xD0, 0x28, 0xA2, 0x8A, 0x00, 0x2B, 0xCC, 0xBE, 0x3F, 0x78, 0x82, 0x18, 0x2C,
+    0xBC, 0xA6, 0x5D, 0xD2, 0xCC, 0xC2, 0x38, 0x57, 0x9F, 0xDD, 0xC3, 0x6C, 0xEA, 0xC5, 0xB3, 0x83,
+    0xD0, 0x85, 0x18, 0xC8, 0x3C, 0xE4, 0x74, 0x35, 0xE8, 0x7A, 0xAE, 0xAB, 0x69, 0x69, 0x1B, 0x49,
+    0xA8, 0xDC, 0xA4, 0x10, 0x28, 0xF3, 0x2E, 0x26, 0x6E, 0x88, 0xBE, 0xC0, 0x77, 0x63, 0xC0, 0x00,
+    0x12, 0x4F, 0x03, 0x9A, 0xF9, 0x53, 0xE2, 0x37, 0x8E, 0x66, 0xD6, 0x2E, 0x0B, 0xE6, 0x74, 0xB6,
+    0x5F, 0xDD, 0x69, 0x56, 0x6E, 0x47, 0xFA, 0x3C, 0x38, 0x19, 0x25, 0x57, 0xBC, 0xC4, 0x64, 0xF5,
+    0x3D, 0xB2, 0x40, 0x14, 0x98, 0xA4, 0xCE, 0x56, 0x8A, 0x28, 0xA8, 0x33, 0x3B, 0xCF, 0x1F, 0xF8,
+    0xAB, 0x4B, 0xBE, 0x89, 0x0D, 0xBE, 0x9D, 0x1C, 0x57, 0x4C, 0x56, 0xF6, 0x6B, 0x95, 0x70, 0xED,
+    0x24, 0x28, 0x8E, 0x9B, 0x35, 0x19, 0xA4, 0xDC, 0xC1, 0xAD, 0xC4, 0x69, 0x8C, 0x49, 0xB6, 0x40,
+    0x7C, 0xC6, 0x55, 0x62, 0x00, 0xA9, 0xF0, 0xF6, 0x0D, 0x1A, 0x4F, 0x31, 0x7C, 0x45, 0xA9, 0x79,
+    0x36, 0xEE, 0xD1, 0xD8, 0x2D, 0xA9, 0x60, 0xA0, 0xCD, 0x36, 0xFF, 0x00, 0xDE, 0xBC, 0x84, 0x36,
+    0x3E, 0xC2, 0xAA, 0x70, 0x42, 0x63, 0x2C, 0x15, 0xD9, 0x51, 0x9B, 0x3C, 0x75, 0x14, 0x0C, 0xF4,
+    0x6D, 0x69, 0xAC, 0xE7, 0x8E, 0x63, 0x2E, 0xBD, 0x00, 0x84, 0x7D, 0xA1, 0x2C, 0x22, 0x0E, 0x86,
+    0x6B, 0x39, 0x96, 0xF9, 0x9D, 0x62, 0xBE, 0x22, 0x42, 0x65, 0x8E, 0xF8, 0x90, 0xDB, 0x83, 0x4C,
+    0x15, 0xF9, 0xC8, 0x50, 0xC5, 0xB7, 0x7F, 0xB6, 0x64, 0xB9, 0x9A, 0xDA, 0x49, 0xBC, 0x61, 0x63,
+    0x0D, 0xD8, 0xCD, 0xD8, 0xB9, 0x79, 0xD4, 0x88, 0x2D, 0xF5, 0x08, 0x26, 0xC4, 0x73, 0x87, 0x1B,
+    0x15, 0xED, 0xD2, 0x15, 0x47, 0x65, 0xB6, 0x03, 0x2E, 0x09, 0x42, 0x54, 0x6F, 0xF1, 0xCA, 0x28,
+    0x03, 0xD8, 0xED, 0xFC, 0x5B, 0xA6, 0x43, 0x74, 0x24, 0x1A, 0xE4, 0x17, 0x86, 0x7F, 0x2E, 0xE3,
+    0x55, 0x58, 0xCB, 0x2E, 0x66, 0x92, 0x2B, 0xC5, 0x7F, 0x22, 0xEE, 0x61, 0xB9, 0x0D, 0xA3, 0x95,
+    0x58, 0xFE, 0x68, 0x00, 0x42, 0x03, 0x9C, 0x66, 0x4A, 0xF2, 0x7D, 0x5B, 0x77, 0x9B, 0x26, 0xFB,
+    0x99, 0x2E, 0x0E, 0xF6, 0xDF, 0x74, 0xE4, 0x13, 0x72, 0xDB, 0xCF, 0xCD, 0x23, 0xA3, 0x38, 0x26,
+    0x4E, 0xBC, 0x3B, 0x0F, 0x42, 0x7A, 0xD5, 0x4A, 0x28, 0x03, 0xD7, 0x2F, 0x3C, 0x50, 0x90, 0xDC,
+    0x46, 0xD1, 0x78, 0xB3, 0xED, 0x77, 0xFE, 0x6C, 0x69, 0x75, 0x23, 0x32, 0xA4, 0x2C, 0xB7, 0x76,
+    0x6C, 0xAD, 0x2C, 0xC9, 0x17, 0x9B, 0x18, 0x7B, 0x28, 0xDD, 0x13, 0x78, 0x76, 0x1C, 0x1D, 0xD1,
+    0x90, 0x0B, 0x3F, 0x0D, 0xE3, 0x99, 0xAC, 0xA4, 0x91, 0x1B, 0x4E, 0xB8, 0x82, 0x58, 0xCC, 0x62,
+    0x15, 0x68, 0xC1, 0x1B, 0x52, 0xD2, 0x57, 0x45, 0xF3, 0x11, 0xD8, 0x91, 0xBA, 0x08, 0xD0, 0x80,
+    0x70, 0xC1, 0x48, 0x0E, 0x59, 0xB2, 0xED, 0xCE, 0x51, 0x40, 0x1D, 0xFE, 0x99, 0xA8, 0xE8, 0x06,
+    0xCC, 0x25, 0xF5, 0xAC, 0x13, 0x5C, 0xF9, 0x13, 0xA2, 0x19, 0xDC, 0x6E, 0x86, 0xE1, 0xA7, 0x76,
+    0x46, 0xD2, 0xE4, 0x52, 0x71, 0xB1, 0x97, 0xE6, 0x57, 0x68, 0xC9, 0xEB, 0x0A, 0xB1, 0x76, 0x12,
+    0x73, 0x9E, 0x0A, 0x9B, 0xCB, 0xB9, 0x56, 0x1A, 0xB7, 0xF6, 0x73, 0x2A, 0xC9, 0x71, 0x6F, 0xA8,
+    0x67, 0x02, 0x0B, 0x88, 0xAD, 0x9C, 0xAF, 0x99, 0xF2, 0xB6, 0x44, 0xB2, 0x00, 0xA4, 0x6D, 0x62,
+    0xC0, 0xED, 0x00, 0x93, 0x58, 0x74, 0x50, 0x07, 0xB3, 0x59, 0xEA, 0xDE, 0x15, 0x96, 0xEE, 0xF5,
+    0xAC, 0x35, 0x38, 0xCC, 0x32, 0x08, 0xEE, 0xED, 0xE2, 0x94, 0x6D, 0x33, 0x5C, 0xC8, 0xFF, 0x00,
+    0xBC, 0x36, 0x4D, 0x77, 0x32, 0x26, 0x76, 0xB3, 0x70, 0xEB, 0xC8, 0x66, 0x50, 0xAD, 0x18, 0x65,
+    0x92, 0x7B, 0xDF, 0x12, 0x89, 0x61, 0xBD, 0x58, 0xAF, 0x7C, 0x3F, 0x05, 0xB9, 0x17, 0x31, 0xC5,
+    0x72, 0xD7, 0x49, 0xE6, 0xEA, 0x63, 0xED, 0xB7, 0x0E, 0xBF, 0x62, 0xB7, 0x84, 0xAB, 0x61, 0xF7,
+    0xB2, 0xE1, 0xE4, 0x2A, 0xC0, 0x86, 0x50, 0x46, 0xE5, 0x7F, 0x12, 0xA2, 0x80, 0xB9, 0xEB, 0x1A,
+    0x27, 0x89, 0xDA, 0xEA, 0xE2, 0xD9, 0xAE, 0xB5, 0x6D, 0x36, 0xC2, 0x45, 0x3E, 0x7D, 0xD5, 0xFB,
+    0x48, 0x3C, 0xBB, 0xB6, 0x30, 0xCF, 0xB7, 0xFB, 0x49, 0x7C, 0xC8, 0xA4, 0x2D, 0x64, 0xAB, 0xE4,
+    0xFC, 0xF2, 0x48, 0x18, 0x1C, 0x96, 0xC3, 0x7E, 0xF4, 0xD3, 0xB5, 0x1F, 0x0A, 0xF9, 0xAB, 0xF6,
+    0x69, 0x74, 0xDB, 0x8B, 0x40, 0x96, 0xF7, 0x3A, 0x85, 0x85, 0xD0, 0xF2, 0xBC, 0xC9, 0xA2, 0x79,
+    0x41, 0x8E, 0xD6, 0x1F, 0x2C, 0xA9, 0x68, 0x9D, 0xE3, 0x3B, 0xA4, 0x9D, 0x9B, 0x6E, 0x55, 0xE5,
+    0x68, 0xCC, 0x84, 0x79, 0x3D, 0x14, 0x01, 0xEA, 0xB6, 0x7A, 0x95, 0x9C, 0x36, 0xB3, 0x42, 0x35,
+    0x5D, 0x2A, 0x42, 0xB1, 0xDD, 0x58, 0x58, 0x6A, 0x90, 0xBA, 0x2B, 0xCB, 0x6B, 0x69, 0x2B, 0x30,
+    0x4B, 0xB5, 0x6D, 0xAC, 0x46, 0xA4, 0xF2, 0x65, 0x7C, 0xBB, 0x87, 0x52, 0x40, 0x05, 0x08, 0x12,
+    0x86, 0xCD, 0xF8, 0x87, 0xF1, 0x05, 0xB5, 0x4B, 0x68, 0x37, 0xCD, 0x20, 0x93, 0x25, 0xAF, 0xA0,
+    0xDC, 0x08, 0x79, 0x60, 0x79, 0x02, 0x99, 0xE3, 0xF9, 0x70, 0xD1, 0xC2, 0xCA, 0x4B, 0x2C, 0x61,
+    0x24, 0x2C, 0x47, 0x1E, 0x58, 0x51, 0xE7, 0x94, 0x50, 0x07, 0xA1, 0xFC, 0x22, 0xF1, 0x03, 0x59,
+    0x34, 0x8C, 0x64, 0xD1, 0xA3, 0x8D, 0x4A, 0xDF, 0xDC, 0x3D, 0xEC, 0xC1, 0x0C, 0x8B, 0x0C, 0x13,
+    0xAE, 0xDB, 0x25, 0x11, 0xC8, 0xC5, 0x9F, 0xCD, 0xCE, 0x55, 0x33, 0x81, 0xB4, 0xFD, 0xEC, 0x13,
+    0x4E, 0x8E, 0x01, 0x6D, 0x3C, 0x4F, 0xE2, 0x6B, 0x4F, 0x20, 0x24, 0x9A, 0xAF, 0x86, 0xEF, 0x92,
+    0x45, 0x57, 0x76, 0xB1, 0x79, 0x90, 0xC3, 0x73, 0x6A, 0xD8, 0x60, 0x35, 0x28, 0xA5, 0x66, 0x0B,
+    0xBB, 0x03, 0x24, 0x80, 0xC4, 0xB8, 0xAF, 0x3C, 0xA2, 0x80, 0x3D, 0xAA, 0xE7, 0xC6, 0xB6, 0xF3,
+    0x5C, 0x42, 0xF2, 0x6A, 0x36, 0x36, 0x32, 0xB4, 0xB2, 0x37, 0xDA, 0x63, 0x68, 0x89, 0x82, 0xE6,
+    0x0B, 0x36, 0x8B, 0x74, 0xB3, 0x66, 0xE3, 0x62, 0x5F, 0xB0, 0x8C, 0x1C, 0xAB, 0xA9, 0x03, 0x20,
+    0x0D, 0x9E, 0x64, 0xB9, 0xBA, 0x87, 0x8A, 0x6D, 0x44, 0xE3, 0xEC, 0x53, 0x5A, 0x18, 0x76, 0x43,
+    0x76, 0x90, 0xE6, 0x3C, 0xD9, 0x6A, 0x5A, 0x75, 0xCC, 0xA8, 0xAB, 0x69, 0x2C, 0xD7, 0x4E, 0xB1,
+    0xA8, 0x95, 0xCB, 0xAE, 0xC2, 0xEA, 0xA9, 0xB7, 0x28, 0xD1, 0xEF, 0xDD, 0xE4, 0xF4, 0x50, 0x17,
+    0x3D, 0x56, 0xDF, 0x54, 0xD0, 0xDE, 0x09, 0xC4, 0x3A, 0x97, 0x9F, 0x20, 0xFB, 0x5F, 0xD8, 0x75,
+    0x2B, 0xC6, 0x41, 0x31, 0x47, 0x8E, 0x6C, 0x1B, 0x5B, 0x89, 0x1B, 0x25, 0x2E, 0xD1, 0xD5, 0x4A,
+    0x18, 0x15, 0x99, 0xDD, 0x9E, 0x33, 0x95, 0x3B, 0x75, 0x75, 0x6F, 0x10, 0xE9, 0x2E, 0x63, 0x36,
+    0x3E, 0x30, 0x9E, 0x3B, 0xA5, 0x63, 0x2C, 0x1A, 0xA3, 0xB7, 0xDF, 0xB7, 0xB0, 0xD3, 0xE7, 0xF2,
+    0x8D, 0xF8, 0x66, 0x94, 0xE7, 0x73, 0x0D, 0xDB, 0x52, 0x31, 0x27, 0x98, 0xCA, 0x63, 0x32, 0x06,
+    0x54, 0xF1, 0x5A, 0x28, 0x0B, 0x9E, 0xAB, 0xA7, 0x6A, 0xDA, 0x15, 0xC4, 0xF2, 0x34, 0x77, 0xB3,
+    0xAD, 0xAB, 0x2C, 0x29, 0x36, 0x9B, 0x7B, 0x74, 0x56, 0x34, 0x9A, 0xF2, 0x39, 0x3C, 0xC4, 0x7B,
+    0xD7, 0x66, 0x93, 0xE4, 0xB8, 0x90, 0x9D, 0xE9, 0x11, 0x1F, 0x33, 0xAC, 0x80, 0x46, 0xE5, 0x8D,
+    0x4B, 0xCF, 0x17, 0xD8, 0xDB, 0xDB, 0x5C, 0x5A, 0xC3, 0x75, 0x68, 0xF0, 0x02, 0xD6, 0x9A, 0x35,
+    0xE4, 0x11, 0x87, 0x92, 0xF2, 0x04, 0xBB, 0x9C, 0x85, 0xD4, 0xDE, 0x55, 0xDA, 0x57, 0x9D, 0xC1,
+    0x91, 0x94, 0xA1, 0x20, 0xA0, 0x63, 0xB8, 0x0F, 0x35, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x81, 0x05,
+    0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05,
+    0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05,
+    0x14, 0x51, 0x40, 0x18, 0xB4, 0x51, 0x45, 0x41, 0x41, 0x45, 0x14, 0x50, 0x07, 0xAC, 0xFC, 0x55,
+    0xFF, 0x00, 0x96, 0x3F, 0xF6, 0xD3, 0xFF, 0x00, 0x64, 0xAE, 0x02, 0xBB, 0xFF, 0x00, 0x8A, 0xBF,
+    0xF2, 0xC7, 0xFE, 0xDA, 0x7F, 0xEC, 0x95, 0xC0, 0x51, 0x4F, 0x63, 0xC3, 0xE1, 0xEF, 0xE1, 0xC7,
+    0xE7, 0xFF, 0x00, 0xA5, 0x30, 0xA2, 0x8A, 0x2A, 0xCF, 0x68, 0xDC, 0xF0, 0x9F, 0x8D, 0x35, 0x6D,
+    0x29, 0xCB, 0x68, 0xF7, 0x5E, 0x5E, 0x70, 0x2E, 0xED, 0xD8, 0x65, 0x6E, 0x91, 0x1B, 0x38, 0x99,
+    0x0F, 0xE2, 0x32, 0x08, 0x60, 0x09, 0xC1, 0x19, 0xAF, 0x70, 0xF0, 0xE7, 0xED, 0x09, 0xA1, 0xCF,
+    0x91, 0xAD, 0x5B, 0x4F, 0xA6, 0x37, 0x2D, 0x1B, 0xF3, 0x22, 0xC8, 0xA3, 0x1C, 0x6F, 0x8D, 0x41,
+    0xC9, 0x24, 0xFF, 0x00, 0x06, 0x30, 0x3A, 0xE7, 0x8A, 0xF9, 0xCE, 0x8A, 0x69, 0x8D, 0x33, 0xEA,
+    0x7F, 0xF8, 0x5D, 0x7E, 0x0C, 0xFF, 0x00, 0xA0, 0xF7, 0xFE, 0x41, 0x9B, 0xFF, 0x00, 0x8D, 0xD6,
+    0x57, 0x88, 0x3E, 0x3F, 0x78, 0x72, 0x05, 0xFF, 0x00, 0x89, 0x4F, 0x9F, 0xA9, 0x4A, 0x7E, 0xEC,
+    0x4A, 0xAC, 0x8B, 0x1E, 0x08, 0xFF, 0x00, 0x5D, 0x2C, 0xAA, 0x3A, 0x82, 0x71, 0x84, 0x6E, 0x9C,
+    0xE3, 0xAD, 0x7C, 0xDB, 0x45, 0x3B, 0x8E, 0xE7, 0x55, 0xE3, 0x9F, 0x88, 0xDA, 0xB6, 0xB0, 0xDF,
+    0xE9, 0xB2, 0xF9, 0x76, 0xC1, 0x8C, 0xD6, 0x3A, 0x6A, 0x7D, 0xDB, 0x7C, 0x8C, 0x7C, 0xED, 0x81,
+    0xB8, 0x81, 0xDC, 0xFA, 0x9D, 0xA0, 0x03, 0x8A, 0xE5, 0x68, 0xA2, 0x91, 0x21, 0x45, 0x14, 0x52,
+    0x03, 0xAE, 0xF1, 0xB7, 0x80, 0xD7, 0x4E, 0x48, 0xDE, 0xCA, 0xF6, 0xEE, 0xFA, 0xD9, 0xCB, 0xC0,
+    0xD7, 0x8F, 0x6E, 0x63, 0x10, 0x5C, 0xC1, 0x21, 0x05, 0x24, 0x47, 0x62, 0x43, 0x06, 0x56, 0xE1,
+    0x91, 0x7A, 0x7C, 0xB9, 0xE7, 0x14, 0x7C, 0x27, 0xE1, 0x36, 0xD4, 0x4B, 0x88, 0x6F, 0x23, 0x8A,
+    0x55, 0x1E, 0x64, 0x30, 0x1C, 0x16, 0xBA, 0x5D, 0xAD, 0x9F, 0xB3, 0xC2, 0x1B, 0x71, 0x31, 0xE0,
+    0x12, 0x16, 0x37, 0x3B, 0x72, 0x46, 0x58, 0x2A, 0x3C, 0x7A, 0xC7, 0x8C, 0x2F, 0xEE, 0xD3, 0x6D,
+    0xE1, 0xF3, 0x33, 0xE5, 0x19, 0x6E, 0x24, 0x79, 0x19, 0xE5, 0x7B, 0x35, 0x94, 0x02, 0x5E, 0x69,
+    0x1B, 0x1E, 0x67, 0x9C, 0xC4, 0x80, 0x02, 0xE7, 0xEE, 0x81, 0xCE, 0x60, 0xD0, 0xFC, 0x49, 0x79,
+    0x65, 0x9F, 0xB1, 0xB7, 0xCA, 0xCC, 0x92, 0xDE, 0x40, 0xCC, 0xFB, 0x2F, 0x61, 0x87, 0x77, 0xEE,
+    0xEF, 0x20, 0x56, 0x01, 0x92, 0x60, 0xD8, 0x20, 0x82, 0x71, 0xC0, 0x20, 0x13, 0x90, 0x67, 0x41,
+    0x27, 0xC3, 0x69, 0x56, 0xDD, 0xA5, 0x6B, 0x9B, 0xB2, 0xA8, 0x25, 0x5D, 0x44, 0x98, 0x36, 0x2D,
+    0xB5, 0xCD, 0xBC, 0xC5, 0x54, 0x2C, 0xD7, 0x4F, 0x16, 0xE1, 0x72, 0x41, 0xCE, 0xD5, 0x67, 0x43,
+    0x85, 0x29, 0xB8, 0xE2, 0x9F, 0xAE, 0xFC, 0x35, 0x8E, 0xD2, 0x58, 0xD5, 0xB5, 0xAD, 0xF1, 0xC9,
+    0x24, 0xFA, 0x75, 0x85, 0xDF, 0x90, 0xDF, 0xBD, 0xB8, 0xB1, 0x44, 0x18, 0xFB, 0x3C, 0x65, 0xDB,
+    0xF7, 0x97, 0x8C, 0xD1, 0xF0, 0xA4, 0xF1, 0xB8, 0x02, 0x08, 0xAE, 0x55, 0xB5, 0x79, 0x4C, 0xAF,
+    0x21, 0x5F, 0x9D, 0xFC, 0xCF, 0x34, 0x6F, 0x7E, 0x3E, 0xD6, 0x8C, 0x0F, 0xEF, 0x4B, 0xEE, 0x38,
+    0x0C, 0x7E, 0xF3, 0xB6, 0x7F, 0x8F, 0x70, 0x24, 0x1E, 0x8D, 0x3E, 0x27, 0x5E, 0x46, 0x10, 0x58,
+    0x68, 0xBA, 0x1D, 0xA2, 0x2C, 0xFF, 0x00, 0xF0, 0x90, 0xAC, 0x31, 0x46, 0xE5, 0x5E, 0xF4, 0x21,
+    0x1C, 0xC7, 0x2C, 0x8C, 0x00, 0xDA, 0x78, 0x0A, 0x17, 0x6F, 0x05, 0x30, 0x45, 0x00, 0x49, 0x27,
+    0xC2, 0xBD, 0x50, 0x4A, 0xF1, 0xA8, 0x93, 0xCF, 0x50, 0x27, 0x8D, 0x19, 0x0F, 0xFA, 0x4D, 0xB0,
+    0x77, 0x57, 0x78, 0xA3, 0x42, 0xCD, 0xB6, 0x39, 0x10, 0xED, 0x3E, 0x5F, 0xCE, 0xB8, 0xE8, 0xEC,
+    0x88, 0xE5, 0xC7, 0xC3, 0x56, 0x8A, 0xD5, 0xE5, 0xBB, 0xD6, 0x2D, 0x2D, 0xAE, 0xA3, 0x2F, 0xF6,
+    0xDD, 0x1A, 0x6C, 0x6E, 0x30, 0xC1, 0x70, 0x63, 0xDD, 0x6C, 0xD0, 0xB3, 0x92, 0x1A, 0xE0, 0x04,
+    0xE5, 0x11, 0x73, 0x9C, 0x9C, 0x00, 0x49, 0x6D, 0xF1, 0x77, 0xC4, 0x31, 0xC8, 0xD2, 0x24, 0xB6,
+    0x8D, 0x70, 0xC8, 0x2C, 0x8D, 0xDC, 0x91, 0x82, 0xD1, 0x42, 0xBE, 0x61, 0xC4, 0x2C, 0xD9, 0xC0,
+    0x79, 0x9F, 0x7E, 0x3E, 0xEE, 0x42, 0x80, 0x02, 0x00, 0xB5, 0xCA, 0xC5, 0xA9, 0xCE, 0x1D, 0x9E,
+    0x49, 0x24, 0x96, 0x46, 0x0E, 0x93, 0xCA, 0xEC, 0xD9, 0x95, 0xAE, 0xA3, 0x60, 0x4C, 0x92, 0x2B,
+    0x02, 0x49, 0xDC, 0x4F, 0x24, 0x83, 0xD1, 0x81, 0x19, 0x04, 0x03, 0x7F, 0xFE, 0x10, 0xCB, 0x69,
+    0x65, 0x85, 0x74, 0x9D, 0x63, 0xED, 0x10, 0x4B, 0x1B, 0x5C, 0xFF, 0x00, 0x68, 0x4B, 0x18, 0x41,
+    0x61, 0x71, 0x6E, 0x8E, 0x59, 0x2F, 0x77, 0x48, 0x40, 0xFB, 0x2A, 0xA8, 0x66, 0x21, 0x89, 0x0A,
+    0x77, 0x28, 0x6C, 0xAE, 0xED, 0xCB, 0x1F, 0x84, 0x51, 0xC9, 0x2E, 0xC6, 0xF1, 0x06, 0xD3, 0xE5,
+    0xA6, 0xA6, 0x42, 0x5B, 0xB3, 0x99, 0x2C, 0xE7, 0x49, 0x88, 0x36, 0xCB, 0x0B, 0x30, 0x6D, 0x8A,
+    0x91, 0x82, 0x55, 0x99, 0x37, 0x36, 0xD5, 0x76, 0x60, 0x03, 0x60, 0x0F, 0x88, 0x7A, 0xA8, 0x75,
+    0x68, 0x63, 0xD3, 0x61, 0x8D, 0x1D, 0xEF, 0xEC, 0x34, 0xF8, 0x60, 0x45, 0x8A, 0xD6, 0xF2, 0x58,
+    0xC8, 0x0E, 0x20, 0x40, 0x32, 0xD6, 0xC3, 0x1B, 0x4B, 0x6F, 0x20, 0x8E, 0xFC, 0xE5, 0xF3, 0x7C,
+    0x43, 0xBC, 0x91, 0x94, 0xDE, 0x69, 0x9A, 0x55, 0xC0, 0x0B, 0x15, 0xBB, 0x5A, 0x4A, 0xAF, 0xE5,
+    0xC8, 0xB6, 0x01, 0xB6, 0xE2, 0xD0, 0x38, 0x51, 0xCB, 0x64, 0xED, 0x54, 0x1D, 0x40, 0x01, 0x59,
+    0xC3, 0x00, 0x5E, 0x4F, 0x86, 0x32, 0x3C, 0x0F, 0x2D, 0xAE, 0xA3, 0xBD, 0x51, 0x67, 0xBB, 0x7B,
+    0x77, 0x55, 0xDD, 0x73, 0x69, 0x65, 0x23, 0x2E, 0xFB, 0x09, 0x12, 0x56, 0x56, 0x01, 0x87, 0xCF,
+    0x89, 0x01, 0x4E, 0xAA, 0x1C, 0x14, 0xDD, 0x26, 0xBF, 0xF0, 0xA2, 0xE2, 0xCB, 0xE6, 0xBC, 0xD5,
+    0x2D, 0x23, 0xB6, 0xDE, 0x2C, 0x4C, 0xB2, 0x15, 0xDF, 0x6F, 0x72, 0xF6, 0x5E, 0x67, 0xFA, 0x5C,
+    0x08, 0xEC, 0x00, 0x4F, 0xBA, 0x71, 0x23, 0x39, 0xEB, 0x1A, 0xBE, 0x54, 0x36, 0x35, 0x8F, 0x8E,
+    0xAF, 0xE2, 0x89, 0xE3, 0x92, 0x18, 0x2E, 0x37, 0x34, 0xD7, 0x4F, 0x75, 0x33, 0x48, 0x5D, 0x6E,
+    0x35, 0x0B, 0x7D, 0x8C, 0xC4, 0x2C, 0x80, 0x12, 0x63, 0xCE, 0x0B, 0x23, 0x10, 0x49, 0xC7, 0x5A,
+    0x93, 0x53, 0xF8, 0x8B, 0xAD, 0x5D, 0x83, 0xFD, 0xA9, 0x75, 0x25, 0xCB, 0x12, 0xCF, 0xE6, 0xB4,
+    0x92, 0x28, 0x45, 0x92, 0xD9, 0x93, 0x11, 0xDB, 0x44, 0xEA, 0x80, 0x05, 0x62, 0x78, 0x8F, 0x24,
+    0xE4, 0x31, 0x2A, 0x48, 0x20, 0x17, 0xB4, 0x6F, 0x86, 0x33, 0xCD, 0x33, 0x45, 0xA8, 0x6A, 0xB6,
+    0x9A, 0x7C, 0xEB, 0x24, 0x3A, 0x74, 0xA9, 0x3A, 0xB6, 0x1E, 0x5B, 0xD8, 0xA4, 0x6C, 0x42, 0xD8,
+    0x19, 0x64, 0x09, 0x81, 0xD1, 0x1C, 0xFD, 0xC7, 0xC1, 0x52, 0xD1, 0xC1, 0xE0, 0xBD, 0x26, 0x4B,
+    0x37, 0x9E, 0x1F, 0x12, 0x4E, 0xDB, 0x59, 0xAD, 0xE7, 0xB2, 0x16, 0xD9, 0x36, 0xAF, 0x87, 0x31,
+    0xFD, 0xB9, 0x96, 0x43, 0xB4, 0x5E, 0x6D, 0x51, 0x90, 0x19, 0x43, 0x1C, 0x64, 0xE0, 0x9A, 0xCA,
+    0xB6, 0xF1, 0x53, 0x87, 0xDF, 0x7F, 0xA4, 0xE9, 0x57, 0xEC, 0x36, 0x8B, 0x48, 0xA7, 0x46, 0x58,
+    0xEC, 0xD6, 0x36, 0x27, 0x10, 0x5A, 0x5B, 0xBC, 0x6B, 0x89, 0x18, 0x92, 0x41, 0x42, 0x09, 0xC9,
+    0x23, 0x24, 0xE6, 0x76, 0xF1, 0xCD, 0xE3, 0x19, 0xCB, 0xD9, 0xD8, 0xEF, 0x9F, 0x70, 0xB9, 0x99,
+    0x03, 0xAB, 0x42, 0xB3, 0xBC, 0x84, 0x88, 0xE4, 0x89, 0xD4, 0x90, 0xED, 0x21, 0xC8, 0x73, 0x20,
+    0x38, 0x50, 0xC0, 0x85, 0x14, 0x01, 0x95, 0xA2, 0xE9, 0xF0, 0xDC, 0x49, 0xB6, 0xEB, 0x50, 0x82,
+    0xC9, 0x36, 0xBC, 0xA6, 0xEE, 0x5C, 0xED, 0x46, 0x86, 0x16, 0x60, 0x1C, 0x2F, 0x3F, 0xBD, 0x60,
+    0x17, 0x80, 0x4F, 0x3C, 0x02, 0x78, 0x3D, 0x89, 0xF8, 0x47, 0x78, 0xD7, 0x53, 0x43, 0x67, 0x2D,
+    0xF4, 0x8D, 0x1A, 0xF9, 0xD6, 0x77, 0x4F, 0x6C, 0xEA, 0x97, 0xE4, 0x44, 0xE7, 0x1E, 0x63, 0x1C,
+    0x2F, 0x9B, 0x3A, 0xEC, 0x52, 0x5B, 0x63, 0x00, 0x48, 0x6C, 0x80, 0xAD, 0xC5, 0xE9, 0x7A, 0x9C,
+    0xF6, 0xCE, 0x1E, 0xD2, 0x49, 0x23, 0x90, 0x06, 0x48, 0x65, 0x46, 0x65, 0x31, 0x34, 0xB1, 0x91,
+    0x98, 0xE4, 0x8D, 0x94, 0xE5, 0x33, 0x9E, 0xB8, 0x3D, 0x18, 0x11, 0x90, 0x75, 0x6E, 0x3C, 0x69,
+    0x7B, 0x24, 0x81, 0xAE, 0x22, 0x8D, 0xD7, 0x06, 0x39, 0xEC, 0xBC, 0xC9, 0x82, 0x5C, 0xAB, 0xF9,
+    0xBF, 0xEB, 0xF6, 0xCA, 0x0E, 0x42, 0xCA, 0xE0, 0x9D, 0xE0, 0xB6, 0x49, 0x7D, 0xCC, 0xCE, 0x58,
+    0x03, 0x62, 0x5F, 0x86, 0x88, 0x6D, 0xCC, 0xB6, 0xBA, 0xE4, 0x12, 0x91, 0x1C, 0xDA, 0x83, 0xD9,
+    0xED, 0x52, 0xE2, 0x0B, 0x2B, 0xC0, 0x80, 0xEC, 0x86, 0x49, 0x32, 0x2E, 0x14, 0x31, 0xDC, 0x03,
+    0x46, 0xA4, 0x60, 0xB6, 0x0E, 0xEA, 0xA3, 0xE2, 0xEF, 0x05, 0x43, 0x60, 0x88, 0xF6, 0xFA, 0x94,
+    0xF7, 0x71, 0x49, 0xB6, 0x6D, 0x32, 0xE1, 0xA0, 0x31, 0x8B, 0xAB, 0x57, 0x56, 0xE4, 0x2C, 0xAF,
+    0xBB, 0x28, 0xEB, 0xD0, 0x46, 0xCB, 0xB4, 0xAB, 0x16, 0x1B, 0x80, 0xAA, 0xB0, 0x78, 0xE7, 0x57,
+    0x58, 0xCA, 0x49, 0x77, 0x24, 0xF1, 0x93, 0x2C, 0xB2, 0x09, 0xD9, 0x9B, 0x74, 0x97, 0xB0, 0x48,
+    0x84, 0x8D, 0xCD, 0xC1, 0x51, 0x2C, 0x8D, 0xC0, 0x19, 0x63, 0x97, 0xDD, 0x81, 0x88, 0xF5, 0x3F,
+    0x17, 0xDE, 0x5C, 0xC6, 0xE9, 0x3C, 0x50, 0x00, 0xF2, 0x8D, 0x6A, 0xF2, 0x55, 0x2F, 0x99, 0x2F,
+    0x44, 0x45, 0x49, 0x58, 0xCB, 0x95, 0x1E, 0x71, 0x62, 0xC7, 0x08, 0x39, 0xE0, 0x61, 0x42, 0xA8,
+    0x00, 0x67, 0x86, 0xFC, 0x35, 0x2E, 0xA0, 0x5D, 0x6C, 0xA7, 0x8C, 0x5C, 0xAA, 0x35, 0xED, 0xB5,
+    0xA3, 0x0E, 0x75, 0x08, 0xE1, 0x52, 0x59, 0x6D, 0x76, 0xE4, 0x97, 0xE9, 0x85, 0x0A, 0x72, 0x32,
+    0x49, 0x18, 0xE6, 0x8E, 0xAD, 0x64, 0xB0, 0x4B, 0x22, 0x24, 0x92, 0x48, 0x11, 0xDA, 0xD9, 0x25,
+    0x74, 0x2A, 0x64, 0x58, 0x9C, 0x8C, 0xC9, 0x03, 0xF2, 0x0B, 0x63, 0xA1, 0xE4, 0x74, 0x35, 0x7B,
+    0xC3, 0xFE, 0x29, 0xBB, 0xB0, 0x0D, 0xF6, 0x18, 0xAD, 0x37, 0x31, 0x49, 0x0C, 0xF2, 0x26, 0x5A,
+    0x26, 0xB6, 0x62, 0xCB, 0xE4, 0xBE, 0x7A, 0x2C, 0xDB, 0x1F, 0x1D, 0x09, 0x55, 0xDD, 0x95, 0xC8,
+    0x39, 0x53, 0xCF, 0x2C, 0x8C, 0x5A, 0xE2, 0x59, 0x24, 0x90, 0x93, 0x2C, 0xD2, 0xB9, 0xC9, 0x96,
+    0x47, 0x3C, 0x99, 0x18, 0xF7, 0x63, 0x40, 0x88, 0xE8, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00,
+    0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00,
+    0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00,
+    0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0xC5, 0xA2, 0x8A, 0x2A,
+    0x0A, 0x0A, 0x28, 0xA2, 0x80, 0x3D, 0x67, 0xE2, 0xAF, 0xFC, 0xB1, 0xFF, 0x00, 0xB6, 0x9F, 0xFB,
+    0x25, 0x70, 0x15, 0xDF, 0xFC, 0x55, 0xFF, 0x00, 0x96, 0x3F, 0xF6, 0xD3, 0xFF, 0x00, 0x64, 0xAE,
+    0x02, 0x8A, 0x7B, 0x1E, 0x1F, 0x0F, 0x7F, 0x0E, 0x3F, 0x3F, 0xFD, 0x29, 0x85, 0x14, 0x51, 0x56,
+    0x7B, 0x41, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14,
+    0x50, 0x01, 0x45, 0x14, 0x50, 0x01, 0x45, 0x14, 0x50, 0x06, 0x2D, 0x14, 0x51, 0x50, 0x50, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51,
+    0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x01, 0xEB, 0x9F, 0x16, 0x7F, 0xE5,
+    0x8F, 0xFD, 0xB4, 0xFF, 0x00, 0xDA, 0x75, 0xE7, 0xB5, 0xE8, 0x5F, 0x16, 0x7F, 0xE5, 0x8F, 0xFD,
+    0xB4, 0xFF, 0x00, 0xDA, 0x75, 0xE7, 0xB5, 0xEA, 0xE6, 0xDF, 0x1B, 0xF9, 0x7E, 0x48, 0xE3, 0xC1,
+    0x7C, 0x2B, 0xE7, 0xF9, 0x85, 0x14, 0x51, 0x5E, 0x69, 0xD4, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51, 0x45, 0x00, 0x14, 0x51,
+    0x45, 0x00, 0x62, 0xD1, 0x45, 0x15, 0x05, 0x05, 0x14, 0x51, 0x40, 0x1E, 0xB9, 0xF1, 0x67, 0xFE,
+    0x58, 0xFF, 0x00, 0xDB, 0x4F, 0xFD, 0xA7, 0x5E, 0x7B, 0x5E, 0x85, 0xF1, 0x67, 0xFE, 0x58, 0xFF,
+    0x00, 0xDB, 0x4F, 0xFD, 0xA7, 0x5E, 0x7B, 0x5E, 0xAE, 0x6D, 0xF1, 0xBF, 0x97, 0xE4, 0x8E, 0x3C,
+    0x17, 0xC2, 0xBE, 0x7F, 0x98, 0x51, 0x45, 0x15, 0xE6, 0x9D, 0x41, 0x45, 0x5E, 0xD1, 0xB4, 0x3D,
+    0x42, 0xF5, 0xC2, 0x69, 0x56, 0x33, 0xDC, 0xCA, 0x79, 0xF2, 0xE3, 0x19, 0xD8, 0xA5, 0x80, 0xCC,
+    0xAD, 0xD8, 0x02, 0x46, 0x49, 0x20, 0x0E, 0xE6, 0xBD, 0x8B, 0xC3, 0x9F, 0xB3, 0x87, 0x53, 0xE2,
+    0x5D, 0x5F, 0xD5, 0x62, 0x82, 0xC7, 0xF0, 0xC1, 0x79, 0xE5, 0x5F, 0xA8, 0xC7, 0x97, 0xE8, 0x77,
+    0x76, 0xA6, 0x34, 0x8F, 0x0F, 0xA2, 0xBE, 0x8C, 0xFF, 0x00, 0x86, 0x73, 0xF0, 0xDF, 0xFD, 0x04,
+    0x35, 0xCF, 0xFB, 0xEE, 0x3F, 0xFE, 0x35, 0x59, 0x5E, 0x20, 0xFD, 0x9C, 0x2D, 0x8A, 0xFF, 0x00,
+    0xC5, 0x3B, 0xAB, 0xCE, 0xB2, 0x8F, 0xBD, 0x15, 0xEE, 0x0A, 0xCD, 0x92, 0x3A, 0x4B, 0x12, 0x8C,
+    0x6D, 0x19, 0xFE, 0x06, 0xCF, 0x1D, 0x3A, 0xD3, 0xB0, 0xEC, 0x78, 0x45, 0x15, 0xB3, 0xE2, 0x8F,
+    0x09, 0x6A, 0x9A, 0x64, 0x85, 0x35, 0x6B, 0x37, 0x8C, 0xE4, 0xA5, 0xBD, 0xC0, 0x07, 0x65, 0xE2,
+    0xA6, 0x39, 0xB5, 0x94, 0x8E, 0x46, 0x08, 0xF7, 0x1D, 0x18, 0x03, 0xC5, 0x63, 0x52, 0x24, 0x28,
+    0xA2, 0x8A, 0x40, 0x6A, 0xF8, 0x56, 0xFA, 0x18, 0x2E, 0x23, 0x6B, 0xB9, 0x36, 0x44, 0x1B, 0x65,
+    0xCB, 0x90, 0x48, 0x58, 0x64, 0x18, 0x3F, 0x69, 0x88, 0x7D, 0xE4, 0xDA, 0x7E, 0x65, 0x18, 0x2E,
+    0xB9, 0x5C, 0x8C, 0xE4, 0x7A, 0x75, 0x87, 0x8F, 0xEC, 0x2D, 0xA5, 0x72, 0x96, 0xF6, 0x3F, 0x68,
+    0x9B, 0xC9, 0xD4, 0x5A, 0x35, 0x78, 0xCD, 0xBD, 0xE5, 0xE4, 0x37, 0x13, 0xB3, 0x19, 0xAE, 0x4E,
+    0x59, 0x3E, 0xD2, 0x5D, 0x5D, 0x3C, 0xC0, 0x1E, 0x27, 0xC0, 0x90, 0xAC, 0x6B, 0x8A, 0xF1, 0xCA,
+    0x28, 0x19, 0xEB, 0x1A, 0x87, 0x89, 0x34, 0xB9, 0x6D, 0xEE, 0x22, 0xBB, 0x9E, 0x37, 0x24, 0x4F,
+    0x7B, 0xE1, 0xE5, 0x92, 0xE0, 0x3B, 0x42, 0xCF, 0x7D, 0x29, 0x29, 0x24, 0x91, 0x6D, 0xC9, 0x60,
+    0x81, 0xCE, 0xFB, 0xC9, 0x83, 0x10, 0x8C, 0x8A, 0xE7, 0x0B, 0x47, 0x8E, 0x35, 0x0D, 0x3D, 0x1D,
+    0x3E, 0xC1, 0xAC, 0x69, 0xB3, 0xDD, 0x1B, 0x83, 0x35, 0xD2, 0x5A, 0x94, 0xDB, 0xA9, 0xD8, 0xDC,
+    0x46, 0x17, 0x7C, 0xF7, 0x8C, 0x5E, 0x35, 0x69, 0xD0, 0x15, 0x94, 0x79, 0x71, 0xAB, 0x93, 0x97,
+    0x8C, 0xA2, 0xAB, 0x37, 0x93, 0xD1, 0x40, 0x1E, 0x8D, 0xA5, 0x6B, 0xF6, 0x48, 0xF2, 0xB6, 0x99,
+    0x77, 0x63, 0x67, 0x66, 0xEA, 0x1F, 0x5E, 0xB5, 0x6C, 0xA9, 0x95, 0xE4, 0xBA, 0x94, 0x04, 0x82,
+    0xC7, 0x73, 0x82, 0x08, 0x65, 0x73, 0xB6, 0x29, 0x56, 0x38, 0xC6, 0xC6, 0x12, 0x7C, 0xEB, 0x35,
+    0xB9, 0x6C, 0xF4, 0x48, 0xAC, 0x64, 0x8F, 0x55, 0xF1, 0x5C, 0x77, 0x71, 0xA9, 0x9F, 0xFE, 0x11,
+    0xDB, 0x68, 0x64, 0xDC, 0x62, 0xD4, 0xAD, 0xE6, 0x60, 0xAF, 0xE4, 0xC6, 0xC7, 0x0B, 0x7E, 0x80,
+    0xF0, 0x63, 0x91, 0x40, 0xCB, 0x2C, 0x88, 0x5F, 0x07, 0xCB, 0xA8, 0xA0, 0x0F, 0x4A, 0xD6, 0x7C,
+    0x77, 0x68, 0x42, 0x0D, 0x19, 0x63, 0x96, 0xEE, 0x31, 0x24, 0x33, 0xDE, 0xDC, 0x36, 0xE8, 0xF5,
+    0x4B, 0x29, 0x2D, 0xA6, 0xF9, 0xA6, 0xF3, 0x56, 0x00, 0x5E, 0x36, 0x9E, 0x5F, 0xBD, 0x6A, 0xCC,
+    0xE4, 0xFD, 0xE6, 0xC9, 0x0F, 0x6F, 0x49, 0xF1, 0xB5, 0xAC, 0x86, 0x57, 0xD5, 0xA5, 0x83, 0x50,
+    0x46, 0x5B, 0x44, 0xBE, 0xB2, 0xBE, 0x9D, 0xC2, 0x47, 0x0C, 0x4E, 0x7E, 0x4B, 0x44, 0xF9, 0x99,
+    0xFE, 0xCD, 0x36, 0xC7, 0x24, 0xC1, 0x21, 0xDA, 0x1C, 0x33, 0x39, 0x6D, 0xF2, 0x79, 0x55, 0x14,
+    0x01, 0xEB, 0x17, 0x3A, 0xDE, 0x96, 0xF6, 0xD2, 0x2E, 0xA1, 0xA8, 0xE9, 0xB7, 0xE4, 0xA5, 0xE6,
+    0xB1, 0x61, 0xAA, 0xDC, 0xE0, 0xB8, 0xD5, 0x67, 0xBB, 0xD8, 0x12, 0xCF, 0x4E, 0x42, 0x0A, 0x0B,
+    0xA8, 0x4F, 0x98, 0x01, 0x04, 0x06, 0x3B, 0xF1, 0xF2, 0x1A, 0x60, 0xF1, 0x8F, 0x87, 0x98, 0x45,
+    0x25, 0xB6, 0x9B, 0x9B, 0x85, 0x8D, 0xD3, 0x58, 0x95, 0x8C, 0x21, 0xEF, 0x9E, 0x6B, 0x4B, 0xC1,
+    0x8B, 0xC3, 0x70, 0x0E, 0xE7, 0x1F, 0x29, 0x2E, 0x15, 0x96, 0x52, 0xDF, 0xBC, 0x4D, 0xDB, 0x23,
+    0xAF, 0x2A, 0xA2, 0x80, 0xB9, 0xD1, 0xF8, 0xEB, 0x5C, 0xB5, 0xBC, 0x95, 0x0D, 0x87, 0x11, 0x24,
+    0x51, 0xD8, 0x45, 0x18, 0x0F, 0x88, 0x96, 0x04, 0xC0, 0x08, 0xB2, 0xBB, 0xE3, 0x0B, 0x8C, 0x80,
+    0x70, 0x0E, 0x40, 0x2F, 0xFE, 0xB1, 0xFB, 0x2D, 0x07, 0xC7, 0x13, 0x2E, 0x96, 0xF6, 0xEB, 0x75,
+    0xA5, 0x5B, 0xE2, 0x29, 0x0C, 0x39, 0x94, 0x79, 0xB3, 0x46, 0xF7, 0x12, 0x16, 0xDB, 0x0B, 0xA8,
+    0x5F, 0xDF, 0x86, 0xD9, 0xB7, 0xCD, 0x59, 0x40, 0x05, 0xD5, 0x5B, 0x2A, 0x2B, 0xCA, 0xA8, 0xA0,
+    0x0F, 0x63, 0xD5, 0x75, 0xCB, 0x0B, 0x99, 0x21, 0x6B, 0xFD, 0x7E, 0xC4, 0xDB, 0x99, 0x65, 0x94,
+    0x7F, 0x67, 0x08, 0xD4, 0x32, 0x4F, 0x0B, 0x81, 0xE6, 0x5B, 0xDE, 0xB1, 0x74, 0x37, 0xB2, 0xAE,
+    0x24, 0x56, 0x4F, 0xB3, 0x30, 0x60, 0xCE, 0xD9, 0xDC, 0xCD, 0xC6, 0xFC, 0x53, 0xBD, 0xD1, 0x65,
+    0xB9, 0x1F, 0xF0, 0x8E, 0xCB, 0x3B, 0xC2, 0xAA, 0xD0, 0x5C, 0x34, 0x92, 0x3B, 0xEE, 0xBB, 0x17,
+    0x52, 0x92, 0x62, 0x9A, 0x46, 0x6C, 0x89, 0xF2, 0x1C, 0x10, 0xD8, 0x39, 0xC9, 0xF9, 0x89, 0xAE,
+    0x3A, 0x8A, 0x00, 0xEF, 0x34, 0xCD, 0x4E, 0x27, 0xD3, 0xCA, 0xDC, 0xF8, 0x8E, 0x48, 0x5D, 0x04,
+    0x96, 0xDA, 0x65, 0xAC, 0x6D, 0xB5, 0xAD, 0xA0, 0x90, 0x33, 0x48, 0x93, 0x46, 0x9C, 0xBA, 0x6A,
+    0x32, 0x98, 0x17, 0x92, 0x08, 0x3B, 0x88, 0x1B, 0x11, 0xB7, 0x6E, 0x7C, 0x4F, 0xD6, 0x34, 0x89,
+    0x2C, 0xD1, 0x6D, 0xB5, 0x4B, 0x49, 0xAF, 0xCC, 0x88, 0xDA, 0xE5, 0xBD, 0xB1, 0x5F, 0x2E, 0xE2,
+    0xF2, 0xDA, 0x09, 0x77, 0xCF, 0x1F, 0x92, 0x31, 0x9B, 0xD6, 0x95, 0x4E, 0x73, 0x96, 0x00, 0x02,
+    0x03, 0x2B, 0x01, 0xE4, 0xF4, 0x50, 0x07, 0x79, 0xF0, 0xBB, 0xC5, 0x71, 0x69, 0xC2, 0x73, 0x73,
+    0x6B, 0x69, 0x34, 0x2E, 0x23, 0xB5, 0xBC, 0x37, 0x12, 0xE1, 0x56, 0x06, 0x66, 0xC8, 0x7D, 0x3F,
+    0x39, 0x71, 0x2E, 0x70, 0x4A, 0xA3, 0x98, 0xC6, 0x4E, 0xD6, 0x04, 0xAB, 0x75, 0x57, 0xDE, 0x34,
+    0xB4, 0x6B, 0x19, 0xD4, 0xEA, 0x9A, 0x6E, 0x64, 0x7B, 0x89, 0xEC, 0xAE, 0xFA, 0xB9, 0xB9, 0x9E,
+    0x69, 0xF3, 0xF6, 0x6D, 0x39, 0x9A, 0x46, 0x45, 0xD4, 0x20, 0x65, 0x45, 0xC8, 0x4D, 0xB9, 0x76,
+    0x76, 0xC9, 0x5F, 0x33, 0xC6, 0x68, 0xA0, 0x0E, 0x9F, 0xE1, 0xB5, 0xD4, 0x11, 0x5E, 0x21, 0xBB,
+    0x6B, 0x41, 0x1E, 0xC9, 0x91, 0x85, 0xC6, 0xDD, 0x92, 0x34, 0x96, 0x72, 0x80, 0x26, 0x59, 0x1D,
+    0x01, 0x12, 0x31, 0x03, 0x06, 0x45, 0x07, 0xA1, 0x23, 0xAD, 0x7A, 0x6D, 0xFD, 0xEF, 0x86, 0x2E,
+    0xA6, 0x91, 0xA7, 0xD7, 0x23, 0x36, 0x13, 0xDB, 0xDA, 0xD9, 0x5F, 0x58, 0xBC, 0xE8, 0x24, 0x8A,
+    0x69, 0xA6, 0x21, 0x5E, 0x59, 0x32, 0x77, 0x3E, 0x98, 0x51, 0x0B, 0x6F, 0x67, 0x60, 0x18, 0x92,
+    0xC5, 0x40, 0x46, 0xF0, 0xBA, 0x28, 0x03, 0xD5, 0x62, 0xF1, 0x67, 0x87, 0x04, 0x12, 0xA3, 0xAF,
+    0xDA, 0x6E, 0x07, 0xDB, 0x5B, 0x42, 0x9E, 0x26, 0x64, 0x8E, 0xC5, 0x35, 0x18, 0xDC, 0x62, 0xCE,
+    0xCE, 0x5D, 0xA1, 0x51, 0xE3, 0x5C, 0xED, 0x2E, 0xEC, 0x09, 0x1B, 0x37, 0x33, 0x30, 0x4D, 0x8D,
+    0x5B, 0xC5, 0xBE, 0x1B, 0xB7, 0x99, 0x46, 0x97, 0x0E, 0x9B, 0x74, 0xC6, 0x69, 0x65, 0xBC, 0x1B,
+    0xC0, 0x8B, 0x5B, 0xB6, 0x36, 0x52, 0x46, 0x0E, 0xA7, 0x77, 0x20, 0x90, 0x86, 0x2E, 0xEC, 0x9C,
+    0xB6, 0xC7, 0x3B, 0xA5, 0x93, 0x0A, 0xE1, 0xAB, 0xC4, 0xA8, 0xA0, 0x2E, 0x7B, 0x8D, 0x8F, 0xC4,
+    0x3D, 0x26, 0xC1, 0xDC, 0x41, 0x1D, 0x8C, 0xD2, 0xB4, 0x56, 0xB6, 0x76, 0x70, 0x5A, 0x4B, 0xB2,
+    0x39, 0x2E, 0xF4, 0xAB, 0xA9, 0x10, 0x8B, 0x8D, 0x44, 0xBB, 0x70, 0xCB, 0x87, 0x52, 0xF8, 0x0D,
+    0x16, 0x04, 0x9F, 0xED, 0x79, 0x07, 0x89, 0x64, 0x81, 0xAE, 0x66, 0x36, 0x70, 0xC7, 0x14, 0x26,
+    0x49, 0x1E, 0xD6, 0x14, 0xDB, 0x88, 0x61, 0x32, 0x9C, 0x08, 0xCC, 0x44, 0x8C, 0x2A, 0xFF, 0x00,
+    0x75, 0x8A, 0xFA, 0x12, 0x2B, 0x36, 0x8A, 0x00, 0xF6, 0xAB, 0xEF, 0x1F, 0xD9, 0xDE, 0x2C, 0x06,
+    0xE6, 0xEA, 0xC7, 0xCB, 0x12, 0xBC, 0xD7, 0xBA, 0x75, 0xBE, 0xC4, 0x8E, 0xE2, 0xF1, 0x61, 0x9F,
+    0x86, 0x92, 0x63, 0xBF, 0x66, 0xAD, 0x2B, 0x7C, 0xE5, 0xA0, 0xF2, 0xF6, 0xB8, 0x56, 0x65, 0x65,
+    0x72, 0xD3, 0xAE, 0xB7, 0xA3, 0x5A, 0x4F, 0x22, 0xC5, 0xA9, 0xE9, 0x42, 0xDD, 0xE3, 0x4B, 0x99,
+    0xAE, 0xE2, 0x60, 0x4C, 0x9A, 0xAD, 0x8C, 0x97, 0x4E, 0x1E, 0x6B, 0xCF, 0xB4, 0x4C, 0xD9, 0x92,
+    0xE1, 0x43, 0x8C, 0xC5, 0x70, 0x70, 0x52, 0x37, 0x5C, 0xE3, 0x77, 0x87, 0x51, 0x40, 0x5C, 0xF5,
+    0xFD, 0x47, 0x5F, 0xF0, 0xFC, 0x96, 0xB2, 0x8D, 0x63, 0x51, 0xBB, 0x9E, 0x72, 0x6E, 0x86, 0x92,
+    0x92, 0xCC, 0x98, 0x57, 0x9A, 0xE2, 0x56, 0x05, 0x13, 0x4E, 0xCE, 0x4C, 0xB7, 0x0B, 0x11, 0x22,
+    0x5C, 0x46, 0x4F, 0xCD, 0x11, 0x2A, 0x30, 0x4F, 0x13, 0xF8, 0xCB, 0x49, 0x96, 0x45, 0x0D, 0x1D,
+    0xA6, 0x3C, 0xCF, 0xED, 0x09, 0x65, 0xD3, 0xFC, 0x85, 0x66, 0x87, 0xEC, 0x8E, 0x27, 0x33, 0xF9,
+    0x81, 0xD4, 0xB5, 0xDC, 0xF9, 0x1B, 0x4C, 0xB2, 0x2C, 0xCA, 0xA0, 0x74, 0x2A, 0xF2, 0x79, 0x05,
+    0x14, 0x05, 0xCF, 0x55, 0xB2, 0xD6, 0x34, 0x2B, 0x6B, 0xA9, 0x62, 0xD1, 0x64, 0x82, 0x3B, 0x69,
+    0x20, 0x97, 0x46, 0xD5, 0x96, 0x39, 0x8A, 0xC3, 0xA9, 0x5C, 0xAC, 0x53, 0x9D, 0xF6, 0x97, 0x97,
+    0x32, 0x1D, 0xA5, 0xD8, 0x46, 0xAB, 0xB9, 0x64, 0x51, 0xB9, 0xB0, 0x48, 0xC3, 0x3D, 0xAB, 0x1F,
+    0x1A, 0xF8, 0x7C, 0x69, 0x92, 0xC3, 0x7F, 0x0C, 0x77, 0x13, 0x14, 0x9F, 0x52, 0xD3, 0x19, 0x82,
+    0x61, 0x27, 0xB8, 0xB8, 0x74, 0x5F, 0x2E, 0xD0, 0xB6, 0x23, 0x78, 0xF7, 0x6F, 0xD8, 0x80, 0x85,
+    0x4C, 0xBA, 0x92, 0x49, 0x15, 0xE4, 0x14, 0x50, 0x17, 0x3D, 0xC7, 0x5E, 0xD5, 0xB4, 0x18, 0x50,
+    0x79, 0x7A, 0xC4, 0x11, 0xFE, 0xFC, 0x69, 0xFF, 0x00, 0x6E, 0x49, 0x22, 0x9E, 0x4B, 0x8D, 0x39,
+    0x74, 0xD9, 0x97, 0xCE, 0xBE, 0xB2, 0xDF, 0x22, 0x91, 0x35, 0xD4, 0xD2, 0x33, 0xE1, 0x11, 0x98,
+    0x12, 0x48, 0xDE, 0x73, 0x5E, 0x63, 0xE3, 0xCF, 0x12, 0x43, 0xA8, 0xCF, 0xE6, 0x40, 0xD7, 0xD9,
+    0x2B, 0xB2, 0xE1, 0x27, 0x62, 0x44, 0x73, 0x09, 0x1B, 0xFE, 0x3C, 0x91, 0x99, 0xB6, 0xA4, 0x8A,
+    0x43, 0x6D, 0xDE, 0xC1, 0x49, 0x20, 0x12, 0x00, 0x35, 0xCE, 0x51, 0x40, 0x1D, 0xFE, 0x93, 0x7F,
+    0xA4, 0x9B, 0x2D, 0x9A, 0xAD, 0xD4, 0x12, 0x4A, 0xB1, 0x5C, 0x5E, 0x68, 0x91, 0x16, 0xDC, 0xF6,
+    0x97, 0x97, 0x0F, 0x8C, 0x44, 0x5C, 0xEC, 0x50, 0xC9, 0x19, 0x62, 0xAC, 0xBB, 0xC1, 0x21, 0xE1,
+    0x62, 0xEE, 0x15, 0x70, 0x3C, 0x07, 0x24, 0x0B, 0x75, 0x19, 0xBD, 0xD4, 0xE3, 0xB1, 0x83, 0x12,
+    0x7D, 0xBA, 0xED, 0x91, 0x58, 0x0B, 0x6F, 0xB3, 0xBE, 0xE5, 0x10, 0xC8, 0x18, 0x13, 0x70, 0x99,
+    0x51, 0x95, 0x6E, 0x4F, 0x00, 0x9E, 0x2B, 0x9F, 0xA2, 0x80, 0x3D, 0xC6, 0xDB, 0xE2, 0x56, 0x81,
+    0xA6, 0x4F, 0x2F, 0xD9, 0x35, 0x4B, 0xEB, 0x90, 0x3C, 0x8B, 0x56, 0x30, 0x20, 0x68, 0xEE, 0xFC,
+    0x99, 0x2E, 0x4B, 0xAE, 0x9F, 0x14, 0x8E, 0x02, 0xC5, 0x02, 0xC8, 0xAA, 0x81, 0x64, 0x18, 0x20,
+    0x11, 0xBD, 0x77, 0x16, 0x80, 0xF8, 0xFB, 0x49, 0xFB, 0x1B, 0xA4, 0x7A, 0xB4, 0xE1, 0x9E, 0x3B,
+    0xF9, 0xAC, 0xB4, 0xFF, 0x00, 0xE2, 0xF2, 0x2F, 0x27, 0x7D, 0xAB, 0xAB, 0x5C, 0x4B, 0x2B, 0x02,
+    0xF8, 0x2C, 0xFF, 0x00, 0xF3, 0xD0, 0xF0, 0x14, 0xE4, 0xE2, 0x5F, 0x15, 0xA2, 0x80, 0xB9, 0xED,
+    0xB7, 0xD7, 0xFA, 0x5B, 0x35, 0xAB, 0x6A, 0x9E, 0x21, 0xD1, 0xAE, 0xAE, 0xB3, 0x1C, 0x77, 0x60,
+    0xCA, 0x3C, 0xBB, 0x26, 0xD4, 0x60, 0xB9, 0x32, 0xFD, 0xB2, 0xDE, 0xD3, 0x08, 0xC1, 0xEE, 0x88,
+    0xDC, 0x43, 0x00, 0xEB, 0xB5, 0x65, 0xDA, 0x09, 0x91, 0xF8, 0xAF, 0x8B, 0x9A, 0xA5, 0xBD, 0xD5,
+    0xC4, 0x6F, 0x6A, 0x60, 0x4D, 0xD1, 0x09, 0x2E, 0xAC, 0xE2, 0x92, 0x27, 0x5B, 0x0B, 0xA6, 0x9E,
+    0x52, 0xCA, 0x93, 0xDB, 0x64, 0x1F, 0x31, 0xC9, 0x7C, 0x92, 0x58, 0xEE, 0xC9, 0xC7, 0x41, 0xC3,
+    0xD1, 0x40, 0x05, 0x14, 0x51, 0x40, 0x82, 0x8A, 0x28, 0xA0, 0x02, 0x8A, 0x28, 0xA0, 0x0C, 0x5A,
+    0x28, 0xA2, 0xA0, 0xA0, 0xA2, 0x8A, 0x28, 0x03, 0xD7, 0x3E, 0x2C, 0xFF, 0x00, 0xCB, 0x1F, 0xFB,
+    0x69, 0xFF, 0x00, 0xB4, 0xEB, 0xCF, 0x6B, 0xD0, 0xBE, 0x2C, 0xFF, 0x00, 0xCB, 0x1F, 0xFB, 0x69,
+    0xFF, 0x00, 0xB4, 0xEB, 0xCF, 0x6B, 0xD5, 0xCD, 0xBE, 0x37, 0xF2, 0xFC, 0x91, 0xC7, 0x82, 0xF8,
+    0x57, 0xCF, 0xF3, 0x0A, 0xBD, 0xA1, 0xE8, 0xD7, 0x37, 0xB3, 0x24, 0x76, 0x29, 0xBA, 0x57, 0x61,
+    0x04, 0x5C, 0x1C, 0x26, 0xE3, 0xC9, 0x93, 0x68, 0x3C, 0x46, 0x32, 0x49, 0xC1, 0xC0, 0xE6, 0xA8,
+    0xD7, 0xB8, 0x7E, 0xCE, 0x1E, 0x1C, 0xFF, 0x00, 0x5D, 0x70, 0xF2, 0x7F, 0xD4, 0x22, 0xDA, 0x30,
+    0x7F, 0xDC, 0x66, 0x32, 0xAE, 0x3F, 0xDC, 0xC7, 0xCD, 0xEB, 0x91, 0xD2, 0xBC, 0xE4, 0x75, 0xA3,
+    0xD3, 0x3C, 0x0D, 0xE0, 0x6D, 0x3F, 0x47, 0x87, 0x65, 0x88, 0xDF, 0x21, 0xC3, 0xEA, 0x37, 0xCC,
+    0x3E, 0x6B, 0xC9, 0x80, 0xFE, 0x21, 0xD8, 0x26, 0x4E, 0x06, 0x70, 0x3D, 0xC9, 0x24, 0xF4, 0x74,
+    0x51, 0x56, 0x68, 0x14, 0x51, 0x45, 0x00, 0x65, 0x78, 0x9B, 0xC3, 0x3A, 0x7E, 0xA5, 0x0B, 0x47,
+    0xAA, 0xC1, 0xBE, 0x33, 0xF3, 0x23, 0x8F, 0xBD, 0x6D, 0x30, 0x1C, 0x35, 0xBB, 0xF6, 0x29, 0x9F,
+    0xA7, 0x62, 0x08, 0x24, 0x57, 0xCA, 0x3E, 0x34, 0xF0, 0x9D, 0xCE, 0x95, 0x70, 0xF1, 0x5D, 0xB7,
+    0x99, 0x8C, 0x49, 0x6D, 0x72, 0x14, 0x81, 0x75, 0x6E, 0xE3, 0x86, 0x40, 0x7F, 0x23, 0x82, 0x40,
+    0x20, 0x8C, 0x9C, 0x57, 0xD8, 0x75, 0xE5, 0x9F, 0xB4, 0x27, 0x87, 0x3C, 0xFB, 0x45, 0x95, 0x24,
+    0xC3, 0x40, 0xDF, 0x3A, 0x13, 0xC4, 0x96, 0xF7, 0x6C, 0xAA, 0x76, 0x8C, 0x1E, 0x44, 0x81, 0x3B,
+    0x81, 0x8C, 0xF5, 0x38, 0xA4, 0xC9, 0x92, 0x3E, 0x73, 0xA2, 0x8A, 0x2A, 0x08, 0x3B, 0x59, 0xFE,
+    0x1C, 0xAC, 0x33, 0x22, 0xDF, 0xEA, 0x92, 0x43, 0x6E, 0xF2, 0x3E, 0x9F, 0x0D, 0xE7, 0x92, 0x4B,
+    0xB3, 0x2C, 0x4A, 0x57, 0x1A, 0x56, 0xE1, 0x26, 0xE9, 0x4B, 0x00, 0x41, 0x88, 0x01, 0x95, 0x21,
+    0x98, 0x30, 0x35, 0x6A, 0xD3, 0xE1, 0x6A, 0x79, 0xCF, 0x1E, 0xA7, 0xA8, 0xDF, 0x69, 0xEF, 0xF2,
+    0xAE, 0x8D, 0x1C, 0xF6, 0xEB, 0xBB, 0x54, 0x9A, 0x43, 0x28, 0xDB, 0xB8, 0x4D, 0xB1, 0x4C, 0x92,
+    0x44, 0xC1, 0x37, 0x4D, 0x89, 0x3A, 0xA9, 0xC5, 0x65, 0x59, 0xFC, 0x47, 0xD4, 0xA0, 0x72, 0xF6,
+    0x96, 0xF6, 0x31, 0xCF, 0xE6, 0x3D, 0xFA, 0xDD, 0x05, 0x6C, 0x89, 0x66, 0xB6, 0x64, 0xFD, 0xE8,
+    0x2E, 0x43, 0x79, 0x2A, 0xC5, 0x81, 0x70, 0xEF, 0xB8, 0x92, 0xCC, 0x77, 0x36, 0xE9, 0xFC, 0x3D,
+    0xF1, 0x5F, 0x5F, 0xB0, 0x0F, 0xF6, 0x59, 0xA0, 0x95, 0x9A, 0x38, 0xF4, 0xE8, 0xA6, 0x99, 0x49,
+    0x36, 0x16, 0xF6, 0x48, 0xC1, 0x45, 0x9A, 0x02, 0x00, 0xD8, 0x18, 0x9E, 0x55, 0x81, 0x3C, 0x90,
+    0x49, 0x39, 0x06, 0x32, 0xDF, 0xC0, 0x6A, 0x6D, 0x5E, 0x69, 0xAF, 0x6E, 0xD1, 0xE3, 0x26, 0xD2,
+    0xFA, 0xC7, 0xEC, 0xE4, 0x7D, 0x8A, 0xF9, 0x3C, 0xDF, 0x96, 0xF2, 0xE2, 0x66, 0x40, 0x06, 0xD4,
+    0x4E, 0x85, 0xDB, 0x73, 0x05, 0xD9, 0x9D, 0xBB, 0xAF, 0x5F, 0xFC, 0x2E, 0x5B, 0x59, 0x21, 0x1A,
+    0x9E, 0xB7, 0x1C, 0x11, 0x4A, 0xEF, 0x65, 0x0B, 0xA4, 0x46, 0x47, 0x13, 0x41, 0x9E, 0x12, 0xDE,
+    0xDD, 0x9C, 0x12, 0x92, 0x15, 0x8D, 0x87, 0x99, 0xB8, 0x39, 0x21, 0x43, 0x28, 0xDC, 0x71, 0xA6,
+    0xF1, 0xC5, 0xCB, 0x33, 0xB2, 0xE9, 0xBA, 0x54, 0x72, 0xC9, 0xF6, 0x8F, 0xB7, 0x5C, 0x2C, 0x64,
+    0xB5, 0xC7, 0xF6, 0xB0, 0xC3, 0x7C, 0xEE, 0xC7, 0x1E, 0x42, 0xF0, 0xBB, 0x4A, 0xE3, 0x9C, 0xE7,
+    0x2D, 0x9B, 0x7A, 0x8F, 0xC4, 0xAB, 0xE9, 0x86, 0x23, 0xD2, 0xF4, 0x6B, 0x50, 0x43, 0xAD, 0xDB,
+    0x41, 0x19, 0xDD, 0x7F, 0x25, 0xC5, 0xB4, 0x89, 0xBA, 0xFA, 0xE1, 0xDD, 0x99, 0x9A, 0x34, 0x95,
+    0xC8, 0x25, 0xF9, 0x24, 0x96, 0xCD, 0x00, 0x5E, 0xB1, 0xF8, 0x5E, 0x1D, 0xCA, 0x5E, 0x6A, 0x92,
+    0x59, 0x5C, 0x87, 0x83, 0x4F, 0x7B, 0x59, 0xE3, 0x4C, 0x9B, 0xCB, 0xD9, 0x24, 0x0C, 0x15, 0xD6,
+    0x62, 0x31, 0x14, 0x51, 0x33, 0xAE, 0x76, 0x99, 0x06, 0x36, 0x81, 0xB9, 0x77, 0x73, 0x83, 0x42,
+    0xB7, 0x6B, 0x73, 0x24, 0x1A, 0xA4, 0x72, 0xC8, 0xA0, 0x7D, 0xB7, 0x4E, 0x44, 0x6D, 0xF6, 0x72,
+    0x49, 0x31, 0x00, 0xCC, 0xC7, 0x03, 0x61, 0x40, 0x3E, 0x60, 0x5B, 0x0C, 0x55, 0x0A, 0x8C, 0xE6,
+    0xA7, 0xBA, 0xF1, 0xC6, 0xA8, 0xFB, 0x36, 0x4B, 0x1C, 0x3B, 0x12, 0x2B, 0x58, 0x76, 0x02, 0x70,
+    0xD6, 0x10, 0xBA, 0xA3, 0xC6, 0x64, 0x2D, 0xB5, 0xA3, 0x49, 0x18, 0xFC, 0xBB, 0x00, 0x6F, 0x98,
+    0x00, 0xDC, 0xD5, 0xAD, 0x3B, 0xE2, 0x3E, 0xA5, 0x04, 0x12, 0x44, 0x2D, 0xEC, 0x65, 0xF3, 0x77,
+    0xFD, 0xBA, 0xFD, 0xD5, 0x84, 0xB7, 0x1F, 0x69, 0x8D, 0xC1, 0xFB, 0x4C, 0xF1, 0xBA, 0xEE, 0xDB,
+    0xE6, 0x31, 0x1B, 0xC3, 0xE0, 0x9C, 0xF6, 0x18, 0x00, 0xD5, 0x5F, 0x83, 0xBA, 0x9A, 0xCF, 0x0A,
+    0x5D, 0xCB, 0xE4, 0xC7, 0x2C, 0x8F, 0x67, 0x69, 0x26, 0x17, 0xCC, 0x55, 0xB7, 0x8F, 0x25, 0xA4,
+    0xB3, 0x79, 0x17, 0x84, 0xE4, 0x12, 0xAE, 0xC3, 0x8C, 0xA9, 0x60, 0x50, 0xBB, 0x2F, 0xBE, 0x17,
+    0x2C, 0x17, 0x32, 0xC1, 0x36, 0xB7, 0x1C, 0xB7, 0x6B, 0x1B, 0x6A, 0x3A, 0x44, 0x16, 0xD1, 0x17,
+    0x3A, 0x83, 0x44, 0x8E, 0xC2, 0x3B, 0x85, 0x0C, 0x0A, 0x3C, 0x91, 0xA8, 0x60, 0x30, 0xE3, 0x07,
+    0x82, 0x78, 0xCE, 0x6E, 0xB9, 0xF1, 0x1F, 0x52, 0xBB, 0x8F, 0x64, 0x96, 0xF6, 0x36, 0xC4, 0xB7,
+    0xDA, 0xAF, 0x2E, 0xAD, 0x55, 0x91, 0xAF, 0xAE, 0x0C, 0x52, 0x2B, 0x35, 0xC2, 0x2B, 0xED, 0xCD,
+    0xD2, 0x48, 0xDB, 0x88, 0x40, 0x5B, 0x80, 0x78, 0x00, 0x55, 0x18, 0xFC, 0x5F, 0x78, 0x0E, 0x67,
+    0x8A, 0x0B, 0x91, 0xBA, 0x3B, 0x89, 0x61, 0xBA, 0x2E, 0xEB, 0x2B, 0x5B, 0x3B, 0x31, 0xDE, 0x92,
+    0xB9, 0xFF, 0x00, 0x8F, 0xA9, 0x59, 0x99, 0xBA, 0x1E, 0x58, 0x29, 0x55, 0x66, 0x04, 0x03, 0x57,
+    0x4E, 0xF8, 0x73, 0x24, 0xB6, 0x9E, 0x7C, 0xDA, 0x94, 0x16, 0xD1, 0x79, 0x72, 0xDE, 0xC6, 0x92,
+    0xED, 0xCC, 0xFF, 0x00, 0x63, 0x62, 0xB8, 0x80, 0x79, 0x99, 0x3E, 0x6C, 0xC6, 0x35, 0x1F, 0x28,
+    0xE4, 0x9C, 0xE3, 0x09, 0xE6, 0x69, 0x6A, 0x5F, 0x0B, 0x2D, 0x2D, 0xDA, 0x00, 0xFE, 0x22, 0x92,
+    0x51, 0x33, 0xB4, 0x50, 0xCD, 0x15, 0xBF, 0x06, 0xD9, 0x4B, 0xED, 0x6B, 0x61, 0x24, 0x8A, 0x5C,
+    0xCB, 0xB4, 0x70, 0x8A, 0xDD, 0x46, 0xD2, 0xDB, 0xA3, 0xF3, 0x33, 0x62, 0xF8, 0xA3, 0xA9, 0x47,
+    0x0C, 0x91, 0xDA, 0xD8, 0x69, 0x51, 0x2C, 0xBE, 0x60, 0xD5, 0x2E, 0x42, 0x31, 0x92, 0xF9, 0x2E,
+    0xC4, 0xBC, 0x5D, 0x5C, 0xBB, 0x92, 0x7C, 0x93, 0x21, 0xDA, 0x49, 0x2D, 0xC0, 0xC9, 0x23, 0x39,
+    0xCE, 0xBC, 0xF1, 0xDE, 0xB7, 0x32, 0x81, 0x3D, 0xFC, 0x84, 0x66, 0x69, 0x1B, 0x1D, 0x24, 0x3A,
+    0x88, 0x7D, 0xFB, 0xA0, 0x1F, 0x2E, 0x4F, 0x99, 0x26, 0x08, 0x40, 0xC3, 0x71, 0x19, 0xC0, 0x50,
+    0x00, 0x2A, 0x78, 0x8F, 0x42, 0xFB, 0x0B, 0x84, 0x37, 0x90, 0x5C, 0xB6, 0xD1, 0x34, 0x93, 0x43,
+    0xF7, 0x0E, 0xF6, 0x38, 0xF2, 0x18, 0xF2, 0x43, 0xA0, 0x04, 0x12, 0x8B, 0x90, 0x72, 0xA0, 0xA1,
+    0x56, 0x6B, 0x70, 0xF8, 0x36, 0xEE, 0x4B, 0x6F, 0x3E, 0xDA, 0x48, 0xDA, 0x00, 0x0F, 0xDB, 0x4B,
+    0x70, 0x20, 0x99, 0x5C, 0xE1, 0x44, 0x80, 0x91, 0x99, 0x10, 0x64, 0x6E, 0x28, 0xD9, 0xE3, 0x19,
+    0x68, 0xBC, 0xCC, 0xAD, 0x4B, 0x55, 0xBB, 0xB9, 0x60, 0x6F, 0xAE, 0x64, 0x94, 0x81, 0xE4, 0xC2,
+    0x0F, 0x4B, 0x78, 0x41, 0x38, 0x5B, 0x68, 0xC7, 0x0A, 0xA9, 0x93, 0x80, 0x00, 0x51, 0xD8, 0x0A,
+    0xD5, 0xD3, 0x3C, 0x69, 0x77, 0x6D, 0x09, 0x8E, 0xDA, 0xCF, 0x4D, 0x00, 0x89, 0x20, 0x9A, 0xF4,
+    0x47, 0x89, 0x27, 0xB6, 0xBB, 0x85, 0x94, 0xA5, 0xC4, 0xE8, 0x46, 0xE5, 0x52, 0xDB, 0x80, 0x6C,
+    0xE1, 0x80, 0xEC, 0x00, 0xA0, 0x0D, 0xF6, 0xF8, 0x61, 0x64, 0x92, 0xC4, 0x93, 0x78, 0xA6, 0x06,
+    0x12, 0xCA, 0x74, 0xFB, 0x5B, 0x98, 0x61, 0x24, 0x08, 0x99, 0x0E, 0xC2, 0xC1, 0x99, 0x49, 0x37,
+    0x0D, 0xB7, 0x85, 0x0C, 0x8A, 0xAC, 0xAE, 0x5F, 0x6B, 0x26, 0xE9, 0x23, 0xF8, 0x5D, 0x62, 0xF2,
+    0x32, 0xDB, 0x6B, 0xF7, 0x73, 0x90, 0x10, 0xC0, 0x62, 0xB6, 0x1F, 0xE9, 0x12, 0x5C, 0xCF, 0x22,
+    0x80, 0xD3, 0x34, 0xE1, 0x14, 0x4E, 0xA8, 0xAE, 0x85, 0xA5, 0x5F, 0x31, 0x58, 0x6C, 0x04, 0x90,
+    0x0F, 0x39, 0x7D, 0xE3, 0xAD, 0x62, 0x66, 0xCC, 0xF7, 0x31, 0xB4, 0x7E, 0x64, 0x9A, 0xAC, 0x5A,
+    0x7C, 0x88, 0xAF, 0x14, 0x37, 0x37, 0x84, 0xEE, 0xD9, 0x6D, 0x30, 0x61, 0x81, 0x93, 0x8C, 0xE7,
+    0x69, 0x24, 0x8E, 0x49, 0x26, 0x34, 0xF1, 0x53, 0x16, 0x43, 0x77, 0xA5, 0xD8, 0xDE, 0x04, 0x8B,
+    0xFB, 0x26, 0x18, 0x2E, 0x9A, 0x66, 0x51, 0x10, 0x04, 0x6E, 0x50, 0x65, 0xE0, 0x85, 0x27, 0x1B,
+    0x4A, 0xA2, 0xF5, 0x55, 0x07, 0x06, 0x80, 0x37, 0x07, 0xC3, 0x3D, 0xF6, 0xB2, 0xCD, 0x61, 0xAA,
+    0xFD, 0xA7, 0xCB, 0xDD, 0xFE, 0x8A, 0x91, 0xE7, 0x1E, 0x44, 0xB2, 0xEE, 0xFB, 0x45, 0xD4, 0x6E,
+    0xC8, 0x36, 0x5B, 0x46, 0x24, 0xE2, 0x46, 0xCE, 0x40, 0x1F, 0x79, 0x0B, 0xD5, 0xF1, 0x57, 0xC3,
+    0xBB, 0xBD, 0x3E, 0x04, 0x96, 0x5F, 0xB5, 0x98, 0x5C, 0x88, 0xE2, 0x32, 0xC5, 0xB0, 0xC3, 0x2B,
+    0x34, 0xBF, 0x2D, 0xCC, 0x2E, 0xFB, 0x83, 0x2A, 0x22, 0x9E, 0x10, 0xA1, 0xC9, 0xC3, 0x10, 0x01,
+    0x6A, 0x37, 0x3E, 0x38, 0xD5, 0x24, 0x1F, 0x3C, 0xB1, 0xF9, 0x84, 0x4F, 0x1C, 0xF7, 0x0C, 0x0B,
+    0x19, 0x57, 0x54, 0x62, 0x5F, 0xCB, 0x8A, 0x42, 0xCA, 0x86, 0x4C, 0x91, 0x98, 0xD2, 0x33, 0x82,
+    0x73, 0x9A, 0x35, 0xFF, 0x00, 0x19, 0xDD, 0x5F, 0x26, 0x2E, 0xED, 0x2D, 0x15, 0xCB, 0x8B, 0xA9,
+    0xEF, 0x10, 0xC9, 0xBE, 0xE4, 0xC7, 0x1E, 0xD5, 0x17, 0x2C, 0xF2, 0x30, 0x22, 0x08, 0xB0, 0x01,
+    0x20, 0xB7, 0x52, 0x49, 0x2C, 0xE5, 0x80, 0x0F, 0x0A, 0xF8, 0x66, 0xDE, 0xF8, 0x49, 0xE6, 0x6A,
+    0x72, 0x41, 0x32, 0x05, 0x9A, 0xDA, 0xD5, 0x21, 0x67, 0x37, 0xD1, 0x96, 0xC3, 0x08, 0x9D, 0x48,
+    0x01, 0xBE, 0xE8, 0x50, 0x48, 0xDE, 0xE4, 0x28, 0x20, 0x9A, 0xD1, 0xBB, 0xF8, 0x7C, 0x91, 0x23,
+    0xB4, 0xBA, 0xAE, 0x02, 0x2C, 0xDE, 0x74, 0x1B, 0x17, 0x7C, 0x37, 0xB6, 0x57, 0x25, 0x76, 0x5D,
+    0x7E, 0xF3, 0x68, 0xF3, 0x13, 0x0C, 0x48, 0x91, 0xF0, 0x4A, 0xAE, 0x09, 0x78, 0xF7, 0xE0, 0x68,
+    0xDE, 0x22, 0xD4, 0xAC, 0x8B, 0x1D, 0x26, 0xF6, 0x4B, 0x67, 0x60, 0x62, 0x96, 0x68, 0xC0, 0xDC,
+    0x63, 0x65, 0x61, 0x85, 0x97, 0x19, 0x00, 0xEE, 0xCF, 0x04, 0x72, 0x03, 0x75, 0x55, 0x23, 0x46,
+    0x3F, 0x1E, 0x6A, 0x4B, 0x0C, 0x91, 0xA0, 0x81, 0x7C, 0xC5, 0x30, 0x6A, 0x17, 0xCB, 0xB8, 0x4B,
+    0x79, 0xBE, 0x72, 0xC4, 0xDD, 0xCC, 0xAC, 0x37, 0x19, 0x73, 0xB7, 0x2C, 0x1B, 0x0B, 0x90, 0xB8,
+    0xDC, 0xDB, 0x80, 0x34, 0xAD, 0x3E, 0x1C, 0xAB, 0xC9, 0x02, 0xFF, 0x00, 0x6A, 0x48, 0xF1, 0xDC,
+    0x14, 0x6D, 0x1A, 0x6B, 0x78, 0x4B, 0x97, 0xB6, 0x93, 0xCC, 0xDC, 0x6E, 0x40, 0x60, 0x03, 0x58,
+    0x32, 0xA7, 0x98, 0xA2, 0x46, 0xDA, 0x1B, 0x39, 0x38, 0xE6, 0x76, 0xF8, 0x59, 0x30, 0x95, 0xA2,
+    0x37, 0x37, 0x66, 0xF7, 0x67, 0x9D, 0x69, 0x62, 0xB1, 0x46, 0x77, 0x5C, 0xB3, 0xCB, 0xB6, 0x3B,
+    0xDB, 0x85, 0x9F, 0x6A, 0x34, 0xB6, 0xD1, 0x89, 0x79, 0x63, 0xF2, 0xE7, 0x19, 0x20, 0x6E, 0xCA,
+    0xD5, 0x3E, 0x20, 0xEA, 0x57, 0x5B, 0xC5, 0xED, 0xBE, 0x9A, 0xF1, 0xB3, 0xC9, 0x7A, 0x2D, 0x96,
+    0x20, 0xAB, 0x15, 0xCD, 0xDC, 0x2E, 0xA5, 0xBC, 0xB8, 0xF1, 0xB9, 0x94, 0x30, 0x21, 0x9F, 0x7B,
+    0x82, 0x01, 0x0D, 0xF7, 0xB7, 0x17, 0xDF, 0x10, 0x35, 0x09, 0xE6, 0xDF, 0x3C, 0x16, 0x82, 0x30,
+    0x62, 0x92, 0x0D, 0x32, 0x3D, 0xEB, 0x1D, 0xAB, 0x58, 0x44, 0xEA, 0x9F, 0x64, 0x31, 0xB8, 0x65,
+    0x10, 0x6F, 0x66, 0x01, 0x64, 0x51, 0x93, 0x9A, 0x00, 0x3F, 0xE1, 0x07, 0xB8, 0x92, 0xD9, 0xA7,
+    0xD3, 0xC5, 0xDB, 0xDB, 0x29, 0x3E, 0x64, 0xD7, 0x11, 0xAC, 0x6B, 0xE4, 0x2B, 0xB8, 0xDC, 0x92,
+    0xBC, 0x98, 0x62, 0xF8, 0x50, 0x02, 0x17, 0x3B, 0xB2, 0xA7, 0x18, 0x52, 0xFD, 0x3F, 0x88, 0x7E,
+    0x0A, 0x3D, 0x83, 0x40, 0x2E, 0xB5, 0xCF, 0x3B, 0xCD, 0x91, 0xED, 0x0C, 0x56, 0xD0, 0x33, 0xC9,
+    0x14, 0x31, 0x82, 0x43, 0xC3, 0x68, 0xAD, 0x96, 0x0A, 0x80, 0x17, 0xC7, 0x29, 0x9E, 0x37, 0xD7,
+    0x37, 0xA7, 0x7C, 0x47, 0xD4, 0xAD, 0xE2, 0x91, 0x21, 0xB7, 0xB1, 0x6F, 0x36, 0x37, 0xB1, 0xD6,
+    0x2E, 0xDD, 0x58, 0xC9, 0xA8, 0x7D, 0xA1, 0xDC, 0xEF, 0xB9, 0x97, 0x7F, 0x2F, 0x0F, 0x98, 0xE0,
+    0x1C, 0x72, 0x0F, 0xCF, 0xBB, 0x0B, 0x88, 0x22, 0xF1, 0xF6, 0xAC, 0x8F, 0xBA, 0x07, 0x82, 0x27,
+    0x2A, 0x23, 0x91, 0xE3, 0x5C, 0x19, 0x6E, 0x16, 0xDA, 0x54, 0xF3, 0x65, 0x9D, 0x70, 0xC6, 0x42,
+    0x26, 0x76, 0x2C, 0x5C, 0x92, 0xC7, 0x27, 0x80, 0x00, 0x00, 0xBD, 0x73, 0xF0, 0xCE, 0xF6, 0xDE,
+    0x49, 0x62, 0xD5, 0x6E, 0xA0, 0xB6, 0xBC, 0x58, 0xFE, 0xDF, 0xA3, 0x5B, 0xE4, 0x15, 0xD7, 0x10,
+    0x4A, 0x57, 0x6D, 0xA4, 0x81, 0xB3, 0xBE, 0x62, 0x3E, 0x45, 0xF2, 0xCB, 0x37, 0x42, 0x16, 0x86,
+    0xF8, 0x77, 0x98, 0x5E, 0x6B, 0x6D, 0x5E, 0x06, 0xB5, 0x55, 0x92, 0xE6, 0xDD, 0xE4, 0x5D, 0x8F,
+    0xA8, 0xC1, 0x04, 0xEC, 0x81, 0xAC, 0xA3, 0x76, 0xC1, 0x0E, 0xE1, 0x72, 0x0B, 0xAC, 0x8A, 0x4E,
+    0x36, 0x1C, 0xA6, 0xFA, 0xB1, 0xFC, 0x44, 0xD5, 0xF7, 0xEF, 0x9A, 0x48, 0xE7, 0xB9, 0x11, 0xFF,
+    0x00, 0x67, 0x43, 0xA8, 0x4A, 0x58, 0xC9, 0x6E, 0x3C, 0xB9, 0x14, 0x3C, 0x13, 0x06, 0x04, 0x32,
+    0x47, 0x23, 0x0E, 0x30, 0xA4, 0xFC, 0xCE, 0xA5, 0xFE, 0x6A, 0x8D, 0xBC, 0x7D, 0xAB, 0x61, 0xFC,
+    0x87, 0x82, 0x07, 0x95, 0x64, 0xB7, 0xD7, 0x2E, 0x23, 0x5C, 0x1D, 0x61, 0x2E, 0xE5, 0x66, 0x3F,
+    0x6D, 0x8C, 0xE5, 0x73, 0x19, 0x76, 0x00, 0xAA, 0x2B, 0x00, 0x71, 0x9C, 0x62, 0x80, 0x3A, 0x3B,
+    0xFF, 0x00, 0x84, 0x11, 0xDB, 0x3C, 0x7F, 0x6D, 0xF1, 0x45, 0x88, 0x81, 0xFC, 0xCB, 0x98, 0xAE,
+    0xE2, 0x8D, 0x9B, 0x3A, 0x64, 0x16, 0xCE, 0xE2, 0x48, 0x54, 0x60, 0x36, 0x56, 0x33, 0xB8, 0x2B,
+    0xB6, 0xCC, 0xAF, 0x2D, 0xB8, 0x55, 0x5B, 0xCF, 0x86, 0xD6, 0x90, 0xDC, 0xDC, 0x43, 0x71, 0xAD,
+    0xDD, 0xBC, 0xB1, 0x08, 0xE4, 0xB5, 0x4B, 0x7B, 0x6D, 0xCD, 0xA9, 0x2D, 0xC2, 0x29, 0x3B, 0x14,
+    0xCA, 0xA0, 0x18, 0xD9, 0x95, 0x40, 0x32, 0x65, 0xC9, 0x01, 0x32, 0xC4, 0x29, 0xC6, 0x97, 0xC7,
+    0xDA, 0xB3, 0x6D, 0x05, 0xE0, 0x5B, 0x55, 0x69, 0x66, 0xB7, 0xD1, 0xE3, 0x5D, 0xB1, 0x46, 0x97,
+    0xFB, 0xF7, 0xA8, 0x44, 0xC1, 0xC3, 0x24, 0x8C, 0xA3, 0xE6, 0xDC, 0xA0, 0xFC, 0x84, 0x75, 0xAD,
+    0x2B, 0x5F, 0x8B, 0x3A, 0xD4, 0x6E, 0x19, 0xA3, 0xB4, 0x9C, 0x82, 0xAF, 0xB2, 0xE0, 0xC8, 0xE2,
+    0x55, 0xB7, 0x92, 0x76, 0x51, 0x3B, 0x3C, 0x84, 0x91, 0x6E, 0xF3, 0x92, 0x32, 0xC4, 0x82, 0xA8,
+    0x73, 0x91, 0x92, 0x01, 0x01, 0xF0, 0x24, 0x49, 0x04, 0x8F, 0x7B, 0xA9, 0xC8, 0x92, 0x46, 0x5E,
+    0xCB, 0x54, 0xB5, 0x8A, 0x2D, 0xFF, 0x00, 0xD9, 0x9A, 0x94, 0x4D, 0x20, 0x09, 0x7E, 0xE1, 0xC6,
+    0x16, 0xEC, 0xAA, 0x85, 0x75, 0x57, 0x5D, 0xC4, 0x86, 0xC6, 0x39, 0xCA, 0xF0, 0x87, 0x87, 0xD7,
+    0x50, 0xB8, 0x48, 0x9E, 0xEA, 0x4B, 0x70, 0xC1, 0xE4, 0x79, 0xD2, 0x32, 0xE5, 0x16, 0x08, 0x59,
+    0xBF, 0x77, 0x6E, 0x84, 0x12, 0x5B, 0x6E, 0x30, 0x39, 0xF4, 0xCF, 0x4A, 0xD8, 0xFF, 0x00, 0x85,
+    0xA9, 0xAC, 0x88, 0x9A, 0x38, 0x63, 0xB1, 0x8E, 0x27, 0x59, 0xAD, 0xAF, 0xCE, 0xC2, 0x5E, 0xF2,
+    0x1B, 0xE7, 0x90, 0xE2, 0xE2, 0xE6, 0x46, 0x66, 0x3F, 0x66, 0x79, 0x5C, 0xAF, 0xCD, 0x9C, 0x9F,
+    0x9F, 0x76, 0x4E, 0x79, 0x9D, 0x2B, 0x50, 0x36, 0xF2, 0x2B, 0xAC, 0x11, 0xCA, 0x54, 0xF9, 0xB1,
+    0xC6, 0xCC, 0xE0, 0x79, 0x83, 0xA1, 0x12, 0x42, 0xE8, 0x41, 0x8D, 0xB0, 0x46, 0x1C, 0x73, 0x40,
+    0x1D, 0xDD, 0xE7, 0xC2, 0x0F, 0x22, 0x6F, 0x2A, 0xF7, 0x5B, 0xF2, 0xEE, 0x36, 0xC2, 0xF6, 0x63,
+    0xC9, 0xF9, 0x35, 0x1B, 0x8B, 0xA3, 0x26, 0x52, 0xD2, 0xE4, 0xB8, 0x00, 0xA8, 0x8D, 0x82, 0x6F,
+    0x31, 0x19, 0x1B, 0x8C, 0x28, 0xF9, 0xAB, 0x02, 0xD3, 0xC0, 0xF2, 0xCD, 0x6F, 0xE6, 0xDB, 0xDE,
+    0xC6, 0xE3, 0xCB, 0x92, 0xFE, 0xE6, 0xD4, 0x2F, 0xCF, 0x6C, 0x2D, 0xA6, 0xC6, 0x5A, 0x2C, 0xE4,
+    0xA4, 0xAB, 0xD1, 0xD5, 0x5D, 0x43, 0x65, 0x64, 0xDA, 0x01, 0x60, 0xF8, 0x7E, 0x22, 0xEA, 0x08,
+    0xC0, 0xC5, 0x63, 0xA5, 0x24, 0x01, 0x52, 0xDE, 0xDF, 0x4C, 0x11, 0x7C, 0x96, 0xE2, 0xD8, 0x49,
+    0xB5, 0xAD, 0xE6, 0xDD, 0xBC, 0x3A, 0x3C, 0xAE, 0xFB, 0x84, 0xC1, 0xF7, 0x1C, 0xE7, 0xB5, 0x4F,
+    0xFF, 0x00, 0x0B, 0x57, 0x5C, 0x11, 0x34, 0x71, 0x34, 0x09, 0x03, 0x2C, 0xD6, 0xF7, 0x90, 0x9D,
+    0xED, 0xF6, 0x84, 0xBE, 0x79, 0x09, 0xDE, 0xF2, 0xBB, 0x1C, 0xC4, 0xD2, 0x36, 0x08, 0x21, 0x8F,
+    0x1E, 0x61, 0x7C, 0x0A, 0x00, 0xC0, 0xD5, 0xF4, 0x85, 0x80, 0x23, 0x5B, 0x5D, 0xC7, 0x75, 0x6E,
+    0xE0, 0xC9, 0x6B, 0x70, 0xA0, 0x82, 0x8C, 0x8D, 0x82, 0x97, 0x48, 0x7A, 0x3C, 0x43, 0x04, 0x80,
+    0xCC, 0x00, 0x20, 0x86, 0x20, 0x82, 0x73, 0x6A, 0xF6, 0xA1, 0xAE, 0x6A, 0x17, 0x1F, 0xF1, 0xFB,
+    0x7D, 0x3C, 0xA3, 0x82, 0xE8, 0xC7, 0x87, 0x68, 0xF7, 0x60, 0xBA, 0x0E, 0xE5, 0x9D, 0xC9, 0x38,
+    0xC9, 0x2C, 0xC4, 0x92, 0x58, 0x93, 0x46, 0x81, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x18, 0xB4, 0x51, 0x45, 0x41, 0x41, 0x45, 0x14, 0x50, 0x07, 0xAE, 0x7C, 0x59, 0xFF, 0x00, 0x96,
+    0x3F, 0xF6, 0xD3, 0xFF, 0x00, 0x69, 0xD7, 0x9E, 0xD7, 0xA1, 0x7C, 0x59, 0xFF, 0x00, 0x96, 0x3F,
+    0xF6, 0xD3, 0xFF, 0x00, 0x69, 0xD7, 0x9E, 0xD7, 0xAB, 0x9B, 0x7C, 0x6F, 0xE5, 0xF9, 0x23, 0x8F,
+    0x05, 0xF0, 0xAF, 0x9F, 0xE6, 0x15, 0xF4, 0x67, 0xEC, 0xE7, 0xFF, 0x00, 0x1E, 0x32, 0x7F, 0xD7,
+    0x76, 0xFF, 0x00, 0xD2, 0x78, 0x6B, 0xE7, 0x3A, 0xF7, 0x7F, 0xD9, 0xC3, 0xC4, 0x10, 0x94, 0x9A,
+    0x06, 0x5D, 0xB2, 0x86, 0xFE, 0xD6, 0x85, 0xB9, 0xFD, 0xF4, 0x2E, 0xA8, 0xA7, 0x8C, 0x71, 0xE5,
+    0x10, 0xBF, 0xC5, 0x93, 0x9E, 0x07, 0x06, 0xBC, 0xF4, 0x76, 0x44, 0xF6, 0x8A, 0x28, 0xA2, 0xA8,
+    0xB0, 0xA2, 0x8A, 0x28, 0x00, 0xAE, 0x1F, 0xE3, 0x5F, 0xFC, 0x83, 0x2E, 0x3F, 0xED, 0x97, 0xFE,
+    0x95, 0xC7, 0x5D, 0xC5, 0x79, 0x97, 0xC7, 0xEF, 0x10, 0x43, 0x05, 0x97, 0x94, 0xCB, 0xBA, 0x59,
+    0x98, 0x47, 0x0A, 0xF3, 0xFB, 0xB8, 0x6D, 0x9D, 0x58, 0xB6, 0x70, 0x7A, 0x10, 0xA3, 0x19, 0x07,
+    0x9C, 0x8E, 0x86, 0x86, 0x26, 0x7C, 0xDB, 0x45, 0x14, 0x56, 0x66, 0x61, 0x45, 0x7B, 0x36, 0xA1,
+    0xE3, 0x8B, 0x13, 0xF6, 0x67, 0x93, 0x53, 0x92, 0xE2, 0xE8, 0x08, 0x9A, 0x0F, 0xB3, 0xCC, 0x15,
+    0xAD, 0xE7, 0x92, 0xCA, 0x7F, 0x92, 0xEE, 0x79, 0x09, 0xC8, 0xB2, 0xB8, 0x96, 0x31, 0xBA, 0x56,
+    0x71, 0xB4, 0x95, 0x21, 0x98, 0x4C, 0x5E, 0xF6, 0x85, 0xE3, 0x1D, 0x12, 0x49, 0xA6, 0x97, 0x52,
+    0x5D, 0x19, 0x90, 0xC7, 0x0F, 0x9D, 0x65, 0x24, 0xBB, 0x44, 0x66, 0x79, 0xA5, 0x12, 0x34, 0x36,
+    0x2C, 0xD2, 0x2B, 0x34, 0x96, 0xCE, 0xD2, 0x30, 0x52, 0x59, 0x4B, 0x18, 0xBE, 0x67, 0x67, 0x62,
+    0x0C, 0xF0, 0xBA, 0x2B, 0xD6, 0x35, 0x6D, 0x7B, 0x4B, 0x68, 0x2E, 0xA3, 0x8A, 0xEB, 0x4D, 0x31,
+    0xEF, 0x9A, 0xCF, 0x4A, 0xB6, 0xB5, 0x70, 0x01, 0xB6, 0x5B, 0xA9, 0xE4, 0x4F, 0xB4, 0xC0, 0xC2,
+    0x30, 0xCA, 0xAC, 0x09, 0x56, 0x4B, 0x87, 0xDA, 0x76, 0x2A, 0xA1, 0xDE, 0xEB, 0x26, 0x6C, 0x3E,
+    0x20, 0xD2, 0xA4, 0x78, 0xA7, 0x97, 0x51, 0xD5, 0x6D, 0x6E, 0x52, 0x40, 0x2E, 0xF5, 0x80, 0xF1,
+    0x99, 0xAE, 0x20, 0x8A, 0xD9, 0xBF, 0x77, 0x2D, 0xA1, 0x90, 0xEE, 0x2A, 0xA8, 0x91, 0x89, 0x3C,
+    0xA4, 0x8D, 0xF7, 0x1F, 0x35, 0x72, 0x39, 0x00, 0xF3, 0x9A, 0x2B, 0xD8, 0xFC, 0x25, 0x2F, 0x84,
+    0x26, 0x75, 0x13, 0x5D, 0x41, 0x6F, 0x69, 0xB6, 0x19, 0x22, 0x87, 0x52, 0x94, 0x15, 0x96, 0xEA,
+    0x2B, 0xAB, 0x96, 0x65, 0x4B, 0x13, 0x23, 0x85, 0x4D, 0xB9, 0xC1, 0x69, 0x55, 0x97, 0x80, 0xDE,
+    0x60, 0x91, 0xBC, 0xCC, 0xA9, 0xF5, 0x4D, 0x36, 0xEE, 0x19, 0x0C, 0xDA, 0x94, 0x11, 0xC2, 0xCB,
+    0x77, 0x6D, 0xA6, 0x42, 0x19, 0x45, 0xC5, 0xBF, 0x97, 0x3B, 0x4F, 0x1A, 0xEB, 0x13, 0x4E, 0xCC,
+    0x58, 0x5E, 0xC9, 0xDD, 0x43, 0x61, 0x82, 0x80, 0xE1, 0x9D, 0xC1, 0x00, 0xF3, 0x1A, 0x2B, 0xDF,
+    0xE7, 0xF1, 0x3E, 0x9D, 0x24, 0xD0, 0x49, 0x77, 0xAE, 0x41, 0x2D, 0xCA, 0xC9, 0x34, 0x46, 0xF2,
+    0x0B, 0xA8, 0x76, 0x5B, 0x96, 0xD3, 0x64, 0x0C, 0x74, 0xF8, 0x27, 0x2B, 0xB4, 0x4B, 0x73, 0xB5,
+    0x13, 0x7A, 0x94, 0x21, 0x03, 0x13, 0x97, 0x25, 0xC7, 0xF1, 0x8D, 0x87, 0xDA, 0xDE, 0x4D, 0x29,
+    0xF4, 0x35, 0xB9, 0x65, 0xB4, 0xBB, 0xD5, 0x45, 0xCD, 0xDC, 0x62, 0x38, 0xAE, 0xD5, 0x66, 0x47,
+    0x58, 0x6E, 0xDB, 0x39, 0x30, 0xDB, 0x48, 0xBC, 0xC6, 0x00, 0x18, 0x39, 0x24, 0xFE, 0xED, 0xC0,
+    0xB1, 0xE0, 0x14, 0x57, 0xA1, 0xDF, 0xDE, 0xF8, 0x7A, 0x4B, 0x69, 0xFE, 0xDF, 0xAF, 0xEA, 0x57,
+    0xB2, 0xF9, 0x86, 0x7D, 0x1E, 0x18, 0x14, 0xA8, 0x86, 0x69, 0x1E, 0xEB, 0x6F, 0x9C, 0x6E, 0x64,
+    0x66, 0x64, 0x7E, 0x1C, 0xE7, 0x2D, 0x19, 0x7E, 0x1B, 0x73, 0xBE, 0x68, 0xF8, 0xFB, 0xC5, 0xAB,
+    0x7C, 0xA3, 0x1A, 0xBC, 0x97, 0x0E, 0xCE, 0x75, 0x3B, 0xB8, 0xA2, 0x8C, 0xA4, 0x7E, 0x6C, 0x80,
+    0xA8, 0x13, 0xC4, 0xE4, 0xFC, 0xF6, 0xB6, 0xE9, 0x1A, 0xF0, 0x5D, 0x08, 0x38, 0x07, 0x21, 0x9E,
+    0x40, 0x0E, 0x2A, 0x8A, 0xED, 0x7E, 0x1B, 0xF8, 0xD2, 0xC7, 0x4D, 0x32, 0x7F, 0x68, 0x69, 0xF1,
+    0xDC, 0xE4, 0xA6, 0xA1, 0x62, 0x1F, 0x1B, 0x45, 0xE5, 0x92, 0xC9, 0x80, 0xE4, 0xC6, 0xE4, 0x16,
+    0xF3, 0x09, 0x56, 0x50, 0x08, 0x60, 0x01, 0x21, 0x4B, 0x11, 0x3A, 0x78, 0x83, 0x42, 0x78, 0xA5,
+    0x4B, 0x6F, 0x0E, 0xC6, 0xD8, 0x37, 0x03, 0x44, 0xD4, 0x2E, 0xE7, 0x52, 0xDA, 0x75, 0xB5, 0xD2,
+    0x48, 0x55, 0x21, 0xB1, 0x76, 0x5C, 0x88, 0xD1, 0x4E, 0x3F, 0x79, 0x26, 0xC9, 0x0E, 0xE5, 0xCB,
+    0x30, 0x56, 0x00, 0xE0, 0xE8, 0xAF, 0x46, 0xD4, 0xFC, 0x4D, 0x20, 0x96, 0xD2, 0x46, 0xD5, 0x7E,
+    0xD7, 0xA8, 0x47, 0xBB, 0x4B, 0x59, 0x84, 0xEA, 0x0C, 0xB6, 0x71, 0xDC, 0x4C, 0xAA, 0xD7, 0xD7,
+    0x03, 0x2A, 0x8F, 0x83, 0xDE, 0x5B, 0x84, 0x71, 0xF3, 0x49, 0xF2, 0xF1, 0x26, 0xEE, 0x85, 0x77,
+    0xA1, 0xDF, 0x5D, 0x34, 0x9A, 0x8D, 0xF5, 0x8D, 0x94, 0x32, 0xED, 0x9B, 0x5E, 0xD3, 0x5A, 0xE1,
+    0x10, 0x6C, 0xBA, 0x8A, 0xEF, 0x3B, 0xE7, 0x52, 0x99, 0x74, 0xFD, 0xD0, 0x25, 0x02, 0x30, 0x57,
+    0x64, 0x94, 0x33, 0x19, 0x0B, 0x00, 0x78, 0xE5, 0x15, 0xEB, 0xF6, 0xDA, 0xD0, 0x8E, 0xDA, 0x78,
+    0xA6, 0xF1, 0x06, 0x9B, 0x30, 0xD9, 0x7A, 0xAB, 0xA9, 0x79, 0xE8, 0x26, 0xBF, 0x36, 0xCE, 0xDB,
+    0x72, 0x54, 0xB6, 0xE5, 0xD4, 0x1E, 0x69, 0x30, 0x8E, 0x0B, 0x7D, 0xE9, 0x23, 0x7F, 0xBA, 0x06,
+    0x1F, 0xC4, 0x4B, 0xB8, 0x9E, 0x14, 0x27, 0xC4, 0x3A, 0x6D, 0xF4, 0xCC, 0x63, 0x47, 0x6B, 0x41,
+    0x93, 0xAA, 0x59, 0xDA, 0x42, 0xE1, 0x25, 0xD5, 0x0B, 0x92, 0xCB, 0x34, 0x41, 0xC8, 0x70, 0xDC,
+    0x10, 0xCA, 0x17, 0x25, 0x1B, 0x00, 0x1E, 0x79, 0x45, 0x75, 0xDE, 0x00, 0x36, 0x8D, 0xE6, 0x2E,
+    0xA0, 0xBA, 0x6C, 0xD0, 0x93, 0x13, 0xDD, 0xD8, 0x5D, 0xCF, 0xE5, 0xFD, 0xA2, 0xD9, 0x26, 0xF9,
+    0x8E, 0x9E, 0xCC, 0xC8, 0x3C, 0xD8, 0x54, 0xF0, 0x4C, 0xE9, 0x85, 0x2C, 0x30, 0xC0, 0x9C, 0x73,
+    0xFA, 0xEC, 0x28, 0x93, 0xCA, 0x23, 0xB9, 0x82, 0xE1, 0x44, 0x8F, 0x1C, 0x77, 0x50, 0xAA, 0xAA,
+    0x5C, 0xAA, 0xC8, 0x7E, 0x68, 0x23, 0x8F, 0x80, 0x24, 0x1C, 0x80, 0x38, 0x03, 0xA7, 0x14, 0x08,
+    0xA3, 0x45, 0x7A, 0x8F, 0xC4, 0xAF, 0x1B, 0xDD, 0xEA, 0x36, 0xA0, 0x6A, 0x17, 0xBA, 0x32, 0xCA,
+    0xB2, 0x44, 0x64, 0xD2, 0xED, 0x5F, 0x79, 0x46, 0xFB, 0x3C, 0xB9, 0x74, 0x9D, 0x78, 0xC3, 0x36,
+    0x73, 0xB6, 0x49, 0x40, 0x05, 0x54, 0xEC, 0x60, 0xDB, 0xFC, 0xBA, 0x80, 0x0A, 0x2B, 0xD3, 0xBC,
+    0x39, 0xAE, 0x68, 0xD1, 0xE9, 0x72, 0x2E, 0xA7, 0x7D, 0x89, 0xCE, 0xFB, 0x6B, 0x08, 0xA2, 0x23,
+    0x72, 0x48, 0x6D, 0xEE, 0x76, 0x89, 0xC1, 0xF9, 0xC0, 0x2E, 0xE4, 0x1D, 0x98, 0x8B, 0xE6, 0x00,
+    0xFD, 0xE9, 0xC1, 0x7E, 0x85, 0xE3, 0x48, 0x2E, 0x2F, 0x22, 0x6B, 0xBD, 0x52, 0x48, 0xEF, 0x04,
+    0x8D, 0x1D, 0xE6, 0xB0, 0xDB, 0x7C, 0xB3, 0x6C, 0xD6, 0x65, 0x0C, 0xB6, 0xE2, 0x66, 0x89, 0x55,
+    0xA4, 0xC0, 0xE0, 0xDB, 0xFD, 0xD5, 0x4C, 0x86, 0x60, 0xC2, 0x40, 0x67, 0x97, 0x51, 0x5E, 0xBF,
+    0xA9, 0xF8, 0xA7, 0x4D, 0xFB, 0x42, 0xF9, 0x77, 0x5A, 0x6D, 0xED, 0xB1, 0x48, 0x5A, 0xF2, 0x61,
+    0x21, 0x44, 0xB1, 0x92, 0xD1, 0xAE, 0x1D, 0x3F, 0xB2, 0xE2, 0x5D, 0x8E, 0x86, 0x28, 0x76, 0x8F,
+    0xDD, 0x96, 0xF2, 0xF2, 0x55, 0x96, 0x69, 0x48, 0xDC, 0x7F, 0x6E, 0xE9, 0x86, 0xCA, 0xE7, 0xED,
+    0x37, 0xDA, 0x6B, 0x5F, 0x62, 0x58, 0x53, 0x56, 0x71, 0x13, 0x4C, 0xD7, 0x57, 0x37, 0x37, 0x25,
+    0xD6, 0x18, 0x7C, 0xC6, 0xC2, 0x5D, 0x42, 0x63, 0x5F, 0xDD, 0x6E, 0x45, 0x2E, 0xCC, 0x09, 0xC3,
+    0x90, 0x01, 0xE4, 0x14, 0x51, 0x45, 0x02, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A,
+    0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A,
+    0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x0A, 0x28, 0xA2, 0x80, 0x31, 0x68, 0xA2, 0x8A, 0x82,
+    0x82, 0x8A, 0x28, 0xA0, 0x0F, 0x5C, 0xF8, 0xB3, 0xFF, 0x00, 0x2C, 0x7F, 0xED, 0xA7, 0xFE, 0xD3,
+    0xAF, 0x3D, 0xAF, 0x42, 0xF8, 0xB3, 0xFF, 0x00, 0x2C, 0x7F, 0xED, 0xA7, 0xFE, 0xD3, 0xAF, 0x3D,
+    0xAF, 0x57, 0x36, 0xF8, 0xDF, 0xCB, 0xF2, 0x47, 0x1E, 0x0B, 0xE1, 0x5F, 0x3F, 0xCC, 0x2B, 0x67,
+    0xC2, 0x5E, 0x28, 0xBB, 0xD3, 0x2E, 0x12, 0x5B, 0x27, 0x70, 0x41, 0x02, 0xEA, 0x15, 0x38, 0x17,
+    0x96, 0xC4, 0x8C, 0xA4, 0x84, 0x83, 0xC4, 0x80, 0x7A, 0x1C, 0x1C, 0x11, 0xC8, 0x15, 0x8D, 0x45,
+    0x79, 0xC7, 0x51, 0xF6, 0x57, 0x86, 0x7C, 0x4D, 0xA7, 0xEA, 0x50, 0xAC, 0x9A, 0x54, 0xFB, 0xE3,
+    0x3F, 0x2B, 0xA1, 0xFB, 0xD6, 0xD3, 0x01, 0xCA, 0xDC, 0x27, 0x62, 0x99, 0xFA, 0x77, 0x04, 0x82,
+    0x0D, 0x6A, 0xD7, 0xC7, 0x9E, 0x13, 0xF1, 0xA6, 0xAD, 0xA5, 0x39, 0x6D, 0x1E, 0xEB, 0xCB, 0xCE,
+    0x05, 0xDD, 0xBB, 0x0C, 0xAD, 0xD2, 0x23, 0x67, 0x13, 0x21, 0xFC, 0x46, 0x41, 0x0C, 0x01, 0x38,
+    0x23, 0x35, 0xEE, 0x1E, 0x1C, 0xFD, 0xA1, 0x34, 0x39, 0xF2, 0x35, 0xAB, 0x69, 0xF4, 0xC6, 0xE5,
+    0xA3, 0x7E, 0x64, 0x59, 0x14, 0x63, 0x8D, 0xF1, 0xA8, 0x39, 0x24, 0x9F, 0xE0, 0xC6, 0x07, 0x5C,
+    0xF1, 0x54, 0x99, 0x69, 0x9E, 0xA7, 0x45, 0x70, 0xFF, 0x00, 0xF0, 0xBA, 0xFC, 0x19, 0xFF, 0x00,
+    0x41, 0xEF, 0xFC, 0x83, 0x37, 0xFF, 0x00, 0x1B, 0xAC, 0xAF, 0x10, 0x7C, 0x7E, 0xF0, 0xE4, 0x0B,
+    0xFF, 0x00, 0x12, 0x9F, 0x3F, 0x52, 0x94, 0xFD, 0xD8, 0x95, 0x59, 0x16, 0x3C, 0x11, 0xFE, 0xBA,
+    0x59, 0x54, 0x75, 0x04, 0xE3, 0x08, 0xDD, 0x39, 0xC7, 0x5A, 0x77, 0x1D, 0xFC, 0xCF, 0x43, 0xD5,
+    0x75, 0x5B, 0x4B, 0x48, 0xDA, 0x4D, 0x46, 0xE5, 0x20, 0x81, 0x47, 0x99, 0x71, 0x33, 0x74, 0x45,
+    0xF6, 0x03, 0xBB, 0x1E, 0x00, 0x00, 0x92, 0x78, 0x1C, 0xD7, 0xCA, 0x9F, 0x11, 0xBC, 0x73, 0x36,
+    0xB1, 0x70, 0x5F, 0x33, 0xA5, 0xB2, 0xFE, 0xEB, 0x4A, 0xB3, 0x72, 0x3F, 0xD1, 0xE1, 0xC0, 0xC9,
+    0x2A, 0xBD, 0xE6, 0x23, 0x27, 0xA9, 0xED, 0x92, 0x00, 0xA3, 0xC7, 0x3F, 0x11, 0xB5, 0x6D, 0x61,
+    0xBF, 0xD3, 0x65, 0xF2, 0xED, 0x83, 0x19, 0xAC, 0x74, 0xD4, 0xFB, 0xB6, 0xF9, 0x18, 0xF9, 0xDB,
+    0x03, 0x71, 0x03, 0xB9, 0xF5, 0x3B, 0x40, 0x07, 0x15, 0xCA, 0xD4, 0xB6, 0x4B, 0x61, 0x45, 0x14,
+    0x54, 0x92, 0x14, 0x57, 0x79, 0xAB, 0xFC, 0x2B, 0x6B, 0x76, 0x4C, 0xEB, 0xFA, 0x69, 0x81, 0xDC,
+    0xE9, 0xED, 0x3B, 0x10, 0x0E, 0x9B, 0x7D, 0x1C, 0x1B, 0x8A, 0xEA, 0xCE, 0x18, 0xA2, 0x98, 0x9F,
+    0x82, 0x3C, 0xF6, 0x62, 0x39, 0x45, 0x63, 0xC5, 0x41, 0x07, 0xC3, 0x0B, 0xA7, 0x77, 0x48, 0xAF,
+    0xE3, 0xB9, 0x99, 0x11, 0x35, 0x45, 0x82, 0xD6, 0x29, 0x09, 0xBF, 0xD2, 0xDA, 0x46, 0x0C, 0xFA,
+    0x6B, 0x4A, 0xB1, 0x86, 0x31, 0x7C, 0xA4, 0x00, 0x76, 0xC8, 0x0F, 0xC8, 0xC4, 0x8C, 0x50, 0x33,
+    0x8A, 0xA2, 0xBB, 0xFD, 0x5B, 0xE1, 0x85, 0xB5, 0xB4, 0x13, 0x49, 0x26, 0xB9, 0x3C, 0x8D, 0x16,
+    0xFF, 0x00, 0x3A, 0x04, 0xB7, 0x18, 0xF9, 0x2F, 0xDE, 0x24, 0xDF, 0x23, 0x4A, 0x3F, 0xE3, 0xEA,
+    0x48, 0xD8, 0xF0, 0xAD, 0xB4, 0x03, 0x9E, 0x76, 0xEE, 0x35, 0x9F, 0x86, 0x36, 0xB0, 0x79, 0x46,
+    0x0D, 0x6E, 0xFA, 0x68, 0xA5, 0x67, 0xB3, 0xB7, 0xBE, 0x6B, 0x27, 0x09, 0x1D, 0xEC, 0x3E, 0x60,
+    0xF2, 0xE6, 0x89, 0x5D, 0x9C, 0x3B, 0xCE, 0x81, 0x71, 0xE4, 0xF4, 0x24, 0x8C, 0xED, 0x22, 0x80,
+    0x38, 0x0A, 0x2B, 0xB1, 0x5F, 0x87, 0x72, 0x19, 0xDE, 0x2F, 0xB5, 0x4F, 0x14, 0xCB, 0xFF, 0x00,
+    0x1E, 0xD6, 0xD2, 0xC6, 0xBE, 0x64, 0xF8, 0x8E, 0x42, 0x77, 0xDA, 0xC3, 0x2C, 0x84, 0x6C, 0x29,
+    0xBB, 0x8D, 0xFB, 0x93, 0xE6, 0x5C, 0xB3, 0x46, 0x92, 0x5E, 0x6F, 0x84, 0x97, 0x2D, 0x68, 0xF3,
+    0xDA, 0x5E, 0x4E, 0xDB, 0x16, 0x4B, 0x8B, 0x8B, 0x09, 0xE0, 0x28, 0xF1, 0xA5, 0xB5, 0xD3, 0x2F,
+    0xCC, 0xEC, 0xC4, 0x65, 0x63, 0x8D, 0xD9, 0x86, 0xE2, 0xCA, 0x40, 0x5C, 0x1D, 0xC0, 0xD0, 0x07,
+    0x01, 0x45, 0x76, 0x3E, 0x31, 0xF8, 0x7B, 0xFD, 0x9D, 0x1F, 0x99, 0x15, 0xF4, 0xF7, 0x70, 0x99,
+    0x05, 0xB5, 0x95, 0xDF, 0x93, 0xB5, 0x2E, 0xAD, 0xDE, 0x22, 0x43, 0xC7, 0x29, 0x73, 0x9D, 0xF2,
+    0x2B, 0x80, 0x00, 0x60, 0x54, 0x6F, 0xC8, 0x56, 0x4D, 0xD9, 0x5E, 0x1B, 0xF0, 0xA4, 0xDA, 0x80,
+    0x93, 0xEC, 0x97, 0x30, 0x23, 0xA6, 0xC7, 0x68, 0xE4, 0x23, 0xF7, 0xB0, 0xCD, 0x28, 0x5F, 0xDD,
+    0x20, 0x25, 0x89, 0x57, 0x65, 0xC0, 0x58, 0xD8, 0x9E, 0x83, 0xE6, 0x2A, 0xAE, 0x08, 0xC3, 0xA2,
+    0xBA, 0xE9, 0xFC, 0x13, 0x68, 0x62, 0x99, 0xF4, 0xDD, 0x5A, 0xEE, 0xFC, 0xC3, 0x23, 0xD9, 0x5F,
+    0xC5, 0x6F, 0x6F, 0x90, 0xB6, 0xCA, 0x92, 0x94, 0x99, 0x67, 0x59, 0x08, 0xD9, 0x37, 0x96, 0x32,
+    0x7F, 0x87, 0x24, 0xF3, 0x81, 0xBA, 0xA7, 0x8A, 0x7C, 0x2D, 0x6D, 0x64, 0xA8, 0xD6, 0xBA, 0x8C,
+    0xF7, 0x2A, 0xF9, 0x8C, 0x2C, 0x91, 0x04, 0x6B, 0x4B, 0xB8, 0x09, 0x12, 0x47, 0x7D, 0x09, 0x91,
+    0x8A, 0xBD, 0xA9, 0x31, 0xFF, 0x00, 0x0E, 0x1B, 0x39, 0x07, 0x03, 0x90, 0x0E, 0x72, 0x8A, 0xE9,
+    0xFC, 0x15, 0xE0, 0x99, 0x75, 0x42, 0xE2, 0xDE, 0x4B, 0xBD, 0xEA, 0x54, 0x18, 0x61, 0x87, 0x71,
+    0x92, 0x39, 0x16, 0x4E, 0x7C, 0xE6, 0x64, 0x50, 0x50, 0xA8, 0xE1, 0xE5, 0x4D, 0xC3, 0x3B, 0x49,
+    0x20, 0x29, 0x2E, 0xFC, 0x10, 0xD1, 0x42, 0x5A, 0x6D, 0x4E, 0xD2, 0x39, 0xD0, 0xCB, 0x16, 0xB1,
+    0xA7, 0xB1, 0x05, 0xAC, 0xA5, 0xB5, 0x95, 0x54, 0x00, 0x20, 0x69, 0x0E, 0x2E, 0x1C, 0x90, 0x0B,
+    0x24, 0x68, 0x08, 0xC1, 0x6C, 0x32, 0x96, 0x00, 0xE6, 0x28, 0xAE, 0xE3, 0x5F, 0xF8, 0x67, 0xF6,
+    0x2D, 0xBF, 0x6A, 0xD5, 0x7E, 0x57, 0x66, 0x86, 0xC4, 0x2C, 0x7B, 0x9B, 0x65, 0xAD, 0xB9, 0x32,
+    0xB5, 0xE2, 0xC0, 0xEE, 0x14, 0x58, 0x4F, 0x84, 0x6C, 0x3B, 0xB7, 0x0C, 0xC0, 0x10, 0xB8, 0x30,
+    0x69, 0x1F, 0x0D, 0x6F, 0x6E, 0x58, 0xA4, 0x26, 0x76, 0xB9, 0x5F, 0x2A, 0x4B, 0xAB, 0x68, 0x90,
+    0x32, 0xB5, 0xBD, 0xD8, 0x76, 0xDD, 0x6D, 0x7C, 0x8E, 0x53, 0x88, 0x02, 0x30, 0xDD, 0x24, 0x61,
+    0xB2, 0x42, 0x9C, 0x81, 0xB8, 0x19, 0xC7, 0x51, 0x5D, 0x3D, 0xEF, 0x83, 0xE2, 0x8A, 0xDD, 0xDD,
+    0xAF, 0x2E, 0xE4, 0xBB, 0x89, 0xFE, 0xC5, 0xAE, 0x69, 0xD1, 0xC3, 0x95, 0xD2, 0x27, 0x33, 0x32,
+    0x81, 0x77, 0x79, 0xE6, 0x74, 0x98, 0x29, 0xC1, 0x54, 0x71, 0x9F, 0x94, 0x91, 0x91, 0x9B, 0xDA,
+    0xF7, 0x80, 0x6C, 0x2D, 0x8C, 0x66, 0x2F, 0x10, 0xC9, 0x25, 0xA3, 0x19, 0x6D, 0x2E, 0xB5, 0x49,
+    0x2D, 0x9D, 0x57, 0x4F, 0xD4, 0x6D, 0x94, 0xE2, 0x2B, 0xB8, 0x03, 0x33, 0x86, 0x76, 0x1C, 0xE6,
+    0x30, 0x40, 0x3B, 0x94, 0x37, 0x38, 0x00, 0xE2, 0xA8, 0xAE, 0xC7, 0xFE, 0x10, 0x4B, 0x37, 0x9A,
+    0x48, 0xEC, 0xF5, 0xDC, 0x94, 0xDA, 0xB0, 0xC9, 0x3C, 0x68, 0xBF, 0xDA, 0x4D, 0x31, 0x6C, 0x1D,
+    0x36, 0x11, 0x33, 0x33, 0x89, 0x46, 0xC6, 0x1B, 0x55, 0x8B, 0x29, 0x25, 0x41, 0x6D, 0x8A, 0xFC,
+    0xAD, 0xFD, 0xA3, 0xC2, 0xEC, 0xB2, 0x1C, 0xB2, 0xB3, 0x5B, 0xC8, 0x70, 0xC3, 0x2D, 0x1B, 0x11,
+    0xF7, 0x24, 0x0A, 0x47, 0x23, 0xBA, 0x82, 0x3B, 0x80, 0x68, 0x11, 0x05, 0x14, 0x51, 0x40, 0x05,
+    0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05,
+    0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05,
+    0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x18,
+    0xB4, 0x51, 0x45, 0x41, 0x41, 0x45, 0x14, 0x50, 0x07, 0xAE, 0x7C, 0x59, 0xFF, 0x00, 0x96, 0x3F,
+    0xF6, 0xD3, 0xFF, 0x00, 0x69, 0xD7, 0x9E, 0xD7, 0xA1, 0x7C, 0x59, 0xFF, 0x00, 0x96, 0x3F, 0xF6,
+    0xD3, 0xFF, 0x00, 0x69, 0xD7, 0x9E, 0xD7, 0xAB, 0x9B, 0x7C, 0x6F, 0xE5, 0xF9, 0x23, 0x8F, 0x05,
+    0xF0, 0xAF, 0x9F, 0xE6, 0x14, 0x51, 0x45, 0x79, 0xA7, 0x50, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45,
+    0x14, 0x00, 0x51, 0x45, 0x14, 0x00, 0x51, 0x45, 0x14, 0x01, 0xD7, 0x49, 0xF1, 0x3F, 0x5A, 0x66,
+    0x0F, 0x2B, 0xC6, 0x6E, 0x03, 0xFD, 0xAE, 0xE6, 0xED, 0x5A, 0x45, 0x37, 0x6E, 0x60, 0x29, 0xFB,
+    0xC8, 0x23, 0x90, 0x28, 0x26, 0x03, 0xB7, 0x72, 0x46, 0x8E, 0x00, 0x04, 0x30, 0x3C, 0xD4, 0x6D,
+    0xF1, 0x2B, 0x59, 0x76, 0x76, 0xBB, 0x78, 0x2E, 0x25, 0x78, 0x24, 0xD0, 0x2E, 0x67, 0x94, 0x1C,
+    0xB5, 0xAD, 0xDC, 0xCC, 0xC4, 0xAE, 0x18, 0x60, 0xA3, 0x36, 0x06, 0x06, 0xD0, 0x30, 0x36, 0xD7,
+    0x2B, 0x45, 0x03, 0x3A, 0x06, 0xF1, 0x94, 0xE5, 0xA5, 0x63, 0xA7, 0x69, 0xBE, 0x7C, 0xAF, 0x2D,
+    0xD5, 0xD5, 0xDE, 0xD6, 0xDC, 0x8B, 0x7D, 0x04, 0xAA, 0x52, 0x02, 0x5F, 0x85, 0x51, 0x2B, 0x11,
+    0xC6, 0x49, 0xC6, 0xE2, 0x40, 0x02, 0xA3, 0x1E, 0x31, 0xD4, 0x1A, 0x45, 0x6B, 0xFF, 0x00, 0x22,
+    0xF2, 0x30, 0xCB, 0x73, 0xFD, 0x95, 0x2A, 0xE2, 0x09, 0x26, 0x82, 0x10, 0x8A, 0x5E, 0xCA, 0x12,
+    0x83, 0xF7, 0x71, 0xA8, 0x1C, 0x00, 0x08, 0x18, 0x39, 0x19, 0x07, 0x0E, 0x8A, 0x04, 0x75, 0x43,
+    0xE2, 0x3E, 0xA4, 0x4B, 0xFD, 0xA2, 0xDE, 0xC6, 0x74, 0x6F, 0x2D, 0x1E, 0xDA, 0x55, 0x62, 0x82,
+    0x0B, 0x5B, 0xB3, 0x20, 0x59, 0x23, 0x0E, 0x37, 0x79, 0xB2, 0x93, 0xB9, 0x9F, 0x7C, 0x84, 0x13,
+    0x96, 0xC9, 0x24, 0xC9, 0x7D, 0xF1, 0x3B, 0x57, 0x9A, 0x19, 0x63, 0x91, 0x2D, 0x04, 0x72, 0x3B,
+    0x5E, 0xB3, 0x28, 0x6D, 0xD6, 0x73, 0xDC, 0xCA, 0xE5, 0x8D, 0x93, 0xB3, 0x9D, 0xA2, 0x74, 0x72,
+    0x84, 0x74, 0x2B, 0x9E, 0x32, 0xCC, 0x5B, 0x91, 0xA2, 0x81, 0x9D, 0x77, 0x8B, 0x7E, 0x26, 0xEA,
+    0x9A, 0xA4, 0x65, 0x35, 0x0B, 0x6D, 0x36, 0x34, 0x32, 0x0D, 0x4D, 0x9A, 0x08, 0xC8, 0x3E, 0x74,
+    0x70, 0x6C, 0xC1, 0x62, 0xC7, 0x23, 0x67, 0xAE, 0x5B, 0xB6, 0x70, 0x00, 0x18, 0x7A, 0x56, 0xB9,
+    0x2D, 0xB2, 0xB0, 0x4B, 0x6B, 0x49, 0x95, 0x8A, 0xCA, 0xCB, 0x3A, 0xEE, 0x0B, 0x24, 0x21, 0xB0,
+    0x44, 0x44, 0xE3, 0x28, 0xCD, 0x9E, 0x54, 0xFF, 0x00, 0x74, 0xFC, 0x8C, 0xEA, 0xD9, 0xB4, 0x50,
+    0x23, 0x66, 0x2F, 0x15, 0xDF, 0x2A, 0xB0, 0x26, 0x39, 0x03, 0x07, 0x17, 0x72, 0x49, 0x92, 0xD3,
+    0x4F, 0x74, 0x18, 0x33, 0x89, 0xD9, 0xB2, 0x1A, 0x45, 0x20, 0x36, 0xD6, 0x50, 0xE0, 0x01, 0x20,
+    0x61, 0x9C, 0xBF, 0x56, 0xF1, 0x8E, 0xA1, 0x77, 0x0A, 0xC7, 0x79, 0xE4, 0x79, 0x6A, 0xDE, 0x75,
+    0xB2, 0xC4, 0xBB, 0x16, 0x21, 0x86, 0xE1, 0x2C, 0xE1, 0x2A, 0x9C, 0xB3, 0x31, 0xCF, 0x95, 0xBF,
+    0x9F, 0xBD, 0x8E, 0x2B, 0x0E, 0x8A, 0x00, 0xBD, 0x63, 0xAC, 0xDC, 0xC0, 0xAC, 0xB6, 0xEF, 0x85,
+    0x66, 0x49, 0xE7, 0x42, 0x49, 0x59, 0xBE, 0xCC, 0x49, 0x02, 0xE2, 0xDC, 0x9D, 0xAC, 0x37, 0x10,
+    0x70, 0xC8, 0xDD, 0x38, 0xC0, 0xCE, 0x6F, 0x0F, 0x19, 0x6A, 0x5F, 0xC5, 0x36, 0xE2, 0x62, 0x93,
+    0x47, 0xBB, 0x90, 0x96, 0xDD, 0x77, 0x6F, 0x75, 0x70, 0xEE, 0x4D, 0xC4, 0xA1, 0xB3, 0x93, 0x33,
+    0xE7, 0xA8, 0x07, 0x18, 0x60, 0x41, 0x60, 0x70, 0xE8, 0xA0, 0x0E, 0xAA, 0x5F, 0x88, 0xFA, 0x93,
+    0x95, 0xFB, 0x45, 0xBD, 0x8C, 0xA8, 0xBE, 0x6A, 0x1B, 0x72, 0xAC, 0x05, 0xC4, 0x17, 0xB1, 0x3A,
+    0x95, 0xBB, 0x91, 0x1C, 0x33, 0x79, 0x42, 0x49, 0x08, 0x62, 0xE6, 0x4C, 0xB3, 0x16, 0x62, 0x49,
+    0xA2, 0xFF, 0x00, 0xE2, 0x5E, 0xB5, 0x29, 0x05, 0x0D, 0x8D, 0xB3, 0x08, 0xA3, 0xD1, 0xF7, 0xC1,
+    0x0A, 0x03, 0xF6, 0x7B, 0x57, 0x2C, 0xA6, 0x22, 0x41, 0xDA, 0x56, 0x42, 0x0F, 0xC9, 0xB0, 0x02,
+    0x01, 0x50, 0x08, 0x18, 0xE5, 0x68, 0xA0, 0x67, 0x41, 0x1F, 0x8C, 0xA7, 0x42, 0xE6, 0x0D, 0x3B,
+    0x4D, 0x59, 0x24, 0x12, 0xC7, 0x7F, 0x72, 0xCA, 0xCE, 0xF3, 0xAD, 0xF2, 0xB8, 0x38, 0xB8, 0x9D,
+    0xDC, 0x83, 0x12, 0xB9, 0xC1, 0x56, 0x52, 0xDF, 0xF2, 0xD3, 0x7D, 0x12, 0x78, 0xF7, 0x5F, 0x66,
+    0x06, 0x4D, 0x52, 0x46, 0x0A, 0x3C, 0xAB, 0x7B, 0x36, 0x55, 0xF2, 0x61, 0x8C, 0xC0, 0x53, 0x11,
+    0xE9, 0xE5, 0x76, 0x00, 0x61, 0x62, 0xBF, 0xEA, 0xFB, 0x9A, 0xE7, 0xE8, 0xA0, 0x46, 0xCC, 0xFE,
+    0x2A, 0xBD, 0x9A, 0x52, 0xFA, 0x8B, 0x49, 0x78, 0x08, 0x30, 0x49, 0x67, 0x71, 0x2C, 0xC5, 0x5A,
+    0xD8, 0xBE, 0x42, 0x33, 0xF9, 0x81, 0xB6, 0xC3, 0x26, 0x18, 0x0F, 0x33, 0xA8, 0x04, 0xE6, 0xB3,
+    0x6F, 0xEE, 0xDE, 0x67, 0x66, 0x90, 0x61, 0x99, 0x9A, 0xE2, 0x41, 0x96, 0x38, 0x69, 0x18, 0x9F,
+    0xBF, 0x21, 0x62, 0x79, 0x3D, 0xD8, 0x93, 0xDC, 0x93, 0x50, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40, 0x05, 0x14, 0x51, 0x40,
+    0x18, 0xB4, 0x51, 0x45, 0x41, 0x41, 0x45, 0x14, 0x50, 0x07, 0xAE, 0x7C, 0x59, 0xFF, 0x00, 0x96,
+    0x3F, 0xF6, 0xD3, 0xFF, 0x00, 0x69, 0xD7, 0x9E, 0xD6, 0x2D, 0x15, 0xD5, 0x8B, 0xAF, 0xCC, 0xDB,
+    0xE4, 0xB5, 0xFA, 0x7C, 0xAC, 0x63, 0x46, 0x9D, 0x95, 0xB9, 0xAE, 0x6D, 0x51, 0x58, 0xB4, 0x57,
+    0x3D, 0xCD, 0x6C, 0x6D, 0x51, 0x58, 0xB4, 0x51, 0x70, 0xB1, 0xB5, 0x45, 0x62, 0xD1, 0x45, 0xC2,
+    0xC6, 0xD5, 0x15, 0x8B, 0x45, 0x17, 0x0B, 0x1B, 0x54, 0x56, 0x2D, 0x14, 0x5C, 0x2C, 0x6D, 0x51,
+    0x58, 0xB4, 0x51, 0x70, 0xB1, 0xB5, 0x45, 0x62, 0xD1, 0x45, 0xC2, 0xC6, 0xD5, 0x15, 0x8B, 0x45,
+    0x17, 0x0B, 0x1B, 0x54, 0x56, 0x2D, 0x14, 0x5C, 0x2C, 0x6D, 0x51, 0x58, 0xB4, 0x51, 0x70, 0xB1,
+    0xB5, 0x45, 0x62, 0xD1, 0x45, 0xC2, 0xC6, 0xD5, 0x15, 0x8B, 0x45, 0x17, 0x0B, 0x1B, 0x54, 0x56,
+    0x2D, 0x14, 0x5C, 0x2C, 0x6D, 0x51, 0x58, 0xB4, 0x51, 0x70, 0xB1, 0xB5, 0x45, 0x62, 0xD1, 0x45,
+    0xC2, 0xC6, 0xD5, 0x15, 0x8B, 0x45, 0x17, 0x0B, 0x1B, 0x54, 0x56, 0x2D, 0x14, 0x5C, 0x2C, 0x6D,
+    0x51, 0x58, 0xB4, 0x51, 0x70, 0xB1, 0xB5, 0x45, 0x62, 0xD1, 0x45, 0xC2, 0xC6, 0xD5, 0x15, 0x8B,
+    0x45, 0x17, 0x0B, 0x1B, 0x54, 0x56, 0x2D, 0x14, 0x5C, 0x2C, 0x6D, 0x51, 0x58, 0xB4, 0x51, 0x70,
+    0xB1, 0xB5, 0x45, 0x62, 0xD1, 0x45, 0xC2, 0xC6, 0xD5, 0x15, 0x8B, 0x45, 0x17, 0x0B, 0x1B, 0x54,
+    0x56, 0x2D, 0x14, 0x5C, 0x2C, 0x6D, 0x51, 0x58, 0xB4, 0x51, 0x70, 0xB1, 0xB5, 0x45, 0x62, 0xD1,
+    0x45, 0xC2, 0xC1, 0x45, 0x14, 0x54, 0x8C, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28, 0xA2, 0x8A, 0x00, 0x28,
+    0xA2, 0x8A, 0x00, 0x28, 0xA2, 0xBE, 0xBA, 0x35, 0xDF, 0x82, 0xC3, 0x73, 0x5F, 0xF7, 0x96, 0xB5,
+    0xBA, 0x5E, 0xE7, 0x91, 0x9A, 0xE3, 0xF9, 0x2D, 0xFB, 0x9E, 0x6B, 0xDF, 0xAD, 0xAD, 0x6B, 0x79,
+    0x3E, 0xE7, 0xC8, 0xB4, 0x57, 0xD7, 0x34, 0xEE, 0xD5, 0xDF, 0xFD, 0x99, 0xFF, 0x00, 0x51, 0x1F,
+    0x87, 0xFC, 0x13, 0xC9, 0x59, 0xEF, 0xFD, 0x41, 0x7F, 0xE4, 0xDF, 0xF0, 0x0F, 0x91, 0x28, 0xAF,
+    0xAE, 0x4D, 0x2A, 0xD4, 0xBC, 0xB7, 0xFE, 0xA2, 0x3F, 0x0F, 0xF8, 0x25, 0xAC, 0xEF, 0xFE, 0xA0,
+    0xFF, 0x00, 0xF2, 0x6F, 0xF8, 0x07, 0xC8, 0xB4, 0x57, 0xD7, 0x2F, 0x42, 0xD2, 0xFE, 0xCE, 0xFF,
+    0x00, 0xA8, 0x8F, 0xC3, 0xFE, 0x09, 0x6B, 0x39, 0xFF, 0x00, 0xA8, 0x4F, 0xC7, 0xFE, 0x01, 0xF2,
+    0x35, 0x15, 0xF5, 0xD1, 0xA6, 0x8A, 0x9F, 0xEC, 0xFF, 0x00, 0xFA, 0x7F, 0xF8, 0x7F, 0xC1, 0x34,
+    0x59, 0xBF, 0xFD, 0x42, 0xFE, 0x3F, 0xF0, 0x0F, 0x91, 0xE8, 0xAF, 0xAE, 0xA8, 0xA5, 0xF5, 0x0F,
+    0xFA, 0x7F, 0xF8, 0x7F, 0xC1, 0x2B, 0xFB, 0x57, 0xFE, 0xA1, 0xBF, 0x1F, 0xF8, 0x07, 0xC8, 0xB4,
+    0x57, 0xD7, 0x34, 0x54, 0xFD, 0x47, 0xFE, 0x9F, 0x7E, 0x1F, 0xF0, 0x4D, 0x3F, 0xB4, 0xFF, 0x00,
+    0xEA, 0x1F, 0xF1, 0xFF, 0x00, 0x80, 0x7C, 0x8D, 0x45, 0x7D, 0x76, 0xD4, 0xC3, 0x49, 0xE0, 0xBF,
+    0xE9, 0xF7, 0xE1, 0xFF, 0x00, 0x04, 0xBF, 0xED, 0x1F, 0xFA, 0x71, 0xF8, 0xFF, 0x00, 0xC0, 0x3E,
+    0x47, 0xA2, 0xBE, 0xBA, 0x14, 0x8D, 0x53, 0xF5, 0x3F, 0xFA, 0x7B, 0xF8, 0x7F, 0xC1, 0x2D, 0x63,
+    0xFF, 0x00, 0xE9, 0xCF, 0xE3, 0xFF, 0x00, 0x00, 0xF9, 0x1A, 0x8A, 0xFA, 0xE9, 0x68, 0xA4, 0xF0,
+    0x9F, 0xF4, 0xF7, 0xF0, 0xFF, 0x00, 0x82, 0x5A, 0xC6, 0xFF, 0x00, 0xD3, 0x9F, 0xC7, 0xFE, 0x01,
+    0xF2, 0x2D, 0x15, 0xF5, 0xC2, 0xD3, 0xA9, 0x7D, 0x57, 0xFE, 0x9E, 0xFE, 0x1F, 0xF0, 0x4B, 0x58,
+    0xBF, 0xFA, 0x75, 0xF8, 0xFF, 0x00, 0xC0, 0x3E, 0x45, 0xA2, 0xBE, 0xB9, 0x34, 0x54, 0xBC, 0x37,
+    0xFD, 0x3C, 0xFC, 0x0B, 0x58, 0x9F, 0xFA, 0x77, 0xF8, 0x9F, 0x23, 0x51, 0x5F, 0x5C, 0x8A, 0x56,
+    0xA5, 0xF5, 0x6F, 0xFA, 0x79, 0xF8, 0x16, 0xAB, 0xFF, 0x00, 0x70, 0xF9, 0x16, 0x8A, 0xFA, 0xE0,
+    0xD3, 0xEA, 0x5D, 0x0F, 0xEF, 0x9A, 0x2A, 0xBF, 0xDD, 0x3E, 0x44, 0xA2, 0xBE, 0xB8, 0x34, 0xFA,
+    0x5E, 0xC3, 0xFB, 0xE5, 0xA9, 0xF9, 0x1F, 0x22, 0x51, 0x5F, 0x5C, 0xB5, 0x0B, 0x53, 0xEC, 0xBF,
+    0xBC, 0x5A, 0x67, 0xC8, 0xD4, 0x57, 0xD7, 0x54, 0x86, 0x93, 0xA5, 0xFD, 0xE2, 0xD2, 0x3E, 0x46,
+    0xA2, 0xBE, 0xB9, 0xA5, 0x5A, 0x9F, 0x67, 0xFD, 0xE2, 0xD4, 0x3C, 0xCF, 0x91, 0x68, 0xAF, 0xAE,
+    0x4D, 0x0B, 0x49, 0xC3, 0xCC, 0xB5, 0x4B, 0xFB, 0xC7, 0xC8, 0xD4, 0x57, 0xD7, 0x66, 0x99, 0x53,
+    0xCB, 0xE6, 0x5F, 0xB0, 0xFE, 0xF9, 0xF2, 0x3D, 0x15, 0xF5, 0xD9, 0xA6, 0xB5, 0x4B, 0x45, 0xFD,
+    0x5B, 0xFE, 0x9E, 0x7E, 0x07, 0xC8, 0xD4, 0x57, 0xD7, 0x42, 0x8A, 0x0B, 0xFA, 0xA7, 0xFD, 0x3D,
+    0xFC, 0x3F, 0xE0, 0x9F, 0x22, 0xD1, 0x5F, 0x5C, 0x9A, 0x2A, 0x2F, 0xE4, 0x68, 0xB0, 0x5F, 0xF4,
+    0xFB, 0xF0, 0xFF, 0x00, 0x82, 0x7C, 0x8D, 0x45, 0x7D, 0x76, 0xB4, 0xDA, 0x5C, 0xDE, 0x45, 0xAC,
+    0x07, 0xFD, 0x3E, 0xFC, 0x3F, 0xE0, 0x9F, 0x23, 0x51, 0x5F, 0x5C, 0xAD, 0x2B, 0x54, 0xF3, 0xF9,
+    0x16, 0xB2, 0xEF, 0xFA, 0x7F, 0xF8, 0x7F, 0xC1, 0x3E, 0x45, 0xA2, 0xBE, 0xB8, 0x5A, 0x71, 0xA1,
+    0xCF, 0xFB, 0xA5, 0xAC, 0xB3, 0xFE, 0xA2, 0x3F, 0x0F, 0xF8, 0x27, 0xC8, 0xB4, 0x57, 0xD7, 0x06,
+    0x9D, 0x53, 0xED, 0x7F, 0xBA, 0x5A, 0xCA, 0xBF, 0xEA, 0x27, 0xF0, 0xFF, 0x00, 0x82, 0x7C, 0x8B,
+    0x45, 0x7D, 0x75, 0x5F, 0x22, 0xD5, 0xC2, 0x57, 0xE8, 0x79, 0xF8, 0xFC, 0x27, 0x2D, 0xBF, 0x7B,
+    0x7B, 0xDF, 0xA5, 0xAD, 0x6B, 0x79, 0x85, 0x14, 0x51, 0x5A, 0x1E, 0x70, 0x51, 0x45, 0x14, 0x00,
+    0x57, 0xD7, 0x46, 0xBE, 0x45, 0xA2, 0xBB, 0xF0, 0x58, 0x9E, 0x5B, 0xFE, 0xEE, 0xF7, 0xB7, 0x5B,
+    0x58, 0xF2, 0x33, 0x5C, 0x07, 0x3D, 0xBF, 0x7D, 0xCB, 0x6B, 0xF4, 0xBD, 0xEF, 0x6F, 0x35, 0xD8,
+    0xFA, 0xE6, 0x9D, 0xDA, 0xBE, 0x44, 0xA2, 0xBB, 0xFF, 0x00, 0xB4, 0xFF, 0x00, 0xEA, 0x1F, 0xF1,
+    0xFF, 0x00, 0x80, 0x79, 0x2B, 0x22, 0xFF, 0x00, 0xA8, 0xDF, 0xFC, 0x97, 0xFE, 0x09, 0xF5, 0xC9,
+    0xA5, 0x5A, 0xF9, 0x16, 0x8A, 0x97, 0x99, 0x7F, 0xD4, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0xB5, 0x92,
+    0x7F, 0xD4, 0x67, 0xFE, 0x4B, 0xFF, 0x00, 0x04, 0xFA, 0xE5, 0xE8, 0x5A, 0xF9, 0x1A, 0x8A, 0x5F,
+    0xDA, 0x3F, 0xF5, 0x0F, 0xF8, 0xFF, 0x00, 0xC0, 0x2D, 0x64, 0xDF, 0xF5, 0x17, 0xF8, 0x7F, 0xC1,
+    0x3E, 0xBA, 0x34, 0xD1, 0x5F, 0x23, 0xD1, 0x53, 0xFD, 0xA1, 0xFF, 0x00, 0x4E, 0x3F, 0x1F, 0xF8,
+    0x06, 0x8B, 0x28, 0xFF, 0x00, 0xA8, 0xAF, 0xC3, 0xFE, 0x09, 0xF5, 0xD5, 0x15, 0xF2, 0x2D, 0x14,
+    0xBE, 0xBF, 0xFF, 0x00, 0x4E, 0x3F, 0x1F, 0xF8, 0x05, 0x7F, 0x65, 0x7F, 0xD4, 0x4F, 0xE1, 0xFF,
+    0x00, 0x04, 0xFA, 0xE6, 0x8A, 0xF9, 0x1A, 0x8A, 0x9F, 0xAF, 0x7F, 0xD3, 0x9F, 0xC7, 0xFE, 0x01,
+    0xA7, 0xF6, 0x67, 0xFD, 0x44, 0x7E, 0x1F, 0xF0, 0x4F, 0xAE, 0xDA, 0x98, 0x6B, 0xE4, 0x7A, 0x29,
+    0x3C, 0x6F, 0xFD, 0x39, 0xFC, 0x7F, 0xE0, 0x17, 0xFD, 0x9D, 0xFF, 0x00, 0x4F, 0xFF, 0x00, 0x0F,
+    0xF8, 0x27, 0xD7, 0x42, 0x91, 0xAB, 0xE4, 0x6A, 0x2A, 0x7E, 0xB9, 0xFF, 0x00, 0x4E, 0xBF, 0x1F,
+    0xF8, 0x05, 0xAC, 0x07, 0xFD, 0x3E, 0xFC, 0x3F, 0xE0, 0x9F, 0x5D, 0x2D, 0x15, 0xF2, 0x2D, 0x14,
+    0x9E, 0x2F, 0xFE, 0x9D, 0x7E, 0x3F, 0xF0, 0x0B, 0x58, 0x2F, 0xFA, 0x7D, 0xF8, 0x7F, 0xC1, 0x3E,
+    0xB8, 0x5A, 0x75, 0x7C, 0x8B, 0x45, 0x2F, 0xAD, 0x7F, 0xD3, 0xAF, 0xC7, 0xFE, 0x01, 0x6B, 0x09,
+    0xFF, 0x00, 0x4F, 0x7F, 0x0F, 0xF8, 0x27, 0xD7, 0x26, 0x8A, 0xF9, 0x1A, 0x8A, 0x97, 0x89, 0xFF,
+    0x00, 0xA7, 0x7F, 0x89, 0x6B, 0x0D, 0xFF, 0x00, 0x4F, 0x3F, 0x03, 0xEB, 0x91, 0x4A, 0xD5, 0xF2,
+    0x2D, 0x14, 0xBE, 0xB3, 0xFF, 0x00, 0x4E, 0xFF, 0x00, 0x12, 0xD5, 0x0F, 0xEF, 0x9F, 0x5C, 0x1A,
+    0x7D, 0x7C, 0x89, 0x45, 0x4B, 0xAF, 0xFD, 0xC3, 0x45, 0x4B, 0xFB, 0xC7, 0xD7, 0x06, 0x9F, 0x5F,
+    0x22, 0x51, 0x4B, 0xDB, 0xFF, 0x00, 0x70, 0xB5, 0x0F, 0x33, 0xEB, 0x96, 0xA1, 0x6B, 0xE4, 0x6A,
+    0x2A, 0x7D, 0xAF, 0xF7, 0x4B, 0x48, 0xFA, 0xEA, 0x90, 0xD7, 0xC8, 0xD4, 0x52, 0x75, 0x7F, 0xBA,
+    0x5A, 0x67, 0xD7, 0x34, 0xAB, 0x5F, 0x22, 0xD1, 0x53, 0xED, 0x3F, 0xBA, 0x5A, 0x9F, 0x91, 0xF5,
+    0xC9, 0xA1, 0x6B, 0xE4, 0x6A, 0x29, 0x39, 0xF9, 0x16, 0xAA, 0xFF, 0x00, 0x74, 0xFA, 0xEC, 0xD3,
+    0x2B, 0xE4, 0x7A, 0x2A, 0x79, 0xBC, 0x8B, 0xF6, 0xFF, 0x00, 0xDC, 0x3E, 0xBB, 0x34, 0xD6, 0xAF,
+    0x91, 0xA8, 0xA9, 0x6C, 0xBF, 0xAC, 0xFF, 0x00, 0xD3, 0xBF, 0xC4, 0xFA, 0xE8, 0x51, 0x5F, 0x22,
+    0xD1, 0x41, 0x7F, 0x5B, 0xFF, 0x00, 0xA7, 0x5F, 0x8F, 0xFC, 0x03, 0xEB, 0x93, 0x45, 0x7C, 0x8D,
+    0x45, 0x45, 0xBC, 0xCD, 0x16, 0x37, 0xFE, 0x9C, 0xFE, 0x3F, 0xF0, 0x0F, 0xAE, 0xD6, 0x9B, 0x5F,
+    0x23, 0x51, 0x4B, 0x97, 0xCC, 0xB5, 0x8F, 0xFF, 0x00, 0xA7, 0x3F, 0x8F, 0xFC, 0x03, 0xEB, 0x95,
+    0xA5, 0x6A, 0xF9, 0x16, 0x8A, 0x9E, 0x4F, 0x32, 0xD6, 0x63, 0xFF, 0x00, 0x4E, 0x3F, 0x1F, 0xF8,
+    0x07, 0xD7, 0x0B, 0x4E, 0x35, 0xF2, 0x2D, 0x14, 0x38, 0x7F, 0x78, 0xB5, 0x99, 0xFF, 0x00, 0xD4,
+    0x3F, 0xE3, 0xFF, 0x00, 0x00, 0xFA, 0xE0, 0xD3, 0xAB, 0xE4, 0x5A, 0x2A, 0x7D, 0x97, 0xF7, 0x8B,
+    0x59, 0xAF, 0xFD, 0x43, 0x7E, 0x3F, 0xF0, 0x0F, 0xAE, 0xAB, 0xE4, 0x5A, 0x28, 0xAB, 0x84, 0x6D,
+    0xD4, 0xF3, 0xF1, 0xF8, 0xBE, 0x6B, 0x7E, 0xEA, 0xD6, 0xBF, 0x5B, 0xDE, 0xF6, 0xF2, 0x0A, 0x28,
+    0xA2, 0xB4, 0x3C, 0xE0, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00,
+    0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD9,
+};
+
+#define BENCH_UI_QOI_SIZE  21030
+
+static const uint8_t BENCH_UI_QOI[BENCH_UI_QOI_SIZE] = {
+    0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x03, 0x00, 0xFE, 0x29,
+    0x3C, 0x7B, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC4, 0xFE, 0xF7,
+    0xF3, 0xF7, 0xC1, 0x39, 0xC1, 0x1A, 0xC1, 0x39, 0xC1, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0x39, 0x1A,
+    0x39, 0x1A, 0xC1, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xC2, 0x1A, 0x39,
+    0xC3, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0xC5, 0x1A, 0xC3, 0x39, 0x1A, 0x39, 0x1A, 0xC0, 0x39,
+    0xC0, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39,
+    0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC1, 0x1A, 0x39, 0x1A, 0xC1,
+    0x39, 0x1A, 0x39, 0x1A, 0xC1, 0x39, 0x1A, 0x39, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC0, 0x1A,
+    0xC0, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC2, 0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC1,
+    0x39, 0xC2, 0x1A, 0xC0, 0x39, 0xC2, 0x1A, 0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A, 0x39, 0xC2, 0x1A,
+    0xC1, 0x39, 0xC7, 0x1A, 0xC0, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0xC1, 0x39, 0xC2, 0x1A, 0xC2, 0x39,
+    0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC3, 0x39, 0x1A, 0xC0, 0x39, 0xC3, 0x1A, 0xC1, 0x39,
+    0xC1, 0x1A, 0x39, 0x1A, 0x39, 0xC1, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC0, 0x1A, 0xC2, 0x39, 0x1A, 0xC1, 0x39, 0xC2, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC1, 0x1A,
+    0xC0, 0x39, 0xC2, 0x1A, 0xC1, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC1, 0x1A, 0xC1, 0x39,
+    0xC1, 0x1A, 0xC1, 0x39, 0xC5, 0x1A, 0xC1, 0x39, 0x1A, 0x39, 0xC1, 0x1A, 0xC0, 0x39, 0xC0, 0x1A,
+    0xC1, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC1, 0x39, 0xC0, 0x1A, 0xC1, 0x39, 0xC3, 0x1A, 0x39, 0x1A,
+    0x39, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0xC1, 0x39,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC1, 0x1A, 0xC3, 0x39, 0xC2, 0x1A, 0xC0, 0x39, 0xC0, 0x1A,
+    0x39, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0xC2, 0x39, 0xC1, 0x1A, 0x39,
+    0x1A, 0xC0, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0xC3, 0x39, 0xC6, 0x1A, 0x39, 0x1A,
+    0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0x39,
+    0xC0, 0x1A, 0xC0, 0x39, 0xC2, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0x39,
+    0x1A, 0xC1, 0x39, 0xC0, 0x1A, 0xC1, 0x39, 0xC3, 0x1A, 0xC0, 0x39, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0x1A, 0xC1, 0x39, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0xC2, 0x39,
+    0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0x1A, 0xC1, 0x39, 0x1A, 0xC1, 0x39, 0x1A, 0x39,
+    0x1A, 0xC0, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xC5, 0x1A, 0x39, 0x1A,
+    0xC1, 0x39, 0x1A, 0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC3, 0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A,
+    0x39, 0x1A, 0xC3, 0x39, 0xC1, 0x1A, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC2, 0x39, 0x1A, 0x39, 0x1A,
+    0xC1, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC1, 0x1A,
+    0xC0, 0x39, 0xC0, 0x1A, 0x39, 0x1A, 0xC1, 0x39, 0x1A, 0xC0, 0x39, 0xC2, 0x1A, 0xC1, 0x39, 0x1A,
+    0x39, 0x1A, 0xC1, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0x1A, 0x39, 0x1A, 0x39,
+    0xC1, 0x1A, 0xC1, 0x39, 0x1A, 0x39, 0xC5, 0x1A, 0x39, 0x1A, 0xC0, 0x39, 0xC1, 0x1A, 0x39, 0x1A,
+    0xC0, 0x39, 0x1A, 0xC3, 0x39, 0xC2, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0xC0,
+    0x1A, 0x39, 0xC2, 0x1A, 0xC2, 0x39, 0xC0, 0x1A, 0xC0, 0x39, 0xC2, 0x1A, 0xC3, 0x39, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0x1A, 0x39, 0xC1, 0x1A, 0x39, 0x1A, 0xC3, 0x39, 0xC6, 0x1A, 0x39, 0x1A,
+    0xC0, 0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A, 0x39, 0xC0, 0x1A, 0xC2, 0x39, 0xC2, 0x1A, 0xC0, 0x39,
+    0xC0, 0x1A, 0xC2, 0x39, 0xC5, 0x1A, 0x39, 0x1A, 0xC1, 0x39, 0x1A, 0xC2, 0x39, 0xC0, 0x1A, 0xC1,
+    0x39, 0x1A, 0x39, 0x1A, 0xC3, 0x39, 0x1A, 0xC1, 0x39, 0xC4, 0x1A, 0xC0, 0x39, 0x1A, 0x39, 0xC9,
+    0x1A, 0xC2, 0x39, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD4, 0xFE, 0x10, 0x14, 0x18,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0xFE, 0xFF, 0xA2,
+    0x00, 0xC2, 0xFE, 0x21, 0x28, 0x31, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xDC, 0xFE, 0xCE, 0xCF, 0xD6, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xCB, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3,
+    0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xF4, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xDD, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xCC, 0x04, 0xC1,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0xC6, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC0,
+    0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xFD, 0xDE, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC3, 0x37, 0xC7, 0x04, 0x37, 0xC3, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xCB, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC2,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC7,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0xC0,
+    0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xF4, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xFD, 0xDD, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC8, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xCB, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04,
+    0xC2, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC8, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0xC2, 0x37, 0xC3, 0x04, 0x37,
+    0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xF3, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xCB, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC6, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC3, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xDF,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC9, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xCE, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0xC7, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xCB, 0x04, 0x37, 0xC5, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xF6, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xFD, 0xDC, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xCE, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC9, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC4,
+    0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xCC,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xF5, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xE7, 0xFE, 0xCE, 0xCB, 0xDE, 0xCD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCE, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCC, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC9, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC5, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC4, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC3, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xD5, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC9, 0x04, 0xC3, 0x37, 0xC5,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xFD, 0xEB, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xD5, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC3,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37,
+    0xC3, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC2, 0x37,
+    0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xD5, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC8, 0x04, 0xC1, 0x37, 0xC6,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC8, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC8, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD8, 0x28, 0xEB, 0x37, 0xD3, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC7,
+    0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC3, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xFD, 0xEC, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC3, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7,
+    0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37,
+    0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD2,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC6, 0x04,
+    0x37, 0xC3, 0x04, 0xC3, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0x37, 0xCB, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD4, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC8, 0x04,
+    0xC2, 0x37, 0xC6, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC7, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0x37, 0xCB, 0x04,
+    0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA,
+    0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE,
+    0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5,
+    0x28, 0xF1, 0x37, 0xD0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0xC5, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xFD,
+    0xFD, 0xF8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD0, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC1,
+    0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC9, 0x04, 0xC0, 0x37, 0xFD, 0xFD,
+    0xF7, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD2, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37,
+    0x04, 0x37, 0xC7, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0xFD, 0xFD,
+    0xF6, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD0, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC9, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xFD, 0xFD, 0xF5, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xD1, 0x04, 0xC3, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC3, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xFD, 0xFD, 0xF5, 0x31, 0xDE,
+    0x1C, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xD1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3,
+    0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37,
+    0x04, 0x37, 0xFD, 0xFD, 0xF6, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD3, 0x04,
+    0xC2, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04,
+    0xC3, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0xC4, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC8, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04,
+    0xC0, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xFD, 0xFD, 0xF5, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFC, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFC, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD8, 0x28, 0xEB, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC0, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC0, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC1, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC2, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC3, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC4, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC5, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC6, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC9, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xE6, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xCD, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xE7, 0x28, 0xCD, 0x37, 0xE8, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xCB, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xE3, 0x04, 0xC2,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC2, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xCC, 0x04, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xE2, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xCC, 0x04, 0xC3, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xFD, 0xE2, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0xCC, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xFD, 0xE4, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC1, 0x37, 0xC8, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xCD, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xE2, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC4, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC4, 0x04, 0xC1, 0x37, 0xC2, 0x04,
+    0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37,
+    0xC1, 0x04, 0x37, 0xCC, 0x04, 0xC1, 0x37, 0xFD, 0xFD, 0xFD, 0xDC, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x1C, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD6, 0xFE, 0x00, 0xCB, 0x7B, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xFD, 0xDC, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0xC5, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04,
+    0xC3, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0xC1, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04,
+    0xC0, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC6,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC6, 0x04, 0xC1, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xF4, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04,
+    0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04,
+    0xC1, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04,
+    0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0xC3, 0x37, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC6, 0x04,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xF3, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xFD, 0xDC, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04,
+    0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC8, 0x04,
+    0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0xC3, 0x37, 0xF3, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xFD, 0xDF, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDC,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0xC2, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0xC4, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC8,
+    0x04, 0x37, 0xC7, 0x04, 0x37, 0xC4, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC3, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xF4, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0x37, 0xC4, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC2, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC9, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC9,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC7, 0x04, 0x37,
+    0xC5, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC2, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC2,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xE7, 0x28, 0xCD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCE, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCC, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC9, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC5, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC4, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC3, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xD5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC9, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37,
+    0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xFD, 0xEC, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xD5,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC3, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37,
+    0xC7, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC3, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD9, 0x28,
+    0xE9, 0x37, 0xD4, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC9, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC1, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37,
+    0xFD, 0xEC, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD8, 0x28, 0xEB, 0x37, 0xD4, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC2, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xFD, 0xEB, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD2, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC6, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xFD, 0xEB, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC1, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC9, 0x04, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x09, 0xC2,
+    0x37, 0xD7, 0x28, 0xED, 0x37, 0xD3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC4, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC2, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2,
+    0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5,
+    0x28, 0xF1, 0x37, 0xD0, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC9,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xFD, 0xFD, 0xE4,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6,
+    0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37, 0x04,
+    0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04,
+    0x37, 0xC2, 0x04, 0xC3, 0x37, 0xFD, 0xFD, 0xE3, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1,
+    0x37, 0xD0, 0x04, 0xC2, 0x37, 0xC8, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC1, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xFD, 0xFD, 0xE5,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC6,
+    0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0xFD, 0xFD, 0xE4, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xD2,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37, 0xC3, 0x04,
+    0x37, 0xC3, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC9, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xFD, 0xFD, 0xE3, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37,
+    0xD3, 0x04, 0x37, 0xC7, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC8, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0xC8, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xFD, 0xFD, 0xE5, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD4,
+    0x04, 0x37, 0xC7, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC0,
+    0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0x37,
+    0xC4, 0x04, 0xC2, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC6, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xFD, 0xFD,
+    0xE9, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xD8, 0x28, 0xEB, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC0, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC0, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC1, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC3, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC4, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC5, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC9, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xE0, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC5,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xFD, 0xFD,
+    0xFD, 0xDB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xE7, 0x28, 0xCD, 0x37, 0xE2, 0x04, 0xC1, 0x37, 0xC8,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC1, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xFD, 0xDE, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0x04,
+    0xC2, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0xFD, 0xFD, 0xFD, 0xDD, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC8, 0x04,
+    0xC1, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37,
+    0xC8, 0x04, 0xC1, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDC, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xFD, 0xFD, 0xFD,
+    0xDB, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xE0, 0x04, 0x37, 0xC8, 0x04, 0x37, 0xC6, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0xC2, 0x37,
+    0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC4, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0xCA, 0x04,
+    0x37, 0xC8, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xFD, 0xFD, 0xFD, 0xDC, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xDD, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDD, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x09, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD6, 0xFE, 0x52, 0x8E, 0xFF, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37,
+    0xFD, 0xE2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC5,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37,
+    0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37,
+    0xC8, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xF3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD,
+    0xE3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0xC3, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC6, 0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC8, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0x37, 0xC3,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC8, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC2, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xF3, 0x31,
+    0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xE3, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0xC3, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37,
+    0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC5, 0x04,
+    0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04,
+    0xC3, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC1, 0x37, 0xC3,
+    0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC1, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC1, 0x37,
+    0xC8, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xF4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xE2, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC7, 0x04, 0xC0,
+    0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC6, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC6, 0x04, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC5,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0xF3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xE3, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC9, 0x04, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC2, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC3,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC7, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xF3, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xFD, 0xE3, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0xC4, 0x04, 0x37, 0xC7, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC8, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0xC8, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37,
+    0xC3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37,
+    0xF3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xE5, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC4, 0x04, 0x37, 0x04, 0x37, 0xC9, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37,
+    0xC6, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC4, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0xC3, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xCB, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xF3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xE7, 0x28, 0xCD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCE, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCC, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC9, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC5, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC4, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC3, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xD5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37,
+    0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xFD, 0xEF, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD9, 0x28,
+    0xE9, 0x37, 0xD4, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC7,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC3, 0x04, 0x37, 0xC2, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xFD, 0xED, 0x31, 0xDE,
+    0x2A, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xD6, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37,
+    0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0xC3, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1,
+    0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0xC1, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0xFD, 0xED, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD8, 0x28, 0xEB,
+    0x37, 0xD3, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0xC3, 0x37, 0xC6, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0,
+    0x04, 0xC3, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC0, 0x37,
+    0xC6, 0x04, 0xC3, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0x37, 0xFD, 0xEC, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD2, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0xC3, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC2, 0x04,
+    0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xFD, 0xEB, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7, 0x28, 0xED,
+    0x37, 0xD3, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC6,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC7, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC4, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC6, 0x04,
+    0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xFD, 0xEE, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7,
+    0x28, 0xED, 0x37, 0xD2, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC2, 0x04, 0x37, 0xCD, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0xC6, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xCB, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC4, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0xFD, 0xF1, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA,
+    0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31,
+    0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE,
+    0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2,
+    0x37, 0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37,
+    0xD5, 0x28, 0xF1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5,
+    0x28, 0xF1, 0x37, 0xD0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3,
+    0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0x37, 0xC9, 0x04, 0xC3, 0x37,
+    0xCB, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xFD, 0xFD,
+    0xE3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1, 0x37, 0xD1, 0x04, 0xC1, 0x37, 0xC1, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04,
+    0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC6, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC5, 0x04, 0xC3, 0x37, 0xCC, 0x04,
+    0xC1, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xFD, 0xFD, 0xE3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1,
+    0x37, 0xD0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC3, 0x37,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04,
+    0x37, 0xC7, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0xC8, 0x04, 0xC1, 0x37, 0xC6, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xCB, 0x04, 0x37, 0x04, 0x37,
+    0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xFD, 0xFD, 0xE4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD5, 0x28, 0xF1,
+    0x37, 0xD1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37,
+    0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04,
+    0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0xC6, 0x04,
+    0xC3, 0x37, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC6, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC7, 0x04, 0x37, 0x04, 0x37, 0xCD, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0xC1, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xFD, 0xFD, 0xE4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xD2, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC2,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04,
+    0x37, 0xC6, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC3,
+    0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0xC8, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0x37, 0xCC, 0x04, 0xC2, 0x37, 0xC2, 0x04,
+    0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0xFD, 0xFD, 0xE3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD6, 0x28, 0xEF, 0x37, 0xD2, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0xC7,
+    0x04, 0x37, 0xC3, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC9, 0x04, 0x37, 0xC9, 0x04, 0xC0, 0x37, 0xC4, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC7, 0x04, 0xC1, 0x37, 0xCB, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0xC4, 0x04, 0xC2, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xFD, 0xFD, 0xE3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xD3,
+    0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1,
+    0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC1, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04, 0xC2, 0x37, 0xC0, 0x04,
+    0xC2, 0x37, 0xC2, 0x04, 0x37, 0xD5, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0xC7, 0x04, 0xC2, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xCC, 0x04, 0xC0, 0x37,
+    0xC7, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1,
+    0x37, 0xFD, 0xFD, 0xE4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFC, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD7, 0x28, 0xED, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFC, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD8, 0x28, 0xEB, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC0, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xD9, 0x28, 0xE9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC0, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDA, 0x28, 0xE7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC1, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDB, 0x28, 0xE5, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC2, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDC, 0x28, 0xE3, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC3, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDD, 0x28, 0xE1, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDE, 0x28, 0xDF, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC5, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xDF, 0x28, 0xDD, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC6, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xE1, 0x28, 0xD9, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xE2, 0x28, 0xD7, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC9, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xE5, 0x28, 0xD1, 0x37, 0xE0, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC3, 0x37, 0x04, 0xC3, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC5, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC0, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0x04,
+    0x37, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDD, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xE7, 0x28, 0xCD, 0x37,
+    0xE3, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0x37,
+    0xC0, 0x04, 0xC2, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC7, 0x04, 0x37, 0x04, 0xC0, 0x37,
+    0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC7, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0x37, 0x04, 0xC0,
+    0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0xC2, 0x37, 0xC0,
+    0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC5, 0x04, 0xC1, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0xC3, 0x04, 0xC0, 0x37, 0xC8, 0x04, 0xC1, 0x37, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0xC2, 0x37, 0xC2,
+    0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC1, 0x37, 0xC1, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xC2, 0x04,
+    0x37, 0xC1, 0x04, 0xC1, 0x37, 0xFD, 0xFD, 0xFD, 0xDD, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xDC,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC2, 0x04, 0xC1,
+    0x37, 0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0xC6, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC1,
+    0x37, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC6, 0x04, 0xC3, 0x37, 0xC2, 0x04, 0x37, 0xC0, 0x04, 0x37,
+    0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC3, 0x37, 0xC1, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0xC3, 0x04, 0xC0, 0x37, 0xFD,
+    0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xDC, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37,
+    0x04, 0xC3, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0x37, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC0, 0x04,
+    0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC5, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04,
+    0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0,
+    0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0xC0, 0x04, 0xC2, 0x37, 0x04, 0x37,
+    0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xFD, 0xDC, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04,
+    0xC0, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0xC3, 0x37,
+    0xC6, 0x04, 0x37, 0x04, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xC0, 0x04, 0xC1, 0x37, 0xCA, 0x04, 0x37,
+    0xC0, 0x04, 0x37, 0xC0, 0x04, 0x37, 0xC1, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0x04, 0xC1, 0x37,
+    0x04, 0xC1, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0x04, 0xC0, 0x37, 0xC2, 0x04, 0xC0, 0x37, 0xFD, 0xFD,
+    0xFD, 0xE4, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xDE, 0x04, 0xC1, 0x37, 0xC0, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0x37, 0xC5, 0x04,
+    0xC1, 0x37, 0xC1, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0, 0x04,
+    0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0x04, 0x37, 0xC1, 0x04, 0x37, 0xC1, 0x04, 0x37,
+    0xC2, 0x04, 0xC0, 0x37, 0xC5, 0x04, 0x37, 0xC3, 0x04, 0x37, 0xC1, 0x04, 0x37, 0x04, 0x37, 0xC0,
+    0x04, 0x37, 0xC0, 0x04, 0xC0, 0x37, 0x04, 0xC0, 0x37, 0xC3, 0x04, 0x37, 0x04, 0xC0, 0x37, 0xC0,
+    0x04, 0x37, 0xC7, 0x04, 0x37, 0xC3, 0x04, 0xC1, 0x37, 0xFD, 0xFD, 0xFD, 0xDB, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE,
+    0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31,
+    0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2,
+    0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8,
+    0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A,
+    0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xC8, 0x31, 0xDE, 0x2A, 0xC2, 0x37, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC8, 0x31, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD6, 0xFE, 0x29, 0xCB, 0xFF, 0x9C, 0xCC, 0xCF, 0xFE,
+    0x31, 0xC7, 0xFF, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x39, 0xC3, 0xF7, 0xC7, 0x9B,
+    0xDD, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x9C, 0xCC, 0xC3, 0xFE, 0x4A, 0xBA,
+    0xEF, 0xCF, 0xFE, 0x52, 0xB6, 0xE7, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x9C, 0xCC, 0xC5, 0xFE,
+    0x5A, 0xB2, 0xDE, 0xC3, 0xFE, 0x63, 0xB2, 0xDE, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0x6B, 0xAE, 0xDE,
+    0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0xFE, 0x7B, 0xA6, 0xCE,
+    0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6,
+    0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x9C, 0xCC,
+    0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0xFE, 0xAD, 0x96, 0xB5, 0xC2,
+    0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0xB5, 0x92, 0xAD, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD,
+    0x8E, 0xAD, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0xC6, 0x8A, 0xA5, 0xCF, 0xFE, 0xCE,
+    0x86, 0x9C, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0xDE,
+    0x82, 0x94, 0xC6, 0x9B, 0xDD, 0xC7, 0xFE, 0xE7, 0x7D, 0x94, 0xC4, 0xA0, 0x80, 0xC5, 0x9C, 0xCC,
+    0xC2, 0xFE, 0xEF, 0x79, 0x8C, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24,
+    0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80,
+    0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3,
+    0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6,
+    0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C,
+    0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5,
+    0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5,
+    0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC,
+    0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4,
+    0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14,
+    0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6,
+    0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A,
+    0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6,
+    0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C,
+    0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E,
+    0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5,
+    0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD,
+    0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C,
+    0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5,
+    0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10,
+    0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26,
+    0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7,
+    0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06,
+    0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6,
+    0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2,
+    0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4,
+    0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C,
+    0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6,
+    0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE,
+    0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42,
+    0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7,
+    0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC,
+    0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5,
+    0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4,
+    0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5,
+    0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD,
+    0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C,
+    0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2,
+    0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18,
+    0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E,
+    0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7,
+    0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE,
+    0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C,
+    0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C,
+    0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7,
+    0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01,
+    0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD,
+    0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C,
+    0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7,
+    0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E,
+    0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE,
+    0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80,
+    0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94,
+    0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D,
+    0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35,
+    0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5,
+    0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF,
+    0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30,
+    0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A,
+    0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3,
+    0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6,
+    0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6,
+    0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD,
+    0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC,
+    0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE,
+    0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27,
+    0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF,
+    0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0,
+    0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F,
+    0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA,
+    0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE,
+    0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD,
+    0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09,
+    0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C,
+    0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80,
+    0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10,
+    0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17,
+    0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE,
+    0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80,
+    0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2,
+    0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94,
+    0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE,
+    0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE,
+    0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86,
+    0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F,
+    0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2,
+    0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5,
+    0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A,
+    0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF,
+    0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2,
+    0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E,
+    0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11,
+    0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2,
+    0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25,
+    0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18,
+    0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE,
+    0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6,
+    0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C,
+    0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC,
+    0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6,
+    0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96,
+    0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E,
+    0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3,
+    0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B,
+    0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5,
+    0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3,
+    0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16,
+    0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0,
+    0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7,
+    0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE,
+    0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29,
+    0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF,
+    0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B,
+    0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20,
+    0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE,
+    0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3,
+    0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2,
+    0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0,
+    0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE,
+    0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF,
+    0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3,
+    0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC,
+    0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33,
+    0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC, 0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4,
+    0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4, 0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF,
+    0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5, 0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E,
+    0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73, 0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84,
+    0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC,
+    0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E, 0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A,
+    0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2, 0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C,
+    0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6, 0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF,
+    0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7,
+    0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE, 0x10, 0x14, 0x18, 0xEE, 0x20, 0x9C, 0xCC,
+    0xCF, 0x24, 0xC2, 0x10, 0xC5, 0x18, 0xC4, 0x30, 0xC7, 0x17, 0xC6, 0xFE, 0x42, 0xBE, 0xF7, 0xC4,
+    0xA0, 0x80, 0xC5, 0x26, 0xC3, 0x3E, 0xCF, 0x0A, 0xCF, 0xFE, 0x5A, 0xB6, 0xE7, 0xC3, 0x0E, 0xC5,
+    0x0F, 0xC3, 0x2A, 0xC7, 0x16, 0xC7, 0x2E, 0xC3, 0xA0, 0x80, 0xC6, 0x9C, 0xCC, 0xC2, 0xFE, 0x73,
+    0xAA, 0xD6, 0xCF, 0x06, 0xD0, 0xFE, 0x84, 0xA6, 0xCE, 0xC2, 0x9C, 0xCC, 0xC5, 0xA0, 0x80, 0xC4,
+    0xFE, 0x8C, 0xA2, 0xC6, 0xC7, 0x9C, 0xCC, 0xC6, 0xFE, 0x94, 0x9E, 0xC6, 0xC4, 0xFE, 0x94, 0x9E,
+    0xBD, 0xC5, 0x1E, 0xC2, 0xFE, 0x9C, 0x9A, 0xBD, 0xD0, 0xFE, 0xA5, 0x96, 0xB5, 0xCF, 0x1D, 0xC2,
+    0x09, 0xC5, 0x11, 0xC4, 0x29, 0xC7, 0x9C, 0xCC, 0xC7, 0xFE, 0xBD, 0x8E, 0xAD, 0xC3, 0x35, 0xC6,
+    0x9C, 0xCC, 0xC2, 0x3C, 0xCF, 0x01, 0xCF, 0xFE, 0xD6, 0x86, 0x9C, 0xC3, 0x9C, 0xCC, 0xC5, 0xA0,
+    0x80, 0xC4, 0x25, 0xC6, 0x9B, 0xDD, 0xC7, 0x27, 0xC4, 0x2F, 0xC5, 0x1B, 0xC2, 0x33, 0xCF, 0xFE,
+    0x10, 0x14, 0x18, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
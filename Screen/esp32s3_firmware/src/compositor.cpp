@@ -0,0 +1,502 @@
+/*
+ * Layered Tile Compositor - Implementation
+ *
+ * Dirty state is one 32-bit mask per tile row (30 tiles wide).
+ * Dirty tile runs are turned into rects, composited bottom-up
+ * (topmost opaque layer copied, keyed layers above it blended
+ * by color key or alpha plane) and pushed with display_present().
+ *
+ * When the core exposes the panel framebuffer, tiles are
+ * composited straight into it. Otherwise two PSRAM output
+ * buffers alternate so composing the next frame overlaps the
+ * async present of the current one; each output buffer tracks
+ * the tiles it has missed since it was last composed.
+ *
+ * A layer in direct mode has no pixels of its own: it is drawn
+ * straight onto the screen (framebuffer, or the front output buffer
+ * plus a present) and its content is the last composed frame. That
+ * only holds while nothing above it is visible, so the first flush
+ * after a layer above appears either copies the frame into the
+ * layer's buffer or, if an opaque layer hides it, drops it to black.
+ *
+ * Transitions keep a snapshot of the old frame. While one runs,
+ * every composed rect is post-processed against the snapshot:
+ * crossfades lerp the whole screen each step, wipes only damage
+ * the band the edge swept over since the last step.
+ */
+
+#include "compositor.h"
+#include "esp_heap_caps.h"
+
+// ============================================================================
+// State
+// ============================================================================
+
+struct Layer {
+    uint16_t *buf;
+    uint8_t  *alpha;        // Per-pixel alpha, replaces the key
+    bool      visible;
+    bool      keyed;
+    uint16_t  key;
+    bool      solid;
+    uint16_t  solid_color;
+    bool      direct;       // Content is on screen only (see header)
+};
+
+static Layer    s_layers[LAYER_COUNT];
+static uint32_t s_dirty[COMP_TILES_Y];          // Changed since last flush
+
+// Output buffers (only when the panel framebuffer isn't exposed)
+static uint16_t       *s_out[2] = { NULL, NULL };
+static uint32_t        s_stale[2][COMP_TILES_Y]; // Tiles each buffer is missing
+static display_fence_t s_out_fence[2] = { 0, 0 };
+static int             s_out_back = 0;
+static display_fence_t s_last_fence = 0;
+static int             s_last_tiles = 0;
+
+// Transition state
+struct Transition {
+    CompTransition type;
+    uint32_t       start_ms;
+    uint32_t       duration_ms;
+    int            alpha;       // Fade: weight of the new frame, 0..32
+    int            edge;        // Wipe: columns left of this show the new frame
+};
+
+static Transition s_trans = { TRANS_NONE, 0, 0, 0, 0 };
+static uint16_t  *s_from = NULL;  // Snapshot of the old frame
+
+#define ROW_MASK  ((uint32_t)((1ULL << COMP_TILES_X) - 1))
+#define FRAME_SIZE (LCD_H_RES * LCD_V_RES * sizeof(uint16_t))
+
+// ============================================================================
+// Tile Mask Helpers
+// ============================================================================
+
+static void mask_set_all(uint32_t *mask) {
+    for (int ty = 0; ty < COMP_TILES_Y; ty++) mask[ty] = ROW_MASK;
+}
+
+static void mask_clear(uint32_t *mask) {
+    memset(mask, 0, COMP_TILES_Y * sizeof(uint32_t));
+}
+
+// Mark every tile touched by a (clipped) screen rect
+static void mask_add_rect(uint32_t *mask, int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > LCD_H_RES) w = LCD_H_RES - x;
+    if (y + h > LCD_V_RES) h = LCD_V_RES - y;
+    if (w <= 0 || h <= 0) return;
+
+    int tx0 = x / COMP_TILE, tx1 = (x + w - 1) / COMP_TILE;
+    int ty0 = y / COMP_TILE, ty1 = (y + h - 1) / COMP_TILE;
+    uint32_t bits = (uint32_t)(((1ULL << (tx1 - tx0 + 1)) - 1) << tx0);
+    for (int ty = ty0; ty <= ty1; ty++) mask[ty] |= bits;
+}
+
+// Convert dirty tile runs to rects, stacking identical runs vertically.
+// Falls back to full-width row bands if there are too many distinct runs.
+static int mask_to_rects(const uint32_t *mask, Rect *out, int max) {
+    int n = 0;
+    for (int ty = 0; ty < COMP_TILES_Y; ty++) {
+        uint32_t bits = mask[ty];
+        while (bits) {
+            int start = __builtin_ctz(bits);
+            int len = __builtin_ctz(~(bits >> start));
+            bits &= ~(((1ULL << len) - 1) << start);
+
+            Rect r = { (int16_t)(start * COMP_TILE), (int16_t)(ty * COMP_TILE),
+                       (int16_t)(len * COMP_TILE), COMP_TILE };
+            bool stacked = false;
+            for (int k = 0; k < n; k++) {
+                if (out[k].x == r.x && out[k].w == r.w && out[k].y + out[k].h == r.y) {
+                    out[k].h += COMP_TILE;
+                    stacked = true;
+                    break;
+                }
+            }
+            if (stacked) continue;
+            if (n == max) goto bands;
+            out[n++] = r;
+        }
+    }
+    return n;
+
+bands:
+    n = 0;
+    for (int ty = 0; ty < COMP_TILES_Y; ty++) {
+        if (!mask[ty]) continue;
+        if (n > 0 && out[n - 1].y + out[n - 1].h == ty * COMP_TILE) {
+            out[n - 1].h += COMP_TILE;
+        } else {
+            Rect r = { 0, (int16_t)(ty * COMP_TILE), LCD_H_RES, COMP_TILE };
+            out[n++] = r;
+        }
+    }
+    return n;
+}
+
+// ============================================================================
+// Composition
+// ============================================================================
+
+// Compose a screen rect into dst (dst points at the rect's top-left)
+static void compose_rect(uint16_t *dst, int stride, const Rect &r) {
+    // Everything below the topmost opaque layer is hidden
+    int base = -1;
+    for (int l = LAYER_COUNT - 1; l >= 0; l--) {
+        if (s_layers[l].visible && !s_layers[l].keyed) {
+            base = l;
+            break;
+        }
+    }
+
+    for (int row = 0; row < r.h; row++) {
+        uint16_t *d = dst + row * stride;
+        int off = (r.y + row) * LCD_H_RES + r.x;
+
+        if (base < 0) {
+            display_fill_buffer(d, 0x0000, r.w);
+        } else if (s_layers[base].solid) {
+            display_fill_buffer(d, s_layers[base].solid_color, r.w);
+        } else if (s_layers[base].direct) {
+            // Already on screen; only the other output buffer needs a copy
+            const uint16_t *src = compositor_frame() + off;
+            if (src != d) memcpy(d, src, r.w * sizeof(uint16_t));
+        } else {
+            memcpy(d, s_layers[base].buf + off, r.w * sizeof(uint16_t));
+        }
+
+        for (int l = base + 1; l < LAYER_COUNT; l++) {
+            const Layer &ly = s_layers[l];
+            if (!ly.visible) continue;
+            if (ly.solid) {
+                if (ly.solid_color != ly.key) display_fill_buffer(d, ly.solid_color, r.w);
+                continue;
+            }
+            const uint16_t *src = ly.buf + off;
+            if (ly.alpha) {
+                const uint8_t *a = ly.alpha + off;
+                for (int x = 0; x < r.w; x++) {
+                    if (!a[x]) continue;
+                    d[x] = a[x] >= COMP_ALPHA_MAX ? src[x] : lerp565(d[x], src[x], a[x]);
+                }
+                continue;
+            }
+            uint16_t key = ly.key;
+            for (int x = 0; x < r.w; x++) {
+                if (src[x] != key) d[x] = src[x];
+            }
+        }
+    }
+}
+
+// Apply the running transition to a freshly composed rect
+static void transition_rect(uint16_t *dst, int stride, const Rect &r) {
+    for (int row = 0; row < r.h; row++) {
+        uint16_t *d = dst + row * stride;
+        const uint16_t *from = s_from + (r.y + row) * LCD_H_RES + r.x;
+
+        if (s_trans.type == TRANS_FADE) {
+            uint32_t a = s_trans.alpha;
+            int x = 0;
+            for (; x + 1 < r.w; x += 2) {
+                d[x]     = lerp565(from[x],     d[x],     a);
+                d[x + 1] = lerp565(from[x + 1], d[x + 1], a);
+            }
+            if (x < r.w) d[x] = lerp565(from[x], d[x], a);
+        } else {
+            // Wipe: pixels right of the edge still show the old frame
+            int start = s_trans.edge - r.x;
+            if (start < 0) start = 0;
+            if (start < r.w) memcpy(d + start, from + start, (r.w - start) * sizeof(uint16_t));
+        }
+    }
+}
+
+static void compose_out(uint16_t *dst, int stride, const Rect &r) {
+    compose_rect(dst, stride, r);
+    if (s_trans.type != TRANS_NONE) transition_rect(dst, stride, r);
+}
+
+// ============================================================================
+// Direct Layers
+// ============================================================================
+
+static bool layer_alloc(Layer &ly) {
+    if (!ly.buf) ly.buf = (uint16_t *)heap_caps_malloc(FRAME_SIZE, MALLOC_CAP_SPIRAM);
+    return ly.buf != NULL;
+}
+
+// Give direct layers that are about to be composed under something
+// (or blended by a transition, when keep is set) pixels of their own.
+// Runs before anything new is composed, so the frame is still theirs.
+static void settle_direct(bool keep) {
+    for (int l = 0; l < LAYER_COUNT; l++) {
+        Layer &ly = s_layers[l];
+        if (!ly.direct) continue;
+
+        bool covered = false, hidden = false;
+        for (int u = l + 1; u < LAYER_COUNT; u++) {
+            if (!s_layers[u].visible) continue;
+            covered = true;
+            if (!s_layers[u].keyed) hidden = true;
+        }
+        if (!covered && !keep) continue;
+
+        ly.direct = false;
+        if (!hidden && layer_alloc(ly)) {
+            display_wait_idle();
+            memcpy(ly.buf, compositor_frame(), FRAME_SIZE);
+        } else {
+            ly.solid = true;
+            ly.solid_color = 0x0000;
+        }
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool compositor_init() {
+    size_t fb_size = LCD_H_RES * LCD_V_RES * sizeof(uint16_t);
+    for (int l = 0; l < LAYER_COUNT; l++) {
+        Layer &ly = s_layers[l];
+        // The background often lives on screen only (direct mode), so its
+        // buffer is allocated by the first compositor_layer() call
+        ly.buf = NULL;
+        ly.alpha = NULL;
+        if (l != LAYER_IMAGE && !layer_alloc(ly)) return false;
+        ly.visible = false;
+        ly.keyed = false;
+        ly.key = 0;
+        ly.solid = false;
+        ly.solid_color = 0;
+        ly.direct = false;
+    }
+
+    // Background always shows, overlay starts empty (all key color)
+    s_layers[LAYER_IMAGE].visible = true;
+    compositor_set_solid(LAYER_IMAGE, 0x0000);
+    s_layers[LAYER_OVERLAY].keyed = true;
+    s_layers[LAYER_OVERLAY].key = COMP_KEY_MAGENTA;
+    display_fill_buffer(s_layers[LAYER_OVERLAY].buf, COMP_KEY_MAGENTA, LCD_H_RES * LCD_V_RES);
+
+    if (!display_framebuffer()) {
+        s_out[0] = (uint16_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+        s_out[1] = (uint16_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+        if (!s_out[0] || !s_out[1]) return false;
+        mask_set_all(s_stale[0]);
+        mask_set_all(s_stale[1]);
+    }
+
+    mask_set_all(s_dirty);
+    return true;
+}
+
+uint16_t *compositor_layer(CompLayer layer) {
+    layer_alloc(s_layers[layer]);
+    return s_layers[layer].buf;
+}
+
+uint8_t *compositor_alpha(CompLayer layer) {
+    Layer &ly = s_layers[layer];
+    if (!ly.alpha) {
+        ly.alpha = (uint8_t *)heap_caps_calloc(LCD_H_RES * LCD_V_RES, 1, MALLOC_CAP_SPIRAM);
+        if (ly.alpha) compositor_damage_all();
+    }
+    return ly.alpha;
+}
+
+void compositor_set_visible(CompLayer layer, bool visible) {
+    if (s_layers[layer].visible == visible) return;
+    s_layers[layer].visible = visible;
+    compositor_damage_all();
+}
+
+bool compositor_is_visible(CompLayer layer) {
+    return s_layers[layer].visible;
+}
+
+void compositor_set_key(CompLayer layer, uint16_t key, bool keyed) {
+    s_layers[layer].key = key;
+    s_layers[layer].keyed = keyed;
+    compositor_damage_all();
+}
+
+void compositor_set_solid(CompLayer layer, uint16_t color) {
+    s_layers[layer].direct = false;
+    s_layers[layer].solid = true;
+    s_layers[layer].solid_color = color;
+    compositor_damage_all();
+}
+
+void compositor_set_buffered(CompLayer layer) {
+    s_layers[layer].direct = false;
+    s_layers[layer].solid = false;
+    compositor_damage_all();
+}
+
+void compositor_damage(int x, int y, int w, int h) {
+    mask_add_rect(s_dirty, x, y, w, h);
+}
+
+void compositor_damage_rects(const Rect *rects, int n) {
+    for (int i = 0; i < n; i++) {
+        compositor_damage(rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    }
+}
+
+void compositor_damage_all() {
+    mask_set_all(s_dirty);
+}
+
+display_fence_t compositor_flush() {
+    int tiles = 0;
+    for (int ty = 0; ty < COMP_TILES_Y; ty++) tiles += __builtin_popcount(s_dirty[ty]);
+    s_last_tiles = tiles;
+    if (tiles == 0) return s_last_fence;
+
+    settle_direct(false);
+    Rect rects[DISPLAY_MAX_DAMAGE];
+    uint16_t *fb = display_framebuffer();
+
+    if (fb) {
+        // Compose straight into the panel framebuffer
+        int n = mask_to_rects(s_dirty, rects, DISPLAY_MAX_DAMAGE);
+        display_wait_idle();
+        for (int i = 0; i < n; i++) {
+            compose_out(&fb[rects[i].y * LCD_H_RES + rects[i].x], LCD_H_RES, rects[i]);
+        }
+        display_commit(rects, n);
+        mask_clear(s_dirty);
+        return s_last_fence;
+    }
+
+    // Bring the back output buffer up to date, then push only new damage
+    int back = s_out_back;
+    display_wait(s_out_fence[back], portMAX_DELAY);
+    for (int ty = 0; ty < COMP_TILES_Y; ty++) {
+        s_stale[0][ty] |= s_dirty[ty];
+        s_stale[1][ty] |= s_dirty[ty];
+    }
+
+    int n = mask_to_rects(s_stale[back], rects, DISPLAY_MAX_DAMAGE);
+    for (int i = 0; i < n; i++) {
+        compose_out(&s_out[back][rects[i].y * LCD_H_RES + rects[i].x], LCD_H_RES, rects[i]);
+    }
+    mask_clear(s_stale[back]);
+
+    n = mask_to_rects(s_dirty, rects, DISPLAY_MAX_DAMAGE);
+    s_last_fence = display_present_async(s_out[back], rects, n, NULL, NULL);
+    s_out_fence[back] = s_last_fence;
+    s_out_back ^= 1;
+    mask_clear(s_dirty);
+    return s_last_fence;
+}
+
+int compositor_last_tiles() {
+    return s_last_tiles;
+}
+
+bool compositor_begin_transition(CompTransition type, uint32_t duration_ms) {
+    s_trans.type = TRANS_NONE;
+    if (type == TRANS_NONE || duration_ms == 0) return true;
+
+    size_t fb_size = LCD_H_RES * LCD_V_RES * sizeof(uint16_t);
+    if (!s_from) s_from = (uint16_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+    if (!s_from) return false;
+
+    // The front frame is complete once its present has finished
+    display_wait_idle();
+    memcpy(s_from, compositor_frame(), fb_size);
+    settle_direct(true);
+
+    s_trans.type = type;
+    s_trans.start_ms = millis();
+    s_trans.duration_ms = duration_ms;
+    s_trans.alpha = 0;
+    s_trans.edge = 0;
+    return true;
+}
+
+bool compositor_transition_active() {
+    return s_trans.type != TRANS_NONE;
+}
+
+void compositor_update() {
+    if (s_trans.type == TRANS_NONE) return;
+
+    uint32_t elapsed = millis() - s_trans.start_ms;
+    if (elapsed >= s_trans.duration_ms) {
+        // Final frame: the new content, untouched
+        if (s_trans.type == TRANS_FADE) {
+            compositor_damage_all();
+        } else {
+            compositor_damage(s_trans.edge, 0, LCD_H_RES - s_trans.edge, LCD_V_RES);
+        }
+        s_trans.type = TRANS_NONE;
+        compositor_flush();
+        return;
+    }
+
+    if (s_trans.type == TRANS_FADE) {
+        int alpha = (int)(elapsed * 32 / s_trans.duration_ms);
+        if (alpha == s_trans.alpha) return;
+        s_trans.alpha = alpha;
+        compositor_damage_all();
+    } else {
+        int edge = (int)(elapsed * LCD_H_RES / s_trans.duration_ms);
+        if (edge == s_trans.edge) return;
+        // Only the newly uncovered band changes
+        compositor_damage(s_trans.edge, 0, edge - s_trans.edge, LCD_V_RES);
+        s_trans.edge = edge;
+    }
+    compositor_flush();
+}
+
+const uint16_t *compositor_frame() {
+    uint16_t *fb = display_framebuffer();
+    if (fb) return fb;
+    // s_out_back is the next one to compose into; the other was presented last
+    return s_out[s_out_back ^ 1];
+}
+
+bool compositor_begin_direct(CompLayer layer) {
+    if (s_trans.type != TRANS_NONE || !s_layers[layer].visible) return false;
+    for (int u = layer + 1; u < LAYER_COUNT; u++) {
+        if (s_layers[u].visible) return false;
+    }
+    display_wait_idle();
+    s_layers[layer].direct = true;
+    s_layers[layer].solid = false;
+    return true;
+}
+
+void compositor_direct_draw(int x, int y, int w, int h, const uint16_t *pixels) {
+    int stride = w;
+    if (x < 0) { pixels -= x; w += x; x = 0; }
+    if (y < 0) { pixels -= y * stride; h += y; y = 0; }
+    if (x + w > LCD_H_RES) w = LCD_H_RES - x;
+    if (y + h > LCD_V_RES) h = LCD_V_RES - y;
+    if (w <= 0 || h <= 0) return;
+
+    // The framebuffer, or the output buffer that was presented last
+    uint16_t *fb = display_framebuffer();
+    int front = s_out_back ^ 1;
+    uint16_t *dst = fb ? fb : s_out[front];
+    for (int row = 0; row < h; row++) {
+        memcpy(&dst[(y + row) * LCD_H_RES + x], pixels + row * stride, w * sizeof(uint16_t));
+    }
+
+    Rect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    if (fb) {
+        display_commit(&r, 1);
+        return;
+    }
+    s_last_fence = display_present_async(dst, &r, 1, NULL, NULL);
+    s_out_fence[front] = s_last_fence;
+    mask_add_rect(s_stale[s_out_back], x, y, w, h);
+}
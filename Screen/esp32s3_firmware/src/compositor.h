@@ -0,0 +1,116 @@
+/*
+ * Layered Tile Compositor for SenseCAP Indicator
+ *
+ * Keeps a small fixed stack of full-screen RGB565 layers
+ * (background image, animated face, UI overlay) and composes
+ * them onto the panel. Damage is tracked per 16x16 tile; only
+ * dirty tiles are recomposited and pushed, so updating one layer
+ * never requires redrawing the others.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "display.h"
+#include "pins.h"
+
+#define COMP_TILE        16
+#define COMP_TILES_X     (LCD_H_RES / COMP_TILE)
+#define COMP_TILES_Y     (LCD_V_RES / COMP_TILE)
+
+// Bottom to top
+enum CompLayer {
+    LAYER_IMAGE = 0,    // Background: decoded JPEGs, solid clears
+    LAYER_FACE,         // Animated face
+    LAYER_OVERLAY,      // UI overlay (keyed)
+    LAYER_COUNT
+};
+
+// Screen transitions (see compositor_begin_transition)
+enum CompTransition {
+    TRANS_NONE = 0,
+    TRANS_FADE,         // Crossfade old -> new
+    TRANS_WIPE,         // New frame sweeps in from the left
+};
+
+// Default overlay transparency key (magenta)
+#define COMP_KEY_MAGENTA  0xF81F
+
+// Layer alpha: 0 transparent .. COMP_ALPHA_MAX opaque
+#define COMP_ALPHA_MAX    32
+
+// RGB565 lerp, all three channels in one multiply: spreading the pixel
+// to 0x07E0F81F (G in the top half, R/B in the bottom) leaves enough
+// headroom between fields for a 5-bit weight. a = 0 -> from, 32 -> to.
+static inline uint16_t lerp565(uint16_t from, uint16_t to, uint32_t a) {
+    uint32_t f = (from | ((uint32_t)from << 16)) & 0x07E0F81F;
+    uint32_t t = (to   | ((uint32_t)to   << 16)) & 0x07E0F81F;
+    f = (f + (((t - f) * a) >> 5)) & 0x07E0F81F;
+    return (uint16_t)(f | (f >> 16));
+}
+
+// Allocate layer buffers (PSRAM). Call after display_init().
+bool compositor_init();
+
+// Layer pixel buffer (480x480 RGB565) to draw into.
+// Mark what changed with compositor_damage() before the next flush.
+uint16_t *compositor_layer(CompLayer layer);
+
+// Show / hide a layer (damages the whole screen on change)
+void compositor_set_visible(CompLayer layer, bool visible);
+bool compositor_is_visible(CompLayer layer);
+
+// Transparency key: pixels equal to key show the layers below.
+// keyed=false makes the layer opaque.
+void compositor_set_key(CompLayer layer, uint16_t key, bool keyed);
+
+// Layer pixel buffers are allocated on first use; compositor_layer()
+// returns NULL if PSRAM runs out.
+
+// Per-pixel alpha plane for a layer (one byte per pixel, 0 ..
+// COMP_ALPHA_MAX), allocated fully transparent on first use; NULL if
+// PSRAM runs out. A layer with one is blended by it, not by its key.
+uint8_t *compositor_alpha(CompLayer layer);
+
+// Make a layer a solid color without touching its buffer, or switch it
+// back to showing its buffer. Both damage the whole screen.
+void compositor_set_solid(CompLayer layer, uint16_t color);
+void compositor_set_buffered(CompLayer layer);
+
+// Mark a screen region (or everything) for recomposition
+void compositor_damage(int x, int y, int w, int h);
+void compositor_damage_rects(const Rect *rects, int n);
+void compositor_damage_all();
+
+// Recomposite dirty tiles and present them asynchronously.
+// Returns the present fence (already done if nothing was dirty).
+display_fence_t compositor_flush();
+
+// Number of tiles recomposited by the last flush
+int compositor_last_tiles();
+
+// Start a transition from what is on screen now to whatever gets
+// composed next, over duration_ms. Snapshots the current frame, so
+// call it after drawing the new content but before flushing it.
+// Returns false (and cuts instantly) if the snapshot buffer can't
+// be allocated.
+bool compositor_begin_transition(CompTransition type, uint32_t duration_ms);
+bool compositor_transition_active();
+
+// Advance a running transition (damages what moved and flushes).
+// Call every loop(); does nothing when no transition is running.
+void compositor_update();
+
+// Most recently composed full frame (the panel framebuffer when it is
+// mapped). Read-only; later flushes update it in place.
+const uint16_t *compositor_frame();
+
+// Direct mode: draw a layer straight onto the screen, skipping its
+// buffer and the recomposite. Only possible while no layer above it is
+// visible and no transition runs (returns false otherwise). The layer
+// then shows whatever is on screen; compositor_set_solid/_buffered end
+// direct mode. If a layer above becomes visible the next flush copies
+// the screen into the layer's buffer (or drops it to black when an
+// opaque layer hides it).
+bool compositor_begin_direct(CompLayer layer);
+void compositor_direct_draw(int x, int y, int w, int h, const uint16_t *pixels);
@@ -0,0 +1,14 @@
+/*
+ * CRC-32 for SenseCAP Indicator
+ *
+ * Standard CRC-32 (IEEE 802.3, reflected, as zlib.crc32 / binascii.crc32
+ * on the host), computed incrementally so payloads can be checked as
+ * they arrive.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+// Continue a CRC over more data. Start with crc = 0.
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len);
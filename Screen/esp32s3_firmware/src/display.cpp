@@ -16,6 +16,41 @@
 
 #include "esp_lcd_panel_rgb.h"
 #include "esp_heap_caps.h"
+#include "esp_idf_version.h"
+#include "esp32s3/rom/cache.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+// esp_lcd only exposes the RGB panel framebuffer from ESP-IDF 5.0 on.
+// Older cores fall back to strip-wise esp_lcd_panel_draw_bitmap() calls.
+#define DISPLAY_HAS_FB_ACCESS (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0))
+
+// Bounce buffers and vsync callbacks arrived in the same release
+#define DISPLAY_HAS_BOUNCE_BUFFER DISPLAY_HAS_FB_ACCESS
+
+// Nominal frame period derived from the panel timing in pins.h
+#define LCD_H_TOTAL  (LCD_H_RES + LCD_HSYNC_BACK_PORCH + LCD_HSYNC_FRONT_PORCH + LCD_HSYNC_PULSE_WIDTH)
+#define LCD_V_TOTAL  (LCD_V_RES + LCD_VSYNC_BACK_PORCH + LCD_VSYNC_FRONT_PORCH + LCD_VSYNC_PULSE_WIDTH)
+#define LCD_FRAME_US ((uint32_t)((uint64_t)LCD_H_TOTAL * LCD_V_TOTAL * 1000000 / LCD_PIXEL_CLK_HZ))
+
+// Rows per draw_bitmap call on the fallback fill path
+#define FILL_STRIP_ROWS   16
+
+// Async draw worker (runs on core 0, Arduino loop() is on core 1)
+#define DRAW_QUEUE_DEPTH  4
+#define DRAW_TASK_STACK   4096
+#define DRAW_TASK_PRIO    2
+#define DRAW_TASK_CORE    0
+
+// Damage merge cost model, in pixel-equivalents. Every rect pays a setup
+// cost; rows that are not full-width pay a per-row burst cost, which is
+// much higher when each row needs its own draw_bitmap call.
+#define DAMAGE_RECT_COST     256
+#define DAMAGE_ROW_COST_FB     8
+#define DAMAGE_ROW_COST_CALL 512
 
 // ============================================================================
 // Static Variables
@@ -23,6 +58,44 @@
 
 static TCA9535 s_expander;
 static esp_lcd_panel_handle_t s_panel = NULL;
+static uint16_t *s_fb = NULL;          // Panel framebuffer (PSRAM), if exposed
+static uint16_t *s_fill_strip = NULL;  // Internal SRAM strip for fallback fills
+static int s_bounce_rows = 0;          // Active bounce buffer height (rows)
+
+// Vsync statistics (written from ISR)
+static volatile uint32_t s_vsync_frames = 0;
+static volatile uint32_t s_underruns = 0;
+static volatile uint32_t s_worst_frame_us = 0;
+static volatile int64_t  s_last_vsync_us = 0;
+
+// Async draw jobs, completed in submission order. Each job copies a list
+// of rects out of a source image; pixels points at the source's (0,0)
+// and stride is its row pitch in pixels.
+struct DrawJob {
+    const uint16_t   *pixels;
+    int               stride;
+    int               ox, oy;   // Screen position of the source's (0,0)
+    Rect              rects[DISPLAY_MAX_DAMAGE];
+    int               n;
+    display_done_cb_t cb;
+    void             *arg;
+    display_fence_t   fence;
+};
+static QueueHandle_t s_draw_queue = NULL;
+static SemaphoreHandle_t s_submit_lock = NULL;         // Fence order = queue order
+static display_fence_t s_fence_submitted = 0;          // Last fence handed out
+static volatile display_fence_t s_fence_done = 0;      // Last fence completed
+
+// Tasks blocked in display_wait(); every completion wakes them all
+#define FENCE_WAITERS  4
+static TaskHandle_t s_fence_waiters[FENCE_WAITERS];
+static portMUX_TYPE s_fence_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Push telemetry (pixels written to the panel framebuffer)
+static volatile uint64_t s_pixels_pushed = 0;
+static volatile uint32_t s_pixels_per_sec = 0;
+static uint32_t s_rate_window_px = 0;
+static unsigned long s_rate_window_start = 0;
 
 // ============================================================================
 // Backlight Control
@@ -33,11 +106,34 @@ void display_backlight(bool on) {
     digitalWrite(PIN_LCD_BL, on ? LCD_BL_ON_LEVEL : !LCD_BL_ON_LEVEL);
 }
 
+// ============================================================================
+// Vsync Monitor
+// ============================================================================
+
+// The LCD peripheral has no underrun flag. When DMA starves on PSRAM the
+// refill ISRs run late and the frame stretches, so a vsync interval more
+// than 25% over nominal is counted as an underrun.
+#if DISPLAY_HAS_BOUNCE_BUFFER
+static IRAM_ATTR bool on_vsync(esp_lcd_panel_handle_t panel,
+                               const esp_lcd_rgb_panel_event_data_t *edata,
+                               void *user_ctx) {
+    int64_t now = esp_timer_get_time();
+    if (s_last_vsync_us != 0) {
+        uint32_t dt = (uint32_t)(now - s_last_vsync_us);
+        if (dt > s_worst_frame_us) s_worst_frame_us = dt;
+        if (dt > LCD_FRAME_US + LCD_FRAME_US / 4) s_underruns = s_underruns + 1;
+    }
+    s_last_vsync_us = now;
+    s_vsync_frames = s_vsync_frames + 1;
+    return false;
+}
+#endif
+
 // ============================================================================
 // RGB Panel Initialization (correct pins from official SDK)
 // ============================================================================
 
-static esp_err_t rgb_panel_init() {
+static esp_err_t rgb_panel_init(int bounce_rows) {
     esp_lcd_rgb_panel_config_t cfg;
     memset(&cfg, 0, sizeof(cfg));
 
@@ -86,15 +182,229 @@ static esp_err_t rgb_panel_init() {
     // Framebuffer in PSRAM
     cfg.flags.fb_in_psram = true;
 
+#if DISPLAY_HAS_BOUNCE_BUFFER
+    // Optional internal-SRAM bounce buffers: the CPU copies PSRAM into
+    // them from an ISR, so LCD DMA never reads PSRAM directly
+    cfg.bounce_buffer_size_px = bounce_rows * LCD_H_RES;
+    s_bounce_rows = bounce_rows;
+#else
+    (void)bounce_rows;
+    s_bounce_rows = 0;
+#endif
+
     // Create the RGB panel
     esp_err_t ret = esp_lcd_new_rgb_panel(&cfg, &s_panel);
     if (ret != ESP_OK) return ret;
 
     ret = esp_lcd_panel_reset(s_panel);
-    if (ret != ESP_OK) return ret;
+    if (ret == ESP_OK) ret = esp_lcd_panel_init(s_panel);
+    if (ret != ESP_OK) {
+        esp_lcd_panel_del(s_panel);
+        s_panel = NULL;
+        return ret;
+    }
+
+#if DISPLAY_HAS_BOUNCE_BUFFER
+    esp_lcd_rgb_panel_event_callbacks_t cbs;
+    memset(&cbs, 0, sizeof(cbs));
+    cbs.on_vsync = on_vsync;
+    esp_lcd_rgb_panel_register_event_callbacks(s_panel, &cbs, NULL);
+#endif
+
+#if DISPLAY_HAS_FB_ACCESS
+    // Grab the framebuffer so fills can write it directly
+    void *fb = NULL;
+    if (esp_lcd_rgb_panel_get_frame_buffer(s_panel, 1, &fb) == ESP_OK) {
+        s_fb = (uint16_t *)fb;
+    }
+#endif
+    return ESP_OK;
+}
+
+// ============================================================================
+// Fill Helpers
+// ============================================================================
+
+// Fill n pixels with a color using 32-bit stores (unrolled x8)
+static inline void fill16(uint16_t *dst, uint16_t color, int n) {
+    if (n <= 0) return;
+    if ((uintptr_t)dst & 2) {
+        *dst++ = color;
+        n--;
+    }
+    uint32_t fill32 = ((uint32_t)color << 16) | color;
+    uint32_t *p = (uint32_t *)dst;
+    int words = n >> 1;
+    while (words >= 8) {
+        p[0] = fill32; p[1] = fill32; p[2] = fill32; p[3] = fill32;
+        p[4] = fill32; p[5] = fill32; p[6] = fill32; p[7] = fill32;
+        p += 8;
+        words -= 8;
+    }
+    while (words-- > 0) *p++ = fill32;
+    if (n & 1) *(uint16_t *)p = color;
+}
+
+// Write back the CPU cache for a framebuffer range so the LCD DMA sees it
+static inline void fb_writeback(const uint16_t *start, size_t bytes) {
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)start, bytes);
+}
+
+// ============================================================================
+// Async Draw Worker
+// ============================================================================
+
+// Account pushed pixels and roll the 1 s rate window
+static void count_pixels(uint32_t px) {
+    s_pixels_pushed = s_pixels_pushed + px;
+    s_rate_window_px += px;
+    unsigned long now = millis();
+    unsigned long dt = now - s_rate_window_start;
+    if (dt >= 1000) {
+        s_pixels_per_sec = (uint32_t)((uint64_t)s_rate_window_px * 1000 / dt);
+        s_rate_window_px = 0;
+        s_rate_window_start = now;
+    }
+}
 
-    ret = esp_lcd_panel_init(s_panel);
-    return ret;
+// Copy one screen rect from a strided source into the panel
+static void blit_rect(const uint16_t *src, int stride, const Rect &r) {
+    if (s_fb) {
+        uint16_t *dst = &s_fb[r.y * LCD_H_RES + r.x];
+        if (r.w == LCD_H_RES && stride == LCD_H_RES) {
+            memcpy(dst, src, (size_t)r.w * r.h * sizeof(uint16_t));
+        } else {
+            for (int row = 0; row < r.h; row++) {
+                memcpy(dst + row * LCD_H_RES, src + row * stride, r.w * sizeof(uint16_t));
+            }
+        }
+        fb_writeback(dst, ((r.h - 1) * LCD_H_RES + r.w) * sizeof(uint16_t));
+    } else if (stride == r.w) {
+        // Packed rows: one burst for the whole rect
+        esp_lcd_panel_draw_bitmap(s_panel, r.x, r.y, r.x + r.w, r.y + r.h, src);
+    } else {
+        for (int row = 0; row < r.h; row++) {
+            esp_lcd_panel_draw_bitmap(s_panel, r.x, r.y + row, r.x + r.w, r.y + row + 1,
+                                      src + row * stride);
+        }
+    }
+    count_pixels((uint32_t)r.w * r.h);
+}
+
+static void run_job(const DrawJob &job) {
+    for (int i = 0; i < job.n; i++) {
+        const Rect &r = job.rects[i];
+        blit_rect(job.pixels + (r.y - job.oy) * job.stride + (r.x - job.ox), job.stride, r);
+    }
+}
+
+static void draw_task(void *arg) {
+    static DrawJob s_job;  // Too big for comfort on the task stack
+    DrawJob *job = &s_job;
+    for (;;) {
+        if (xQueueReceive(s_draw_queue, job, portMAX_DELAY) != pdTRUE) continue;
+
+        run_job(*job);
+
+        s_fence_done = job->fence;
+        if (job->cb) job->cb(job->arg);
+
+        TaskHandle_t waiters[FENCE_WAITERS];
+        portENTER_CRITICAL(&s_fence_mux);
+        memcpy(waiters, s_fence_waiters, sizeof(waiters));
+        portEXIT_CRITICAL(&s_fence_mux);
+        for (TaskHandle_t w : waiters) {
+            if (w) xTaskNotifyGive(w);
+        }
+    }
+}
+
+// Queue a job; runs it inline if the worker is missing. Several tasks
+// submit, so handing out the fence and queueing the job happen under one
+// lock: fences then complete in the order they were handed out.
+static display_fence_t job_submit(DrawJob &job) {
+    if (!s_panel || !job.pixels || job.n == 0) {
+        if (job.cb) job.cb(job.arg);
+        return s_fence_submitted;
+    }
+
+    if (s_submit_lock) xSemaphoreTake(s_submit_lock, portMAX_DELAY);
+    job.fence = s_fence_submitted + 1;
+    bool queued = s_draw_queue && xQueueSend(s_draw_queue, &job, portMAX_DELAY) == pdTRUE;
+    if (queued) {
+        s_fence_submitted = job.fence;
+    } else {
+        display_wait_idle();
+        run_job(job);
+    }
+    display_fence_t fence = s_fence_submitted;
+    if (s_submit_lock) xSemaphoreGive(s_submit_lock);
+
+    if (!queued && job.cb) job.cb(job.arg);
+    return fence;
+}
+
+// ============================================================================
+// Damage Merging
+// ============================================================================
+
+static inline int rect_cost(const Rect &r) {
+    int row_cost = 0;
+    if (r.w != LCD_H_RES) row_cost = s_fb ? DAMAGE_ROW_COST_FB : DAMAGE_ROW_COST_CALL;
+    return DAMAGE_RECT_COST + r.w * r.h + r.h * row_cost;
+}
+
+static inline Rect rect_union(const Rect &a, const Rect &b) {
+    int x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+    int x1 = max(a.x + a.w, b.x + b.w), y1 = max(a.y + a.h, b.y + b.h);
+    Rect u = { (int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    return u;
+}
+
+// Clip to screen; returns false if nothing is left
+static inline bool rect_clip(Rect &r) {
+    int x0 = max((int)r.x, 0), y0 = max((int)r.y, 0);
+    int x1 = min(r.x + r.w, LCD_H_RES), y1 = min(r.y + r.h, LCD_V_RES);
+    if (x1 <= x0 || y1 <= y0) return false;
+    r.x = x0; r.y = y0; r.w = x1 - x0; r.h = y1 - y0;
+    return true;
+}
+
+// Greedily merge pairs whose union is cheaper than pushing both.
+// Overlapping and touching rects always win; distant ones stay apart.
+static int merge_damage(Rect *r, int n) {
+    bool merged = true;
+    while (merged && n > 1) {
+        merged = false;
+        for (int i = 0; i < n && !merged; i++) {
+            for (int j = i + 1; j < n; j++) {
+                Rect u = rect_union(r[i], r[j]);
+                if (rect_cost(u) <= rect_cost(r[i]) + rect_cost(r[j])) {
+                    r[i] = u;
+                    r[j] = r[--n];
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+// Clip, cap and merge a caller's damage list into a job
+static void collect_damage(DrawJob &job, const Rect *rects, int n) {
+    job.n = 0;
+    for (int i = 0; i < n; i++) {
+        Rect r = rects[i];
+        if (!rect_clip(r)) continue;
+        if (job.n < DISPLAY_MAX_DAMAGE) {
+            job.rects[job.n++] = r;
+        } else {
+            // Out of slots: fold the overflow into the last rect
+            job.rects[DISPLAY_MAX_DAMAGE - 1] = rect_union(job.rects[DISPLAY_MAX_DAMAGE - 1], r);
+        }
+    }
+    job.n = merge_damage(job.rects, job.n);
 }
 
 // ============================================================================
@@ -119,13 +429,31 @@ bool display_init() {
     s_expander.setLevel(EXPANDER_TP_RST, 1);
 
     // Step 4: Create RGB panel (this configures DMA + GPIO for parallel data)
-    esp_err_t err = rgb_panel_init();
+    esp_err_t err = rgb_panel_init(DISPLAY_BOUNCE_ROWS);
     if (err != ESP_OK) {
         Serial.printf("ERROR: RGB panel init failed: 0x%x\n", err);
         return false;
     }
     Serial.println("RGB panel created");
 
+    // Fallback fill strip (only used when the framebuffer is not exposed);
+    // PSRAM if internal RAM is short
+    if (!s_fb) {
+        size_t bytes = LCD_H_RES * FILL_STRIP_ROWS * sizeof(uint16_t);
+        s_fill_strip = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!s_fill_strip) s_fill_strip = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    }
+
+    // Async draw worker
+    s_submit_lock = xSemaphoreCreateMutex();
+    s_draw_queue = xQueueCreate(DRAW_QUEUE_DEPTH, sizeof(DrawJob));
+    if (!s_draw_queue ||
+        xTaskCreatePinnedToCore(draw_task, "display", DRAW_TASK_STACK, NULL,
+                                DRAW_TASK_PRIO, NULL, DRAW_TASK_CORE) != pdPASS) {
+        Serial.println("WARNING: display worker not started, async draws run inline");
+        s_draw_queue = NULL;
+    }
+
     // Step 5: Initialize ST7701S LCD controller via SPI
     lcd_panel_st7701s_init(s_expander);
     Serial.println("ST7701S initialized");
@@ -139,35 +467,216 @@ bool display_init() {
     return true;
 }
 
+bool display_set_bounce_rows(int rows) {
+#if DISPLAY_HAS_BOUNCE_BUFFER
+    // The two bounce buffers take turns, so the frame has to be an even
+    // multiple of one; anything else esp_lcd_new_rgb_panel() rejects
+    if (rows < 0 || (rows > 0 && (LCD_V_RES % rows != 0 || (LCD_V_RES / rows) % 2 != 0))) {
+        return false;
+    }
+    if (s_panel && rows == s_bounce_rows) return true;
+    display_wait_idle();
+
+    // The RGB panel has to be recreated; the ST7701S keeps its config
+    if (s_panel) esp_lcd_panel_del(s_panel);
+    s_panel = NULL;
+    s_fb = NULL;
+    s_last_vsync_us = 0;
+
+    esp_err_t err = rgb_panel_init(rows);
+    if (err != ESP_OK) {
+        Serial.printf("ERROR: RGB panel re-init failed: 0x%x\n", err);
+        // Try to restore the build-time configuration, then no bounce
+        // buffers at all
+        if (rgb_panel_init(DISPLAY_BOUNCE_ROWS) != ESP_OK && rgb_panel_init(0) != ESP_OK) {
+            Serial.println("ERROR: RGB panel lost, nothing will be drawn");
+            return false;
+        }
+        display_fill(0x0000);
+        return false;
+    }
+    display_fill(0x0000);
+    return true;
+#else
+    return rows == 0;
+#endif
+}
+
+void display_get_stats(DisplayStats *out) {
+    out->frames         = s_vsync_frames;
+    out->underruns      = s_underruns;
+    out->worst_frame_us = s_worst_frame_us;
+    out->frame_us       = LCD_FRAME_US;
+    out->bounce_rows    = s_bounce_rows;
+    out->direct_fb      = (s_fb != NULL);
+    out->pixels_pushed  = s_pixels_pushed;
+    out->pixels_per_sec = s_pixels_per_sec;
+}
+
+void display_reset_stats() {
+    s_underruns = 0;
+    s_worst_frame_us = 0;
+}
+
+uint16_t *display_framebuffer() {
+    return s_fb;
+}
+
+void display_commit(const Rect *rects, int n) {
+    if (!s_fb) return;
+    for (int i = 0; i < n; i++) {
+        Rect r = rects[i];
+        if (!rect_clip(r)) continue;
+        fb_writeback(&s_fb[r.y * LCD_H_RES + r.x],
+                     ((r.h - 1) * LCD_H_RES + r.w) * sizeof(uint16_t));
+        count_pixels((uint32_t)r.w * r.h);
+    }
+}
+
+void display_fill_buffer(uint16_t *dst, uint16_t color, int n) {
+    fill16(dst, color, n);
+}
+
+bool display_ok() {
+    return s_panel != NULL;
+}
+
 esp_lcd_panel_handle_t display_get_panel() {
     return s_panel;
 }
 
 void display_draw_fullscreen(const uint16_t *pixels) {
-    if (s_panel && pixels) {
-        esp_lcd_panel_draw_bitmap(s_panel, 0, 0, LCD_H_RES, LCD_V_RES, pixels);
-    }
+    display_wait(display_draw_fullscreen_async(pixels, NULL, NULL), portMAX_DELAY);
 }
 
 void display_draw_rect(int x, int y, int w, int h, const uint16_t *pixels) {
-    if (s_panel && pixels) {
-        esp_lcd_panel_draw_bitmap(s_panel, x, y, x + w, y + h, pixels);
+    display_wait(display_draw_rect_async(x, y, w, h, pixels, NULL, NULL), portMAX_DELAY);
+}
+
+display_fence_t display_draw_fullscreen_async(const uint16_t *pixels,
+                                              display_done_cb_t cb, void *arg) {
+    Rect full = { 0, 0, LCD_H_RES, LCD_V_RES };
+    return display_present_async(pixels, &full, 1, cb, arg);
+}
+
+display_fence_t display_draw_rect_async(int x, int y, int w, int h, const uint16_t *pixels,
+                                        display_done_cb_t cb, void *arg) {
+    DrawJob job;
+    job.pixels = pixels;
+    job.stride = w;
+    job.ox = x;
+    job.oy = y;
+    Rect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    collect_damage(job, &r, 1);
+    job.cb = cb;
+    job.arg = arg;
+    return job_submit(job);
+}
+
+void display_present(const uint16_t *frame, const Rect *rects, int n) {
+    display_wait(display_present_async(frame, rects, n, NULL, NULL), portMAX_DELAY);
+}
+
+display_fence_t display_present_async(const uint16_t *frame, const Rect *rects, int n,
+                                      display_done_cb_t cb, void *arg) {
+    DrawJob job;
+    job.pixels = frame;
+    job.stride = LCD_H_RES;
+    job.ox = 0;
+    job.oy = 0;
+    collect_damage(job, rects, n);
+    job.cb = cb;
+    job.arg = arg;
+    return job_submit(job);
+}
+
+bool display_fence_done(display_fence_t fence) {
+    return (int32_t)(s_fence_done - fence) >= 0;
+}
+
+// Add or remove the calling task as a waiter; false if all slots are
+// taken (the caller then just polls)
+static bool fence_waiter(TaskHandle_t self, bool add) {
+    bool ok = false;
+    portENTER_CRITICAL(&s_fence_mux);
+    for (int i = 0; i < FENCE_WAITERS && !ok; i++) {
+        if (s_fence_waiters[i] == (add ? NULL : self)) {
+            s_fence_waiters[i] = add ? self : NULL;
+            ok = true;
+        }
     }
+    portEXIT_CRITICAL(&s_fence_mux);
+    return ok;
+}
+
+bool display_wait(display_fence_t fence, uint32_t timeout_ms) {
+    unsigned long start = millis();
+    if (display_fence_done(fence)) return true;
+
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    bool registered = fence_waiter(self, true);
+    bool done;
+    while (!(done = display_fence_done(fence))) {
+        // Registered before the check, so a completion can't be missed;
+        // the poll covers an unregistered caller
+        uint32_t elapsed = millis() - start;
+        if (timeout_ms != portMAX_DELAY && elapsed >= timeout_ms) break;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+    }
+    if (registered) fence_waiter(self, false);
+    return done;
+}
+
+void display_wait_idle() {
+    display_wait(s_fence_submitted, portMAX_DELAY);
 }
 
 void display_fill(uint16_t color) {
-    // Allocate a single row buffer
-    uint16_t *row = (uint16_t *)heap_caps_malloc(LCD_H_RES * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
-    if (!row) return;
+    display_fill_rect(0, 0, LCD_H_RES, LCD_V_RES, color);
+}
 
-    for (int i = 0; i < LCD_H_RES; i++) {
-        row[i] = color;
+void display_fill_rect(int x, int y, int w, int h, uint16_t color) {
+    if (!s_panel) return;
+    display_wait_idle();  // Keep ordering with queued async draws
+
+    // Clip to screen
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > LCD_H_RES) w = LCD_H_RES - x;
+    if (y + h > LCD_V_RES) h = LCD_V_RES - y;
+    if (w <= 0 || h <= 0) return;
+
+    if (s_fb) {
+        // Direct framebuffer write, one cache write-back at the end
+        uint16_t *first = &s_fb[y * LCD_H_RES + x];
+        if (w == LCD_H_RES) {
+            fill16(first, color, w * h);
+        } else {
+            for (int row = 0; row < h; row++) {
+                fill16(first + row * LCD_H_RES, color, w);
+            }
+        }
+        fb_writeback(first, ((h - 1) * LCD_H_RES + w) * sizeof(uint16_t));
+        count_pixels((uint32_t)w * h);
+        return;
     }
 
-    // Draw row by row
-    for (int y = 0; y < LCD_V_RES; y++) {
-        esp_lcd_panel_draw_bitmap(s_panel, 0, y, LCD_H_RES, y + 1, row);
+    // Fallback: push a pre-filled strip of rows per draw_bitmap call, or
+    // (strip never allocated) one row at a time as before
+    uint16_t *strip = s_fill_strip;
+    int strip_rows = FILL_STRIP_ROWS;
+    if (!strip) {
+        strip = (uint16_t *)heap_caps_malloc(w * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+        if (!strip) return;
+        strip_rows = 1;
     }
-
-    free(row);
+    if (strip_rows > h) strip_rows = h;
+    fill16(strip, color, w * strip_rows);
+    for (int row = 0; row < h; row += strip_rows) {
+        int rows = h - row;
+        if (rows > strip_rows) rows = strip_rows;
+        esp_lcd_panel_draw_bitmap(s_panel, x, y + row, x + w, y + row + rows, strip);
+    }
+    if (strip != s_fill_strip) heap_caps_free(strip);
+    count_pixels((uint32_t)w * h);
 }
@@ -11,6 +11,39 @@
 #include <Arduino.h>
 #include "esp_lcd_panel_ops.h"
 
+// Bounce buffer height in panel rows (0 = LCD DMA reads PSRAM directly).
+// LCD_V_RES must be an even multiple of it. Override with
+// -DDISPLAY_BOUNCE_ROWS=N. Needs ESP-IDF 5 (ignored on 4.4).
+#ifndef DISPLAY_BOUNCE_ROWS
+#define DISPLAY_BOUNCE_ROWS  10
+#endif
+
+// Max damage rects per present (extra rects are folded together)
+#define DISPLAY_MAX_DAMAGE   32
+
+// Screen rectangle for damage tracking
+struct Rect {
+    int16_t x, y, w, h;
+};
+
+// Async draw completion: fences increase monotonically, a fence is done
+// once every draw submitted up to and including it has been presented.
+typedef uint32_t display_fence_t;
+
+// Called from the display worker task when a draw completes. Keep it short.
+typedef void (*display_done_cb_t)(void *arg);
+
+struct DisplayStats {
+    uint32_t frames;          // Vsyncs seen since init
+    uint32_t underruns;       // Frames that overran the nominal period
+    uint32_t worst_frame_us;  // Longest vsync interval observed
+    uint32_t frame_us;        // Nominal frame period
+    int      bounce_rows;     // Active bounce buffer height (0 = off)
+    bool     direct_fb;       // Framebuffer writable directly
+    uint64_t pixels_pushed;   // Pixels written to the panel since init
+    uint32_t pixels_per_sec;  // Push rate over the last ~1 s window
+};
+
 // Initialize display hardware (I2C expander, ST7701S, RGB panel, backlight)
 // Returns true on success
 bool display_init();
@@ -24,8 +57,57 @@ void display_draw_fullscreen(const uint16_t *pixels);
 // Draw a rectangular region of RGB565 pixels
 void display_draw_rect(int x, int y, int w, int h, const uint16_t *pixels);
 
+// Async variants: queue the copy on the display worker and return at once.
+// The pixel buffer must stay untouched until the returned fence is done.
+// cb (optional) runs on the worker task after the copy.
+display_fence_t display_draw_fullscreen_async(const uint16_t *pixels,
+                                              display_done_cb_t cb, void *arg);
+display_fence_t display_draw_rect_async(int x, int y, int w, int h, const uint16_t *pixels,
+                                        display_done_cb_t cb, void *arg);
+
+// Present only the damaged regions of a full-screen (480x480) frame.
+// Rects are clipped, and overlapping/adjacent/nearby rects are merged
+// when one larger copy is cheaper than several small ones.
+void display_present(const uint16_t *frame, const Rect *rects, int n);
+display_fence_t display_present_async(const uint16_t *frame, const Rect *rects, int n,
+                                      display_done_cb_t cb, void *arg);
+
+// Panel framebuffer for direct writes, or NULL if the core doesn't expose
+// it. Call display_wait_idle() before writing and display_commit() after.
+uint16_t *display_framebuffer();
+void display_commit(const Rect *rects, int n);
+
+// Fast RGB565 fill of any buffer (32-bit stores)
+void display_fill_buffer(uint16_t *dst, uint16_t color, int n);
+
+// Fence helpers. display_wait() returns false on timeout
+// (pass portMAX_DELAY to wait forever). Several tasks may submit draws
+// (fences are handed out in queue order) and wait at once; each
+// completion wakes all of them.
+bool display_fence_done(display_fence_t fence);
+bool display_wait(display_fence_t fence, uint32_t timeout_ms);
+void display_wait_idle();
+
 // Fill the entire screen with a solid RGB565 color
 void display_fill(uint16_t color);
 
+// Fill a rectangular region with a solid RGB565 color (clipped to screen).
+// Writes the panel framebuffer directly when the core exposes it.
+void display_fill_rect(int x, int y, int w, int h, uint16_t color);
+
+// Recreate the RGB panel with a different bounce buffer height (the
+// frame must be an even multiple of it). Returns false if unsupported by
+// the core, the size is invalid or the panel could not be recreated.
+// The screen is cleared to black.
+bool display_set_bounce_rows(int rows);
+
+// False once the RGB panel is gone (a bounce change that could not even
+// restore the old setup); draws then do nothing
+bool display_ok();
+
+// Read / reset the vsync-based underrun statistics
+void display_get_stats(DisplayStats *out);
+void display_reset_stats();
+
 // Set backlight on/off
 void display_backlight(bool on);
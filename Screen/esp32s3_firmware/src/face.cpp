@@ -2,8 +2,8 @@
  * Animated Face Renderer - Implementation
  *
  * Renders a clean, minimal face on the 480x480 SenseCAP display.
- * Uses scanline-based drawing to a PSRAM framebuffer, pushed
- * to the RGB panel at ~40fps.
+ * Uses scanline-based drawing into the compositor's face layer;
+ * only the regions that moved are recomposited and pushed (~40fps).
  *
  * Visual design:
  *   - Dark navy background
@@ -16,8 +16,8 @@
 
 #include "face.h"
 #include "display.h"
+#include "compositor.h"
 #include "pins.h"
-#include "esp_heap_caps.h"
 #include <math.h>
 
 // ============================================================================
@@ -74,7 +74,7 @@ static const uint16_t COL_HEART_B    = RGB565(255, 120, 155); // Lighter pink
 // State
 // ============================================================================
 
-static uint16_t *face_fb = NULL;       // Framebuffer in PSRAM
+static uint16_t *face_fb = NULL;       // Compositor face layer (PSRAM)
 static bool      s_enabled = false;
 static float     s_mouth_open = 0.0f;  // 0.0 - 1.0
 static float     s_love = 0.0f;        // 0.0 - 1.0
@@ -97,6 +97,14 @@ struct Heart {
 };
 static Heart s_hearts[MAX_HEARTS];
 
+// Damage: element bounding boxes for this frame and the previous one.
+// The panel only needs their union (old spots revert to background).
+#define MAX_FACE_DAMAGE  (3 + MAX_HEARTS)
+static Rect s_damage[2][MAX_FACE_DAMAGE];
+static int  s_damage_n[2] = { 0, 0 };
+static int  s_cur_damage = 0;
+static bool s_full_redraw = true;      // First frame after enable pushes everything
+
 // ============================================================================
 // Drawing Primitives
 // ============================================================================
@@ -156,6 +164,17 @@ static void fillHeart(int cx, int cy, float size, uint16_t color) {
     }
 }
 
+// Record an element's bounding box for this frame
+static void addDamage(int x, int y, int w, int h) {
+    int &n = s_damage_n[s_cur_damage];
+    if (n >= MAX_FACE_DAMAGE) {
+        s_full_redraw = true;
+        return;
+    }
+    Rect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    s_damage[s_cur_damage][n++] = r;
+}
+
 // ============================================================================
 // Floating Animation Helper
 // ============================================================================
@@ -232,6 +251,8 @@ static void drawHearts() {
         // Alternate color shades for variety
         uint16_t col = (i % 2 == 0) ? COL_HEART_A : COL_HEART_B;
         fillHeart((int)h.x, (int)h.y, sz, col);
+        int ext = (int)(sz + 0.5f);
+        addDamage((int)h.x - ext, (int)h.y - ext, 2 * ext + 1, 2 * ext + 1);
     }
 }
 
@@ -249,6 +270,7 @@ static void drawEye(int baseX, int baseY, float fx, float fy, float blinkFactor)
 
     // White sclera
     fillEllipse(cx, cy, EYE_RX, ry, COL_EYE_WHITE);
+    addDamage(cx - EYE_RX, cy - EYE_RY, 2 * EYE_RX + 1, 2 * EYE_RY + 1);
 
     // Pupil and highlight only when eye is sufficiently open
     if (ry > 10) {
@@ -284,6 +306,7 @@ static void drawMouth(int baseX, int baseY, float fx, float fy, float openness)
                 setPixel(cx + dx, cy + dy + t, COL_MOUTH);
             }
         }
+        addDamage(cx - rx, cy, 2 * rx + 1, SMILE_DEPTH + thickness);
     } else {
         // === Open mouth: filled ellipse ===
         int ry = MOUTH_RY_CLOSED + (int)((float)(MOUTH_RY_OPEN - MOUTH_RY_CLOSED) * openness);
@@ -296,6 +319,7 @@ static void drawMouth(int baseX, int baseY, float fx, float fy, float openness)
         if (ry > 8) {
             fillEllipse(cx, cy, rx - 5, ry - 5, COL_MOUTH_DARK);
         }
+        addDamage(cx - rx, cy - ry, 2 * rx + 1, 2 * ry + 1);
     }
 }
 
@@ -304,8 +328,7 @@ static void drawMouth(int baseX, int baseY, float fx, float fy, float openness)
 // ============================================================================
 
 bool face_init() {
-    size_t fb_size = SCR_W * SCR_H * sizeof(uint16_t);
-    face_fb = (uint16_t *)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
+    face_fb = compositor_layer(LAYER_FACE);
     if (!face_fb) return false;
 
     // Seed RNG with hardware random
@@ -324,9 +347,11 @@ bool face_init() {
 
 void face_set_enabled(bool en) {
     s_enabled = en;
+    compositor_set_visible(LAYER_FACE, en);
     if (en) {
         s_start_ms = millis();
         s_last_frame_ms = 0;
+        s_full_redraw = true;
         s_next_blink = millis() + 2000 + random(3000);
     }
 }
@@ -366,6 +391,13 @@ void face_update() {
     if (now - s_last_frame_ms < FRAME_MS) return;
     s_last_frame_ms = now;
 
+    face_render_frame();
+}
+
+void face_render_frame() {
+    if (!face_fb) return;
+
+    unsigned long now = millis();
     float t = (float)(now - s_start_ms) / 1000.0f;
 
     // --- Blink logic ---
@@ -387,6 +419,10 @@ void face_update() {
         s_blink_start = now;
     }
 
+    // --- Start a fresh damage list for this frame ---
+    s_cur_damage ^= 1;
+    s_damage_n[s_cur_damage] = 0;
+
     // --- Clear framebuffer (fast 32-bit fill) ---
     {
         uint32_t fill32 = ((uint32_t)COL_BG << 16) | COL_BG;
@@ -418,6 +454,13 @@ void face_update() {
     updateHearts(t);
     drawHearts();
 
-    // --- Push framebuffer to display ---
-    display_draw_fullscreen(face_fb);
+    // --- Damage last frame's and this frame's element boxes, then push ---
+    if (s_full_redraw) {
+        compositor_damage_all();
+        s_full_redraw = false;
+    } else {
+        compositor_damage_rects(s_damage[0], s_damage_n[0]);
+        compositor_damage_rects(s_damage[1], s_damage_n[1]);
+    }
+    compositor_flush();
 }
@@ -14,8 +14,8 @@
 
 #include <Arduino.h>
 
-// Initialize the face renderer (allocates PSRAM framebuffer).
-// Call after display_init(). Returns false on allocation failure.
+// Initialize the face renderer (draws into the compositor face layer).
+// Call after compositor_init(). Returns false if the layer is missing.
 bool face_init();
 
 // Enable/disable face rendering mode.
@@ -36,6 +36,10 @@ float face_get_love();
 // Trigger a manual blink.
 void face_blink();
 
-// Call every loop() iteration. Renders a frame and pushes
-// to display if face mode is enabled. Rate-limited internally.
+// Call every loop() iteration. Renders a frame and flushes the
+// compositor if face mode is enabled. Rate-limited internally.
 void face_update();
+
+// Render and flush one frame right now, ignoring the rate limit and
+// the enabled flag (used by the bench command).
+void face_render_frame();
@@ -0,0 +1,102 @@
+/*
+ * Bitmap Font Text - Implementation
+ *
+ * Glyphs are blended into the target one pixel at a time: over a
+ * transparent pixel the text color takes the glyph coverage as its
+ * alpha; over text already drawn the colors are mixed and the higher
+ * alpha kept.
+ */
+
+#include "font.h"
+#include "font_data.h"
+#include "compositor.h"
+
+// 4-bit coverage -> 0..COMP_ALPHA_MAX
+#define COVERAGE_ALPHA(v)  (((v) * COMP_ALPHA_MAX + 7) / 15)
+
+static const FontGlyph *glyphFor(const Font *f, char c) {
+    uint8_t code = (uint8_t)c;
+    if (code < f->first || code >= f->first + f->count) code = '?';
+    return &f->glyphs[code - f->first];
+}
+
+// Union of the glyph boxes drawn so far
+struct Bounds {
+    int x0, y0, x1, y1;
+};
+
+static void drawGlyph(const Font *f, const FontGlyph *g, int x, int y, uint16_t color,
+                      uint16_t *pixels, uint8_t *alpha, Bounds &bb) {
+    int gx0 = x + g->x, gy0 = y + g->y;
+    if (gx0 >= LCD_H_RES || gy0 >= LCD_V_RES || gx0 + g->width <= 0 || gy0 + g->height <= 0) return;
+    bb.x0 = min(bb.x0, max(x + g->x, 0));
+    bb.y0 = min(bb.y0, max(y + g->y, 0));
+    bb.x1 = max(bb.x1, min(x + g->x + g->width, LCD_H_RES));
+    bb.y1 = max(bb.y1, min(y + g->y + g->height, LCD_V_RES));
+    const uint8_t *bits = f->bitmap + g->offset;
+    for (int gy = 0; gy < g->height; gy++) {
+        int py = y + g->y + gy;
+        if (py < 0 || py >= LCD_V_RES) continue;
+        for (int gx = 0; gx < g->width; gx++) {
+            int px = x + g->x + gx;
+            if (px < 0 || px >= LCD_H_RES) continue;
+            int i = gy * g->width + gx;
+            int v = (bits[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F;
+            if (!v) continue;
+
+            uint32_t a = COVERAGE_ALPHA(v);
+            int off = py * LCD_H_RES + px;
+            if (!alpha[off]) {
+                pixels[off] = color;
+                alpha[off] = a;
+            } else {
+                pixels[off] = lerp565(pixels[off], color, a);
+                if (a > alpha[off]) alpha[off] = a;
+            }
+        }
+    }
+}
+
+const Font *font_for_size(int px) {
+    const Font *best = FONTS[0];
+    for (int i = 1; i < FONT_COUNT; i++) {
+        if (abs(FONTS[i]->size - px) < abs(best->size - px)) best = FONTS[i];
+    }
+    return best;
+}
+
+int font_line_width(const Font *f, const char *text) {
+    int w = 0;
+    for (; *text && *text != '\n'; text++) w += glyphFor(f, *text)->advance;
+    return w;
+}
+
+int font_line_count(const char *text) {
+    int n = 1;
+    for (; *text; text++) {
+        if (*text == '\n') n++;
+    }
+    return n;
+}
+
+Rect font_draw(const Font *f, const char *text, int x, int y, int align, uint16_t color,
+               uint16_t *pixels, uint8_t *alpha) {
+    Bounds bb = { LCD_H_RES, LCD_V_RES, 0, 0 };
+    for (;;) {
+        int w = font_line_width(f, text);
+        int pen = align < 0 ? x : align == 0 ? x - w / 2 : x - w;
+        for (; *text && *text != '\n'; text++) {
+            const FontGlyph *g = glyphFor(f, *text);
+            if (g->width) drawGlyph(f, g, pen, y, color, pixels, alpha, bb);
+            pen += g->advance;
+        }
+        if (!*text) break;
+        text++;
+        y += f->height;
+    }
+    Rect r = { 0, 0, 0, 0 };
+    if (bb.x1 > bb.x0 && bb.y1 > bb.y0) {
+        r = { (int16_t)bb.x0, (int16_t)bb.y0, (int16_t)(bb.x1 - bb.x0), (int16_t)(bb.y1 - bb.y0) };
+    }
+    return r;
+}
@@ -0,0 +1,47 @@
+/*
+ * Bitmap Font Text for SenseCAP Indicator
+ *
+ * Anti-aliased fonts baked into flash by tools/gen_fonts.py (font_data.h)
+ * and drawn into an RGB565 layer with a per-pixel alpha plane (the
+ * compositor overlay), so text blends over whatever is below it.
+ * Printable ASCII only; other bytes draw as '?'. '\n' starts a new line.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "display.h"
+
+struct FontGlyph {
+    uint32_t offset;        // Into the bitmap, bytes
+    uint8_t  width;
+    uint8_t  height;
+    int8_t   x;             // From the pen position
+    int8_t   y;             // From the top of the line
+    uint8_t  advance;
+};
+
+// Glyph bitmaps are 4-bit coverage, two pixels per byte (high nibble
+// first), row after row with no padding
+struct Font {
+    uint8_t  size;          // Em size, px
+    uint8_t  height;        // Line height, px
+    uint8_t  first;         // First character code
+    uint8_t  count;
+    const FontGlyph *glyphs;
+    const uint8_t   *bitmap;
+};
+
+// The available font closest to px
+const Font *font_for_size(int px);
+
+// Width of one line (up to '\n' or the end) and the lines in text
+int font_line_width(const Font *f, const char *text);
+int font_line_count(const char *text);
+
+// Draw text with the top of its first line at y, each line placed by
+// align (-1 starting at x, 0 centered on x, 1 ending at x). Pixels take
+// color, alpha (0..COMP_ALPHA_MAX) the glyph coverage. Clipped to the
+// screen; returns the rect of pixels drawn (w = 0 if none).
+Rect font_draw(const Font *f, const char *text, int x, int y, int align, uint16_t color,
+               uint16_t *pixels, uint8_t *alpha);
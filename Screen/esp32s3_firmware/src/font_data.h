@@ -0,0 +1,5616 @@
+/*
+ * Anti-aliased bitmap fonts for the text command: DejaVuSans,
+ * 16, 24, 32, 48 px, ASCII 32-126, 4-bit coverage (see font.h).
+ *
+ * Generated by tools/gen_fonts.py - do not edit.
+ */
+
+#pragma once
+
+#include "font.h"
+
+static const uint8_t FONT_16_BITMAP[5094] = {
+    0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x8F, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x9F, 0x00, 0x07, 0xD0, 0x8C, 0x00, 0x7D, 0x08, 0xC0, 0x07, 0xD0, 0x8C, 0x00, 0x7D,
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xD0, 0x0D, 0x60, 0x00, 0x00, 0x00, 0xA9, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x6D,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x7C, 0x00, 0xE5, 0x00, 0x00, 0x00,
+    0x0A, 0x90, 0x2F, 0x20, 0x00, 0x00, 0x00, 0xE5, 0x05, 0xE0, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0x07, 0xC0, 0x0D, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xF1, 0x00, 0x00, 0x00,
+    0x0E, 0x40, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x5C, 0xEF, 0xC5, 0x00, 0x04, 0xF6, 0x67, 0x4A, 0x20, 0x09, 0xC0, 0x66, 0x00, 0x00, 0x08,
+    0xE2, 0x66, 0x00, 0x00, 0x01, 0xDE, 0xDA, 0x40, 0x00, 0x00, 0x05, 0xAE, 0xFD, 0x20, 0x00, 0x00,
+    0x66, 0x2D, 0xB0, 0x00, 0x00, 0x66, 0x0A, 0xC0, 0x08, 0x72, 0x67, 0x5E, 0x70, 0x02, 0x8C, 0xFE,
+    0xC6, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x02, 0xBE, 0xC3, 0x00,
+    0x00, 0xA9, 0x00, 0x00, 0xC9, 0x17, 0xD1, 0x00, 0x4E, 0x10, 0x00, 0x1F, 0x30, 0x1F, 0x30, 0x0D,
+    0x50, 0x00, 0x01, 0xF3, 0x01, 0xF3, 0x08, 0xB0, 0x00, 0x00, 0x0C, 0x91, 0x7E, 0x12, 0xE2, 0x00,
+    0x00, 0x00, 0x2B, 0xEC, 0x30, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x12, 0xBE, 0xC4,
+    0x00, 0x00, 0x00, 0x1D, 0x50, 0xBA, 0x17, 0xE1, 0x00, 0x00, 0x08, 0xB0, 0x0F, 0x40, 0x0F, 0x40,
+    0x00, 0x03, 0xE2, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0xB7, 0x00, 0x0B, 0xA1, 0x7E, 0x10, 0x00,
+    0x6D, 0x00, 0x00, 0x2B, 0xEC, 0x40, 0x00, 0x05, 0xCE, 0xC5, 0x00, 0x00, 0x00, 0x4F, 0x71, 0x3A,
+    0x20, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x9F, 0x70, 0x02, 0xF5,
+    0x0C, 0xB0, 0x08, 0xF7, 0x05, 0xF1, 0x0E, 0x80, 0x00, 0x8F, 0x7C, 0xA0, 0x0C, 0xC0, 0x00, 0x08,
+    0xFE, 0x20, 0x04, 0xFA, 0x21, 0x3A, 0xFF, 0x70, 0x00, 0x3A, 0xEF, 0xD9, 0x27, 0xF7, 0x07, 0xD0,
+    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x2F, 0x30, 0x00, 0x9C, 0x00, 0x01,
+    0xE6, 0x00, 0x04, 0xF3, 0x00, 0x07, 0xF0, 0x00, 0x09, 0xE0, 0x00, 0x09, 0xE0, 0x00, 0x07, 0xF0,
+    0x00, 0x04, 0xF3, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x09, 0xB0,
+    0x07, 0xC0, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0E, 0x80, 0x00,
+    0x0C, 0xB0, 0x00, 0x0A, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x0C, 0xB0, 0x00, 0x0E, 0x80, 0x00, 0x3F,
+    0x40, 0x00, 0x8D, 0x00, 0x01, 0xE6, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07,
+    0x70, 0x00, 0x4A, 0x37, 0x73, 0xA4, 0x02, 0x9D, 0xD9, 0x20, 0x02, 0x9D, 0xD9, 0x20, 0x4A, 0x37,
+    0x73, 0xA4, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE5, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x70, 0x06, 0xE1, 0x00, 0xA7, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5,
+    0x00, 0x4F, 0x50, 0x00, 0x01, 0xF3, 0x00, 0x06, 0xE0, 0x00, 0x0B, 0x90, 0x00, 0x1F, 0x40, 0x00,
+    0x5E, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xE5, 0x00, 0x04, 0xF1, 0x00, 0x09, 0xB0, 0x00, 0x0E, 0x60,
+    0x00, 0x3F, 0x20, 0x00, 0x8C, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x1A, 0xEE, 0xB3, 0x00, 0x00,
+    0xCC, 0x21, 0xAE, 0x10, 0x06, 0xF2, 0x00, 0x1E, 0x80, 0x0A, 0xD0, 0x00, 0x0A, 0xD0, 0x0D, 0xB0,
+    0x00, 0x08, 0xF1, 0x0E, 0xA0, 0x00, 0x07, 0xF1, 0x0E, 0xA0, 0x00, 0x07, 0xF1, 0x0D, 0xB0, 0x00,
+    0x08, 0xF1, 0x0A, 0xD0, 0x00, 0x0A, 0xD0, 0x06, 0xF2, 0x00, 0x1E, 0x80, 0x00, 0xCC, 0x21, 0xAE,
+    0x20, 0x00, 0x1A, 0xEE, 0xB3, 0x00, 0x00, 0x49, 0xEF, 0x20, 0x00, 0x03, 0xB6, 0x7F, 0x20, 0x00,
+    0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00,
+    0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00,
+    0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x02, 0x8C, 0xED, 0x91, 0x00, 0x0B, 0xD4, 0x13, 0xCD, 0x10, 0x07, 0x10, 0x00, 0x4F,
+    0x60, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x01, 0xDD, 0x10,
+    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00,
+    0x7F, 0x70, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x90, 0x01, 0x6C,
+    0xEE, 0xB3, 0x00, 0x06, 0x83, 0x12, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00,
+    0x1F, 0x80, 0x00, 0x00, 0x02, 0xAE, 0x20, 0x00, 0x0C, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x02, 0xAE,
+    0x40, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xB0,
+    0x09, 0x52, 0x13, 0xAF, 0x30, 0x02, 0x9D, 0xFD, 0xA2, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00,
+    0x00, 0x5E, 0xF9, 0x00, 0x00, 0x01, 0xE6, 0xE9, 0x00, 0x00, 0x0A, 0xC0, 0xE9, 0x00, 0x00, 0x4F,
+    0x30, 0xE9, 0x00, 0x01, 0xD9, 0x00, 0xE9, 0x00, 0x09, 0xE1, 0x00, 0xE9, 0x00, 0x2F, 0x50, 0x00,
+    0xE9, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xE9,
+    0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x04, 0xFF, 0xFF, 0xFE, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00,
+    0x04, 0xF3, 0x00, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x04, 0xFE, 0xFE, 0x92, 0x00, 0x04,
+    0x82, 0x14, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00,
+    0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x09, 0x52, 0x14, 0xDD, 0x10, 0x02, 0x9D, 0xFD,
+    0x92, 0x00, 0x00, 0x04, 0xBE, 0xD8, 0x10, 0x00, 0x6E, 0x51, 0x17, 0x60, 0x02, 0xF5, 0x00, 0x00,
+    0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC7, 0xDF, 0xD6, 0x00, 0x0D, 0xFD, 0x31, 0x7F, 0x70,
+    0x0D, 0xF4, 0x00, 0x0B, 0xE0, 0x0C, 0xF1, 0x00, 0x07, 0xF2, 0x09, 0xF1, 0x00, 0x07, 0xF2, 0x04,
+    0xF4, 0x00, 0x0A, 0xE0, 0x00, 0xBD, 0x31, 0x6F, 0x60, 0x00, 0x19, 0xEF, 0xC6, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x01,
+    0xEB, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00, 0x00, 0x1F, 0xA0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
+    0x00, 0x08, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0xC5, 0x00, 0x03,
+    0xF9, 0x11, 0x7F, 0x60, 0x08, 0xF1, 0x00, 0x0D, 0xB0, 0x08, 0xF1, 0x00, 0x0D, 0xB0, 0x02, 0xE9,
+    0x11, 0x7E, 0x40, 0x00, 0x3D, 0xFF, 0xE5, 0x00, 0x03, 0xE9, 0x21, 0x7F, 0x60, 0x0B, 0xD0, 0x00,
+    0x0A, 0xE0, 0x0D, 0xB0, 0x00, 0x08, 0xF1, 0x0C, 0xD0, 0x00, 0x0A, 0xE0, 0x05, 0xF9, 0x11, 0x7F,
+    0x80, 0x00, 0x4B, 0xEE, 0xC6, 0x00, 0x00, 0x4B, 0xEE, 0xA2, 0x00, 0x04, 0xF9, 0x12, 0xBD, 0x10,
+    0x0B, 0xD0, 0x00, 0x2F, 0x70, 0x0E, 0xA0, 0x00, 0x0D, 0xC0, 0x0E, 0xA0, 0x00, 0x0D, 0xE0, 0x0B,
+    0xD0, 0x00, 0x2F, 0xF1, 0x04, 0xF9, 0x12, 0xBF, 0xF0, 0x00, 0x5C, 0xFE, 0x89, 0xE0, 0x00, 0x00,
+    0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0x82, 0x04, 0xD9, 0x00, 0x00, 0x7D, 0xFC,
+    0x60, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x70, 0x06, 0xE1, 0x00, 0xA7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFE, 0x70, 0x00, 0x00, 0x49, 0xEF,
+    0xB5, 0x00, 0x00, 0x17, 0xDF, 0xC7, 0x10, 0x00, 0x00, 0x04, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xDF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x6C, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0x89, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+    0xFE, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF,
+    0xFA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xAE, 0xFA, 0x40, 0x00,
+    0x02, 0x8D, 0xFC, 0x61, 0x00, 0x00, 0x2C, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x04, 0xB5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xAD, 0xEB, 0x30, 0x00, 0xA5, 0x12, 0xBE, 0x10, 0x00, 0x00, 0x04, 0xF5,
+    0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x0B,
+    0xD0, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xED, 0x93, 0x00,
+    0x00, 0x00, 0x04, 0xE9, 0x41, 0x02, 0x7E, 0x70, 0x00, 0x00, 0x4E, 0x40, 0x00, 0x00, 0x02, 0xD7,
+    0x00, 0x01, 0xE5, 0x01, 0xAF, 0xE8, 0xC5, 0x2F, 0x30, 0x07, 0xB0, 0x0A, 0xC2, 0x2B, 0xF5, 0x09,
+    0x90, 0x0B, 0x50, 0x1F, 0x30, 0x03, 0xF5, 0x06, 0xC0, 0x0D, 0x30, 0x3F, 0x00, 0x00, 0xE5, 0x04,
+    0xD0, 0x0D, 0x30, 0x4F, 0x00, 0x00, 0xE5, 0x06, 0xB0, 0x0C, 0x50, 0x1F, 0x30, 0x02, 0xF5, 0x0B,
+    0x70, 0x07, 0xA0, 0x0A, 0xC2, 0x2B, 0xF6, 0x8C, 0x00, 0x01, 0xE4, 0x01, 0xAE, 0xD8, 0xBC, 0x70,
+    0x00, 0x00, 0x5E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE9, 0x31, 0x13, 0x6C, 0x40,
+    0x00, 0x00, 0x00, 0x18, 0xCE, 0xED, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00,
+    0x1E, 0xFE, 0x00, 0x00, 0x00, 0x05, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0E, 0xA0, 0x00, 0x00,
+    0x2F, 0x80, 0x9F, 0x10, 0x00, 0x07, 0xF3, 0x03, 0xF6, 0x00, 0x00, 0xDD, 0x00, 0x0D, 0xC0, 0x00,
+    0x3F, 0x70, 0x00, 0x8F, 0x20, 0x09, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xEA, 0x00, 0x00, 0x0B, 0xD0,
+    0x5F, 0x50, 0x00, 0x00, 0x5F, 0x4A, 0xE0, 0x00, 0x00, 0x01, 0xE9, 0x06, 0xFF, 0xFF, 0xDA, 0x20,
+    0x00, 0x6F, 0x20, 0x03, 0xCD, 0x10, 0x06, 0xF2, 0x00, 0x05, 0xF4, 0x00, 0x6F, 0x20, 0x00, 0x5F,
+    0x40, 0x06, 0xF2, 0x00, 0x3C, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0xD3, 0x00, 0x06, 0xF2, 0x00, 0x29,
+    0xE3, 0x00, 0x6F, 0x20, 0x00, 0x0E, 0xA0, 0x06, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x6F, 0x20, 0x00,
+    0x0E, 0xB0, 0x06, 0xF2, 0x00, 0x29, 0xF4, 0x00, 0x6F, 0xFF, 0xFE, 0xB4, 0x00, 0x00, 0x03, 0xAD,
+    0xFD, 0xB5, 0x00, 0x06, 0xF9, 0x20, 0x27, 0xF5, 0x03, 0xF8, 0x00, 0x00, 0x03, 0x40, 0xAE, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x70, 0x00, 0x00, 0x34, 0x00, 0x6F, 0x92, 0x02, 0x7F, 0x50, 0x00, 0x3A, 0xEF, 0xDB, 0x50, 0x06,
+    0xFF, 0xFE, 0xDA, 0x50, 0x00, 0x06, 0xF2, 0x00, 0x27, 0xEB, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x3F,
+    0x90, 0x06, 0xF2, 0x00, 0x00, 0x0A, 0xF1, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF4, 0x06, 0xF2, 0x00,
+    0x00, 0x05, 0xF5, 0x06, 0xF2, 0x00, 0x00, 0x05, 0xF5, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF4, 0x06,
+    0xF2, 0x00, 0x00, 0x0A, 0xF1, 0x06, 0xF2, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xF2, 0x00, 0x27, 0xEB,
+    0x00, 0x06, 0xFF, 0xFE, 0xDA, 0x50, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x06, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xFF, 0xB0, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0xFF, 0xF1, 0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00,
+    0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x06, 0xF2,
+    0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x00, 0x03, 0xAD, 0xFE, 0xC8, 0x20, 0x00,
+    0x6F, 0x93, 0x01, 0x5D, 0xC0, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x70, 0x0A, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00,
+    0x1F, 0xFF, 0xF1, 0x0E, 0xA0, 0x00, 0x00, 0x07, 0xF1, 0x0A, 0xE0, 0x00, 0x00, 0x07, 0xF1, 0x03,
+    0xF7, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x6F, 0x93, 0x01, 0x4B, 0xF1, 0x00, 0x03, 0xAD, 0xFE, 0xC9,
+    0x30, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00,
+    0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F,
+    0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00,
+    0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x2F, 0x70, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2,
+    0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00,
+    0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+    0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00,
+    0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x8F, 0x10, 0x03, 0xEB,
+    0x00, 0xCD, 0x91, 0x00, 0x06, 0xF2, 0x00, 0x03, 0xEC, 0x10, 0x6F, 0x20, 0x03, 0xEC, 0x10, 0x06,
+    0xF2, 0x04, 0xEC, 0x10, 0x00, 0x6F, 0x24, 0xEB, 0x10, 0x00, 0x06, 0xF7, 0xFB, 0x10, 0x00, 0x00,
+    0x6F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0x29, 0xF7, 0x00, 0x00,
+    0x06, 0xF2, 0x09, 0xF7, 0x00, 0x00, 0x6F, 0x20, 0x0A, 0xF6, 0x00, 0x06, 0xF2, 0x00, 0x0A, 0xF6,
+    0x00, 0x6F, 0x20, 0x00, 0x0B, 0xF5, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06,
+    0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00,
+    0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F,
+    0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0x20, 0x00,
+    0x04, 0xFF, 0x40, 0x06, 0xFE, 0x70, 0x00, 0x0A, 0xEF, 0x40, 0x06, 0xFA, 0xC0, 0x00, 0x1E, 0xAF,
+    0x40, 0x06, 0xF5, 0xF2, 0x00, 0x5E, 0x5F, 0x40, 0x06, 0xF2, 0xD8, 0x00, 0xBA, 0x4F, 0x40, 0x06,
+    0xF2, 0x7D, 0x01, 0xF4, 0x4F, 0x40, 0x06, 0xF2, 0x2F, 0x36, 0xE0, 0x4F, 0x40, 0x06, 0xF2, 0x0C,
+    0x9C, 0x90, 0x4F, 0x40, 0x06, 0xF2, 0x06, 0xEF, 0x30, 0x4F, 0x40, 0x06, 0xF2, 0x01, 0xFD, 0x00,
+    0x4F, 0x40, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0x40,
+    0x06, 0xFE, 0x10, 0x00, 0x2F, 0x60, 0x06, 0xFF, 0x70, 0x00, 0x2F, 0x60, 0x06, 0xFB, 0xE1, 0x00,
+    0x2F, 0x60, 0x06, 0xF4, 0xF8, 0x00, 0x2F, 0x60, 0x06, 0xF2, 0x9E, 0x10, 0x2F, 0x60, 0x06, 0xF2,
+    0x2F, 0x80, 0x2F, 0x60, 0x06, 0xF2, 0x08, 0xE1, 0x2F, 0x60, 0x06, 0xF2, 0x01, 0xE9, 0x2F, 0x60,
+    0x06, 0xF2, 0x00, 0x8F, 0x4F, 0x60, 0x06, 0xF2, 0x00, 0x1E, 0xBF, 0x60, 0x06, 0xF2, 0x00, 0x07,
+    0xFF, 0x60, 0x06, 0xF2, 0x00, 0x01, 0xEF, 0x60, 0x00, 0x04, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x07,
+    0xF8, 0x20, 0x3C, 0xD2, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0xAE, 0x10, 0x00, 0x00,
+    0x6F, 0x40, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x1F,
+    0x90, 0x00, 0x00, 0x00, 0xFA, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0A, 0xE0, 0x00, 0x00,
+    0x06, 0xF4, 0x00, 0x4F, 0x80, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x7F, 0x82, 0x03, 0xCE, 0x20, 0x00,
+    0x00, 0x4B, 0xEF, 0xD9, 0x10, 0x00, 0x06, 0xFF, 0xFE, 0xC7, 0x00, 0x06, 0xF2, 0x01, 0x7F, 0x80,
+    0x06, 0xF2, 0x00, 0x0B, 0xE0, 0x06, 0xF2, 0x00, 0x09, 0xF1, 0x06, 0xF2, 0x00, 0x0B, 0xE0, 0x06,
+    0xF2, 0x01, 0x7F, 0x80, 0x06, 0xFF, 0xFE, 0xC7, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x07, 0xF8, 0x20, 0x3C, 0xD2, 0x00, 0x03,
+    0xF8, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0xAE, 0x10, 0x00, 0x00, 0x6F, 0x40, 0x0E, 0xB0, 0x00, 0x00,
+    0x02, 0xF8, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0xEB, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0A, 0xE0, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x4F, 0x80, 0x00,
+    0x01, 0xDD, 0x00, 0x00, 0x7F, 0x82, 0x03, 0xCE, 0x20, 0x00, 0x00, 0x4B, 0xEF, 0xFC, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0x00, 0x06, 0xFF, 0xFF,
+    0xD7, 0x00, 0x00, 0x6F, 0x20, 0x16, 0xF8, 0x00, 0x06, 0xF2, 0x00, 0x0B, 0xE0, 0x00, 0x6F, 0x20,
+    0x00, 0x9F, 0x10, 0x06, 0xF2, 0x00, 0x0B, 0xE0, 0x00, 0x6F, 0x20, 0x16, 0xF8, 0x00, 0x06, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x6F, 0x20, 0x19, 0xF4, 0x00, 0x06, 0xF2, 0x00, 0x0C, 0xD0, 0x00, 0x6F,
+    0x20, 0x00, 0x4F, 0x60, 0x06, 0xF2, 0x00, 0x00, 0xCD, 0x00, 0x6F, 0x20, 0x00, 0x04, 0xF6, 0x00,
+    0x4B, 0xEE, 0xC7, 0x10, 0x06, 0xF8, 0x21, 0x5D, 0x80, 0x0C, 0xC0, 0x00, 0x01, 0x60, 0x0D, 0xA0,
+    0x00, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xD9, 0x61, 0x00, 0x00, 0x03, 0x7A,
+    0xEE, 0x50, 0x00, 0x00, 0x00, 0x1C, 0xE1, 0x00, 0x00, 0x00, 0x06, 0xF3, 0x08, 0x00, 0x00, 0x08,
+    0xF2, 0x0D, 0xC4, 0x11, 0x6E, 0xB0, 0x02, 0x8C, 0xEE, 0xC8, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x4F, 0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F, 0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F, 0x50, 0x09,
+    0xF0, 0x00, 0x00, 0x4F, 0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F, 0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F,
+    0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F, 0x50, 0x09, 0xF0, 0x00, 0x00, 0x4F, 0x50, 0x08, 0xF1, 0x00,
+    0x00, 0x5F, 0x40, 0x04, 0xF5, 0x00, 0x00, 0x9E, 0x10, 0x00, 0xBD, 0x41, 0x27, 0xF7, 0x00, 0x00,
+    0x18, 0xDF, 0xEC, 0x50, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x1E, 0x95, 0xF5, 0x00, 0x00, 0x06, 0xF4,
+    0x0E, 0xA0, 0x00, 0x00, 0xBD, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0x80, 0x03, 0xF6, 0x00, 0x07, 0xF2,
+    0x00, 0x0D, 0xC0, 0x00, 0xDC, 0x00, 0x00, 0x7F, 0x20, 0x3F, 0x60, 0x00, 0x02, 0xF8, 0x09, 0xF1,
+    0x00, 0x00, 0x0B, 0xD0, 0xEA, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x40, 0x00, 0x00, 0x01, 0xEF, 0xE0,
+    0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x06, 0xF3, 0x2F,
+    0x70, 0x00, 0x5E, 0xF2, 0x00, 0x0A, 0xE0, 0x0D, 0xB0, 0x00, 0x9B, 0xD6, 0x00, 0x0E, 0xA0, 0x09,
+    0xE0, 0x00, 0xC7, 0x9A, 0x00, 0x2F, 0x70, 0x06, 0xF3, 0x01, 0xF3, 0x6D, 0x00, 0x6F, 0x30, 0x02,
+    0xF7, 0x05, 0xE0, 0x2F, 0x20, 0x9E, 0x00, 0x00, 0xDA, 0x08, 0xB0, 0x0E, 0x60, 0xDB, 0x00, 0x00,
+    0xAE, 0x0C, 0x80, 0x0A, 0x92, 0xF7, 0x00, 0x00, 0x6F, 0x3F, 0x40, 0x07, 0xD5, 0xF3, 0x00, 0x00,
+    0x2F, 0xAF, 0x10, 0x03, 0xFA, 0xE0, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00,
+    0x0A, 0xF8, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0xCD, 0x10, 0x1E, 0xA0, 0x00,
+    0x7F, 0x30, 0x00, 0x6F, 0x50, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x1C, 0xD0, 0x00, 0x00, 0x02, 0xED,
+    0xF3, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x8F,
+    0x6F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x30, 0x00, 0x0C, 0xD0, 0x00, 0xCC, 0x00, 0x08, 0xF3,
+    0x00, 0x03, 0xF7, 0x03, 0xF8, 0x00, 0x00, 0x08, 0xF3, 0x0B, 0xE1, 0x00, 0x00, 0x3F, 0x70, 0x2E,
+    0xA0, 0x00, 0x0C, 0xC0, 0x00, 0x6F, 0x50, 0x08, 0xF3, 0x00, 0x00, 0xBE, 0x13, 0xF8, 0x00, 0x00,
+    0x02, 0xE9, 0xCC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0xE3, 0x00, 0x00, 0x00, 0x0C, 0xF6,
+    0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x10, 0x00, 0x00, 0x02, 0xEE, 0x20,
+    0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00,
+    0x00, 0x00, 0x2E, 0xE2, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x09, 0xFF, 0xA0,
+    0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09,
+    0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0, 0x00, 0x09, 0xC0,
+    0x00, 0x09, 0xC0, 0x00, 0x09, 0xFF, 0xA0, 0xD7, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x3F, 0x20, 0x00,
+    0x0E, 0x60, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF1, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xAA, 0x00, 0x00,
+    0x5E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x90, 0x00, 0x06, 0xE0, 0x00, 0x02, 0xF3, 0x07, 0xFF,
+    0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0,
+    0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00, 0x09, 0xD0, 0x00,
+    0x09, 0xD0, 0x00, 0x09, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x09, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x09, 0xE6, 0xCE, 0x30, 0x00, 0x00, 0x0A, 0xD3, 0x00, 0xAE, 0x30, 0x00, 0x1B, 0xC1, 0x00, 0x00,
+    0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x6D,
+    0x10, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFD, 0xA2, 0x00, 0x00, 0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x7D, 0xEF,
+    0xFF, 0x50, 0x09, 0xE4, 0x10, 0x2F, 0x50, 0x0E, 0x80, 0x00, 0x3F, 0x50, 0x0E, 0x70, 0x00, 0x9F,
+    0x50, 0x0A, 0xD3, 0x16, 0xAF, 0x50, 0x01, 0xAE, 0xE9, 0x2F, 0x50, 0x08, 0xE0, 0x00, 0x00, 0x00,
+    0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x08,
+    0xEA, 0x41, 0x6F, 0x60, 0x08, 0xF5, 0x00, 0x09, 0xD0, 0x08, 0xF0, 0x00, 0x05, 0xF2, 0x08, 0xE0,
+    0x00, 0x03, 0xF4, 0x08, 0xF0, 0x00, 0x05, 0xF2, 0x08, 0xF5, 0x00, 0x09, 0xE0, 0x08, 0xEA, 0x31,
+    0x6F, 0x60, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x00, 0x3A, 0xEE, 0xB3, 0x00, 0x3E, 0xA2, 0x14, 0x90,
+    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0xA2, 0x14, 0x90, 0x00, 0x3A, 0xEE, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+    0x5D, 0xFC, 0x3B, 0xB0, 0x04, 0xF8, 0x13, 0xBC, 0xB0, 0x0B, 0xC0, 0x00, 0x2F, 0xB0, 0x0F, 0x70,
+    0x00, 0x0D, 0xB0, 0x1F, 0x60, 0x00, 0x0B, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0, 0x0B, 0xB0, 0x00,
+    0x2F, 0xB0, 0x04, 0xF8, 0x12, 0xAC, 0xB0, 0x00, 0x5D, 0xFC, 0x3B, 0xB0, 0x00, 0x3A, 0xEF, 0xC4,
+    0x00, 0x03, 0xEA, 0x21, 0x7F, 0x30, 0x0B, 0xD0, 0x00, 0x0B, 0xA0, 0x0F, 0x80, 0x00, 0x08, 0xE0,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x70, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03,
+    0xEA, 0x21, 0x27, 0x80, 0x00, 0x2A, 0xEF, 0xD8, 0x20, 0x00, 0x6D, 0xFE, 0x01, 0xF7, 0x00, 0x04,
+    0xF3, 0x00, 0x9F, 0xFF, 0xF8, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3,
+    0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x5D, 0xFC,
+    0x3B, 0xB0, 0x04, 0xF8, 0x12, 0xAC, 0xB0, 0x0B, 0xB0, 0x00, 0x2F, 0xB0, 0x0F, 0x70, 0x00, 0x0D,
+    0xB0, 0x1F, 0x60, 0x00, 0x0B, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0, 0x0B, 0xB0, 0x00, 0x2F, 0xB0,
+    0x04, 0xF7, 0x12, 0xAC, 0xB0, 0x00, 0x5D, 0xFC, 0x3C, 0xA0, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x01,
+    0x93, 0x12, 0xAE, 0x20, 0x00, 0x6C, 0xEE, 0xB3, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0,
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE1, 0xAE, 0xD6, 0x00, 0x08, 0xEA, 0x41,
+    0x7F, 0x30, 0x08, 0xF4, 0x00, 0x0D, 0x90, 0x08, 0xF0, 0x00, 0x0B, 0xB0, 0x08, 0xE0, 0x00, 0x0A,
+    0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0,
+    0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x7E, 0x00,
+    0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07,
+    0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x8D, 0x00, 0x1C, 0xA0,
+    0x4E, 0xB2, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00,
+    0x00, 0x00, 0x08, 0xE0, 0x00, 0x6F, 0x70, 0x08, 0xE0, 0x07, 0xF6, 0x00, 0x08, 0xE0, 0x8E, 0x50,
+    0x00, 0x08, 0xEA, 0xE4, 0x00, 0x00, 0x08, 0xFE, 0xB0, 0x00, 0x00, 0x08, 0xE4, 0xEA, 0x00, 0x00,
+    0x08, 0xE0, 0x4E, 0xA0, 0x00, 0x08, 0xE0, 0x03, 0xEA, 0x00, 0x08, 0xE0, 0x00, 0x3E, 0xA0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x08, 0xE1, 0xBE, 0xD4, 0x04, 0xCF, 0xB2, 0x00, 0x08,
+    0xEA, 0x31, 0x9E, 0x49, 0x22, 0xDA, 0x00, 0x08, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x6F, 0x10, 0x08,
+    0xF0, 0x00, 0x0E, 0xA0, 0x00, 0x4F, 0x30, 0x08, 0xE0, 0x00, 0x0D, 0x90, 0x00, 0x3F, 0x40, 0x08,
+    0xE0, 0x00, 0x0D, 0x80, 0x00, 0x3F, 0x40, 0x08, 0xE0, 0x00, 0x0D, 0x80, 0x00, 0x3F, 0x40, 0x08,
+    0xE0, 0x00, 0x0D, 0x80, 0x00, 0x3F, 0x40, 0x08, 0xE0, 0x00, 0x0D, 0x80, 0x00, 0x3F, 0x40, 0x08,
+    0xE1, 0xAE, 0xD6, 0x00, 0x08, 0xEA, 0x41, 0x7F, 0x30, 0x08, 0xF4, 0x00, 0x0D, 0x90, 0x08, 0xF0,
+    0x00, 0x0B, 0xB0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x08, 0xE0, 0x00,
+    0x0A, 0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x08, 0xE0, 0x00, 0x0A, 0xC0, 0x00, 0x4C, 0xEE, 0xA2,
+    0x00, 0x04, 0xF9, 0x12, 0xBE, 0x20, 0x0C, 0xC0, 0x00, 0x1E, 0x90, 0x0F, 0x80, 0x00, 0x0B, 0xC0,
+    0x1F, 0x70, 0x00, 0x0A, 0xE0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0C, 0xC0, 0x00, 0x1E, 0x90, 0x04,
+    0xF8, 0x12, 0xBE, 0x20, 0x00, 0x4C, 0xFE, 0xB2, 0x00, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x08, 0xEA,
+    0x41, 0x6F, 0x60, 0x08, 0xF5, 0x00, 0x09, 0xD0, 0x08, 0xF0, 0x00, 0x05, 0xF2, 0x08, 0xE0, 0x00,
+    0x03, 0xF4, 0x08, 0xF0, 0x00, 0x05, 0xF2, 0x08, 0xF5, 0x00, 0x09, 0xE0, 0x08, 0xEA, 0x31, 0x6F,
+    0x60, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00,
+    0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x3B, 0xB0, 0x04, 0xF8, 0x13, 0xBC, 0xB0, 0x0B,
+    0xC0, 0x00, 0x2F, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0, 0x1F, 0x60, 0x00, 0x0B, 0xB0, 0x0F, 0x70,
+    0x00, 0x0D, 0xB0, 0x0B, 0xB0, 0x00, 0x2F, 0xB0, 0x04, 0xF8, 0x12, 0xAC, 0xB0, 0x00, 0x5D, 0xFC,
+    0x3B, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x0B,
+    0xB0, 0x08, 0xE1, 0xAE, 0x90, 0x8E, 0xA4, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x08,
+    0xE0, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x08, 0xE0, 0x00,
+    0x00, 0x02, 0xAE, 0xEC, 0x50, 0x0C, 0xB2, 0x13, 0xA1, 0x0F, 0x60, 0x00, 0x00, 0x0D, 0xD5, 0x10,
+    0x00, 0x02, 0xBF, 0xFC, 0x50, 0x00, 0x01, 0x4A, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x2A, 0x41, 0x16,
+    0xF4, 0x04, 0xBE, 0xEC, 0x50, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x8F, 0xFF, 0xFD, 0x08, 0xE0,
+    0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x9E, 0xFD, 0x0A, 0xC0, 0x00, 0x0B, 0xA0, 0x0A, 0xC0, 0x00, 0x0B, 0xA0,
+    0x0A, 0xC0, 0x00, 0x0B, 0xA0, 0x0A, 0xC0, 0x00, 0x0B, 0xA0, 0x0A, 0xC0, 0x00, 0x0B, 0xA0, 0x09,
+    0xD0, 0x00, 0x0D, 0xA0, 0x07, 0xE1, 0x00, 0x2F, 0xA0, 0x02, 0xF9, 0x13, 0xAC, 0xA0, 0x00, 0x5D,
+    0xFB, 0x2B, 0xA0, 0x5F, 0x30, 0x00, 0x0B, 0xC0, 0xE8, 0x00, 0x01, 0xF7, 0x09, 0xD0, 0x00, 0x7F,
+    0x10, 0x4F, 0x40, 0x0C, 0xB0, 0x00, 0xD9, 0x02, 0xF5, 0x00, 0x08, 0xE1, 0x8E, 0x10, 0x00, 0x2F,
+    0x5D, 0x90, 0x00, 0x00, 0xCD, 0xF4, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x06, 0xF8,
+    0x00, 0x2F, 0x40, 0xE7, 0x00, 0xAE, 0xC0, 0x06, 0xF1, 0x0A, 0xB0, 0x0E, 0x8F, 0x10, 0xAC, 0x00,
+    0x7F, 0x03, 0xF1, 0xE4, 0x0E, 0x80, 0x03, 0xF4, 0x7C, 0x0B, 0x83, 0xF4, 0x00, 0x0E, 0x8B, 0x80,
+    0x7C, 0x6F, 0x10, 0x00, 0xAC, 0xE4, 0x03, 0xFB, 0xB0, 0x00, 0x06, 0xFF, 0x10, 0x0E, 0xF8, 0x00,
+    0x00, 0x2F, 0xC0, 0x00, 0xAF, 0x40, 0x00, 0x1D, 0xC0, 0x00, 0x4F, 0x60, 0x3F, 0x80, 0x1E, 0xA0,
+    0x00, 0x7F, 0x4B, 0xD1, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x01, 0xEC,
+    0xF7, 0x00, 0x00, 0xBD, 0x18, 0xF3, 0x00, 0x7F, 0x40, 0x0C, 0xD1, 0x3F, 0x80, 0x00, 0x2E, 0x90,
+    0x5F, 0x30, 0x00, 0x0B, 0xC0, 0xE9, 0x00, 0x02, 0xF6, 0x08, 0xE0, 0x00, 0x8E, 0x10, 0x2F, 0x50,
+    0x0D, 0x90, 0x00, 0xBB, 0x04, 0xF3, 0x00, 0x05, 0xF2, 0xAC, 0x00, 0x00, 0x0D, 0x9F, 0x60, 0x00,
+    0x00, 0x8F, 0xE1, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x1C, 0xB0,
+    0x00, 0x00, 0xBF, 0xC2, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00,
+    0x3E, 0xC0, 0x00, 0x01, 0xDD, 0x10, 0x00, 0x0B, 0xE3, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x06, 0xF8,
+    0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x19, 0xEF, 0x30, 0x00,
+    0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00,
+    0x8D, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x00, 0x00, 0xFF, 0xC1,
+    0x00, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x00,
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00,
+    0x00, 0x00, 0x1A, 0xEF, 0x30, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00,
+    0xF5, 0x00, 0x0F, 0x50, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00, 0xF5,
+    0x00, 0x0F, 0x50, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00, 0xF5, 0x00, 0x0F, 0x50, 0x00, 0xFE, 0xB2,
+    0x00, 0x00, 0x00, 0x02, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00,
+    0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x02,
+    0xE9, 0x00, 0x00, 0x00, 0xFE, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xCE, 0xD9, 0x41, 0x16, 0xA0, 0x04, 0xA3, 0x03, 0x7C, 0xED, 0xA2, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const FontGlyph FONT_16_GLYPHS[95] = {
+    { 0, 0, 0, 0, 0, 5 },  // space
+    { 0, 6, 12, 0, 3, 6 },  // !
+    { 36, 7, 12, 0, 3, 7 },  // "
+    { 78, 13, 11, 0, 4, 13 },  // #
+    { 150, 10, 14, 0, 3, 10 },  // $
+    { 220, 15, 12, 0, 3, 15 },  // %
+    { 310, 12, 12, 0, 3, 12 },  // &
+    { 382, 4, 12, 0, 3, 4 },  // '
+    { 406, 6, 14, 0, 3, 6 },  // (
+    { 448, 6, 14, 0, 3, 6 },  // )
+    { 490, 8, 12, 0, 3, 8 },  // *
+    { 538, 13, 9, 0, 6, 13 },  // +
+    { 597, 5, 4, 0, 13, 5 },  // ,
+    { 607, 6, 5, 0, 10, 6 },  // -
+    { 622, 5, 2, 0, 13, 5 },  // .
+    { 627, 6, 13, 0, 3, 5 },  // /
+    { 666, 10, 12, 0, 3, 10 },  // 0
+    { 726, 10, 12, 0, 3, 10 },  // 1
+    { 786, 10, 12, 0, 3, 10 },  // 2
+    { 846, 10, 12, 0, 3, 10 },  // 3
+    { 906, 10, 12, 0, 3, 10 },  // 4
+    { 966, 10, 12, 0, 3, 10 },  // 5
+    { 1026, 10, 12, 0, 3, 10 },  // 6
+    { 1086, 10, 12, 0, 3, 10 },  // 7
+    { 1146, 10, 12, 0, 3, 10 },  // 8
+    { 1206, 10, 12, 0, 3, 10 },  // 9
+    { 1266, 5, 8, 0, 7, 5 },  // :
+    { 1286, 5, 10, 0, 7, 5 },  // ;
+    { 1311, 13, 9, 0, 6, 13 },  // <
+    { 1370, 13, 7, 0, 8, 13 },  // =
+    { 1416, 13, 9, 0, 6, 13 },  // >
+    { 1475, 9, 12, 0, 3, 9 },  // ?
+    { 1529, 16, 14, 0, 4, 16 },  // @
+    { 1641, 11, 12, 0, 3, 11 },  // A
+    { 1707, 11, 12, 0, 3, 11 },  // B
+    { 1773, 11, 12, 0, 3, 11 },  // C
+    { 1839, 12, 12, 0, 3, 12 },  // D
+    { 1911, 10, 12, 0, 3, 10 },  // E
+    { 1971, 9, 12, 0, 3, 9 },  // F
+    { 2025, 12, 12, 0, 3, 12 },  // G
+    { 2097, 12, 12, 0, 3, 12 },  // H
+    { 2169, 5, 12, 0, 3, 5 },  // I
+    { 2199, 6, 15, -1, 3, 5 },  // J
+    { 2244, 11, 12, 0, 3, 11 },  // K
+    { 2310, 9, 12, 0, 3, 9 },  // L
+    { 2364, 14, 12, 0, 3, 14 },  // M
+    { 2448, 12, 12, 0, 3, 12 },  // N
+    { 2520, 13, 12, 0, 3, 13 },  // O
+    { 2598, 10, 12, 0, 3, 10 },  // P
+    { 2658, 13, 14, 0, 3, 13 },  // Q
+    { 2749, 11, 12, 0, 3, 11 },  // R
+    { 2815, 10, 12, 0, 3, 10 },  // S
+    { 2875, 11, 12, -1, 3, 10 },  // T
+    { 2941, 12, 12, 0, 3, 12 },  // U
+    { 3013, 11, 12, 0, 3, 11 },  // V
+    { 3079, 16, 12, 0, 3, 16 },  // W
+    { 3175, 11, 12, 0, 3, 11 },  // X
+    { 3241, 11, 12, -1, 3, 10 },  // Y
+    { 3307, 11, 12, 0, 3, 11 },  // Z
+    { 3373, 6, 14, 0, 3, 6 },  // [
+    { 3415, 6, 13, 0, 3, 5 },  // backslash
+    { 3454, 6, 14, 0, 3, 6 },  // ]
+    { 3496, 13, 12, 0, 3, 13 },  // ^
+    { 3574, 10, 4, -1, 15, 8 },  // _
+    { 3594, 8, 13, 0, 2, 8 },  // `
+    { 3646, 10, 9, 0, 6, 10 },  // a
+    { 3691, 10, 12, 0, 3, 10 },  // b
+    { 3751, 9, 9, 0, 6, 9 },  // c
+    { 3792, 10, 12, 0, 3, 10 },  // d
+    { 3852, 10, 9, 0, 6, 10 },  // e
+    { 3897, 6, 12, 0, 3, 6 },  // f
+    { 3933, 10, 12, 0, 6, 10 },  // g
+    { 3993, 10, 12, 0, 3, 10 },  // h
+    { 4053, 4, 12, 0, 3, 4 },  // i
+    { 4077, 5, 15, -1, 3, 4 },  // j
+    { 4115, 10, 12, 0, 3, 9 },  // k
+    { 4175, 4, 12, 0, 3, 4 },  // l
+    { 4199, 16, 9, 0, 6, 16 },  // m
+    { 4271, 10, 9, 0, 6, 10 },  // n
+    { 4316, 10, 9, 0, 6, 10 },  // o
+    { 4361, 10, 12, 0, 6, 10 },  // p
+    { 4421, 10, 12, 0, 6, 10 },  // q
+    { 4481, 7, 9, 0, 6, 7 },  // r
+    { 4513, 8, 9, 0, 6, 8 },  // s
+    { 4549, 6, 11, 0, 4, 6 },  // t
+    { 4582, 10, 9, 0, 6, 10 },  // u
+    { 4627, 9, 9, 0, 6, 9 },  // v
+    { 4668, 13, 9, 0, 6, 13 },  // w
+    { 4727, 9, 9, 0, 6, 9 },  // x
+    { 4768, 9, 12, 0, 6, 9 },  // y
+    { 4822, 8, 9, 0, 6, 8 },  // z
+    { 4858, 10, 15, 0, 3, 10 },  // {
+    { 4933, 5, 16, 0, 3, 5 },  // |
+    { 4973, 10, 15, 0, 3, 10 },  // }
+    { 5048, 13, 7, 0, 8, 13 },  // ~
+};
+
+static const Font FONT_16 = { 16, 19, 32, 95, FONT_16_GLYPHS, FONT_16_BITMAP };
+
+static const uint8_t FONT_24_BITMAP[11559] = {
+    0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xFE,
+    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x4F, 0xB0, 0x00,
+    0x0A, 0xF4, 0x04, 0xFB, 0x00, 0x00, 0xAF, 0x40, 0x4F, 0xB0, 0x00, 0x0A, 0xF4, 0x04, 0xFB, 0x00,
+    0x00, 0xAF, 0x40, 0x4F, 0xB0, 0x00, 0x0A, 0xF4, 0x04, 0xFB, 0x00, 0x00, 0xAF, 0x40, 0x4F, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x60, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x06, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFA,
+    0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x70, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x05, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x09, 0xF4, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x00, 0x8F, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0x90, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x04, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0xC9, 0x40, 0x00, 0x00,
+    0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x09, 0xFE, 0x62, 0xF2, 0x36, 0xB3, 0x00, 0x00, 0xEF,
+    0x50, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0,
+    0x1F, 0x20, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDA, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF,
+    0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFB, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x21,
+    0x9F, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xF2, 0x00, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x2F,
+    0xF3, 0x00, 0x0D, 0x83, 0x11, 0xF3, 0x5D, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x40,
+    0x00, 0x02, 0x7B, 0xDE, 0xFE, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0xC5, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00,
+    0x00, 0x00, 0x0A, 0xF4, 0x18, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00,
+    0x0E, 0xE0, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x9F, 0x40, 0x00, 0x3F,
+    0xA0, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x08, 0xF6, 0x00, 0x0C, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0x30, 0x00, 0x8F, 0x60, 0x06, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x09, 0xF4,
+    0x01, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0xDE, 0x00, 0x9F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0x41, 0x8F, 0x60, 0x3F, 0xA0, 0x07, 0xDF, 0xD6, 0x00, 0x00, 0x00, 0x8D,
+    0xFC, 0x50, 0x0C, 0xE1, 0x09, 0xF5, 0x17, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x02,
+    0xFA, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x7F, 0x60, 0x00, 0x8F, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x09, 0xF5, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0x90, 0x00, 0x9F, 0x50, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x07, 0xF6, 0x00,
+    0x08, 0xF5, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0xCF, 0x10, 0x00, 0x00,
+    0x02, 0xEC, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x7F, 0x70, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00,
+    0x00, 0x7D, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x04, 0xBE, 0xED, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xB3, 0x02, 0x6B, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x59, 0xFF, 0x80,
+    0x00, 0x01, 0xFF, 0x10, 0x01, 0xEF, 0x60, 0x07, 0xFF, 0x90, 0x00, 0x4F, 0xD0, 0x00, 0x5F, 0xE0,
+    0x00, 0x06, 0xFF, 0x90, 0x09, 0xF7, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x05, 0xFF, 0xA2, 0xEE, 0x10,
+    0x00, 0x6F, 0xE0, 0x00, 0x00, 0x04, 0xEF, 0xEF, 0x60, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x04,
+    0xFF, 0xD0, 0x00, 0x00, 0x08, 0xFF, 0xB4, 0x10, 0x27, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x73, 0xEF, 0x90, 0x00, 0x00, 0x04, 0xAD, 0xFE, 0xC8, 0x20, 0x05, 0xFF, 0x80,
+    0x00, 0xAF, 0x40, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0xAF,
+    0x40, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xF3, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x5F, 0xB0,
+    0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x02, 0xFF, 0x10, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x09,
+    0xF9, 0x00, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x00,
+    0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x5F,
+    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x10, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x00, 0x5F, 0xB0, 0x00,
+    0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0xCE,
+    0x20, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00,
+    0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x04,
+    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0x00, 0x01, 0xFF, 0x30, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+    0xB0, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x01, 0xFF, 0x20, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00,
+    0x0C, 0xF3, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0xCE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x1C, 0x60, 0x0A, 0xA0, 0x06, 0xC1, 0x06,
+    0xDD, 0x5A, 0xA5, 0xDD, 0x60, 0x00, 0x05, 0xCF, 0xFC, 0x50, 0x00, 0x00, 0x05, 0xCF, 0xFC, 0x50,
+    0x00, 0x06, 0xDD, 0x5A, 0xA5, 0xDD, 0x60, 0x1C, 0x60, 0x0A, 0xA0, 0x06, 0xC1, 0x00, 0x00, 0x0A,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
+    0x00, 0x00, 0x4F, 0xF2, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x01, 0xF9, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xF7, 0x00, 0xCF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x7F, 0xF1,
+    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00,
+    0x00, 0xEF, 0x10, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0xDF, 0x20,
+    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x2F,
+    0xD0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+    0x05, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x04, 0xFB, 0x00,
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEA,
+    0x30, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x1E, 0xFD, 0x40, 0x2A, 0xFF,
+    0x30, 0x00, 0x07, 0xFE, 0x20, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x00, 0x5F, 0xF1,
+    0x00, 0x1F, 0xF5, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x04, 0xFF, 0x20, 0x00, 0x00, 0x0D, 0xF8, 0x00,
+    0x5F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x6F,
+    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x4F, 0xF2,
+    0x00, 0x00, 0x00, 0xDF, 0x80, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x0D, 0xF9, 0x00,
+    0x00, 0x05, 0xFF, 0x10, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0xCF, 0xB0, 0x00, 0x01, 0xEF, 0xD4, 0x02,
+    0xAF, 0xF3, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xA3,
+    0x00, 0x00, 0x00, 0x03, 0x7A, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x5C, 0x85, 0x4F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x37, 0xBD, 0xEE, 0xC8, 0x20, 0x00,
+    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xC8, 0x42, 0x12, 0x6E, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0x15, 0xAC, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x99, 0x53, 0x11, 0x4B, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x13, 0xBF, 0xD1, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0xFF, 0x92, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF1,
+    0x00, 0x2B, 0x63, 0x10, 0x14, 0x9F, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00,
+    0x03, 0x8C, 0xDF, 0xED, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDE, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF4, 0xEF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x0E, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xEE,
+    0x20, 0xEF, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x0E, 0xF6, 0x00, 0x00, 0x00, 0x4F, 0xC0, 0x00,
+    0xEF, 0x60, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x0E, 0xF6, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0xEF,
+    0x60, 0x00, 0x02, 0xFE, 0x10, 0x00, 0x0E, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xEF, 0x60,
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x60, 0x00, 0x00, 0x6F,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xEC, 0xFE, 0xC8,
+    0x20, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x69, 0x42, 0x02, 0x6E, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xB0, 0x00, 0x2C,
+    0x73, 0x10, 0x26, 0xEF, 0xF3, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x03, 0x8C,
+    0xDF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xEE, 0xC7, 0x10, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0xFF, 0xA3, 0x11, 0x38, 0x80, 0x00, 0x01, 0xEF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x43, 0xBE, 0xED, 0x81, 0x00, 0x00, 0x4F, 0xF7, 0xFF, 0xFF, 0xFF, 0xD3,
+    0x00, 0x04, 0xFF, 0xFD, 0x51, 0x16, 0xEF, 0xD0, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x05, 0xFF, 0x50,
+    0x04, 0xFF, 0xB0, 0x00, 0x00, 0x0D, 0xF9, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x5F,
+    0xF3, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0xCF, 0xD4, 0x11, 0x6E, 0xFC, 0x00, 0x00, 0x02, 0xDF,
+    0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC7, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xEC, 0x71, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xC1, 0x00, 0x00, 0x6F, 0xFA, 0x31, 0x27, 0xFF, 0xA0, 0x00, 0x0C, 0xFC, 0x00, 0x00, 0x08, 0xFF,
+    0x10, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x3F, 0xF3, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0x03, 0xFF, 0x20,
+    0x00, 0x9F, 0xC0, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x02, 0xDF, 0xA3, 0x12, 0x7F, 0xF4, 0x00, 0x00,
+    0x02, 0x9F, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFD, 0x70, 0x00, 0x00, 0x7F,
+    0xF8, 0x21, 0x26, 0xEF, 0xA0, 0x00, 0x1E, 0xF7, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x04, 0xFF, 0x20,
+    0x00, 0x00, 0x0D, 0xF8, 0x00, 0x5F, 0xF2, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x03, 0xFF, 0x70, 0x00,
+    0x00, 0x3F, 0xF6, 0x00, 0x0C, 0xFF, 0x82, 0x02, 0x6E, 0xFE, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x40, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xD9, 0x20,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x8F, 0xF8, 0x20, 0x3B, 0xFE, 0x20,
+    0x00, 0x1E, 0xF9, 0x00, 0x00, 0x0D, 0xF9, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0x6F, 0xE0, 0x00,
+    0x7F, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0x30, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x5F,
+    0xF2, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0x90, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x09, 0xFF,
+    0x82, 0x03, 0xBF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x00, 0x00, 0x06, 0xCE,
+    0xEC, 0x60, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x05, 0xA4, 0x10, 0x28, 0xFF,
+    0x90, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x5B, 0xDF, 0xDA, 0x40, 0x00,
+    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
+    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x4F, 0xF2,
+    0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF,
+    0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x4D, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+    0xEF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xE9, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x98, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xC7,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFB, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF,
+    0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xBF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEF, 0xFE, 0x94, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFB, 0x51, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xFF, 0xC7,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xAE, 0xFD, 0x91, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xE2, 0x00,
+    0x04, 0xFB, 0x41, 0x17, 0xFF, 0xA0, 0x00, 0x46, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x01,
+    0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xFE, 0xC8,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xC6, 0x31, 0x02, 0x49, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD4,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x30, 0x00, 0x00, 0x08, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0x00, 0x07, 0xDF, 0xD8, 0x1A, 0xF0, 0x08, 0xF7, 0x00,
+    0x00, 0x9F, 0x40, 0x00, 0x9F, 0xFF, 0xFF, 0xCB, 0xF0, 0x01, 0xED, 0x00, 0x00, 0xEC, 0x00, 0x04,
+    0xFF, 0x61, 0x16, 0xEF, 0xF0, 0x00, 0x9F, 0x20, 0x03, 0xF7, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x6F,
+    0xF0, 0x00, 0x6F, 0x40, 0x05, 0xF5, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x6F, 0x50,
+    0x06, 0xF4, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x8F, 0x30, 0x05, 0xF5, 0x00, 0x0D,
+    0xF1, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xCF, 0x00, 0x03, 0xF7, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x6F,
+    0xF0, 0x06, 0xF9, 0x00, 0x00, 0xEC, 0x00, 0x04, 0xFE, 0x61, 0x16, 0xEF, 0xF2, 0x8F, 0xD1, 0x00,
+    0x00, 0xAF, 0x40, 0x00, 0x9F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x3F, 0xD1, 0x00,
+    0x07, 0xDF, 0xD8, 0x1A, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xFF, 0xB6, 0x21, 0x02, 0x5A, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDE, 0xED, 0x94,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xD7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0x30, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xF8, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x30, 0x00, 0xCF, 0xA0, 0x00,
+    0x00, 0x00, 0xAF, 0xD0, 0x00, 0x06, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF7,
+    0x00, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0xAF, 0xE0, 0x00, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x4F, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFA, 0x09, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFE, 0xB6, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x13, 0x9F, 0xF8, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x02, 0x9F, 0xF4, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x02, 0x5D, 0xFC, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x02, 0xFF, 0x60, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x00, 0xCF, 0xA0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0xCF, 0xB0, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0xAF, 0xB0, 0x00, 0x02, 0x5D, 0xFF, 0x30, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x01,
+    0x6B, 0xDF, 0xED, 0x93, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x06,
+    0xFF, 0xD7, 0x21, 0x12, 0x6C, 0xF7, 0x00, 0x03, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x05, 0x60, 0x00,
+    0xBF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x6F, 0xFD,
+    0x72, 0x11, 0x26, 0xCF, 0x70, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x16, 0xBD, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xED, 0xA7, 0x20, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x12, 0x6C, 0xFF, 0xD1,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x40, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xC0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0x40, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x12, 0x6C, 0xFF, 0xD1, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xED, 0xA7, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x10, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x6A, 0xDE, 0xFD, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00,
+    0x00, 0x06, 0xFF, 0xD7, 0x31, 0x01, 0x49, 0xEF, 0x30, 0x00, 0x03, 0xFF, 0xB1, 0x00, 0x00, 0x00,
+    0x01, 0x92, 0x00, 0x00, 0xBF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0x90, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF9, 0x00, 0x08, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x02,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x0B, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x0B,
+    0xF9, 0x00, 0x00, 0x3F, 0xFB, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xFD, 0x73,
+    0x10, 0x14, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00,
+    0x00, 0x16, 0xAD, 0xEF, 0xEB, 0x72, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00,
+    0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x0A, 0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A,
+    0xFB, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A,
+    0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFB,
+    0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
+    0x1E, 0xF6, 0x00, 0x00, 0x3B, 0xFF, 0x20, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x4F, 0xEB, 0x50, 0x00,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x01, 0xDF, 0xE3, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x02, 0xDF,
+    0xE2, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x02, 0xDF, 0xD2, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x02, 0xDF,
+    0xD2, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x02, 0xEF, 0xD2, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x03, 0xEF,
+    0xD1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB3, 0xEF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xEF,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD,
+    0xEF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB3, 0xEF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFB, 0x03, 0xEF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x04, 0xEF, 0xD1, 0x00, 0x00, 0x00,
+    0x0A, 0xFB, 0x00, 0x04, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x04, 0xFF, 0xC1, 0x00,
+    0x00, 0x0A, 0xFB, 0x00, 0x00, 0x05, 0xFF, 0xC1, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x05, 0xFF,
+    0xB1, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF4, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0x50, 0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x00, 0xAF, 0xEF,
+    0xC0, 0x00, 0x00, 0x01, 0xFE, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0xDF, 0x20, 0x00, 0x00, 0x6F, 0x9E,
+    0xF5, 0x00, 0x00, 0xAF, 0xA8, 0xF7, 0x00, 0x00, 0x0B, 0xF4, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0x3F,
+    0xC0, 0x00, 0x02, 0xFE, 0x0E, 0xF5, 0x00, 0x00, 0xAF, 0xA0, 0xDF, 0x30, 0x00, 0x7F, 0x80, 0xEF,
+    0x50, 0x00, 0x0A, 0xFA, 0x07, 0xF8, 0x00, 0x0C, 0xF3, 0x0E, 0xF5, 0x00, 0x00, 0xAF, 0xA0, 0x2F,
+    0xD0, 0x03, 0xFD, 0x00, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0x00, 0xCF, 0x40, 0x8F, 0x70, 0x0E, 0xF5,
+    0x00, 0x00, 0xAF, 0xA0, 0x06, 0xF9, 0x0D, 0xF2, 0x00, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0x00, 0x1F,
+    0xE4, 0xFC, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0xBF, 0xDF, 0x60, 0x00, 0xEF, 0x50,
+    0x00, 0x0A, 0xFA, 0x00, 0x05, 0xFF, 0xF1, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x1E,
+    0xFB, 0x00, 0x00, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00,
+    0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF,
+    0xFF, 0x50, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF9, 0x00,
+    0x00, 0xAF, 0xBE, 0xF5, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA8, 0xFD, 0x00, 0x00, 0x0B,
+    0xF9, 0x00, 0x00, 0xAF, 0xA1, 0xEF, 0x60, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x8F, 0xD0,
+    0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x1E, 0xF6, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA0,
+    0x07, 0xFD, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x01, 0xEF, 0x70, 0x0B, 0xF9, 0x00, 0x00,
+    0xAF, 0xA0, 0x00, 0x7F, 0xE1, 0x0B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x1E, 0xF7, 0x0B, 0xF9,
+    0x00, 0x00, 0xAF, 0xA0, 0x00, 0x06, 0xFE, 0x1B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0xDF,
+    0x7B, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x6F, 0xEC, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x00,
+    0x00, 0x0D, 0xFF, 0xF9, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0xAF,
+    0xA0, 0x00, 0x00, 0x00, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD5, 0x10, 0x26,
+    0xDF, 0xF5, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xCF, 0xE2, 0x00, 0x00, 0xBF, 0xE1,
+    0x00, 0x00, 0x00, 0x02, 0xEF, 0x90, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x10,
+    0x06, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x70, 0x09, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x9F, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x08, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00,
+    0x6F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xF1, 0x00, 0x0B, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x2E, 0xF9, 0x00, 0x00, 0x3F, 0xFB, 0x00,
+    0x00, 0x00, 0x1C, 0xFE, 0x20, 0x00, 0x00, 0x7F, 0xFD, 0x51, 0x02, 0x6D, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0xB7, 0x10,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xED, 0x92, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0xAF, 0xB0, 0x00, 0x26, 0xEF, 0xF2, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x4F, 0xF7, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x0E, 0xF9, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0E, 0xF9, 0x00, 0xAF, 0xB0, 0x00,
+    0x00, 0x4F, 0xF7, 0x00, 0xAF, 0xB0, 0x00, 0x26, 0xEF, 0xF2, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0xAF, 0xFF, 0xFF, 0xED, 0x92, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x7C, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xE5, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD5, 0x10, 0x26, 0xDF, 0xF5, 0x00, 0x00, 0x03, 0xFF, 0xB0,
+    0x00, 0x00, 0x01, 0xCF, 0xE2, 0x00, 0x00, 0xBF, 0xE1, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xA0, 0x00,
+    0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x10, 0x06, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF4, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x70, 0x09, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x08,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x40, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF1, 0x00, 0x0B, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x2E, 0xF9, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00, 0x1C, 0xFE, 0x20, 0x00, 0x00,
+    0x7F, 0xFD, 0x51, 0x02, 0x6D, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFD, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xED, 0x93, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x25, 0xDF, 0xF2,
+    0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x0E,
+    0xF9, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0xEF, 0x90, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x3F, 0xF6, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x01, 0x5D, 0xFE, 0x10, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x20, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xB0,
+    0x00, 0x3A, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xAF,
+    0xB0, 0x00, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xB0, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0xA6, 0x10, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0xBF, 0xF8, 0x31, 0x12, 0x59, 0xB0, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xEA, 0x63, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+    0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x00, 0x04, 0xAD, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x5A, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xFA, 0x00, 0x5C, 0x84, 0x21, 0x02, 0x6D, 0xFF, 0x40, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x03, 0x7B, 0xDE, 0xFE, 0xC8, 0x20, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7,
+    0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00,
+    0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00,
+    0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF,
+    0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00,
+    0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D,
+    0xF7, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xDF, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0xF7, 0x00, 0x00, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0x00, 0x00, 0x9F, 0xD0,
+    0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
+    0x0B, 0xFF, 0x72, 0x01, 0x4B, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBE, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0x14, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x0D, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xF4, 0x00, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xFE, 0x00, 0x02, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0xDF, 0x80, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x00, 0x6F, 0xF1,
+    0x00, 0x00, 0x09, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x01, 0xEF, 0x70, 0x00, 0x00, 0x0A,
+    0xFC, 0x00, 0x00, 0x5F, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xF2, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x70, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF3, 0x0C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x93, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFE, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x9F, 0xC0, 0x0D,
+    0xF8, 0x00, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0xCF, 0x90, 0x09, 0xFC, 0x00, 0x00, 0x01,
+    0xFE, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x05, 0xFF, 0x10, 0x00, 0x05, 0xF9, 0xDF, 0x10, 0x00,
+    0x05, 0xFF, 0x10, 0x02, 0xFF, 0x40, 0x00, 0x08, 0xF6, 0x9F, 0x40, 0x00, 0x08, 0xFD, 0x00, 0x00,
+    0xDF, 0x80, 0x00, 0x0C, 0xF2, 0x6F, 0x80, 0x00, 0x0C, 0xF9, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x1F,
+    0xE0, 0x2F, 0xC0, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x4F, 0xA0, 0x0E, 0xF1, 0x00,
+    0x4F, 0xF2, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x8F, 0x60, 0x0A, 0xF4, 0x00, 0x8F, 0xD0, 0x00, 0x00,
+    0x0D, 0xF7, 0x00, 0xBF, 0x30, 0x06, 0xF7, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0xFE,
+    0x00, 0x03, 0xFB, 0x00, 0xEF, 0x60, 0x00, 0x00, 0x06, 0xFE, 0x04, 0xFB, 0x00, 0x00, 0xEE, 0x03,
+    0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x37, 0xF7, 0x00, 0x00, 0xBF, 0x37, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x7B, 0xF3, 0x00, 0x00, 0x7F, 0x7B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xBE, 0xF0,
+    0x00, 0x00, 0x4F, 0xBE, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xB0, 0x00, 0x00, 0x1F, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x9F, 0xE1, 0x00, 0x8F, 0xE1, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x0D, 0xFA, 0x00, 0x00,
+    0x1D, 0xFA, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x00, 0x9F, 0xE1, 0x04,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x1D, 0xF9, 0x1D, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xBF,
+    0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xCF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF9, 0x2E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xD1, 0x06,
+    0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1D, 0xF9, 0x00, 0x00,
+    0x2F, 0xF6, 0x00, 0x00, 0x9F, 0xD1, 0x00, 0x00, 0x07, 0xFE, 0x20, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0xCF, 0xB0, 0x1D, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x0B, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xF6, 0x02, 0xEF, 0x70, 0x00, 0x00, 0x00, 0xCF, 0xB0, 0x00, 0x6F, 0xF2, 0x00, 0x00,
+    0x07, 0xFE, 0x20, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x02, 0xEF, 0x70, 0x00,
+    0xBF, 0xB0, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x06, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x2E,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF1, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0xEF, 0xFF, 0xF0, 0x00,
+    0x0E, 0xFF, 0xFF, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30,
+    0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00,
+    0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00,
+    0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E,
+    0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00,
+    0x00, 0x0E, 0xFF, 0xFF, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x08, 0xF7,
+    0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00,
+    0x00, 0x5F, 0xA0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x6F,
+    0x90, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x04,
+    0xFB, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x00, 0x00, 0x06, 0xFA, 0x00,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0D,
+    0xF4, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+    0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0xDF,
+    0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0xAF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x7F, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00,
+    0x00, 0x6F, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x70, 0x00, 0x00, 0x05, 0xFE, 0x40, 0x00, 0x00,
+    0x2D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF4, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xAD, 0xEE, 0xC8, 0x10, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x30, 0x00, 0x00, 0x89, 0x42, 0x02, 0x5C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x4A, 0xDE, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF9, 0x31, 0x00, 0x0A, 0xF8, 0x00, 0x07,
+    0xFB, 0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x05, 0xFF,
+    0x72, 0x02, 0x8F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xDB, 0xF8, 0x00, 0x00, 0x08, 0xDF,
+    0xEC, 0x71, 0x9F, 0x80, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x2A, 0xDF, 0xD9,
+    0x20, 0x00, 0x00, 0xCF, 0x9F, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x0C, 0xFF, 0xD5, 0x11, 0x5D, 0xFD,
+    0x00, 0x00, 0xCF, 0xF3, 0x00, 0x00, 0x2F, 0xF6, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xA0,
+    0x00, 0xCF, 0x70, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00,
+    0xCF, 0x70, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0xCF,
+    0xF3, 0x00, 0x00, 0x2F, 0xF6, 0x00, 0x0C, 0xFF, 0xD5, 0x11, 0x5D, 0xFD, 0x10, 0x00, 0xCF, 0x9F,
+    0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x0C, 0xF5, 0x3A, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x4A, 0xDF,
+    0xEC, 0x71, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x8F, 0xFA, 0x31, 0x13, 0x89, 0x00,
+    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9,
+    0x31, 0x13, 0x89, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4A, 0xDF, 0xEC, 0x71,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x17, 0xDF, 0xEB, 0x41, 0xFF, 0x10, 0x00, 0x1C,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xF1, 0x00, 0x0A, 0xFE, 0x61, 0x03, 0xCF, 0xFF, 0x10, 0x02, 0xFF, 0x60,
+    0x00, 0x01, 0xDF, 0xF1, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x10, 0x09, 0xFA, 0x00, 0x00,
+    0x00, 0x3F, 0xF1, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0x10, 0x09, 0xFA, 0x00, 0x00, 0x00,
+    0x3F, 0xF1, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x10, 0x02, 0xFF, 0x50, 0x00, 0x01, 0xDF,
+    0xF1, 0x00, 0x0A, 0xFE, 0x61, 0x03, 0xCF, 0xFF, 0x10, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x8F, 0xF1,
+    0x00, 0x00, 0x18, 0xDF, 0xEB, 0x51, 0xFF, 0x10, 0x00, 0x00, 0x4A, 0xDF, 0xEC, 0x60, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x7F, 0xE8, 0x21, 0x25, 0xDF, 0xA0, 0x00, 0x1E,
+    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x9F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x9F, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x41, 0x02, 0x48, 0xC0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x39, 0xDE, 0xED, 0xB7, 0x20, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xE0, 0x00,
+    0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0xF5, 0x10, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xF5, 0x7F, 0xFF, 0xFF, 0xFF, 0x50, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x6F,
+    0xC0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00,
+    0x00, 0x6F, 0xC0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x06, 0xFC,
+    0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xB4,
+    0x1F, 0xF1, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0x10, 0x00, 0xAF, 0xE6, 0x10, 0x3B, 0xFF,
+    0xF1, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x0D, 0xFF, 0x10, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xF1,
+    0x00, 0x9F, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00,
+    0x9F, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x2F,
+    0xF5, 0x00, 0x00, 0x0D, 0xFF, 0x10, 0x00, 0xAF, 0xE6, 0x10, 0x3B, 0xFF, 0xF1, 0x00, 0x01, 0xCF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0x10, 0x00, 0x01, 0x8D, 0xFE, 0xB4, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x01, 0xB5, 0x20, 0x14,
+    0xCF, 0xF2, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0x93,
+    0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x29, 0xDF, 0xEA, 0x20, 0x00, 0x00,
+    0xCF, 0x8E, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x0C, 0xFF, 0xD5, 0x11, 0x5E, 0xFB, 0x00, 0x00, 0xCF,
+    0xE1, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x20, 0x00, 0xCF, 0x60,
+    0x00, 0x00, 0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00,
+    0x00, 0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x0F,
+    0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00,
+    0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6,
+    0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x01, 0x6F, 0xF2, 0x00, 0x7F, 0xFF, 0xA0, 0x00,
+    0x7F, 0xD8, 0x10, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x01, 0xBF, 0xD2, 0x00, 0xCF,
+    0x50, 0x00, 0x2C, 0xFB, 0x10, 0x00, 0xCF, 0x50, 0x03, 0xDF, 0xA0, 0x00, 0x00, 0xCF, 0x50, 0x4E,
+    0xF8, 0x00, 0x00, 0x00, 0xCF, 0x56, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xCF, 0xCF, 0xE4, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xEF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x6B, 0xFE, 0x20, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0xAF, 0xE3, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x0A, 0xFE, 0x30, 0x00, 0x00, 0xCF, 0x50,
+    0x00, 0x9F, 0xE4, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x08, 0xFF, 0x40, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0x8F, 0xF5, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00,
+    0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00,
+    0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x0B, 0xF6,
+    0x00, 0x00, 0xCF, 0x52, 0xAD, 0xFD, 0x91, 0x00, 0x6C, 0xEE, 0xC4, 0x00, 0x00, 0x0C, 0xF9, 0xEF,
+    0xFF, 0xFF, 0xD1, 0xAF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0xCF, 0xFD, 0x41, 0x17, 0xFF, 0xDF, 0x82,
+    0x13, 0xCF, 0xD0, 0x00, 0x0C, 0xFE, 0x10, 0x00, 0x0A, 0xFF, 0x70, 0x00, 0x02, 0xFF, 0x30, 0x00,
+    0xCF, 0x80, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x05,
+    0xFD, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x0C,
+    0xF5, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0xCF, 0x50,
+    0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x05, 0xFD, 0x00,
+    0x00, 0x00, 0xCF, 0x50, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x0C, 0xF5, 0x00,
+    0x0C, 0xF5, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0x5F, 0xD0, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0xCF, 0x52, 0x9D, 0xFE, 0xA2, 0x00, 0x00, 0x0C,
+    0xF8, 0xEF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0xCF, 0xFD, 0x51, 0x15, 0xEF, 0xB0, 0x00, 0x0C, 0xFE,
+    0x10, 0x00, 0x05, 0xFF, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x0C, 0xF6, 0x00,
+    0x00, 0x00, 0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00,
+    0x00, 0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00,
+    0xFF, 0x30, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0xFF,
+    0x30, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xDA, 0x30, 0x00,
+    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x9F, 0xF7, 0x20, 0x3B, 0xFF, 0x50, 0x00,
+    0x2F, 0xF7, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x9F,
+    0xB0, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x9F, 0xB0,
+    0x00, 0x00, 0x00, 0xFF, 0x50, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x2F, 0xF7, 0x00,
+    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xAF, 0xF7, 0x20, 0x3A, 0xFF, 0x50, 0x00, 0x01, 0xBF, 0xFF, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0xCF, 0x52, 0xAD, 0xFD,
+    0x92, 0x00, 0x00, 0x0C, 0xF9, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0xCF, 0xFD, 0x51, 0x15, 0xDF,
+    0xD0, 0x00, 0x0C, 0xFF, 0x30, 0x00, 0x02, 0xFF, 0x60, 0x00, 0xCF, 0xA0, 0x00, 0x00, 0x0A, 0xFA,
+    0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x05, 0xFE, 0x00,
+    0x0C, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xCF, 0xA0, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x0C,
+    0xFF, 0x30, 0x00, 0x02, 0xFF, 0x60, 0x00, 0xCF, 0xFD, 0x51, 0x15, 0xDF, 0xD1, 0x00, 0x0C, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0xCF, 0x53, 0xAE, 0xFD, 0x92, 0x00, 0x00, 0x0C, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x7D, 0xFE, 0xB4, 0x1F, 0xF1, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF,
+    0x10, 0x00, 0xAF, 0xE6, 0x10, 0x3C, 0xFF, 0xF1, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0x10,
+    0x07, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x0A,
+    0xF9, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x07, 0xFD,
+    0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x1D, 0xFF, 0x10, 0x00, 0xAF, 0xE6,
+    0x10, 0x3C, 0xFF, 0xF1, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0x10, 0x00, 0x01, 0x8D, 0xFE,
+    0xB5, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0xCF, 0x52, 0x9D, 0xFD, 0x00, 0xCF,
+    0x9E, 0xFF, 0xFD, 0x00, 0xCF, 0xFD, 0x51, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0xCF, 0x90,
+    0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00,
+    0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0xB6, 0x10,
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0xFE, 0x62, 0x02, 0x38, 0x80, 0x00, 0x9F, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFD, 0x85, 0x20, 0x00,
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x01, 0x47, 0xBF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x09, 0x95, 0x21, 0x13, 0xAF,
+    0xF2, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x01, 0x6A, 0xDE, 0xFD, 0xA3, 0x00, 0x00, 0x00,
+    0xCF, 0x60, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x0C, 0xF6, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x0C,
+    0xF6, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00,
+    0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x9F,
+    0xC2, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x04, 0xBE, 0xFF, 0xD0, 0x00, 0xEF, 0x30, 0x00,
+    0x00, 0x2F, 0xF0, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x2F,
+    0xF0, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x2F, 0xF0,
+    0x00, 0x0E, 0xF3, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xEF, 0x40, 0x00, 0x00, 0x4F, 0xF0, 0x00,
+    0x0C, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xF6, 0x11, 0x4B, 0xFF, 0xF0, 0x00, 0x01,
+    0xDF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x01, 0x9D, 0xFE, 0xA3, 0x2F, 0xF0, 0x00, 0x2F, 0xF3,
+    0x00, 0x00, 0x00, 0x1E, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x05, 0xFE, 0x00, 0x00,
+    0x00, 0xBF, 0x80, 0x00, 0xEF, 0x50, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x9F, 0xA0, 0x00, 0x07, 0xFC,
+    0x00, 0x00, 0x3F, 0xF1, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x4F, 0xE1, 0x00, 0x00,
+    0x07, 0xFC, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x01, 0xFF, 0x31, 0xEF, 0x40, 0x00, 0x00, 0x00, 0xAF,
+    0x95, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xEB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x9F, 0xF3, 0x00,
+    0x00, 0xAF, 0x70, 0x09, 0xF9, 0x00, 0x00, 0xDF, 0xF7, 0x00, 0x00, 0xEF, 0x30, 0x05, 0xFD, 0x00,
+    0x02, 0xFD, 0xFB, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x10, 0x06, 0xF8, 0xDF, 0x10, 0x07, 0xFA,
+    0x00, 0x00, 0xCF, 0x50, 0x0A, 0xF4, 0x9F, 0x40, 0x0B, 0xF7, 0x00, 0x00, 0x8F, 0x90, 0x0E, 0xE0,
+    0x5F, 0x80, 0x0E, 0xF3, 0x00, 0x00, 0x4F, 0xD0, 0x3F, 0xB0, 0x1F, 0xC0, 0x4F, 0xE0, 0x00, 0x00,
+    0x1F, 0xF2, 0x7F, 0x70, 0x0C, 0xF1, 0x8F, 0xA0, 0x00, 0x00, 0x0B, 0xF6, 0xBF, 0x30, 0x08, 0xF5,
+    0xCF, 0x60, 0x00, 0x00, 0x07, 0xFB, 0xEE, 0x00, 0x04, 0xFA, 0xFF, 0x20, 0x00, 0x00, 0x03, 0xFF,
+    0xFA, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF6, 0x00, 0x00, 0xBF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xF2, 0x00, 0x00, 0x7F, 0xF5, 0x00, 0x00, 0x08, 0xFE, 0x20, 0x00, 0x00,
+    0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x08, 0xFE, 0x20, 0x00, 0x1E, 0xF8, 0x00, 0x4F, 0xF4, 0x00,
+    0x00, 0x04, 0xFF, 0x51, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xEC, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x97, 0xFE, 0x20, 0x00, 0x00, 0x0A, 0xFC, 0x10, 0xBF, 0xC0,
+    0x00, 0x00, 0x7F, 0xE2, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x04, 0xFF, 0x40, 0x1D,
+    0xF9, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x1E, 0xF4, 0x0A, 0xF9, 0x00,
+    0x00, 0x00, 0x6F, 0xD0, 0x04, 0xFE, 0x10, 0x00, 0x00, 0xCF, 0x70, 0x00, 0xCF, 0x60, 0x00, 0x03,
+    0xFF, 0x10, 0x00, 0x6F, 0xC0, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x1E, 0xF3, 0x00, 0x1E, 0xF3, 0x00,
+    0x00, 0x09, 0xF9, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x10, 0xCF, 0x60, 0x00, 0x00, 0x00,
+    0xBF, 0x63, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xD9, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x6F, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDE, 0xF4, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+    0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0F,
+    0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0xEF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDA, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5B,
+    0xEE, 0xB5, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xD7, 0x21, 0x3A, 0xF8,
+    0x00, 0x00, 0x7F, 0x93, 0x12, 0x7D, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x4A, 0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const FontGlyph FONT_24_GLYPHS[95] = {
+    { 0, 0, 0, 0, 0, 8 },  // space
+    { 0, 10, 18, 0, 5, 10 },  // !
+    { 90, 11, 18, 0, 5, 11 },  // "
+    { 189, 20, 18, 0, 5, 20 },  // #
+    { 369, 15, 22, 0, 5, 15 },  // $
+    { 534, 23, 18, 0, 5, 23 },  // %
+    { 741, 19, 18, 0, 5, 19 },  // &
+    { 912, 7, 18, 0, 5, 7 },  // '
+    { 975, 9, 21, 0, 5, 9 },  // (
+    { 1070, 9, 21, 0, 5, 9 },  // )
+    { 1165, 12, 18, 0, 5, 12 },  // *
+    { 1273, 20, 16, 0, 7, 20 },  // +
+    { 1433, 8, 6, 0, 20, 8 },  // ,
+    { 1457, 9, 8, 0, 15, 9 },  // -
+    { 1493, 8, 3, 0, 20, 8 },  // .
+    { 1505, 9, 20, 0, 5, 8 },  // /
+    { 1595, 15, 18, 0, 5, 15 },  // 0
+    { 1730, 15, 18, 0, 5, 15 },  // 1
+    { 1865, 15, 18, 0, 5, 15 },  // 2
+    { 2000, 15, 18, 0, 5, 15 },  // 3
+    { 2135, 15, 18, 0, 5, 15 },  // 4
+    { 2270, 15, 18, 0, 5, 15 },  // 5
+    { 2405, 15, 18, 0, 5, 15 },  // 6
+    { 2540, 15, 18, 0, 5, 15 },  // 7
+    { 2675, 15, 18, 0, 5, 15 },  // 8
+    { 2810, 15, 18, 0, 5, 15 },  // 9
+    { 2945, 8, 12, 0, 11, 8 },  // :
+    { 2993, 8, 15, 0, 11, 8 },  // ;
+    { 3053, 20, 14, 0, 9, 20 },  // <
+    { 3193, 20, 11, 0, 12, 20 },  // =
+    { 3303, 20, 14, 0, 9, 20 },  // >
+    { 3443, 13, 18, 0, 5, 13 },  // ?
+    { 3560, 24, 21, 0, 6, 24 },  // @
+    { 3812, 17, 18, 0, 5, 16 },  // A
+    { 3965, 16, 18, 0, 5, 16 },  // B
+    { 4109, 17, 18, 0, 5, 17 },  // C
+    { 4262, 18, 18, 0, 5, 18 },  // D
+    { 4424, 15, 18, 0, 5, 15 },  // E
+    { 4559, 14, 18, 0, 5, 14 },  // F
+    { 4685, 19, 18, 0, 5, 19 },  // G
+    { 4856, 18, 18, 0, 5, 18 },  // H
+    { 5018, 7, 18, 0, 5, 7 },  // I
+    { 5081, 9, 23, -2, 5, 7 },  // J
+    { 5185, 17, 18, 0, 5, 16 },  // K
+    { 5338, 14, 18, 0, 5, 13 },  // L
+    { 5464, 21, 18, 0, 5, 21 },  // M
+    { 5653, 18, 18, 0, 5, 18 },  // N
+    { 5815, 19, 18, 0, 5, 19 },  // O
+    { 5986, 14, 18, 0, 5, 14 },  // P
+    { 6112, 19, 21, 0, 5, 19 },  // Q
+    { 6312, 17, 18, 0, 5, 17 },  // R
+    { 6465, 15, 18, 0, 5, 15 },  // S
+    { 6600, 16, 18, -1, 5, 15 },  // T
+    { 6744, 18, 18, 0, 5, 18 },  // U
+    { 6906, 17, 18, 0, 5, 16 },  // V
+    { 7059, 24, 18, 0, 5, 24 },  // W
+    { 7275, 16, 18, 0, 5, 16 },  // X
+    { 7419, 16, 18, -1, 5, 15 },  // Y
+    { 7563, 16, 18, 0, 5, 16 },  // Z
+    { 7707, 9, 21, 0, 5, 9 },  // [
+    { 7802, 9, 20, 0, 5, 8 },  // backslash
+    { 7892, 9, 21, 0, 5, 9 },  // ]
+    { 7987, 20, 18, 0, 5, 20 },  // ^
+    { 8167, 14, 6, -1, 23, 12 },  // _
+    { 8209, 12, 19, 0, 4, 12 },  // `
+    { 8323, 15, 13, 0, 10, 15 },  // a
+    { 8421, 15, 18, 0, 5, 15 },  // b
+    { 8556, 13, 13, 0, 10, 13 },  // c
+    { 8641, 15, 18, 0, 5, 15 },  // d
+    { 8776, 15, 13, 0, 10, 15 },  // e
+    { 8874, 9, 18, 0, 5, 8 },  // f
+    { 8955, 15, 18, 0, 10, 15 },  // g
+    { 9090, 15, 18, 0, 5, 15 },  // h
+    { 9225, 7, 18, 0, 5, 7 },  // i
+    { 9288, 8, 23, -1, 5, 7 },  // j
+    { 9380, 14, 18, 0, 5, 14 },  // k
+    { 9506, 7, 18, 0, 5, 7 },  // l
+    { 9569, 23, 13, 0, 10, 23 },  // m
+    { 9719, 15, 13, 0, 10, 15 },  // n
+    { 9817, 15, 13, 0, 10, 15 },  // o
+    { 9915, 15, 18, 0, 10, 15 },  // p
+    { 10050, 15, 18, 0, 10, 15 },  // q
+    { 10185, 10, 13, 0, 10, 10 },  // r
+    { 10250, 13, 13, 0, 10, 13 },  // s
+    { 10335, 9, 17, 0, 6, 9 },  // t
+    { 10412, 15, 13, 0, 10, 15 },  // u
+    { 10510, 14, 13, 0, 10, 14 },  // v
+    { 10601, 20, 13, 0, 10, 20 },  // w
+    { 10731, 14, 13, 0, 10, 14 },  // x
+    { 10822, 14, 18, 0, 10, 14 },  // y
+    { 10948, 13, 13, 0, 10, 13 },  // z
+    { 11033, 15, 22, 0, 5, 15 },  // {
+    { 11198, 8, 24, 0, 5, 8 },  // |
+    { 11294, 15, 22, 0, 5, 15 },  // }
+    { 11459, 20, 10, 0, 13, 20 },  // ~
+};
+
+static const Font FONT_24 = { 24, 29, 32, 95, FONT_24_GLYPHS, FONT_24_BITMAP };
+
+static const uint8_t FONT_32_BITMAP[20192] = {
+    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0xEF,
+    0xB0, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0xEF, 0xB0,
+    0x00, 0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00,
+    0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0xFF,
+    0xA0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x90, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x10, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
+    0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF8, 0x00, 0x00, 0xEF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xA0, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6,
+    0x00, 0x01, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x20, 0x00, 0x4F,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x08, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF9, 0x00, 0x00, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0A,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0xEF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x30, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFA, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x60, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xFE, 0xDB, 0x73, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x0D, 0xFF, 0xE6, 0x2B, 0xC1, 0x34, 0x8C, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x20, 0x0B, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF9, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x10, 0x0B, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD6, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF,
+    0xFF, 0xE8, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0xAE, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD4,
+    0x8E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xCF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x4F,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xAF, 0xF8, 0x00, 0x00, 0x5B, 0x74, 0x20,
+    0x0B, 0xC2, 0x6C, 0xFF, 0xF3, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x6A, 0xCD, 0xEF, 0xFE,
+    0xB7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFA, 0x21, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x09, 0xFF, 0x10, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x9F, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x50, 0x00, 0x01, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0D, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0x50, 0x00, 0x01, 0xFF, 0x70, 0x00, 0x8F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x03, 0xFF, 0x50, 0x02, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
+    0x00, 0x09, 0xFF, 0x10, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFA, 0x21,
+    0x7F, 0xF9, 0x00, 0x6F, 0xE2, 0x00, 0x4B, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+    0xC1, 0x02, 0xEF, 0x70, 0x06, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC7, 0x00,
+    0x0A, 0xFC, 0x00, 0x3F, 0xFB, 0x21, 0x6F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF3, 0x00, 0xAF, 0xE1, 0x00, 0x08, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x80,
+    0x00, 0xEF, 0x90, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x10, 0x01,
+    0xFF, 0x70, 0x00, 0x00, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF,
+    0x60, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x00, 0x01, 0xFF, 0x70,
+    0x00, 0x00, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x10, 0x00, 0x00, 0xEF, 0x90, 0x00,
+    0x02, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00, 0x08,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x21, 0x6F, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xC1, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xEF, 0xD8, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xAD, 0xEE, 0xDB, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x51, 0x01, 0x48, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xE4,
+    0xAF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF5, 0x00, 0xAF, 0xFE, 0x30,
+    0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x9F, 0xFE, 0x30, 0x00, 0x07, 0xFF,
+    0x50, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x9F, 0xFE, 0x40, 0x00, 0xBF, 0xE1, 0x00, 0x00, 0xEF,
+    0xF1, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x40, 0x3F, 0xF9, 0x00, 0x00, 0x0E, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0x5B, 0xFE, 0x10, 0x00, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x0A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xD6, 0x20, 0x13, 0x7D, 0xFF, 0xEF, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD2, 0xBF, 0xFD, 0x10, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x01, 0xEF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x38, 0xCE, 0xFE, 0xC8, 0x20, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00,
+    0x0E, 0xFB, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0xEF, 0xB0,
+    0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00,
+    0xEF, 0xB0, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x1E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF1, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x0D, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0,
+    0x00, 0x00, 0x00, 0x06, 0x91, 0x00, 0x0D, 0xD0, 0x00, 0x19, 0x60, 0x0D, 0xFD, 0x40, 0x0D, 0xD0,
+    0x04, 0xDF, 0xD0, 0x01, 0x9F, 0xF9, 0x1D, 0xD1, 0x9F, 0xF9, 0x10, 0x00, 0x03, 0xCF, 0xDE, 0xED,
+    0xFC, 0x30, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFE,
+    0x60, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xDE, 0xED, 0xFC, 0x30, 0x00, 0x01, 0x9F, 0xF9, 0x1D, 0xD1,
+    0x9F, 0xF9, 0x10, 0x0D, 0xFD, 0x40, 0x0D, 0xD0, 0x04, 0xDF, 0xC0, 0x06, 0x91, 0x00, 0x0D, 0xD0,
+    0x00, 0x19, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x04, 0xFF, 0xF1,
+    0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00,
+    0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00,
+    0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x10,
+    0x00, 0x00, 0x00, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0xCF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00, 0x00, 0x00, 0x0E, 0xFA, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x9F, 0xF1, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0xCE, 0xED, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD,
+    0x51, 0x13, 0xAF, 0xFF, 0x70, 0x00, 0x00, 0x0A, 0xFF, 0xD1, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00,
+    0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0xF5, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFA, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0x00, 0x00, 0xBF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x10, 0x00, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x20, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x30, 0x00, 0xDF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x30,
+    0x00, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0x10, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0x00, 0x00, 0x5F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xEF,
+    0xF5, 0x00, 0x00, 0x0A, 0xFF, 0xD1, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00, 0x00, 0x02, 0xFF, 0xFD,
+    0x51, 0x13, 0xAF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xCE, 0xED,
+    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x8B, 0xDF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCA, 0x74, 0x2D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x03, 0x69, 0xCE, 0xFF, 0xEB,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x7C, 0x95, 0x32, 0x10, 0x27, 0xEF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFB, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0x01, 0x58, 0xBD, 0xEF, 0xED, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD3, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x0B,
+    0xA6, 0x42, 0x10, 0x14, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x9F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xAF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x8B,
+    0x74, 0x21, 0x01, 0x25, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x30, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x14, 0x7B, 0xCE,
+    0xFE, 0xDB, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xD1, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x40, 0xEF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xE1, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0xEF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00,
+    0xEF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x0D,
+    0xFB, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00, 0x00, 0xEF, 0xF4,
+    0x00, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xBC,
+    0xEF, 0xEB, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x07, 0xA6, 0x32, 0x01, 0x38,
+    0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE1, 0x00, 0x00, 0x7B, 0x74, 0x21, 0x01, 0x37,
+    0xEF, 0xFF, 0x70, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0x7B, 0xCE, 0xFE, 0xDA, 0x71, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xDE, 0xEC, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x31, 0x02, 0x59, 0xB0, 0x00, 0x00, 0x02, 0xEF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x01,
+    0x8C, 0xEE, 0xD9, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x3E, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00,
+    0x00, 0xBF, 0xF9, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x51, 0x01,
+    0x5C, 0xFF, 0xF8, 0x00, 0x00, 0xAF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0x9F,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x50, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x0D, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x07, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x00,
+    0x00, 0x01, 0xEF, 0xFC, 0x51, 0x01, 0x5C, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0xBE, 0xFE, 0xC9, 0x30, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x6B, 0xDE, 0xFE, 0xC8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0D, 0xFF, 0xF9,
+    0x31, 0x12, 0x6D, 0xFF, 0xF3, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0xF8, 0x00,
+    0x00, 0x4F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0xF3, 0x00, 0x00, 0x04,
+    0xFF, 0xF8, 0x31, 0x12, 0x6D, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xF8, 0x31, 0x02, 0x6D, 0xFF, 0xD1, 0x00,
+    0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xCF, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFE, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0xCF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x10, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
+    0x31, 0x02, 0x6D, 0xFF, 0xF6, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x01, 0x7B, 0xDE, 0xFE,
+    0xC8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xEC, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE7, 0x20, 0x14, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFE, 0x20,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF3, 0x00,
+    0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFB, 0x00, 0x00, 0xDF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0x9F,
+    0xFE, 0x20, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE6, 0x20, 0x13, 0xAF, 0xFF,
+    0xFF, 0x10, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x10, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0x10, 0x00, 0x00, 0x02, 0x8C, 0xEF, 0xDA, 0x30, 0x5F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0x60, 0x00, 0x00, 0x07, 0xA6, 0x31, 0x02, 0x6C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00,
+    0x00, 0x01, 0x49, 0xCE, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x10, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00,
+    0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x9E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFD, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0xDF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB6,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDF, 0xFF, 0xFE, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x5B, 0xFF, 0xFF, 0xFD, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x8D, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x9E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFB, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xAE, 0xFF, 0xFF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0xAF, 0xFF, 0xFF, 0xE8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0xBF, 0xFF, 0xFF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xCF,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xFF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xAF, 0xFF, 0xFF, 0xE8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF,
+    0xFF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFB, 0x51, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xCE, 0xFE, 0xB6, 0x00,
+    0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x72, 0x11, 0x4C, 0xFF, 0xF6, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xCF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xCF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x7B, 0xDE, 0xFE, 0xDA, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFE, 0x95, 0x21, 0x01, 0x35, 0xAE, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xEF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x1D,
+    0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x30, 0x00, 0x00, 0x04, 0xFF,
+    0x90, 0x00, 0x00, 0x3A, 0xEF, 0xD9, 0x20, 0x9F, 0xA0, 0x01, 0xDF, 0xB0, 0x00, 0x00, 0x0B, 0xFD,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE3, 0x9F, 0xA0, 0x00, 0x5F, 0xF2, 0x00, 0x00, 0x2F, 0xF5,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xA0, 0x00, 0x0E, 0xF6, 0x00, 0x00, 0x7F, 0xE0,
+    0x00, 0x00, 0xDF, 0xFB, 0x41, 0x13, 0xAF, 0xFF, 0xA0, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0xAF, 0x90,
+    0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x09, 0xFF, 0xA0, 0x00, 0x08, 0xFB, 0x00, 0x00, 0xCF, 0x60,
+    0x00, 0x07, 0xFF, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xA0, 0x00, 0x08, 0xFB, 0x00, 0x00, 0xDF, 0x50,
+    0x00, 0x08, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA0, 0x00, 0x09, 0xFA, 0x00, 0x00, 0xDF, 0x50,
+    0x00, 0x08, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA0, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0xCF, 0x70,
+    0x00, 0x07, 0xFF, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xA0, 0x00, 0x6F, 0xF3, 0x00, 0x00, 0xAF, 0x90,
+    0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x09, 0xFF, 0xA0, 0x03, 0xEF, 0xC0, 0x00, 0x00, 0x7F, 0xE0,
+    0x00, 0x00, 0xDF, 0xFB, 0x41, 0x03, 0xAF, 0xFF, 0xA3, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x3F, 0xF5,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0C, 0xFD,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0x80, 0x00, 0x00, 0x3A, 0xEF, 0xD9, 0x20, 0x8E, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0xFF, 0xFD, 0x84, 0x21, 0x02, 0x49, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x8B, 0xDF, 0xFE, 0xB7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xBD, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x57, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xF8, 0x00, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0x00,
+    0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0D, 0xFE, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0x10,
+    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xF7, 0x00, 0x01, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFD, 0x00, 0x06, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xA0, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF1, 0x8F,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEC, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x25, 0xCF, 0xFF, 0x50, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x90,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0x90, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1D, 0xFF,
+    0x60, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x25, 0xCF, 0xFD, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x10, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x14, 0x9F, 0xFF, 0x60, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xE1, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF9, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF6, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x14, 0x9F, 0xFF, 0xE1, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xED, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBD, 0xEF, 0xEC, 0x96,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x62, 0x10, 0x12,
+    0x59, 0xEF, 0x90, 0x00, 0x04, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x0D,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x62, 0x10, 0x12,
+    0x59, 0xEF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBD, 0xEF,
+    0xEC, 0x95, 0x10, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xED, 0xDA, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x12,
+    0x59, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF,
+    0xE1, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xDF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFB, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xF9, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x70, 0x00,
+    0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xE1,
+    0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x12, 0x59, 0xEF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xEE, 0xDA, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xBD, 0xEF,
+    0xED, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8,
+    0x10, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xB6, 0x31, 0x01, 0x24, 0x7B, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xFD, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x02,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x1F, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0x30, 0x00, 0x0A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3,
+    0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0xDF,
+    0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB6, 0x31, 0x00, 0x14, 0x7D,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x37, 0xBD, 0xEF, 0xED, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xF4, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF,
+    0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0x30, 0x00, 0x00, 0x02, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x00, 0x00, 0x02,
+    0x7F, 0xFF, 0x80, 0x00, 0xAF, 0xFF, 0xFF, 0xE1, 0x00, 0x0A, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0xAF,
+    0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x50,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE4, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x01, 0xCF, 0xFE, 0x30, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x03, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x3E, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x04, 0xEF, 0xFB, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x46, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x7E, 0xFF, 0xD2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x43, 0xEF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x3E, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x03, 0xEF,
+    0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x02, 0xEF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x2D, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x30,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xE3, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x30, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xFF, 0xE3, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0xCF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x6F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xC9, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x3C, 0xFD, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x69, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x37, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0x19,
+    0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x31, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFA, 0x09, 0xFF, 0x70,
+    0x00, 0x00, 0x0D, 0xFF, 0x30, 0xBF, 0xE1, 0x00, 0x00, 0x6F, 0xF5, 0x09, 0xFF, 0x70, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x5F, 0xF6, 0x00, 0x00, 0xCF, 0xE0, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF,
+    0x30, 0x0E, 0xFB, 0x00, 0x02, 0xFF, 0x80, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x09,
+    0xFF, 0x20, 0x08, 0xFF, 0x30, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x03, 0xFF, 0x70,
+    0x0D, 0xFC, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0xDF, 0xD0, 0x4F, 0xF7,
+    0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x7F, 0xF4, 0xAF, 0xF1, 0x00, 0x09,
+    0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x2F, 0xFA, 0xEF, 0xA0, 0x00, 0x09, 0xFF, 0x70,
+    0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x00, 0x05, 0xFF, 0xFE, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF,
+    0x30, 0x00, 0x00, 0xEF, 0xF9, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0x3D, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x35, 0xFF,
+    0xD0, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0xCF, 0xF6, 0x00, 0x00, 0x04,
+    0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x4F, 0xFE, 0x10, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x0B, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x03,
+    0xFF, 0xE1, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0xAF, 0xF9, 0x00, 0x04,
+    0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x2F, 0xFF, 0x20, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x00, 0x08, 0xFF, 0xA0, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00,
+    0x01, 0xEF, 0xF3, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xFB, 0x04,
+    0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x1E, 0xFF, 0x44, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x00, 0x00, 0x06, 0xFF, 0xC4, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0xDF, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xFE, 0xDA, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0x94, 0x10, 0x13, 0x8E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0x1B, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xF1, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0A,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0x40, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5,
+    0x00, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x60, 0x02, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xF1, 0x00, 0x0A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00,
+    0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xDF, 0xFE, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x1B, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x94, 0x10, 0x13, 0x8E, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE,
+    0xFE, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x30, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x26, 0xDF, 0xFF, 0x70, 0x00, 0x0D, 0xFF,
+    0x40, 0x00, 0x00, 0x01, 0xDF, 0xFD, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF1,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x20, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF2, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x10, 0x00, 0xDF, 0xF4,
+    0x00, 0x00, 0x00, 0x1D, 0xFF, 0xD0, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x02, 0x6D, 0xFF, 0xF7, 0x00,
+    0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x10, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xEC, 0x94, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xFE, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x94, 0x10, 0x13, 0x8E,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0xDF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF2, 0x00, 0x00, 0x5F, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x02,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x3F, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x60, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF5, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0x40, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF1, 0x00, 0x0A, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x70, 0x00, 0x00, 0xDF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xE1, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0x94, 0x10, 0x13, 0x8E, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1D, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFE, 0xCA, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x01, 0x5B, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0x20, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x30,
+    0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x01, 0x5C, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x14, 0xBF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0x40, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0xDF, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x20, 0x00, 0x00,
+    0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x90, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xF2, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF9, 0x00,
+    0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x00, 0x0D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0x90, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xF1, 0x00, 0x00, 0x01, 0x6A, 0xDE, 0xFE, 0xDB, 0x85, 0x20, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x3F, 0xFF, 0xE8, 0x31, 0x01, 0x24, 0x6A, 0xD2, 0x00, 0x00, 0x9F, 0xFE, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x96,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFE, 0xB7, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9C, 0xEF, 0xFF,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00,
+    0xBB, 0x85, 0x32, 0x10, 0x12, 0x6C, 0xFF, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE3, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x14, 0x7A,
+    0xCD, 0xEF, 0xEE, 0xB8, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00,
+    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x3F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0,
+    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFA, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x03,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
+    0x00, 0x00, 0x0E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x50, 0x00, 0x00, 0xBF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x02,
+    0xDF, 0xFB, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFA, 0x41, 0x01, 0x37, 0xEF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9C, 0xEF, 0xED, 0xA6, 0x10, 0x00,
+    0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x3F, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF1, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xA0, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x40, 0x01, 0xEF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xF7, 0x00, 0x00, 0x4F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF2, 0x00, 0x00,
+    0x0D, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x00,
+    0x00, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x50, 0x00, 0x07, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xF1, 0x00, 0x3F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0x00, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0x35, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x9B, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x08,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x05,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x00, 0x01,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0xFC, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x00,
+    0xCF, 0xF6, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00,
+    0x8F, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00,
+    0x4F, 0xFD, 0x00, 0x00, 0x00, 0x9F, 0xE0, 0x5F, 0xF3, 0x00, 0x00, 0x04, 0xFF, 0xE0, 0x00, 0x00,
+    0x1F, 0xFF, 0x20, 0x00, 0x00, 0xDF, 0xB0, 0x1F, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00,
+    0x0C, 0xFF, 0x60, 0x00, 0x01, 0xFF, 0x70, 0x0C, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00, 0x00,
+    0x08, 0xFF, 0xA0, 0x00, 0x05, 0xFF, 0x30, 0x08, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x30, 0x00, 0x00,
+    0x04, 0xFF, 0xD0, 0x00, 0x09, 0xFE, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x4F, 0xFE, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xF2, 0x00, 0x0D, 0xFB, 0x00, 0x01, 0xFF, 0x70, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xF6, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0xCF, 0xB0, 0x00, 0xBF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFA, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFE, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x5F, 0xF4, 0x04, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x20, 0xDF, 0xB0, 0x00, 0x00, 0x1F, 0xF8, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0x62, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFB, 0x0B, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xA5, 0xFF, 0x40, 0x00, 0x00, 0x09, 0xFF, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x8F, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFE, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x20, 0x00, 0x1E, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x05, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x9F, 0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x70,
+    0x00, 0x02, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE2, 0x00, 0x0C, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFC, 0x00, 0x8F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+    0xFF, 0x73, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFD, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1D, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xED, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x43, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF9, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xD1, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x30, 0x00,
+    0x03, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x10, 0x00,
+    0x00, 0x09, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
+    0x10, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x90, 0x0B, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x2E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x90, 0x00, 0x5F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD1, 0x00, 0x00, 0xAF, 0xFB, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF3, 0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xE2, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xB0,
+    0x00, 0x3F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x70, 0x0D, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x38, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFD,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x20, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+    0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x4F, 0xFF, 0xFF, 0xF6,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF6, 0x00, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xA0, 0x00, 0x00, 0x00,
+    0x0A, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x0C, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x0D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF1, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x0E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x0D, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFB, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x0D, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xF7, 0x0A, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xF6, 0x00, 0x09, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF5, 0x00,
+    0x00, 0x07, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x03, 0xEF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xD1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x1D, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0xBD, 0xEF, 0xDB, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE2, 0x00, 0x00, 0x00, 0x0B, 0xA6, 0x32, 0x01, 0x27, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xAC, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xAF, 0xFE, 0x74, 0x21, 0x00, 0x03,
+    0xFF, 0xB0, 0x00, 0x00, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x01, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xB0,
+    0x00, 0x00, 0xCF, 0xFD, 0x52, 0x01, 0x4A, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x4A, 0xDF, 0xEC, 0x83, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x6B, 0xEF, 0xDA, 0x30, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x2C, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x82, 0x01, 0x5D, 0xFF, 0xF3, 0x00, 0x00, 0x1F, 0xFF,
+    0xF4, 0x00, 0x00, 0x01, 0xCF, 0xFB, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0x10, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x70, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xCF, 0xFB,
+    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x82, 0x01, 0x5D, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x2C, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x6B, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xCE, 0xFE, 0xCA,
+    0x51, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x52, 0x01, 0x35, 0xA8, 0x00, 0x00, 0x4F, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x51, 0x01, 0x35, 0xA8, 0x00,
+    0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x39, 0xCE, 0xFE, 0xC9, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xEE, 0xC8, 0x20, 0x7F, 0xF6,
+    0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xE4, 0x7F, 0xF6, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0xE7, 0x20, 0x15, 0xDF, 0xFF, 0xF6, 0x00, 0x00,
+    0x6F, 0xFE, 0x30, 0x00, 0x00, 0x1D, 0xFF, 0xF6, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x02, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6,
+    0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x00,
+    0xBF, 0xF7, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x1D,
+    0xFF, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0xE7, 0x20, 0x15, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE4, 0x7F, 0xF6,
+    0x00, 0x00, 0x00, 0x02, 0x8D, 0xEE, 0xC8, 0x20, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x39, 0xCE,
+    0xFE, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+    0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0xE8, 0x31, 0x02, 0x6D,
+    0xFF, 0xD0, 0x00, 0x00, 0x4F, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xCF, 0xF5, 0x00, 0x00, 0xAF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFD,
+    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x52, 0x01, 0x25, 0x9E, 0xF5,
+    0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBE, 0xFE, 0xDA, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xAD, 0xEF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xEF, 0xFF, 0xFF,
+    0xFD, 0x00, 0x05, 0xFF, 0xD3, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x60, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x8D, 0xEE, 0xC8, 0x20, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE4,
+    0x7F, 0xF6, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00, 0x1D, 0xFF,
+    0xE7, 0x20, 0x15, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x1C, 0xFF, 0xF6,
+    0x00, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xF6, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x03,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xF6, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF6,
+    0x00, 0x00, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x1C, 0xFF, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0xE7, 0x20,
+    0x15, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00,
+    0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE4, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xEE, 0xC8, 0x20,
+    0x9F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xC7, 0x32, 0x11, 0x27, 0xEF, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0xBD, 0xEF, 0xEC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x5B, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x1B, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x72, 0x01, 0x5D, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
+    0xE2, 0x00, 0x00, 0x01, 0xEF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0xF7,
+    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
+    0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD,
+    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
+    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0,
+    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
+    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
+    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
+    0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x3C, 0xFF, 0x70,
+    0x00, 0x9F, 0xFF, 0xFF, 0x20, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x9F, 0xEB, 0x40, 0x00, 0x00,
+    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x04,
+    0xEF, 0xF7, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x09, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0A, 0xFF, 0xD2, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1B, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xDC, 0xFF,
+    0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xDC, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1C, 0xFF, 0xC1, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1C, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1C,
+    0xFF, 0xC1, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1C, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x1F,
+    0xFC, 0x00, 0x00, 0x1C, 0xFF, 0xC1, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1C, 0xFF, 0xC1,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xC1, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x1C, 0xFF, 0xD1, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD,
+    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
+    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0,
+    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
+    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
+    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
+    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
+    0x00, 0x1F, 0xFC, 0x00, 0x6B, 0xEF, 0xD9, 0x20, 0x00, 0x03, 0x9D, 0xEE, 0xB5, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xC1, 0xCF, 0xFF, 0xFF, 0xFE, 0x40, 0x08, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xE6, 0x20, 0x17, 0xFF, 0xFB, 0xFF, 0x93, 0x11, 0x4D, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
+    0xFF, 0xD2, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x2E, 0xFF, 0x20, 0x00, 0x01, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x1F, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x60, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x5B, 0xDF, 0xEB, 0x50, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x1B, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x72, 0x01, 0x5D, 0xFF, 0xE0, 0x00, 0x00,
+    0x1F, 0xFF, 0xE2, 0x00, 0x00, 0x01, 0xEF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x9F, 0xF7, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xDF,
+    0xED, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x30, 0x14, 0xCF,
+    0xFF, 0x70, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xE1, 0x00, 0x00, 0xBF, 0xF9,
+    0x00, 0x00, 0x00, 0x01, 0xEF, 0xF5, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x02,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF5, 0x00, 0x00, 0x6F, 0xFF,
+    0x40, 0x00, 0x00, 0x0A, 0xFF, 0xE1, 0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x20, 0x14, 0xCF, 0xFF, 0x70,
+    0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xDF, 0xED, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x6B, 0xEF, 0xDA, 0x30, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x2C, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
+    0xFE, 0x82, 0x01, 0x5D, 0xFF, 0xF3, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xCF, 0xFB,
+    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x1F, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x1F, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0x10, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xCF, 0xFB, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x82,
+    0x01, 0x5D, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFC, 0x2C, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x6B, 0xEF, 0xDA,
+    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xEE, 0xC8, 0x20,
+    0x7F, 0xF6, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xE4, 0x7F, 0xF6, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0xE7, 0x20, 0x15, 0xDF, 0xFF, 0xF6,
+    0x00, 0x00, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x1D, 0xFF, 0xF6, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x02,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xF6, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x02, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF6,
+    0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFE, 0x30, 0x00,
+    0x00, 0x1D, 0xFF, 0xF6, 0x00, 0x00, 0x1D, 0xFF, 0xE7, 0x20, 0x15, 0xDF, 0xFF, 0xF6, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE4,
+    0x7F, 0xF6, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xEE, 0xC8, 0x20, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF6, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x5B, 0xDF, 0xF2, 0x00, 0x1F, 0xFC, 0x1C, 0xFF, 0xFF,
+    0xF2, 0x00, 0x1F, 0xFC, 0xCF, 0xFF, 0xFF, 0xF2, 0x00, 0x1F, 0xFF, 0xFE, 0x72, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x39, 0xCE, 0xFE, 0xDB, 0x73, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0E, 0xFF, 0xB4, 0x10, 0x12,
+    0x48, 0xC2, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xC9, 0x62, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x8B, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5D, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF1, 0x00,
+    0x49, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x04, 0xFF, 0xA5, 0x20, 0x12, 0x7E, 0xFF, 0xC0,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5,
+    0x00, 0x00, 0x00, 0x05, 0xAD, 0xFF, 0xDB, 0x61, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x17, 0xCE, 0xFF, 0xFC, 0x00,
+    0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00,
+    0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0x4F,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF6, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xEF,
+    0xF6, 0x00, 0x00, 0x0E, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF6, 0x00, 0x00, 0x0A, 0xFF, 0xE6,
+    0x10, 0x15, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xF6, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xD3, 0x8F, 0xF6, 0x00, 0x00, 0x00, 0x03, 0x9D, 0xFE, 0xC7,
+    0x10, 0x8F, 0xF6, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x8F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF1,
+    0x00, 0x0C, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0x50, 0x00, 0x01, 0xFF, 0xE1, 0x00, 0x00, 0x01, 0xFF, 0xE1, 0x00, 0x00, 0x0A, 0xFF,
+    0x50, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x0C, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0xEF, 0xF1, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x8F,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xF2, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x9F, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFD, 0x0E, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x04, 0xFF, 0x90, 0x00,
+    0x00, 0x0E, 0xFF, 0xF2, 0x00, 0x00, 0x06, 0xFF, 0x70, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x4F, 0xFF,
+    0xF6, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x8F, 0xFD, 0xFA, 0x00, 0x00,
+    0x0E, 0xFE, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x00, 0xBF, 0xC9, 0xFE, 0x00, 0x00, 0x3F, 0xFA, 0x00,
+    0x00, 0x4F, 0xF9, 0x00, 0x01, 0xFF, 0x85, 0xFF, 0x30, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x0F, 0xFD,
+    0x00, 0x04, 0xFF, 0x41, 0xFF, 0x70, 0x00, 0xBF, 0xF3, 0x00, 0x00, 0x0B, 0xFF, 0x20, 0x08, 0xFF,
+    0x00, 0xCF, 0xA0, 0x00, 0xEF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x60, 0x0C, 0xFB, 0x00, 0x9F, 0xE0,
+    0x03, 0xFF, 0xA0, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x1F, 0xF7, 0x00, 0x5F, 0xF3, 0x07, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0xEF, 0xE0, 0x4F, 0xF4, 0x00, 0x1F, 0xF7, 0x0B, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0xBF, 0xF2, 0x8F, 0xE0, 0x00, 0x0C, 0xFB, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0xCF,
+    0xB0, 0x00, 0x08, 0xFE, 0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x70, 0x00, 0x04,
+    0xFF, 0xBF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x30, 0x00, 0x01, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xF3, 0x00, 0x06, 0xFF, 0xD1, 0x00, 0x00, 0x01, 0xDF, 0xF7, 0x00, 0x00, 0x0A, 0xFF, 0xA0,
+    0x00, 0x00, 0xAF, 0xFB, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x60, 0x00, 0x5F, 0xFE, 0x20, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x30, 0x2E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x1C, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFD, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x40,
+    0x7F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xC0, 0x00, 0x01, 0xEF, 0xF5, 0x00, 0x00, 0x04, 0xFF, 0xE2, 0x00, 0x00, 0x05, 0xFF, 0xE2,
+    0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0x80, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x7F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x60, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE1,
+    0x00, 0x0A, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0x30, 0x00, 0x00, 0xDF, 0xF2, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
+    0x80, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1E, 0xFE, 0x10, 0x00,
+    0x00, 0x00, 0xAF, 0xF5, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0xBF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x10, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xF7, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xD0, 0xEF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4D, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x60, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xDF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xBD, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x93,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0xBD, 0xEF, 0x50, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00,
+    0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00,
+    0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00,
+    0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0,
+    0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xA3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xEF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xB4, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x93, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0xBE, 0xFD, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x2B, 0x60, 0x00, 0x00, 0x00,
+    0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x31, 0x14, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x09, 0xFE, 0x83, 0x11, 0x37, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x9A, 0x10, 0x00, 0x00, 0x00, 0x27, 0xBD, 0xFE,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const FontGlyph FONT_32_GLYPHS[95] = {
+    { 0, 0, 0, 0, 0, 10 },  // space
+    { 0, 13, 23, 0, 7, 13 },  // !
+    { 150, 15, 23, 0, 7, 15 },  // "
+    { 323, 27, 23, 0, 7, 27 },  // #
+    { 634, 20, 30, 0, 5, 20 },  // $
+    { 934, 30, 23, 0, 7, 30 },  // %
+    { 1279, 25, 23, 0, 7, 25 },  // &
+    { 1567, 9, 23, 0, 7, 9 },  // '
+    { 1671, 12, 29, 0, 6, 12 },  // (
+    { 1845, 12, 29, 0, 6, 12 },  // )
+    { 2019, 16, 23, 0, 7, 16 },  // *
+    { 2203, 27, 21, 0, 9, 27 },  // +
+    { 2487, 10, 8, 0, 26, 10 },  // ,
+    { 2527, 12, 10, 0, 20, 12 },  // -
+    { 2587, 10, 4, 0, 26, 10 },  // .
+    { 2607, 11, 26, 0, 7, 11 },  // /
+    { 2750, 20, 23, 0, 7, 20 },  // 0
+    { 2980, 20, 23, 0, 7, 20 },  // 1
+    { 3210, 20, 23, 0, 7, 20 },  // 2
+    { 3440, 20, 23, 0, 7, 20 },  // 3
+    { 3670, 20, 23, 0, 7, 20 },  // 4
+    { 3900, 20, 23, 0, 7, 20 },  // 5
+    { 4130, 20, 23, 0, 7, 20 },  // 6
+    { 4360, 20, 23, 0, 7, 20 },  // 7
+    { 4590, 20, 23, 0, 7, 20 },  // 8
+    { 4820, 20, 23, 0, 7, 20 },  // 9
+    { 5050, 11, 17, 0, 13, 11 },  // :
+    { 5144, 11, 21, 0, 13, 11 },  // ;
+    { 5260, 27, 19, 0, 11, 27 },  // <
+    { 5517, 27, 15, 0, 15, 27 },  // =
+    { 5720, 27, 19, 0, 11, 27 },  // >
+    { 5977, 17, 23, 0, 7, 17 },  // ?
+    { 6173, 32, 28, 0, 7, 32 },  // @
+    { 6621, 22, 23, 0, 7, 22 },  // A
+    { 6874, 22, 23, 0, 7, 22 },  // B
+    { 7127, 22, 23, 0, 7, 22 },  // C
+    { 7380, 25, 23, 0, 7, 25 },  // D
+    { 7668, 20, 23, 0, 7, 20 },  // E
+    { 7898, 18, 23, 0, 7, 18 },  // F
+    { 8105, 25, 23, 0, 7, 25 },  // G
+    { 8393, 24, 23, 0, 7, 24 },  // H
+    { 8669, 9, 23, 0, 7, 9 },  // I
+    { 8773, 11, 29, -2, 7, 9 },  // J
+    { 8933, 22, 23, 0, 7, 21 },  // K
+    { 9186, 18, 23, 0, 7, 18 },  // L
+    { 9393, 28, 23, 0, 7, 28 },  // M
+    { 9715, 24, 23, 0, 7, 24 },  // N
+    { 9991, 25, 23, 0, 7, 25 },  // O
+    { 10279, 19, 23, 0, 7, 19 },  // P
+    { 10498, 25, 27, 0, 7, 25 },  // Q
+    { 10836, 22, 23, 0, 7, 22 },  // R
+    { 11089, 20, 23, 0, 7, 20 },  // S
+    { 11319, 21, 23, -1, 7, 20 },  // T
+    { 11561, 23, 23, 0, 7, 23 },  // U
+    { 11826, 22, 23, 0, 7, 22 },  // V
+    { 12079, 32, 23, 0, 7, 32 },  // W
+    { 12447, 22, 23, 0, 7, 22 },  // X
+    { 12700, 21, 23, -1, 7, 20 },  // Y
+    { 12942, 22, 23, 0, 7, 22 },  // Z
+    { 13195, 12, 29, 0, 6, 12 },  // [
+    { 13369, 11, 26, 0, 7, 11 },  // backslash
+    { 13512, 12, 29, 0, 6, 12 },  // ]
+    { 13686, 27, 23, 0, 7, 27 },  // ^
+    { 13997, 18, 8, -1, 30, 16 },  // _
+    { 14069, 16, 26, 0, 4, 16 },  // `
+    { 14277, 20, 18, 0, 12, 20 },  // a
+    { 14457, 20, 24, 0, 6, 20 },  // b
+    { 14697, 18, 18, 0, 12, 18 },  // c
+    { 14859, 20, 24, 0, 6, 20 },  // d
+    { 15099, 20, 18, 0, 12, 20 },  // e
+    { 15279, 12, 24, 0, 6, 11 },  // f
+    { 15423, 20, 25, 0, 12, 20 },  // g
+    { 15673, 20, 24, 0, 6, 20 },  // h
+    { 15913, 9, 24, 0, 6, 9 },  // i
+    { 16021, 10, 31, -1, 6, 9 },  // j
+    { 16176, 19, 24, 0, 6, 19 },  // k
+    { 16404, 9, 24, 0, 6, 9 },  // l
+    { 16512, 31, 18, 0, 12, 31 },  // m
+    { 16791, 20, 18, 0, 12, 20 },  // n
+    { 16971, 20, 18, 0, 12, 20 },  // o
+    { 17151, 20, 25, 0, 12, 20 },  // p
+    { 17401, 20, 25, 0, 12, 20 },  // q
+    { 17651, 14, 18, 0, 12, 13 },  // r
+    { 17777, 17, 18, 0, 12, 17 },  // s
+    { 17930, 13, 23, 0, 7, 13 },  // t
+    { 18080, 20, 18, 0, 12, 20 },  // u
+    { 18260, 19, 18, 0, 12, 19 },  // v
+    { 18431, 26, 18, 0, 12, 26 },  // w
+    { 18665, 19, 18, 0, 12, 19 },  // x
+    { 18836, 19, 25, 0, 12, 19 },  // y
+    { 19074, 17, 18, 0, 12, 17 },  // z
+    { 19227, 20, 30, 0, 6, 20 },  // {
+    { 19527, 11, 32, 0, 6, 11 },  // |
+    { 19703, 20, 30, 0, 6, 20 },  // }
+    { 20003, 27, 14, 0, 16, 27 },  // ~
+};
+
+static const Font FONT_32 = { 32, 38, 32, 95, FONT_32_GLYPHS, FONT_32_BITMAP };
+
+static const uint8_t FONT_48_BITMAP[46179] = {
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
+    0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90,
+    0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00, 0x00, 0x07,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0x60, 0x00, 0x00, 0x0B, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x06, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00,
+    0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0x30, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00,
+    0x0A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0x40, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x09,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0xCE, 0xFF, 0xFF,
+    0xDC, 0xB8, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xD7, 0x33, 0xFF, 0x41, 0x24, 0x57,
+    0xAD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x91, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF6, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF7, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD1, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC3, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFC, 0x76, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x85, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x16, 0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x01, 0xCF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x03, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x1E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0x30, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0C, 0x61, 0x00, 0x00,
+    0x00, 0x2F, 0xF3, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x85, 0x20,
+    0x02, 0xFF, 0x43, 0x7D, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0xBD, 0xEF, 0xFF,
+    0xEC, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB3, 0x12, 0x7F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0xBF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xA0, 0x00, 0x00, 0x1D, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0x70, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x00,
+    0x00, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xB3, 0x01, 0x7E, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xDF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBD, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x2E, 0xFF, 0xA0, 0x00,
+    0x00, 0x04, 0xAD, 0xEE, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFE, 0x20, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x1D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xD0, 0x00, 0x00, 0xAF, 0xFF, 0xC4, 0x11, 0x6E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x03, 0xFF, 0xFD, 0x10, 0x00,
+    0x03, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFB,
+    0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFD, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFD, 0x10, 0x00, 0x03, 0xEF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC4, 0x11, 0x6E, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xAD, 0xEE, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xDE, 0xFE,
+    0xDA, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFD, 0x72, 0x01, 0x25, 0x8D, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x03, 0xA5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF,
+    0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFE, 0x3B, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x30, 0x1C, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x1C, 0xFF, 0xFF,
+    0xD2, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xB0, 0x00, 0x00,
+    0x1D, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x50, 0x00, 0x00, 0x09,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x2F, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xB1, 0x00, 0x07, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xB0,
+    0x00, 0xDF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+    0xFF, 0xFF, 0xB0, 0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xAE, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4C,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xB6, 0x21, 0x02,
+    0x37, 0xCF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x7F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x7F, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9C, 0xEF, 0xFE, 0xC9, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x10, 0x00, 0x00, 0x5F,
+    0xF5, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0xEF, 0xD5, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x5D,
+    0xFE, 0x20, 0x04, 0xEF, 0xFF, 0xB2, 0x00, 0x5F, 0xF5, 0x00, 0x2B, 0xFF, 0xFE, 0x40, 0x00, 0x18,
+    0xEF, 0xFF, 0x70, 0x5F, 0xF5, 0x07, 0xEF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFD, 0x9F,
+    0xF9, 0xDF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFD, 0x9F, 0xF9, 0xDF, 0xFF, 0x91,
+    0x00, 0x00, 0x00, 0x17, 0xEF, 0xFF, 0x70, 0x5F, 0xF5, 0x07, 0xEF, 0xFE, 0x71, 0x00, 0x04, 0xDF,
+    0xFF, 0xB2, 0x00, 0x5F, 0xF5, 0x00, 0x2B, 0xFF, 0xFD, 0x40, 0x02, 0xEF, 0xD5, 0x00, 0x00, 0x5F,
+    0xF5, 0x00, 0x00, 0x5D, 0xFF, 0x20, 0x00, 0x79, 0x10, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xEF, 0xEC, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB4, 0x21, 0x27, 0xEF, 0xFF, 0xFE, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x10, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x0C, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x01,
+    0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xCF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB4, 0x11, 0x27, 0xDF, 0xFF,
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xFF, 0xEC, 0x94, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xBE, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB8, 0x46, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAB, 0x74, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0xBD, 0xEF, 0xED, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xEA, 0x63, 0x20, 0x13, 0x7D, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x9C, 0xEE, 0xFE, 0xDA, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xC8, 0x53, 0x10, 0x12, 0x49, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x48, 0xDF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x25, 0x9E,
+    0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFE, 0x96, 0x31, 0x00, 0x13, 0x6B, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x7A, 0xCE, 0xFF, 0xED, 0xB8, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xEF, 0xFD, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0x4D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xA0, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xE1, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xF6, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFB, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF,
+    0x20, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x70,
+    0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x00,
+    0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x0D,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFA, 0x8C, 0xEF, 0xED, 0xB8,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFE, 0xA6, 0x31, 0x01, 0x25, 0x9E, 0xFF, 0xFF,
+    0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04,
+    0xFD, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xE9, 0x63, 0x10, 0x12, 0x59, 0xEF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xAD, 0xEF, 0xFE, 0xDA, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x9C, 0xEF, 0xED, 0xCB, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFE,
+    0xA5, 0x21, 0x01, 0x24, 0x7A, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFB, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x04, 0x9D, 0xEF, 0xDC, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0xFF, 0xFC, 0x62, 0x01, 0x37, 0xEF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x10,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xC6, 0x20, 0x13, 0x7E, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9C,
+    0xEF, 0xED, 0xB7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCD, 0xEF,
+    0xED, 0xA7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x62, 0x10, 0x14, 0x9E,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x62, 0x10, 0x14, 0x9E, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xC6, 0x31, 0x01, 0x49, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFC, 0x62, 0x10,
+    0x14, 0x9E, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0xCD, 0xEF, 0xED, 0xB7,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xCE, 0xFE, 0xDB, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x52, 0x01, 0x38, 0xEF, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE1,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x1E,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xFF, 0xB5, 0x20, 0x13, 0x8E, 0xFF, 0xFE, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x03, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+    0xAD, 0xEF, 0xEC, 0x72, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB8, 0x53, 0x21, 0x01, 0x37, 0xCF, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0xAC, 0xDE, 0xFE, 0xDB, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5B,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x61, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFC, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xCF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0xEF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xEA, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x6A, 0xCE, 0xFE, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFD, 0x94, 0x20, 0x13, 0x8E, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x8F, 0xC5, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x9B, 0xDE, 0xFE, 0xEC, 0xA7, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xEA, 0x74, 0x21, 0x01, 0x13, 0x59, 0xDF, 0xFF, 0xFF,
+    0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xB5, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F,
+    0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x9D, 0xEF, 0xEB, 0x60, 0x00, 0x5F, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x5F, 0xFF, 0x00,
+    0x00, 0x01, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xD6, 0x21, 0x12, 0x6C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00, 0x05,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x0C,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0x70, 0x00, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x0B,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x00,
+    0x00, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x00,
+    0x00, 0x2D, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x00, 0x04, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xD6, 0x21, 0x02, 0x6C, 0xFF, 0xFF, 0xFF, 0x25,
+    0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x5F, 0xFF, 0xFF, 0xE8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9D, 0xEE, 0xDB, 0x50, 0x00, 0x5E, 0xDB, 0x84,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xEF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xA2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xD9,
+    0x53, 0x10, 0x01, 0x24, 0x8C, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
+    0xAC, 0xEF, 0xFE, 0xDB, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF6, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x0D, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x50, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE1, 0x02, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF9, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x0A, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xEF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x0A, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF7, 0x01, 0xFF,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xD0, 0x7F,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEC, 0xA7, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0x25, 0xAF, 0xFF, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xEF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x12,
+    0x5A, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x7D, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x13, 0x7D, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xB8, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xBD, 0xEF, 0xED, 0xCA, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x73, 0x21,
+    0x12, 0x36, 0xAE, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFE, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xE0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
+    0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x73, 0x21, 0x02, 0x36, 0xAD, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xBD, 0xEF,
+    0xED, 0xCA, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED,
+    0xCA, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x12, 0x36, 0x9D, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x12, 0x36, 0x9D, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xCA, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xBD, 0xEF,
+    0xFE, 0xDC, 0x97, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFC, 0x84, 0x21, 0x01, 0x23, 0x6A, 0xEF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFB, 0x74, 0x21,
+    0x01, 0x13, 0x58, 0xDF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0xBD, 0xEF, 0xFE, 0xDC, 0x96, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x12, 0x6D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x01, 0xCF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x02, 0xDF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x02, 0xDF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x03, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x73, 0xEF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0xEF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0xEF, 0xFF, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x74, 0xEF, 0xFF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x04, 0xEF, 0xFF, 0xFD,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x04, 0xEF, 0xFF,
+    0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x04, 0xEF,
+    0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x04,
+    0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x9D, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xF4, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x57, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF5, 0x1F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x70, 0xDF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF2,
+    0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x05, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFB, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x0E,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x50, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF5, 0x00, 0x8F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xDF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xF9, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x0C, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x30, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x50, 0x00, 0x6F, 0xFF, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x01, 0xFF, 0xFE, 0x10, 0x00, 0x09, 0xFF, 0xF7, 0x00, 0x00,
+    0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x01,
+    0xEF, 0xFF, 0x10, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00,
+    0x4F, 0xFF, 0xC0, 0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x0B, 0xFF, 0xF5, 0x00, 0x00, 0x0D, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x2F, 0xFF,
+    0xD0, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x4D, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0xBF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x3F, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x0A, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x02,
+    0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF5, 0x00, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF5, 0x00, 0x2F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x01, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x1E, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x10, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x70, 0x00, 0x6F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE1, 0x00, 0x6F,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+    0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x20, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0x90, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x9F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x7A, 0xCE, 0xFF, 0xEC, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE9,
+    0x42, 0x11, 0x25, 0x9E, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xF1, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xF1, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xE1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xFF, 0xD9, 0x42, 0x11, 0x25, 0x9E, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7A,
+    0xDE, 0xFF, 0xEC, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xED, 0xB8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x14, 0x8E, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF2, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF2, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xB8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7A, 0xCE,
+    0xFF, 0xEC, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE9, 0x42, 0x11, 0x25, 0x9E, 0xFF,
+    0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFE, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE1,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xDF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x4F, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+    0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xF1, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x9F, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xD9, 0x42,
+    0x11, 0x25, 0x9E, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7A, 0xDE, 0xFF, 0xEF, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xC9, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x13,
+    0x7C, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x01, 0x37, 0xDF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x01, 0x36, 0xDF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xCD, 0xEF, 0xED,
+    0xCA, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFC, 0x73, 0x10, 0x12, 0x47, 0xBF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0xFA, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xC8, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA,
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7D, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0x00, 0x00, 0x09, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x0A, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xEA, 0x74, 0x21, 0x01, 0x25,
+    0x8E, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x40, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x71,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0xAC, 0xEE, 0xFE, 0xDC, 0xA7, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xB6, 0x21, 0x01, 0x25, 0xAF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x8B, 0xDE, 0xFE, 0xDC,
+    0x95, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0xDF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x0E, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x05, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xA0, 0xDF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x4F, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB,
+    0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00,
+    0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x01,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xF5, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x18, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xC0, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF9, 0x01, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x50,
+    0x0C, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x05,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF5, 0x00, 0x00, 0xDF,
+    0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x5F, 0xFF,
+    0x70, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00,
+    0x04, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0x00, 0x0D, 0xFF, 0xF0,
+    0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x0C,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF7, 0x00,
+    0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x08, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x07,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF3, 0x00, 0xBF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x70, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x70, 0x0E, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x04, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xE0, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x3B, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0x3B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0xEF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD1,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x01, 0xEF, 0xFF,
+    0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00, 0xAF, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x6F, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x8E, 0xFF,
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xDF, 0xFF, 0xF3, 0x01, 0xEF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xF7, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x20, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00,
+    0x00, 0x08, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6,
+    0x00, 0x03, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+    0xE2, 0x00, 0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF,
+    0xFE, 0x20, 0x2E, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0x60, 0x00, 0x6F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00,
+    0x00, 0x02, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x06, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xF6, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xFF, 0xE2, 0x00, 0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x5F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0x60, 0x1E, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFE, 0x2B, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xFD, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xDF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x30, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF3, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+    0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xDF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3E, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xB0, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF5, 0x3E, 0xFF, 0xFF, 0xC1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x40, 0x02,
+    0xDF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0xD3, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x9F, 0xFF,
+    0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xAD, 0xEF, 0xED, 0xC8, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFE, 0x96, 0x32, 0x10, 0x13, 0x6B, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9C, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x01, 0xDF, 0xFF, 0xFF, 0xA6, 0x42, 0x10, 0x00, 0x00, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x6F,
+    0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC5, 0x20, 0x13, 0x7D, 0xFF, 0xFA, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x14, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xCE, 0xFE, 0xDB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x16, 0xAD, 0xFE, 0xDA, 0x51, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xCE, 0xFF, 0xE7, 0x31, 0x12, 0x7D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFB, 0x10, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFB, 0x10, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCE, 0xFF,
+    0xE7, 0x31, 0x12, 0x7D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x05, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xFE, 0xDB,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAC, 0xDF, 0xED, 0xB8, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x71, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x95,
+    0x21, 0x01, 0x47, 0xBF, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x86, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x02, 0x86, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x95, 0x21, 0x01, 0x47, 0xBF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xAC, 0xEF, 0xED, 0xB8, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xEC,
+    0x83, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA1, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x23, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0x41, 0x02, 0x5B, 0xFF, 0xFA, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x1F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0x41, 0x02, 0x5B, 0xFF, 0xFA, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x23, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x8C, 0xEF, 0xEC, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0xAC, 0xEF, 0xED, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFC, 0x73, 0x10,
+    0x13, 0x8E, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00,
+    0x01, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x70, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xB0, 0x00, 0x00, 0x0E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0,
+    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xA6, 0x21, 0x01, 0x13, 0x58,
+    0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8C, 0xDE, 0xFE, 0xDB, 0x96, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x9C, 0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xA0, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xEC, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x03, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x23, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xF9, 0x41, 0x02, 0x4A, 0xFF, 0xFA, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x01,
+    0xEF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x1D, 0xFF, 0xFF, 0xF9, 0x41, 0x01, 0x4A, 0xFF, 0xFA, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x03,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x23, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9C,
+    0xEF, 0xEC, 0x83, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD8, 0x52, 0x10, 0x13, 0x6B, 0xFF, 0xFF, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0xAC, 0xEF, 0xFD, 0xCA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x05, 0xAD, 0xEF, 0xDB,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCD, 0xFF, 0xD7, 0x31, 0x02, 0x6D, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x15, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+    0xDF, 0xED, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x1A, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x01, 0xCF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x2D, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x04, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x5F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB7, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xDE, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB2, 0xDF, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x2D, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x02, 0xDF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x1C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x01, 0xCF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFE,
+    0x30, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE3, 0x00,
+    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xAD, 0xEF, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xDE, 0xED, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x04, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCE, 0xFF, 0xC6, 0x21, 0x13,
+    0x9F, 0xFF, 0xFF, 0x53, 0xFF, 0xFC, 0x62, 0x11, 0x39, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFC, 0xBF, 0xF7, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0xEF, 0xDB, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xCD, 0xFF, 0xD7, 0x31, 0x02, 0x6D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xCD,
+    0xFE, 0xDB, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFB, 0x52, 0x01, 0x49, 0xFF, 0xFF, 0xFE, 0x20,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0xDF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x70, 0x00, 0x03, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFA,
+    0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00,
+    0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF7, 0x00, 0x00, 0x0D,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x9F, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xB5, 0x20, 0x14, 0x9F,
+    0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9C, 0xEF, 0xED, 0xB7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xFE, 0xDA, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCE,
+    0xFF, 0xE7, 0x31, 0x12, 0x7D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFB,
+    0x10, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xC1, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xC1,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFB, 0x10,
+    0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xCE, 0xFF, 0xE7, 0x31,
+    0x12, 0x7D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x16, 0xAD, 0xFE, 0xDB, 0x51, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C,
+    0xEF, 0xEC, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xA1, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x23, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0x41, 0x02, 0x5B, 0xFF,
+    0xFA, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F,
+    0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0x41, 0x02, 0x5B, 0xFF, 0xFA, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x23, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xEC, 0x83, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAC, 0xEF, 0xFB, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x04, 0xDF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xAF, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xAF,
+    0xFF, 0xCE, 0xFF, 0xD7, 0x31, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFE,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xDE, 0xFF, 0xEC, 0xA7, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE9, 0x42, 0x10, 0x12, 0x58, 0xDF, 0xF4,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x40, 0x00, 0x00, 0x1F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xD8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x6A, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0xAE, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
+    0xFF, 0x40, 0x00, 0x06, 0xFF, 0xEB, 0x75, 0x21, 0x00, 0x14, 0x8E, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x05, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8A, 0xDE, 0xFF, 0xEC, 0x96, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
+    0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xEF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xEF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3E, 0xFF,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF9, 0x31, 0x02, 0x5A, 0xFF, 0xFA, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x04, 0xFF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0xEF, 0xEB, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0x01, 0xEF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x9F, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x10, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xA0, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x0A, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xE0, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5,
+    0x0E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x5F, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xBF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x09,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0x5F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x8F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x09, 0xFF, 0xF2,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0xFF,
+    0x90, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
+    0x00, 0x06, 0xFF, 0xF5, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0xDF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x8F, 0xFF, 0x30, 0x00,
+    0x2F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x04,
+    0xFF, 0xF7, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0x30, 0x0B, 0xFF, 0xF1, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x0E, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x01, 0xFF, 0xFB, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x3F, 0xFF,
+    0x80, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x08, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0xEF, 0xFC, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
+    0xCF, 0xFE, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF2, 0xEF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0x9F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x9F, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xFF, 0xFD, 0x10, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF,
+    0xF4, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x2E, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xF7, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+    0x40, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xD1, 0x06,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x3E, 0xFF, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x5F, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x20, 0x01, 0xCF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x2E, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xEF, 0xFF, 0xD1, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0x70, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0,
+    0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x60, 0x00, 0x8F,
+    0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xA0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF1,
+    0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF7, 0x00, 0x00,
+    0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xDF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA0, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF1, 0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x1F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xEB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9B, 0xDE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0xDF, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x6D, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x73, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x59, 0xBD, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEE, 0xDA, 0x73,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4A, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x94, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9E, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFA, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xAF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xED, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7B, 0xDE, 0xFD, 0xB7,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x42, 0x01, 0x37, 0xCF, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFD, 0x84, 0x20, 0x14, 0x7B,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0xDE, 0xFD, 0xC8, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+};
+
+static const FontGlyph FONT_48_GLYPHS[95] = {
+    { 0, 0, 0, 0, 0, 15 },  // space
+    { 0, 19, 35, 0, 10, 19 },  // !
+    { 333, 22, 35, 0, 10, 22 },  // "
+    { 718, 40, 35, 0, 10, 40 },  // #
+    { 1418, 31, 44, 0, 8, 31 },  // $
+    { 2100, 46, 37, 0, 9, 46 },  // %
+    { 2951, 37, 37, 0, 9, 37 },  // &
+    { 3636, 13, 35, 0, 10, 13 },  // '
+    { 3864, 19, 43, 0, 9, 19 },  // (
+    { 4273, 19, 43, 0, 9, 19 },  // )
+    { 4682, 24, 36, 0, 9, 24 },  // *
+    { 5114, 40, 30, 0, 15, 40 },  // +
+    { 5714, 15, 12, 0, 39, 15 },  // ,
+    { 5804, 17, 15, 0, 30, 17 },  // -
+    { 5932, 15, 6, 0, 39, 15 },  // .
+    { 5977, 17, 39, 0, 10, 16 },  // /
+    { 6309, 31, 37, 0, 9, 31 },  // 0
+    { 6883, 31, 35, 0, 10, 31 },  // 1
+    { 7426, 31, 36, 0, 9, 31 },  // 2
+    { 7984, 31, 37, 0, 9, 31 },  // 3
+    { 8558, 31, 35, 0, 10, 31 },  // 4
+    { 9101, 31, 36, 0, 10, 31 },  // 5
+    { 9659, 31, 37, 0, 9, 31 },  // 6
+    { 10233, 31, 35, 0, 10, 31 },  // 7
+    { 10776, 31, 37, 0, 9, 31 },  // 8
+    { 11350, 31, 37, 0, 9, 31 },  // 9
+    { 11924, 16, 25, 0, 20, 16 },  // :
+    { 12124, 16, 31, 0, 20, 16 },  // ;
+    { 12372, 40, 28, 0, 17, 40 },  // <
+    { 12932, 40, 22, 0, 23, 40 },  // =
+    { 13372, 40, 28, 0, 17, 40 },  // >
+    { 13932, 25, 36, 0, 9, 25 },  // ?
+    { 14382, 48, 42, 0, 11, 48 },  // @
+    { 15390, 33, 35, 0, 10, 33 },  // A
+    { 15968, 33, 35, 0, 10, 33 },  // B
+    { 16546, 34, 37, 0, 9, 34 },  // C
+    { 17175, 37, 35, 0, 10, 37 },  // D
+    { 17823, 30, 35, 0, 10, 30 },  // E
+    { 18348, 28, 35, 0, 10, 28 },  // F
+    { 18838, 37, 37, 0, 9, 37 },  // G
+    { 19523, 36, 35, 0, 10, 36 },  // H
+    { 20153, 14, 35, 0, 10, 14 },  // I
+    { 20398, 17, 45, -3, 10, 14 },  // J
+    { 20781, 33, 35, 0, 10, 31 },  // K
+    { 21359, 27, 35, 0, 10, 27 },  // L
+    { 21832, 41, 35, 0, 10, 41 },  // M
+    { 22550, 36, 35, 0, 10, 36 },  // N
+    { 23180, 38, 37, 0, 9, 38 },  // O
+    { 23883, 29, 35, 0, 10, 29 },  // P
+    { 24391, 38, 42, 0, 9, 38 },  // Q
+    { 25189, 33, 35, 0, 10, 33 },  // R
+    { 25767, 30, 37, 0, 9, 30 },  // S
+    { 26322, 31, 35, -1, 10, 29 },  // T
+    { 26865, 35, 36, 0, 10, 35 },  // U
+    { 27495, 33, 35, 0, 10, 33 },  // V
+    { 28073, 47, 35, 0, 10, 47 },  // W
+    { 28896, 33, 35, 0, 10, 33 },  // X
+    { 29474, 31, 35, -1, 10, 29 },  // Y
+    { 30017, 33, 35, 0, 10, 33 },  // Z
+    { 30595, 19, 43, 0, 9, 19 },  // [
+    { 31004, 17, 39, 0, 10, 16 },  // backslash
+    { 31336, 19, 43, 0, 9, 19 },  // ]
+    { 31745, 40, 35, 0, 10, 40 },  // ^
+    { 32445, 26, 11, -1, 45, 24 },  // _
+    { 32588, 24, 38, 0, 7, 24 },  // `
+    { 33044, 29, 28, 0, 18, 29 },  // a
+    { 33450, 30, 37, 0, 9, 30 },  // b
+    { 34005, 26, 28, 0, 18, 26 },  // c
+    { 34369, 30, 37, 0, 9, 30 },  // d
+    { 34924, 30, 28, 0, 18, 30 },  // e
+    { 35344, 18, 36, 0, 9, 17 },  // f
+    { 35668, 30, 37, 0, 18, 30 },  // g
+    { 36223, 30, 36, 0, 9, 30 },  // h
+    { 36763, 13, 36, 0, 9, 13 },  // i
+    { 36997, 14, 46, -1, 9, 13 },  // j
+    { 37319, 28, 36, 0, 9, 28 },  // k
+    { 37823, 13, 36, 0, 9, 13 },  // l
+    { 38057, 47, 27, 0, 18, 47 },  // m
+    { 38692, 30, 27, 0, 18, 30 },  // n
+    { 39097, 29, 28, 0, 18, 29 },  // o
+    { 39503, 30, 37, 0, 18, 30 },  // p
+    { 40058, 30, 37, 0, 18, 30 },  // q
+    { 40613, 20, 27, 0, 18, 20 },  // r
+    { 40883, 25, 28, 0, 18, 25 },  // s
+    { 41233, 19, 33, 0, 12, 19 },  // t
+    { 41547, 30, 28, 0, 18, 30 },  // u
+    { 41967, 28, 26, 0, 19, 28 },  // v
+    { 42331, 39, 26, 0, 19, 39 },  // w
+    { 42838, 28, 26, 0, 19, 28 },  // x
+    { 43202, 28, 36, 0, 19, 28 },  // y
+    { 43706, 25, 26, 0, 19, 25 },  // z
+    { 44031, 31, 44, 0, 9, 31 },  // {
+    { 44713, 16, 48, 0, 9, 16 },  // |
+    { 45097, 31, 44, 0, 9, 31 },  // }
+    { 45779, 40, 20, 0, 25, 40 },  // ~
+};
+
+static const Font FONT_48 = { 48, 57, 32, 95, FONT_48_GLYPHS, FONT_48_BITMAP };
+
+static const Font *const FONTS[] = { &FONT_16, &FONT_24, &FONT_32, &FONT_48 };
+#define FONT_COUNT  4
@@ -0,0 +1,156 @@
+/*
+ * JPEG Restart Slicing - Implementation
+ */
+
+#include "jpeg_slice.h"
+
+#define M_SOF0 0xC0
+#define M_SOF1 0xC1
+#define M_DHT  0xC4
+#define M_JPG  0xC8
+#define M_DAC  0xCC
+#define M_RST0 0xD0
+#define M_RST7 0xD7
+#define M_EOI  0xD9
+#define M_SOS  0xDA
+#define M_DRI  0xDD
+
+static uint16_t be16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+static int need(uint32_t end, uint32_t avail, uint32_t size) {
+    if (end <= avail) return JPEG_SLICE_OK;
+    return end > size ? JPEG_SLICE_NO : JPEG_SLICE_MORE;
+}
+
+int jpeg_slice_parse(JpegSlice *s, const uint8_t *data, uint32_t avail, uint32_t size) {
+    memset(s, 0, sizeof(*s));
+    int r = need(2, avail, size);
+    if (r != JPEG_SLICE_OK) return r;
+    if (data[0] != 0xFF || data[1] != 0xD8) return JPEG_SLICE_NO;
+
+    uint32_t pos = 2;
+    uint32_t interval = 0;
+    int comps = 0;
+    int mcu_w = 8, mcu_h = 8;
+    for (;;) {
+        r = need(pos + 4, avail, size);
+        if (r != JPEG_SLICE_OK) return r;
+        if (data[pos] != 0xFF) return JPEG_SLICE_NO;
+        uint8_t m = data[pos + 1];
+        if (m == 0xFF) {                        // Fill byte
+            pos++;
+            continue;
+        }
+        if ((m >= M_RST0 && m <= M_EOI) || m == 0x01) return JPEG_SLICE_NO;
+        uint32_t len = be16(data + pos + 2);
+        uint32_t end = pos + 2 + len;
+        if (len < 2) return JPEG_SLICE_NO;
+        r = need(end, avail, size);
+        if (r != JPEG_SLICE_OK) return r;
+        const uint8_t *seg = data + pos + 4;
+
+        if (m == M_SOF0 || m == M_SOF1) {
+            if (len < 8) return JPEG_SLICE_NO;
+            comps = seg[5];
+            if (len < 8 + 3u * comps) return JPEG_SLICE_NO;
+            s->sof_pos = pos + 5;
+            s->height = be16(seg + 1);
+            s->width = be16(seg + 3);
+            // A single-component scan codes one block per MCU
+            if (comps > 1) {
+                int hmax = 1, vmax = 1;
+                for (int i = 0; i < comps; i++) {
+                    hmax = max(hmax, seg[7 + i * 3] >> 4);
+                    vmax = max(vmax, seg[7 + i * 3] & 0x0F);
+                }
+                mcu_w = 8 * hmax;
+                mcu_h = 8 * vmax;
+            }
+        } else if (m >= 0xC2 && m <= 0xCF && m != M_DHT && m != M_JPG && m != M_DAC) {
+            return JPEG_SLICE_NO;               // Progressive, lossless, arithmetic
+        } else if (m == M_DRI) {
+            if (len < 4) return JPEG_SLICE_NO;
+            interval = be16(seg);
+        } else if (m == M_SOS) {
+            // One interleaved scan only
+            if (!comps || seg[0] != comps) return JPEG_SLICE_NO;
+            s->scan_pos = end;
+            break;
+        }
+        pos = end;
+    }
+    if (!interval || !s->width || !s->height) return JPEG_SLICE_NO;
+
+    // Nearest MCU row to the middle that starts a restart interval
+    uint32_t rows = (s->height + mcu_h - 1) / mcu_h;
+    uint32_t per_row = (s->width + mcu_w - 1) / mcu_w;
+    for (uint32_t d = 0; d <= rows / 2; d++) {
+        uint32_t cand[2] = { rows / 2 + d, rows / 2 - d };
+        for (uint32_t row : cand) {
+            if (row == 0 || row >= rows || (row * per_row) % interval) continue;
+            s->split_y = row * mcu_h;
+            s->split_rst = row * per_row / interval;
+            s->scan_at = s->scan_pos;
+            return JPEG_SLICE_OK;
+        }
+    }
+    return JPEG_SLICE_NO;
+}
+
+void jpeg_slice_cut_top(const JpegSlice *s, uint8_t *data) {
+    data[s->sof_pos] = s->split_y >> 8;
+    data[s->sof_pos + 1] = s->split_y & 0xFF;
+}
+
+bool jpeg_slice_find_split(JpegSlice *s, const uint8_t *data, uint32_t avail) {
+    if (s->data_pos) return true;
+    while (s->scan_at + 1 < avail) {
+        const uint8_t *p = (const uint8_t *)memchr(data + s->scan_at, 0xFF, avail - 1 - s->scan_at);
+        if (!p) {
+            s->scan_at = avail - 1;
+            break;
+        }
+        uint32_t i = p - data;
+        uint8_t m = data[i + 1];
+        s->scan_at = i + 1;
+        if (m >= M_RST0 && m <= M_RST7 && ++s->rst_seen == s->split_rst) {
+            s->data_pos = i + 2;
+            s->fixed_to = s->data_pos;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t jpeg_slice_bottom_size(const JpegSlice *s, uint32_t size) {
+    return s->scan_pos + (size - s->data_pos);
+}
+
+uint32_t jpeg_slice_bottom_end(const JpegSlice *s, uint32_t pos) {
+    return pos <= s->scan_pos ? pos : s->data_pos + (pos - s->scan_pos);
+}
+
+void jpeg_slice_bottom_read(JpegSlice *s, uint8_t *data, uint32_t pos, uint8_t *dst, uint32_t len) {
+    // Renumber the markers that follow the split from RST0
+    uint32_t end = jpeg_slice_bottom_end(s, pos + len);
+    for (uint32_t i = s->fixed_to; i < end; i++) {
+        if (data[i] >= M_RST0 && data[i] <= M_RST7 && data[i - 1] == 0xFF) {
+            data[i] = M_RST0 | ((data[i] - M_RST0 - s->split_rst) & 7);
+        }
+    }
+    if (end > s->fixed_to) s->fixed_to = end;
+
+    // Headers with the height cut to the bottom rows, then the data
+    while (len && pos < s->scan_pos) {
+        uint8_t c = data[pos];
+        uint16_t h = s->height - s->split_y;
+        if (pos == s->sof_pos) c = h >> 8;
+        if (pos == s->sof_pos + 1) c = h & 0xFF;
+        *dst++ = c;
+        pos++;
+        len--;
+    }
+    if (len) memcpy(dst, data + s->data_pos + (pos - s->scan_pos), len);
+}
@@ -0,0 +1,54 @@
+/*
+ * JPEG Restart Slicing for SenseCAP Indicator
+ *
+ * A baseline JPEG with restart markers (DRI) can be cut at a marker into
+ * two files that decode independently: the DC predictors reset at every
+ * marker, so the bytes after one are a valid start of scan. The top part
+ * is the original file with the frame height cut short; the bottom part
+ * is the original headers (height reduced to the remaining rows) followed
+ * by the entropy data after the split marker, with the later markers
+ * renumbered from RST0.
+ *
+ * Everything works on a buffer that may still be filling: each step says
+ * whether it needs more bytes.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define JPEG_SLICE_MORE  0      // Need more bytes
+#define JPEG_SLICE_OK    1
+#define JPEG_SLICE_NO   -1      // Not sliceable: decode it whole
+
+struct JpegSlice {
+    uint16_t width, height;
+    uint32_t sof_pos;           // Offset of the SOF height field
+    uint32_t scan_pos;          // First entropy-coded byte
+    uint16_t split_y;           // First pixel row of the bottom part
+    uint32_t split_rst;         // Restart markers before the bottom part
+    uint32_t data_pos;          // Bottom entropy data (once found)
+    uint32_t scan_at;           // Marker search / renumbering progress
+    uint32_t rst_seen;
+    uint32_t fixed_to;
+};
+
+// Parse the headers in the first `avail` of `size` bytes and pick a split
+// at the restart marker nearest the middle.
+int jpeg_slice_parse(JpegSlice *s, const uint8_t *data, uint32_t avail, uint32_t size);
+
+// Cut the original file down to the top part (patches its SOF in place)
+void jpeg_slice_cut_top(const JpegSlice *s, uint8_t *data);
+
+// Search the first `avail` bytes for the split marker. Resumable.
+bool jpeg_slice_find_split(JpegSlice *s, const uint8_t *data, uint32_t avail);
+
+// Bottom part as a file of its own (after jpeg_slice_find_split)
+uint32_t jpeg_slice_bottom_size(const JpegSlice *s, uint32_t size);
+
+// Offset in the original just past bottom-part byte `pos`
+uint32_t jpeg_slice_bottom_end(const JpegSlice *s, uint32_t pos);
+
+// Read bottom-part bytes [pos, pos + len). Everything up to
+// jpeg_slice_bottom_end(pos + len) must have been received.
+void jpeg_slice_bottom_read(JpegSlice *s, uint8_t *data, uint32_t pos, uint8_t *dst, uint32_t len);
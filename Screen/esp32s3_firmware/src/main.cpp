@@ -9,7 +9,28 @@
  *   Display modes (mutually exclusive):
  *     {"cmd":"face","on":true/false}          → animated face mode
  *     {"cmd":"image","len":N}                 → JPEG display (disables face)
+ *         optional "transition":"fade"|"wipe", "duration":ms (default 300),
+ *         "format":"jpeg"|"qoi" (default jpeg),
+ *         "fit":"cover" (scale / center-crop to fill the screen)
+ *     {"cmd":"tiles","len":N,"codec":"rle"} → changed 16x16 tiles only
+ *         (image, tiles, store and asset take "chunk":N for a chunked
+ *         transfer with per-chunk CRC and retransmit)
+ *     {"cmd":"store","slot":"idle","len":N}   → keep an image in the slot cache
+ *         optional "keep":"frame"|"data", "format", "fit" (as image)
+ *     {"cmd":"show","slot":"idle"}            → show a stored image
+ *         or "asset":"logo" (from flash, optional "fit");
+ *         optional "transition", "duration" (as image)
+ *     {"cmd":"evict","slot":"idle"}           → drop one slot (no slot: all)
+ *     {"cmd":"slots","budget":N}              → list slots / set the budget
+ *     {"cmd":"asset","id":"logo","len":N}     → write a flash asset (len 0: delete)
+ *         optional "format":"jpeg"|"qoi"|"rgb565"
+ *     {"cmd":"assets"}                        → list flash assets
+ *     {"cmd":"gallery","slots":[...]}         → grid of stored JPEG thumbnails
+ *         optional "cols":1-8, "bg"; "page":N turns the page
  *     {"cmd":"clear","color":"#RRGGBB"}       → fill screen with color
+ *     {"cmd":"text","text":"Hi","x":X,"y":Y}  → draw text over everything
+ *         optional "size":16-48, "color", "align":"left"|"center"|"right",
+ *         "w"/"h" (box cleared first), "bg"; "clear":true removes text
  *
  *   Face controls (while face mode is active):
  *     {"cmd":"mouth","open":0.0-1.0}          → mouth openness (lip sync)
@@ -23,6 +44,9 @@
  *
  *   Hardware:
  *     {"cmd":"bl","on":true/false}            → backlight control
+ *     {"cmd":"display","bounce":N,"reset":b}  → display stats / bounce rows
+ *     {"cmd":"screenshot"}                    → stream the screen back as QOI
+ *     {"cmd":"bench","suite":"all"}           → run on-device benchmarks
  *
  *   WiFi info:
  *     {"cmd":"wifi"}                          → returns IP/status
@@ -37,7 +61,21 @@
 #include <ArduinoJson.h>
 #include <JPEGDEC.h>
 #include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "display.h"
+#include "bench.h"
+#include "compositor.h"
+#include "qoi.h"
+#include "crc32.h"
+#include "jpeg_slice.h"
+#include "rle565.h"
+#include "slot_cache.h"
+#include "asset_pack.h"
+#include "font.h"
+#include "sprite.h"
 #include "pins.h"
 #include "face.h"
 #include "touch.h"
@@ -60,8 +98,6 @@ static unsigned long s_last_touch_event = 0;
 // Globals (PSRAM-backed)
 // ============================================================================
 
-static uint8_t  *jpeg_buf   = NULL;   // Incoming JPEG data
-static uint16_t *decode_buf = NULL;   // Decoded 480x480 RGB565 frame
 static JPEGDEC   jpeg;
 
 // WiFi TCP server
@@ -72,148 +108,2570 @@ static bool s_wifi_ok = false;
 //   0 = Serial (USB), 1 = WiFi TCP
 static int s_cmd_source = 0;
 
+// Chunk size its payload is split into ("chunk":N, 0 = plain bytes)
+static uint32_t s_cmd_chunk = 0;
+
+// ============================================================================
+// Dual Output Helpers (Serial + WiFi)
+// ============================================================================
+
+static void dualPrintln(const char* str) {
+    Serial.println(str);
+    wifi.println(str);
+}
+
+static void dualPrintf(const char* fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n < 0) return;
+    if (n >= (int)sizeof(buf)) n = sizeof(buf) - 1;  // Truncated
+    Serial.write((const uint8_t*)buf, n);
+    if (wifi.connected && wifi.client.connected()) {
+        wifi.client.write((const uint8_t*)buf, n);
+    }
+}
+
+// Raw bytes to the transport that sent the current command only
+// (binary payloads must not end up on the other link)
+static void sourceWrite(int source, const uint8_t *data, size_t len) {
+    if (source == 1) {
+        if (wifi.connected && wifi.client.connected()) wifi.client.write(data, len);
+    } else {
+        Serial.write(data, len);
+    }
+}
+
+static void sourcePrintf(int source, const char* fmt, ...) {
+    char buf[128];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n < 0) return;
+    if (n >= (int)sizeof(buf)) n = sizeof(buf) - 1;  // Truncated
+    sourceWrite(source, (const uint8_t*)buf, n);
+}
+
+// ============================================================================
+// JPEG Streaming Decode
+// ============================================================================
+// Receiving and decoding run on different tasks with two receive
+// buffers: loop() streams frame N+1 into one while the decode task is
+// still drawing frame N from the other. JPEGDEC reads the file through
+// callbacks, so a frame starts decoding as soon as its header is in;
+// bytes land in the buffer in order (the decoder may seek, so the whole
+// file stays addressable) and a read only blocks until the range it
+// asks for has been received.
+//
+// While a frame is queued or decoding the decode task owns the
+// compositor; every other command waits for it first.
+//
+// A baseline JPEG with restart markers is split at the marker nearest
+// the middle (see jpeg_slice.h): the decode task draws the top half while
+// the slice task, on the other core with its own JPEGDEC, draws the
+// bottom half. Draws from the two are serialized; anything else decodes
+// whole on the decode task.
+//
+// QOI frames (lossless, for UI content) are decoded here too, a band
+// of rows at a time straight from the receive buffer; they are never
+// sliced.
+//
+// With "fit":"cover" a frame of any size fills the screen: a JPEG is
+// decoded at the smallest of 1, 1/2, 1/4 or 1/8 scale that still covers
+// it (JPEGDEC scales for free while decoding), one smaller than the
+// screen is doubled, and the result is centered, cropping the overhang.
+// Blocks are placed (and doubled) as they are drawn.
+//
+// Frame sprites (see sprite.h) are blended into each block just before
+// it is drawn, so they ride on every frame without costing the direct
+// path.
+//
+// A queued frame the decoder has not picked up yet can be taken back by
+// the receiver and overwritten with a newer one (stream mode, when it
+// falls behind); `ready` tells the decoder whether the queue entry still
+// holds a frame to draw.
+
+#define RX_BUFS              2
+#define RX_FIRST_BYTE_MS     30000  // Wait for the transfer to start
+#define RX_STALL_MS          5000   // Max gap between bytes once started
+#define DECODE_IDLE_MS       10000  // Longest a command waits for the decoder
+#define PROGRESSIVE_FLUSH_MS 20     // Min interval between partial presents
+#define QOI_BAND_ROWS        16     // Rows per QOI draw
+#define ZOOM_ROWS            8      // Source rows per 2x upscaled draw
+
+#define DECODE_TASK_STACK    8192
+#define DECODE_TASK_PRIO     1
+#define DECODE_TASK_CORE     0      // loop() receives on core 1
+#define SLICE_TASK_CORE      1      // Bottom half of sliced frames
+
+enum ImageFormat {
+    IMG_JPEG,
+    IMG_QOI,
+};
+
+struct RxBuf {
+    uint8_t *data;              // mem, or a mapped flash asset
+    uint8_t *mem;               // Own receive buffer (PSRAM)
+    uint32_t len;
+    ImageFormat format;
+    bool cover;                 // Scale / crop to fill the screen
+    uint16_t *target;           // Decode here instead of to the screen
+    bool readonly;              // data must not be patched (no slicing)
+    const char *err;            // Decode result, once busy clears
+    volatile uint32_t received; // Bytes in data so far
+    volatile bool done;         // Receiver finished (complete or stalled)
+    volatile bool busy;         // Queued or being decoded
+    bool queued;                // Has an entry in the decode queue
+    bool ready;                 // Submitted and not taken back
+    CompTransition trans;
+    uint32_t trans_ms;
+    bool has_ts;                // host_ts is valid (stream frames)
+    uint32_t host_ts;           // Host capture time, host ms
+    unsigned long rx_ms;        // When its header / command came in
+};
+static RxBuf s_rxbuf[RX_BUFS];
+static int   s_rx_next = 0;
+static portMUX_TYPE s_rx_mux = portMUX_INITIALIZER_UNLOCKED;  // queued/ready
+
+// Last frame the decoder put on screen, for stream latency stats
+struct ShownFrame {
+    uint32_t count;
+    bool has_ts;
+    uint32_t host_ts;
+    unsigned long rx_ms;
+    unsigned long at_ms;
+};
+static ShownFrame s_shown;      // Guarded by s_rx_mux
+
+static QueueHandle_t s_decode_queue = NULL;
+static TaskHandle_t  s_decode_task  = NULL;
+static const char *volatile s_decode_err = NULL;  // Reported by loop()
+
+// Bottom half of a sliced frame, handed to the slice task
+struct SliceJob {
+    RxBuf *buf;
+    JpegSlice slice;
+    volatile bool busy;
+    const char *volatile err;
+};
+static SliceJob      s_slice;
+static JPEGDEC      *s_slice_jpeg = NULL;
+static TaskHandle_t  s_slice_task = NULL;
+static SemaphoreHandle_t s_draw_lock = NULL;
+
+static uint16_t *s_qoi_band = NULL;     // QOI_BAND_ROWS rows, decode task
+static uint16_t *s_zoom_strip = NULL;   // 2 * ZOOM_ROWS upscaled rows
+
+// Decode task state for the frame being drawn
+struct DecodeState {
+    RxBuf *buf;
+    bool sliced;                // Slice task draws too
+    bool direct;                // Blocks go straight to the screen
+    uint16_t *layer;            // Otherwise: compositor image layer
+    bool progressive;           // Present layer rows as they land
+    unsigned long last_flush;
+    int shift;                  // JPEG decoded at 1 / (1 << shift)
+    int zoom;                   // 1, or 2 to double decoded pixels
+    int ox, oy;                 // Screen position of decoded (0, 0)
+    bool sprites;               // Blend frame sprites into each block
+};
+static DecodeState s_dec;
+
+// Image layer holds the picture currently on screen (rows decoded over it
+// can be shown right away without exposing stale content)
+static bool s_image_shown = false;
+
+static bool imageBusy() {
+    for (int i = 0; i < RX_BUFS; i++) {
+        if (s_rxbuf[i].busy) return true;
+    }
+    return false;
+}
+
+// Wait for the decoder to finish every frame; false if it is still busy
+// after DECODE_IDLE_MS (stuck on a frame whose bytes never come)
+static bool imageWaitIdle() {
+    unsigned long t0 = millis();
+    while (imageBusy()) {
+        if (millis() - t0 >= DECODE_IDLE_MS) return false;
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+// Same for a single buffer
+static bool rxWaitFree(RxBuf &b) {
+    unsigned long t0 = millis();
+    while (b.busy) {
+        if (millis() - t0 >= DECODE_IDLE_MS) return false;
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+// Decode side: block until the first `upto` bytes are in; false if the
+// transfer ended short
+static bool rxWait(RxBuf &b, uint32_t upto) {
+    if (upto > b.len) upto = b.len;
+    while (b.received < upto) {
+        if (b.done) return b.received >= upto;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+    }
+    return true;
+}
+
+static int32_t jpegReadCB(JPEGFILE *pFile, uint8_t *pBuf, int32_t iLen) {
+    RxBuf &b = *s_dec.buf;
+    int32_t n = pFile->iSize - pFile->iPos;
+    if (iLen < n) n = iLen;
+    if (n <= 0) return 0;
+    if (!rxWait(b, pFile->iPos + n)) {
+        n = (int32_t)b.received - pFile->iPos;  // Short read ends the decode
+        if (n <= 0) return 0;
+    }
+    memcpy(pBuf, b.data + pFile->iPos, n);
+    pFile->iPos += n;
+    return n;
+}
+
+static int32_t jpegSeekCB(JPEGFILE *pFile, int32_t iPosition) {
+    if (iPosition < 0 || iPosition > pFile->iSize) return -1;
+    pFile->iPos = iPosition;
+    return iPosition;
+}
+
+// Put a block of pixels (stride = w) on screen, clipped to it, with the
+// sprites blended in
+static void drawOut(int x, int y, int w, int h, uint16_t *pixels) {
+    if (s_dec.sprites) sprite_blend(x, y, w, h, pixels);
+    if (s_dec.direct) {
+        compositor_direct_draw(x, y, w, h, pixels);
+        return;
+    }
+    int stride = w;
+    if (x < 0) { pixels -= x; w += x; x = 0; }
+    if (y < 0) { pixels -= y * stride; h += y; y = 0; }
+    if (x + w > LCD_H_RES) w = LCD_H_RES - x;
+    if (y + h > LCD_V_RES) h = LCD_V_RES - y;
+    if (w <= 0 || h <= 0) return;
+    for (int i = 0; i < h; i++) {
+        memcpy(&s_dec.layer[(y + i) * LCD_H_RES + x], &pixels[i * stride], w * sizeof(uint16_t));
+    }
+    if (s_dec.progressive) {
+        compositor_damage(x, y, w, h);
+        if (millis() - s_dec.last_flush >= PROGRESSIVE_FLUSH_MS) {
+            compositor_flush();
+            s_dec.last_flush = millis();
+        }
+    }
+}
+
+// Draw a decoded block of pixels (stride = width) where it lands on screen
+static void drawBlock(int x, int y, int width, int height, uint16_t *pixels) {
+    if (s_dec.zoom == 1) {
+        drawOut(x + s_dec.ox, y + s_dec.oy, width, height, pixels);
+        return;
+    }
+
+    // Doubled: only the columns that land on screen, ZOOM_ROWS at a time
+    int ox = s_dec.ox + x * 2;
+    int oy = s_dec.oy + y * 2;
+    int i0 = ox < 0 ? -ox / 2 : 0;
+    int i1 = min(width, (LCD_H_RES - ox + 1) / 2);
+    int n = i1 - i0;
+    if (n <= 0) return;
+    for (int r0 = 0; r0 < height; r0 += ZOOM_ROWS) {
+        int rows = min(ZOOM_ROWS, height - r0);
+        int y0 = oy + r0 * 2;
+        if (y0 >= LCD_V_RES) break;
+        if (y0 + rows * 2 <= 0) continue;
+        for (int r = 0; r < rows; r++) {
+            const uint16_t *src = pixels + (r0 + r) * width + i0;
+            uint16_t *dst = s_zoom_strip + r * 4 * n;
+            for (int i = 0; i < n; i++) dst[i * 2] = dst[i * 2 + 1] = src[i];
+            memcpy(dst + n * 2, dst, n * 2 * sizeof(uint16_t));
+        }
+        drawOut(ox + i0 * 2, y0, n * 2, rows * 2, s_zoom_strip);
+    }
+}
+
+static int jpegDrawCB(JPEGDRAW *pDraw) {
+    if (!s_dec.sliced) {
+        drawBlock(pDraw->x, pDraw->y, pDraw->iWidth, pDraw->iHeight, pDraw->pPixels);
+        return 1;
+    }
+    xSemaphoreTake(s_draw_lock, portMAX_DELAY);
+    drawBlock(pDraw->x, pDraw->y, pDraw->iWidth, pDraw->iHeight, pDraw->pPixels);
+    xSemaphoreGive(s_draw_lock);
+    return 1;
+}
+
+// Slice task: the bottom part as a file of its own
+static int32_t sliceReadCB(JPEGFILE *pFile, uint8_t *pBuf, int32_t iLen) {
+    RxBuf &b = *s_slice.buf;
+    int32_t n = pFile->iSize - pFile->iPos;
+    if (iLen < n) n = iLen;
+    if (n <= 0) return 0;
+    if (!rxWait(b, jpeg_slice_bottom_end(&s_slice.slice, pFile->iPos + n))) return 0;
+    jpeg_slice_bottom_read(&s_slice.slice, b.data, pFile->iPos, pBuf, n);
+    pFile->iPos += n;
+    return n;
+}
+
+// Split a frame with restart markers; false to decode it whole. Waits
+// for the headers.
+static bool slicePlan(RxBuf &b, JpegSlice &sl) {
+    if (!s_slice_task || b.readonly) return false;
+    for (;;) {
+        bool end = b.done;
+        uint32_t avail = b.received;
+        int r = jpeg_slice_parse(&sl, b.data, avail, b.len);
+        if (r != JPEG_SLICE_MORE) return r == JPEG_SLICE_OK;
+        if (end) return false;
+        rxWait(b, avail + 1);
+    }
+}
+
+// JPEGDEC decode() option for 1 / (1 << shift)
+static int jpegScale(int shift) {
+    static const int opts[] = { 0, JPEG_SCALE_HALF, JPEG_SCALE_QUARTER, JPEG_SCALE_EIGHTH };
+    return opts[shift];
+}
+
+static const char *decodeSlice() {
+    RxBuf &b = *s_slice.buf;
+    JpegSlice &sl = s_slice.slice;
+
+    // The bottom half starts after the split marker
+    for (;;) {
+        bool end = b.done;
+        uint32_t avail = b.received;
+        if (jpeg_slice_find_split(&sl, b.data, avail)) break;
+        if (end || avail >= b.len) return "jpeg decode fail";
+        rxWait(b, avail + 1);
+    }
+
+    JPEGDEC &dec = *s_slice_jpeg;
+    if (!dec.open(&s_slice, jpeg_slice_bottom_size(&sl, b.len), NULL,
+                  sliceReadCB, jpegSeekCB, jpegDrawCB)) {
+        return "jpeg open fail";
+    }
+    dec.setPixelType(RGB565_LITTLE_ENDIAN);
+    bool ok = dec.decode(0, sl.split_y >> s_dec.shift, jpegScale(s_dec.shift));
+    dec.close();
+    return ok ? NULL : "jpeg decode fail";
+}
+
+static void sliceTask(void *arg) {
+    for (;;) {
+        // Also woken by rxAppend(); only a handed-over job counts
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!s_slice.busy) continue;
+        s_slice.err = decodeSlice();
+        s_slice.busy = false;
+        xTaskNotifyGive(s_decode_task);
+    }
+}
+
+// Choose how a width x height frame (as decoded) reaches the screen, or
+// the buffer's own target frame. "cover" frames are doubled if smaller
+// than the screen and centered. A full-screen
+// image with nothing over it and no transition is drawn straight to the
+// screen. Otherwise it goes through the image layer: smaller images are
+// padded with black, and over a shown image rows can still be presented
+// as they are decoded.
+static const char *decodeBegin(RxBuf &b, int width, int height) {
+    s_dec.zoom = 1;
+    s_dec.ox = 0;
+    s_dec.oy = 0;
+    if (b.cover) {
+        if (width < LCD_H_RES || height < LCD_V_RES) {
+            if (!s_zoom_strip) {
+                s_zoom_strip = (uint16_t *)heap_caps_malloc(ZOOM_ROWS * 2 * (LCD_H_RES + 2) * sizeof(uint16_t),
+                                                            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+                if (!s_zoom_strip) return "no memory";
+            }
+            s_dec.zoom = 2;
+            width *= 2;
+            height *= 2;
+        }
+        s_dec.ox = (LCD_H_RES - width) / 2;
+        s_dec.oy = (LCD_V_RES - height) / 2;
+    }
+    bool covers = width >= LCD_H_RES && height >= LCD_V_RES;
+    bool screen = !b.target;
+    bool direct = screen && covers && b.trans == TRANS_NONE && compositor_begin_direct(LAYER_IMAGE);
+    if (!direct) {
+        s_dec.layer = screen ? compositor_layer(LAYER_IMAGE) : b.target;
+        if (!s_dec.layer) return "no memory";
+        if (!covers) memset(s_dec.layer, 0, FRAME_BYTES);
+    }
+    s_dec.direct = direct;
+    s_dec.sprites = screen && sprite_count() > 0;
+    s_dec.progressive = screen && !direct && covers && s_image_shown && b.trans == TRANS_NONE;
+    s_dec.last_flush = millis();
+    return NULL;
+}
+
+static const char *decodeJpeg(RxBuf &b) {
+    // With restart markers this task only decodes the top half
+    JpegSlice &sl = s_slice.slice;
+    bool sliced = slicePlan(b, sl);
+    if (sliced) jpeg_slice_cut_top(&sl, b.data);
+    if (!jpeg.open(&b, b.len, NULL, jpegReadCB, jpegSeekCB, jpegDrawCB)) {
+        return "jpeg open fail";
+    }
+    jpeg.setPixelType(RGB565_LITTLE_ENDIAN);
+    int width = jpeg.getWidth();
+    int height = sliced ? sl.height : jpeg.getHeight();
+
+    // Cover: the smallest scale that still fills the screen
+    int shift = 0;
+    while (b.cover && shift < 3 &&
+           (width >> (shift + 1)) >= LCD_H_RES && (height >> (shift + 1)) >= LCD_V_RES) {
+        shift++;
+    }
+    s_dec.shift = shift;
+    int part = (1 << shift) - 1;    // Partial blocks still produce a pixel
+    const char *err = decodeBegin(b, (width + part) >> shift, (height + part) >> shift);
+    if (err) {
+        jpeg.close();
+        return err;
+    }
+
+    if (sliced) {
+        s_slice.buf = &b;
+        s_slice.err = NULL;
+        s_dec.sliced = true;
+        s_slice.busy = true;
+        xTaskNotifyGive(s_slice_task);
+    }
+    bool ok = jpeg.decode(0, 0, jpegScale(shift));
+    jpeg.close();
+    if (sliced) {
+        while (s_slice.busy) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        if (ok && s_slice.err) return s_slice.err;
+    }
+    return ok ? NULL : "jpeg decode fail";
+}
+
+// Decode the next n QOI pixels into dst (NULL: discard them), waiting for
+// bytes as needed. False if the data ends first.
+static bool qoiRead(RxBuf &b, QoiDecoder &q, size_t &pos, uint16_t *dst, uint32_t n) {
+    uint16_t scrap[64];
+    while (n) {
+        int want = dst ? n : min(n, (uint32_t)64);
+        uint32_t avail = b.received;
+        int got = qoi_decode_rgb565(&q, b.data, avail, &pos, dst ? dst : scrap, want);
+        n -= got;
+        if (dst) dst += got;
+        if (got < want && (avail >= b.len || !rxWait(b, avail + 1))) return false;
+    }
+    return true;
+}
+
+static const char *decodeQoi(RxBuf &b) {
+    if (!s_qoi_band) {
+        s_qoi_band = (uint16_t *)heap_caps_malloc(QOI_BAND_ROWS * LCD_H_RES * sizeof(uint16_t),
+                                                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!s_qoi_band) return "no memory";
+    }
+    QoiDecoder q;
+    if (!rxWait(b, QOI_HEADER_SIZE) || !qoi_decode_begin(&q, b.data)) return "qoi open fail";
+    if (q.width > 0xFFFF || q.height > 0xFFFF) return "qoi open fail";
+    s_dec.shift = 0;
+    const char *err = decodeBegin(b, q.width, q.height);
+    if (err) return err;
+
+    // Only the columns [c0, c1) and rows that land on screen are kept;
+    // the rest is decoded and dropped
+    int z = s_dec.zoom;
+    uint32_t c0 = s_dec.ox < 0 ? -s_dec.ox / z : 0;
+    uint32_t c1 = min(q.width, (uint32_t)((LCD_H_RES - s_dec.ox + z - 1) / z));
+    uint32_t rows = min(q.height, (uint32_t)((LCD_V_RES - s_dec.oy + z - 1) / z));
+    uint32_t w = c1 - c0;
+    size_t pos = QOI_HEADER_SIZE;
+    for (uint32_t y = 0; y < rows; y += QOI_BAND_ROWS) {
+        uint32_t h = min(rows - y, (uint32_t)QOI_BAND_ROWS);
+        for (uint32_t i = 0; i < h; i++) {
+            if (!qoiRead(b, q, pos, NULL, c0) ||
+                !qoiRead(b, q, pos, s_qoi_band + i * w, w) ||
+                !qoiRead(b, q, pos, NULL, q.width - c1)) {
+                return "qoi decode fail";
+            }
+        }
+        drawBlock(c0, y, w, h, s_qoi_band);
+    }
+    return NULL;
+}
+
+// Decode one frame and put it on screen. Returns an error or NULL.
+static const char *decodeImage(RxBuf &b) {
+    s_dec.buf = &b;
+    s_dec.sliced = false;
+    s_dec.direct = false;
+    s_dec.progressive = false;
+
+    const char *err = b.format == IMG_QOI ? decodeQoi(b) : decodeJpeg(b);
+    bool direct = s_dec.direct;
+    bool progressive = s_dec.progressive;
+    s_dec.sliced = false;
+    s_dec.direct = false;
+    s_dec.progressive = false;
+    if (err) return err;
+    if (b.target) return NULL;
+
+    // Recomposite the background layer; the push overlaps the next frame.
+    // A transition starts from what is still on screen and is advanced by
+    // compositor_update() in loop(). Direct and progressive decodes have
+    // already pushed what they drew; the flush only settles the rest.
+    if (!direct && !progressive) compositor_set_buffered(LAYER_IMAGE);
+    compositor_begin_transition(b.trans, b.trans_ms);
+    compositor_flush();
+    s_image_shown = true;
+    return NULL;
+}
+
+static void decodeTask(void *arg) {
+    for (;;) {
+        int idx;
+        if (xQueueReceive(s_decode_queue, &idx, portMAX_DELAY) != pdTRUE) continue;
+        RxBuf &b = s_rxbuf[idx];
+
+        // The receiver may have taken the frame back; it queues it again
+        // once it holds a new one
+        portENTER_CRITICAL(&s_rx_mux);
+        bool take = b.ready;
+        b.queued = false;
+        b.ready = false;
+        portEXIT_CRITICAL(&s_rx_mux);
+        if (!take) continue;
+
+        const char *err = decodeImage(b);
+
+        // Let the receiver finish with the buffer; a short transfer was
+        // already reported by handleImage()
+        while (!b.done) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        b.err = err;
+        if (err && !b.target && b.received == b.len) s_decode_err = err;
+        if (!err && !b.target) {
+            portENTER_CRITICAL(&s_rx_mux);
+            s_shown.count++;
+            s_shown.has_ts = b.has_ts;
+            s_shown.host_ts = b.host_ts;
+            s_shown.rx_ms = b.rx_ms;
+            s_shown.at_ms = millis();
+            portEXIT_CRITICAL(&s_rx_mux);
+        }
+        b.busy = false;
+    }
+}
+
+static bool decodeInit() {
+    for (int i = 0; i < RX_BUFS; i++) {
+        s_rxbuf[i].mem = (uint8_t *)heap_caps_malloc(MAX_JPEG_SIZE, MALLOC_CAP_SPIRAM);
+        if (!s_rxbuf[i].mem) return false;
+        s_rxbuf[i].data = s_rxbuf[i].mem;
+        s_rxbuf[i].busy = false;
+        s_rxbuf[i].queued = false;
+        s_rxbuf[i].ready = false;
+    }
+    s_decode_queue = xQueueCreate(RX_BUFS, sizeof(int));
+    if (!s_decode_queue) return false;
+    if (xTaskCreatePinnedToCore(decodeTask, "decode", DECODE_TASK_STACK, NULL,
+                                DECODE_TASK_PRIO, &s_decode_task, DECODE_TASK_CORE) != pdPASS) {
+        return false;
+    }
+
+    // Without the slice task every frame decodes whole
+    s_draw_lock = xSemaphoreCreateMutex();
+    s_slice_jpeg = new JPEGDEC();
+    if (s_draw_lock && s_slice_jpeg) {
+        xTaskCreatePinnedToCore(sliceTask, "slice", DECODE_TASK_STACK, NULL,
+                                DECODE_TASK_PRIO, &s_slice_task, SLICE_TASK_CORE);
+    }
+    return true;
+}
+
+static void rxReset(RxBuf &b, uint32_t len, CompTransition trans, uint32_t trans_ms) {
+    b.data = b.mem;
+    b.len = len;
+    b.format = IMG_JPEG;
+    b.cover = false;
+    b.target = NULL;
+    b.readonly = false;
+    b.err = NULL;
+    b.received = 0;
+    b.done = false;
+    b.trans = trans;
+    b.trans_ms = trans_ms;
+    b.has_ts = false;
+    b.host_ts = 0;
+    b.rx_ms = millis();
+}
+
+// Receiver side: claim the next buffer for a frame, or NULL while the
+// decoder still holds it (buffers are used round-robin)
+static RxBuf *rxClaim(uint32_t len, CompTransition trans, uint32_t trans_ms) {
+    RxBuf &b = s_rxbuf[s_rx_next];
+    if (b.busy) return NULL;
+    s_rx_next = (s_rx_next + 1) % RX_BUFS;
+
+    rxReset(b, len, trans, trans_ms);
+    b.busy = true;
+    return &b;
+}
+
+// rxClaim(), waiting up to DECODE_IDLE_MS for the decoder to free a buffer
+static RxBuf *rxClaimWait(uint32_t len, CompTransition trans, uint32_t trans_ms) {
+    unsigned long t0 = millis();
+    RxBuf *b;
+    while (!(b = rxClaim(len, trans, trans_ms))) {
+        if (millis() - t0 >= DECODE_IDLE_MS) return NULL;
+        vTaskDelay(1);
+    }
+    return b;
+}
+
+// The most recently claimed buffer (the frame after the one decoding)
+static RxBuf &rxNewest() {
+    return s_rxbuf[(s_rx_next + RX_BUFS - 1) % RX_BUFS];
+}
+
+// Take back a complete frame that is queued but not picked up yet, to
+// receive a newer one in its place. NULL if the decoder got there first.
+static RxBuf *rxReclaim(RxBuf &b, uint32_t len, CompTransition trans, uint32_t trans_ms) {
+    portENTER_CRITICAL(&s_rx_mux);
+    bool ok = b.busy && b.done && b.ready;
+    if (ok) b.ready = false;
+    portEXIT_CRITICAL(&s_rx_mux);
+    if (!ok) return NULL;
+    rxReset(b, len, trans, trans_ms);
+    return &b;
+}
+
+// Queue a claimed buffer for decoding (before or after its bytes are in)
+static void rxSubmit(RxBuf &b) {
+    portENTER_CRITICAL(&s_rx_mux);
+    bool send = !b.queued;      // A taken-back frame keeps its entry
+    b.queued = true;
+    b.ready = true;
+    portEXIT_CRITICAL(&s_rx_mux);
+    if (!send) return;
+    int idx = &b - s_rxbuf;
+    xQueueSend(s_decode_queue, &idx, portMAX_DELAY);
+}
+
+// Whatever the transport has buffered, up to want bytes
+static size_t linkRead(int source, uint8_t *dst, size_t want) {
+    int avail = (source == 1) ? wifi.availableBytes() : Serial.available();
+    if (avail <= 0) return 0;
+    if ((size_t)avail < want) want = avail;
+    return (source == 1) ? wifi.readBytes(dst, want) : Serial.readBytes(dst, want);
+}
+
+static void rxWake() {
+    xTaskNotifyGive(s_decode_task);
+    if (s_slice_task) xTaskNotifyGive(s_slice_task);
+}
+
+static void rxAppend(RxBuf &b, size_t got) {
+    b.received += got;
+    rxWake();
+}
+
+// Receiver is done with the buffer (complete or not)
+static void rxFinish(RxBuf &b) {
+    b.done = true;
+    rxWake();
+}
+
+// ============================================================================
+// RP2040 Communication (buzzer)
+// ============================================================================
+
+static void rp2040_tone(int freq, int dur) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "TONE %d %d\n", freq, dur);
+    Serial1.print(buf);
+}
+
+static void rp2040_melody(const char *notes) {
+    Serial1.print("MELODY ");
+    Serial1.println(notes);
+}
+
+static void rp2040_stop() {
+    Serial1.println("STOP");
+}
+
+// ============================================================================
+// Color Helpers
+// ============================================================================
+
+static uint16_t hexToRGB565(const char *hex) {
+    if (hex[0] == '#') hex++;
+    uint32_t rgb = strtoul(hex, NULL, 16);
+    uint8_t r = (rgb >> 16) & 0xFF;
+    uint8_t g = (rgb >>  8) & 0xFF;
+    uint8_t b =  rgb        & 0xFF;
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+// ============================================================================
+// Image Handler
+// ============================================================================
+
+static CompTransition parseTransition(const char *name) {
+    if (!name) return TRANS_NONE;
+    if (strcmp(name, "fade") == 0) return TRANS_FADE;
+    if (strcmp(name, "wipe") == 0) return TRANS_WIPE;
+    return TRANS_NONE;
+}
+
+// Chunked transfer: with "chunk":N on a command that carries a payload
+// (image, store, tiles, asset) the payload is cut into N-byte chunks
+// (the last one shorter), each sent as
+//   "SCCH" | u16 seq (LE) | u16 size (LE) | size bytes | u32 CRC-32 (LE)
+// with the CRC over seq, size and the bytes. Good chunks are written in
+// place; a damaged or lost one is only noted. Once a round is over (as
+// many chunks came by as were asked for, or the link went quiet) the
+// device replies {"status":"nack","chunks":[...]} with the missing ones,
+// and the host sends just those. When all are in the command carries on
+// as after a plain transfer. The decoder sees the contiguous prefix, so
+// an image still decodes while it arrives.
+
+#define CHUNK_MAGIC       "SCCH"
+#define CHUNK_HDR_SIZE    8
+#define CHUNK_MIN         256
+#define CHUNK_MAX         32768
+#define CHUNK_GAP_MS      250       // Quiet link ends a round
+#define CHUNK_NACK_MS     1000      // Wait for the resend after a nack
+#define CHUNK_ROUNDS      8         // Retransmit rounds before giving up
+
+static uint8_t s_chunk_have[MAX_JPEG_SIZE / CHUNK_MIN / 8];
+
+static bool chunkHave(uint32_t seq) {
+    return s_chunk_have[seq / 8] & (1 << (seq % 8));
+}
+
+// Read exactly n bytes (dst NULL: discard them), adding them to *crc
+// if given. False if the link is quiet for timeout_ms first.
+static bool chunkRead(uint8_t *dst, uint32_t n, uint32_t *crc, uint32_t timeout_ms) {
+    uint8_t scrap[64];
+    unsigned long deadline = millis() + timeout_ms;
+    while (n) {
+        uint8_t *p = dst ? dst : scrap;
+        size_t got = linkRead(s_cmd_source, p, dst ? n : min(n, (uint32_t)sizeof(scrap)));
+        if (got > 0) {
+            if (crc) *crc = crc32_update(*crc, p, got);
+            if (dst) dst += got;
+            n -= got;
+            deadline = millis() + CHUNK_GAP_MS;
+        } else if ((long)(millis() - deadline) >= 0) {
+            return false;
+        } else {
+            yield();
+        }
+    }
+    return true;
+}
+
+// Next chunk header, slipping a byte at a time past anything else
+static bool chunkHeader(uint8_t *hdr, uint32_t timeout_ms) {
+    if (!chunkRead(hdr, CHUNK_HDR_SIZE, NULL, timeout_ms)) return false;
+    while (memcmp(hdr, CHUNK_MAGIC, 4) != 0) {
+        memmove(hdr, hdr + 1, CHUNK_HDR_SIZE - 1);
+        if (!chunkRead(hdr + CHUNK_HDR_SIZE - 1, 1, NULL, CHUNK_GAP_MS)) return false;
+    }
+    return true;
+}
+
+static void chunkNack(uint32_t count) {
+    dualPrintf("{\"status\":\"nack\",\"chunks\":[");
+    bool first = true;
+    for (uint32_t i = 0; i < count; i++) {
+        if (chunkHave(i)) continue;
+        dualPrintf(first ? "%u" : ",%u", i);
+        first = false;
+    }
+    dualPrintln("]}");
+}
+
+static uint32_t rxReceiveChunked(RxBuf &b, uint32_t chunk) {
+    uint32_t count = (b.len + chunk - 1) / chunk;
+    uint32_t missing = count;
+    uint32_t prefix = 0;        // Chunks in order from the start
+    memset(s_chunk_have, 0, sizeof(s_chunk_have));
+
+    for (int round = 0; missing && round < CHUNK_ROUNDS; round++) {
+        if (round) chunkNack(count);
+        uint32_t expect = missing;
+        uint32_t timeout = round ? CHUNK_NACK_MS : RX_FIRST_BYTE_MS;
+        for (uint32_t seen = 0; seen < expect; seen++) {
+            uint8_t hdr[CHUNK_HDR_SIZE];
+            if (!chunkHeader(hdr, timeout)) break;
+            timeout = CHUNK_GAP_MS;
+            uint16_t seq, size;
+            memcpy(&seq, hdr + 4, 2);
+            memcpy(&size, hdr + 6, 2);
+            if (seq >= count || size != min(chunk, b.len - seq * chunk)) continue;  // Resync
+
+            // Chunks already in are read past, never over
+            bool want = !chunkHave(seq);
+            uint32_t crc = crc32_update(0, hdr + 4, 4);
+            uint32_t sent;
+            if (!chunkRead(want ? b.data + seq * chunk : NULL, size, &crc, CHUNK_GAP_MS) ||
+                !chunkRead((uint8_t *)&sent, 4, NULL, CHUNK_GAP_MS)) {
+                break;
+            }
+            if (!want || sent != crc) continue;
+
+            s_chunk_have[seq / 8] |= 1 << (seq % 8);
+            missing--;
+            if (seq != prefix) continue;
+            while (prefix < count && chunkHave(prefix)) prefix++;
+            rxAppend(b, min(prefix * chunk, b.len) - b.received);
+        }
+    }
+    uint32_t received = b.received;
+    rxFinish(b);
+    return received;
+}
+
+// Receive a claimed buffer's bytes from whichever transport sent the
+// command, then finish it. Returns the bytes received (in order from the
+// start, for a chunked transfer).
+static uint32_t rxReceive(RxBuf &b) {
+    if (s_cmd_chunk) return rxReceiveChunked(b, s_cmd_chunk);
+    unsigned long deadline = millis() + RX_FIRST_BYTE_MS;
+    while (b.received < b.len && millis() < deadline) {
+        size_t got = linkRead(s_cmd_source, b.data + b.received, b.len - b.received);
+        if (got > 0) {
+            rxAppend(b, got);
+            deadline = millis() + RX_STALL_MS;
+        }
+        yield();
+    }
+    uint32_t received = b.received;
+    rxFinish(b);
+    return received;
+}
+
+static bool parseFormat(const char *name, ImageFormat *fmt) {
+    if (strcmp(name, "jpeg") == 0) *fmt = IMG_JPEG;
+    else if (strcmp(name, "qoi") == 0) *fmt = IMG_QOI;
+    else return false;
+    return true;
+}
+
+static void handleImage(uint32_t len, CompTransition trans, uint32_t trans_ms, const char *format,
+                        bool cover) {
+    ImageFormat fmt;
+    if (!parseFormat(format, &fmt)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad format\"}");
+        return;
+    }
+    if (len == 0 || len > MAX_JPEG_SIZE) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+        return;
+    }
+    if (!s_decode_task) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no decoder\"}");
+        return;
+    }
+
+    // Take the buffer the decoder finished with longest ago
+    RxBuf *bp = rxClaimWait(len, trans, trans_ms);
+    if (!bp) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"decoder busy\"}");
+        return;
+    }
+    RxBuf &b = *bp;
+    b.format = fmt;
+    b.cover = cover;
+
+    // Signal ready
+    dualPrintln("{\"status\":\"ready\"}");
+    Serial.flush();
+    wifi.flush();
+
+    // Hand the frame over now; it decodes while the bytes arrive
+    rxSubmit(b);
+    uint32_t received = rxReceive(b);
+
+    // Acknowledge reception; decode errors follow as an image_error event
+    if (received != len) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+        return;
+    }
+    dualPrintln("{\"status\":\"ok\"}");
+}
+
+// ============================================================================
+// Tile Delta Handler
+// ============================================================================
+// {"cmd":"tiles","len":N,"codec":"rle"|"raw"} is followed, after ready, by
+// N bytes:
+//   TILE_MAP_BYTES bitmap of changed 16x16 tiles: bit i (LSB first) is
+//   tile (i % COMP_TILES_X, i / COMP_TILES_X)
+//   the pixels of those tiles in that order, each 16x16 row-major
+//   RGB565 (LE), as one raw or rle565.h stream
+// The tiles replace parts of the picture in the image layer. With nothing
+// over it they are drawn straight to the screen a run of tiles at a time;
+// otherwise they go into the layer buffer and are flushed as damage.
+
+#define TILE_MAP_BYTES  ((COMP_TILES_X * COMP_TILES_Y + 7) / 8)
+#define TILE_PIXELS     (COMP_TILE * COMP_TILE)
+
+static uint16_t *s_tile_strip = NULL;   // Run of tiles for direct draws
+
+static bool tileChanged(const uint8_t *map, int tx, int ty) {
+    int i = ty * COMP_TILES_X + tx;
+    return map[i >> 3] & (1 << (i & 7));
+}
+
+struct TileReader {
+    bool rle;
+    Rle565 r;
+    const uint8_t *src, *end;   // Raw
+};
+
+static bool tileRead(TileReader &t, uint16_t *dst, int n) {
+    if (t.rle) return rle565_read(&t.r, dst, n);
+    if (t.end - t.src < n * 2) return false;
+    memcpy(dst, t.src, n * 2);
+    t.src += n * 2;
+    return true;
+}
+
+static void handleTiles(uint32_t len, const char *codec) {
+    bool rle = strcmp(codec, "rle") == 0;
+    if (!rle && strcmp(codec, "raw") != 0) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad codec\"}");
+        return;
+    }
+    if (len < TILE_MAP_BYTES || len > MAX_JPEG_SIZE) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+        return;
+    }
+    if (!s_tile_strip) {
+        s_tile_strip = (uint16_t *)heap_caps_malloc(COMP_TILE * LCD_H_RES * sizeof(uint16_t),
+                                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    RxBuf *bp = s_decode_task ? rxClaim(len, TRANS_NONE, 0) : NULL;
+    if (!bp || !s_tile_strip) {
+        if (bp) bp->busy = false;
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    RxBuf &b = *bp;
+
+    // Updates are small; receive the whole thing (into an idle receive
+    // buffer, never queued), then apply it
+    dualPrintln("{\"status\":\"ready\"}");
+    Serial.flush();
+    wifi.flush();
+    uint32_t received = rxReceive(b);
+    if (received != len) {
+        b.busy = false;
+        dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+        return;
+    }
+    unsigned long t0 = millis();
+
+    const uint8_t *map = b.data;
+    TileReader rd;
+    rd.rle = rle;
+    rd.src = b.data + TILE_MAP_BYTES;
+    rd.end = b.data + len;
+    rle565_begin(&rd.r, rd.src, len - TILE_MAP_BYTES);
+
+    // Without a picture to patch (face, clear) start from black
+    bool direct = s_image_shown && compositor_begin_direct(LAYER_IMAGE);
+    uint16_t *layer = NULL;
+    if (!direct) {
+        layer = compositor_layer(LAYER_IMAGE);
+        if (!layer) {
+            b.busy = false;
+            dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+            return;
+        }
+        if (!s_image_shown) {
+            memset(layer, 0, FRAME_BYTES);
+            compositor_set_buffered(LAYER_IMAGE);
+        }
+    }
+
+    int tiles = 0;
+    bool ok = true;
+    for (int ty = 0; ty < COMP_TILES_Y && ok; ty++) {
+        int tx = 0;
+        while (tx < COMP_TILES_X && ok) {
+            if (!tileChanged(map, tx, ty)) {
+                tx++;
+                continue;
+            }
+            int run = 1;
+            while (tx + run < COMP_TILES_X && tileChanged(map, tx + run, ty)) run++;
+
+            int x = tx * COMP_TILE, y = ty * COMP_TILE, w = run * COMP_TILE;
+            uint16_t *dst = direct ? s_tile_strip : &layer[y * LCD_H_RES + x];
+            int stride = direct ? w : LCD_H_RES;
+            for (int t = 0; t < run && ok; t++) {
+                for (int row = 0; row < COMP_TILE && ok; row++) {
+                    ok = tileRead(rd, dst + row * stride + t * COMP_TILE, COMP_TILE);
+                }
+            }
+            if (!ok) break;
+            if (direct) {
+                compositor_direct_draw(x, y, w, COMP_TILE, s_tile_strip);
+            } else {
+                compositor_damage(x, y, w, COMP_TILE);
+            }
+            tiles += run;
+            tx += run;
+        }
+    }
+    if (!direct) compositor_flush();
+    s_image_shown = true;
+    b.busy = false;
+
+    if (!ok) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad tile data\",\"tiles\":%d}\n", tiles);
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"tiles\":%d,\"ms\":%lu}\n", tiles, millis() - t0);
+}
+
+// ============================================================================
+// Image Slot Cache
+// ============================================================================
+// {"cmd":"store","slot":"idle","len":N} takes an image like "image" does
+// (same ready handshake, format and fit) but keeps it in a named PSRAM
+// slot instead of showing it; {"cmd":"show","slot":"idle"} puts it on
+// screen later without any transfer. "keep":"frame" (default) decodes
+// it once into a full RGB565 frame, so a show is one copy;
+// "keep":"data" keeps the compressed bytes (much smaller) and decodes
+// them on every show. See slot_cache.h for budget and eviction.
+
+// A frame left decoding when handleStore() gave up waiting; freed by the
+// next store (commands only run once the decoder is idle)
+static uint8_t *s_store_orphan = NULL;
+
+static void handleStore(const char *name, uint32_t len, const char *format, bool cover,
+                        const char *keep) {
+    ImageFormat fmt;
+    bool frame = strcmp(keep, "frame") == 0;
+    heap_caps_free(s_store_orphan);
+    s_store_orphan = NULL;
+    if (!name || !name[0] || strlen(name) >= SLOT_NAME_LEN) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad slot\"}");
+        return;
+    }
+    if (!frame && strcmp(keep, "data") != 0) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad keep\"}");
+        return;
+    }
+    if (!parseFormat(format, &fmt)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad format\"}");
+        return;
+    }
+    if (len == 0 || len > MAX_JPEG_SIZE) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+        return;
+    }
+
+    // Nothing in the cache changes until the image is in and valid, so a
+    // failed store leaves the old copy and the other slots alone. A frame
+    // decodes into a buffer of its own while it arrives and is handed
+    // to the cache once done; data is copied into its slot at the end.
+    uint32_t size = frame ? FRAME_BYTES : len;
+    RxBuf *bp = s_decode_task && size <= slot_cache_budget() ? rxClaim(len, TRANS_NONE, 0) : NULL;
+    uint8_t *pixels = bp && frame ? (uint8_t *)heap_caps_malloc(FRAME_BYTES, MALLOC_CAP_SPIRAM) : NULL;
+    if (!bp || (frame && !pixels)) {
+        if (bp) bp->busy = false;
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    RxBuf &b = *bp;
+    b.format = fmt;
+    b.cover = cover;
+
+    dualPrintln("{\"status\":\"ready\"}");
+    Serial.flush();
+    wifi.flush();
+    if (frame) {
+        b.target = (uint16_t *)pixels;
+        rxSubmit(b);
+    }
+    uint32_t received = rxReceive(b);
+    const char *err = NULL;
+    if (frame) {
+        if (!rxWaitFree(b)) {
+            s_store_orphan = pixels;    // Still being written
+            dualPrintln("{\"status\":\"error\",\"msg\":\"decoder busy\"}");
+            return;
+        }
+        err = b.err;
+    } else {
+        bool magic = fmt == IMG_QOI ? len >= QOI_HEADER_SIZE && memcmp(b.data, "qoif", 4) == 0
+                                    : len >= 2 && b.data[0] == 0xFF && b.data[1] == 0xD8;
+        if (!magic) err = fmt == IMG_QOI ? "qoi open fail" : "jpeg open fail";
+    }
+
+    if (received != len || err) {
+        heap_caps_free(pixels);
+        b.busy = false;
+        if (received != len) {
+            dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+        } else {
+            dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        }
+        return;
+    }
+
+    int evicted = 0;
+    Slot *slot = frame ? slot_cache_adopt(name, pixels, size, &evicted)
+                       : slot_cache_alloc(name, size, &evicted);
+    if (!slot) {
+        heap_caps_free(pixels);
+        b.busy = false;
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    if (!frame) {
+        memcpy(slot->data, b.data, len);
+        slot->format = fmt;
+        slot->cover = cover;
+    }
+    slot->frame = frame;
+    b.busy = false;
+    dualPrintf("{\"status\":\"ok\",\"slot\":\"%s\",\"bytes\":%u,\"evicted\":%d,\"used\":%u,\"budget\":%u}\n",
+               name, size, evicted, (uint32_t)slot_cache_used(), (uint32_t)slot_cache_budget());
+}
+
+// Put a full RGB565 frame on screen (PSRAM or mapped flash)
+static bool showFrame(const uint16_t *frame, CompTransition trans, uint32_t trans_ms) {
+    bool direct = trans == TRANS_NONE && compositor_begin_direct(LAYER_IMAGE);
+    if (direct) {
+        compositor_direct_draw(0, 0, LCD_H_RES, LCD_V_RES, frame);
+    } else {
+        uint16_t *layer = compositor_layer(LAYER_IMAGE);
+        if (!layer) return false;
+        memcpy(layer, frame, FRAME_BYTES);
+        compositor_set_buffered(LAYER_IMAGE);
+    }
+    compositor_begin_transition(trans, trans_ms);
+    compositor_flush();
+    s_image_shown = true;
+    return true;
+}
+
+// Decode stored image bytes like a freshly received image. Mapped flash
+// is decoded where it lies; anything else is copied over first. False if
+// the decoder never freed a buffer.
+static bool showEncoded(const uint8_t *data, uint32_t size, ImageFormat fmt, bool cover, bool mapped,
+                        CompTransition trans, uint32_t trans_ms) {
+    RxBuf *bp = rxClaimWait(size, trans, trans_ms);
+    if (!bp) return false;
+    RxBuf &b = *bp;
+    b.format = fmt;
+    b.cover = cover;
+    if (mapped) {
+        b.data = (uint8_t *)data;
+        b.readonly = true;
+    } else {
+        memcpy(b.data, data, size);
+    }
+    rxSubmit(b);
+    rxAppend(b, size);
+    rxFinish(b);
+    return true;
+}
+
+static void handleShow(const char *name, CompTransition trans, uint32_t trans_ms) {
+    unsigned long t0 = millis();
+    Slot *slot = name ? slot_cache_find(name) : NULL;
+    if (!slot) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no slot\"}");
+        return;
+    }
+
+    if (!slot->frame) {
+        if (!showEncoded(slot->data, slot->size, (ImageFormat)slot->format, slot->cover, false,
+                         trans, trans_ms)) {
+            dualPrintln("{\"status\":\"error\",\"msg\":\"decoder busy\"}");
+            return;
+        }
+    } else if (!showFrame((const uint16_t *)slot->data, trans, trans_ms)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"ms\":%lu}\n", millis() - t0);
+}
+
+static void handleEvict(const char *name) {
+    if (!name) {
+        slot_cache_clear();
+    } else if (!slot_cache_evict(name)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no slot\"}");
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"used\":%u}\n", (uint32_t)slot_cache_used());
+}
+
+static void handleSlots() {
+    dualPrintf("{\"status\":\"ok\",\"budget\":%u,\"used\":%u,\"slots\":[",
+               (uint32_t)slot_cache_budget(), (uint32_t)slot_cache_used());
+    for (int i = 0; i < slot_cache_count(); i++) {
+        const Slot *s = slot_cache_at(i);
+        dualPrintf("%s{\"slot\":\"%s\",\"keep\":\"%s\",\"bytes\":%u}", i ? "," : "",
+                   s->name, s->frame ? "frame" : "data", s->size);
+    }
+    dualPrintln("]}");
+}
+
+// ============================================================================
+// Flash Assets
+// ============================================================================
+// Images baked into the "assets" flash partition (see asset_pack.h and
+// tools/pack_assets.py) are shown by name with {"cmd":"show","asset":id}
+// and never copied to RAM: an RGB565 frame is drawn straight from the
+// mapped flash, a JPEG or QOI is decoded from it (JPEGs whole, since
+// slicing patches the data in place). {"cmd":"asset","id":id,"len":N}
+// replaces or adds one asset over the link (len 0 deletes it). An asset
+// named "splash" is shown at boot instead of the face.
+
+#define ASSET_SPLASH  "splash"
+
+static const char *const ASSET_FORMAT_NAMES[] = { "jpeg", "qoi", "rgb565" };
+
+static bool parseAssetFormat(const char *name, AssetFormat *fmt) {
+    for (int i = 0; i < 3; i++) {
+        if (strcmp(name, ASSET_FORMAT_NAMES[i]) == 0) {
+            *fmt = (AssetFormat)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// NULL once shown, else the error message
+static const char *showAsset(const AssetEntry *e, bool cover, CompTransition trans, uint32_t trans_ms) {
+    const uint8_t *data = asset_data(e);
+    if (e->format == ASSET_RGB565) {
+        bool ok = e->size == FRAME_BYTES && showFrame((const uint16_t *)data, trans, trans_ms);
+        return ok ? NULL : "bad asset";
+    }
+    if (!showEncoded(data, e->size, e->format == ASSET_QOI ? IMG_QOI : IMG_JPEG, cover, true,
+                     trans, trans_ms)) {
+        return "decoder busy";
+    }
+    return NULL;
+}
+
+static void handleShowAsset(const char *name, bool cover, CompTransition trans, uint32_t trans_ms) {
+    unsigned long t0 = millis();
+    const AssetEntry *e = asset_find(name);
+    if (!e) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no asset\"}");
+        return;
+    }
+    const char *err = showAsset(e, cover, trans, trans_ms);
+    if (err) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"ms\":%lu}\n", millis() - t0);
+}
+
+static void handleAsset(const char *name, uint32_t len, const char *format) {
+    AssetFormat fmt;
+    if (!name || !name[0] || strlen(name) >= ASSET_NAME_LEN) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad asset\"}");
+        return;
+    }
+    if (len == 0) {
+        const char *err = asset_delete(name);
+        if (err) dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        else dualPrintf("{\"status\":\"ok\",\"free\":%u}\n", asset_pack_free());
+        return;
+    }
+    if (!parseAssetFormat(format, &fmt)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad format\"}");
+        return;
+    }
+    if (len > MAX_JPEG_SIZE || (fmt == ASSET_RGB565 && len != FRAME_BYTES)) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+        return;
+    }
+    if (!asset_pack_size()) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no asset partition\"}");
+        return;
+    }
+    RxBuf *bp = s_decode_task ? rxClaim(len, TRANS_NONE, 0) : NULL;
+    if (!bp) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    RxBuf &b = *bp;
+
+    // Received whole into an idle receive buffer, then written to flash
+    // (erasing takes a while; the reply comes once it is verified)
+    dualPrintln("{\"status\":\"ready\"}");
+    Serial.flush();
+    wifi.flush();
+    uint32_t received = rxReceive(b);
+    if (received != len) {
+        b.busy = false;
+        dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+        return;
+    }
+    const char *err = NULL;
+    if (fmt == ASSET_JPEG && !(b.data[0] == 0xFF && b.data[1] == 0xD8)) err = "jpeg open fail";
+    if (fmt == ASSET_QOI && (len < QOI_HEADER_SIZE || memcmp(b.data, "qoif", 4) != 0)) err = "qoi open fail";
+    unsigned long t0 = millis();
+    if (!err) err = asset_write(name, fmt, b.data, len);
+    b.busy = false;
+    if (err) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"asset\":\"%s\",\"bytes\":%u,\"free\":%u,\"ms\":%lu}\n",
+               name, len, asset_pack_free(), millis() - t0);
+}
+
+static void handleAssets() {
+    if (!asset_pack_size()) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no asset partition\"}");
+        return;
+    }
+    dualPrintf("{\"status\":\"ok\",\"size\":%u,\"free\":%u,\"assets\":[",
+               asset_pack_size(), asset_pack_free());
+    for (int i = 0; i < asset_count(); i++) {
+        const AssetEntry *e = asset_at(i);
+        dualPrintf("%s{\"asset\":\"%s\",\"format\":\"%s\",\"bytes\":%u}", i ? "," : "",
+                   e->name, e->format < 3 ? ASSET_FORMAT_NAMES[e->format] : "?", e->size);
+    }
+    dualPrintln("]}");
+}
+
+// ============================================================================
+// Thumbnail Gallery
+// ============================================================================
+// {"cmd":"gallery","slots":["d1","d2",...]} lays out JPEGs the device
+// already holds (slots kept as "data", or flash assets) as a grid of
+// thumbnails, with nothing composited on the host. Without "slots" it
+// takes every JPEG slot, most recently used first. "cols" (1-8, default
+// 3 for up to 9 images, else 4) gives a cols x cols page of square cells.
+// Each JPEG is decoded at the JPEGDEC scale (1, 1/2, 1/4 or 1/8) that
+// fits its cell, straight into the image layer and centered in it; one
+// still too big at 1/8 is center-cropped. At 1/8 JPEGDEC only decodes the
+// DC coefficients.
+//
+// Cells are decoded lazily, one per loop() pass and only for the page
+// on screen, each shown as soon as it is done; commands are taken in
+// between. {"cmd":"gallery","page":N} turns the page (decoding just its
+// cells), and once a page is complete
+// {"event":"gallery","page":N,"drawn":D,"missing":M,"ms":T} reports it
+// (missing: evicted since, or not decodable). Touching a cell sends
+// {"event":"gallery_tap","slot":...,"index":I}. Anything else that puts
+// a picture up (image, show, stream, clear, face...) ends the gallery.
+
+#define GALLERY_MAX   32
+
+struct Gallery {
+    bool shown;                 // The image layer holds the gallery
+    char names[GALLERY_MAX][SLOT_NAME_LEN];
+    int count;
+    int cols;
+    int cell;                   // Cell size, px
+    int x0, y0;                 // Top-left of the grid
+    uint16_t bg;
+    int page;
+    bool filling;               // Page has cells left to decode
+    int next;                   // Next cell of the page
+    int drawn, missing;
+    unsigned long start_ms;
+    uint16_t *layer;
+    int cx, cy;                 // Cell being decoded
+    int ox, oy;                 // Screen position of its decoded (0, 0)
+};
+static Gallery s_gallery;
+
+static int galleryPerPage() {
+    return s_gallery.cols * s_gallery.cols;
+}
+
+static int galleryPages() {
+    int per = galleryPerPage();
+    return (s_gallery.count + per - 1) / per;
+}
+
+// Compressed JPEG bytes of a gallery item: a slot kept as data (looked
+// up without refreshing its LRU stamp), else a flash asset. False if
+// there is none by that name (any more).
+static bool galleryItem(const char *name, const uint8_t **data, uint32_t *size) {
+    for (int i = 0; i < slot_cache_count(); i++) {
+        const Slot *s = slot_cache_at(i);
+        if (strcmp(s->name, name) != 0) continue;
+        if (s->frame || s->format != IMG_JPEG) return false;
+        *data = s->data;
+        *size = s->size;
+        return true;
+    }
+    const AssetEntry *e = asset_find(name);
+    if (!e || e->format != ASSET_JPEG) return false;
+    *data = asset_data(e);
+    *size = e->size;
+    return true;
+}
+
+// Copy the part of a decoded block that lands in the cell
+static int galleryDrawCB(JPEGDRAW *pDraw) {
+    Gallery &g = s_gallery;
+    int bx = g.ox + pDraw->x, by = g.oy + pDraw->y;
+    int x0 = max(bx, g.cx), x1 = min(bx + pDraw->iWidth, g.cx + g.cell);
+    int y0 = max(by, g.cy), y1 = min(by + pDraw->iHeight, g.cy + g.cell);
+    for (int y = y0; y < y1 && x0 < x1; y++) {
+        memcpy(&g.layer[y * LCD_H_RES + x0], &pDraw->pPixels[(y - by) * pDraw->iWidth + (x0 - bx)],
+               (x1 - x0) * sizeof(uint16_t));
+    }
+    return 1;
+}
+
+static bool galleryDecode(const char *name) {
+    Gallery &g = s_gallery;
+    const uint8_t *data;
+    uint32_t size;
+    if (!galleryItem(name, &data, &size) || !jpeg.openRAM((uint8_t *)data, size, galleryDrawCB)) {
+        return false;
+    }
+    jpeg.setPixelType(RGB565_LITTLE_ENDIAN);
+    int width = jpeg.getWidth(), height = jpeg.getHeight();
+    int shift = 0;
+    while (shift < 3 && ((width >> shift) > g.cell || (height >> shift) > g.cell)) shift++;
+    int part = (1 << shift) - 1;
+    g.ox = g.cx + (g.cell - ((width + part) >> shift)) / 2;
+    g.oy = g.cy + (g.cell - ((height + part) >> shift)) / 2;
+    bool ok = jpeg.decode(0, 0, jpegScale(shift));
+    jpeg.close();
+    return ok;
+}
+
+// Clear the grid to the background and queue the page's cells
+static void galleryPage(int page) {
+    Gallery &g = s_gallery;
+    display_fill_buffer(g.layer, g.bg, LCD_H_RES * LCD_V_RES);
+    compositor_set_buffered(LAYER_IMAGE);
+    compositor_flush();
+    g.page = page;
+    g.filling = true;
+    g.next = 0;
+    g.drawn = 0;
+    g.missing = 0;
+    g.start_ms = millis();
+}
+
+static void galleryEnd() {
+    s_gallery.shown = false;
+    s_gallery.filling = false;
+}
+
+// Commands that put up a picture of their own
+static bool galleryReplacedBy(const char *cmd) {
+    static const char *const cmds[] = { "image", "tiles", "show", "stream", "mjpeg", "clear", "face" };
+    for (const char *c : cmds) {
+        if (strcmp(cmd, c) == 0) return true;
+    }
+    return false;
+}
+
+// Decode the next cell of the page (called from loop())
+static void galleryStep() {
+    Gallery &g = s_gallery;
+    int i = g.page * galleryPerPage() + g.next;
+    if (g.next == galleryPerPage() || i == g.count) {
+        dualPrintf("{\"event\":\"gallery\",\"page\":%d,\"drawn\":%d,\"missing\":%d,\"ms\":%lu}\n",
+                   g.page, g.drawn, g.missing, millis() - g.start_ms);
+        g.filling = false;
+        return;
+    }
+    g.cx = g.x0 + (g.next % g.cols) * g.cell;
+    g.cy = g.y0 + (g.next / g.cols) * g.cell;
+    g.next++;
+    if (galleryDecode(g.names[i])) g.drawn++;
+    else g.missing++;
+    compositor_damage(g.cx, g.cy, g.cell, g.cell);
+    compositor_flush();
+}
+
+// Index of the item under a touch, or -1
+static int galleryHit(int x, int y) {
+    Gallery &g = s_gallery;
+    int c = (x - g.x0) / g.cell, r = (y - g.y0) / g.cell;
+    if (x < g.x0 || y < g.y0 || c >= g.cols || r >= g.cols) return -1;
+    int i = g.page * galleryPerPage() + r * g.cols + c;
+    return i < g.count ? i : -1;
+}
+
+// Every JPEG slot, most recently used first; returns how many
+static int galleryListSlots(const Slot **order) {
+    int n = 0;
+    for (int i = 0; i < slot_cache_count(); i++) {
+        const Slot *s = slot_cache_at(i);
+        if (s->frame || s->format != IMG_JPEG) continue;
+        int j = n++;
+        for (; j > 0 && order[j - 1]->used < s->used; j--) order[j] = order[j - 1];
+        order[j] = s;
+    }
+    return n;
+}
+
+// A new gallery (names given, or none on screen) or another page / layout
+// of the one shown. Nothing changes unless all of it checks out.
+static void handleGallery(JsonArrayConst names, int cols, int page, const char *bg) {
+    Gallery &g = s_gallery;
+    bool fresh = !names.isNull() || !g.shown;
+    const Slot *slots[SLOT_CACHE_MAX];
+    int count = g.count;
+    if (fresh && names.isNull()) {
+        count = min(galleryListSlots(slots), GALLERY_MAX);
+    } else if (fresh) {
+        if (names.size() > GALLERY_MAX) {
+            dualPrintln("{\"status\":\"error\",\"msg\":\"too many images\"}");
+            return;
+        }
+        for (JsonVariantConst v : names) {
+            const char *name = v | "";
+            const uint8_t *data;
+            uint32_t size;
+            if (!galleryItem(name, &data, &size)) {
+                dualPrintf("{\"status\":\"error\",\"msg\":\"no jpeg %.*s\"}\n",
+                           SLOT_NAME_LEN - 1, name);
+                return;
+            }
+        }
+        count = names.size();
+    }
+    if (!count) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no images\"}");
+        return;
+    }
+    if (!cols) cols = fresh ? (count <= 9 ? 3 : 4) : g.cols;
+    if (cols < 1 || cols > 8) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad cols\"}");
+        return;
+    }
+    if (page < 0 || page >= (count + cols * cols - 1) / (cols * cols)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad page\"}");
+        return;
+    }
+    g.layer = compositor_layer(LAYER_IMAGE);
+    if (!g.layer) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+
+    if (fresh) {
+        for (int i = 0; i < count; i++) {
+            strcpy(g.names[i], names.isNull() ? slots[i]->name : (names[i] | ""));
+        }
+        g.count = count;
+        g.bg = 0;
+    }
+    if (bg) g.bg = hexToRGB565(bg);
+    g.cols = cols;
+    g.cell = LCD_H_RES / cols;
+    g.x0 = (LCD_H_RES - g.cell * cols) / 2;
+    g.y0 = (LCD_V_RES - g.cell * cols) / 2;
+    face_set_enabled(false);
+    galleryPage(page);
+    g.shown = true;
+    s_image_shown = true;
+    dualPrintf("{\"status\":\"ok\",\"images\":%d,\"cols\":%d,\"page\":%d,\"pages\":%d}\n",
+               g.count, g.cols, g.page, galleryPages());
+}
+
+// ============================================================================
+// Text Overlay
+// ============================================================================
+// {"cmd":"text","text":"Hi","x":240,"y":200} draws text into the overlay
+// layer, above image and face, from the fonts baked into flash (see
+// font.h). Its anti-aliased edges are blended by the overlay's alpha
+// plane and only the tiles it touches are recomposited. "size" picks the
+// closest font (16, 24, 32 or 48 px); "align" is "left" (from x),
+// "center" (on x) or "right" (ending at x). With "w" (and "h") x, y is
+// the top-left of a box that is cleared first, with the text aligned in
+// it (and centered vertically when h is given), so a changing value is
+// redrawn in place. "bg" fills the box (or the text's own bounds) with a
+// solid color instead of leaving it see-through.
+// {"cmd":"text","clear":true} removes all text, or with x, y, w, h just
+// that area. Replies give the rect that changed.
+
+static bool parseAlign(const char *name, int *align) {
+    if (strcmp(name, "left") == 0) *align = -1;
+    else if (strcmp(name, "center") == 0) *align = 0;
+    else if (strcmp(name, "right") == 0) *align = 1;
+    else return false;
+    return true;
+}
+
+// Clip a rect to the screen; false if nothing is left
+static bool clipRect(Rect &r, int x, int y, int w, int h) {
+    int x1 = min(x + w, LCD_H_RES), y1 = min(y + h, LCD_V_RES);
+    x = max(x, 0);
+    y = max(y, 0);
+    r = { (int16_t)x, (int16_t)y, (int16_t)(x1 - x), (int16_t)(y1 - y) };
+    return x1 > x && y1 > y;
+}
+
+// Set a screen rect of the overlay to one color and alpha
+static void overlayFill(const Rect &r, uint16_t color, uint8_t a) {
+    uint16_t *pixels = compositor_layer(LAYER_OVERLAY);
+    uint8_t *alpha = compositor_alpha(LAYER_OVERLAY);
+    for (int y = r.y; y < r.y + r.h; y++) {
+        int off = y * LCD_H_RES + r.x;
+        display_fill_buffer(pixels + off, color, r.w);
+        memset(alpha + off, a, r.w);
+    }
+    compositor_damage(r.x, r.y, r.w, r.h);
+}
+
+static void textReply(const Rect &r) {
+    dualPrintf("{\"status\":\"ok\",\"x\":%d,\"y\":%d,\"w\":%d,\"h\":%d}\n", r.x, r.y, r.w, r.h);
+}
+
+static void handleTextClear(bool area, int x, int y, int w, int h) {
+    Rect r = { 0, 0, LCD_H_RES, LCD_V_RES };
+    if (!area) {
+        // Hidden overlays cost nothing to compose
+        uint8_t *alpha = compositor_alpha(LAYER_OVERLAY);
+        if (alpha) memset(alpha, 0, LCD_H_RES * LCD_V_RES);
+        compositor_set_visible(LAYER_OVERLAY, false);
+    } else if (!clipRect(r, x, y, w, h)) {
+        r = { 0, 0, 0, 0 };
+    } else if (compositor_alpha(LAYER_OVERLAY) && compositor_layer(LAYER_OVERLAY)) {
+        overlayFill(r, 0, 0);
+    }
+    compositor_flush();
+    textReply(r);
+}
+
+static void handleText(const char *text, int x, int y, int size, const char *color,
+                       const char *align, const char *bg, int w, int h) {
+    int a;
+    if (!parseAlign(align, &a)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad align\"}");
+        return;
+    }
+    uint16_t *pixels = compositor_layer(LAYER_OVERLAY);
+    uint8_t *alpha = compositor_alpha(LAYER_OVERLAY);
+    if (!pixels || !alpha) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+
+    // Block of lines, and where the text's anchor goes
+    const Font *f = font_for_size(size);
+    int tw = 0;
+    for (const char *line = text; line; line = strchr(line, '\n')) {
+        if (line != text) line++;
+        tw = max(tw, font_line_width(f, line));
+    }
+    int th = font_line_count(text) * f->height;
+    int bx, by, bw, bh, tx, ty;
+    if (w > 0) {
+        bx = x;
+        by = y;
+        bw = w;
+        bh = h > 0 ? h : th;
+        tx = a < 0 ? x : a == 0 ? x + w / 2 : x + w;
+        ty = h > 0 ? y + (h - th) / 2 : y;
+    } else {
+        bx = a < 0 ? x : a == 0 ? x - tw / 2 : x - tw;
+        by = y;
+        bw = tw;
+        bh = th;
+        tx = x;
+        ty = y;
+    }
+
+    Rect box = { 0, 0, 0, 0 };
+    bool boxed = clipRect(box, bx, by, bw, bh);
+    if (boxed && bg) overlayFill(box, hexToRGB565(bg), COMP_ALPHA_MAX);
+    else if (boxed && w > 0) overlayFill(box, 0, 0);
+    Rect drawn = font_draw(f, text, tx, ty, a, hexToRGB565(color), pixels, alpha);
+    compositor_damage(drawn.x, drawn.y, drawn.w, drawn.h);
+
+    compositor_set_visible(LAYER_OVERLAY, true);
+    compositor_flush();
+
+    // Changed area: the box plus any glyph overhang
+    if (!boxed) box = drawn;
+    else if (drawn.w) {
+        int x1 = max(box.x + box.w, drawn.x + drawn.w), y1 = max(box.y + box.h, drawn.y + drawn.h);
+        box.x = min(box.x, drawn.x);
+        box.y = min(box.y, drawn.y);
+        box.w = x1 - box.x;
+        box.h = y1 - box.y;
+    }
+    textReply(box);
+}
+
+// ============================================================================
+// Frame Sprites
+// ============================================================================
+// {"cmd":"sprite","id":"date","x":150,"y":400,"len":N} takes a QOI image
+// (same ready handshake as "image") and keeps it as a sprite at x, y,
+// blended into every frame decoded from then on (see sprite.h). An RGBA
+// file carries its own alpha; with "key":"#FF00FF" pixels of that color
+// are left out instead. Without "len" an existing sprite moves to x, y.
+// {"cmd":"sprite","id":"date","remove":true} drops one and
+// {"cmd":"sprite","clear":true} all of them. Replies list the sprites.
+
+static void spriteReply() {
+    dualPrintf("{\"status\":\"ok\",\"sprites\":[");
+    for (int i = 0; i < sprite_count(); i++) {
+        const Sprite *s = sprite_at(i);
+        dualPrintf("%s{\"id\":\"%s\",\"x\":%d,\"y\":%d,\"w\":%u,\"h\":%u}", i ? "," : "",
+                   s->name, s->x, s->y, s->w, s->h);
+    }
+    dualPrintln("]}");
+}
+
+// Decode a whole QOI file into a new sprite
+static const char *spriteDecode(const char *name, const uint8_t *data, uint32_t len, int x, int y,
+                                const char *key) {
+    QoiDecoder q;
+    if (len < QOI_HEADER_SIZE || !qoi_decode_begin(&q, data)) return "qoi open fail";
+    if (q.width > LCD_H_RES || q.height > LCD_V_RES) return "sprite too big";
+    Sprite *s = sprite_alloc(name, q.width, q.height);
+    if (!s) return sprite_count() == SPRITE_MAX && !sprite_find(name) ? "too many sprites" : "no memory";
+    int n = s->w * s->h;
+    size_t pos = QOI_HEADER_SIZE;
+    if (qoi_decode_rgb565a(&q, data, len, &pos, s->pixels, s->alpha, n) != n) {
+        sprite_remove(name);
+        return "qoi decode fail";
+    }
+    uint16_t k = key ? hexToRGB565(key) : 0;
+    for (int i = 0; i < n; i++) {
+        s->alpha[i] = key && s->pixels[i] == k ? 0 : (s->alpha[i] * COMP_ALPHA_MAX + 127) / 255;
+    }
+    s->x = x;
+    s->y = y;
+    return NULL;
+}
+
+static void handleSprite(const char *name, bool place, int x, int y, uint32_t len, const char *key) {
+    if (!name || !name[0] || strlen(name) >= SPRITE_NAME_LEN) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad sprite\"}");
+        return;
+    }
+    if (len == 0) {
+        Sprite *s = sprite_find(name);
+        if (!s) {
+            dualPrintln("{\"status\":\"error\",\"msg\":\"no sprite\"}");
+            return;
+        }
+        if (place) {
+            s->x = x;
+            s->y = y;
+        }
+        spriteReply();
+        return;
+    }
+    if (len > MAX_JPEG_SIZE) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+        return;
+    }
+    RxBuf *bp = s_decode_task ? rxClaim(len, TRANS_NONE, 0) : NULL;
+    if (!bp) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no memory\"}");
+        return;
+    }
+    RxBuf &b = *bp;
+
+    dualPrintln("{\"status\":\"ready\"}");
+    Serial.flush();
+    wifi.flush();
+    uint32_t received = rxReceive(b);
+    const char *err = received == len ? spriteDecode(name, b.data, len, x, y, key) : NULL;
+    b.busy = false;
+    if (received != len) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+        return;
+    }
+    if (err) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        return;
+    }
+    spriteReply();
+}
+
 // ============================================================================
-// Dual Output Helpers (Serial + WiFi)
+// Video Stream
 // ============================================================================
+// After {"cmd":"stream"} the link carries back-to-back frames with no
+// replies:
+//   "SCFR" | u32 len (LE) | len JPEG bytes | u32 CRC-32 (LE, if crc on)
+//   "SCFT" | u32 len | u32 host capture ms | ...  (same, timestamped)
+// A frame with len 0 ends the stream. Frames go through the same receive
+// buffers and decode task as image commands. Without a CRC a frame is
+// queued as soon as its header is in (it decodes while arriving); with
+// one it is only queued once the CRC matches. Lost bytes are recovered
+// by scanning for the next magic. Stats go out as periodic events.
+// Commands keep working on the other link.
+//
+// Latest wins: when both buffers are taken (one decoding, one waiting)
+// the link is not read, so a sender that outruns the decoder piles frames
+// up in the UART / TCP buffers. Once the waiting frame is older than
+// max_latency it is dropped and the next one is received in its place,
+// which keeps the link drained and the picture at most about that stale.
+// A frame's age is measured from its host timestamp when it has one
+// (clock offset taken as the smallest delay seen, so a frame that came
+// through at best speed counts as 0) and otherwise from when its header
+// arrived.
 
-static void dualPrintln(const char* str) {
-    Serial.println(str);
-    wifi.println(str);
+#define STREAM_MAGIC       "SCFR"
+#define STREAM_MAGIC_TS    "SCFT"
+#define STREAM_HDR_SIZE    8
+#define STREAM_HDR_TS_SIZE 12
+#define STREAM_STATS_MS    1000
+#define STREAM_MAX_LATENCY 150      // Default max_latency, ms (0 = never drop)
+
+enum StreamState { STREAM_HEADER, STREAM_PAYLOAD, STREAM_TRAILER };
+
+struct StreamStats {
+    uint32_t frames;            // Complete frames handed to the decoder
+    uint32_t shown;             // Frames put on screen
+    uint32_t dropped;           // Frames replaced by a newer one unshown
+    uint32_t bytes;
+    uint32_t crc_errors;
+    uint32_t resyncs;           // Times the magic had to be searched for
+    uint32_t stalls;            // Frames cut short by a silent link
+    uint32_t decode_errors;
+};
+
+struct VideoStream {
+    bool active;
+    int source;
+    bool crc;
+    uint32_t max_latency;
+    bool cover;                 // Frames use "fit":"cover"
+    StreamState state;
+    uint8_t hdr[STREAM_HDR_TS_SIZE];
+    int hdr_n;
+    bool in_sync;
+    uint32_t len;
+    uint32_t crc_val;
+    RxBuf *buf;
+    bool has_ts;                // Header of the frame being received
+    uint32_t host_ts;
+    unsigned long hdr_ms;       // When that header came in
+    int32_t ts_offset;          // Smallest (device - host) ms seen
+    bool ts_synced;
+    unsigned long deadline;     // Stall limit for a partial frame
+    StreamStats stats;
+    uint32_t shown_seen;        // s_shown.count already accounted for
+    ShownFrame shown;           // Last frame shown
+    uint32_t lat_sum;           // Latency of frames shown since the report
+    uint32_t lat_max;
+    uint32_t lat_n;
+    uint32_t report_shown;      // stats.shown at the last report
+    unsigned long report_ms;
+};
+static VideoStream s_stream;
+
+// Estimated ms between the host capturing a frame and `now`
+static uint32_t streamAge(bool has_ts, uint32_t host_ts, unsigned long rx_ms, unsigned long now) {
+    if (has_ts && s_stream.ts_synced) {
+        int32_t age = (int32_t)(now - host_ts) - s_stream.ts_offset;
+        return age > 0 ? age : 0;
+    }
+    return now - rx_ms;
 }
 
-static void dualPrintf(const char* fmt, ...) {
-    char buf[256];
-    va_list args;
-    va_start(args, fmt);
-    int n = vsnprintf(buf, sizeof(buf), fmt, args);
-    va_end(args);
-    Serial.write((const uint8_t*)buf, n);
-    if (wifi.connected && wifi.client.connected()) {
-        wifi.client.write((const uint8_t*)buf, n);
+// Account for frames the decoder has shown since the last call
+static void streamCollectShown() {
+    VideoStream &st = s_stream;
+    ShownFrame shown;
+    portENTER_CRITICAL(&s_rx_mux);
+    shown = s_shown;
+    portEXIT_CRITICAL(&s_rx_mux);
+    if (shown.count == st.shown_seen) return;
+
+    st.stats.shown += shown.count - st.shown_seen;
+    st.shown_seen = shown.count;
+    st.shown = shown;
+    uint32_t lat = streamAge(shown.has_ts, shown.host_ts, shown.rx_ms, shown.at_ms);
+    st.lat_sum += lat;
+    st.lat_n++;
+    if (lat > st.lat_max) st.lat_max = lat;
+}
+
+// Periodic stats event, or the final reply when the stream ends. The
+// latency figures cover the frames shown since the last report; with
+// timestamped frames, shown_ts / shown_ago (host ms of the last frame
+// shown, ms since it was) let the host work out glass-to-glass itself.
+static void streamReport(bool final) {
+    VideoStream &s = s_stream;
+    StreamStats &st = s.stats;
+    streamCollectShown();
+    unsigned long now = millis();
+    uint32_t dt = now - s.report_ms;
+    float fps = dt ? (st.shown - s.report_shown) * 1000.0f / dt : 0;
+    char msg[384];
+    int n = snprintf(msg, sizeof(msg),
+             "{%s,\"frames\":%u,\"shown\":%u,\"dropped\":%u,\"fps\":%.1f,"
+             "\"bytes\":%u,\"crc_errors\":%u,\"resyncs\":%u,\"stalls\":%u,"
+             "\"decode_errors\":%u,\"latency_ms\":%u,\"latency_max\":%u",
+             final ? "\"status\":\"ok\"" : "\"event\":\"stream\"",
+             st.frames, st.shown, st.dropped, fps, st.bytes, st.crc_errors,
+             st.resyncs, st.stalls, st.decode_errors,
+             s.lat_n ? s.lat_sum / s.lat_n : 0, s.lat_max);
+    if (s.shown.count && s.shown.has_ts) {
+        n += snprintf(msg + n, sizeof(msg) - n, ",\"shown_ts\":%u,\"shown_ago\":%u",
+                      s.shown.host_ts, (uint32_t)(now - s.shown.at_ms));
     }
+    snprintf(msg + n, sizeof(msg) - n, "}");
+    dualPrintln(msg);
+    s.lat_sum = s.lat_max = s.lat_n = 0;
+    s.report_shown = st.shown;
+    s.report_ms = now;
 }
 
-// ============================================================================
-// JPEG Decode Callback
-// ============================================================================
+static void streamBegin(int source, bool crc, uint32_t max_latency, bool cover) {
+    memset(&s_stream, 0, sizeof(s_stream));
+    s_stream.active = true;
+    s_stream.source = source;
+    s_stream.crc = crc;
+    s_stream.max_latency = max_latency;
+    s_stream.cover = cover;
+    s_stream.state = STREAM_HEADER;
+    s_stream.in_sync = true;
+    s_stream.report_ms = millis();
+    portENTER_CRITICAL(&s_rx_mux);
+    s_stream.shown_seen = s_shown.count;
+    portEXIT_CRITICAL(&s_rx_mux);
+}
 
-static int jpegDrawCB(JPEGDRAW *pDraw) {
-    for (int y = 0; y < pDraw->iHeight; y++) {
-        int row = pDraw->y + y;
-        if (row >= LCD_V_RES) break;
-        int w = pDraw->iWidth;
-        if (pDraw->x + w > LCD_H_RES) w = LCD_H_RES - pDraw->x;
-        if (pDraw->x < LCD_H_RES && w > 0) {
-            memcpy(&decode_buf[row * LCD_H_RES + pDraw->x],
-                   &pDraw->pPixels[y * pDraw->iWidth],
-                   w * sizeof(uint16_t));
+static void handleStream(bool crc, uint32_t max_latency, bool cover) {
+    if (!s_decode_task) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no decoder\"}");
+        return;
+    }
+    streamBegin(s_cmd_source, crc, max_latency, cover);
+    dualPrintln("{\"status\":\"ok\"}");
+}
+
+// Give up on the frame being received
+static void streamDropFrame() {
+    VideoStream &st = s_stream;
+    if (st.buf) {
+        if (st.crc) {
+            st.buf->busy = false;   // Never queued
+        } else {
+            rxFinish(*st.buf);      // Short read ends its decode quietly
         }
+        st.buf = NULL;
     }
-    return 1;
+    st.state = STREAM_HEADER;
+    st.hdr_n = 0;
 }
 
-// ============================================================================
-// RP2040 Communication (buzzer)
-// ============================================================================
+static void streamEnd() {
+    streamDropFrame();
+    imageWaitIdle();            // Totals include the last frames shown
+    streamReport(true);
+    s_stream.active = false;
+}
 
-static void rp2040_tone(int freq, int dur) {
-    char buf[64];
-    snprintf(buf, sizeof(buf), "TONE %d %d\n", freq, dur);
-    Serial1.print(buf);
+// Header bytes expected, going by the magic once it is in
+static int streamHeaderSize() {
+    VideoStream &st = s_stream;
+    if (st.hdr_n >= 4 && memcmp(st.hdr, STREAM_MAGIC_TS, 4) == 0) return STREAM_HDR_TS_SIZE;
+    return STREAM_HDR_SIZE;
 }
 
-static void rp2040_melody(const char *notes) {
-    Serial1.print("MELODY ");
-    Serial1.println(notes);
+// Header complete: start a frame, end the stream, or slip one byte
+static void streamHeader() {
+    VideoStream &st = s_stream;
+    bool has_ts = memcmp(st.hdr, STREAM_MAGIC_TS, 4) == 0;
+    uint32_t len;
+    memcpy(&len, st.hdr + 4, 4);
+    if ((!has_ts && memcmp(st.hdr, STREAM_MAGIC, 4) != 0) || len > MAX_JPEG_SIZE) {
+        if (st.in_sync) st.stats.resyncs++;
+        st.in_sync = false;
+        memmove(st.hdr, st.hdr + 1, st.hdr_n - 1);
+        st.hdr_n--;
+        return;
+    }
+    st.in_sync = true;
+    st.hdr_n = 0;
+    if (len == 0) {
+        streamEnd();
+        return;
+    }
+    st.len = len;
+    st.crc_val = 0;
+    st.has_ts = has_ts;
+    st.hdr_ms = millis();
+    if (has_ts) {
+        memcpy(&st.host_ts, st.hdr + 8, 4);
+        int32_t offset = (int32_t)(millis() - st.host_ts);
+        if (!st.ts_synced || offset < st.ts_offset) st.ts_offset = offset;
+        st.ts_synced = true;
+    }
+    st.state = STREAM_PAYLOAD;
 }
 
-static void rp2040_stop() {
-    Serial1.println("STOP");
+// Both buffers taken: drop the waiting frame for the incoming one if it
+// has gone stale (latest wins)
+static RxBuf *streamReclaim() {
+    VideoStream &st = s_stream;
+    if (!st.max_latency) return NULL;
+    RxBuf &w = rxNewest();
+    if (!w.busy || !w.done) return NULL;
+    if (streamAge(w.has_ts, w.host_ts, w.rx_ms, millis()) <= st.max_latency) return NULL;
+    RxBuf *b = rxReclaim(w, st.len, TRANS_NONE, 0);
+    if (b) st.stats.dropped++;
+    return b;
 }
 
-// ============================================================================
-// Color Helpers
-// ============================================================================
+// Receive whatever the stream link has (called from loop())
+static void streamPoll() {
+    VideoStream &st = s_stream;
+    if (st.source == 1 && !wifi.connected) {
+        streamDropFrame();
+        st.active = false;
+        return;
+    }
 
-static uint16_t hexToRGB565(const char *hex) {
-    if (hex[0] == '#') hex++;
-    uint32_t rgb = strtoul(hex, NULL, 16);
-    uint8_t r = (rgb >> 16) & 0xFF;
-    uint8_t g = (rgb >>  8) & 0xFF;
-    uint8_t b =  rgb        & 0xFF;
-    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    for (;;) {
+        if (st.state == STREAM_HEADER) {
+            size_t got = linkRead(st.source, st.hdr + st.hdr_n, streamHeaderSize() - st.hdr_n);
+            if (got == 0) break;
+            st.hdr_n += got;
+            st.deadline = millis() + RX_STALL_MS;
+            if (st.hdr_n == streamHeaderSize()) {
+                streamHeader();
+                if (!st.active) return;
+            }
+        } else if (st.state == STREAM_PAYLOAD) {
+            if (!st.buf) {
+                st.buf = rxClaim(st.len, TRANS_NONE, 0);
+                if (!st.buf) st.buf = streamReclaim();
+                if (!st.buf) break;  // Decoder still busy; the link buffers
+                st.buf->has_ts = st.has_ts;
+                st.buf->host_ts = st.host_ts;
+                st.buf->rx_ms = st.hdr_ms;
+                st.buf->cover = st.cover;
+                if (!st.crc) rxSubmit(*st.buf);
+                st.deadline = millis() + RX_STALL_MS;
+            }
+            RxBuf &b = *st.buf;
+            size_t got = linkRead(st.source, b.data + b.received, st.len - b.received);
+            if (got == 0) break;
+            if (st.crc) st.crc_val = crc32_update(st.crc_val, b.data + b.received, got);
+            rxAppend(b, got);
+            st.deadline = millis() + RX_STALL_MS;
+            if (b.received < st.len) continue;
+
+            st.stats.bytes += st.len;
+            if (st.crc) {
+                st.state = STREAM_TRAILER;
+            } else {
+                rxFinish(b);
+                st.buf = NULL;
+                st.stats.frames++;
+                st.state = STREAM_HEADER;
+            }
+        } else {
+            size_t got = linkRead(st.source, st.hdr + st.hdr_n, 4 - st.hdr_n);
+            if (got == 0) break;
+            st.hdr_n += got;
+            if (st.hdr_n < 4) continue;
+
+            uint32_t crc;
+            memcpy(&crc, st.hdr, 4);
+            st.hdr_n = 0;
+            st.state = STREAM_HEADER;
+            if (crc != st.crc_val) {
+                st.stats.crc_errors++;
+                st.buf->busy = false;
+            } else {
+                rxFinish(*st.buf);
+                rxSubmit(*st.buf);
+                st.stats.frames++;
+            }
+            st.buf = NULL;
+        }
+    }
+
+    // A partial frame on a link that went quiet is dropped
+    bool partial = st.hdr_n > 0 || st.state != STREAM_HEADER;
+    if (partial && (long)(millis() - st.deadline) > 0 && (st.state != STREAM_PAYLOAD || st.buf)) {
+        st.stats.stalls++;
+        streamDropFrame();
+    }
+
+    streamCollectShown();
+    if (millis() - st.report_ms >= STREAM_STATS_MS) streamReport(false);
 }
 
 // ============================================================================
-// Image Handler
+// HTTP MJPEG Client
 // ============================================================================
+// {"cmd":"mjpeg","url":"http://pi.local:8080/stream"} makes the device
+// pull frames from an HTTP MJPEG server (multipart/x-mixed-replace, as
+// served by mjpg-streamer, motion or controller/mjpeg_server.py) instead
+// of the host pushing each one. It runs as a stream whose source is the
+// HTTP connection: same receive buffers, "fit" and stats events, and both
+// links keep taking commands. A part with a Content-Length is queued as
+// soon as its headers are in and decodes while arriving; one without is
+// cut at the next boundary and queued once complete.
+//
+// Latest wins: a camera sends at its own pace whether the decoder keeps
+// up or not, so a frame still waiting to be decoded is always dropped
+// for the next one rather than leaving stale frames piling up in TCP.
+// {"cmd":"mjpeg","stop":true} ends it with the final stats; if the
+// server ends it an {"event":"mjpeg_end"} says why.
 
-static void handleImage(uint32_t len) {
-    if (len == 0 || len > MAX_JPEG_SIZE) {
-        dualPrintf("{\"status\":\"error\",\"msg\":\"bad len %u\"}\n", len);
+#define STREAM_SOURCE_HTTP  2       // s_stream.source besides 0 / 1 (links)
+#define MJPEG_CONNECT_MS    3000
+#define MJPEG_HEADER_MS     5000    // Wait for the HTTP response headers
+#define MJPEG_LINE_MAX      256     // Longer header lines are cut
+#define MJPEG_BOUNDARY_MAX  70      // RFC 2046
+#define MJPEG_READ          2048    // Bytes per read while looking for a boundary
+
+enum MjpegState {
+    MJPEG_BOUNDARY,             // Skip lines up to "--boundary"
+    MJPEG_BOUNDARY_TAIL,        // Rest of a boundary line found in a body
+    MJPEG_PART_HEADERS,
+    MJPEG_BODY,
+};
+
+struct MjpegClient {
+    WiFiClient http;
+    MjpegState state;
+    char line[MJPEG_LINE_MAX];
+    int line_n;
+    char delim[MJPEG_BOUNDARY_MAX + 5];     // "\r\n--" boundary
+    int delim_n;
+    int32_t part_len;           // Content-Length, or -1: cut at the boundary
+    bool submitted;             // Frame being received is queued already
+    bool hold;                  // Start no new frame (mjpegSettle)
+    uint8_t spill[MJPEG_READ];  // Read past the end of a frame
+    size_t spill_n, spill_pos;
+};
+static MjpegClient s_mjpeg;
+
+// "http://host[:port][/path]"
+static bool parseUrl(const char *url, char *host, size_t host_size, uint16_t *port, const char **path) {
+    if (strncmp(url, "http://", 7) != 0) return false;
+    url += 7;
+    const char *slash = strchr(url, '/');
+    size_t n = slash ? slash - url : strlen(url);
+    const char *colon = (const char *)memchr(url, ':', n);
+    *path = slash ? slash : "/";
+    *port = colon ? atoi(colon + 1) : 80;
+    if (colon) n = colon - url;
+    if (!n || n >= host_size || !*port) return false;
+    memcpy(host, url, n);
+    host[n] = 0;
+    return true;
+}
+
+// Bytes left over from the last frame first, then the connection
+static size_t mjpegRead(uint8_t *dst, size_t want) {
+    MjpegClient &m = s_mjpeg;
+    size_t n = 0;
+    if (m.spill_pos < m.spill_n) {
+        n = min(want, m.spill_n - m.spill_pos);
+        memcpy(dst, m.spill + m.spill_pos, n);
+        m.spill_pos += n;
+    } else {
+        int avail = m.http.available();
+        int got = avail > 0 && want ? m.http.read(dst, min(want, (size_t)avail)) : 0;
+        n = got > 0 ? got : 0;
+    }
+    if (n) s_stream.deadline = millis() + RX_STALL_MS;
+    return n;
+}
+
+// Read towards the end of a line; true once m.line holds a whole one
+// (without the CR / LF)
+static bool mjpegLine() {
+    MjpegClient &m = s_mjpeg;
+    uint8_t c;
+    while (mjpegRead(&c, 1)) {
+        if (c == '\n') {
+            m.line[m.line_n] = 0;
+            m.line_n = 0;
+            return true;
+        }
+        if (c != '\r' && m.line_n < MJPEG_LINE_MAX - 1) m.line[m.line_n++] = c;
+    }
+    return false;
+}
+
+// Take the boundary from a Content-Type header value, if multipart
+static void mjpegBoundary(const char *value) {
+    MjpegClient &m = s_mjpeg;
+    while (*value == ' ') value++;
+    if (strncasecmp(value, "multipart/", 10) != 0) return;
+    for (const char *p = value; *p; p++) {
+        if (strncasecmp(p, "boundary=", 9) != 0) continue;
+        p += 9;
+        if (*p == '"') p++;
+        size_t n = strcspn(p, "\"; \t");
+        if (!n || n > MJPEG_BOUNDARY_MAX) return;
+        memcpy(m.delim, "\r\n--", 4);
+        memcpy(m.delim + 4, p, n);
+        m.delim_n = 4 + n;
+        m.delim[m.delim_n] = 0;
         return;
     }
+}
 
-    // Signal ready
-    dualPrintln("{\"status\":\"ready\"}");
-    Serial.flush();
-    wifi.flush();
+// Status line and headers of the response; NULL if it is a multipart
+// stream we can follow
+static const char *mjpegResponse() {
+    MjpegClient &m = s_mjpeg;
+    static char msg[16];
+    unsigned long deadline = millis() + MJPEG_HEADER_MS;
+    int status = 0;
+    bool first = true;
+    for (;;) {
+        // Checked every line too: a server sending headers without end
+        // must not hold loop()
+        if ((long)(millis() - deadline) > 0) return "http timeout";
+        if (!mjpegLine()) {
+            if (!m.http.connected()) return "connection closed";
+            delay(1);
+            continue;
+        }
+        if (first) {
+            if (sscanf(m.line, "HTTP/%*d.%*d %d", &status) != 1) return "not http";
+            first = false;
+        } else if (!m.line[0]) {
+            break;
+        } else if (strncasecmp(m.line, "Content-Type:", 13) == 0) {
+            mjpegBoundary(m.line + 13);
+        }
+    }
+    if (status != 200) {
+        snprintf(msg, sizeof(msg), "http %d", status);
+        return msg;
+    }
+    return m.delim_n ? NULL : "not mjpeg";
+}
+
+static void handleMjpeg(const char *url, bool cover) {
+    MjpegClient &m = s_mjpeg;
+    char host[64];
+    uint16_t port;
+    const char *path;
+    if (!url || !parseUrl(url, host, sizeof(host), &port, &path)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"bad url\"}");
+        return;
+    }
+    if (!s_decode_task) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"no decoder\"}");
+        return;
+    }
+    if (!wifi.isWiFiConnected()) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"wifi not connected\"}");
+        return;
+    }
+    if (!m.http.connect(host, port, MJPEG_CONNECT_MS)) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"connect fail\"}");
+        return;
+    }
+    m.http.setNoDelay(true);
+
+    // HTTP/1.0: the body comes as is, never chunked
+    char req[256];
+    int n = snprintf(req, sizeof(req), "GET %s HTTP/1.0\r\nHost: %s\r\nUser-Agent: SenseCAP\r\n\r\n",
+                     path, host);
+    m.http.write((const uint8_t *)req, min(n, (int)sizeof(req) - 1));
+    m.line_n = 0;
+    m.delim_n = 0;
+    m.spill_n = m.spill_pos = 0;
+    const char *err = mjpegResponse();
+    if (err) {
+        m.http.stop();
+        dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", err);
+        return;
+    }
+
+    streamBegin(STREAM_SOURCE_HTTP, false, 0, cover);
+    m.state = MJPEG_BOUNDARY;
+    dualPrintf("{\"status\":\"ok\",\"boundary\":\"%s\"}\n", m.delim + 4);
+}
+
+// Buffer for the next frame; with both taken, the one waiting for the
+// decoder is dropped for it
+static RxBuf *mjpegClaim(uint32_t len) {
+    RxBuf *b = rxClaim(len, TRANS_NONE, 0);
+    if (!b) {
+        b = rxReclaim(rxNewest(), len, TRANS_NONE, 0);
+        if (b) s_stream.stats.dropped++;
+    }
+    return b;
+}
+
+static void mjpegDropFrame() {
+    VideoStream &st = s_stream;
+    if (!st.buf) return;
+    if (s_mjpeg.submitted) rxFinish(*st.buf);   // Short read ends its decode quietly
+    else st.buf->busy = false;
+    st.buf = NULL;
+}
+
+static void mjpegFrameDone() {
+    VideoStream &st = s_stream;
+    st.stats.frames++;
+    st.stats.bytes += st.buf->len;
+    rxFinish(*st.buf);
+    st.buf = NULL;
+}
+
+// Start of the delimiter in data[0, to), looking only where it could
+// end past `from` (what was there before was searched already)
+static int32_t mjpegFindDelim(const uint8_t *data, uint32_t from, uint32_t to) {
+    MjpegClient &m = s_mjpeg;
+    uint32_t i = from >= (uint32_t)m.delim_n ? from - m.delim_n + 1 : 0;
+    while (i + m.delim_n <= to) {
+        const uint8_t *p = (const uint8_t *)memchr(data + i, '\r', to - m.delim_n + 1 - i);
+        if (!p) break;
+        i = p - data;
+        if (memcmp(p, m.delim, m.delim_n) == 0) return i;
+        i++;
+    }
+    return -1;
+}
+
+// Length of a JPEG whose EOI marker ends data[0, n) (ignoring a CRLF
+// after it), or -1. FF D9 cannot occur inside entropy-coded data.
+static int32_t mjpegEndOfImage(const uint8_t *data, uint32_t n) {
+    if (n >= 4 && data[n - 2] == '\r' && data[n - 1] == '\n') n -= 2;
+    return n >= 4 && data[n - 2] == 0xFF && data[n - 1] == 0xD9 ? n : -1;
+}
+
+// Stop pulling: the final reply for a stop command, else an event
+static void mjpegEnd(const char *why) {
+    mjpegDropFrame();
+    s_mjpeg.http.stop();
+    imageWaitIdle();            // Totals include the last frames shown
+    streamReport(!why);
+    s_stream.active = false;
+    if (why) dualPrintf("{\"event\":\"mjpeg_end\",\"msg\":\"%s\"}\n", why);
+}
 
-    // Receive raw JPEG bytes from whichever transport sent the command
-    uint32_t received = 0;
-    unsigned long deadline = millis() + 30000;
-
-    if (s_cmd_source == 1) {
-        // WiFi TCP source
-        while (received < len && millis() < deadline) {
-            int avail = wifi.availableBytes();
-            if (avail > 0) {
-                uint32_t want = len - received;
-                if ((uint32_t)avail < want) want = avail;
-                size_t got = wifi.readBytes(jpeg_buf + received, want);
-                received += got;
-                if (got > 0) deadline = millis() + 5000;
+// Receive whatever the server has sent (called from loop())
+static void mjpegPoll() {
+    VideoStream &st = s_stream;
+    MjpegClient &m = s_mjpeg;
+    for (;;) {
+        if (m.state == MJPEG_BOUNDARY || m.state == MJPEG_BOUNDARY_TAIL) {
+            if (!mjpegLine()) break;
+            const char *tail = m.line;
+            if (m.state == MJPEG_BOUNDARY) {
+                // Preamble, the CRLF after a body, or a cut-off frame
+                if (strncmp(m.line, m.delim + 2, m.delim_n - 2) != 0) continue;
+                tail += m.delim_n - 2;
             }
-            yield();
-        }
-    } else {
-        // Serial USB source
-        while (received < len && millis() < deadline) {
-            int avail = Serial.available();
-            if (avail > 0) {
-                uint32_t want = len - received;
-                if ((uint32_t)avail < want) want = avail;
-                size_t got = Serial.readBytes(jpeg_buf + received, want);
-                received += got;
-                if (got > 0) deadline = millis() + 5000;
+            if (strncmp(tail, "--", 2) == 0) {
+                mjpegEnd("stream ended");
+                return;
             }
-            yield();
+            m.state = MJPEG_PART_HEADERS;
+            m.part_len = -1;
+            st.hdr_ms = millis();
+        } else if (m.state == MJPEG_PART_HEADERS) {
+            if (!mjpegLine()) break;
+            if (strncasecmp(m.line, "Content-Length:", 15) == 0) {
+                m.part_len = atol(m.line + 15);
+            } else if (!m.line[0]) {
+                bool fits = m.part_len > 0 && m.part_len <= MAX_JPEG_SIZE;
+                m.state = fits || m.part_len < 0 ? MJPEG_BODY : MJPEG_BOUNDARY;
+            }
+        } else {
+            if (!st.buf) {
+                if (m.hold) break;
+                st.buf = mjpegClaim(m.part_len >= 0 ? m.part_len : MAX_JPEG_SIZE);
+                if (!st.buf) break;  // Decoder busy with a frame; TCP buffers
+                st.buf->rx_ms = st.hdr_ms;
+                st.buf->cover = st.cover;
+                m.submitted = m.part_len >= 0;
+                if (m.submitted) rxSubmit(*st.buf);
+                st.deadline = millis() + RX_STALL_MS;
+            }
+            RxBuf &b = *st.buf;
+            uint32_t old = b.received;
+            if (m.part_len >= 0) {
+                size_t got = mjpegRead(b.data + old, b.len - old);
+                if (!got) break;
+                rxAppend(b, got);
+                if (b.received < b.len) continue;
+                mjpegFrameDone();
+                m.state = MJPEG_BOUNDARY;
+                continue;
+            }
+
+            // No length: read a bit at a time up to the next delimiter,
+            // keeping what came after it for the part headers. Data that
+            // stops right after an EOI is taken as the whole frame, so
+            // it does not wait for the server's next part.
+            size_t got = mjpegRead(b.data + old, min((uint32_t)MJPEG_READ, b.len - old));
+            if (!got) {
+                if (old < b.len) break;
+                mjpegDropFrame();           // Too big; skip to the next part
+                m.state = MJPEG_BOUNDARY;
+                continue;
+            }
+            b.received += got;
+            int32_t at = mjpegFindDelim(b.data, old, b.received);
+            if (at >= 0) {
+                m.spill_n = b.received - (at + m.delim_n);
+                memcpy(m.spill, b.data + at + m.delim_n, m.spill_n);
+                m.spill_pos = 0;
+                m.state = MJPEG_BOUNDARY_TAIL;
+            } else {
+                at = mjpegEndOfImage(b.data, b.received);
+                if (at < 0) continue;
+                m.state = MJPEG_BOUNDARY;   // Skips the CRLF before the delimiter
+            }
+            b.len = b.received = at;
+            rxSubmit(b);
+            mjpegFrameDone();
         }
     }
 
-    if (received != len) {
-        dualPrintf("{\"status\":\"error\",\"msg\":\"got %u/%u\"}\n", received, len);
+    // A frame cut off by a silent server is dropped; the next part is
+    // found by its boundary
+    if (st.buf && (long)(millis() - st.deadline) > 0) {
+        st.stats.stalls++;
+        mjpegDropFrame();
+        m.state = MJPEG_BOUNDARY;
+    }
+    if (!m.http.connected()) {
+        mjpegEnd("connection closed");
         return;
     }
 
-    // Decode JPEG to RGB565
-    if (!jpeg.openRAM(jpeg_buf, len, jpegDrawCB)) {
-        dualPrintln("{\"status\":\"error\",\"msg\":\"jpeg open fail\"}");
+    streamCollectShown();
+    if (millis() - st.report_ms >= STREAM_STATS_MS) streamReport(false);
+}
+
+// Finish receiving the frame in progress, so a command can wait for the
+// decoder (which may be waiting for that frame's bytes) or claim a buffer
+static void mjpegSettle() {
+    if (!s_stream.active || s_stream.source != STREAM_SOURCE_HTTP) return;
+    s_mjpeg.hold = true;
+    while (s_stream.active && s_stream.buf) {
+        mjpegPoll();
+        yield();
+    }
+    s_mjpeg.hold = false;
+}
+
+// Give up on a partly received frame so a command can wait for the
+// decoder (which may be waiting for that frame's bytes) or claim a
+// buffer. The rest of the frame is skipped by the header resync.
+static void streamSettle() {
+    VideoStream &st = s_stream;
+    if (!st.active || st.source == STREAM_SOURCE_HTTP || !st.buf) return;
+    st.stats.dropped++;
+    streamDropFrame();
+}
+
+// ============================================================================
+// Screenshot
+// ============================================================================
+//
+// Streams the last composed frame as a QOI image, a few rows per loop()
+// so the face keeps animating. Reply sequence (to the requesting link):
+//   {"status":"screenshot","format":"qoi","width":480,"height":480}
+//   {"status":"chunk","len":N}\n + N bytes     (repeated)
+//   {"status":"ok","bytes":TOTAL,"ms":T}
+// Rows captured later may come from a newer frame than earlier ones.
+
+#define SHOT_ROWS      8
+#define SHOT_BUF_SIZE  (QOI_HEADER_SIZE + SHOT_ROWS * LCD_H_RES * QOI_MAX_BYTES_PER_PX + QOI_END_SIZE)
+
+struct Screenshot {
+    bool          active;
+    int           source;     // Transport that asked for it
+    int           row;        // Next row to encode
+    uint32_t      bytes;      // Sent so far
+    unsigned long start_ms;
+    uint8_t      *buf;
+    QoiEncoder    qoi;
+};
+static Screenshot s_shot;
+
+static void screenshotEnd() {
+    heap_caps_free(s_shot.buf);
+    s_shot.buf = NULL;
+    s_shot.active = false;
+}
+
+static void handleScreenshot() {
+    if (s_shot.active) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"screenshot busy\"}");
         return;
     }
-    jpeg.setPixelType(RGB565_LITTLE_ENDIAN);
-    memset(decode_buf, 0, FRAME_BYTES);
+    s_shot.buf = (uint8_t *)heap_caps_malloc(SHOT_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    if (!s_shot.buf) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"screenshot alloc failed\"}");
+        return;
+    }
+    s_shot.active = true;
+    s_shot.source = s_cmd_source;
+    s_shot.row = 0;
+    s_shot.bytes = 0;
+    s_shot.start_ms = millis();
+    sourcePrintf(s_shot.source,
+                 "{\"status\":\"screenshot\",\"format\":\"qoi\",\"width\":%d,\"height\":%d}\n",
+                 LCD_H_RES, LCD_V_RES);
+}
 
-    if (!jpeg.decode(0, 0, 0)) {
-        dualPrintln("{\"status\":\"error\",\"msg\":\"jpeg decode fail\"}");
-        jpeg.close();
+// Encode and send the next band of rows (called from loop())
+static void screenshotStep() {
+    if (s_shot.source == 1 && !(wifi.connected && wifi.client.connected())) {
+        screenshotEnd();  // Requester went away
         return;
     }
-    jpeg.close();
 
-    // Push to display
-    display_draw_fullscreen(decode_buf);
-    dualPrintln("{\"status\":\"ok\"}");
+    size_t n = 0;
+    if (s_shot.row == 0) n = qoi_encode_begin(&s_shot.qoi, LCD_H_RES, LCD_V_RES, s_shot.buf);
+
+    const uint16_t *frame = compositor_frame();
+    int rows = min(SHOT_ROWS, LCD_V_RES - s_shot.row);
+    n += qoi_encode_rgb565(&s_shot.qoi, frame + s_shot.row * LCD_H_RES,
+                           rows * LCD_H_RES, s_shot.buf + n);
+    s_shot.row += rows;
+    bool last = (s_shot.row == LCD_V_RES);
+    if (last) n += qoi_encode_end(&s_shot.qoi, s_shot.buf + n);
+
+    if (n > 0) {
+        sourcePrintf(s_shot.source, "{\"status\":\"chunk\",\"len\":%u}\n", (unsigned)n);
+        sourceWrite(s_shot.source, s_shot.buf, n);
+        s_shot.bytes += n;
+    }
+
+    if (last) {
+        sourcePrintf(s_shot.source, "{\"status\":\"ok\",\"bytes\":%u,\"ms\":%lu}\n",
+                     s_shot.bytes, millis() - s_shot.start_ms);
+        screenshotEnd();
+    }
 }
 
 // ============================================================================
@@ -221,7 +2679,9 @@ static void handleImage(uint32_t len) {
 // ============================================================================
 
 static void handleCommand(const char *line) {
-    StaticJsonDocument<256> doc;
+    // Room for a text command's string or a gallery's slot list; static
+    // to keep it off the loop task's stack
+    static StaticJsonDocument<1536> doc;
     if (deserializeJson(doc, line)) {
         dualPrintln("{\"status\":\"error\",\"msg\":\"bad json\"}");
         return;
@@ -233,12 +2693,109 @@ static void handleCommand(const char *line) {
         return;
     }
 
+    s_cmd_chunk = doc["chunk"] | (uint32_t)0;
+    if (s_cmd_chunk && (s_cmd_chunk < CHUNK_MIN || s_cmd_chunk > CHUNK_MAX)) {
+        dualPrintf("{\"status\":\"error\",\"msg\":\"bad chunk %u\"}\n", s_cmd_chunk);
+        return;
+    }
+
+    // Only images queue behind the decoder; everything else sees the
+    // screen with the last frame already drawn
+    mjpegSettle();
+    streamSettle();
+    if (strcmp(cmd, "image") != 0 && !imageWaitIdle()) {
+        dualPrintln("{\"status\":\"error\",\"msg\":\"decoder busy\"}");
+        return;
+    }
+    if (s_gallery.shown && galleryReplacedBy(cmd)) galleryEnd();
+
     if (strcmp(cmd, "image") == 0) {
         face_set_enabled(false);  // Image mode takes over from face
-        handleImage(doc["len"] | (uint32_t)0);
+        CompTransition trans = parseTransition(doc["transition"]);
+        uint32_t trans_ms = doc["duration"] | (uint32_t)300;
+        if (trans == TRANS_NONE && !doc["duration"].isNull()) trans = TRANS_FADE;
+        handleImage(doc["len"] | (uint32_t)0, trans, trans_ms, doc["format"] | "jpeg",
+                    strcmp(doc["fit"] | "none", "cover") == 0);
+    }
+    else if (strcmp(cmd, "tiles") == 0) {
+        face_set_enabled(false);
+        handleTiles(doc["len"] | (uint32_t)0, doc["codec"] | "rle");
+    }
+    else if (strcmp(cmd, "store") == 0) {
+        handleStore(doc["slot"], doc["len"] | (uint32_t)0, doc["format"] | "jpeg",
+                    strcmp(doc["fit"] | "none", "cover") == 0, doc["keep"] | "frame");
+    }
+    else if (strcmp(cmd, "show") == 0) {
+        face_set_enabled(false);
+        CompTransition trans = parseTransition(doc["transition"]);
+        uint32_t trans_ms = doc["duration"] | (uint32_t)300;
+        if (trans == TRANS_NONE && !doc["duration"].isNull()) trans = TRANS_FADE;
+        if (doc["asset"]) {
+            handleShowAsset(doc["asset"], strcmp(doc["fit"] | "none", "cover") == 0, trans, trans_ms);
+        } else {
+            handleShow(doc["slot"], trans, trans_ms);
+        }
+    }
+    else if (strcmp(cmd, "evict") == 0) {
+        handleEvict(doc["slot"]);
+    }
+    else if (strcmp(cmd, "slots") == 0) {
+        if (!doc["budget"].isNull()) slot_cache_set_budget(doc["budget"] | (uint32_t)0);
+        handleSlots();
+    }
+    else if (strcmp(cmd, "asset") == 0) {
+        handleAsset(doc["id"], doc["len"] | (uint32_t)0, doc["format"] | "jpeg");
+    }
+    else if (strcmp(cmd, "assets") == 0) {
+        handleAssets();
+    }
+    else if (strcmp(cmd, "stream") == 0) {
+        face_set_enabled(false);
+        if (s_stream.active && s_stream.source == STREAM_SOURCE_HTTP) mjpegEnd("replaced");
+        handleStream(doc["crc"] | false, doc["max_latency"] | STREAM_MAX_LATENCY,
+                     strcmp(doc["fit"] | "none", "cover") == 0);
+    }
+    else if (strcmp(cmd, "mjpeg") == 0) {
+        bool pulling = s_stream.active && s_stream.source == STREAM_SOURCE_HTTP;
+        if (doc["stop"] | false) {
+            if (pulling) mjpegEnd(NULL);
+            else dualPrintln("{\"status\":\"error\",\"msg\":\"no mjpeg\"}");
+        } else if (s_stream.active && !pulling) {
+            dualPrintln("{\"status\":\"error\",\"msg\":\"stream active\"}");
+        } else {
+            face_set_enabled(false);
+            if (pulling) mjpegEnd("replaced");
+            handleMjpeg(doc["url"], strcmp(doc["fit"] | "none", "cover") == 0);
+        }
+    }
+    else if (strcmp(cmd, "gallery") == 0) {
+        handleGallery(doc["slots"], doc["cols"] | 0, doc["page"] | 0, doc["bg"]);
+    }
+    else if (strcmp(cmd, "text") == 0) {
+        if (doc["clear"] | false) {
+            handleTextClear(!doc["w"].isNull(), doc["x"] | 0, doc["y"] | 0, doc["w"] | 0, doc["h"] | 0);
+        } else {
+            handleText(doc["text"] | "", doc["x"] | 0, doc["y"] | 0, doc["size"] | 24,
+                       doc["color"] | "#FFFFFF", doc["align"] | "left", doc["bg"],
+                       doc["w"] | 0, doc["h"] | 0);
+        }
+    }
+    else if (strcmp(cmd, "sprite") == 0) {
+        if (doc["clear"] | false) {
+            sprite_clear();
+            spriteReply();
+        } else if (doc["remove"] | false) {
+            if (sprite_remove(doc["id"] | "")) spriteReply();
+            else dualPrintln("{\"status\":\"error\",\"msg\":\"no sprite\"}");
+        } else {
+            handleSprite(doc["id"], !doc["x"].isNull() && !doc["y"].isNull(), doc["x"] | 0, doc["y"] | 0,
+                         doc["len"] | (uint32_t)0, doc["key"]);
+        }
     }
     else if (strcmp(cmd, "clear") == 0) {
-        display_fill(hexToRGB565(doc["color"] | "#000000"));
+        compositor_set_solid(LAYER_IMAGE, hexToRGB565(doc["color"] | "#000000"));
+        compositor_flush();
+        s_image_shown = false;
         dualPrintln("{\"status\":\"ok\"}");
     }
     else if (strcmp(cmd, "tone") == 0) {
@@ -257,6 +2814,43 @@ static void handleCommand(const char *line) {
         display_backlight(doc["on"] | true);
         dualPrintln("{\"status\":\"ok\"}");
     }
+    else if (strcmp(cmd, "display") == 0) {
+        if (!doc["bounce"].isNull()) {
+            bool ok = display_set_bounce_rows(doc["bounce"] | 0);
+            compositor_damage_all();  // New panel starts black
+            compositor_flush();
+            if (!ok) {
+                dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n",
+                           display_ok() ? "bounce rows unsupported" : "display lost");
+                return;
+            }
+        }
+        if (doc["reset"] | false) display_reset_stats();
+        DisplayStats st;
+        display_get_stats(&st);
+        dualPrintf("{\"status\":\"ok\",\"bounce\":%d,\"direct_fb\":%s,"
+                   "\"frames\":%u,\"underruns\":%u,\"worst_us\":%u,\"frame_us\":%u,"
+                   "\"px_per_sec\":%u,\"px_total\":%llu,\"tiles\":%d}\n",
+                   st.bounce_rows, st.direct_fb ? "true" : "false",
+                   st.frames, st.underruns, st.worst_frame_us, st.frame_us,
+                   st.pixels_per_sec, (unsigned long long)st.pixels_pushed,
+                   compositor_last_tiles());
+    }
+    else if (strcmp(cmd, "screenshot") == 0) {
+        handleScreenshot();
+    }
+    else if (strcmp(cmd, "bench") == 0) {
+        const char *suite = doc["suite"] | "all";
+        static char report[BENCH_REPORT_SIZE];
+        static char reply[BENCH_REPORT_SIZE + 64];
+        if (!bench_run(suite, report, sizeof(report))) {
+            dualPrintf("{\"status\":\"error\",\"msg\":\"%s\"}\n", report);
+            return;
+        }
+        snprintf(reply, sizeof(reply), "{\"status\":\"ok\",\"suite\":\"%s\",\"results\":%s}",
+                 suite, report);
+        dualPrintln(reply);
+    }
     // ---- WiFi info ----
     else if (strcmp(cmd, "wifi") == 0) {
         if (s_wifi_ok) {
@@ -268,9 +2862,19 @@ static void handleCommand(const char *line) {
     }
     // ---- Face mode commands ----
     else if (strcmp(cmd, "face") == 0) {
+        // The decoder owns the compositor while a stream runs
+        if (s_stream.active) {
+            dualPrintln("{\"status\":\"error\",\"msg\":\"stream active\"}");
+            return;
+        }
         bool on = doc["on"] | false;
         face_set_enabled(on);
-        if (!on) display_fill(0x0000);  // Clear to black when leaving face mode
+        s_image_shown = false;
+        if (!on) {
+            // Clear to black when leaving face mode
+            compositor_set_solid(LAYER_IMAGE, 0x0000);
+            compositor_flush();
+        }
         dualPrintln("{\"status\":\"ok\"}");
     }
     else if (strcmp(cmd, "mouth") == 0) {
@@ -304,31 +2908,43 @@ void setup() {
 
     Serial.println("{\"status\":\"booting\"}");
 
-    // Connect WiFi and start TCP server
-    s_wifi_ok = wifi.begin();
-    if (s_wifi_ok) {
-        Serial.printf("{\"status\":\"wifi\",\"ip\":\"%s\",\"port\":%d}\n",
-                      wifi.ipAddress().c_str(), TCP_PORT);
+    // Initialize display hardware
+    if (!display_init()) {
+        Serial.println("{\"status\":\"error\",\"msg\":\"display init failed\"}");
+        return;
     }
 
-    // Allocate PSRAM buffers
-    jpeg_buf   = (uint8_t  *)heap_caps_malloc(MAX_JPEG_SIZE, MALLOC_CAP_SPIRAM);
-    decode_buf = (uint16_t *)heap_caps_malloc(FRAME_BYTES,   MALLOC_CAP_SPIRAM);
-    if (!jpeg_buf || !decode_buf) {
-        Serial.println("{\"status\":\"error\",\"msg\":\"PSRAM alloc failed\"}");
+    // Layer compositor (face / overlay buffers in PSRAM; the image
+    // layer allocates its own on first use)
+    if (!compositor_init()) {
+        Serial.println("{\"status\":\"error\",\"msg\":\"compositor alloc failed\"}");
         return;
     }
 
-    // Initialize display hardware
-    if (!display_init()) {
-        Serial.println("{\"status\":\"error\",\"msg\":\"display init failed\"}");
+    // JPEG receive buffers (PSRAM) + decode task
+    if (!decodeInit()) {
+        Serial.println("{\"status\":\"error\",\"msg\":\"PSRAM alloc failed\"}");
         return;
     }
 
+    // Flash assets; a splash goes up before WiFi starts connecting
+    bool splash = false;
+    if (asset_pack_init()) {
+        const AssetEntry *e = asset_find(ASSET_SPLASH);
+        splash = e && asset_verify(e) && !showAsset(e, false, TRANS_NONE, 0);
+    }
+
+    // Connect WiFi and start TCP server
+    s_wifi_ok = wifi.begin();
+    if (s_wifi_ok) {
+        Serial.printf("{\"status\":\"wifi\",\"ip\":\"%s\",\"port\":%d}\n",
+                      wifi.ipAddress().c_str(), TCP_PORT);
+    }
+
     // Initialize face renderer
     if (!face_init()) {
         Serial.println("{\"status\":\"warning\",\"msg\":\"face init failed (PSRAM?)\"}");
-    } else {
+    } else if (!splash) {
         face_set_enabled(true);  // Start in face mode by default
     }
 
@@ -347,8 +2963,14 @@ void loop() {
         wifi.poll();
     }
 
+    // --- Receive stream frames (that link carries no commands meanwhile) ---
+    if (s_stream.active) {
+        if (s_stream.source == STREAM_SOURCE_HTTP) mjpegPoll();
+        else streamPoll();
+    }
+
     // --- Check USB serial ---
-    if (Serial.available()) {
+    if (!(s_stream.active && s_stream.source == 0) && Serial.available()) {
         s_cmd_source = 0;
         String line = Serial.readStringUntil('\n');
         line.trim();
@@ -358,7 +2980,7 @@ void loop() {
     }
 
     // --- Check WiFi TCP ---
-    if (s_wifi_ok && wifi.available()) {
+    if (s_wifi_ok && !(s_stream.active && s_stream.source == 1) && wifi.available()) {
         String line = wifi.readLine();
         if (line.length() > 0) {
             s_cmd_source = 1;
@@ -374,6 +2996,11 @@ void loop() {
     if (tp.touched && (now - s_last_touch_event) > TOUCH_COOLDOWN_MS) {
         s_last_touch_event = now;
         dualPrintf("{\"event\":\"touch\",\"x\":%d,\"y\":%d}\n", tp.x, tp.y);
+        int cell = s_gallery.shown ? galleryHit(tp.x, tp.y) : -1;
+        if (cell >= 0) {
+            dualPrintf("{\"event\":\"gallery_tap\",\"slot\":\"%s\",\"index\":%d}\n",
+                       s_gallery.names[cell], cell);
+        }
         rp2040_tone(1500, 60);
     }
 
@@ -387,6 +3014,33 @@ void loop() {
         rp2040_tone(800, 40);
     }
 
+    // Report a decode that failed after its bytes were acknowledged
+    const char *err = s_decode_err;
+    if (err) {
+        s_decode_err = NULL;
+        if (s_stream.active) {
+            s_stream.stats.decode_errors++;
+        } else {
+            dualPrintf("{\"event\":\"image_error\",\"msg\":\"%s\"}\n", err);
+        }
+    }
+
+    // Step a running image transition (the decode task owns the
+    // compositor while it has frames)
+    if (!imageBusy()) {
+        compositor_update();
+    }
+
+    // Decode the next gallery thumbnail while a page is filling in
+    if (s_gallery.filling && !imageBusy()) {
+        galleryStep();
+    }
+
+    // Stream the next screenshot band, if one is in progress
+    if (s_shot.active) {
+        screenshotStep();
+    }
+
     // Render face animation (rate-limited internally)
     if (face_is_enabled()) {
         face_update();
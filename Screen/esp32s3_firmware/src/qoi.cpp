@@ -0,0 +1,230 @@
+/*
+ * QOI Encoder / Decoder - Implementation
+ *
+ * Follows the QOI 1.0 spec (qoiformat.org). Alpha is always 255, so
+ * QOI_OP_RGBA is never needed. Identical consecutive RGB565 values are
+ * detected before expansion, which keeps runs (the common case on UI
+ * frames) at one compare per pixel. The decoder converts each new pixel
+ * to RGB565 once and fills runs with the converted value; alpha is
+ * passed through only for callers that ask for it (sprites).
+ */
+
+#include "qoi.h"
+
+#define QOI_OP_INDEX  0x00
+#define QOI_OP_DIFF   0x40
+#define QOI_OP_LUMA   0x80
+#define QOI_OP_RUN    0xC0
+#define QOI_OP_RGB    0xFE
+#define QOI_OP_RGBA   0xFF
+#define QOI_MASK_2    0xC0
+#define QOI_MAX_RUN   62
+
+static inline uint32_t get32be(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint8_t *put32be(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+    return p + 4;
+}
+
+size_t qoi_encode_begin(QoiEncoder *e, int width, int height, uint8_t *out) {
+    memset(e->index, 0, sizeof(e->index));
+    e->prev565 = 0x0000;  // Spec start pixel is opaque black
+    e->pr = e->pg = e->pb = 0;
+    e->run = 0;
+
+    uint8_t *p = out;
+    *p++ = 'q';
+    *p++ = 'o';
+    *p++ = 'i';
+    *p++ = 'f';
+    p = put32be(p, width);
+    p = put32be(p, height);
+    *p++ = 3;   // RGB
+    *p++ = 0;   // sRGB with linear alpha
+    return p - out;
+}
+
+size_t qoi_encode_rgb565(QoiEncoder *e, const uint16_t *px, int n, uint8_t *out) {
+    uint8_t *p = out;
+    uint16_t prev565 = e->prev565;
+    int run = e->run;
+    int pr = e->pr, pg = e->pg, pb = e->pb;
+
+    for (int i = 0; i < n; i++) {
+        uint16_t c = px[i];
+        if (c == prev565) {
+            if (++run == QOI_MAX_RUN) {
+                *p++ = QOI_OP_RUN | (QOI_MAX_RUN - 1);
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            *p++ = QOI_OP_RUN | (run - 1);
+            run = 0;
+        }
+        prev565 = c;
+
+        int r = ((c >> 8) & 0xF8) | (c >> 13);
+        int g = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+        int b = ((c << 3) & 0xF8) | ((c >> 2) & 0x07);
+        uint32_t packed = ((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | 0xFF;
+        int h = (r * 3 + g * 5 + b * 7 + 255 * 11) & 63;
+
+        if (e->index[h] == packed) {
+            *p++ = QOI_OP_INDEX | h;
+        } else {
+            e->index[h] = packed;
+            int dr = (int8_t)(r - pr);
+            int dg = (int8_t)(g - pg);
+            int db = (int8_t)(b - pb);
+            int dr_dg = dr - dg;
+            int db_dg = db - dg;
+
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                *p++ = QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+            } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 &&
+                       db_dg >= -8 && db_dg <= 7) {
+                *p++ = QOI_OP_LUMA | (dg + 32);
+                *p++ = ((dr_dg + 8) << 4) | (db_dg + 8);
+            } else {
+                *p++ = QOI_OP_RGB;
+                *p++ = r;
+                *p++ = g;
+                *p++ = b;
+            }
+        }
+        pr = r;
+        pg = g;
+        pb = b;
+    }
+
+    e->prev565 = prev565;
+    e->run = run;
+    e->pr = pr;
+    e->pg = pg;
+    e->pb = pb;
+    return p - out;
+}
+
+size_t qoi_encode_end(QoiEncoder *e, uint8_t *out) {
+    uint8_t *p = out;
+    if (e->run) {
+        *p++ = QOI_OP_RUN | (e->run - 1);
+        e->run = 0;
+    }
+    static const uint8_t end_marker[QOI_END_SIZE] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+    memcpy(p, end_marker, QOI_END_SIZE);
+    return p + QOI_END_SIZE - out;
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+bool qoi_decode_begin(QoiDecoder *d, const uint8_t *hdr) {
+    if (memcmp(hdr, "qoif", 4) != 0) return false;
+    d->width = get32be(hdr + 4);
+    d->height = get32be(hdr + 8);
+    if (!d->width || !d->height || (hdr[12] != 3 && hdr[12] != 4)) return false;
+    memset(d->index, 0, sizeof(d->index));
+    d->r = d->g = d->b = 0;
+    d->a = 255;
+    d->px565 = 0x0000;
+    d->run = 0;
+    return true;
+}
+
+// Alpha is only written when the caller wants it (alpha != NULL)
+static int decode(QoiDecoder *d, const uint8_t *data, size_t avail, size_t *pos,
+                  uint16_t *out, uint8_t *alpha, int n) {
+    size_t p = *pos;
+    uint8_t r = d->r, g = d->g, b = d->b, a = d->a;
+    uint16_t px = d->px565;
+    int run = d->run;
+    int i = 0;
+
+    while (i < n) {
+        if (run) {
+            int k = min(run, n - i);
+            for (int j = 0; j < k; j++) out[i + j] = px;
+            if (alpha) memset(alpha + i, a, k);
+            i += k;
+            run -= k;
+            continue;
+        }
+        if (p >= avail) break;
+
+        uint8_t op = data[p];
+        if (op == QOI_OP_RGB) {
+            if (p + 4 > avail) break;
+            r = data[p + 1];
+            g = data[p + 2];
+            b = data[p + 3];
+            p += 4;
+        } else if (op == QOI_OP_RGBA) {
+            if (p + 5 > avail) break;
+            r = data[p + 1];
+            g = data[p + 2];
+            b = data[p + 3];
+            a = data[p + 4];
+            p += 5;
+        } else if ((op & QOI_MASK_2) == QOI_OP_INDEX) {
+            uint32_t v = d->index[op];
+            r = v >> 24;
+            g = v >> 16;
+            b = v >> 8;
+            a = v;
+            p++;
+        } else if ((op & QOI_MASK_2) == QOI_OP_DIFF) {
+            r += ((op >> 4) & 3) - 2;
+            g += ((op >> 2) & 3) - 2;
+            b += (op & 3) - 2;
+            p++;
+        } else if ((op & QOI_MASK_2) == QOI_OP_LUMA) {
+            if (p + 2 > avail) break;
+            int dg = (op & 0x3F) - 32;
+            uint8_t rb = data[p + 1];
+            r += dg - 8 + (rb >> 4);
+            g += dg;
+            b += dg - 8 + (rb & 0x0F);
+            p += 2;
+        } else {
+            // Run of the previous pixel (already indexed and converted)
+            run = (op & 0x3F) + 1;
+            p++;
+            continue;
+        }
+
+        d->index[(r * 3 + g * 5 + b * 7 + a * 11) & 63] =
+            ((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | a;
+        px = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+        if (alpha) alpha[i] = a;
+        out[i++] = px;
+    }
+
+    *pos = p;
+    d->r = r;
+    d->g = g;
+    d->b = b;
+    d->a = a;
+    d->px565 = px;
+    d->run = run;
+    return i;
+}
+
+int qoi_decode_rgb565(QoiDecoder *d, const uint8_t *data, size_t avail, size_t *pos,
+                      uint16_t *out, int n) {
+    return decode(d, data, avail, pos, out, NULL, n);
+}
+
+int qoi_decode_rgb565a(QoiDecoder *d, const uint8_t *data, size_t avail, size_t *pos,
+                       uint16_t *out, uint8_t *alpha, int n) {
+    return decode(d, data, avail, pos, out, alpha, n);
+}
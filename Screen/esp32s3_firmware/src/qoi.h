@@ -0,0 +1,63 @@
+/*
+ * QOI ("Quite OK Image") Encoder / Decoder for SenseCAP Indicator
+ *
+ * Streaming encoder for RGB565 pixels. Output is a standard 3-channel
+ * QOI file (RGB565 expanded to RGB888 by bit replication), so host
+ * tools can decode it with any QOI reader and recover exact RGB565.
+ * Flat regions collapse into 1-byte runs: a mostly solid face frame
+ * is a few KB instead of 460 KB.
+ *
+ * The encoder state carries across calls, so an image can be encoded
+ * a few rows at a time from loop() and sent as it is produced.
+ *
+ * The decoder is the reverse: any QOI file (RGB or RGBA; alpha is
+ * dropped unless asked for) to RGB565, resumable at any byte, so lossless UI frames can
+ * be drawn while they are still being received.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define QOI_HEADER_SIZE      14
+#define QOI_END_SIZE         8
+#define QOI_MAX_BYTES_PER_PX 4     // Worst case: QOI_OP_RGB
+
+struct QoiEncoder {
+    uint32_t index[64];   // Recently seen pixels (packed RGBA)
+    uint16_t prev565;
+    uint8_t  pr, pg, pb;  // Previous pixel, expanded
+    int      run;
+};
+
+// Reset the encoder and write the file header. Returns bytes written.
+size_t qoi_encode_begin(QoiEncoder *e, int width, int height, uint8_t *out);
+
+// Encode n pixels. out must hold n * QOI_MAX_BYTES_PER_PX bytes.
+// Returns bytes written (a pending run may be held until later calls).
+size_t qoi_encode_rgb565(QoiEncoder *e, const uint16_t *px, int n, uint8_t *out);
+
+// Flush the pending run and write the end marker. Returns bytes written.
+size_t qoi_encode_end(QoiEncoder *e, uint8_t *out);
+
+struct QoiDecoder {
+    uint32_t index[64];   // Recently seen pixels (packed RGBA)
+    uint8_t  r, g, b, a;  // Previous pixel
+    uint16_t px565;       // ...as RGB565
+    int      run;         // Repeats of it still to output
+    uint32_t width, height;
+};
+
+// Check the QOI_HEADER_SIZE byte header and reset the decoder.
+// False if it is not a QOI file.
+bool qoi_decode_begin(QoiDecoder *d, const uint8_t *hdr);
+
+// Decode up to n pixels from data[*pos, avail), advancing *pos. Returns
+// fewer when the next chunk is not all in yet.
+int qoi_decode_rgb565(QoiDecoder *d, const uint8_t *data, size_t avail, size_t *pos,
+                      uint16_t *out, int n);
+
+// As qoi_decode_rgb565, also writing each pixel's 8-bit alpha (255 for
+// RGB files)
+int qoi_decode_rgb565a(QoiDecoder *d, const uint8_t *data, size_t avail, size_t *pos,
+                       uint16_t *out, uint8_t *alpha, int n);
@@ -0,0 +1,45 @@
+/*
+ * RGB565 Run-Length Decoder - Implementation
+ */
+
+#include "rle565.h"
+
+void rle565_begin(Rle565 *r, const uint8_t *src, size_t len) {
+    r->src = src;
+    r->end = src + len;
+    r->pixel = 0;
+    r->run = 0;
+    r->lit = 0;
+}
+
+bool rle565_read(Rle565 *r, uint16_t *dst, int n) {
+    while (n > 0) {
+        if (r->run) {
+            int k = min(n, r->run);
+            for (int i = 0; i < k; i++) dst[i] = r->pixel;
+            dst += k;
+            n -= k;
+            r->run -= k;
+        } else if (r->lit) {
+            int k = min(n, r->lit);
+            if (r->end - r->src < k * 2) return false;
+            memcpy(dst, r->src, k * 2);
+            r->src += k * 2;
+            dst += k;
+            n -= k;
+            r->lit -= k;
+        } else {
+            if (r->src >= r->end) return false;
+            uint8_t h = *r->src++;
+            if (h < 0x80) {
+                r->lit = h + 1;
+            } else {
+                if (r->end - r->src < 2) return false;
+                memcpy(&r->pixel, r->src, 2);
+                r->src += 2;
+                r->run = h - 0x7E;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,27 @@
+/*
+ * RGB565 Run-Length Decoder for SenseCAP Indicator
+ *
+ * Packed pixel streams from the host (tile updates). A stream is a
+ * sequence of packets, each a header byte h and then:
+ *   h <  0x80: h + 1 literal pixels (2 bytes each, little-endian)
+ *   h >= 0x80: one pixel, repeated h - 0x7E times (2..129)
+ * Packets may span whatever pieces the caller unpacks, so a stream can
+ * be read a tile row at a time.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+struct Rle565 {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint16_t pixel;     // Pixel being repeated
+    int      run;       // Repeats left
+    int      lit;       // Literals left
+};
+
+void rle565_begin(Rle565 *r, const uint8_t *src, size_t len);
+
+// Unpack the next n pixels. False if the stream ends or is malformed.
+bool rle565_read(Rle565 *r, uint16_t *dst, int n);
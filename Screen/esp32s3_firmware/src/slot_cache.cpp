@@ -0,0 +1,118 @@
+/*
+ * Named Image Slot Cache - Implementation
+ *
+ * A handful of slots, so a linear scan is all the lookup needs.
+ */
+
+#include "slot_cache.h"
+#include "esp_heap_caps.h"
+
+static Slot     s_slots[SLOT_CACHE_MAX];
+static int      s_count = 0;
+static uint32_t s_clock = 0;
+static size_t   s_budget = SLOT_CACHE_BUDGET;
+static size_t   s_used = 0;
+
+static int indexOf(const char *name) {
+    for (int i = 0; i < s_count; i++) {
+        if (strcmp(s_slots[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static void removeAt(int i) {
+    heap_caps_free(s_slots[i].data);
+    s_used -= s_slots[i].size;
+    s_slots[i] = s_slots[--s_count];
+}
+
+static int oldest() {
+    int best = 0;
+    for (int i = 1; i < s_count; i++) {
+        if (s_slots[i].used < s_slots[best].used) best = i;
+    }
+    return best;
+}
+
+Slot *slot_cache_find(const char *name) {
+    int i = indexOf(name);
+    if (i < 0) return NULL;
+    s_slots[i].used = ++s_clock;
+    return &s_slots[i];
+}
+
+// Replace name and evict down to room for size more bytes in one more
+// slot; false (nothing dropped) if it could never fit
+static bool makeRoom(const char *name, uint32_t size, int *evicted) {
+    if (evicted) *evicted = 0;
+    if (!name[0] || strlen(name) >= SLOT_NAME_LEN || !size || size > s_budget) return false;
+
+    int i = indexOf(name);
+    if (i >= 0) removeAt(i);
+    while (s_count && (s_count == SLOT_CACHE_MAX || s_used + size > s_budget)) {
+        removeAt(oldest());
+        if (evicted) (*evicted)++;
+    }
+    return true;
+}
+
+static Slot *insert(const char *name, uint8_t *data, uint32_t size) {
+    Slot &s = s_slots[s_count++];
+    memset(&s, 0, sizeof(s));
+    strcpy(s.name, name);
+    s.data = data;
+    s.size = size;
+    s.used = ++s_clock;
+    s_used += size;
+    return &s;
+}
+
+Slot *slot_cache_alloc(const char *name, uint32_t size, int *evicted) {
+    if (!makeRoom(name, size, evicted)) return NULL;
+
+    // PSRAM can be short of the budget (other buffers grow on demand)
+    uint8_t *data;
+    while (!(data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM))) {
+        if (!s_count) return NULL;
+        removeAt(oldest());
+        if (evicted) (*evicted)++;
+    }
+    return insert(name, data, size);
+}
+
+Slot *slot_cache_adopt(const char *name, uint8_t *data, uint32_t size, int *evicted) {
+    if (!makeRoom(name, size, evicted)) return NULL;
+    return insert(name, data, size);
+}
+
+bool slot_cache_evict(const char *name) {
+    int i = indexOf(name);
+    if (i < 0) return false;
+    removeAt(i);
+    return true;
+}
+
+void slot_cache_clear() {
+    while (s_count) removeAt(s_count - 1);
+}
+
+void slot_cache_set_budget(size_t bytes) {
+    s_budget = bytes;
+    while (s_count && s_used > s_budget) removeAt(oldest());
+}
+
+size_t slot_cache_budget() {
+    return s_budget;
+}
+
+size_t slot_cache_used() {
+    return s_used;
+}
+
+int slot_cache_count() {
+    return s_count;
+}
+
+const Slot *slot_cache_at(int i) {
+    return i >= 0 && i < s_count ? &s_slots[i] : NULL;
+}
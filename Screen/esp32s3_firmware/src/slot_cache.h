@@ -0,0 +1,56 @@
+/*
+ * Named Image Slot Cache for SenseCAP Indicator
+ *
+ * Images the host shows again and again (idle screen, prompts, result
+ * cards) are kept in PSRAM under a short name, either as a decoded
+ * RGB565 frame (shown with one copy) or as the compressed bytes (decoded
+ * again on show, several times smaller). The slots share a byte budget;
+ * storing past it evicts the least recently used slots first.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define SLOT_CACHE_MAX      16
+#define SLOT_NAME_LEN       16              // Including the terminator
+#define SLOT_CACHE_BUDGET   (2 * 1024 * 1024)
+
+struct Slot {
+    char     name[SLOT_NAME_LEN];
+    uint8_t *data;
+    uint32_t size;
+    uint32_t used;          // LRU stamp
+    bool     frame;         // Decoded frame, else compressed image bytes
+    uint8_t  format;        // Compressed: caller's image format
+    bool     cover;         // Compressed: caller's fit flag
+};
+
+// Slot pointers stay valid until the next alloc / evict / budget change.
+
+// Slot with this name (and mark it used), or NULL
+Slot *slot_cache_find(const char *name);
+
+// New slot of size bytes under name, replacing one with the same name
+// and evicting the least recently used until it fits the budget. NULL
+// if it is bigger than the budget, the name is too long or PSRAM runs
+// out. *evicted (optional) counts the slots dropped to make room.
+Slot *slot_cache_alloc(const char *name, uint32_t size, int *evicted);
+
+// Like slot_cache_alloc() but for data the caller already filled
+// (heap_caps_malloc'd from PSRAM); the cache owns it from then on. NULL
+// if it cannot fit, and data stays the caller's.
+Slot *slot_cache_adopt(const char *name, uint8_t *data, uint32_t size, int *evicted);
+
+// Drop one slot (false if there is none by that name), or all of them
+bool slot_cache_evict(const char *name);
+void slot_cache_clear();
+
+// Budget changes evict down to the new size
+void   slot_cache_set_budget(size_t bytes);
+size_t slot_cache_budget();
+size_t slot_cache_used();
+
+// Slots in no particular order, for listing
+int slot_cache_count();
+const Slot *slot_cache_at(int i);
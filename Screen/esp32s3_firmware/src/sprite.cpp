@@ -0,0 +1,100 @@
+/*
+ * Frame Sprites - Implementation
+ *
+ * Sprites are small, so they live in internal RAM when it has room (the
+ * blend reads them for every block they overlap) and in PSRAM otherwise.
+ * Blocks that miss every sprite cost one rect test per sprite.
+ */
+
+#include "sprite.h"
+#include "compositor.h"
+#include "esp_heap_caps.h"
+
+static Sprite s_sprites[SPRITE_MAX];
+static int    s_count = 0;
+
+static int indexOf(const char *name) {
+    for (int i = 0; i < s_count; i++) {
+        if (strcmp(s_sprites[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static void removeAt(int i) {
+    heap_caps_free(s_sprites[i].pixels);
+    heap_caps_free(s_sprites[i].alpha);
+    s_sprites[i] = s_sprites[--s_count];
+}
+
+static void *spriteMalloc(size_t size) {
+    void *p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+
+Sprite *sprite_alloc(const char *name, int w, int h) {
+    if (!name[0] || strlen(name) >= SPRITE_NAME_LEN || w <= 0 || h <= 0 ||
+        w > LCD_H_RES || h > LCD_V_RES) {
+        return NULL;
+    }
+    int i = indexOf(name);
+    if (i >= 0) removeAt(i);
+    if (s_count == SPRITE_MAX) return NULL;
+
+    Sprite &s = s_sprites[s_count];
+    memset(&s, 0, sizeof(s));
+    strcpy(s.name, name);
+    s.w = w;
+    s.h = h;
+    s.pixels = (uint16_t *)spriteMalloc(w * h * sizeof(uint16_t));
+    s.alpha = (uint8_t *)spriteMalloc(w * h);
+    if (!s.pixels || !s.alpha) {
+        heap_caps_free(s.pixels);
+        heap_caps_free(s.alpha);
+        return NULL;
+    }
+    s_count++;
+    return &s;
+}
+
+Sprite *sprite_find(const char *name) {
+    int i = indexOf(name);
+    return i < 0 ? NULL : &s_sprites[i];
+}
+
+bool sprite_remove(const char *name) {
+    int i = indexOf(name);
+    if (i < 0) return false;
+    removeAt(i);
+    return true;
+}
+
+void sprite_clear() {
+    while (s_count) removeAt(s_count - 1);
+}
+
+int sprite_count() {
+    return s_count;
+}
+
+const Sprite *sprite_at(int i) {
+    return i >= 0 && i < s_count ? &s_sprites[i] : NULL;
+}
+
+void sprite_blend(int x, int y, int w, int h, uint16_t *pixels) {
+    for (int i = 0; i < s_count; i++) {
+        const Sprite &s = s_sprites[i];
+        int x0 = max(x, (int)s.x), x1 = min(x + w, s.x + s.w);
+        int y0 = max(y, (int)s.y), y1 = min(y + h, s.y + s.h);
+        if (x0 >= x1 || y0 >= y1) continue;
+        for (int py = y0; py < y1; py++) {
+            uint16_t *dst = pixels + (py - y) * w + (x0 - x);
+            int off = (py - s.y) * s.w + (x0 - s.x);
+            const uint16_t *src = s.pixels + off;
+            const uint8_t *a = s.alpha + off;
+            for (int n = 0; n < x1 - x0; n++) {
+                if (a[n] == COMP_ALPHA_MAX) dst[n] = src[n];
+                else if (a[n]) dst[n] = lerp565(dst[n], src[n], a[n]);
+            }
+        }
+    }
+}
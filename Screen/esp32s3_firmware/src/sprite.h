@@ -0,0 +1,47 @@
+/*
+ * Frame Sprites for SenseCAP Indicator
+ *
+ * Small images (buttons, badges) registered once and blended into every
+ * frame as it is decoded, so the host can stream clean camera frames
+ * and the UI on top of them costs it nothing. Unlike the overlay layer
+ * they do not force decodes through the image layer: blocks are blended
+ * on their way to the screen, direct draws included. A sprite is baked
+ * into the frames decoded while it is set; moving or removing one shows
+ * from the next frame on.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define SPRITE_MAX       4
+#define SPRITE_NAME_LEN  16     // Including the terminator
+
+struct Sprite {
+    char      name[SPRITE_NAME_LEN];
+    int16_t   x, y;             // Screen position of the top-left pixel
+    uint16_t  w, h;
+    uint16_t *pixels;           // RGB565, w * h
+    uint8_t  *alpha;            // 0..COMP_ALPHA_MAX, w * h
+};
+
+// Sprite pointers stay valid until the next alloc / remove / clear, none
+// of which may run while a frame is decoding.
+
+// New w x h sprite under name (replacing one with the same name), for
+// the caller to fill. NULL if the name is bad, all SPRITE_MAX are in use
+// or memory runs out.
+Sprite *sprite_alloc(const char *name, int w, int h);
+
+Sprite *sprite_find(const char *name);
+
+// Drop one sprite (false if there is none by that name), or all of them
+bool sprite_remove(const char *name);
+void sprite_clear();
+
+int sprite_count();
+const Sprite *sprite_at(int i);
+
+// Blend the sprites into a block of pixels (stride = w) that is about to
+// be drawn at screen x, y
+void sprite_blend(int x, int y, int w, int h, uint16_t *pixels);
@@ -0,0 +1,357 @@
+#!/usr/bin/env python3
+"""
+Generate src/bench_jpeg.h and src/bench_ui.h - the reference images for
+{"cmd":"bench"}.
+
+The JPEG is a deterministic 480x480 test card (gradients, flat shapes,
+fine stripes and a noise patch) so decode timings are comparable across
+firmware builds. It is encoded with the small baseline encoder below
+(4:2:0, standard Huffman tables) so the output does not depend on the
+installed Pillow/libjpeg version.
+
+bench_ui.h holds a typical UI frame (flat panels, text, icons, a
+gradient bar) both as JPEG and as QOI, to compare the two formats.
+
+Needs only the Python standard library (no Pillow).
+
+Usage:
+    python tools/gen_bench_jpeg.py [--quality 80] [--out src/bench_jpeg.h]
+                                   [--ui-out src/bench_ui.h]
+"""
+
+import argparse
+import math
+import os
+
+W = H = 480
+
+# ----------------------------------------------------------------------
+# Test card
+# ----------------------------------------------------------------------
+
+def test_card():
+    """Return rows of (r, g, b) tuples."""
+    seed = 12345
+    rows = []
+    for y in range(H):
+        row = []
+        for x in range(W):
+            # Diagonal background gradient
+            r = int(40 + 160 * x / W)
+            g = int(30 + 120 * y / H)
+            b = int(120 + 100 * (x + y) / (W + H))
+
+            # Flat disc (UI-like solid area)
+            if (x - 150) ** 2 + (y - 160) ** 2 < 90 ** 2:
+                r, g, b = 240, 200, 40
+            # Ring
+            d = math.hypot(x - 330, y - 150)
+            if 60 < d < 75:
+                r, g, b = 30, 220, 120
+            # Fine vertical stripes (high frequency detail)
+            if 280 < y < 340 and 40 < x < 440 and (x // 3) % 2 == 0:
+                r, g, b = 250, 250, 250
+            # Noise patch (photo-like texture)
+            if y > 360 and x > 240:
+                seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+                n = (seed >> 16) % 64 - 32
+                r = max(0, min(255, r + n))
+                g = max(0, min(255, g + n))
+                b = max(0, min(255, b + n))
+            row.append((r, g, b))
+        rows.append(row)
+    return rows
+
+
+def ui_card():
+    """A UI screen in RGB565 colors (what the panel can show): dark
+    background, title bar, cards with text lines, icons and a gradient
+    progress bar. Returns rows of (r, g, b) tuples."""
+    bg = (18, 20, 28)
+    pixels = [[bg] * W for _ in range(H)]
+
+    def rect(x0, y0, x1, y1, c):
+        for y in range(y0, y1):
+            pixels[y][x0:x1] = [c] * (x1 - x0)
+
+    def text(x, y, chars, c, seed):
+        # Glyph-like 5x7 cells of on/off pixels, 1 px spacing
+        for i in range(chars):
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            if (seed >> 16) % 7 == 0:
+                continue                    # Word gap
+            for gy in range(7):
+                bits = (seed >> (gy * 3)) | (1 << gy)
+                for gx in range(5):
+                    if (bits >> gx) & 1:
+                        pixels[y + gy][x + i * 6 + gx] = c
+
+    rect(0, 0, W, 48, (40, 60, 120))                 # Title bar
+    text(16, 20, 18, (240, 240, 240), 1)
+    for k in range(3):                               # Cards
+        y0 = 64 + k * 120
+        rect(16, y0, W - 16, y0 + 104, (36, 40, 52))
+        rect(16, y0, 20, y0 + 104, ((255, 160, 0), (0, 200, 120), (80, 140, 255))[k])
+        for cy in range(y0 + 24, y0 + 80):           # Round icon
+            for cx in range(40, 96):
+                if (cx - 68) ** 2 + (cy - y0 - 52) ** 2 < 26 ** 2:
+                    pixels[cy][cx] = (200, 200, 220)
+        for line in range(4):
+            text(112, y0 + 16 + line * 20, 50 - line * 9, (200, 204, 212), k * 4 + line + 7)
+    for x in range(24, W - 24):                      # Progress bar
+        t = (x - 24) / (W - 48)
+        rect(x, 440, x + 1, 456, (int(40 + 200 * t), int(200 - 80 * t), 255 - int(120 * t)))
+
+    def rgb565(c):
+        r, g, b = c[0] & 0xF8, c[1] & 0xFC, c[2] & 0xF8
+        return (r | r >> 5, g | g >> 6, b | b >> 5)
+    return [[rgb565(c) for c in row] for row in pixels]
+
+# ----------------------------------------------------------------------
+# Baseline JPEG encoder
+# ----------------------------------------------------------------------
+
+ZIGZAG = [
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+]
+
+Q_LUMA = [
+    16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99,
+]
+Q_CHROMA = [
+    17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+] + [99] * 32
+
+# Standard Huffman tables (JPEG Annex K): (bits[16], values)
+DC_LUMA = ([0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0], list(range(12)))
+DC_CHROMA = ([0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0], list(range(12)))
+AC_LUMA = ([0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D], bytes.fromhex(
+    "01020300041105122131410613516107227114328191a1082342b1c11552d1f02433627282090a161718191a25262728292a3435363738393a434445464748494a535455565758595a636465666768696a737475767778797a838485868788898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4f5f6f7f8f9fa"))
+AC_CHROMA = ([0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77], bytes.fromhex(
+    "000102031104052131061241510761711322328108144291a1b1c109233352f0156272d10a162434e125f11718191a262728292a35363738393a434445464748494a535455565758595a636465666768696a737475767778797a82838485868788898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4f5f6f7f8f9fa"))
+
+
+def huff_codes(table):
+    bits, vals = table
+    codes, code, k = {}, 0, 0
+    for length in range(1, 17):
+        for _ in range(bits[length - 1]):
+            codes[vals[k]] = (code, length)
+            code += 1
+            k += 1
+        code <<= 1
+    return codes
+
+
+def scaled_quant(base, quality):
+    scale = 5000 // quality if quality < 50 else 200 - quality * 2
+    return [max(1, min(255, (q * scale + 50) // 100)) for q in base]
+
+
+# Separable DCT-II basis
+COS = [[(math.sqrt(0.125) if u == 0 else 0.5) * math.cos((2 * x + 1) * u * math.pi / 16)
+        for x in range(8)] for u in range(8)]
+
+
+def fdct(block):
+    tmp = [[sum(COS[u][x] * block[y * 8 + x] for x in range(8)) for u in range(8)] for y in range(8)]
+    return [sum(COS[v][y] * tmp[y][u] for y in range(8)) for v in range(8) for u in range(8)]
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, code, length):
+        self.acc = (self.acc << length) | code
+        self.n += length
+        while self.n >= 8:
+            self.n -= 8
+            byte = (self.acc >> self.n) & 0xFF
+            self.out.append(byte)
+            if byte == 0xFF:
+                self.out.append(0)
+        self.acc &= (1 << self.n) - 1
+
+    def flush(self):
+        if self.n:
+            self.put((1 << (8 - self.n)) - 1, 8 - self.n)
+
+
+def magnitude(v):
+    n = abs(v).bit_length()
+    return n, (v if v >= 0 else v + (1 << n) - 1)
+
+
+def encode_block(bw, block, quant, prev_dc, dc_codes, ac_codes):
+    coef = fdct([p - 128 for p in block])
+    q = [int(round(coef[ZIGZAG[i]] / quant[i])) for i in range(64)]
+
+    diff = q[0] - prev_dc
+    n, bits = magnitude(diff)
+    bw.put(*dc_codes[n])
+    if n:
+        bw.put(bits, n)
+
+    run = 0
+    for i in range(1, 64):
+        if q[i] == 0:
+            run += 1
+            continue
+        while run > 15:
+            bw.put(*ac_codes[0xF0])
+            run -= 16
+        n, bits = magnitude(q[i])
+        bw.put(*ac_codes[(run << 4) | n])
+        bw.put(bits, n)
+        run = 0
+    if run:
+        bw.put(*ac_codes[0x00])
+    return q[0]
+
+
+def encode_jpeg(rows, quality):
+    ql = scaled_quant(Q_LUMA, quality)
+    qc = scaled_quant(Q_CHROMA, quality)
+    ycc = [[(0.299 * r + 0.587 * g + 0.114 * b,
+             -0.168736 * r - 0.331264 * g + 0.5 * b + 128,
+             0.5 * r - 0.418688 * g - 0.081312 * b + 128) for (r, g, b) in row] for row in rows]
+
+    dcl, acl = huff_codes(DC_LUMA), huff_codes(AC_LUMA)
+    dcc, acc = huff_codes(DC_CHROMA), huff_codes(AC_CHROMA)
+    bw = BitWriter()
+    pdc = [0, 0, 0]
+    for my in range(0, H, 16):
+        for mx in range(0, W, 16):
+            for by in (0, 8):
+                for bx in (0, 8):
+                    blk = [ycc[my + by + y][mx + bx + x][0] for y in range(8) for x in range(8)]
+                    pdc[0] = encode_block(bw, blk, ql, pdc[0], dcl, acl)
+            for c in (1, 2):
+                blk = [sum(ycc[my + 2 * y + j][mx + 2 * x + i][c] for j in (0, 1) for i in (0, 1)) / 4
+                       for y in range(8) for x in range(8)]
+                pdc[c] = encode_block(bw, blk, qc, pdc[c], dcc, acc)
+    bw.flush()
+
+    def seg(marker, payload):
+        return bytes([0xFF, marker]) + (len(payload) + 2).to_bytes(2, "big") + payload
+
+    out = bytearray(b"\xFF\xD8")
+    out += seg(0xE0, b"JFIF\x00\x01\x01\x00\x00\x01\x00\x01\x00\x00")
+    out += seg(0xDB, bytes([0]) + bytes(ql) + bytes([1]) + bytes(qc))
+    out += seg(0xC0, bytes([8]) + H.to_bytes(2, "big") + W.to_bytes(2, "big") +
+               bytes([3, 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1]))
+    for cls_id, (bits, vals) in ((0x00, DC_LUMA), (0x10, AC_LUMA), (0x01, DC_CHROMA), (0x11, AC_CHROMA)):
+        out += seg(0xC4, bytes([cls_id]) + bytes(bits) + bytes(vals))
+    out += seg(0xDA, bytes([3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0]))
+    out += bw.out + b"\xFF\xD9"
+    return bytes(out)
+
+# ----------------------------------------------------------------------
+# QOI encoder (qoiformat.org, 3 channels)
+# ----------------------------------------------------------------------
+
+def encode_qoi(rows):
+    out = bytearray(b"qoif" + W.to_bytes(4, "big") + H.to_bytes(4, "big") + bytes([3, 0]))
+    index = [None] * 64
+    prev = (0, 0, 0)
+    run = 0
+    for px in (px for row in rows for px in row):
+        if px == prev:
+            run += 1
+            if run == 62:
+                out.append(0xC0 | 61)
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        r, g, b = px
+        h = (r * 3 + g * 5 + b * 7 + 255 * 11) % 64
+        if index[h] == px:
+            out.append(h)
+        else:
+            index[h] = px
+            dr = (r - prev[0] + 128) % 256 - 128
+            dg = (g - prev[1] + 128) % 256 - 128
+            db = (b - prev[2] + 128) % 256 - 128
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out += bytes([0x80 | (dg + 32), (dr - dg + 8) << 4 | (db - dg + 8)])
+            else:
+                out += bytes([0xFE, r, g, b])
+        prev = px
+    if run:
+        out.append(0xC0 | (run - 1))
+    return bytes(out + bytes(7) + b"\x01")
+
+# ----------------------------------------------------------------------
+# Header output
+# ----------------------------------------------------------------------
+
+def write_header(path, comment, arrays):
+    """arrays: (NAME, bytes) pairs, each written as NAME[NAME_SIZE]."""
+    lines = ["/*"] + [(" * " + c).rstrip() for c in comment] + [
+        " *",
+        " * Generated by tools/gen_bench_jpeg.py - do not edit.",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+    ]
+    for name, data in arrays:
+        lines += [
+            "",
+            f"#define {name}_SIZE  {len(data)}",
+            "",
+            f"static const uint8_t {name}[{name}_SIZE] = {{",
+        ]
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+        lines.append("};")
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--quality", type=int, default=80)
+    ap.add_argument("--out", default=os.path.join(here, "..", "src", "bench_jpeg.h"))
+    ap.add_argument("--ui-out", default=os.path.join(here, "..", "src", "bench_ui.h"))
+    ap.add_argument("--jpeg", help="Also write the raw .jpg here")
+    args = ap.parse_args()
+
+    data = encode_jpeg(test_card(), args.quality)
+    write_header(args.out, [
+        "Reference JPEG for the bench command (480x480 test card, 4:2:0,",
+        f"quality {args.quality}, {len(data)} bytes).",
+    ], [("BENCH_JPEG", data)])
+    if args.jpeg:
+        with open(args.jpeg, "wb") as f:
+            f.write(data)
+    print(f"{args.out}: {len(data)} bytes")
+
+    ui = ui_card()
+    ui_jpeg = encode_jpeg(ui, args.quality)
+    ui_qoi = encode_qoi(ui)
+    write_header(args.ui_out, [
+        "Reference UI frame for the bench command (480x480, RGB565 colors) as",
+        f"JPEG (4:2:0, quality {args.quality}, {len(ui_jpeg)} bytes) and QOI ({len(ui_qoi)} bytes).",
+    ], [("BENCH_UI_JPEG", ui_jpeg), ("BENCH_UI_QOI", ui_qoi)])
+    print(f"{args.ui_out}: {len(ui_jpeg)} + {len(ui_qoi)} bytes")
+
+
+if __name__ == "__main__":
+    main()
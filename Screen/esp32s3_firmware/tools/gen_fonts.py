@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Generate src/font_data.h - the anti-aliased bitmap fonts for
+{"cmd":"text"}.
+
+Each size is printable ASCII (32-126) rasterized with FreeType through
+Pillow, cropped per glyph and stored as 4-bit coverage (two pixels per
+byte, row-major, high nibble first). Kerning is not kept; advances are
+rounded to whole pixels.
+
+Needs Pillow with FreeType (pip install Pillow).
+
+Usage:
+    python tools/gen_fonts.py [--font DejaVuSans.ttf] [--sizes 16,24,32,48]
+                              [--out src/font_data.h]
+"""
+
+import argparse
+import os
+
+from PIL import Image, ImageDraw, ImageFont
+
+FIRST, LAST = 32, 126
+DEFAULT_FONTS = [
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/TTF/DejaVuSans.ttf",
+    "/Library/Fonts/DejaVuSans.ttf",
+    "C:/Windows/Fonts/DejaVuSans.ttf",
+]
+
+
+def rasterize(font, ch):
+    """-> (x, y, width, height, advance, 4-bit coverage values)."""
+    left, top, right, bottom = font.getbbox(ch)
+    advance = round(font.getlength(ch))
+    w, h = max(right - left, 0), max(bottom - top, 0)
+    if not w or not h:
+        return 0, 0, 0, 0, advance, []
+    img = Image.new("L", (w, h), 0)
+    ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255)
+    cov = [(v * 15 + 127) // 255 for v in img.tobytes()]
+    return left, top, w, h, advance, cov
+
+
+def pack_nibbles(values):
+    if len(values) % 2:
+        values = values + [0]
+    return bytes((values[i] << 4) | values[i + 1] for i in range(0, len(values), 2))
+
+
+def build(path, size):
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs, bitmap = [], bytearray()
+    for code in range(FIRST, LAST + 1):
+        x, y, w, h, adv, cov = rasterize(font, chr(code))
+        glyphs.append((len(bitmap), w, h, x, y, adv))
+        bitmap += pack_nibbles(cov)
+    return ascent + descent, glyphs, bytes(bitmap)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--font", help="TrueType file (default: DejaVu Sans)")
+    ap.add_argument("--sizes", default="16,24,32,48", help="pixel sizes (em)")
+    ap.add_argument("--out", default=os.path.join(here, "..", "src", "font_data.h"))
+    args = ap.parse_args()
+
+    path = args.font or next((p for p in DEFAULT_FONTS if os.path.exists(p)), None)
+    if not path:
+        ap.error("DejaVuSans.ttf not found, pass --font")
+    sizes = sorted(int(s) for s in args.sizes.split(","))
+    name = os.path.splitext(os.path.basename(path))[0]
+
+    lines = [
+        "/*",
+        f" * Anti-aliased bitmap fonts for the text command: {name},",
+        " * " + ", ".join(str(s) for s in sizes) + f" px, ASCII {FIRST}-{LAST}, 4-bit coverage (see font.h).",
+        " *",
+        " * Generated by tools/gen_fonts.py - do not edit.",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        '#include "font.h"',
+    ]
+    total = 0
+    for size in sizes:
+        height, glyphs, bitmap = build(path, size)
+        total += len(bitmap) + len(glyphs) * 8
+        lines += ["", f"static const uint8_t FONT_{size}_BITMAP[{len(bitmap)}] = {{"]
+        for i in range(0, len(bitmap), 16):
+            lines.append("    " + ", ".join(f"0x{b:02X}" for b in bitmap[i:i + 16]) + ",")
+        lines += ["};", "", f"static const FontGlyph FONT_{size}_GLYPHS[{len(glyphs)}] = {{"]
+        for code, (off, w, h, x, y, adv) in zip(range(FIRST, LAST + 1), glyphs):
+            ch = {" ": "space", "\\": "backslash"}.get(chr(code), chr(code))
+            lines.append(f"    {{ {off}, {w}, {h}, {x}, {y}, {adv} }},  // {ch}")
+        lines += ["};", "",
+                  f"static const Font FONT_{size} = {{ {size}, {height}, {FIRST}, {LAST - FIRST + 1}, "
+                  f"FONT_{size}_GLYPHS, FONT_{size}_BITMAP }};"]
+        print(f"{size} px: line {height}, {len(bitmap)} bitmap bytes")
+
+    lines += ["", "static const Font *const FONTS[] = { "
+              + ", ".join(f"&FONT_{s}" for s in sizes) + " };",
+              f"#define FONT_COUNT  {len(sizes)}"]
+    with open(args.out, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print(f"{args.out}: {total} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Pack a directory of images into the "assets" flash partition image
+(see src/asset_pack.h), to be shown with {"cmd":"show","asset":name}.
+
+Each file becomes one asset named after it (without the extension, at
+most 15 characters):
+
+    .jpg / .jpeg       stored as is (JPEG)
+    .qoi               stored as is (QOI)
+    .rgb565 / .raw     stored as is (480x480 little-endian RGB565 frame)
+    .png / .bmp / .gif converted to QOI, or with --rgb565 to a raw frame
+                       (scaled to cover 480x480)
+
+An asset named "splash" is shown at boot. Flash the result with the
+printed esptool command; single assets can also be replaced later over
+the link (SenseCapController.asset_upload).
+
+Usage:
+    python tools/pack_assets.py assets/ [--out assets.bin] [--rgb565]
+                                        [--partitions partitions.csv]
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "..", "controller"))
+
+from sensecap_controller import DISPLAY_W, DISPLAY_H, SenseCapController  # noqa: E402
+
+MAGIC = b"SCAP"
+VERSION = 1
+NAME_LEN = 16
+SECTOR = 4096
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<16sIIIB3x")
+MAX_ASSETS = (SECTOR - HEADER.size) // ENTRY.size
+FRAME_BYTES = DISPLAY_W * DISPLAY_H * 2
+
+FORMATS = {"jpeg": 0, "qoi": 1, "rgb565": 2}
+CONVERT = (".png", ".bmp", ".gif")
+
+
+def load_asset(path, rgb565):
+    """Return (format, bytes) for one file, or None to skip it."""
+    ext = os.path.splitext(path)[1].lower()
+    if ext in (".jpg", ".jpeg", ".qoi", ".rgb565", ".raw"):
+        with open(path, "rb") as f:
+            data = f.read()
+        if ext == ".qoi":
+            return "qoi", data
+        if ext in (".rgb565", ".raw"):
+            if len(data) != FRAME_BYTES:
+                raise ValueError(f"{path}: raw frame must be {FRAME_BYTES} bytes")
+            return "rgb565", data
+        return "jpeg", data
+    if ext in CONVERT:
+        from PIL import Image
+        img = Image.open(path).convert("RGB")
+        if rgb565:
+            img = SenseCapController._resize_cover(img, DISPLAY_W, DISPLAY_H)
+            return "rgb565", SenseCapController.to_rgb565(img)
+        return "qoi", SenseCapController.qoi_encode(img)
+    return None
+
+
+def pack(assets, size):
+    """assets: [(name, format, data)] -> partition image bytes."""
+    if len(assets) > MAX_ASSETS:
+        raise ValueError(f"at most {MAX_ASSETS} assets")
+    entries = b""
+    body = bytearray()
+    offset = SECTOR
+    for name, fmt, data in assets:
+        raw = name.encode()
+        if not raw or len(raw) >= NAME_LEN:
+            raise ValueError(f"bad asset name {name!r} (1-{NAME_LEN - 1} bytes)")
+        entries += ENTRY.pack(raw, offset, len(data), zlib.crc32(data), FORMATS[fmt])
+        padded = -(-len(data) // SECTOR) * SECTOR
+        body += data + b"\xff" * (padded - len(data))
+        offset += padded
+    if offset > size:
+        raise ValueError(f"assets need {offset} bytes, partition has {size}")
+    header = HEADER.pack(MAGIC, VERSION, len(assets), zlib.crc32(entries), 0)
+    directory = header + entries
+    return directory + b"\xff" * (SECTOR - len(directory)) + body
+
+
+def find_partition(csv_path):
+    """(offset, size) of the "assets" partition in a partition table."""
+    with open(csv_path) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if cols[0] == "assets":
+                return int(cols[3], 0), int(cols[4], 0)
+    raise ValueError(f"no assets partition in {csv_path}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("dir", help="directory of images")
+    ap.add_argument("--out", default="assets.bin")
+    ap.add_argument("--rgb565", action="store_true",
+                    help="convert PNG/BMP/GIF to raw frames instead of QOI")
+    ap.add_argument("--partitions", default=os.path.join(HERE, "..", "partitions.csv"))
+    args = ap.parse_args()
+
+    offset, size = find_partition(args.partitions)
+    assets = []
+    for fname in sorted(os.listdir(args.dir)):
+        loaded = load_asset(os.path.join(args.dir, fname), args.rgb565)
+        if loaded:
+            assets.append((os.path.splitext(fname)[0],) + loaded)
+    image = pack(assets, size)
+    with open(args.out, "wb") as f:
+        f.write(image)
+
+    for name, fmt, data in assets:
+        print(f"  {name:<16} {fmt:<7} {len(data):>8} bytes")
+    print(f"{len(assets)} assets, {len(image)} of {size} bytes -> {args.out}")
+    print(f"Flash: esptool.py --chip esp32s3 write_flash 0x{offset:x} {args.out}")
+
+
+if __name__ == "__main__":
+    main()
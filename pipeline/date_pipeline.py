@@ -2,8 +2,10 @@
 Date Pipeline — Webcam → SenseCAP Display → Date Button → Face Mode
 
 Streams webcam video to the SenseCAP Indicator with a pink "Date" button
-overlay. When the user taps the button (touch) or presses the physical
-button (GPIO38), the pipeline:
+overlay. The button is registered once as a device-side sprite, so the
+frames go out clean (firmware without sprites gets it drawn into every
+frame instead). When the user taps the button (touch) or presses the
+physical button (GPIO38), the pipeline:
 
   1. Captures the current webcam frame
   2. Saves it for the Pi/pipeline to process
@@ -82,13 +84,15 @@ def resize_cover(img: Image.Image, w: int, h: int) -> Image.Image:
     return img.crop((left, top, left + w, top + h))
 
 
-def overlay_button(img: Image.Image) -> Image.Image:
-    """Draw a pink 'Date' button on the bottom of the image."""
+def draw_button(img: Image.Image, left: int, top: int) -> Image.Image:
+    """Draw the pink 'Date' button with its top-left corner at left, top."""
     draw = ImageDraw.Draw(img)
+    right = left + BUTTON_RIGHT - BUTTON_LEFT
+    bottom = top + BUTTON_BOTTOM - BUTTON_TOP
 
     # Rounded rectangle background
     draw.rounded_rectangle(
-        [BUTTON_LEFT, BUTTON_TOP, BUTTON_RIGHT, BUTTON_BOTTOM],
+        [left, top, right, bottom],
         radius=20,
         fill=BUTTON_COLOR,
         outline=BUTTON_BORDER,
@@ -108,17 +112,34 @@ def overlay_button(img: Image.Image) -> Image.Image:
     bbox = draw.textbbox((0, 0), label, font=font)
     tw = bbox[2] - bbox[0]
     th = bbox[3] - bbox[1]
-    tx = (BUTTON_LEFT + BUTTON_RIGHT - tw) // 2
-    ty = (BUTTON_TOP + BUTTON_BOTTOM - th) // 2 - 2
+    tx = (left + right - tw) // 2
+    ty = (top + bottom - th) // 2 - 2
     draw.text((tx, ty), label, fill=TEXT_COLOR, font=font)
 
     return img
 
 
+def overlay_button(img: Image.Image) -> Image.Image:
+    """Draw the 'Date' button on the bottom of the image."""
+    return draw_button(img, BUTTON_LEFT, BUTTON_TOP)
+
+
+def button_sprite() -> bytes:
+    """The 'Date' button alone on a transparent background, as RGBA QOI
+    for the firmware's sprite command (placed at BUTTON_LEFT, BUTTON_TOP)."""
+    sys.path.insert(0, str(Path(__file__).resolve().parent.parent / "Screen" / "controller"))
+    from sensecap_controller import SenseCapController
+
+    size = (BUTTON_RIGHT - BUTTON_LEFT + 1, BUTTON_BOTTOM - BUTTON_TOP + 1)
+    img = draw_button(Image.new("RGBA", size, (0, 0, 0, 0)), 0, 0)
+    return SenseCapController.qoi_encode(img, alpha=True)
+
+
 def image_to_jpeg(img: Image.Image, quality: int = STREAM_QUALITY) -> bytes:
-    """Compress PIL image to JPEG bytes."""
+    """Compress PIL image to JPEG bytes (with restart markers, so the
+    SenseCAP can split the decode across both cores)."""
     buf = io.BytesIO()
-    img.save(buf, format="JPEG", quality=quality)
+    img.save(buf, format="JPEG", quality=quality, restart_marker_rows=1)
     return buf.getvalue()
 
 
@@ -152,24 +173,17 @@ class EventSerial:
 
     def send_jpeg(self, jpeg_bytes: bytes) -> dict:
         """Send a JPEG frame using the image protocol. Returns final status."""
-        length = len(jpeg_bytes)
-
-        # Send image command
-        cmd = json.dumps({"cmd": "image", "len": length}, separators=(",", ":")) + "\n"
-        self.ser.write(cmd.encode("utf-8"))
-        self.ser.flush()
-
-        # Wait for "ready"
-        resp = self._read_until_status(timeout=3)
-        if resp.get("status") != "ready":
-            return resp
+        return self._send_payload({"cmd": "image", "len": len(jpeg_bytes)}, jpeg_bytes)
 
-        # Send raw JPEG bytes
-        self.ser.write(jpeg_bytes)
-        self.ser.flush()
+    def send_sprite(self, sprite: str, x: int, y: int, qoi_bytes: bytes) -> dict:
+        """Register a QOI image the device blends into every frame at x, y."""
+        cmd = {"cmd": "sprite", "id": sprite, "x": x, "y": y, "len": len(qoi_bytes)}
+        return self._send_payload(cmd, qoi_bytes)
 
-        # Wait for "ok"
-        return self._read_until_status(timeout=5)
+    def send_store(self, slot: str, jpeg_bytes: bytes) -> dict:
+        """Keep a JPEG on the device (compressed) under a slot name."""
+        cmd = {"cmd": "store", "slot": slot, "len": len(jpeg_bytes), "keep": "data"}
+        return self._send_payload(cmd, jpeg_bytes)
 
     def collect_events(self) -> list[dict]:
         """Read any buffered serial data and return collected events."""
@@ -184,6 +198,24 @@ class EventSerial:
 
     # --- Internal ---
 
+    def _send_payload(self, cmd: dict, data: bytes) -> dict:
+        """Send a command, wait for "ready", then send its bytes."""
+        line = json.dumps(cmd, separators=(",", ":")) + "\n"
+        self.ser.write(line.encode("utf-8"))
+        self.ser.flush()
+
+        # Wait for "ready"
+        resp = self._read_until_status(timeout=3)
+        if resp.get("status") != "ready":
+            return resp
+
+        # Send the raw bytes
+        self.ser.write(data)
+        self.ser.flush()
+
+        # Wait for "ok"
+        return self._read_until_status(timeout=5)
+
     def _drain_lines(self):
         """Read all available lines, sorting into events vs responses."""
         while self.ser.in_waiting:
@@ -345,6 +377,14 @@ def run_pipeline(
     print("Disabling face mode...")
     link.send_cmd({"cmd": "face", "on": False})
 
+    # The device adds the button to each frame; older firmware does not
+    # know sprites, so then it is drawn here
+    resp = link.send_sprite("date", BUTTON_LEFT, BUTTON_TOP, button_sprite())
+    device_button = resp.get("status") == "ok"
+    if not device_button:
+        print(f"  Device sprites unavailable ({resp.get('msg', resp.get('status'))}), "
+              "drawing the button into each frame")
+
     cam_index: int | None = None
     cam_path: str | None = None
     if isinstance(camera_index, str):
@@ -389,6 +429,7 @@ def run_pipeline(
     print("  Press Ctrl+C to quit.\n")
 
     frame_count = 0
+    fps_t0 = time.time()
     last_pil_frame = None
 
     try:
@@ -425,9 +466,10 @@ def run_pipeline(
             pil_frame = resize_cover(pil_frame, DISPLAY_W, DISPLAY_H)
             last_pil_frame = pil_frame.copy()
 
-            # 3. Overlay button
-            display_frame = pil_frame.copy()
-            overlay_button(display_frame)
+            # 3. Overlay button (unless the device does)
+            display_frame = pil_frame
+            if not device_button:
+                display_frame = overlay_button(pil_frame.copy())
 
             # 4. Send to SenseCAP
             jpeg = image_to_jpeg(display_frame)
@@ -435,8 +477,9 @@ def run_pipeline(
 
             frame_count += 1
             if frame_count % 30 == 0:
-                fps_est = "~2-3" if resp.get("status") == "ok" else "?"
-                print(f"  Streamed {frame_count} frames ({fps_est} fps)")
+                now = time.time()
+                print(f"  Streamed {frame_count} frames ({30 / (now - fps_t0):.1f} fps)")
+                fps_t0 = now
 
             # 5. Check for button/touch events
             events = link.collect_events()
@@ -445,6 +488,8 @@ def run_pipeline(
                     print(f"  Touch: x={ev.get('x')}, y={ev.get('y')}")
                 elif ev.get("event") == "button":
                     print("  Button: physical press")
+                elif ev.get("event") == "image_error":
+                    print(f"  Frame not shown: {ev.get('msg')}")
 
             date_pressed = any(is_button_touch(ev, touch_anywhere) for ev in events)
 
@@ -464,6 +509,8 @@ def run_pipeline(
 
     # --- Date Button Pressed ---
     cap.release()
+    if device_button:
+        link.send_cmd({"cmd": "sprite", "clear": True})
 
     # Save captured frame
     timestamp = int(time.time())
@@ -475,6 +522,13 @@ def run_pipeline(
         print("  Warning: No frame captured")
         frame_path = ""
 
+    # Keep it on the device too, for its gallery of past dates (the slot
+    # cache drops the least recently used when it fills up)
+    if last_pil_frame:
+        resp = link.send_store(f"date-{timestamp}", image_to_jpeg(last_pil_frame, quality=80))
+        if resp.get("status") != "ok":
+            print(f"  Not kept on device: {resp.get('msg', resp.get('status'))}")
+
     # Call the processing callback (e.g., send to Gemini on Pi)
     capture_result = {}
     if on_capture and frame_path:
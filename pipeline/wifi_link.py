@@ -88,22 +88,17 @@ class WiFiLink:
 
     def send_jpeg(self, jpeg_bytes: bytes) -> dict:
         """Send a JPEG frame using the image protocol. Returns final status."""
-        length = len(jpeg_bytes)
+        return self._send_payload({"cmd": "image", "len": len(jpeg_bytes)}, jpeg_bytes)
 
-        # Send image command
-        cmd = json.dumps({"cmd": "image", "len": length}, separators=(",", ":")) + "\n"
-        self._send_all(cmd.encode("utf-8"))
+    def send_sprite(self, sprite: str, x: int, y: int, qoi_bytes: bytes) -> dict:
+        """Register a QOI image the device blends into every frame at x, y."""
+        cmd = {"cmd": "sprite", "id": sprite, "x": x, "y": y, "len": len(qoi_bytes)}
+        return self._send_payload(cmd, qoi_bytes)
 
-        # Wait for "ready"
-        resp = self._read_until_status(timeout=3)
-        if resp.get("status") != "ready":
-            return resp
-
-        # Send raw JPEG bytes
-        self._send_all(jpeg_bytes)
-
-        # Wait for "ok"
-        return self._read_until_status(timeout=10)
+    def send_store(self, slot: str, jpeg_bytes: bytes) -> dict:
+        """Keep a JPEG on the device (compressed) under a slot name."""
+        cmd = {"cmd": "store", "slot": slot, "len": len(jpeg_bytes), "keep": "data"}
+        return self._send_payload(cmd, jpeg_bytes)
 
     def send_raw_line(self, line: str):
         """Send a raw line without waiting for a response (fire-and-forget)."""
@@ -120,6 +115,22 @@ class WiFiLink:
 
     # --- Internal helpers ---
 
+    def _send_payload(self, cmd: dict, data: bytes) -> dict:
+        """Send a command, wait for "ready", then send its bytes."""
+        line = json.dumps(cmd, separators=(",", ":")) + "\n"
+        self._send_all(line.encode("utf-8"))
+
+        # Wait for "ready"
+        resp = self._read_until_status(timeout=3)
+        if resp.get("status") != "ready":
+            return resp
+
+        # Send the raw bytes
+        self._send_all(data)
+
+        # Wait for "ok"
+        return self._read_until_status(timeout=10)
+
     def _send_all(self, data: bytes):
         """Send all bytes, retrying on partial sends."""
         if not self.sock: